@@ -15,11 +15,6 @@
 #include <ArduinoBearSSL.h>
 #include "AES128.h"
 
-#ifdef ARDUINO_ARCH_MEGAAVR
-// Create the object
-AES128Class AES128;
-#endif
-
 uint8_t key[16] = {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x02};
 uint8_t enc_iv[16] = {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01};
 uint8_t dec_iv[16] = {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01};
@@ -0,0 +1,90 @@
+/*
+  ArduinoCrypto AES Benchmark Example
+
+  This sketch measures AES-CBC (chained, one block at a time) against
+  AES-CTR (parallel, so the bitsliced implementations encrypt several
+  blocks at once) for each bearssl AES implementation, and prints the
+  throughput in bytes per second and cycles per byte.
+
+  Circuit:
+  - Nano 33 IoT (SAMD21) or any SAMD51 board
+
+  This example code is in the public domain.
+*/
+
+#include <ArduinoBearSSL.h>
+#include "AES128.h"
+#include "AESCTR.h"
+
+#define BUFFER_SIZE 1024
+#define ROUNDS 16
+
+uint8_t key[16] = {0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0x0c,0x0d,0x0e,0x0f};
+uint8_t iv[16];
+uint8_t buffer[BUFFER_SIZE];
+
+const char* names[] = { "ct", "ct64", "small", "big" };
+
+const br_block_cbcenc_class* cbcenc[] = {
+  &br_aes_ct_cbcenc_vtable,
+  &br_aes_ct64_cbcenc_vtable,
+  &br_aes_small_cbcenc_vtable,
+  &br_aes_big_cbcenc_vtable
+};
+
+const br_block_cbcdec_class* cbcdec[] = {
+  &br_aes_ct_cbcdec_vtable,
+  &br_aes_ct64_cbcdec_vtable,
+  &br_aes_small_cbcdec_vtable,
+  &br_aes_big_cbcdec_vtable
+};
+
+const br_block_ctr_class* ctr[] = {
+  &br_aes_ct_ctr_vtable,
+  &br_aes_ct64_ctr_vtable,
+  &br_aes_small_ctr_vtable,
+  &br_aes_big_ctr_vtable
+};
+
+void setup() {
+  Serial.begin(9600);
+  while (!Serial);
+}
+
+void loop() {
+  for (int i = 0; i < 4; i++) {
+    unsigned long start;
+
+    AES128.setImplementation(cbcenc[i], cbcdec[i]);
+    AES128.setKey(key, 16);
+    start = micros();
+    for (int r = 0; r < ROUNDS; r++) {
+      AES128.encrypt(buffer, BUFFER_SIZE, iv);
+    }
+    printResult("CBC", names[i], micros() - start);
+
+    AESCTR.setImplementation(ctr[i]);
+    AESCTR.setKey(key, 16);
+    start = micros();
+    for (int r = 0; r < ROUNDS; r++) {
+      AESCTR.run(iv, r * (BUFFER_SIZE / 16), buffer, BUFFER_SIZE);
+    }
+    printResult("CTR", names[i], micros() - start);
+  }
+
+  Serial.println();
+  while (1);
+}
+
+void printResult(const char* mode, const char* name, unsigned long elapsed) {
+  float bytes = (float)BUFFER_SIZE * ROUNDS;
+
+  Serial.print(mode);
+  Serial.print(" ");
+  Serial.print(name);
+  Serial.print(": ");
+  Serial.print(bytes * 1000000.0 / elapsed, 0);
+  Serial.print(" bytes/s, ");
+  Serial.print((float)elapsed * (F_CPU / 1000000) / bytes, 1);
+  Serial.println(" cycles/byte");
+}
@@ -0,0 +1,65 @@
+/*
+  ArduinoCrypto AES-GCM Example
+
+  This sketch demonstrates how to run AES-GCM authenticated encryption
+  and decryption for an input buffer, with the key expanded only once.
+
+  Circuit:
+  - Nano 33 IoT board
+
+  This example code is in the public domain.
+*/
+
+#include <ArduinoBearSSL.h>
+#include "AESGCM.h"
+
+uint8_t key[16] = {0xfe,0xff,0xe9,0x92,0x86,0x65,0x73,0x1c,0x6d,0x6a,0x8f,0x94,0x67,0x30,0x83,0x08};
+uint8_t iv[12] = {0xca,0xfe,0xba,0xbe,0xfa,0xce,0xdb,0xad,0xde,0xca,0xf8,0x88};
+uint8_t aad[8] = "header";
+uint8_t input[16] = "ArduinoArduino";
+uint8_t tag[16];
+
+void setup() {
+  Serial.begin(9600);
+  while (!Serial);
+
+  AESGCM.setKey(key, 16);
+}
+
+void loop() {
+
+  Serial.print("Key: ");
+  printHex(key, 16);
+  Serial.println(" ");
+  Serial.print("IV: ");
+  printHex(iv, 12);
+  Serial.println(" ");
+  Serial.print("AES-GCM Encryption of '");
+  printHex(input, 16);
+  Serial.print("' is 0x");
+  AESGCM.encrypt(iv, 12, aad, sizeof(aad), input, 16, tag);
+  printHex(input, 16);
+  Serial.print(" with tag 0x");
+  printHex(tag, 16);
+  Serial.println(" ");
+  Serial.println(" ");
+  Serial.print("AES-GCM Decryption of '");
+  printHex(input, 16);
+  Serial.print("' is 0x");
+  if (AESGCM.decrypt(iv, 12, aad, sizeof(aad), input, 16, tag)) {
+    printHex(input, 16);
+  } else {
+    Serial.print(" (authentication failed)");
+  }
+  Serial.println(" ");
+  while (1);
+}
+
+void printHex(uint8_t *text, size_t size) {
+  for (byte i = 0; i < size; i = i + 1) {
+    if (text[i] < 16) {
+      Serial.print("0");
+    }
+    Serial.print(text[i], HEX);
+  }
+}
@@ -0,0 +1,342 @@
+/*
+  ArduinoBearSSL Crypto Benchmark Example
+
+  This sketch measures every implementation of the symmetric ciphers,
+  MACs, hash functions, elliptic curves and RSA that the library
+  compiles, and prints one table per board in operations per second,
+  bytes per second and cycles per byte (cycles per operation for the
+  public key algorithms). Each line runs for about one second; the RSA
+  private key operations take several seconds on Cortex-M0+ boards.
+
+  Compare the tables of the boards you target to choose the default
+  implementations (e.g. with BEAR_SSL_AES, or the br_*_get_default()
+  functions) with data. CBC encryption chains one block to the next,
+  decryption does not: the bitsliced ct and ct64 implementations decrypt
+  two and four blocks per pass, as the TLS record layer does for the
+  legacy CBC suites. Run it once more with BR_FAST_RAM enabled in
+  src/bearssl/config.h to see what running the AES, GHASH, SHA-256,
+  ChaCha20, Poly1305 and P-256 inner loops from RAM gains on your board,
+  and with BR_ARM_UNALIGNED set to 0 to see what the word loads and
+  stores of the hash and AES-GCM code gain on Cortex-M3/M4/M7.
+
+  benchmark_key.h holds a 2048-bit RSA test key generated with
+  extras/generate_der.py; do not use it for anything else.
+
+  Circuit:
+  - any 32-bit board (e.g. Nano 33 IoT, MKR boards, SAMD51, Nano 33 BLE)
+
+  This example code is in the public domain.
+*/
+
+#include <ArduinoBearSSL.h>
+#include "benchmark_key.h"
+
+#define BUFFER_SIZE 1024
+#define DURATION 1000000UL // microseconds per measurement
+
+typedef void (*Operation)(void* context);
+
+uint8_t buffer[BUFFER_SIZE];
+
+const uint8_t key[32] = {
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+  0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f
+};
+
+const uint8_t iv[16] = {
+  0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff
+};
+
+br_skey_decoder_context keyDecoder;
+
+void setup() {
+  Serial.begin(9600);
+  while (!Serial);
+}
+
+void loop() {
+  Serial.print("Board: ");
+#ifdef ARDUINO_BOARD
+  Serial.print(ARDUINO_BOARD);
+  Serial.print(", ");
+#endif
+  Serial.print(F_CPU / 1000000);
+  Serial.println(" MHz");
+  Serial.println();
+
+  printColumn("Primitive", 28);
+  printColumn("ops/s", 12);
+  printColumn("bytes/s", 12);
+  Serial.println("cycles");
+
+  benchAes("AES-128-CTR ct", &br_aes_ct_ctr_vtable);
+  benchAes("AES-128-CTR ct64", &br_aes_ct64_ctr_vtable);
+  benchAes("AES-128-CTR small", &br_aes_small_ctr_vtable);
+  benchAes("AES-128-CTR big", &br_aes_big_ctr_vtable);
+
+  benchAesCbcEnc("AES-128-CBC enc ct", &br_aes_ct_cbcenc_vtable);
+  benchAesCbcDec("AES-128-CBC dec ct", &br_aes_ct_cbcdec_vtable);
+  benchAesCbcDec("AES-128-CBC dec ct64", &br_aes_ct64_cbcdec_vtable);
+  benchAesCbcDec("AES-128-CBC dec small", &br_aes_small_cbcdec_vtable);
+  benchAesCbcDec("AES-128-CBC dec big", &br_aes_big_cbcdec_vtable);
+
+  benchGhash("GHASH ctmul", &br_ghash_ctmul);
+  benchGhash("GHASH ctmul32", &br_ghash_ctmul32);
+  benchGhash("GHASH ctmul64", &br_ghash_ctmul64);
+
+  benchGcm("AES-128-GCM ct+ctmul", &br_aes_ct_ctr_vtable, &br_ghash_ctmul);
+  benchGcm("AES-128-GCM ct+ctmul32", &br_aes_ct_ctr_vtable, &br_ghash_ctmul32);
+  benchGcm("AES-128-GCM big+ctmul", &br_aes_big_ctr_vtable, &br_ghash_ctmul);
+
+  benchChaCha20("ChaCha20 ct", &br_chacha20_ct_run);
+  benchPoly1305("ChaCha20+Poly1305 ctmul", &br_poly1305_ctmul_run);
+  benchPoly1305("ChaCha20+Poly1305 ctmul32", &br_poly1305_ctmul32_run);
+  benchPoly1305("ChaCha20+Poly1305 i15", &br_poly1305_i15_run);
+
+  benchHash("MD5", &br_md5_vtable);
+  benchHash("SHA1", &br_sha1_vtable);
+  benchHash("SHA256", &br_sha256_vtable);
+  benchHash("SHA384", &br_sha384_vtable);
+
+  benchEc("P-256 mul m15", &br_ec_p256_m15, BR_EC_secp256r1);
+  benchEc("P-256 mul m31", &br_ec_p256_m31, BR_EC_secp256r1);
+  benchEc("P-256 mul prime_i15", &br_ec_prime_i15, BR_EC_secp256r1);
+  benchEc("P-256 mul prime_i31", &br_ec_prime_i31, BR_EC_secp256r1);
+  benchEc("X25519 mul m15", &br_ec_c25519_m15, BR_EC_curve25519);
+  benchEc("X25519 mul m31", &br_ec_c25519_m31, BR_EC_curve25519);
+  benchEc("X25519 mul i15", &br_ec_c25519_i15, BR_EC_curve25519);
+  benchEc("X25519 mul i31", &br_ec_c25519_i31, BR_EC_curve25519);
+
+  benchRsa("RSA-2048 i15", &br_rsa_i15_public, &br_rsa_i15_private);
+  benchRsa("RSA-2048 i31", &br_rsa_i31_public, &br_rsa_i31_private);
+  benchRsa("RSA-2048 i32", &br_rsa_i32_public, &br_rsa_i32_private);
+
+  Serial.println();
+  while (1);
+}
+
+void aesRun(void* context) {
+  const br_block_ctr_class** vtable = (const br_block_ctr_class**)context;
+
+  (*vtable)->run(vtable, iv, 0, buffer, BUFFER_SIZE);
+}
+
+void benchAes(const char* name, const br_block_ctr_class* vtable) {
+  br_aes_gen_ctr_keys context;
+
+  vtable->init(&context.vtable, key, 16);
+  measure(name, BUFFER_SIZE, aesRun, &context.vtable);
+}
+
+void aesCbcEncRun(void* context) {
+  const br_block_cbcenc_class** vtable = (const br_block_cbcenc_class**)context;
+  uint8_t chain[16];
+
+  memcpy(chain, iv, sizeof(chain));
+  (*vtable)->run(vtable, chain, buffer, BUFFER_SIZE);
+}
+
+void benchAesCbcEnc(const char* name, const br_block_cbcenc_class* vtable) {
+  br_aes_gen_cbcenc_keys context;
+
+  vtable->init(&context.vtable, key, 16);
+  measure(name, BUFFER_SIZE, aesCbcEncRun, &context.vtable);
+}
+
+void aesCbcDecRun(void* context) {
+  const br_block_cbcdec_class** vtable = (const br_block_cbcdec_class**)context;
+  uint8_t chain[16];
+
+  memcpy(chain, iv, sizeof(chain));
+  (*vtable)->run(vtable, chain, buffer, BUFFER_SIZE);
+}
+
+void benchAesCbcDec(const char* name, const br_block_cbcdec_class* vtable) {
+  br_aes_gen_cbcdec_keys context;
+
+  vtable->init(&context.vtable, key, 16);
+  measure(name, BUFFER_SIZE, aesCbcDecRun, &context.vtable);
+}
+
+void ghashRun(void* context) {
+  uint8_t y[16] = { 0 };
+
+  (*(br_ghash*)context)(y, key, buffer, BUFFER_SIZE);
+}
+
+void benchGhash(const char* name, br_ghash ghash) {
+  measure(name, BUFFER_SIZE, ghashRun, &ghash);
+}
+
+struct GcmContext {
+  br_aes_gen_ctr_keys aes;
+  br_gcm_context gcm;
+};
+
+void gcmRun(void* context) {
+  br_gcm_context* gcm = &((GcmContext*)context)->gcm;
+  uint8_t tag[16];
+
+  // one record: nonce, encryption and tag
+  br_gcm_reset(gcm, iv, 12);
+  br_gcm_flip(gcm);
+  br_gcm_run(gcm, 1, buffer, BUFFER_SIZE);
+  br_gcm_get_tag(gcm, tag);
+}
+
+void benchGcm(const char* name, const br_block_ctr_class* vtable, br_ghash ghash) {
+  GcmContext context;
+
+  vtable->init(&context.aes.vtable, key, 16);
+  br_gcm_init(&context.gcm, &context.aes.vtable, ghash);
+  measure(name, BUFFER_SIZE, gcmRun, &context);
+}
+
+void chacha20Run(void* context) {
+  (*(br_chacha20_run*)context)(key, iv, 0, buffer, BUFFER_SIZE);
+}
+
+void benchChaCha20(const char* name, br_chacha20_run run) {
+  measure(name, BUFFER_SIZE, chacha20Run, &run);
+}
+
+void poly1305Run(void* context) {
+  uint8_t tag[16];
+
+  (*(br_poly1305_run*)context)(key, iv, buffer, BUFFER_SIZE, NULL, 0, tag, br_chacha20_ct_run, 1);
+}
+
+void benchPoly1305(const char* name, br_poly1305_run run) {
+  measure(name, BUFFER_SIZE, poly1305Run, &run);
+}
+
+void hashRun(void* context) {
+  const br_hash_class** vtable = (const br_hash_class**)context;
+
+  (*vtable)->update(vtable, buffer, BUFFER_SIZE);
+}
+
+void benchHash(const char* name, const br_hash_class* vtable) {
+  br_hash_compat_context context;
+
+  vtable->init(&context.vtable);
+  measure(name, BUFFER_SIZE, hashRun, &context.vtable);
+}
+
+struct EcContext {
+  const br_ec_impl* impl;
+  int curve;
+  const uint8_t* generator;
+  size_t generatorLength;
+};
+
+void ecRun(void* context) {
+  EcContext* ec = (EcContext*)context;
+  uint8_t point[65];
+
+  // one ECDH: a scalar multiplication of an arbitrary point
+  memcpy(point, ec->generator, ec->generatorLength);
+  ec->impl->mul(point, ec->generatorLength, key, 32, ec->curve);
+}
+
+void benchEc(const char* name, const br_ec_impl* impl, int curve) {
+  EcContext context = { impl, curve, NULL, 0 };
+
+  context.generator = impl->generator(curve, &context.generatorLength);
+  measure(name, 0, ecRun, &context);
+}
+
+struct RsaContext {
+  br_rsa_public publicOperation;
+  br_rsa_private privateOperation;
+  br_rsa_public_key pk;
+  const br_rsa_private_key* sk;
+  uint8_t n[256];
+  uint8_t e[4];
+  uint8_t x[256];
+};
+
+void rsaPublicRun(void* context) {
+  RsaContext* rsa = (RsaContext*)context;
+
+  rsa->publicOperation(rsa->x, rsa->pk.nlen, &rsa->pk);
+}
+
+void rsaPrivateRun(void* context) {
+  RsaContext* rsa = (RsaContext*)context;
+
+  rsa->privateOperation(rsa->x, rsa->sk);
+}
+
+void benchRsa(const char* name, br_rsa_public publicOperation, br_rsa_private privateOperation) {
+  static RsaContext context;
+
+  br_skey_decoder_init(&keyDecoder);
+  br_skey_decoder_push(&keyDecoder, BENCHMARK_KEY, sizeof(BENCHMARK_KEY));
+
+  context.publicOperation = publicOperation;
+  context.privateOperation = privateOperation;
+  context.sk = br_skey_decoder_get_rsa(&keyDecoder);
+  if (context.sk == NULL) {
+    Serial.println("RSA key decoding failed");
+    return;
+  }
+
+  uint32_t exponent = br_rsa_compute_pubexp_get_default()(context.sk);
+
+  context.e[0] = exponent >> 24;
+  context.e[1] = exponent >> 16;
+  context.e[2] = exponent >> 8;
+  context.e[3] = exponent;
+  context.pk.n = context.n;
+  context.pk.nlen = br_rsa_compute_modulus_get_default()(context.n, context.sk);
+  context.pk.e = context.e;
+  context.pk.elen = sizeof(context.e);
+
+  // any value below the modulus will do, the results stay below it
+  memcpy(context.x, buffer, context.pk.nlen);
+  context.x[0] = 0x00;
+
+  String label = name;
+
+  measure((label + " public").c_str(), 0, rsaPublicRun, &context);
+  measure((label + " private").c_str(), 0, rsaPrivateRun, &context);
+}
+
+void measure(const char* name, size_t bytes, Operation operation, void* context) {
+  unsigned long count = 0;
+  unsigned long start = micros();
+  unsigned long elapsed;
+
+  do {
+    operation(context);
+    count++;
+    elapsed = micros() - start;
+  } while (elapsed < DURATION);
+
+  printResult(name, count, bytes, elapsed);
+}
+
+void printResult(const char* name, unsigned long count, size_t bytes, unsigned long elapsed) {
+  float seconds = elapsed / 1000000.0;
+  float cycles = (float)elapsed * (F_CPU / 1000000) / count;
+
+  printColumn(name, 28);
+  printColumn(String(count / seconds, 1), 12);
+  if (bytes) {
+    printColumn(String(count * bytes / seconds, 0), 12);
+    Serial.print(cycles / bytes, 1);
+    Serial.println(" /byte");
+  } else {
+    printColumn("-", 12);
+    Serial.print(cycles, 0);
+    Serial.println(" /op");
+  }
+}
+
+void printColumn(const String& text, unsigned int width) {
+  Serial.print(text);
+  for (unsigned int i = text.length(); i < width; i++) {
+    Serial.print(' ');
+  }
+}
@@ -0,0 +1,111 @@
+// generated by extras/generate_der.py from benchmark_key.pem
+
+#ifndef _BENCHMARK_KEY_H_
+#define _BENCHMARK_KEY_H_
+
+#include "bearssl/bearssl_x509.h"
+
+static const unsigned char BENCHMARK_KEY[] = {
+  0x30, 0x82, 0x04, 0xA5, 0x02, 0x01, 0x00, 0x02, 0x82, 0x01, 0x01, 0x00,
+  0xBA, 0x39, 0x4E, 0xEF, 0x01, 0x16, 0x9E, 0xEC, 0xE4, 0x66, 0x7F, 0x33,
+  0x67, 0xAE, 0xEC, 0x0F, 0x69, 0x0C, 0x6A, 0xC2, 0xC2, 0x30, 0xD5, 0xE8,
+  0x88, 0x4A, 0xAF, 0xED, 0x8A, 0xCA, 0xF8, 0x6A, 0x38, 0xAB, 0xE2, 0xA3,
+  0x7D, 0x64, 0xD7, 0xE5, 0xA1, 0x3F, 0xB6, 0x00, 0xA9, 0xBB, 0xBB, 0xAA,
+  0x34, 0x2F, 0xD9, 0xD2, 0xC9, 0x89, 0x75, 0x54, 0x69, 0xFB, 0x26, 0x5E,
+  0xE8, 0x7C, 0x12, 0x2E, 0x16, 0x37, 0xA5, 0x15, 0x95, 0xED, 0x63, 0xAA,
+  0x1E, 0xFB, 0x7B, 0xD6, 0x37, 0x46, 0xD4, 0x6C, 0xB8, 0x23, 0x9D, 0xF4,
+  0xEB, 0x36, 0x5C, 0x6F, 0xE8, 0x71, 0xAB, 0x53, 0x65, 0xCE, 0x70, 0xAD,
+  0x61, 0x15, 0x59, 0x83, 0x3C, 0x28, 0x88, 0x38, 0x6F, 0x37, 0x9C, 0xD2,
+  0x02, 0xC7, 0xA9, 0xFC, 0x42, 0x0C, 0x2E, 0xA2, 0xC8, 0xC9, 0xF7, 0x57,
+  0x8D, 0xE1, 0x67, 0x1A, 0xA0, 0x0D, 0x04, 0x0F, 0x27, 0x42, 0x87, 0x03,
+  0x2D, 0xC7, 0xD1, 0x88, 0x9B, 0x50, 0x04, 0xB5, 0x37, 0xDE, 0x39, 0xF7,
+  0xC4, 0x1F, 0xFB, 0x3F, 0x40, 0xFA, 0x1D, 0x1A, 0x2C, 0x45, 0x78, 0x0F,
+  0x8D, 0x58, 0xA7, 0x90, 0x59, 0x46, 0x60, 0x34, 0xBF, 0xB6, 0x32, 0xD8,
+  0x27, 0x31, 0x27, 0xD5, 0x67, 0x60, 0x9C, 0x7F, 0x37, 0xE5, 0x17, 0x66,
+  0x34, 0xA3, 0x77, 0xBD, 0xF2, 0xBB, 0x65, 0x34, 0xD9, 0x14, 0x28, 0x42,
+  0x01, 0xF7, 0xC3, 0x22, 0x2F, 0x6C, 0xAA, 0x22, 0x5F, 0x4F, 0x3B, 0x6F,
+  0x20, 0xDF, 0xF5, 0x24, 0x8E, 0x26, 0x7E, 0xCC, 0x4C, 0x1C, 0x23, 0x74,
+  0x2C, 0x52, 0x2F, 0x0C, 0x9C, 0xB9, 0x4C, 0x3C, 0xDB, 0x05, 0x99, 0xDB,
+  0xFA, 0x7D, 0x1A, 0xD1, 0xCB, 0x06, 0xA4, 0x4F, 0xEA, 0xB7, 0xA9, 0xDE,
+  0xAE, 0xB3, 0xEC, 0x1A, 0x27, 0xD5, 0x83, 0x1C, 0x75, 0x25, 0x5D, 0x0D,
+  0xD2, 0xD1, 0x7E, 0x47, 0x02, 0x03, 0x01, 0x00, 0x01, 0x02, 0x82, 0x01,
+  0x00, 0x10, 0xCD, 0xFF, 0x1B, 0x7E, 0x43, 0xA6, 0x4F, 0xC6, 0x44, 0xA1,
+  0x91, 0xE7, 0xF7, 0x57, 0x02, 0x04, 0xFE, 0xC3, 0xDB, 0x93, 0x5E, 0x88,
+  0xCF, 0x15, 0x0D, 0x78, 0x56, 0xBD, 0x41, 0x97, 0xAD, 0x2E, 0x34, 0x04,
+  0x9D, 0xB0, 0x41, 0x1B, 0x62, 0x73, 0x6C, 0xA6, 0x65, 0xE4, 0xEB, 0x36,
+  0x02, 0x23, 0xF7, 0x75, 0x76, 0x9A, 0x0D, 0x37, 0x73, 0x48, 0xA5, 0x0B,
+  0x4F, 0x61, 0x37, 0x61, 0x04, 0x9B, 0xA8, 0xA5, 0xD3, 0x0E, 0xD6, 0x7F,
+  0x39, 0xE8, 0xD5, 0xD4, 0xD4, 0xFD, 0xE3, 0xFC, 0x63, 0x5B, 0x32, 0x8B,
+  0x9C, 0x80, 0x65, 0x45, 0x6E, 0x2B, 0xD1, 0xA6, 0x1E, 0x3E, 0x7F, 0xA4,
+  0x97, 0x60, 0xBD, 0x66, 0x78, 0x7B, 0x43, 0x45, 0x17, 0xA2, 0xA1, 0xA8,
+  0x1B, 0x23, 0x79, 0x15, 0x13, 0xD8, 0x79, 0xF4, 0xF3, 0x67, 0x9F, 0x22,
+  0x1C, 0xDA, 0x86, 0xCE, 0xA1, 0x0E, 0x74, 0x5E, 0x3B, 0x3F, 0xFE, 0xC9,
+  0xBF, 0x96, 0xE2, 0x8D, 0xD9, 0x33, 0x2F, 0x5F, 0x89, 0xC4, 0x98, 0xCE,
+  0xC3, 0xB7, 0x94, 0x1C, 0x3F, 0x9E, 0x07, 0x6B, 0xC0, 0x41, 0xF3, 0xF1,
+  0x68, 0x6C, 0x35, 0x8A, 0x21, 0xCF, 0xA4, 0x6A, 0x36, 0xCE, 0xD8, 0x14,
+  0x87, 0xC9, 0x19, 0xF0, 0x71, 0xB1, 0xB4, 0x8A, 0xFF, 0xC6, 0x4C, 0xD0,
+  0x7E, 0xA3, 0xBA, 0x4B, 0x58, 0x68, 0xE6, 0xE5, 0x32, 0x3B, 0x6C, 0x74,
+  0xAB, 0x29, 0x88, 0x7F, 0x7F, 0xA1, 0xB3, 0x50, 0x02, 0x2B, 0x9C, 0x45,
+  0xB0, 0x8F, 0x72, 0x0D, 0x8B, 0x7D, 0xD7, 0x07, 0x08, 0x23, 0x5F, 0x61,
+  0x30, 0x19, 0x99, 0x5D, 0x20, 0x5A, 0x04, 0xD0, 0xE9, 0xC2, 0xED, 0xF5,
+  0x3D, 0xAA, 0xFD, 0x77, 0x10, 0x9D, 0x0B, 0x17, 0x77, 0xA2, 0x3C, 0xE9,
+  0x24, 0x2B, 0x30, 0x86, 0x0A, 0x84, 0x77, 0xF3, 0x50, 0xAE, 0xDA, 0xF0,
+  0x35, 0xFC, 0xFA, 0x23, 0x71, 0x02, 0x81, 0x81, 0x00, 0xFD, 0x32, 0x18,
+  0x0D, 0x78, 0x07, 0x4D, 0x7A, 0x34, 0x98, 0x5F, 0x8A, 0x21, 0x94, 0x87,
+  0x9B, 0x7D, 0x2E, 0xB4, 0x21, 0x91, 0xB0, 0xE8, 0x92, 0x5E, 0xD3, 0x35,
+  0x8E, 0x23, 0x6C, 0x85, 0x46, 0x5B, 0x35, 0x83, 0x98, 0x58, 0xFF, 0x2D,
+  0x60, 0xBA, 0x4B, 0xFA, 0x77, 0x3A, 0x4D, 0x43, 0x41, 0xDA, 0x30, 0x72,
+  0x40, 0x2E, 0xAD, 0xEE, 0x45, 0x66, 0x2A, 0x6F, 0x26, 0xB3, 0x3A, 0x7B,
+  0x58, 0x4D, 0x1E, 0x4D, 0x85, 0x9B, 0x89, 0x87, 0xE6, 0x87, 0x20, 0xF0,
+  0x00, 0xDB, 0x24, 0x84, 0x55, 0xA6, 0x61, 0x0D, 0x48, 0xEB, 0x5A, 0x01,
+  0x91, 0x72, 0x8B, 0x7C, 0x3E, 0x66, 0x00, 0x2D, 0xCA, 0xAF, 0xD7, 0xC7,
+  0xB8, 0x5F, 0x9A, 0x59, 0x91, 0x39, 0xF8, 0x92, 0x22, 0xE7, 0x36, 0x54,
+  0xA0, 0xA5, 0x5B, 0x4E, 0xEC, 0xCF, 0xDB, 0x23, 0x4C, 0xD0, 0xB0, 0x12,
+  0x7D, 0x45, 0xFC, 0x83, 0x23, 0x02, 0x81, 0x81, 0x00, 0xBC, 0x49, 0x52,
+  0xE4, 0xB6, 0xC8, 0xE1, 0xBD, 0x7F, 0x05, 0x19, 0x0A, 0xB3, 0xD3, 0xFB,
+  0xC0, 0xB0, 0x39, 0x66, 0xD0, 0x5C, 0xA6, 0x32, 0x08, 0xA3, 0x46, 0xA7,
+  0x6F, 0x6C, 0x42, 0xF3, 0xFF, 0xFB, 0x32, 0xFA, 0x6D, 0x15, 0xFD, 0x42,
+  0x97, 0xFE, 0x43, 0xE8, 0xBA, 0xFA, 0x28, 0xE0, 0x05, 0xA4, 0x7F, 0x74,
+  0x41, 0xFA, 0x25, 0x05, 0x11, 0x83, 0xDA, 0x32, 0xDE, 0x3E, 0xD7, 0x29,
+  0x29, 0xD9, 0x66, 0x02, 0xE5, 0x29, 0x5C, 0x2D, 0x56, 0x70, 0x72, 0x1C,
+  0xD1, 0x59, 0xCA, 0x76, 0x32, 0x0F, 0x3A, 0x05, 0x6B, 0x08, 0x79, 0x36,
+  0x6D, 0x1F, 0xB2, 0x7E, 0xC9, 0x67, 0x11, 0x4C, 0x37, 0xFF, 0x62, 0x73,
+  0x5B, 0x43, 0x23, 0x13, 0xC1, 0x09, 0xC0, 0x90, 0xA1, 0x1F, 0x5B, 0xC9,
+  0x60, 0xD3, 0x35, 0x10, 0xB5, 0x6A, 0x92, 0x3C, 0x1D, 0x77, 0x1C, 0x12,
+  0xDB, 0x78, 0xD3, 0xEC, 0x8D, 0x02, 0x81, 0x81, 0x00, 0xA1, 0xA9, 0xFB,
+  0x8B, 0x96, 0x08, 0xEB, 0xA2, 0x4C, 0xB4, 0xC1, 0xC3, 0xDB, 0xBF, 0x0F,
+  0x7A, 0xEB, 0x4A, 0x07, 0xBF, 0xAB, 0x5B, 0x8E, 0x93, 0xEE, 0xB1, 0xE2,
+  0xEF, 0x17, 0x95, 0x31, 0xDF, 0x83, 0x5B, 0x3E, 0xE3, 0xE6, 0x67, 0x40,
+  0x1D, 0x13, 0xB6, 0x71, 0x7C, 0xF1, 0x1F, 0xE6, 0x02, 0xC5, 0x02, 0xCB,
+  0xE0, 0x49, 0x2D, 0xCB, 0x06, 0x4A, 0xBE, 0x6B, 0x6C, 0x05, 0x62, 0x20,
+  0xE1, 0x77, 0x94, 0x12, 0xA1, 0x6D, 0x77, 0x39, 0xEB, 0xAA, 0x7A, 0x10,
+  0x64, 0x2B, 0x88, 0x3C, 0x6A, 0xC7, 0xAA, 0x0E, 0x26, 0x72, 0x07, 0x6D,
+  0x1A, 0xE6, 0x4D, 0x43, 0x8E, 0x3F, 0xE8, 0x7B, 0x54, 0x80, 0x44, 0x41,
+  0x84, 0x6A, 0x9E, 0x8D, 0xF3, 0xD9, 0x54, 0xEA, 0x52, 0x18, 0xD9, 0x2A,
+  0xDD, 0xCB, 0xD6, 0xEA, 0x24, 0xF0, 0x6E, 0x96, 0x32, 0x74, 0xC9, 0x07,
+  0x75, 0x2F, 0x5B, 0x94, 0x8B, 0x02, 0x81, 0x81, 0x00, 0x81, 0x14, 0x7F,
+  0x88, 0x9E, 0xAA, 0xCE, 0xDF, 0x7B, 0x72, 0x02, 0x3D, 0xED, 0x14, 0x99,
+  0xD5, 0xFA, 0xBA, 0x0F, 0x7B, 0x2E, 0xD9, 0x1D, 0x1A, 0x00, 0xDD, 0x92,
+  0x31, 0xF7, 0xF5, 0x5A, 0x93, 0x96, 0x21, 0xD7, 0xBE, 0xEB, 0x41, 0x49,
+  0xE3, 0x2B, 0x84, 0x60, 0xCB, 0xB6, 0x6E, 0x49, 0x4E, 0x74, 0xFC, 0x8F,
+  0xB6, 0x1F, 0x88, 0x3B, 0x96, 0x4B, 0x5F, 0x4E, 0x5A, 0x40, 0x98, 0x7E,
+  0xF6, 0xDA, 0xBC, 0x6D, 0xA5, 0xAF, 0x1A, 0x2B, 0x56, 0xC4, 0x15, 0xE7,
+  0x1D, 0xBA, 0xC1, 0xEB, 0x0F, 0xDC, 0x92, 0x79, 0x5E, 0x6C, 0x5B, 0xB4,
+  0xED, 0x50, 0xBA, 0xAC, 0xE2, 0xE4, 0x0E, 0xDE, 0xC2, 0xD1, 0x09, 0x2C,
+  0x6E, 0x57, 0x73, 0x77, 0xBA, 0x72, 0x36, 0x1A, 0xB0, 0xEA, 0xEF, 0xA0,
+  0xFA, 0x09, 0x31, 0xAA, 0xF7, 0xC4, 0x4C, 0xE6, 0x7B, 0x88, 0xC9, 0xAD,
+  0x3F, 0xDA, 0xF0, 0xE6, 0x8D, 0x02, 0x81, 0x81, 0x00, 0xB8, 0x43, 0x24,
+  0x41, 0xFF, 0x8F, 0xDE, 0xD1, 0x47, 0xA5, 0x5D, 0x07, 0xB6, 0xC7, 0x8C,
+  0x32, 0x5F, 0x13, 0x0D, 0x00, 0xB2, 0x28, 0x8A, 0x90, 0x4C, 0x59, 0x55,
+  0x4A, 0x58, 0xBC, 0x05, 0x8A, 0x3B, 0x8A, 0xA4, 0x30, 0x03, 0x13, 0x94,
+  0xE2, 0xED, 0x41, 0x52, 0xD3, 0xA2, 0xC1, 0xBC, 0xD5, 0xC3, 0xF9, 0x0E,
+  0x64, 0x39, 0x87, 0x13, 0xF9, 0xFE, 0xA8, 0x15, 0x77, 0x13, 0x11, 0xD2,
+  0x3C, 0x01, 0x3F, 0xE7, 0xB4, 0x07, 0x40, 0xCB, 0x7D, 0xF5, 0x78, 0x14,
+  0x84, 0x8A, 0x6E, 0x51, 0xF1, 0xED, 0xD9, 0x0F, 0x1A, 0x5C, 0x92, 0xA5,
+  0x6A, 0xFC, 0x58, 0x42, 0xA9, 0xF8, 0xB5, 0x32, 0x96, 0x5E, 0x6F, 0xC4,
+  0xE0, 0x7D, 0x1B, 0x94, 0x81, 0x6E, 0xD8, 0xC6, 0xFE, 0xD5, 0x0B, 0xC9,
+  0xDA, 0x0A, 0x39, 0x6D, 0x29, 0x98, 0x1A, 0xED, 0x7A, 0xBD, 0xCE, 0xCE,
+  0xEF, 0x49, 0xE6, 0xA0, 0xE7
+};
+
+#endif
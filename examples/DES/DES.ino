@@ -15,11 +15,6 @@
 #include <ArduinoBearSSL.h>
 #include "DES.h"
 
-#ifdef ARDUINO_ARCH_MEGAAVR
-// Create the object
-DESClass DES;
-#endif
-
 uint8_t key[8] = {0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x02};
 uint8_t enc_iv[8] = {0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01};
 uint8_t dec_iv[8] = {0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01};
@@ -0,0 +1,76 @@
+/*
+  ArduinoBearSSL ECDH and ECDSA Example
+
+  This sketch runs an X25519 key exchange between two local parties and
+  signs and verifies a SHA-256 digest with ECDSA on P-256. Only the code
+  of these two curves is linked.
+
+  Circuit:
+  - Nano 33 IoT board
+
+  This example code is in the public domain.
+*/
+
+#include <ArduinoBearSSL.h>
+#include "ECDH.h"
+#include "ECDSA.h"
+#include "SHA256.h"
+
+br_hmac_drbg_context rng;
+
+ECDH<X25519> alice;
+ECDH<X25519> bob;
+ECDSA<P256> ecdsa;
+
+void setup() {
+  Serial.begin(9600);
+  while (!Serial);
+
+  // a real application seeds this from a hardware source, e.g. ECCX08.random()
+  unsigned long seed[4] = { micros(), (unsigned long)analogRead(A0), millis(), (unsigned long)analogRead(A1) };
+  br_hmac_drbg_init(&rng, &br_sha256_vtable, seed, sizeof(seed));
+}
+
+void loop() {
+  uint8_t alicePublic[ECDH<X25519>::PUBLIC_KEY_SIZE];
+  uint8_t bobPublic[ECDH<X25519>::PUBLIC_KEY_SIZE];
+  uint8_t aliceSecret[ECDH<X25519>::SHARED_SECRET_SIZE];
+  uint8_t bobSecret[ECDH<X25519>::SHARED_SECRET_SIZE];
+
+  alice.generateKey(&rng.vtable);
+  bob.generateKey(&rng.vtable);
+  alice.publicKey(alicePublic);
+  bob.publicKey(bobPublic);
+  alice.sharedSecret(bobPublic, sizeof(bobPublic), aliceSecret);
+  bob.sharedSecret(alicePublic, sizeof(alicePublic), bobSecret);
+
+  Serial.print("X25519 shared secret: ");
+  printHex(aliceSecret, sizeof(aliceSecret));
+  Serial.println(memcmp(aliceSecret, bobSecret, sizeof(aliceSecret)) == 0 ? " (match)" : " (mismatch)");
+
+  uint8_t digest[32];
+  uint8_t signature[ECDSA<P256>::SIGNATURE_SIZE];
+
+  SHA256.beginHash();
+  SHA256.print("Arduino");
+  SHA256.endHash();
+  SHA256.readBytes(digest, sizeof(digest));
+
+  ecdsa.generateKey(&rng.vtable);
+  ecdsa.sign(digest, signature);
+
+  Serial.print("P-256 signature: ");
+  printHex(signature, sizeof(signature));
+  Serial.println(ecdsa.verify(digest, sizeof(digest), signature, sizeof(signature)) ? " (valid)" : " (invalid)");
+
+  while (1);
+}
+
+void printHex(uint8_t *text, size_t size) {
+  for (size_t i = 0; i < size; i = i + 1) {
+    if (text[i] < 16) {
+      Serial.print("0");
+    }
+    Serial.print(text[i], HEX);
+  }
+}
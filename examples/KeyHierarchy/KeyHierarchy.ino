@@ -0,0 +1,88 @@
+/*
+  ArduinoBearSSL Key Hierarchy Example
+
+  This sketch keeps a single master key in flash, wrapped (RFC 3394)
+  with a device key, instead of one encrypted copy per service key. At
+  boot only the master key is unwrapped; each service key is derived
+  from it with HKDF the first time the service needs it, and cleared
+  once used. A key that cannot be derived is stored wrapped for its
+  label instead.
+
+  The keys below are examples only: provision a per-device key, e.g. in
+  a secure element, and a random master key.
+
+  Circuit:
+  - Nano 33 IoT board
+
+  This example code is in the public domain.
+*/
+
+#include <ArduinoBearSSL.h>
+#include "AESKeyWrap.h"
+#include "KeyHierarchy.h"
+
+uint8_t deviceKey[16] = {0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0x0c,0x0d,0x0e,0x0f};
+// the master key 00112233445566778899aabbccddeeff wrapped with deviceKey
+const uint8_t wrappedMaster[24] = {0x1f,0xa6,0x8b,0x0a,0x81,0x12,0xb4,0x47,0xae,0xf3,0x4b,0xd8,0xfb,0x5a,0x7b,0x82,0x9d,0x3e,0x86,0x23,0x71,0xd2,0xcf,0xe5};
+
+KeyHierarchy keys;
+
+void setup() {
+  Serial.begin(9600);
+  while (!Serial);
+
+  unsigned long start = micros();
+
+  if (!keys.begin(deviceKey, sizeof(deviceKey), wrappedMaster, sizeof(wrappedMaster))) {
+    Serial.println("Master key does not unwrap");
+    while (1);
+  }
+
+  Serial.print("Master key unwrapped in ");
+  Serial.print(micros() - start);
+  Serial.println(" us");
+}
+
+void loop() {
+  uint8_t mqttKey[16];
+  uint8_t apiKey[16];
+  uint8_t wrappedApiKey[sizeof(apiKey) + AESKEYWRAP_OVERHEAD];
+
+  unsigned long start = micros();
+  keys.derive("mqtt", mqttKey, sizeof(mqttKey));
+  unsigned long elapsed = micros() - start;
+
+  Serial.print("mqtt key: ");
+  printHex(mqttKey, sizeof(mqttKey));
+  Serial.print(" (");
+  Serial.print(elapsed);
+  Serial.println(" us)");
+  memset(mqttKey, 0x00, sizeof(mqttKey));
+
+  // e.g. a key received from a server, to be stored wrapped
+  ArduinoBearSSL.getRandom(apiKey, sizeof(apiKey));
+  keys.wrap("api", apiKey, sizeof(apiKey), wrappedApiKey);
+  memset(apiKey, 0x00, sizeof(apiKey));
+
+  Serial.print("api key stored as: ");
+  printHex(wrappedApiKey, sizeof(wrappedApiKey));
+  Serial.println();
+
+  if (keys.unwrap("api", wrappedApiKey, sizeof(wrappedApiKey), apiKey)) {
+    Serial.print("api key: ");
+    printHex(apiKey, sizeof(apiKey));
+    Serial.println();
+  }
+  memset(apiKey, 0x00, sizeof(apiKey));
+
+  while (1);
+}
+
+void printHex(const uint8_t *text, size_t size) {
+  for (size_t i = 0; i < size; i++) {
+    if (text[i] < 16) {
+      Serial.print("0");
+    }
+    Serial.print(text[i], HEX);
+  }
+}
@@ -0,0 +1,173 @@
+/*
+  ArduinoBearSSL Loopback Benchmark Example
+
+  This sketch connects a BearSSLClient to a BearSSL server running in
+  the same sketch (see LoopbackClient.h), without any network, and
+  reports for each cipher suite the full handshakes per second and the
+  throughput of application data echoed by the server. Run it before
+  and after a change to catch performance regressions, on the board or
+  on a PC with a host build of the Arduino core.
+
+  The server uses the P-256 certificate and key of server_credentials.h,
+  signed by the test CA of benchmark_ca.h; they were generated with
+  extras/generate_der.py and extras/generate_trust_anchors.py and must
+  not be used for anything else.
+
+  Circuit:
+  - any 32-bit board with at least 32 kB of RAM (e.g. SAMD51, Nano 33 BLE)
+
+  This example code is in the public domain.
+*/
+
+#include <ArduinoBearSSL.h>
+#include "LoopbackClient.h"
+#include "benchmark_ca.h"
+#include "server_credentials.h"
+
+#define HANDSHAKES 10
+#define TRANSFER_SIZE (64 * 1024UL)
+#define CHUNK_SIZE 1024
+
+struct Suite {
+  const char* name;
+  uint16_t id;
+};
+
+const Suite suites[] = {
+  { "ECDHE-ECDSA-AES128-GCM-SHA256", BR_TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256 },
+  { "ECDHE-ECDSA-AES256-GCM-SHA384", BR_TLS_ECDHE_ECDSA_WITH_AES_256_GCM_SHA384 },
+  { "ECDHE-ECDSA-CHACHA20-POLY1305", BR_TLS_ECDHE_ECDSA_WITH_CHACHA20_POLY1305_SHA256 },
+  { "ECDHE-ECDSA-AES128-SHA256", BR_TLS_ECDHE_ECDSA_WITH_AES_128_CBC_SHA256 }
+};
+
+br_x509_certificate serverChain = { (unsigned char*)SERVER_CERT, sizeof(SERVER_CERT) };
+unsigned char serverKeyData[BR_EC_KBUF_PRIV_MAX_SIZE];
+br_ec_private_key serverKey;
+
+LoopbackClient loopback(&serverChain, 1, &serverKey);
+BearSSLClient client(loopback, TAs, TAs_NUM);
+
+uint8_t chunk[CHUNK_SIZE];
+
+void setup() {
+  Serial.begin(9600);
+  while (!Serial);
+
+  // the certificates are valid from 2026, any later time will do
+  ArduinoBearSSL.onGetTime(benchmarkTime);
+
+  if (!decodeServerKey()) {
+    Serial.println("Server key decoding failed");
+    while (1);
+  }
+
+  for (size_t i = 0; i < sizeof(chunk); i++) {
+    chunk[i] = i;
+  }
+}
+
+void loop() {
+  Serial.print("Suite");
+  for (int i = 5; i < 32; i++) {
+    Serial.print(' ');
+  }
+  Serial.println("handshakes/s  kB/s (echoed)");
+
+  for (size_t i = 0; i < sizeof(suites) / sizeof(suites[0]); i++) {
+    run(suites[i]);
+  }
+
+  Serial.println();
+  while (1);
+}
+
+unsigned long benchmarkTime() {
+  return 1798761600UL; // 2027-01-01
+}
+
+int decodeServerKey() {
+  static br_skey_decoder_context decoder;
+
+  br_skey_decoder_init(&decoder);
+  br_skey_decoder_push(&decoder, SERVER_KEY, sizeof(SERVER_KEY));
+
+  const br_ec_private_key* key = br_skey_decoder_get_ec(&decoder);
+
+  if (key == NULL || key->xlen > sizeof(serverKeyData)) {
+    return 0;
+  }
+
+  memcpy(serverKeyData, key->x, key->xlen);
+  serverKey.curve = key->curve;
+  serverKey.x = serverKeyData;
+  serverKey.xlen = key->xlen;
+
+  return 1;
+}
+
+void run(const Suite& suite) {
+  loopback.setSuite(suite.id);
+
+  Serial.print(suite.name);
+  for (int i = strlen(suite.name); i < 32; i++) {
+    Serial.print(' ');
+  }
+
+  unsigned long start = micros();
+
+  for (int i = 0; i < HANDSHAKES; i++) {
+    if (!client.connect("localhost", 443)) {
+      Serial.print("connect failed, error ");
+      Serial.println(client.errorCode());
+      return;
+    }
+
+    client.stop();
+  }
+
+  unsigned long elapsed = micros() - start;
+
+  Serial.print(HANDSHAKES * 1000000.0 / elapsed, 2);
+  Serial.print("         ");
+
+  if (!client.connect("localhost", 443)) {
+    Serial.println("connect failed");
+    return;
+  }
+
+  start = micros();
+
+  for (unsigned long sent = 0; sent < TRANSFER_SIZE; sent += CHUNK_SIZE) {
+    uint8_t echo[CHUNK_SIZE];
+    size_t received = 0;
+
+    if (client.write(chunk, CHUNK_SIZE) != CHUNK_SIZE) {
+      Serial.println("write failed");
+      client.stop();
+      return;
+    }
+
+    while (received < CHUNK_SIZE) {
+      int n = client.read(echo + received, CHUNK_SIZE - received);
+
+      if (n < 0 && !client.connected()) {
+        Serial.println("read failed");
+        return;
+      }
+      if (n > 0) {
+        received += n;
+      }
+    }
+
+    if (memcmp(echo, chunk, CHUNK_SIZE) != 0) {
+      Serial.println("echo mismatch");
+      client.stop();
+      return;
+    }
+  }
+
+  elapsed = micros() - start;
+  client.stop();
+
+  Serial.println(TRANSFER_SIZE * 1000.0 / elapsed, 1);
+}
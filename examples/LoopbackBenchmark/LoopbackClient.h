@@ -0,0 +1,271 @@
+/*
+  LoopbackClient
+
+  A Client whose other end is a BearSSL server running in the same
+  sketch: what BearSSLClient writes is fed to the server engine, what
+  the server sends back is what BearSSLClient reads. The server echoes
+  the application data it receives. No network is involved, so the
+  measurements only depend on the CPU and the library.
+
+  This example code is in the public domain.
+*/
+
+#ifndef _LOOPBACK_CLIENT_H_
+#define _LOOPBACK_CLIENT_H_
+
+#include <ArduinoBearSSL.h>
+#include <Client.h>
+
+// bytes in flight in each direction, at least the echo of one write()
+#ifndef LOOPBACK_FIFO_SIZE
+#define LOOPBACK_FIFO_SIZE 2048
+#endif
+
+// the server takes the client's records of up to 512 bytes (the default
+// BearSSLClient output buffer) and sends records of up to 512 bytes
+#define LOOPBACK_SERVER_IBUF_SIZE (512 + 325)
+#define LOOPBACK_SERVER_OBUF_SIZE (512 + 85)
+
+class LoopbackFifo {
+public:
+  LoopbackFifo() : _start(0), _length(0) {}
+
+  void clear() {
+    _start = 0;
+    _length = 0;
+  }
+
+  size_t length() {
+    return _length;
+  }
+
+  size_t write(const uint8_t* buf, size_t size) {
+    size_t written = 0;
+
+    while (size && _length < sizeof(_data)) {
+      size_t end = (_start + _length) % sizeof(_data);
+      size_t chunk = (end >= _start) ? sizeof(_data) - end : _start - end;
+
+      if (chunk > size) {
+        chunk = size;
+      }
+
+      memcpy(&_data[end], buf, chunk);
+      _length += chunk;
+      buf += chunk;
+      size -= chunk;
+      written += chunk;
+    }
+
+    return written;
+  }
+
+  size_t read(uint8_t* buf, size_t size) {
+    size_t read = 0;
+
+    while (size && _length) {
+      size_t chunk = sizeof(_data) - _start;
+
+      if (chunk > _length) {
+        chunk = _length;
+      }
+      if (chunk > size) {
+        chunk = size;
+      }
+
+      memcpy(buf, &_data[_start], chunk);
+      _start = (_start + chunk) % sizeof(_data);
+      _length -= chunk;
+      buf += chunk;
+      size -= chunk;
+      read += chunk;
+    }
+
+    return read;
+  }
+
+  int peek() {
+    return _length ? _data[_start] : -1;
+  }
+
+private:
+  uint8_t _data[LOOPBACK_FIFO_SIZE];
+  size_t _start;
+  size_t _length;
+};
+
+class LoopbackClient : public Client {
+public:
+  LoopbackClient(const br_x509_certificate* chain, size_t chainLen, const br_ec_private_key* key) :
+    _chain(chain),
+    _chainLen(chainLen),
+    _key(key),
+    _suite(0),
+    _connected(false)
+  {
+  }
+
+  // the only cipher suite the server accepts, 0 for all of them
+  void setSuite(uint16_t suite) {
+    _suite = suite;
+  }
+
+  virtual int connect(IPAddress, uint16_t) {
+    return begin();
+  }
+
+  virtual int connect(const char*, uint16_t) {
+    return begin();
+  }
+
+  virtual size_t write(uint8_t b) {
+    return write(&b, 1);
+  }
+
+  virtual size_t write(const uint8_t* buf, size_t size) {
+    size_t written = 0;
+
+    while (written < size) {
+      size_t n = _toServer.write(buf + written, size - written);
+
+      pump();
+
+      if (n == 0) {
+        break;
+      }
+
+      written += n;
+    }
+
+    return written;
+  }
+
+  virtual int available() {
+    pump();
+
+    return _toClient.length();
+  }
+
+  virtual int read() {
+    uint8_t b;
+
+    return (read(&b, 1) == 1) ? b : -1;
+  }
+
+  virtual int read(uint8_t* buf, size_t size) {
+    pump();
+
+    size_t n = _toClient.read(buf, size);
+
+    return n ? (int)n : -1;
+  }
+
+  virtual int peek() {
+    pump();
+
+    return _toClient.peek();
+  }
+
+  virtual void flush() {
+  }
+
+  virtual void stop() {
+    _connected = false;
+  }
+
+  virtual uint8_t connected() {
+    if (!_connected) {
+      return 0;
+    }
+
+    return _toClient.length() || !(br_ssl_engine_current_state(&_sc.eng) & BR_SSL_CLOSED);
+  }
+
+  virtual operator bool() {
+    return _connected;
+  }
+
+private:
+  int begin() {
+    unsigned char seed[32];
+
+    br_ssl_server_init_full_ec(&_sc, _chain, _chainLen, BR_KEYTYPE_EC, _key);
+    if (_suite) {
+      br_ssl_engine_set_suites(&_sc.eng, &_suite, 1);
+    }
+    br_ssl_engine_set_buffers_bidi(&_sc.eng, _ibuf, sizeof(_ibuf), _obuf, sizeof(_obuf));
+
+    ArduinoBearSSL.getRandom(seed, sizeof(seed));
+    br_ssl_engine_inject_entropy(&_sc.eng, seed, sizeof(seed));
+
+    if (!br_ssl_server_reset(&_sc)) {
+      return 0;
+    }
+
+    _toServer.clear();
+    _toClient.clear();
+    _connected = true;
+
+    return 1;
+  }
+
+  // run the server until it waits for the client
+  void pump() {
+    br_ssl_engine_context* eng = &_sc.eng;
+
+    for (;;) {
+      unsigned state = br_ssl_engine_current_state(eng);
+      size_t length = 0;
+      unsigned char* buf;
+
+      if (state & BR_SSL_CLOSED) {
+        return;
+      }
+
+      if (state & BR_SSL_SENDREC) {
+        buf = br_ssl_engine_sendrec_buf(eng, &length);
+        length = _toClient.write(buf, length);
+        if (length) {
+          br_ssl_engine_sendrec_ack(eng, length);
+        }
+      } else if ((state & BR_SSL_RECVAPP) && (state & BR_SSL_SENDAPP)) {
+        size_t space;
+        unsigned char* out = br_ssl_engine_sendapp_buf(eng, &space);
+
+        buf = br_ssl_engine_recvapp_buf(eng, &length);
+        if (length > space) {
+          length = space;
+        }
+
+        memcpy(out, buf, length);
+        br_ssl_engine_recvapp_ack(eng, length);
+        br_ssl_engine_sendapp_ack(eng, length);
+        br_ssl_engine_flush(eng, 0);
+      } else if (state & BR_SSL_RECVREC) {
+        buf = br_ssl_engine_recvrec_buf(eng, &length);
+        length = _toServer.read(buf, length);
+        if (length) {
+          br_ssl_engine_recvrec_ack(eng, length);
+        }
+      }
+
+      if (length == 0) {
+        return;
+      }
+    }
+  }
+
+  const br_x509_certificate* _chain;
+  size_t _chainLen;
+  const br_ec_private_key* _key;
+  uint16_t _suite;
+  bool _connected;
+
+  br_ssl_server_context _sc;
+  unsigned char _ibuf[LOOPBACK_SERVER_IBUF_SIZE];
+  unsigned char _obuf[LOOPBACK_SERVER_OBUF_SIZE];
+  LoopbackFifo _toServer;
+  LoopbackFifo _toClient;
+};
+
+#endif
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2018 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _BEAR_SSL_TRUST_ANCHORS_H_
+#define _BEAR_SSL_TRUST_ANCHORS_H_
+
+#include "bearssl/bearssl_ssl.h"
+
+// The following was created by running extras/generate_trust_anchors.py
+// in the extras/TrustAnchors directory, entries are sorted by the
+// SHA-256 hash of their DN.
+
+static const unsigned char TA0_DN[] = {
+  0x30, 0x1F, 0x31, 0x1D, 0x30, 0x1B, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0C,
+  0x14, 0x42, 0x65, 0x61, 0x72, 0x53, 0x53, 0x4C, 0x20, 0x42, 0x65, 0x6E,
+  0x63, 0x68, 0x6D, 0x61, 0x72, 0x6B, 0x20, 0x43, 0x41
+};
+
+static const unsigned char TA0_EC_Q[] = {
+  0x04, 0x3D, 0x4A, 0x5B, 0x5F, 0x13, 0x3B, 0x00, 0xC0, 0xD6, 0x9E, 0xDE,
+  0xAE, 0x2C, 0xA2, 0x11, 0x87, 0xD0, 0x24, 0x4B, 0x7E, 0xA2, 0xA8, 0x2E,
+  0x9A, 0xAD, 0xC0, 0xD6, 0x1E, 0xD0, 0x23, 0xEF, 0x47, 0x10, 0xCA, 0x60,
+  0x68, 0xF2, 0x6E, 0x34, 0x93, 0xFC, 0xA0, 0x76, 0xB5, 0xA1, 0x15, 0xFB,
+  0xE1, 0x2F, 0x8D, 0x0F, 0x2E, 0xDA, 0x21, 0xBD, 0x1D, 0x0D, 0xE9, 0x0F,
+  0xBA, 0x26, 0x1F, 0x8C, 0x2A
+};
+
+static const br_x509_trust_anchor TAs[1] = {
+  {
+    { (unsigned char *)TA0_DN, sizeof TA0_DN },
+    BR_X509_TA_CA,
+    {
+      BR_KEYTYPE_EC,
+      { .ec = {
+        BR_EC_secp256r1,
+        (unsigned char *)TA0_EC_Q, sizeof TA0_EC_Q,
+      } }
+    }
+  }
+};
+
+#define TAs_NUM   1
+
+#endif
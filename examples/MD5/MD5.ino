@@ -10,11 +10,6 @@
 #include <ArduinoBearSSL.h>
 #include "MD5.h"
 
-#ifdef ARDUINO_ARCH_MEGAAVR
-// Create the object
-MD5Class MD5;
-#endif
-
 void setup() {
   Serial.begin(9600);
   while (!Serial);
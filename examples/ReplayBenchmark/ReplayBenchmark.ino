@@ -0,0 +1,175 @@
+/*
+  ArduinoBearSSL Replay Benchmark Example
+
+  This sketch replays recorded connections to a BearSSLClient (see
+  ReplayClient.h and recordings.h): the server's answers come from
+  flash, and with the seed and time of the recording the client sends
+  the same bytes, so every handshake runs through the same code with the
+  same data. It reports for each recording (ECDSA and RSA certificates,
+  chains of one and two certificates, several suites) the CPU time of a
+  full handshake, without network delays or a server, so that two
+  versions of the library or two configurations compare reproducibly,
+  on the board or on a PC with a host build of the Arduino core.
+
+  A configuration that changes the ClientHello (profile, curves, buffer
+  sizes, ...) makes the client diverge from the recordings, which is
+  reported. Set FUZZ to 1 to also replay each recording with every server
+  byte of the handshake corrupted in turn, each of which must fail the
+  handshake: that takes a while, better on a PC.
+
+  Circuit:
+  - any 32-bit board with at least 32 kB of RAM (e.g. SAMD51, Nano 33 BLE)
+
+  This example code is in the public domain.
+*/
+
+#include <ArduinoBearSSL.h>
+#include "ReplayClient.h"
+#include "recordings.h"
+#include "replay_ca.h"
+
+#define HANDSHAKES 10
+#define FUZZ 0
+
+ReplayClient replay;
+BearSSLClient client(replay, TAs, TAs_NUM);
+
+unsigned long recordingTime() {
+  return RECORDING_TIME;
+}
+
+// replay the recording once, 1 if the handshake completed
+int replayHandshake() {
+  int ok = client.connect("localhost", 443);
+
+  client.stop();
+
+  return ok;
+}
+
+int check(const Recording& recording) {
+  replay.setRecording(recording.data, recording.length);
+  replay.corrupt(0, 0);
+
+  if (!replayHandshake()) {
+    Serial.print("handshake failed, error ");
+    Serial.print(client.errorCode());
+    if (replay.divergence() >= 0) {
+      Serial.print(", the client diverged from the recording at byte ");
+      Serial.print(replay.divergence());
+    }
+    Serial.println();
+    return 0;
+  }
+
+  return 1;
+}
+
+void run(const Recording& recording) {
+  Serial.print(recording.name);
+  for (int i = strlen(recording.name); i < 28; i++) {
+    Serial.print(' ');
+  }
+
+  // also sets up the client context, which is kept for the next ones
+  if (!check(recording)) {
+    return;
+  }
+
+  unsigned long total = 0;
+  unsigned long fastest = 0xFFFFFFFFUL;
+  unsigned long slowest = 0;
+
+  for (int i = 0; i < HANDSHAKES; i++) {
+    unsigned long start = micros();
+    int ok = client.connect("localhost", 443);
+    unsigned long elapsed = micros() - start;
+
+    client.stop();
+
+    if (!ok) {
+      Serial.println("replay failed");
+      return;
+    }
+
+    total += elapsed;
+    if (elapsed < fastest) {
+      fastest = elapsed;
+    }
+    if (elapsed > slowest) {
+      slowest = elapsed;
+    }
+  }
+
+  Serial.print(total / HANDSHAKES);
+  Serial.print("  ");
+  Serial.print(fastest);
+  Serial.print("  ");
+  Serial.println(slowest);
+}
+
+void fuzz(const Recording& recording) {
+  Serial.print(recording.name);
+  Serial.print(": ");
+
+  if (!check(recording)) {
+    return;
+  }
+
+  // the server bytes up to its Finished, the close_notify comes later
+  replay.setRecording(recording.data, recording.length);
+  client.connect("localhost", 443);
+
+  size_t handshakeLength = replay.serverOffset();
+  size_t accepted = 0;
+
+  client.stop();
+
+  for (size_t offset = 0; offset < handshakeLength; offset++) {
+    replay.corrupt(offset, 0x01);
+
+    if (replayHandshake()) {
+      accepted++;
+    }
+  }
+
+  replay.corrupt(0, 0);
+
+  Serial.print(handshakeLength);
+  Serial.print(" corrupted handshakes, ");
+  Serial.print(accepted);
+  Serial.println(" accepted");
+}
+
+void setup() {
+  Serial.begin(9600);
+  while (!Serial);
+
+  ArduinoBearSSL.onGetTime(recordingTime);
+
+  // as for the recordings
+  client.setSuiteOrder(BearSSLClient::SuiteOrder::ChaChaFirst);
+  client.setFixedSeed(RECORDING_SEED, sizeof(RECORDING_SEED));
+}
+
+void loop() {
+  Serial.print("Recording");
+  for (int i = 9; i < 28; i++) {
+    Serial.print(' ');
+  }
+  Serial.println("handshake us (average, min, max)");
+
+  for (size_t i = 0; i < sizeof(recordings) / sizeof(recordings[0]); i++) {
+    run(recordings[i]);
+  }
+
+  if (FUZZ) {
+    Serial.println();
+    for (size_t i = 0; i < sizeof(recordings) / sizeof(recordings[0]); i++) {
+      fuzz(recordings[i]);
+    }
+  }
+
+  Serial.println();
+  while (1);
+}
@@ -0,0 +1,386 @@
+/*
+  ReplayClient
+
+  A Client that plays back a connection recorded with RecordingClient:
+  what BearSSLClient writes is checked against what the client sent
+  then, and reads return what the server answered, one flight after the
+  other. With the same fixed seed (BearSSLClient::setFixedSeed()), time
+  and configuration as the recording the client sends the same bytes,
+  so the recorded answers stay valid and the handshake completes without
+  a network or a server.
+
+  A recording is a sequence of segments: one direction byte
+  (REPLAY_CLIENT or REPLAY_SERVER), a 16-bit big-endian length and the
+  bytes sent in that direction.
+
+  This example code is in the public domain.
+*/
+
+#ifndef _REPLAY_CLIENT_H_
+#define _REPLAY_CLIENT_H_
+
+#include <ArduinoBearSSL.h>
+#include <Client.h>
+
+#define REPLAY_CLIENT 0
+#define REPLAY_SERVER 1
+
+class ReplayClient : public Client {
+public:
+  ReplayClient() :
+    _data(NULL),
+    _length(0),
+    _corruptOffset(0),
+    _corruptMask(0)
+  {
+    rewind();
+  }
+
+  void setRecording(const uint8_t* data, size_t length) {
+    _data = data;
+    _length = length;
+    rewind();
+  }
+
+  // bytes the server sent in the recording
+  size_t serverLength() {
+    size_t total = 0;
+
+    for (size_t pos = 0; pos + 3 <= _length; pos += 3 + segmentLength(pos)) {
+      if (_data[pos] == REPLAY_SERVER) {
+        total += segmentLength(pos);
+      }
+    }
+
+    return total;
+  }
+
+  // flip the bits of mask in the server byte at offset on the next
+  // replays, mask 0 plays the recording as it is
+  void corrupt(size_t offset, uint8_t mask) {
+    _corruptOffset = offset;
+    _corruptMask = mask;
+  }
+
+  // offset of the first client byte that differs from the recording,
+  // -1 while they match
+  long divergence() {
+    return _divergence;
+  }
+
+  // server bytes read since connect()
+  size_t serverOffset() {
+    return _serverOffset;
+  }
+
+  // true once every recorded byte was exchanged
+  bool finished() {
+    return _pos >= _length;
+  }
+
+  virtual int connect(IPAddress, uint16_t) {
+    return begin();
+  }
+
+  virtual int connect(const char*, uint16_t) {
+    return begin();
+  }
+
+  virtual size_t write(uint8_t b) {
+    return write(&b, 1);
+  }
+
+  virtual size_t write(const uint8_t* buf, size_t size) {
+    if (_divergence >= 0) {
+      return 0;
+    }
+
+    for (size_t i = 0; i < size; i++) {
+      if (finished()) {
+        break;
+      }
+
+      if (_data[_pos] != REPLAY_CLIENT || buf[i] != _data[_pos + 3 + _segmentOffset]) {
+        diverge();
+        return 0;
+      }
+
+      _clientOffset++;
+      advance();
+    }
+
+    return size;
+  }
+
+  virtual int available() {
+    if (_divergence >= 0 || finished() || _data[_pos] != REPLAY_SERVER) {
+      return 0;
+    }
+
+    return segmentLength(_pos) - _segmentOffset;
+  }
+
+  virtual int read() {
+    uint8_t b;
+
+    return (read(&b, 1) == 1) ? b : -1;
+  }
+
+  virtual int read(uint8_t* buf, size_t size) {
+    size_t n = 0;
+
+    // the client waits for an answer that the server only gave to bytes
+    // it has not sent: it would wait forever
+    if (_divergence < 0 && !finished() && _data[_pos] == REPLAY_CLIENT) {
+      diverge();
+    }
+
+    while (n < size && available()) {
+      uint8_t b = _data[_pos + 3 + _segmentOffset];
+
+      if (_serverOffset == _corruptOffset) {
+        b ^= _corruptMask;
+      }
+
+      buf[n++] = b;
+      _serverOffset++;
+      advance();
+    }
+
+    return n ? (int)n : -1;
+  }
+
+  virtual int peek() {
+    if (!available()) {
+      return -1;
+    }
+
+    uint8_t b = _data[_pos + 3 + _segmentOffset];
+
+    return (_serverOffset == _corruptOffset) ? (b ^ _corruptMask) : b;
+  }
+
+  virtual void flush() {
+  }
+
+  virtual void stop() {
+    _connected = false;
+  }
+
+  virtual uint8_t connected() {
+    return _connected && _divergence < 0 && !finished();
+  }
+
+  virtual operator bool() {
+    return _connected;
+  }
+
+private:
+  int begin() {
+    rewind();
+    _connected = (_data != NULL);
+
+    return _connected;
+  }
+
+  void rewind() {
+    _pos = 0;
+    _segmentOffset = 0;
+    _clientOffset = 0;
+    _serverOffset = 0;
+    _divergence = -1;
+    _connected = false;
+  }
+
+  size_t segmentLength(size_t pos) {
+    return ((size_t)_data[pos + 1] << 8) | _data[pos + 2];
+  }
+
+  void advance() {
+    if (++_segmentOffset >= segmentLength(_pos)) {
+      _pos += 3 + segmentLength(_pos);
+      _segmentOffset = 0;
+    }
+  }
+
+  void diverge() {
+    _divergence = _clientOffset;
+  }
+
+  const uint8_t* _data;
+  size_t _length;
+  size_t _pos;
+  size_t _segmentOffset;
+  size_t _clientOffset;
+  size_t _serverOffset;
+  size_t _corruptOffset;
+  uint8_t _corruptMask;
+  long _divergence;
+  bool _connected;
+};
+
+// Wraps the Client of a real connection and keeps what goes through it
+// in buffer, in the format ReplayClient plays back; dump() prints it as
+// a C array to paste in recordings.h.
+class RecordingClient : public Client {
+public:
+  RecordingClient(Client& client, uint8_t* buffer, size_t size) :
+    _client(&client),
+    _buffer(buffer),
+    _size(size),
+    _length(0),
+    _segment(0)
+  {
+  }
+
+  size_t length() {
+    return _length;
+  }
+
+  // 0 if the buffer was too small for the whole connection
+  int complete() {
+    return _length <= _size;
+  }
+
+  void dump(Print& out, const char* name) {
+    out.print("static const uint8_t ");
+    out.print(name);
+    out.println("[] = {");
+
+    for (size_t i = 0; i < _length && i < _size; i++) {
+      out.print((i % 12) ? " 0x" : "  0x");
+      if (_buffer[i] < 0x10) {
+        out.print('0');
+      }
+      out.print(_buffer[i], HEX);
+      if (i + 1 < _length) {
+        out.print(',');
+      }
+      if (i % 12 == 11 || i + 1 == _length) {
+        out.println();
+      }
+    }
+
+    out.println("};");
+  }
+
+  virtual int connect(IPAddress ip, uint16_t port) {
+    _length = 0;
+
+    return _client->connect(ip, port);
+  }
+
+  virtual int connect(const char* host, uint16_t port) {
+    _length = 0;
+
+    return _client->connect(host, port);
+  }
+
+  virtual size_t write(uint8_t b) {
+    return write(&b, 1);
+  }
+
+  virtual size_t write(const uint8_t* buf, size_t size) {
+    size_t n = _client->write(buf, size);
+
+    record(REPLAY_CLIENT, buf, n);
+
+    return n;
+  }
+
+  virtual int available() {
+    return _client->available();
+  }
+
+  virtual int read() {
+    uint8_t b;
+
+    return (read(&b, 1) == 1) ? b : -1;
+  }
+
+  virtual int read(uint8_t* buf, size_t size) {
+    int n = _client->read(buf, size);
+
+    if (n > 0) {
+      record(REPLAY_SERVER, buf, n);
+    }
+
+    return n;
+  }
+
+  virtual int peek() {
+    return _client->peek();
+  }
+
+  virtual void flush() {
+    _client->flush();
+  }
+
+  virtual void stop() {
+    _client->stop();
+  }
+
+  virtual uint8_t connected() {
+    return _client->connected();
+  }
+
+  virtual operator bool() {
+    return (bool)*_client;
+  }
+
+private:
+  void record(uint8_t direction, const uint8_t* data, size_t length) {
+    while (length) {
+      // a new segment on each change of direction, or when full
+      if (_length == 0 || byteAt(_segment) != direction || segmentLength() == 0xFFFF) {
+        _segment = _length;
+        put(direction);
+        put(0);
+        put(0);
+      }
+
+      size_t chunk = 0xFFFF - segmentLength();
+
+      if (chunk > length) {
+        chunk = length;
+      }
+
+      for (size_t i = 0; i < chunk; i++) {
+        put(data[i]);
+      }
+
+      size_t total = segmentLength() + chunk;
+
+      setByte(_segment + 1, total >> 8);
+      setByte(_segment + 2, total & 0xFF);
+      data += chunk;
+      length -= chunk;
+    }
+  }
+
+  size_t segmentLength() {
+    return ((size_t)byteAt(_segment + 1) << 8) | byteAt(_segment + 2);
+  }
+
+  uint8_t byteAt(size_t pos) {
+    return (pos < _size) ? _buffer[pos] : 0;
+  }
+
+  void setByte(size_t pos, uint8_t b) {
+    if (pos < _size) {
+      _buffer[pos] = b;
+    }
+  }
+
+  void put(uint8_t b) {
+    setByte(_length++, b);
+  }
+
+  Client* _client;
+  uint8_t* _buffer;
+  size_t _size;
+  size_t _length;
+  size_t _segment;
+};
+
+#endif
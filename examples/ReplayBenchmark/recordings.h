@@ -0,0 +1,818 @@
+// Connections of a BearSSLClient (default configuration with
+// ARDUINO_DISABLE_ECCX08, SuiteOrder::ChaChaFirst, setFixedSeed(RECORDING_SEED),
+// time RECORDING_TIME) to openssl s_server, recorded with RecordingClient
+// (see ReplayClient.h) from the ClientHello to the close_notify of both
+// sides. The server certificates are signed by the test CAs of
+// replay_ca.h, whose keys are not kept: the recordings can be replayed,
+// not extended. ec.pem is a P-256 certificate signed by the EC CA, ec2.pem
+// one signed by an intermediate CA (int.pem) of the EC CA and rsa.pem an
+// RSA-2048 certificate signed by the RSA CA. Server options of each
+// recording:
+//
+//   ECDSA_P256_AES128_GCM      -cert ec.pem -cipher ECDHE-ECDSA-AES128-GCM-SHA256 -curves P-256
+//   ECDSA_X25519_CHACHA20      -cert ec.pem -cipher ECDHE-ECDSA-CHACHA20-POLY1305 -curves X25519
+//   ECDSA_CHAIN2_AES256_GCM    -cert ec2.pem + int.pem -cipher ECDHE-ECDSA-AES256-GCM-SHA384 -curves P-256
+//   ECDSA_CHAIN2_AES128_CBC    -cert ec2.pem + int.pem -cipher ECDHE-ECDSA-AES128-SHA256 -curves P-256
+//   RSA2048_AES128_GCM         -cert rsa.pem -cipher ECDHE-RSA-AES128-GCM-SHA256 -curves P-256
+//   RSA2048_X25519_CHACHA20    -cert rsa.pem -cipher ECDHE-RSA-CHACHA20-POLY1305 -curves X25519
+
+#ifndef _RECORDINGS_H_
+#define _RECORDINGS_H_
+
+#include <Arduino.h>
+
+#define RECORDING_TIME 1798761600UL // 2027-01-01
+
+static const uint8_t RECORDING_SEED[32] = {
+  'A', 'r', 'd', 'u', 'i', 'n', 'o', 'B', 'e', 'a', 'r', 'S',
+  'S', 'L', ' ', 'r', 'e', 'p', 'l', 'a', 'y', ' ', 's', 'e',
+  'e', 'd', 0, 0, 0, 0, 0, 0
+};
+
+static const uint8_t ECDSA_P256_AES128_GCM[] = {
+  0x00, 0x00, 0xD6, 0x16, 0x03, 0x01, 0x00, 0xD1, 0x01, 0x00, 0x00, 0xCD,
+  0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC4, 0x8A, 0xF1, 0xFF, 0x86, 0x82,
+  0xAF, 0x9C, 0x07, 0x1D, 0x55, 0xE4, 0xBF, 0x9F, 0xDB, 0xD2, 0x67, 0x29,
+  0x04, 0x95, 0xDB, 0x97, 0x14, 0x38, 0xAF, 0x99, 0xB2, 0xCD, 0x00, 0x00,
+  0x5A, 0xCC, 0xA9, 0xCC, 0xA8, 0xC0, 0x2B, 0xC0, 0x2F, 0xC0, 0x2C, 0xC0,
+  0x30, 0xC0, 0xAC, 0xC0, 0xAD, 0xC0, 0xAE, 0xC0, 0xAF, 0xC0, 0x23, 0xC0,
+  0x27, 0xC0, 0x24, 0xC0, 0x28, 0xC0, 0x09, 0xC0, 0x13, 0xC0, 0x0A, 0xC0,
+  0x14, 0xC0, 0x2D, 0xC0, 0x31, 0xC0, 0x2E, 0xC0, 0x32, 0xC0, 0x25, 0xC0,
+  0x29, 0xC0, 0x26, 0xC0, 0x2A, 0xC0, 0x04, 0xC0, 0x0E, 0xC0, 0x05, 0xC0,
+  0x0F, 0x00, 0x9C, 0x00, 0x9D, 0xC0, 0x9C, 0xC0, 0x9D, 0xC0, 0xA0, 0xC0,
+  0xA1, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x35, 0xC0, 0x08, 0xC0,
+  0x12, 0xC0, 0x03, 0xC0, 0x0D, 0x00, 0x0A, 0x01, 0x00, 0x00, 0x4A, 0xFF,
+  0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x00,
+  0x09, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x68, 0x6F, 0x73, 0x74, 0x00, 0x01,
+  0x00, 0x01, 0x01, 0x00, 0x0D, 0x00, 0x16, 0x00, 0x14, 0x04, 0x03, 0x03,
+  0x03, 0x05, 0x03, 0x06, 0x03, 0x02, 0x03, 0x04, 0x01, 0x03, 0x01, 0x05,
+  0x01, 0x06, 0x01, 0x02, 0x01, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x08, 0x00,
+  0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1D, 0x00, 0x0B, 0x00, 0x02, 0x01,
+  0x00, 0x01, 0x02, 0xB4, 0x16, 0x03, 0x03, 0x00, 0x5E, 0x02, 0x00, 0x00,
+  0x5A, 0x03, 0x03, 0xD5, 0xEB, 0x0D, 0x7F, 0x1A, 0x01, 0x6B, 0x31, 0x39,
+  0x2A, 0xC5, 0xE5, 0xE4, 0x8C, 0x64, 0x97, 0x79, 0xF9, 0xDD, 0x16, 0x69,
+  0xDF, 0x35, 0x34, 0x44, 0x4F, 0x57, 0x4E, 0x47, 0x52, 0x44, 0x01, 0x20,
+  0x9C, 0xF2, 0x83, 0x39, 0xF1, 0x7D, 0x57, 0x1B, 0x93, 0x1C, 0x1B, 0xAB,
+  0xD3, 0x06, 0x40, 0x7C, 0xAC, 0x0A, 0x97, 0x6C, 0xF9, 0x61, 0x0B, 0x46,
+  0x2D, 0x1B, 0xD0, 0xFF, 0xD8, 0x2D, 0x99, 0xFA, 0xC0, 0x2B, 0x00, 0x00,
+  0x12, 0xFF, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00,
+  0x0B, 0x00, 0x04, 0x03, 0x00, 0x01, 0x02, 0x16, 0x03, 0x03, 0x01, 0xAA,
+  0x0B, 0x00, 0x01, 0xA6, 0x00, 0x01, 0xA3, 0x00, 0x01, 0xA0, 0x30, 0x82,
+  0x01, 0x9C, 0x30, 0x82, 0x01, 0x42, 0xA0, 0x03, 0x02, 0x01, 0x02, 0x02,
+  0x01, 0x03, 0x30, 0x0A, 0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x04,
+  0x03, 0x02, 0x30, 0x26, 0x31, 0x24, 0x30, 0x22, 0x06, 0x03, 0x55, 0x04,
+  0x03, 0x0C, 0x1B, 0x41, 0x72, 0x64, 0x75, 0x69, 0x6E, 0x6F, 0x42, 0x65,
+  0x61, 0x72, 0x53, 0x53, 0x4C, 0x20, 0x52, 0x65, 0x70, 0x6C, 0x61, 0x79,
+  0x20, 0x45, 0x43, 0x20, 0x43, 0x41, 0x30, 0x1E, 0x17, 0x0D, 0x32, 0x36,
+  0x31, 0x30, 0x31, 0x34, 0x31, 0x31, 0x35, 0x30, 0x31, 0x32, 0x5A, 0x17,
+  0x0D, 0x34, 0x36, 0x31, 0x30, 0x30, 0x39, 0x31, 0x31, 0x35, 0x30, 0x31,
+  0x32, 0x5A, 0x30, 0x14, 0x31, 0x12, 0x30, 0x10, 0x06, 0x03, 0x55, 0x04,
+  0x03, 0x0C, 0x09, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x68, 0x6F, 0x73, 0x74,
+  0x30, 0x59, 0x30, 0x13, 0x06, 0x07, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x02,
+  0x01, 0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x03, 0x01, 0x07, 0x03,
+  0x42, 0x00, 0x04, 0x77, 0x3E, 0xD1, 0x03, 0x59, 0xFC, 0x95, 0x29, 0xAC,
+  0x7A, 0xE4, 0x84, 0xCE, 0xFF, 0xA3, 0xBC, 0x85, 0x72, 0x65, 0x19, 0xEF,
+  0x67, 0x1A, 0x1D, 0xB3, 0x02, 0x6D, 0x86, 0x23, 0x6C, 0x0E, 0x1F, 0xD0,
+  0xFF, 0x1C, 0x62, 0x53, 0xBD, 0xD6, 0x24, 0x27, 0xEA, 0xF4, 0x6A, 0x1C,
+  0x95, 0x6E, 0x4F, 0x0C, 0xF1, 0xC7, 0x2C, 0x26, 0x77, 0xB0, 0x16, 0x40,
+  0x58, 0xE5, 0x74, 0xE2, 0xEE, 0x46, 0x25, 0xA3, 0x73, 0x30, 0x71, 0x30,
+  0x09, 0x06, 0x03, 0x55, 0x1D, 0x13, 0x04, 0x02, 0x30, 0x00, 0x30, 0x0E,
+  0x06, 0x03, 0x55, 0x1D, 0x0F, 0x01, 0x01, 0xFF, 0x04, 0x04, 0x03, 0x02,
+  0x05, 0xA0, 0x30, 0x14, 0x06, 0x03, 0x55, 0x1D, 0x11, 0x04, 0x0D, 0x30,
+  0x0B, 0x82, 0x09, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x68, 0x6F, 0x73, 0x74,
+  0x30, 0x1D, 0x06, 0x03, 0x55, 0x1D, 0x0E, 0x04, 0x16, 0x04, 0x14, 0xAB,
+  0xC0, 0xA2, 0x33, 0xDE, 0x4A, 0xB3, 0x26, 0x06, 0x68, 0x00, 0x8C, 0x89,
+  0xC9, 0xF7, 0x78, 0xD0, 0x42, 0xF6, 0xE5, 0x30, 0x1F, 0x06, 0x03, 0x55,
+  0x1D, 0x23, 0x04, 0x18, 0x30, 0x16, 0x80, 0x14, 0xB6, 0x80, 0xD2, 0x98,
+  0xE0, 0xBF, 0xA3, 0x95, 0x93, 0x66, 0x35, 0x7C, 0x78, 0x02, 0xF1, 0xC4,
+  0xC6, 0x28, 0xCC, 0xCD, 0x30, 0x0A, 0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE,
+  0x3D, 0x04, 0x03, 0x02, 0x03, 0x48, 0x00, 0x30, 0x45, 0x02, 0x20, 0x55,
+  0xE9, 0xFF, 0x73, 0x71, 0x4C, 0x45, 0x80, 0x5E, 0x76, 0xB2, 0x72, 0x80,
+  0x60, 0xFC, 0x2D, 0x0D, 0xB9, 0xFB, 0x37, 0x03, 0x50, 0x79, 0x52, 0xD4,
+  0x53, 0x14, 0x85, 0x3A, 0xEA, 0x49, 0xA1, 0x02, 0x21, 0x00, 0xF8, 0x1A,
+  0x29, 0x67, 0x2A, 0xD7, 0xCD, 0x30, 0xA8, 0xB6, 0x85, 0x03, 0x7D, 0xDA,
+  0xD9, 0xC8, 0xB4, 0xAE, 0x78, 0xA4, 0x2A, 0x5D, 0x7D, 0x3F, 0xCE, 0x3D,
+  0x52, 0x13, 0xF5, 0xB5, 0x0D, 0x42, 0x16, 0x03, 0x03, 0x00, 0x94, 0x0C,
+  0x00, 0x00, 0x90, 0x03, 0x00, 0x17, 0x41, 0x04, 0x77, 0x9C, 0xFB, 0xA2,
+  0xD9, 0x1E, 0x50, 0x84, 0xB5, 0x83, 0x5F, 0xE6, 0xF5, 0x58, 0x89, 0xFF,
+  0x16, 0x48, 0x76, 0xC2, 0xD0, 0x96, 0x4C, 0x8E, 0x89, 0x1F, 0x28, 0x7A,
+  0x76, 0xF0, 0x9B, 0x6D, 0xEF, 0x18, 0x46, 0xA2, 0x39, 0x53, 0x82, 0x4B,
+  0xA0, 0x7C, 0x4F, 0x2E, 0x4B, 0xDD, 0xA1, 0x5A, 0xE9, 0xFD, 0x28, 0xC6,
+  0x44, 0xC8, 0x5D, 0x52, 0x7F, 0x5F, 0xA1, 0x6E, 0x85, 0x35, 0x05, 0x38,
+  0x04, 0x03, 0x00, 0x47, 0x30, 0x45, 0x02, 0x21, 0x00, 0xE8, 0xE1, 0x25,
+  0x9C, 0xE5, 0x25, 0x78, 0xC6, 0xC2, 0xE3, 0xFE, 0xD3, 0xBE, 0xF5, 0xE2,
+  0x85, 0x6E, 0x4C, 0xDC, 0x61, 0xF9, 0x8C, 0xCF, 0xFD, 0xFA, 0xEC, 0xF9,
+  0xB6, 0xAA, 0x3B, 0xC1, 0xE6, 0x02, 0x20, 0x1B, 0xEA, 0x9C, 0x56, 0xC4,
+  0x87, 0x1B, 0xEC, 0xEA, 0x37, 0xA3, 0x31, 0x27, 0xE1, 0x9C, 0x56, 0x7A,
+  0x80, 0xA1, 0xC3, 0xB2, 0x38, 0x55, 0xCC, 0xD4, 0x93, 0xF9, 0x4B, 0x26,
+  0xC8, 0xA3, 0xB9, 0x16, 0x03, 0x03, 0x00, 0x04, 0x0E, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7E, 0x16, 0x03, 0x03, 0x00, 0x46, 0x10, 0x00, 0x00, 0x42,
+  0x41, 0x04, 0x74, 0xC7, 0xA4, 0xF5, 0xF0, 0x86, 0x94, 0x6A, 0x0E, 0x26,
+  0x6B, 0xD3, 0xC8, 0x97, 0x7C, 0xD9, 0xE7, 0x8F, 0x9F, 0xFD, 0xFF, 0x6B,
+  0x5D, 0x23, 0xBF, 0x5B, 0xAA, 0x22, 0xA1, 0xFB, 0xD4, 0x3A, 0xB7, 0x93,
+  0x24, 0x99, 0x65, 0x47, 0x0E, 0xC9, 0x6A, 0x46, 0x3E, 0x67, 0x47, 0x0A,
+  0x92, 0x26, 0xBE, 0xB3, 0x28, 0x85, 0x6A, 0xF9, 0x95, 0x28, 0x40, 0x82,
+  0x03, 0x74, 0xCD, 0xE9, 0x30, 0xCB, 0x14, 0x03, 0x03, 0x00, 0x01, 0x01,
+  0x16, 0x03, 0x03, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x56, 0xF5, 0x93, 0x84, 0xED, 0xA3, 0x19, 0xE2, 0x41, 0xB1, 0xA1,
+  0x54, 0x43, 0xEF, 0x0A, 0x83, 0x00, 0xD6, 0x14, 0x40, 0x74, 0x0F, 0x8F,
+  0x78, 0xB4, 0x8B, 0x23, 0xD8, 0x6F, 0x5C, 0xBB, 0x72, 0x01, 0x00, 0x33,
+  0x14, 0x03, 0x03, 0x00, 0x01, 0x01, 0x16, 0x03, 0x03, 0x00, 0x28, 0xA1,
+  0x7C, 0x41, 0x34, 0xDF, 0x15, 0x05, 0x74, 0x7A, 0x59, 0xA4, 0x69, 0xCA,
+  0xF9, 0x44, 0xB5, 0xF8, 0xFF, 0x18, 0x9C, 0x94, 0x33, 0x27, 0x4A, 0x1E,
+  0x07, 0x07, 0x20, 0x86, 0xB8, 0x3D, 0xEC, 0xA3, 0xC3, 0xC5, 0x6E, 0xED,
+  0xE8, 0x5E, 0xCA, 0x00, 0x00, 0x1F, 0x15, 0x03, 0x03, 0x00, 0x1A, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8F, 0x94, 0x8A, 0x36, 0x93,
+  0x96, 0x7C, 0xE8, 0x28, 0x3B, 0x95, 0x03, 0x50, 0x81, 0x0D, 0x52, 0xE0,
+  0x71, 0x01, 0x00, 0x1F, 0x15, 0x03, 0x03, 0x00, 0x1A, 0xA1, 0x7C, 0x41,
+  0x34, 0xDF, 0x15, 0x05, 0x75, 0x0A, 0xB8, 0x5E, 0x1D, 0xB6, 0x61, 0x32,
+  0x47, 0xD6, 0x3F, 0x45, 0x22, 0x55, 0x1A, 0x7E, 0x98, 0xA6, 0x03
+};
+
+static const uint8_t ECDSA_X25519_CHACHA20[] = {
+  0x00, 0x00, 0xD6, 0x16, 0x03, 0x01, 0x00, 0xD1, 0x01, 0x00, 0x00, 0xCD,
+  0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC4, 0x8A, 0xF1, 0xFF, 0x86, 0x82,
+  0xAF, 0x9C, 0x07, 0x1D, 0x55, 0xE4, 0xBF, 0x9F, 0xDB, 0xD2, 0x67, 0x29,
+  0x04, 0x95, 0xDB, 0x97, 0x14, 0x38, 0xAF, 0x99, 0xB2, 0xCD, 0x00, 0x00,
+  0x5A, 0xCC, 0xA9, 0xCC, 0xA8, 0xC0, 0x2B, 0xC0, 0x2F, 0xC0, 0x2C, 0xC0,
+  0x30, 0xC0, 0xAC, 0xC0, 0xAD, 0xC0, 0xAE, 0xC0, 0xAF, 0xC0, 0x23, 0xC0,
+  0x27, 0xC0, 0x24, 0xC0, 0x28, 0xC0, 0x09, 0xC0, 0x13, 0xC0, 0x0A, 0xC0,
+  0x14, 0xC0, 0x2D, 0xC0, 0x31, 0xC0, 0x2E, 0xC0, 0x32, 0xC0, 0x25, 0xC0,
+  0x29, 0xC0, 0x26, 0xC0, 0x2A, 0xC0, 0x04, 0xC0, 0x0E, 0xC0, 0x05, 0xC0,
+  0x0F, 0x00, 0x9C, 0x00, 0x9D, 0xC0, 0x9C, 0xC0, 0x9D, 0xC0, 0xA0, 0xC0,
+  0xA1, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x35, 0xC0, 0x08, 0xC0,
+  0x12, 0xC0, 0x03, 0xC0, 0x0D, 0x00, 0x0A, 0x01, 0x00, 0x00, 0x4A, 0xFF,
+  0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x00,
+  0x09, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x68, 0x6F, 0x73, 0x74, 0x00, 0x01,
+  0x00, 0x01, 0x01, 0x00, 0x0D, 0x00, 0x16, 0x00, 0x14, 0x04, 0x03, 0x03,
+  0x03, 0x05, 0x03, 0x06, 0x03, 0x02, 0x03, 0x04, 0x01, 0x03, 0x01, 0x05,
+  0x01, 0x06, 0x01, 0x02, 0x01, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x08, 0x00,
+  0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1D, 0x00, 0x0B, 0x00, 0x02, 0x01,
+  0x00, 0x01, 0x02, 0x93, 0x16, 0x03, 0x03, 0x00, 0x5E, 0x02, 0x00, 0x00,
+  0x5A, 0x03, 0x03, 0x60, 0xE5, 0x14, 0x5A, 0xD3, 0xE4, 0x24, 0xE4, 0xD8,
+  0xCC, 0xB3, 0xA9, 0xAF, 0xDE, 0xBC, 0xDE, 0x36, 0xD1, 0xFA, 0x1B, 0xAA,
+  0xFE, 0x44, 0x47, 0x44, 0x4F, 0x57, 0x4E, 0x47, 0x52, 0x44, 0x01, 0x20,
+  0x2C, 0xF4, 0xFA, 0x60, 0x9F, 0x32, 0x8D, 0xDB, 0x5F, 0x4B, 0x16, 0x2F,
+  0x4F, 0x29, 0x29, 0xC7, 0x10, 0xF4, 0x6C, 0xAF, 0xC7, 0xEF, 0xAA, 0x5E,
+  0xEE, 0x8B, 0x0A, 0x59, 0x62, 0xC5, 0x9B, 0x14, 0xCC, 0xA9, 0x00, 0x00,
+  0x12, 0xFF, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00,
+  0x0B, 0x00, 0x04, 0x03, 0x00, 0x01, 0x02, 0x16, 0x03, 0x03, 0x01, 0xAA,
+  0x0B, 0x00, 0x01, 0xA6, 0x00, 0x01, 0xA3, 0x00, 0x01, 0xA0, 0x30, 0x82,
+  0x01, 0x9C, 0x30, 0x82, 0x01, 0x42, 0xA0, 0x03, 0x02, 0x01, 0x02, 0x02,
+  0x01, 0x03, 0x30, 0x0A, 0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x04,
+  0x03, 0x02, 0x30, 0x26, 0x31, 0x24, 0x30, 0x22, 0x06, 0x03, 0x55, 0x04,
+  0x03, 0x0C, 0x1B, 0x41, 0x72, 0x64, 0x75, 0x69, 0x6E, 0x6F, 0x42, 0x65,
+  0x61, 0x72, 0x53, 0x53, 0x4C, 0x20, 0x52, 0x65, 0x70, 0x6C, 0x61, 0x79,
+  0x20, 0x45, 0x43, 0x20, 0x43, 0x41, 0x30, 0x1E, 0x17, 0x0D, 0x32, 0x36,
+  0x31, 0x30, 0x31, 0x34, 0x31, 0x31, 0x35, 0x30, 0x31, 0x32, 0x5A, 0x17,
+  0x0D, 0x34, 0x36, 0x31, 0x30, 0x30, 0x39, 0x31, 0x31, 0x35, 0x30, 0x31,
+  0x32, 0x5A, 0x30, 0x14, 0x31, 0x12, 0x30, 0x10, 0x06, 0x03, 0x55, 0x04,
+  0x03, 0x0C, 0x09, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x68, 0x6F, 0x73, 0x74,
+  0x30, 0x59, 0x30, 0x13, 0x06, 0x07, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x02,
+  0x01, 0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x03, 0x01, 0x07, 0x03,
+  0x42, 0x00, 0x04, 0x77, 0x3E, 0xD1, 0x03, 0x59, 0xFC, 0x95, 0x29, 0xAC,
+  0x7A, 0xE4, 0x84, 0xCE, 0xFF, 0xA3, 0xBC, 0x85, 0x72, 0x65, 0x19, 0xEF,
+  0x67, 0x1A, 0x1D, 0xB3, 0x02, 0x6D, 0x86, 0x23, 0x6C, 0x0E, 0x1F, 0xD0,
+  0xFF, 0x1C, 0x62, 0x53, 0xBD, 0xD6, 0x24, 0x27, 0xEA, 0xF4, 0x6A, 0x1C,
+  0x95, 0x6E, 0x4F, 0x0C, 0xF1, 0xC7, 0x2C, 0x26, 0x77, 0xB0, 0x16, 0x40,
+  0x58, 0xE5, 0x74, 0xE2, 0xEE, 0x46, 0x25, 0xA3, 0x73, 0x30, 0x71, 0x30,
+  0x09, 0x06, 0x03, 0x55, 0x1D, 0x13, 0x04, 0x02, 0x30, 0x00, 0x30, 0x0E,
+  0x06, 0x03, 0x55, 0x1D, 0x0F, 0x01, 0x01, 0xFF, 0x04, 0x04, 0x03, 0x02,
+  0x05, 0xA0, 0x30, 0x14, 0x06, 0x03, 0x55, 0x1D, 0x11, 0x04, 0x0D, 0x30,
+  0x0B, 0x82, 0x09, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x68, 0x6F, 0x73, 0x74,
+  0x30, 0x1D, 0x06, 0x03, 0x55, 0x1D, 0x0E, 0x04, 0x16, 0x04, 0x14, 0xAB,
+  0xC0, 0xA2, 0x33, 0xDE, 0x4A, 0xB3, 0x26, 0x06, 0x68, 0x00, 0x8C, 0x89,
+  0xC9, 0xF7, 0x78, 0xD0, 0x42, 0xF6, 0xE5, 0x30, 0x1F, 0x06, 0x03, 0x55,
+  0x1D, 0x23, 0x04, 0x18, 0x30, 0x16, 0x80, 0x14, 0xB6, 0x80, 0xD2, 0x98,
+  0xE0, 0xBF, 0xA3, 0x95, 0x93, 0x66, 0x35, 0x7C, 0x78, 0x02, 0xF1, 0xC4,
+  0xC6, 0x28, 0xCC, 0xCD, 0x30, 0x0A, 0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE,
+  0x3D, 0x04, 0x03, 0x02, 0x03, 0x48, 0x00, 0x30, 0x45, 0x02, 0x20, 0x55,
+  0xE9, 0xFF, 0x73, 0x71, 0x4C, 0x45, 0x80, 0x5E, 0x76, 0xB2, 0x72, 0x80,
+  0x60, 0xFC, 0x2D, 0x0D, 0xB9, 0xFB, 0x37, 0x03, 0x50, 0x79, 0x52, 0xD4,
+  0x53, 0x14, 0x85, 0x3A, 0xEA, 0x49, 0xA1, 0x02, 0x21, 0x00, 0xF8, 0x1A,
+  0x29, 0x67, 0x2A, 0xD7, 0xCD, 0x30, 0xA8, 0xB6, 0x85, 0x03, 0x7D, 0xDA,
+  0xD9, 0xC8, 0xB4, 0xAE, 0x78, 0xA4, 0x2A, 0x5D, 0x7D, 0x3F, 0xCE, 0x3D,
+  0x52, 0x13, 0xF5, 0xB5, 0x0D, 0x42, 0x16, 0x03, 0x03, 0x00, 0x73, 0x0C,
+  0x00, 0x00, 0x6F, 0x03, 0x00, 0x1D, 0x20, 0xB5, 0x2F, 0x7A, 0xCA, 0x64,
+  0xBC, 0x5A, 0x65, 0x37, 0x08, 0x87, 0xCB, 0x85, 0x4C, 0x29, 0xF3, 0xFB,
+  0x39, 0x18, 0xAF, 0xA0, 0x67, 0x1F, 0x7B, 0x6F, 0x06, 0xDC, 0x16, 0x8E,
+  0xE5, 0x18, 0x61, 0x04, 0x03, 0x00, 0x47, 0x30, 0x45, 0x02, 0x20, 0x2F,
+  0x18, 0xAC, 0x4B, 0x47, 0x30, 0xD1, 0x2F, 0x89, 0x9C, 0x0F, 0x78, 0x82,
+  0xB7, 0x32, 0x71, 0x6C, 0x6D, 0x39, 0x80, 0x20, 0xD3, 0x20, 0x7B, 0x06,
+  0xE7, 0xC5, 0x40, 0xEC, 0x4B, 0x73, 0x9A, 0x02, 0x21, 0x00, 0xEB, 0xCD,
+  0x14, 0x51, 0x33, 0x29, 0xEB, 0x6A, 0x1E, 0x50, 0xDB, 0xEA, 0x39, 0x7C,
+  0x5B, 0x86, 0x34, 0xD5, 0x0E, 0x7F, 0xC0, 0x07, 0xD3, 0x36, 0xCA, 0x56,
+  0x3F, 0x3E, 0x93, 0xCE, 0x35, 0x11, 0x16, 0x03, 0x03, 0x00, 0x04, 0x0E,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x16, 0x03, 0x03, 0x00, 0x25, 0x10,
+  0x00, 0x00, 0x21, 0x20, 0xA5, 0xEE, 0x26, 0x46, 0x4D, 0xF4, 0x62, 0xFB,
+  0x4D, 0x31, 0x1D, 0x55, 0x4D, 0xCD, 0xA5, 0x21, 0x4F, 0x90, 0x94, 0x0A,
+  0x6C, 0xBB, 0x8F, 0xCA, 0xC3, 0xBF, 0xE2, 0xCA, 0x4C, 0x4E, 0xBE, 0x3E,
+  0x14, 0x03, 0x03, 0x00, 0x01, 0x01, 0x16, 0x03, 0x03, 0x00, 0x20, 0xB5,
+  0xC6, 0x30, 0xEC, 0x1A, 0x5D, 0xF3, 0x4B, 0x62, 0xFC, 0xA8, 0xA5, 0x96,
+  0xD7, 0x62, 0xD2, 0x27, 0xAA, 0x88, 0x8B, 0x66, 0x78, 0x63, 0x20, 0x9D,
+  0xE7, 0x8C, 0xC7, 0x8F, 0x2A, 0xE8, 0xA7, 0x01, 0x00, 0x2B, 0x14, 0x03,
+  0x03, 0x00, 0x01, 0x01, 0x16, 0x03, 0x03, 0x00, 0x20, 0x20, 0x48, 0x23,
+  0xAB, 0x34, 0x26, 0xD3, 0x78, 0xAE, 0xB4, 0x01, 0x02, 0x9B, 0xA6, 0x14,
+  0x9A, 0xAE, 0xA7, 0x76, 0xDE, 0x2F, 0x5D, 0x77, 0x18, 0x4C, 0x9F, 0x0D,
+  0x81, 0xD6, 0x35, 0xC6, 0x32, 0x00, 0x00, 0x17, 0x15, 0x03, 0x03, 0x00,
+  0x12, 0xF9, 0xA1, 0x94, 0xCA, 0xD0, 0x90, 0xB2, 0x0D, 0x40, 0xEC, 0xAB,
+  0x35, 0xA6, 0x5F, 0x1E, 0x84, 0xEA, 0xCF, 0x01, 0x00, 0x17, 0x15, 0x03,
+  0x03, 0x00, 0x12, 0x54, 0x20, 0xF6, 0xA0, 0x69, 0x01, 0xDC, 0x18, 0x5B,
+  0x55, 0x95, 0x5F, 0x74, 0x27, 0xF1, 0x5C, 0xE8, 0xA3
+};
+
+static const uint8_t ECDSA_CHAIN2_AES256_GCM[] = {
+  0x00, 0x00, 0xD6, 0x16, 0x03, 0x01, 0x00, 0xD1, 0x01, 0x00, 0x00, 0xCD,
+  0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC4, 0x8A, 0xF1, 0xFF, 0x86, 0x82,
+  0xAF, 0x9C, 0x07, 0x1D, 0x55, 0xE4, 0xBF, 0x9F, 0xDB, 0xD2, 0x67, 0x29,
+  0x04, 0x95, 0xDB, 0x97, 0x14, 0x38, 0xAF, 0x99, 0xB2, 0xCD, 0x00, 0x00,
+  0x5A, 0xCC, 0xA9, 0xCC, 0xA8, 0xC0, 0x2B, 0xC0, 0x2F, 0xC0, 0x2C, 0xC0,
+  0x30, 0xC0, 0xAC, 0xC0, 0xAD, 0xC0, 0xAE, 0xC0, 0xAF, 0xC0, 0x23, 0xC0,
+  0x27, 0xC0, 0x24, 0xC0, 0x28, 0xC0, 0x09, 0xC0, 0x13, 0xC0, 0x0A, 0xC0,
+  0x14, 0xC0, 0x2D, 0xC0, 0x31, 0xC0, 0x2E, 0xC0, 0x32, 0xC0, 0x25, 0xC0,
+  0x29, 0xC0, 0x26, 0xC0, 0x2A, 0xC0, 0x04, 0xC0, 0x0E, 0xC0, 0x05, 0xC0,
+  0x0F, 0x00, 0x9C, 0x00, 0x9D, 0xC0, 0x9C, 0xC0, 0x9D, 0xC0, 0xA0, 0xC0,
+  0xA1, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x35, 0xC0, 0x08, 0xC0,
+  0x12, 0xC0, 0x03, 0xC0, 0x0D, 0x00, 0x0A, 0x01, 0x00, 0x00, 0x4A, 0xFF,
+  0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x00,
+  0x09, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x68, 0x6F, 0x73, 0x74, 0x00, 0x01,
+  0x00, 0x01, 0x01, 0x00, 0x0D, 0x00, 0x16, 0x00, 0x14, 0x04, 0x03, 0x03,
+  0x03, 0x05, 0x03, 0x06, 0x03, 0x02, 0x03, 0x04, 0x01, 0x03, 0x01, 0x05,
+  0x01, 0x06, 0x01, 0x02, 0x01, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x08, 0x00,
+  0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1D, 0x00, 0x0B, 0x00, 0x02, 0x01,
+  0x00, 0x01, 0x04, 0x72, 0x16, 0x03, 0x03, 0x00, 0x5E, 0x02, 0x00, 0x00,
+  0x5A, 0x03, 0x03, 0xAB, 0x4F, 0xE4, 0x80, 0xE3, 0x71, 0xC3, 0xE3, 0x1B,
+  0x31, 0x46, 0x44, 0x09, 0x14, 0x21, 0x1D, 0xD2, 0xA6, 0xAD, 0x68, 0x1B,
+  0xAD, 0x9D, 0x6E, 0x44, 0x4F, 0x57, 0x4E, 0x47, 0x52, 0x44, 0x01, 0x20,
+  0x25, 0xDB, 0x20, 0x73, 0x57, 0x92, 0xFC, 0x35, 0x88, 0xC6, 0xB7, 0x26,
+  0x65, 0x8A, 0xA9, 0xC9, 0xDC, 0xFE, 0x52, 0xCE, 0x53, 0x8E, 0x7D, 0x6B,
+  0x16, 0x30, 0xD4, 0x2E, 0x16, 0x81, 0xDC, 0xEF, 0xC0, 0x2C, 0x00, 0x00,
+  0x12, 0xFF, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00,
+  0x0B, 0x00, 0x04, 0x03, 0x00, 0x01, 0x02, 0x16, 0x03, 0x03, 0x02, 0x00,
+  0x0B, 0x00, 0x03, 0x5F, 0x00, 0x03, 0x5C, 0x00, 0x01, 0xAB, 0x30, 0x82,
+  0x01, 0xA7, 0x30, 0x82, 0x01, 0x4C, 0xA0, 0x03, 0x02, 0x01, 0x02, 0x02,
+  0x01, 0x04, 0x30, 0x0A, 0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x04,
+  0x03, 0x02, 0x30, 0x30, 0x31, 0x2E, 0x30, 0x2C, 0x06, 0x03, 0x55, 0x04,
+  0x03, 0x0C, 0x25, 0x41, 0x72, 0x64, 0x75, 0x69, 0x6E, 0x6F, 0x42, 0x65,
+  0x61, 0x72, 0x53, 0x53, 0x4C, 0x20, 0x52, 0x65, 0x70, 0x6C, 0x61, 0x79,
+  0x20, 0x45, 0x43, 0x20, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x6D, 0x65, 0x64,
+  0x69, 0x61, 0x74, 0x65, 0x30, 0x1E, 0x17, 0x0D, 0x32, 0x36, 0x31, 0x30,
+  0x31, 0x34, 0x31, 0x31, 0x35, 0x30, 0x31, 0x32, 0x5A, 0x17, 0x0D, 0x34,
+  0x36, 0x31, 0x30, 0x30, 0x39, 0x31, 0x31, 0x35, 0x30, 0x31, 0x32, 0x5A,
+  0x30, 0x14, 0x31, 0x12, 0x30, 0x10, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0C,
+  0x09, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x68, 0x6F, 0x73, 0x74, 0x30, 0x59,
+  0x30, 0x13, 0x06, 0x07, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x02, 0x01, 0x06,
+  0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x03, 0x01, 0x07, 0x03, 0x42, 0x00,
+  0x04, 0x49, 0xBC, 0x10, 0x96, 0xB8, 0xFF, 0x7F, 0x79, 0x3D, 0x95, 0xD7,
+  0x64, 0x64, 0xB9, 0x42, 0x70, 0x3E, 0xDE, 0x29, 0x43, 0x09, 0xEF, 0xE6,
+  0x73, 0x9C, 0x13, 0xB5, 0x81, 0xEF, 0x83, 0x5B, 0x17, 0x6C, 0xB8, 0x1C,
+  0x08, 0x53, 0x93, 0x9E, 0xE1, 0x78, 0x80, 0x3A, 0x1F, 0x45, 0x9B, 0xAA,
+  0x59, 0xFF, 0x55, 0xBD, 0x02, 0xD4, 0xAB, 0x57, 0xFB, 0x9B, 0x73, 0xD2,
+  0xC2, 0x8D, 0x18, 0xB4, 0x68, 0xA3, 0x73, 0x30, 0x71, 0x30, 0x09, 0x06,
+  0x03, 0x55, 0x1D, 0x13, 0x04, 0x02, 0x30, 0x00, 0x30, 0x0E, 0x06, 0x03,
+  0x55, 0x1D, 0x0F, 0x01, 0x01, 0xFF, 0x04, 0x04, 0x03, 0x02, 0x05, 0xA0,
+  0x30, 0x14, 0x06, 0x03, 0x55, 0x1D, 0x11, 0x04, 0x0D, 0x30, 0x0B, 0x82,
+  0x09, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x68, 0x6F, 0x73, 0x74, 0x30, 0x1D,
+  0x06, 0x03, 0x55, 0x1D, 0x0E, 0x04, 0x16, 0x04, 0x14, 0xCA, 0xC9, 0x95,
+  0x85, 0xE8, 0x35, 0x8C, 0x29, 0x5F, 0xD9, 0x05, 0x80, 0x83, 0xAD, 0x87,
+  0x80, 0xD5, 0x2D, 0xDD, 0xB9, 0x30, 0x1F, 0x06, 0x03, 0x55, 0x1D, 0x23,
+  0x04, 0x18, 0x30, 0x16, 0x80, 0x14, 0x55, 0x03, 0x42, 0xFF, 0xF6, 0xE6,
+  0x95, 0x0B, 0xB1, 0x0A, 0x53, 0x5B, 0x9D, 0x6F, 0x1F, 0x05, 0x86, 0xEE,
+  0x35, 0x23, 0x30, 0x0A, 0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x04,
+  0x03, 0x02, 0x03, 0x49, 0x00, 0x30, 0x46, 0x02, 0x21, 0x00, 0x93, 0xF1,
+  0x94, 0x4E, 0x55, 0x1B, 0x56, 0x06, 0xE9, 0xA1, 0xBA, 0x4B, 0x48, 0xAA,
+  0xA3, 0xAF, 0x4B, 0x90, 0xC7, 0x8C, 0x57, 0xCD, 0x3B, 0x95, 0x21, 0x25,
+  0x59, 0xA0, 0xCF, 0x7D, 0xEE, 0x53, 0x02, 0x21, 0x00, 0xA2, 0x0C, 0xFC,
+  0x52, 0x7B, 0x52, 0x26, 0x23, 0x6C, 0xFA, 0xEF, 0x1D, 0xCA, 0xFE, 0x1B,
+  0x3C, 0x0D, 0x9C, 0x49, 0x52, 0x3A, 0x9E, 0x07, 0x62, 0x79, 0x59, 0xE2,
+  0xF4, 0x74, 0xEE, 0xF6, 0xC9, 0x00, 0x01, 0xAB, 0x30, 0x82, 0x01, 0xA7,
+  0x30, 0x82, 0x01, 0x4E, 0xA0, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02,
+  0x30, 0x0A, 0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x04, 0x03, 0x02,
+  0x30, 0x26, 0x31, 0x24, 0x30, 0x22, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0C,
+  0x1B, 0x41, 0x72, 0x64, 0x75, 0x69, 0x6E, 0x6F, 0x42, 0x65, 0x61, 0x72,
+  0x53, 0x53, 0x4C, 0x20, 0x52, 0x65, 0x70, 0x6C, 0x61, 0x79, 0x20, 0x45,
+  0x43, 0x20, 0x43, 0x41, 0x30, 0x1E, 0x17, 0x0D, 0x16, 0x03, 0x03, 0x01,
+  0x63, 0x32, 0x36, 0x31, 0x30, 0x31, 0x34, 0x31, 0x31, 0x35, 0x30, 0x31,
+  0x32, 0x5A, 0x17, 0x0D, 0x34, 0x36, 0x31, 0x30, 0x30, 0x39, 0x31, 0x31,
+  0x35, 0x30, 0x31, 0x32, 0x5A, 0x30, 0x30, 0x31, 0x2E, 0x30, 0x2C, 0x06,
+  0x03, 0x55, 0x04, 0x03, 0x0C, 0x25, 0x41, 0x72, 0x64, 0x75, 0x69, 0x6E,
+  0x6F, 0x42, 0x65, 0x61, 0x72, 0x53, 0x53, 0x4C, 0x20, 0x52, 0x65, 0x70,
+  0x6C, 0x61, 0x79, 0x20, 0x45, 0x43, 0x20, 0x49, 0x6E, 0x74, 0x65, 0x72,
+  0x6D, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x30, 0x59, 0x30, 0x13, 0x06,
+  0x07, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x02, 0x01, 0x06, 0x08, 0x2A, 0x86,
+  0x48, 0xCE, 0x3D, 0x03, 0x01, 0x07, 0x03, 0x42, 0x00, 0x04, 0x20, 0x58,
+  0xCD, 0x9A, 0x39, 0x46, 0x24, 0xCE, 0xBC, 0x30, 0xCC, 0xFB, 0x0E, 0xCD,
+  0xCC, 0x61, 0xA2, 0x19, 0x4D, 0x30, 0x53, 0x0B, 0x01, 0xE6, 0x4F, 0xCF,
+  0x1C, 0x2D, 0xF4, 0xFC, 0x25, 0xF2, 0x74, 0x42, 0x1A, 0xB1, 0x14, 0x7A,
+  0xA4, 0x19, 0x30, 0xED, 0x81, 0xF9, 0x02, 0xFB, 0xD6, 0xA4, 0x7F, 0x5F,
+  0x30, 0x24, 0x56, 0x00, 0x6D, 0xC7, 0x95, 0x32, 0xAB, 0x71, 0xCB, 0x8E,
+  0xE1, 0x8A, 0xA3, 0x63, 0x30, 0x61, 0x30, 0x0F, 0x06, 0x03, 0x55, 0x1D,
+  0x13, 0x01, 0x01, 0xFF, 0x04, 0x05, 0x30, 0x03, 0x01, 0x01, 0xFF, 0x30,
+  0x0E, 0x06, 0x03, 0x55, 0x1D, 0x0F, 0x01, 0x01, 0xFF, 0x04, 0x04, 0x03,
+  0x02, 0x01, 0x06, 0x30, 0x1D, 0x06, 0x03, 0x55, 0x1D, 0x0E, 0x04, 0x16,
+  0x04, 0x14, 0x55, 0x03, 0x42, 0xFF, 0xF6, 0xE6, 0x95, 0x0B, 0xB1, 0x0A,
+  0x53, 0x5B, 0x9D, 0x6F, 0x1F, 0x05, 0x86, 0xEE, 0x35, 0x23, 0x30, 0x1F,
+  0x06, 0x03, 0x55, 0x1D, 0x23, 0x04, 0x18, 0x30, 0x16, 0x80, 0x14, 0xB6,
+  0x80, 0xD2, 0x98, 0xE0, 0xBF, 0xA3, 0x95, 0x93, 0x66, 0x35, 0x7C, 0x78,
+  0x02, 0xF1, 0xC4, 0xC6, 0x28, 0xCC, 0xCD, 0x30, 0x0A, 0x06, 0x08, 0x2A,
+  0x86, 0x48, 0xCE, 0x3D, 0x04, 0x03, 0x02, 0x03, 0x47, 0x00, 0x30, 0x44,
+  0x02, 0x20, 0x59, 0xC7, 0xA2, 0x9A, 0x37, 0x99, 0xC4, 0x8A, 0x7D, 0x6B,
+  0xFA, 0x37, 0xF1, 0x2A, 0xA2, 0xD3, 0xF4, 0x5A, 0xF1, 0xE7, 0xB5, 0x19,
+  0x63, 0x59, 0x36, 0x92, 0x4E, 0xF9, 0x7C, 0xDA, 0xDA, 0xB1, 0x02, 0x20,
+  0x63, 0x4A, 0x87, 0x81, 0x21, 0x60, 0x3C, 0x0D, 0xCB, 0x8F, 0xB2, 0x8F,
+  0x70, 0x8B, 0xB9, 0x74, 0x18, 0x64, 0x2A, 0x2E, 0xBF, 0xA8, 0xC4, 0x72,
+  0x32, 0x26, 0x50, 0x2F, 0x36, 0x1F, 0x89, 0x65, 0x16, 0x03, 0x03, 0x00,
+  0x94, 0x0C, 0x00, 0x00, 0x90, 0x03, 0x00, 0x17, 0x41, 0x04, 0x36, 0xBD,
+  0x13, 0x7B, 0x94, 0xE5, 0x76, 0x5E, 0xFA, 0xC4, 0x8D, 0xC8, 0xF6, 0x10,
+  0x00, 0x9F, 0x38, 0xB9, 0x6C, 0x7C, 0xA6, 0xB4, 0xB9, 0x7F, 0x2D, 0xA9,
+  0x1D, 0xEC, 0x53, 0xC9, 0xA0, 0x08, 0x94, 0xA4, 0x29, 0x82, 0x2D, 0x3F,
+  0x22, 0x47, 0x90, 0x89, 0x69, 0xD8, 0x41, 0xAD, 0xB6, 0x4C, 0xEC, 0xC2,
+  0x20, 0xE9, 0xD1, 0x56, 0xD2, 0xBE, 0xD2, 0x33, 0x53, 0xCA, 0xCE, 0x07,
+  0x1A, 0x24, 0x04, 0x03, 0x00, 0x47, 0x30, 0x45, 0x02, 0x20, 0x42, 0x28,
+  0xAF, 0xE5, 0xD2, 0xD0, 0xF4, 0x54, 0x89, 0xF8, 0x2C, 0x5E, 0x1A, 0xC1,
+  0xFB, 0xCC, 0xFD, 0xA0, 0xC4, 0x71, 0x81, 0xB6, 0xB6, 0x65, 0xAE, 0xA0,
+  0x92, 0xC0, 0xF5, 0xF0, 0x92, 0xF9, 0x02, 0x21, 0x00, 0xC9, 0xD4, 0xC5,
+  0xA3, 0xCA, 0x48, 0xD7, 0xB8, 0x47, 0xC8, 0x46, 0x07, 0x1E, 0xDB, 0xAC,
+  0xB9, 0xCA, 0xC9, 0xE1, 0x67, 0xC9, 0x81, 0xFD, 0xF7, 0x60, 0x06, 0x7F,
+  0xBB, 0xA4, 0xEA, 0x6A, 0xBD, 0x16, 0x03, 0x03, 0x00, 0x04, 0x0E, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7E, 0x16, 0x03, 0x03, 0x00, 0x46, 0x10, 0x00,
+  0x00, 0x42, 0x41, 0x04, 0x74, 0xC7, 0xA4, 0xF5, 0xF0, 0x86, 0x94, 0x6A,
+  0x0E, 0x26, 0x6B, 0xD3, 0xC8, 0x97, 0x7C, 0xD9, 0xE7, 0x8F, 0x9F, 0xFD,
+  0xFF, 0x6B, 0x5D, 0x23, 0xBF, 0x5B, 0xAA, 0x22, 0xA1, 0xFB, 0xD4, 0x3A,
+  0xB7, 0x93, 0x24, 0x99, 0x65, 0x47, 0x0E, 0xC9, 0x6A, 0x46, 0x3E, 0x67,
+  0x47, 0x0A, 0x92, 0x26, 0xBE, 0xB3, 0x28, 0x85, 0x6A, 0xF9, 0x95, 0x28,
+  0x40, 0x82, 0x03, 0x74, 0xCD, 0xE9, 0x30, 0xCB, 0x14, 0x03, 0x03, 0x00,
+  0x01, 0x01, 0x16, 0x03, 0x03, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x37, 0xAF, 0x27, 0x8D, 0xB9, 0xDF, 0xAB, 0x52, 0xAB,
+  0x5F, 0xD0, 0x95, 0x6C, 0x25, 0x04, 0xB7, 0xE2, 0x9C, 0x2C, 0x60, 0xB9,
+  0xF9, 0xC1, 0xCC, 0x70, 0xEC, 0x8A, 0xCB, 0x4F, 0xF4, 0x53, 0x6C, 0x01,
+  0x00, 0x33, 0x14, 0x03, 0x03, 0x00, 0x01, 0x01, 0x16, 0x03, 0x03, 0x00,
+  0x28, 0x18, 0xEA, 0xF6, 0xDF, 0x5F, 0x69, 0x77, 0x97, 0x0B, 0x50, 0xC6,
+  0x3C, 0x48, 0xCA, 0x74, 0x18, 0x0C, 0xCB, 0x12, 0x3F, 0x24, 0x1C, 0xB6,
+  0xE3, 0x58, 0xDD, 0xCC, 0x7D, 0x35, 0x5A, 0x56, 0x58, 0x54, 0x85, 0x95,
+  0xA1, 0x3A, 0x06, 0x8B, 0xFB, 0x00, 0x00, 0x1F, 0x15, 0x03, 0x03, 0x00,
+  0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x60, 0x3A, 0x0F,
+  0x61, 0x7C, 0x02, 0x6B, 0x10, 0x33, 0xDF, 0x34, 0xD9, 0xF0, 0x0F, 0x96,
+  0xBF, 0xF4, 0x01, 0x01, 0x00, 0x1F, 0x15, 0x03, 0x03, 0x00, 0x1A, 0x18,
+  0xEA, 0xF6, 0xDF, 0x5F, 0x69, 0x77, 0x98, 0x43, 0xF7, 0x01, 0x77, 0xEB,
+  0xF2, 0x23, 0x27, 0x72, 0x75, 0x35, 0xC6, 0xC5, 0x17, 0xC2, 0x5A, 0x86,
+  0x2D
+};
+
+static const uint8_t ECDSA_CHAIN2_AES128_CBC[] = {
+  0x00, 0x00, 0xD6, 0x16, 0x03, 0x01, 0x00, 0xD1, 0x01, 0x00, 0x00, 0xCD,
+  0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC4, 0x8A, 0xF1, 0xFF, 0x86, 0x82,
+  0xAF, 0x9C, 0x07, 0x1D, 0x55, 0xE4, 0xBF, 0x9F, 0xDB, 0xD2, 0x67, 0x29,
+  0x04, 0x95, 0xDB, 0x97, 0x14, 0x38, 0xAF, 0x99, 0xB2, 0xCD, 0x00, 0x00,
+  0x5A, 0xCC, 0xA9, 0xCC, 0xA8, 0xC0, 0x2B, 0xC0, 0x2F, 0xC0, 0x2C, 0xC0,
+  0x30, 0xC0, 0xAC, 0xC0, 0xAD, 0xC0, 0xAE, 0xC0, 0xAF, 0xC0, 0x23, 0xC0,
+  0x27, 0xC0, 0x24, 0xC0, 0x28, 0xC0, 0x09, 0xC0, 0x13, 0xC0, 0x0A, 0xC0,
+  0x14, 0xC0, 0x2D, 0xC0, 0x31, 0xC0, 0x2E, 0xC0, 0x32, 0xC0, 0x25, 0xC0,
+  0x29, 0xC0, 0x26, 0xC0, 0x2A, 0xC0, 0x04, 0xC0, 0x0E, 0xC0, 0x05, 0xC0,
+  0x0F, 0x00, 0x9C, 0x00, 0x9D, 0xC0, 0x9C, 0xC0, 0x9D, 0xC0, 0xA0, 0xC0,
+  0xA1, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x35, 0xC0, 0x08, 0xC0,
+  0x12, 0xC0, 0x03, 0xC0, 0x0D, 0x00, 0x0A, 0x01, 0x00, 0x00, 0x4A, 0xFF,
+  0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x00,
+  0x09, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x68, 0x6F, 0x73, 0x74, 0x00, 0x01,
+  0x00, 0x01, 0x01, 0x00, 0x0D, 0x00, 0x16, 0x00, 0x14, 0x04, 0x03, 0x03,
+  0x03, 0x05, 0x03, 0x06, 0x03, 0x02, 0x03, 0x04, 0x01, 0x03, 0x01, 0x05,
+  0x01, 0x06, 0x01, 0x02, 0x01, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x08, 0x00,
+  0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1D, 0x00, 0x0B, 0x00, 0x02, 0x01,
+  0x00, 0x01, 0x04, 0x73, 0x16, 0x03, 0x03, 0x00, 0x5E, 0x02, 0x00, 0x00,
+  0x5A, 0x03, 0x03, 0x27, 0x95, 0xD0, 0x1D, 0x12, 0xFF, 0xAE, 0x14, 0x03,
+  0xB1, 0x52, 0x45, 0x02, 0x55, 0x47, 0xF1, 0xA8, 0xB8, 0xA6, 0x75, 0x10,
+  0xFB, 0x21, 0x34, 0x44, 0x4F, 0x57, 0x4E, 0x47, 0x52, 0x44, 0x01, 0x20,
+  0xE5, 0x6B, 0x73, 0xCE, 0x2E, 0x52, 0xB9, 0xBC, 0x3B, 0xBE, 0xFE, 0x52,
+  0x66, 0x56, 0x86, 0x67, 0x19, 0xD6, 0xA7, 0x54, 0x19, 0x44, 0xC6, 0xB0,
+  0x0C, 0xB7, 0xD5, 0x41, 0xED, 0xA9, 0x43, 0xD7, 0xC0, 0x23, 0x00, 0x00,
+  0x12, 0xFF, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00,
+  0x0B, 0x00, 0x04, 0x03, 0x00, 0x01, 0x02, 0x16, 0x03, 0x03, 0x02, 0x00,
+  0x0B, 0x00, 0x03, 0x5F, 0x00, 0x03, 0x5C, 0x00, 0x01, 0xAB, 0x30, 0x82,
+  0x01, 0xA7, 0x30, 0x82, 0x01, 0x4C, 0xA0, 0x03, 0x02, 0x01, 0x02, 0x02,
+  0x01, 0x04, 0x30, 0x0A, 0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x04,
+  0x03, 0x02, 0x30, 0x30, 0x31, 0x2E, 0x30, 0x2C, 0x06, 0x03, 0x55, 0x04,
+  0x03, 0x0C, 0x25, 0x41, 0x72, 0x64, 0x75, 0x69, 0x6E, 0x6F, 0x42, 0x65,
+  0x61, 0x72, 0x53, 0x53, 0x4C, 0x20, 0x52, 0x65, 0x70, 0x6C, 0x61, 0x79,
+  0x20, 0x45, 0x43, 0x20, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x6D, 0x65, 0x64,
+  0x69, 0x61, 0x74, 0x65, 0x30, 0x1E, 0x17, 0x0D, 0x32, 0x36, 0x31, 0x30,
+  0x31, 0x34, 0x31, 0x31, 0x35, 0x30, 0x31, 0x32, 0x5A, 0x17, 0x0D, 0x34,
+  0x36, 0x31, 0x30, 0x30, 0x39, 0x31, 0x31, 0x35, 0x30, 0x31, 0x32, 0x5A,
+  0x30, 0x14, 0x31, 0x12, 0x30, 0x10, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0C,
+  0x09, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x68, 0x6F, 0x73, 0x74, 0x30, 0x59,
+  0x30, 0x13, 0x06, 0x07, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x02, 0x01, 0x06,
+  0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x03, 0x01, 0x07, 0x03, 0x42, 0x00,
+  0x04, 0x49, 0xBC, 0x10, 0x96, 0xB8, 0xFF, 0x7F, 0x79, 0x3D, 0x95, 0xD7,
+  0x64, 0x64, 0xB9, 0x42, 0x70, 0x3E, 0xDE, 0x29, 0x43, 0x09, 0xEF, 0xE6,
+  0x73, 0x9C, 0x13, 0xB5, 0x81, 0xEF, 0x83, 0x5B, 0x17, 0x6C, 0xB8, 0x1C,
+  0x08, 0x53, 0x93, 0x9E, 0xE1, 0x78, 0x80, 0x3A, 0x1F, 0x45, 0x9B, 0xAA,
+  0x59, 0xFF, 0x55, 0xBD, 0x02, 0xD4, 0xAB, 0x57, 0xFB, 0x9B, 0x73, 0xD2,
+  0xC2, 0x8D, 0x18, 0xB4, 0x68, 0xA3, 0x73, 0x30, 0x71, 0x30, 0x09, 0x06,
+  0x03, 0x55, 0x1D, 0x13, 0x04, 0x02, 0x30, 0x00, 0x30, 0x0E, 0x06, 0x03,
+  0x55, 0x1D, 0x0F, 0x01, 0x01, 0xFF, 0x04, 0x04, 0x03, 0x02, 0x05, 0xA0,
+  0x30, 0x14, 0x06, 0x03, 0x55, 0x1D, 0x11, 0x04, 0x0D, 0x30, 0x0B, 0x82,
+  0x09, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x68, 0x6F, 0x73, 0x74, 0x30, 0x1D,
+  0x06, 0x03, 0x55, 0x1D, 0x0E, 0x04, 0x16, 0x04, 0x14, 0xCA, 0xC9, 0x95,
+  0x85, 0xE8, 0x35, 0x8C, 0x29, 0x5F, 0xD9, 0x05, 0x80, 0x83, 0xAD, 0x87,
+  0x80, 0xD5, 0x2D, 0xDD, 0xB9, 0x30, 0x1F, 0x06, 0x03, 0x55, 0x1D, 0x23,
+  0x04, 0x18, 0x30, 0x16, 0x80, 0x14, 0x55, 0x03, 0x42, 0xFF, 0xF6, 0xE6,
+  0x95, 0x0B, 0xB1, 0x0A, 0x53, 0x5B, 0x9D, 0x6F, 0x1F, 0x05, 0x86, 0xEE,
+  0x35, 0x23, 0x30, 0x0A, 0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x04,
+  0x03, 0x02, 0x03, 0x49, 0x00, 0x30, 0x46, 0x02, 0x21, 0x00, 0x93, 0xF1,
+  0x94, 0x4E, 0x55, 0x1B, 0x56, 0x06, 0xE9, 0xA1, 0xBA, 0x4B, 0x48, 0xAA,
+  0xA3, 0xAF, 0x4B, 0x90, 0xC7, 0x8C, 0x57, 0xCD, 0x3B, 0x95, 0x21, 0x25,
+  0x59, 0xA0, 0xCF, 0x7D, 0xEE, 0x53, 0x02, 0x21, 0x00, 0xA2, 0x0C, 0xFC,
+  0x52, 0x7B, 0x52, 0x26, 0x23, 0x6C, 0xFA, 0xEF, 0x1D, 0xCA, 0xFE, 0x1B,
+  0x3C, 0x0D, 0x9C, 0x49, 0x52, 0x3A, 0x9E, 0x07, 0x62, 0x79, 0x59, 0xE2,
+  0xF4, 0x74, 0xEE, 0xF6, 0xC9, 0x00, 0x01, 0xAB, 0x30, 0x82, 0x01, 0xA7,
+  0x30, 0x82, 0x01, 0x4E, 0xA0, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02,
+  0x30, 0x0A, 0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x04, 0x03, 0x02,
+  0x30, 0x26, 0x31, 0x24, 0x30, 0x22, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0C,
+  0x1B, 0x41, 0x72, 0x64, 0x75, 0x69, 0x6E, 0x6F, 0x42, 0x65, 0x61, 0x72,
+  0x53, 0x53, 0x4C, 0x20, 0x52, 0x65, 0x70, 0x6C, 0x61, 0x79, 0x20, 0x45,
+  0x43, 0x20, 0x43, 0x41, 0x30, 0x1E, 0x17, 0x0D, 0x16, 0x03, 0x03, 0x01,
+  0x63, 0x32, 0x36, 0x31, 0x30, 0x31, 0x34, 0x31, 0x31, 0x35, 0x30, 0x31,
+  0x32, 0x5A, 0x17, 0x0D, 0x34, 0x36, 0x31, 0x30, 0x30, 0x39, 0x31, 0x31,
+  0x35, 0x30, 0x31, 0x32, 0x5A, 0x30, 0x30, 0x31, 0x2E, 0x30, 0x2C, 0x06,
+  0x03, 0x55, 0x04, 0x03, 0x0C, 0x25, 0x41, 0x72, 0x64, 0x75, 0x69, 0x6E,
+  0x6F, 0x42, 0x65, 0x61, 0x72, 0x53, 0x53, 0x4C, 0x20, 0x52, 0x65, 0x70,
+  0x6C, 0x61, 0x79, 0x20, 0x45, 0x43, 0x20, 0x49, 0x6E, 0x74, 0x65, 0x72,
+  0x6D, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x30, 0x59, 0x30, 0x13, 0x06,
+  0x07, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x02, 0x01, 0x06, 0x08, 0x2A, 0x86,
+  0x48, 0xCE, 0x3D, 0x03, 0x01, 0x07, 0x03, 0x42, 0x00, 0x04, 0x20, 0x58,
+  0xCD, 0x9A, 0x39, 0x46, 0x24, 0xCE, 0xBC, 0x30, 0xCC, 0xFB, 0x0E, 0xCD,
+  0xCC, 0x61, 0xA2, 0x19, 0x4D, 0x30, 0x53, 0x0B, 0x01, 0xE6, 0x4F, 0xCF,
+  0x1C, 0x2D, 0xF4, 0xFC, 0x25, 0xF2, 0x74, 0x42, 0x1A, 0xB1, 0x14, 0x7A,
+  0xA4, 0x19, 0x30, 0xED, 0x81, 0xF9, 0x02, 0xFB, 0xD6, 0xA4, 0x7F, 0x5F,
+  0x30, 0x24, 0x56, 0x00, 0x6D, 0xC7, 0x95, 0x32, 0xAB, 0x71, 0xCB, 0x8E,
+  0xE1, 0x8A, 0xA3, 0x63, 0x30, 0x61, 0x30, 0x0F, 0x06, 0x03, 0x55, 0x1D,
+  0x13, 0x01, 0x01, 0xFF, 0x04, 0x05, 0x30, 0x03, 0x01, 0x01, 0xFF, 0x30,
+  0x0E, 0x06, 0x03, 0x55, 0x1D, 0x0F, 0x01, 0x01, 0xFF, 0x04, 0x04, 0x03,
+  0x02, 0x01, 0x06, 0x30, 0x1D, 0x06, 0x03, 0x55, 0x1D, 0x0E, 0x04, 0x16,
+  0x04, 0x14, 0x55, 0x03, 0x42, 0xFF, 0xF6, 0xE6, 0x95, 0x0B, 0xB1, 0x0A,
+  0x53, 0x5B, 0x9D, 0x6F, 0x1F, 0x05, 0x86, 0xEE, 0x35, 0x23, 0x30, 0x1F,
+  0x06, 0x03, 0x55, 0x1D, 0x23, 0x04, 0x18, 0x30, 0x16, 0x80, 0x14, 0xB6,
+  0x80, 0xD2, 0x98, 0xE0, 0xBF, 0xA3, 0x95, 0x93, 0x66, 0x35, 0x7C, 0x78,
+  0x02, 0xF1, 0xC4, 0xC6, 0x28, 0xCC, 0xCD, 0x30, 0x0A, 0x06, 0x08, 0x2A,
+  0x86, 0x48, 0xCE, 0x3D, 0x04, 0x03, 0x02, 0x03, 0x47, 0x00, 0x30, 0x44,
+  0x02, 0x20, 0x59, 0xC7, 0xA2, 0x9A, 0x37, 0x99, 0xC4, 0x8A, 0x7D, 0x6B,
+  0xFA, 0x37, 0xF1, 0x2A, 0xA2, 0xD3, 0xF4, 0x5A, 0xF1, 0xE7, 0xB5, 0x19,
+  0x63, 0x59, 0x36, 0x92, 0x4E, 0xF9, 0x7C, 0xDA, 0xDA, 0xB1, 0x02, 0x20,
+  0x63, 0x4A, 0x87, 0x81, 0x21, 0x60, 0x3C, 0x0D, 0xCB, 0x8F, 0xB2, 0x8F,
+  0x70, 0x8B, 0xB9, 0x74, 0x18, 0x64, 0x2A, 0x2E, 0xBF, 0xA8, 0xC4, 0x72,
+  0x32, 0x26, 0x50, 0x2F, 0x36, 0x1F, 0x89, 0x65, 0x16, 0x03, 0x03, 0x00,
+  0x95, 0x0C, 0x00, 0x00, 0x91, 0x03, 0x00, 0x17, 0x41, 0x04, 0xEB, 0x2F,
+  0x43, 0x47, 0x35, 0xF4, 0x67, 0xD8, 0x99, 0x66, 0x65, 0x7B, 0xE6, 0xA8,
+  0xC0, 0x35, 0x6A, 0xA6, 0xB1, 0xE9, 0xA3, 0x48, 0xA8, 0xCF, 0x62, 0x69,
+  0xCF, 0x51, 0x29, 0xB2, 0xCB, 0x28, 0x15, 0xD6, 0x45, 0x0F, 0x40, 0xA2,
+  0x19, 0xEA, 0x3C, 0x27, 0xE9, 0x2E, 0x52, 0x74, 0x3A, 0xE3, 0xD8, 0x48,
+  0xFB, 0x96, 0x98, 0x1D, 0xD6, 0x53, 0x6B, 0x6A, 0xE4, 0xCF, 0x0B, 0xE5,
+  0x6A, 0x25, 0x04, 0x03, 0x00, 0x48, 0x30, 0x46, 0x02, 0x21, 0x00, 0xDA,
+  0x79, 0xE6, 0xDB, 0x91, 0xDF, 0xC6, 0x04, 0xA1, 0x31, 0x84, 0x86, 0x26,
+  0x9B, 0x91, 0x89, 0xCE, 0x68, 0x4B, 0x11, 0x7A, 0x62, 0x15, 0x68, 0xB8,
+  0xAE, 0x70, 0xC4, 0x31, 0x95, 0xFF, 0xF4, 0x02, 0x21, 0x00, 0x82, 0x41,
+  0x36, 0x0E, 0x3D, 0x05, 0xE3, 0x4B, 0x8B, 0x7F, 0x62, 0x9E, 0x94, 0x84,
+  0xE7, 0x34, 0x7C, 0x51, 0x06, 0x7D, 0x56, 0x55, 0xDF, 0x71, 0x5A, 0x16,
+  0xCC, 0x65, 0x6D, 0xC9, 0x7D, 0x75, 0x16, 0x03, 0x03, 0x00, 0x04, 0x0E,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x16, 0x03, 0x03, 0x00, 0x46, 0x10,
+  0x00, 0x00, 0x42, 0x41, 0x04, 0x74, 0xC7, 0xA4, 0xF5, 0xF0, 0x86, 0x94,
+  0x6A, 0x0E, 0x26, 0x6B, 0xD3, 0xC8, 0x97, 0x7C, 0xD9, 0xE7, 0x8F, 0x9F,
+  0xFD, 0xFF, 0x6B, 0x5D, 0x23, 0xBF, 0x5B, 0xAA, 0x22, 0xA1, 0xFB, 0xD4,
+  0x3A, 0xB7, 0x93, 0x24, 0x99, 0x65, 0x47, 0x0E, 0xC9, 0x6A, 0x46, 0x3E,
+  0x67, 0x47, 0x0A, 0x92, 0x26, 0xBE, 0xB3, 0x28, 0x85, 0x6A, 0xF9, 0x95,
+  0x28, 0x40, 0x82, 0x03, 0x74, 0xCD, 0xE9, 0x30, 0xCB, 0x14, 0x03, 0x03,
+  0x00, 0x01, 0x01, 0x16, 0x03, 0x03, 0x00, 0x50, 0xBE, 0x74, 0x1B, 0x9B,
+  0xA9, 0x5D, 0x80, 0xD1, 0xE9, 0xF3, 0x3B, 0x9F, 0xBE, 0x68, 0x3D, 0x3F,
+  0x56, 0x7E, 0xA9, 0x91, 0x0A, 0x9E, 0xD2, 0xD8, 0x77, 0x68, 0x78, 0x17,
+  0x12, 0x33, 0xF0, 0x5B, 0xC2, 0xFD, 0x19, 0xF4, 0x4A, 0xD5, 0xEE, 0xDB,
+  0xB2, 0x7E, 0x3A, 0xD1, 0x1A, 0x09, 0xA3, 0xCA, 0xB8, 0x52, 0x9C, 0xB7,
+  0x2B, 0x60, 0x8B, 0xC2, 0xF5, 0x22, 0xA8, 0xE8, 0x43, 0x03, 0xA1, 0x28,
+  0x1F, 0x64, 0x6A, 0x9A, 0x4B, 0x1A, 0x97, 0xCF, 0x22, 0x79, 0x99, 0x91,
+  0x36, 0xEB, 0xA4, 0x1D, 0x01, 0x00, 0x5B, 0x14, 0x03, 0x03, 0x00, 0x01,
+  0x01, 0x16, 0x03, 0x03, 0x00, 0x50, 0x9C, 0x36, 0x71, 0x21, 0x45, 0x46,
+  0x86, 0x84, 0x66, 0x2C, 0x28, 0x6F, 0xDA, 0xF8, 0x3C, 0x87, 0xC7, 0x9D,
+  0x13, 0xA7, 0x25, 0xB2, 0x18, 0x08, 0xD8, 0x2F, 0x9F, 0xE9, 0xB9, 0xE5,
+  0x80, 0x1B, 0x9F, 0x77, 0xF2, 0x2F, 0x52, 0xF2, 0xE9, 0xFA, 0xF1, 0xB5,
+  0x96, 0x4E, 0xFF, 0xA6, 0x09, 0x59, 0x53, 0xC4, 0xDF, 0x1B, 0x73, 0x9B,
+  0xD9, 0x53, 0x93, 0x27, 0xC3, 0x4F, 0x65, 0x17, 0xBE, 0x69, 0x7A, 0xAF,
+  0x41, 0x21, 0x22, 0x6F, 0xA7, 0x86, 0x9F, 0xA2, 0x3D, 0x5A, 0x87, 0xDE,
+  0x22, 0xA6, 0x00, 0x00, 0x45, 0x15, 0x03, 0x03, 0x00, 0x40, 0xA7, 0x8C,
+  0x23, 0x59, 0x3F, 0x18, 0x67, 0xF3, 0x21, 0xBF, 0xCA, 0x57, 0xBF, 0x86,
+  0x54, 0x8A, 0x0B, 0x15, 0x4D, 0x9F, 0xE9, 0xB6, 0x2B, 0xF5, 0x1D, 0x92,
+  0x9A, 0xDA, 0xC9, 0x62, 0xE5, 0x94, 0x24, 0xE6, 0x1A, 0xE6, 0x83, 0x4E,
+  0x2F, 0x0B, 0x36, 0x77, 0x36, 0x94, 0x50, 0xA3, 0x17, 0x95, 0x11, 0x9C,
+  0x3F, 0x86, 0x53, 0x5E, 0x37, 0x3A, 0x30, 0x58, 0x9C, 0xEB, 0x5D, 0xCB,
+  0xFA, 0x23, 0x01, 0x00, 0x45, 0x15, 0x03, 0x03, 0x00, 0x40, 0x6B, 0x82,
+  0xC7, 0xAF, 0xCF, 0xE7, 0xEF, 0xFA, 0x06, 0xCD, 0x96, 0x7D, 0x18, 0xCB,
+  0x15, 0xCE, 0x08, 0x9F, 0xA2, 0xDE, 0x7D, 0x4E, 0x2E, 0x1C, 0x35, 0x51,
+  0xA3, 0xBB, 0x14, 0xC6, 0x7C, 0xF8, 0xAF, 0x30, 0x0F, 0x4C, 0x79, 0x61,
+  0xC6, 0x47, 0x11, 0xCD, 0x95, 0x04, 0x10, 0x1B, 0xB0, 0x21, 0x93, 0x8C,
+  0x36, 0xC3, 0x66, 0x09, 0x89, 0x6E, 0x49, 0xAB, 0x66, 0x12, 0xCB, 0xE4,
+  0xFA, 0x29
+};
+
+static const uint8_t RSA2048_AES128_GCM[] = {
+  0x00, 0x00, 0xD6, 0x16, 0x03, 0x01, 0x00, 0xD1, 0x01, 0x00, 0x00, 0xCD,
+  0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC4, 0x8A, 0xF1, 0xFF, 0x86, 0x82,
+  0xAF, 0x9C, 0x07, 0x1D, 0x55, 0xE4, 0xBF, 0x9F, 0xDB, 0xD2, 0x67, 0x29,
+  0x04, 0x95, 0xDB, 0x97, 0x14, 0x38, 0xAF, 0x99, 0xB2, 0xCD, 0x00, 0x00,
+  0x5A, 0xCC, 0xA9, 0xCC, 0xA8, 0xC0, 0x2B, 0xC0, 0x2F, 0xC0, 0x2C, 0xC0,
+  0x30, 0xC0, 0xAC, 0xC0, 0xAD, 0xC0, 0xAE, 0xC0, 0xAF, 0xC0, 0x23, 0xC0,
+  0x27, 0xC0, 0x24, 0xC0, 0x28, 0xC0, 0x09, 0xC0, 0x13, 0xC0, 0x0A, 0xC0,
+  0x14, 0xC0, 0x2D, 0xC0, 0x31, 0xC0, 0x2E, 0xC0, 0x32, 0xC0, 0x25, 0xC0,
+  0x29, 0xC0, 0x26, 0xC0, 0x2A, 0xC0, 0x04, 0xC0, 0x0E, 0xC0, 0x05, 0xC0,
+  0x0F, 0x00, 0x9C, 0x00, 0x9D, 0xC0, 0x9C, 0xC0, 0x9D, 0xC0, 0xA0, 0xC0,
+  0xA1, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x35, 0xC0, 0x08, 0xC0,
+  0x12, 0xC0, 0x03, 0xC0, 0x0D, 0x00, 0x0A, 0x01, 0x00, 0x00, 0x4A, 0xFF,
+  0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x00,
+  0x09, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x68, 0x6F, 0x73, 0x74, 0x00, 0x01,
+  0x00, 0x01, 0x01, 0x00, 0x0D, 0x00, 0x16, 0x00, 0x14, 0x04, 0x03, 0x03,
+  0x03, 0x05, 0x03, 0x06, 0x03, 0x02, 0x03, 0x04, 0x01, 0x03, 0x01, 0x05,
+  0x01, 0x06, 0x01, 0x02, 0x01, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x08, 0x00,
+  0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1D, 0x00, 0x0B, 0x00, 0x02, 0x01,
+  0x00, 0x01, 0x04, 0xFF, 0x16, 0x03, 0x03, 0x00, 0x5E, 0x02, 0x00, 0x00,
+  0x5A, 0x03, 0x03, 0xB3, 0xC6, 0xFB, 0xD4, 0x6F, 0x63, 0xFC, 0x13, 0x21,
+  0x61, 0x5F, 0x65, 0xA3, 0x24, 0x85, 0x52, 0xE8, 0x69, 0xA0, 0xCC, 0x83,
+  0x31, 0x91, 0xC8, 0x44, 0x4F, 0x57, 0x4E, 0x47, 0x52, 0x44, 0x01, 0x20,
+  0x9B, 0x5A, 0x9A, 0x11, 0x0F, 0xB8, 0x31, 0x94, 0xD8, 0x38, 0xA0, 0x56,
+  0x6A, 0xF7, 0x5C, 0x55, 0x0E, 0x8D, 0x4E, 0xB4, 0x9C, 0x8C, 0xB2, 0x82,
+  0xF1, 0x11, 0x5B, 0xFF, 0xA3, 0x70, 0x12, 0x17, 0xC0, 0x2F, 0x00, 0x00,
+  0x12, 0xFF, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00,
+  0x0B, 0x00, 0x04, 0x03, 0x00, 0x01, 0x02, 0x16, 0x03, 0x03, 0x02, 0x00,
+  0x0B, 0x00, 0x03, 0x33, 0x00, 0x03, 0x30, 0x00, 0x03, 0x2D, 0x30, 0x82,
+  0x03, 0x29, 0x30, 0x82, 0x02, 0x11, 0xA0, 0x03, 0x02, 0x01, 0x02, 0x02,
+  0x01, 0x05, 0x30, 0x0D, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D,
+  0x01, 0x01, 0x0B, 0x05, 0x00, 0x30, 0x27, 0x31, 0x25, 0x30, 0x23, 0x06,
+  0x03, 0x55, 0x04, 0x03, 0x0C, 0x1C, 0x41, 0x72, 0x64, 0x75, 0x69, 0x6E,
+  0x6F, 0x42, 0x65, 0x61, 0x72, 0x53, 0x53, 0x4C, 0x20, 0x52, 0x65, 0x70,
+  0x6C, 0x61, 0x79, 0x20, 0x52, 0x53, 0x41, 0x20, 0x43, 0x41, 0x30, 0x1E,
+  0x17, 0x0D, 0x32, 0x36, 0x31, 0x30, 0x31, 0x34, 0x31, 0x31, 0x35, 0x30,
+  0x31, 0x32, 0x5A, 0x17, 0x0D, 0x34, 0x36, 0x31, 0x30, 0x30, 0x39, 0x31,
+  0x31, 0x35, 0x30, 0x31, 0x32, 0x5A, 0x30, 0x14, 0x31, 0x12, 0x30, 0x10,
+  0x06, 0x03, 0x55, 0x04, 0x03, 0x0C, 0x09, 0x6C, 0x6F, 0x63, 0x61, 0x6C,
+  0x68, 0x6F, 0x73, 0x74, 0x30, 0x82, 0x01, 0x22, 0x30, 0x0D, 0x06, 0x09,
+  0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x01, 0x05, 0x00, 0x03,
+  0x82, 0x01, 0x0F, 0x00, 0x30, 0x82, 0x01, 0x0A, 0x02, 0x82, 0x01, 0x01,
+  0x00, 0x93, 0x69, 0xE7, 0x9D, 0xCA, 0x70, 0xCE, 0x69, 0x82, 0x45, 0x5E,
+  0x3B, 0x7C, 0xEC, 0x9C, 0x58, 0x1E, 0xEB, 0x57, 0x0E, 0x39, 0x82, 0xFC,
+  0x84, 0x48, 0x52, 0xA6, 0xF5, 0xDC, 0xFB, 0x79, 0x1F, 0x73, 0xCB, 0x81,
+  0x7E, 0x49, 0xA7, 0xBF, 0xC2, 0x07, 0x05, 0x00, 0x07, 0xA0, 0xED, 0x3B,
+  0x0E, 0x74, 0x2A, 0x2E, 0x0A, 0xAD, 0x4C, 0x6D, 0x06, 0x35, 0x9E, 0xAC,
+  0xFE, 0x78, 0xA4, 0x6D, 0x78, 0x1A, 0xCA, 0xFF, 0xBF, 0x15, 0x50, 0x5B,
+  0xE3, 0x31, 0xF0, 0x64, 0x6C, 0x1D, 0x6F, 0x04, 0x54, 0x4B, 0x10, 0x0B,
+  0x81, 0x5B, 0x3E, 0x87, 0x36, 0x0F, 0xF6, 0xF1, 0x67, 0x71, 0xFE, 0x58,
+  0xA7, 0x37, 0x47, 0xC2, 0x7F, 0xAA, 0xAC, 0x5E, 0x6F, 0x2A, 0x56, 0x31,
+  0xDA, 0x80, 0x10, 0x09, 0xB7, 0xB3, 0xE6, 0x75, 0xDD, 0x8B, 0xDC, 0xA9,
+  0x11, 0x32, 0xE8, 0x89, 0x23, 0x09, 0xC2, 0x7C, 0xF6, 0x7F, 0x8E, 0x48,
+  0xC0, 0x84, 0x29, 0x70, 0x3F, 0xA9, 0x3E, 0x9A, 0x7F, 0x45, 0xB3, 0x00,
+  0xC9, 0xFB, 0xAE, 0xBC, 0x54, 0xA8, 0x6B, 0xAB, 0xB9, 0x1A, 0x88, 0xAC,
+  0xDD, 0xD1, 0x0E, 0x88, 0x67, 0xBC, 0xA6, 0xD6, 0x32, 0xB5, 0xC1, 0xB9,
+  0xB6, 0x1D, 0xF1, 0x37, 0x3B, 0xE5, 0xB1, 0x05, 0xE3, 0xE4, 0x0D, 0x79,
+  0x8F, 0x55, 0xAF, 0xC3, 0x8A, 0xDE, 0x31, 0x6D, 0x09, 0x85, 0x30, 0x80,
+  0x36, 0x33, 0x67, 0x43, 0x64, 0x8D, 0xED, 0x09, 0x9F, 0xE8, 0x2F, 0x83,
+  0x18, 0x88, 0xA4, 0xAD, 0x7F, 0x8A, 0xAC, 0xDD, 0xAF, 0xC5, 0xE2, 0x88,
+  0x1B, 0xAA, 0x48, 0x60, 0x7E, 0x1F, 0x1A, 0x9E, 0x89, 0x9B, 0x5A, 0x61,
+  0x34, 0x22, 0x0B, 0xEC, 0x8F, 0xB9, 0xD2, 0xBF, 0xD3, 0x0C, 0x59, 0x9A,
+  0x0A, 0x90, 0x70, 0x4A, 0xA8, 0xDA, 0xA6, 0x19, 0x61, 0x35, 0xF1, 0x52,
+  0x94, 0x80, 0xBF, 0x91, 0x0B, 0x02, 0x03, 0x01, 0x00, 0x01, 0xA3, 0x73,
+  0x30, 0x71, 0x30, 0x09, 0x06, 0x03, 0x55, 0x1D, 0x13, 0x04, 0x02, 0x30,
+  0x00, 0x30, 0x0E, 0x06, 0x03, 0x55, 0x1D, 0x0F, 0x01, 0x01, 0xFF, 0x04,
+  0x04, 0x03, 0x02, 0x05, 0xA0, 0x30, 0x14, 0x06, 0x03, 0x55, 0x1D, 0x11,
+  0x04, 0x0D, 0x30, 0x0B, 0x82, 0x09, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x68,
+  0x6F, 0x73, 0x74, 0x30, 0x1D, 0x06, 0x03, 0x55, 0x1D, 0x0E, 0x04, 0x16,
+  0x04, 0x14, 0xB6, 0xCB, 0x2E, 0x92, 0xFE, 0xDC, 0x2D, 0xFB, 0x98, 0xA5,
+  0xCD, 0x26, 0x18, 0x03, 0x27, 0x89, 0x26, 0x57, 0x16, 0x03, 0x03, 0x01,
+  0x37, 0xE6, 0xD2, 0x30, 0x1F, 0x06, 0x03, 0x55, 0x1D, 0x23, 0x04, 0x18,
+  0x30, 0x16, 0x80, 0x14, 0x3E, 0x7F, 0x93, 0x40, 0xFA, 0x86, 0xF2, 0xDD,
+  0x3A, 0x1F, 0x1E, 0xCD, 0x96, 0xB0, 0x9D, 0x05, 0x5D, 0x74, 0xF1, 0x5D,
+  0x30, 0x0D, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01,
+  0x0B, 0x05, 0x00, 0x03, 0x82, 0x01, 0x01, 0x00, 0x4B, 0x94, 0xBC, 0xE9,
+  0xA3, 0xA5, 0x35, 0x0F, 0xAD, 0x34, 0xED, 0xAC, 0x61, 0x10, 0x82, 0x81,
+  0xD8, 0xAA, 0xD1, 0xCE, 0xF0, 0x5A, 0xF4, 0xD9, 0x83, 0xFA, 0x8A, 0xFE,
+  0x73, 0x61, 0x63, 0xF4, 0xB4, 0x4B, 0xEA, 0x54, 0x50, 0x13, 0x2C, 0x71,
+  0x0F, 0x53, 0xEA, 0xF9, 0x19, 0xD6, 0x9D, 0x7F, 0x84, 0xB5, 0x52, 0x1A,
+  0x34, 0x08, 0x9B, 0xB5, 0x8E, 0x40, 0x6B, 0xED, 0x4B, 0x7B, 0xAE, 0xF8,
+  0xC7, 0x5E, 0xDA, 0x5B, 0x84, 0xB9, 0xBE, 0x9F, 0x44, 0x05, 0xBD, 0x39,
+  0x2E, 0xFC, 0x27, 0x45, 0x83, 0xBB, 0xC4, 0x92, 0x24, 0x8D, 0x62, 0x3D,
+  0x69, 0xAC, 0x40, 0xC7, 0x79, 0x07, 0x25, 0xF2, 0x78, 0x23, 0x70, 0xD9,
+  0x87, 0x94, 0xDA, 0x8F, 0xE9, 0xBE, 0x03, 0x31, 0x16, 0xD9, 0xE2, 0x8E,
+  0xD0, 0x03, 0xBF, 0xE7, 0xD1, 0x6B, 0xD5, 0xCF, 0xAE, 0x09, 0x73, 0x3F,
+  0x65, 0x74, 0x76, 0x67, 0x90, 0x7C, 0xEA, 0x00, 0xD1, 0x7C, 0x97, 0xD7,
+  0xE2, 0x91, 0x42, 0xD9, 0x65, 0xA6, 0x4A, 0x23, 0x8C, 0x00, 0x83, 0xE0,
+  0x5D, 0xB0, 0x27, 0x9D, 0x88, 0xD8, 0x0D, 0x17, 0x48, 0xFB, 0xB1, 0xD7,
+  0xCF, 0x0B, 0x63, 0x05, 0x02, 0xCB, 0xFF, 0x09, 0x04, 0x06, 0xB5, 0xA0,
+  0x78, 0x25, 0x19, 0x60, 0xFB, 0xB1, 0xF8, 0x68, 0x80, 0x03, 0xDA, 0xE5,
+  0xD6, 0xF0, 0x2D, 0xF2, 0x5B, 0xB3, 0xE5, 0x38, 0xAF, 0xEC, 0x1B, 0x48,
+  0xA7, 0x92, 0x8E, 0xBC, 0x5B, 0x85, 0xF6, 0x2A, 0x74, 0xB4, 0x1C, 0x66,
+  0x88, 0xA4, 0xAA, 0xBB, 0xC4, 0x87, 0x6A, 0xB1, 0x27, 0x12, 0x83, 0x4C,
+  0x0F, 0x2D, 0x8F, 0x6A, 0x87, 0x1E, 0x67, 0x63, 0xB5, 0xC3, 0x7D, 0xCD,
+  0x9C, 0x25, 0x7F, 0x7C, 0x6F, 0xA0, 0x72, 0x8C, 0x78, 0x72, 0xCF, 0xA6,
+  0xC4, 0x51, 0x1B, 0x6C, 0xCC, 0x9E, 0x22, 0x04, 0xAF, 0x5C, 0x0D, 0x96,
+  0x16, 0x03, 0x03, 0x01, 0x4D, 0x0C, 0x00, 0x01, 0x49, 0x03, 0x00, 0x17,
+  0x41, 0x04, 0xAF, 0xCF, 0xFF, 0xDA, 0xE0, 0x07, 0x17, 0x81, 0x67, 0x1F,
+  0xBB, 0x14, 0x14, 0xD1, 0x46, 0x8C, 0x51, 0x35, 0x97, 0xF3, 0xE7, 0x4C,
+  0x6E, 0xCC, 0x6E, 0x07, 0x6A, 0x16, 0x87, 0xBB, 0x7F, 0x37, 0xD1, 0xB7,
+  0x0F, 0x25, 0xEA, 0x5D, 0x71, 0x2D, 0x34, 0xAB, 0x49, 0x55, 0xA9, 0x71,
+  0x09, 0x7F, 0xFB, 0xB9, 0x6B, 0x4F, 0x73, 0x86, 0x50, 0x37, 0xC8, 0xDD,
+  0x2A, 0x9E, 0x94, 0x22, 0x2A, 0x42, 0x04, 0x01, 0x01, 0x00, 0x06, 0x53,
+  0xA6, 0x24, 0xC7, 0x87, 0x3F, 0xFE, 0xC5, 0xB0, 0xA4, 0x4A, 0x8C, 0x52,
+  0xA5, 0x05, 0x05, 0xA7, 0x16, 0x18, 0x23, 0x58, 0xAD, 0x2D, 0xC2, 0xDC,
+  0x76, 0x91, 0x57, 0xFC, 0x8C, 0xDB, 0x1E, 0x63, 0xC3, 0x59, 0x89, 0xF7,
+  0xBA, 0x0A, 0x38, 0x78, 0x81, 0xEC, 0x07, 0xDF, 0x14, 0x25, 0x1A, 0x8E,
+  0xF9, 0x2E, 0xF6, 0x3C, 0xC8, 0xA5, 0xDC, 0x67, 0xFF, 0x7B, 0xDF, 0x1E,
+  0xF5, 0x88, 0xB4, 0x5F, 0x59, 0x48, 0x3C, 0xA5, 0xC7, 0x7C, 0x35, 0x9D,
+  0xEB, 0x75, 0x38, 0xF3, 0xDD, 0x09, 0x3E, 0xA4, 0x01, 0xF4, 0x62, 0xFE,
+  0x86, 0xC0, 0x46, 0x62, 0x91, 0x31, 0x48, 0x4F, 0xDC, 0xC3, 0x4D, 0x89,
+  0xA8, 0x60, 0x95, 0x18, 0xE6, 0x41, 0xA0, 0x48, 0x34, 0xF6, 0xB0, 0x29,
+  0xAE, 0xB1, 0xC4, 0x38, 0x93, 0x35, 0xFB, 0x14, 0x8D, 0x37, 0x30, 0x7C,
+  0xD7, 0xE7, 0x9E, 0x79, 0xA9, 0x85, 0x38, 0x41, 0x49, 0x19, 0x3D, 0xCF,
+  0xFE, 0x4F, 0x86, 0x1D, 0x78, 0x01, 0x2D, 0x5B, 0x01, 0x94, 0xC1, 0xC2,
+  0xC0, 0x86, 0xE6, 0x49, 0x4B, 0x0F, 0x52, 0x68, 0x3C, 0x27, 0x8D, 0x40,
+  0x73, 0x11, 0xC9, 0x14, 0xEF, 0x22, 0x80, 0x9C, 0x84, 0x8F, 0x2A, 0xEF,
+  0xA4, 0xD1, 0x09, 0xD6, 0x28, 0xC5, 0x6A, 0xD3, 0x8C, 0x3D, 0x68, 0x13,
+  0x7E, 0x04, 0x85, 0x59, 0x33, 0x84, 0xEC, 0x5B, 0x13, 0x32, 0x27, 0xBF,
+  0x26, 0x93, 0x09, 0xC6, 0x3F, 0x0E, 0x57, 0x5A, 0x79, 0x21, 0x9D, 0xE2,
+  0x1F, 0xE6, 0x86, 0x3A, 0xBD, 0x54, 0x8F, 0x83, 0x4D, 0xF0, 0x8F, 0x95,
+  0xC6, 0x0B, 0x9A, 0x5F, 0x40, 0x1C, 0xFD, 0x23, 0x7C, 0x2E, 0x70, 0xF1,
+  0x4A, 0xF0, 0x26, 0xE5, 0x06, 0xD0, 0xE8, 0x81, 0xA1, 0xEC, 0x9C, 0xD1,
+  0x07, 0x11, 0x24, 0x1E, 0xFD, 0xAB, 0xF2, 0x51, 0x62, 0xE6, 0x5B, 0xF1,
+  0x38, 0x23, 0x16, 0x03, 0x03, 0x00, 0x04, 0x0E, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x7E, 0x16, 0x03, 0x03, 0x00, 0x46, 0x10, 0x00, 0x00, 0x42, 0x41,
+  0x04, 0x74, 0xC7, 0xA4, 0xF5, 0xF0, 0x86, 0x94, 0x6A, 0x0E, 0x26, 0x6B,
+  0xD3, 0xC8, 0x97, 0x7C, 0xD9, 0xE7, 0x8F, 0x9F, 0xFD, 0xFF, 0x6B, 0x5D,
+  0x23, 0xBF, 0x5B, 0xAA, 0x22, 0xA1, 0xFB, 0xD4, 0x3A, 0xB7, 0x93, 0x24,
+  0x99, 0x65, 0x47, 0x0E, 0xC9, 0x6A, 0x46, 0x3E, 0x67, 0x47, 0x0A, 0x92,
+  0x26, 0xBE, 0xB3, 0x28, 0x85, 0x6A, 0xF9, 0x95, 0x28, 0x40, 0x82, 0x03,
+  0x74, 0xCD, 0xE9, 0x30, 0xCB, 0x14, 0x03, 0x03, 0x00, 0x01, 0x01, 0x16,
+  0x03, 0x03, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5D, 0x64, 0x3D, 0xB9, 0xE8, 0x15, 0x4A, 0x02, 0x26, 0x2A, 0x1C, 0xD1,
+  0xB2, 0x77, 0x01, 0xD0, 0x46, 0x3B, 0x5E, 0x9B, 0x9E, 0x11, 0x8C, 0xCD,
+  0xA6, 0xB8, 0x26, 0x1C, 0x17, 0x29, 0x1D, 0x65, 0x01, 0x00, 0x33, 0x14,
+  0x03, 0x03, 0x00, 0x01, 0x01, 0x16, 0x03, 0x03, 0x00, 0x28, 0xFC, 0x29,
+  0x3B, 0x07, 0x82, 0xDB, 0xB7, 0x03, 0xB7, 0xE1, 0xF2, 0xC2, 0x57, 0xE1,
+  0xD1, 0xAC, 0x1A, 0xAC, 0xB3, 0x8C, 0x5C, 0x4C, 0x53, 0xFC, 0xCE, 0x21,
+  0xDD, 0x9B, 0x56, 0xC1, 0x84, 0x89, 0x0B, 0x07, 0x6C, 0x29, 0x34, 0x3D,
+  0x33, 0xB3, 0x00, 0x00, 0x1F, 0x15, 0x03, 0x03, 0x00, 0x1A, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1C, 0x00, 0x1C, 0x8C, 0x87, 0x87,
+  0xD9, 0x09, 0x6C, 0x5C, 0xE2, 0xCF, 0xBD, 0xB6, 0x65, 0x7C, 0xE6, 0x1E,
+  0x01, 0x00, 0x1F, 0x15, 0x03, 0x03, 0x00, 0x1A, 0xFC, 0x29, 0x3B, 0x07,
+  0x82, 0xDB, 0xB7, 0x04, 0xE4, 0x46, 0xAC, 0x46, 0xEB, 0xC3, 0xD0, 0x51,
+  0xC2, 0x48, 0x35, 0x4F, 0x74, 0xB8, 0x86, 0x93, 0x71, 0xDB
+};
+
+static const uint8_t RSA2048_X25519_CHACHA20[] = {
+  0x00, 0x00, 0xD6, 0x16, 0x03, 0x01, 0x00, 0xD1, 0x01, 0x00, 0x00, 0xCD,
+  0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC4, 0x8A, 0xF1, 0xFF, 0x86, 0x82,
+  0xAF, 0x9C, 0x07, 0x1D, 0x55, 0xE4, 0xBF, 0x9F, 0xDB, 0xD2, 0x67, 0x29,
+  0x04, 0x95, 0xDB, 0x97, 0x14, 0x38, 0xAF, 0x99, 0xB2, 0xCD, 0x00, 0x00,
+  0x5A, 0xCC, 0xA9, 0xCC, 0xA8, 0xC0, 0x2B, 0xC0, 0x2F, 0xC0, 0x2C, 0xC0,
+  0x30, 0xC0, 0xAC, 0xC0, 0xAD, 0xC0, 0xAE, 0xC0, 0xAF, 0xC0, 0x23, 0xC0,
+  0x27, 0xC0, 0x24, 0xC0, 0x28, 0xC0, 0x09, 0xC0, 0x13, 0xC0, 0x0A, 0xC0,
+  0x14, 0xC0, 0x2D, 0xC0, 0x31, 0xC0, 0x2E, 0xC0, 0x32, 0xC0, 0x25, 0xC0,
+  0x29, 0xC0, 0x26, 0xC0, 0x2A, 0xC0, 0x04, 0xC0, 0x0E, 0xC0, 0x05, 0xC0,
+  0x0F, 0x00, 0x9C, 0x00, 0x9D, 0xC0, 0x9C, 0xC0, 0x9D, 0xC0, 0xA0, 0xC0,
+  0xA1, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x35, 0xC0, 0x08, 0xC0,
+  0x12, 0xC0, 0x03, 0xC0, 0x0D, 0x00, 0x0A, 0x01, 0x00, 0x00, 0x4A, 0xFF,
+  0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x00,
+  0x09, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x68, 0x6F, 0x73, 0x74, 0x00, 0x01,
+  0x00, 0x01, 0x01, 0x00, 0x0D, 0x00, 0x16, 0x00, 0x14, 0x04, 0x03, 0x03,
+  0x03, 0x05, 0x03, 0x06, 0x03, 0x02, 0x03, 0x04, 0x01, 0x03, 0x01, 0x05,
+  0x01, 0x06, 0x01, 0x02, 0x01, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x08, 0x00,
+  0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1D, 0x00, 0x0B, 0x00, 0x02, 0x01,
+  0x00, 0x01, 0x04, 0xDE, 0x16, 0x03, 0x03, 0x00, 0x5E, 0x02, 0x00, 0x00,
+  0x5A, 0x03, 0x03, 0xEF, 0x8F, 0x6C, 0xC9, 0x46, 0xA6, 0x32, 0x7B, 0x7E,
+  0x94, 0x92, 0xEB, 0xBC, 0x90, 0xBC, 0x44, 0x5F, 0x5C, 0x47, 0x47, 0x32,
+  0x98, 0x0B, 0xBA, 0x44, 0x4F, 0x57, 0x4E, 0x47, 0x52, 0x44, 0x01, 0x20,
+  0x30, 0x2C, 0xDC, 0x65, 0xD0, 0x6D, 0xFB, 0xE4, 0x2A, 0x57, 0xBC, 0x48,
+  0xD4, 0x4B, 0x07, 0xBC, 0x9A, 0x4F, 0x56, 0x9F, 0x35, 0x65, 0x30, 0xA2,
+  0xBE, 0x3F, 0x3F, 0x14, 0xF5, 0x17, 0xFB, 0xDA, 0xCC, 0xA8, 0x00, 0x00,
+  0x12, 0xFF, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00,
+  0x0B, 0x00, 0x04, 0x03, 0x00, 0x01, 0x02, 0x16, 0x03, 0x03, 0x02, 0x00,
+  0x0B, 0x00, 0x03, 0x33, 0x00, 0x03, 0x30, 0x00, 0x03, 0x2D, 0x30, 0x82,
+  0x03, 0x29, 0x30, 0x82, 0x02, 0x11, 0xA0, 0x03, 0x02, 0x01, 0x02, 0x02,
+  0x01, 0x05, 0x30, 0x0D, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D,
+  0x01, 0x01, 0x0B, 0x05, 0x00, 0x30, 0x27, 0x31, 0x25, 0x30, 0x23, 0x06,
+  0x03, 0x55, 0x04, 0x03, 0x0C, 0x1C, 0x41, 0x72, 0x64, 0x75, 0x69, 0x6E,
+  0x6F, 0x42, 0x65, 0x61, 0x72, 0x53, 0x53, 0x4C, 0x20, 0x52, 0x65, 0x70,
+  0x6C, 0x61, 0x79, 0x20, 0x52, 0x53, 0x41, 0x20, 0x43, 0x41, 0x30, 0x1E,
+  0x17, 0x0D, 0x32, 0x36, 0x31, 0x30, 0x31, 0x34, 0x31, 0x31, 0x35, 0x30,
+  0x31, 0x32, 0x5A, 0x17, 0x0D, 0x34, 0x36, 0x31, 0x30, 0x30, 0x39, 0x31,
+  0x31, 0x35, 0x30, 0x31, 0x32, 0x5A, 0x30, 0x14, 0x31, 0x12, 0x30, 0x10,
+  0x06, 0x03, 0x55, 0x04, 0x03, 0x0C, 0x09, 0x6C, 0x6F, 0x63, 0x61, 0x6C,
+  0x68, 0x6F, 0x73, 0x74, 0x30, 0x82, 0x01, 0x22, 0x30, 0x0D, 0x06, 0x09,
+  0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x01, 0x05, 0x00, 0x03,
+  0x82, 0x01, 0x0F, 0x00, 0x30, 0x82, 0x01, 0x0A, 0x02, 0x82, 0x01, 0x01,
+  0x00, 0x93, 0x69, 0xE7, 0x9D, 0xCA, 0x70, 0xCE, 0x69, 0x82, 0x45, 0x5E,
+  0x3B, 0x7C, 0xEC, 0x9C, 0x58, 0x1E, 0xEB, 0x57, 0x0E, 0x39, 0x82, 0xFC,
+  0x84, 0x48, 0x52, 0xA6, 0xF5, 0xDC, 0xFB, 0x79, 0x1F, 0x73, 0xCB, 0x81,
+  0x7E, 0x49, 0xA7, 0xBF, 0xC2, 0x07, 0x05, 0x00, 0x07, 0xA0, 0xED, 0x3B,
+  0x0E, 0x74, 0x2A, 0x2E, 0x0A, 0xAD, 0x4C, 0x6D, 0x06, 0x35, 0x9E, 0xAC,
+  0xFE, 0x78, 0xA4, 0x6D, 0x78, 0x1A, 0xCA, 0xFF, 0xBF, 0x15, 0x50, 0x5B,
+  0xE3, 0x31, 0xF0, 0x64, 0x6C, 0x1D, 0x6F, 0x04, 0x54, 0x4B, 0x10, 0x0B,
+  0x81, 0x5B, 0x3E, 0x87, 0x36, 0x0F, 0xF6, 0xF1, 0x67, 0x71, 0xFE, 0x58,
+  0xA7, 0x37, 0x47, 0xC2, 0x7F, 0xAA, 0xAC, 0x5E, 0x6F, 0x2A, 0x56, 0x31,
+  0xDA, 0x80, 0x10, 0x09, 0xB7, 0xB3, 0xE6, 0x75, 0xDD, 0x8B, 0xDC, 0xA9,
+  0x11, 0x32, 0xE8, 0x89, 0x23, 0x09, 0xC2, 0x7C, 0xF6, 0x7F, 0x8E, 0x48,
+  0xC0, 0x84, 0x29, 0x70, 0x3F, 0xA9, 0x3E, 0x9A, 0x7F, 0x45, 0xB3, 0x00,
+  0xC9, 0xFB, 0xAE, 0xBC, 0x54, 0xA8, 0x6B, 0xAB, 0xB9, 0x1A, 0x88, 0xAC,
+  0xDD, 0xD1, 0x0E, 0x88, 0x67, 0xBC, 0xA6, 0xD6, 0x32, 0xB5, 0xC1, 0xB9,
+  0xB6, 0x1D, 0xF1, 0x37, 0x3B, 0xE5, 0xB1, 0x05, 0xE3, 0xE4, 0x0D, 0x79,
+  0x8F, 0x55, 0xAF, 0xC3, 0x8A, 0xDE, 0x31, 0x6D, 0x09, 0x85, 0x30, 0x80,
+  0x36, 0x33, 0x67, 0x43, 0x64, 0x8D, 0xED, 0x09, 0x9F, 0xE8, 0x2F, 0x83,
+  0x18, 0x88, 0xA4, 0xAD, 0x7F, 0x8A, 0xAC, 0xDD, 0xAF, 0xC5, 0xE2, 0x88,
+  0x1B, 0xAA, 0x48, 0x60, 0x7E, 0x1F, 0x1A, 0x9E, 0x89, 0x9B, 0x5A, 0x61,
+  0x34, 0x22, 0x0B, 0xEC, 0x8F, 0xB9, 0xD2, 0xBF, 0xD3, 0x0C, 0x59, 0x9A,
+  0x0A, 0x90, 0x70, 0x4A, 0xA8, 0xDA, 0xA6, 0x19, 0x61, 0x35, 0xF1, 0x52,
+  0x94, 0x80, 0xBF, 0x91, 0x0B, 0x02, 0x03, 0x01, 0x00, 0x01, 0xA3, 0x73,
+  0x30, 0x71, 0x30, 0x09, 0x06, 0x03, 0x55, 0x1D, 0x13, 0x04, 0x02, 0x30,
+  0x00, 0x30, 0x0E, 0x06, 0x03, 0x55, 0x1D, 0x0F, 0x01, 0x01, 0xFF, 0x04,
+  0x04, 0x03, 0x02, 0x05, 0xA0, 0x30, 0x14, 0x06, 0x03, 0x55, 0x1D, 0x11,
+  0x04, 0x0D, 0x30, 0x0B, 0x82, 0x09, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x68,
+  0x6F, 0x73, 0x74, 0x30, 0x1D, 0x06, 0x03, 0x55, 0x1D, 0x0E, 0x04, 0x16,
+  0x04, 0x14, 0xB6, 0xCB, 0x2E, 0x92, 0xFE, 0xDC, 0x2D, 0xFB, 0x98, 0xA5,
+  0xCD, 0x26, 0x18, 0x03, 0x27, 0x89, 0x26, 0x57, 0x16, 0x03, 0x03, 0x01,
+  0x37, 0xE6, 0xD2, 0x30, 0x1F, 0x06, 0x03, 0x55, 0x1D, 0x23, 0x04, 0x18,
+  0x30, 0x16, 0x80, 0x14, 0x3E, 0x7F, 0x93, 0x40, 0xFA, 0x86, 0xF2, 0xDD,
+  0x3A, 0x1F, 0x1E, 0xCD, 0x96, 0xB0, 0x9D, 0x05, 0x5D, 0x74, 0xF1, 0x5D,
+  0x30, 0x0D, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01,
+  0x0B, 0x05, 0x00, 0x03, 0x82, 0x01, 0x01, 0x00, 0x4B, 0x94, 0xBC, 0xE9,
+  0xA3, 0xA5, 0x35, 0x0F, 0xAD, 0x34, 0xED, 0xAC, 0x61, 0x10, 0x82, 0x81,
+  0xD8, 0xAA, 0xD1, 0xCE, 0xF0, 0x5A, 0xF4, 0xD9, 0x83, 0xFA, 0x8A, 0xFE,
+  0x73, 0x61, 0x63, 0xF4, 0xB4, 0x4B, 0xEA, 0x54, 0x50, 0x13, 0x2C, 0x71,
+  0x0F, 0x53, 0xEA, 0xF9, 0x19, 0xD6, 0x9D, 0x7F, 0x84, 0xB5, 0x52, 0x1A,
+  0x34, 0x08, 0x9B, 0xB5, 0x8E, 0x40, 0x6B, 0xED, 0x4B, 0x7B, 0xAE, 0xF8,
+  0xC7, 0x5E, 0xDA, 0x5B, 0x84, 0xB9, 0xBE, 0x9F, 0x44, 0x05, 0xBD, 0x39,
+  0x2E, 0xFC, 0x27, 0x45, 0x83, 0xBB, 0xC4, 0x92, 0x24, 0x8D, 0x62, 0x3D,
+  0x69, 0xAC, 0x40, 0xC7, 0x79, 0x07, 0x25, 0xF2, 0x78, 0x23, 0x70, 0xD9,
+  0x87, 0x94, 0xDA, 0x8F, 0xE9, 0xBE, 0x03, 0x31, 0x16, 0xD9, 0xE2, 0x8E,
+  0xD0, 0x03, 0xBF, 0xE7, 0xD1, 0x6B, 0xD5, 0xCF, 0xAE, 0x09, 0x73, 0x3F,
+  0x65, 0x74, 0x76, 0x67, 0x90, 0x7C, 0xEA, 0x00, 0xD1, 0x7C, 0x97, 0xD7,
+  0xE2, 0x91, 0x42, 0xD9, 0x65, 0xA6, 0x4A, 0x23, 0x8C, 0x00, 0x83, 0xE0,
+  0x5D, 0xB0, 0x27, 0x9D, 0x88, 0xD8, 0x0D, 0x17, 0x48, 0xFB, 0xB1, 0xD7,
+  0xCF, 0x0B, 0x63, 0x05, 0x02, 0xCB, 0xFF, 0x09, 0x04, 0x06, 0xB5, 0xA0,
+  0x78, 0x25, 0x19, 0x60, 0xFB, 0xB1, 0xF8, 0x68, 0x80, 0x03, 0xDA, 0xE5,
+  0xD6, 0xF0, 0x2D, 0xF2, 0x5B, 0xB3, 0xE5, 0x38, 0xAF, 0xEC, 0x1B, 0x48,
+  0xA7, 0x92, 0x8E, 0xBC, 0x5B, 0x85, 0xF6, 0x2A, 0x74, 0xB4, 0x1C, 0x66,
+  0x88, 0xA4, 0xAA, 0xBB, 0xC4, 0x87, 0x6A, 0xB1, 0x27, 0x12, 0x83, 0x4C,
+  0x0F, 0x2D, 0x8F, 0x6A, 0x87, 0x1E, 0x67, 0x63, 0xB5, 0xC3, 0x7D, 0xCD,
+  0x9C, 0x25, 0x7F, 0x7C, 0x6F, 0xA0, 0x72, 0x8C, 0x78, 0x72, 0xCF, 0xA6,
+  0xC4, 0x51, 0x1B, 0x6C, 0xCC, 0x9E, 0x22, 0x04, 0xAF, 0x5C, 0x0D, 0x96,
+  0x16, 0x03, 0x03, 0x01, 0x2C, 0x0C, 0x00, 0x01, 0x28, 0x03, 0x00, 0x1D,
+  0x20, 0x15, 0xFB, 0x7E, 0x36, 0x50, 0x72, 0xF6, 0xEF, 0x1B, 0xCE, 0x59,
+  0x72, 0x9E, 0x72, 0x01, 0x53, 0xC8, 0xCA, 0xB1, 0x5E, 0xD3, 0x2C, 0x3F,
+  0xCF, 0x10, 0x91, 0x6B, 0xD6, 0xCD, 0xFA, 0x81, 0x01, 0x04, 0x01, 0x01,
+  0x00, 0x3F, 0x5D, 0x0E, 0x47, 0x74, 0xED, 0x3D, 0x7F, 0x80, 0xE4, 0x62,
+  0x67, 0x4B, 0xA5, 0x35, 0x3D, 0xA1, 0x99, 0xAA, 0xB4, 0x44, 0xE2, 0x19,
+  0x2D, 0x95, 0xBE, 0xC8, 0x93, 0xE4, 0x07, 0x08, 0x4E, 0xCC, 0x18, 0x75,
+  0x79, 0xC3, 0xBF, 0x92, 0xD5, 0x6B, 0x87, 0x67, 0xB7, 0xA0, 0x76, 0x55,
+  0xB0, 0x87, 0x76, 0x26, 0xEE, 0x55, 0x00, 0xF2, 0x4A, 0x2F, 0x9D, 0x19,
+  0xDE, 0x29, 0x47, 0xE4, 0x76, 0x33, 0xB2, 0x30, 0xBF, 0x30, 0xCD, 0xF7,
+  0xF6, 0x71, 0xB0, 0x71, 0x05, 0x5F, 0x1B, 0x66, 0xA0, 0x81, 0xD1, 0xE2,
+  0xF9, 0x09, 0x10, 0xD2, 0xB1, 0xAD, 0x8B, 0x3C, 0xB9, 0x33, 0xEF, 0x6B,
+  0x72, 0xA4, 0x67, 0xF0, 0xB1, 0x82, 0xDE, 0x44, 0x53, 0x65, 0x1F, 0xD7,
+  0x7D, 0xB0, 0x4F, 0x5E, 0xBE, 0x2A, 0x6B, 0x35, 0x74, 0x9D, 0xD2, 0x36,
+  0xD0, 0xF0, 0xA1, 0xF9, 0x4B, 0x98, 0x82, 0xA4, 0x56, 0x59, 0x74, 0x88,
+  0xEC, 0xDA, 0xA9, 0x54, 0xA2, 0x19, 0xDF, 0x7C, 0xF8, 0xF8, 0xF9, 0x4C,
+  0x42, 0x20, 0x79, 0x5A, 0x1F, 0xDA, 0x98, 0x78, 0xB9, 0x16, 0x1D, 0xB0,
+  0x79, 0x9C, 0xB3, 0xBE, 0xB2, 0x11, 0xB6, 0x3D, 0x09, 0x27, 0x3D, 0x24,
+  0xAD, 0x81, 0xAB, 0x54, 0xF5, 0x20, 0x85, 0xC2, 0x5B, 0x9A, 0x96, 0xC4,
+  0x9B, 0x57, 0xA8, 0x81, 0x58, 0xE9, 0x8E, 0x39, 0x78, 0xE1, 0xC3, 0x98,
+  0x02, 0x04, 0xE8, 0x90, 0xBE, 0x6F, 0x1F, 0x01, 0xDE, 0xFA, 0xA0, 0xB2,
+  0x6C, 0x26, 0x44, 0xB0, 0x8B, 0x62, 0xA0, 0x06, 0x34, 0xB5, 0x00, 0x41,
+  0xEA, 0x95, 0x55, 0xA0, 0x21, 0x1B, 0x15, 0xAD, 0xB8, 0x85, 0x8F, 0x90,
+  0xD0, 0xFA, 0x36, 0xF4, 0x49, 0xEB, 0x92, 0x92, 0xD7, 0xD2, 0xF0, 0x68,
+  0xE0, 0xA0, 0x80, 0x10, 0x4E, 0x6C, 0x71, 0x7D, 0x05, 0xD9, 0xA4, 0x82,
+  0x9A, 0xF0, 0x41, 0xA3, 0xC4, 0x16, 0x03, 0x03, 0x00, 0x04, 0x0E, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x55, 0x16, 0x03, 0x03, 0x00, 0x25, 0x10, 0x00,
+  0x00, 0x21, 0x20, 0xA5, 0xEE, 0x26, 0x46, 0x4D, 0xF4, 0x62, 0xFB, 0x4D,
+  0x31, 0x1D, 0x55, 0x4D, 0xCD, 0xA5, 0x21, 0x4F, 0x90, 0x94, 0x0A, 0x6C,
+  0xBB, 0x8F, 0xCA, 0xC3, 0xBF, 0xE2, 0xCA, 0x4C, 0x4E, 0xBE, 0x3E, 0x14,
+  0x03, 0x03, 0x00, 0x01, 0x01, 0x16, 0x03, 0x03, 0x00, 0x20, 0xB5, 0x64,
+  0xDD, 0x7B, 0x37, 0x97, 0xBB, 0x0D, 0xBA, 0xBC, 0x83, 0x7A, 0xBB, 0xDD,
+  0x26, 0xE7, 0x55, 0x98, 0xA7, 0xC6, 0xCD, 0xB4, 0x62, 0x60, 0x4A, 0x12,
+  0x5B, 0x51, 0x5E, 0x88, 0xB6, 0x6E, 0x01, 0x00, 0x2B, 0x14, 0x03, 0x03,
+  0x00, 0x01, 0x01, 0x16, 0x03, 0x03, 0x00, 0x20, 0xE0, 0xFF, 0x11, 0xD3,
+  0x74, 0x74, 0xBA, 0x3F, 0x85, 0x36, 0x95, 0xC8, 0xC1, 0x03, 0x6F, 0x9B,
+  0x2A, 0x2C, 0x72, 0xDD, 0x2B, 0xA7, 0xAD, 0x63, 0x1C, 0xF5, 0x8D, 0xCC,
+  0xF8, 0xD3, 0xBC, 0x47, 0x00, 0x00, 0x17, 0x15, 0x03, 0x03, 0x00, 0x12,
+  0x64, 0x4F, 0x59, 0x2C, 0xDF, 0xD3, 0x93, 0x53, 0xC9, 0xF2, 0x62, 0xE7,
+  0xF2, 0x50, 0x48, 0x2C, 0x21, 0x35, 0x01, 0x00, 0x17, 0x15, 0x03, 0x03,
+  0x00, 0x12, 0x1A, 0xD8, 0x86, 0x85, 0x0B, 0xF7, 0xFD, 0x70, 0xF0, 0x09,
+  0x7A, 0xDA, 0x60, 0x49, 0x89, 0x33, 0x9D, 0x95
+};
+
+struct Recording {
+  const char* name;
+  const uint8_t* data;
+  size_t length;
+};
+
+static const Recording recordings[] = {
+  { "ECDSA P-256 AES128-GCM", ECDSA_P256_AES128_GCM, sizeof(ECDSA_P256_AES128_GCM) },
+  { "ECDSA X25519 CHACHA20", ECDSA_X25519_CHACHA20, sizeof(ECDSA_X25519_CHACHA20) },
+  { "ECDSA chain 2 AES256-GCM", ECDSA_CHAIN2_AES256_GCM, sizeof(ECDSA_CHAIN2_AES256_GCM) },
+  { "ECDSA chain 2 AES128-CBC", ECDSA_CHAIN2_AES128_CBC, sizeof(ECDSA_CHAIN2_AES128_CBC) },
+  { "RSA-2048 AES128-GCM", RSA2048_AES128_GCM, sizeof(RSA2048_AES128_GCM) },
+  { "RSA-2048 X25519 CHACHA20", RSA2048_X25519_CHACHA20, sizeof(RSA2048_X25519_CHACHA20) }
+};
+
+#endif
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2018 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _BEAR_SSL_TRUST_ANCHORS_H_
+#define _BEAR_SSL_TRUST_ANCHORS_H_
+
+#include "bearssl/bearssl_ssl.h"
+
+// The following was created by running extras/generate_trust_anchors.py
+// in the extras/TrustAnchors directory, entries are sorted by the
+// SHA-256 hash of their DN.
+
+static const unsigned char TA0_DN[] = {
+  0x30, 0x26, 0x31, 0x24, 0x30, 0x22, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0C,
+  0x1B, 0x41, 0x72, 0x64, 0x75, 0x69, 0x6E, 0x6F, 0x42, 0x65, 0x61, 0x72,
+  0x53, 0x53, 0x4C, 0x20, 0x52, 0x65, 0x70, 0x6C, 0x61, 0x79, 0x20, 0x45,
+  0x43, 0x20, 0x43, 0x41
+};
+
+static const unsigned char TA0_EC_Q[] = {
+  0x04, 0x96, 0x85, 0x54, 0x33, 0xAD, 0xB7, 0x81, 0x89, 0x74, 0xC6, 0x33,
+  0xAF, 0x8B, 0x9C, 0x3C, 0x74, 0x7A, 0xE0, 0xFA, 0x6E, 0x65, 0x9B, 0x6D,
+  0xB0, 0x28, 0xB0, 0x0B, 0x2F, 0xC7, 0xEF, 0x45, 0xF2, 0xE4, 0x82, 0xAC,
+  0x51, 0xD2, 0xC2, 0x4C, 0x74, 0x47, 0xF2, 0x89, 0x3F, 0xC6, 0xC7, 0xD2,
+  0x85, 0xBA, 0x18, 0x35, 0xB0, 0x2B, 0xEB, 0x87, 0xB3, 0x27, 0x4C, 0x3B,
+  0x41, 0x6C, 0x1E, 0xA0, 0x68
+};
+
+static const unsigned char TA1_DN[] = {
+  0x30, 0x27, 0x31, 0x25, 0x30, 0x23, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0C,
+  0x1C, 0x41, 0x72, 0x64, 0x75, 0x69, 0x6E, 0x6F, 0x42, 0x65, 0x61, 0x72,
+  0x53, 0x53, 0x4C, 0x20, 0x52, 0x65, 0x70, 0x6C, 0x61, 0x79, 0x20, 0x52,
+  0x53, 0x41, 0x20, 0x43, 0x41
+};
+
+static const unsigned char TA1_RSA_N[] = {
+  0xB3, 0x6B, 0xB1, 0x6B, 0xD7, 0x82, 0xA5, 0xE8, 0xE0, 0xD9, 0x5C, 0x98,
+  0x27, 0x4B, 0x43, 0x87, 0x91, 0x8F, 0x24, 0xE5, 0xCB, 0xAF, 0xFD, 0xEB,
+  0x27, 0x60, 0xCF, 0x13, 0xC3, 0xDD, 0xB2, 0xE0, 0x02, 0x0E, 0xAE, 0xDB,
+  0x7D, 0x22, 0x12, 0x62, 0x35, 0xCE, 0xA3, 0x04, 0xB1, 0x0A, 0x2F, 0x70,
+  0x1D, 0xC6, 0xE6, 0x4A, 0x8E, 0x98, 0xBD, 0x57, 0x5D, 0x12, 0xFC, 0xD1,
+  0x89, 0x03, 0xBF, 0x77, 0xF6, 0x39, 0x02, 0xC4, 0x42, 0x8D, 0x64, 0x94,
+  0x53, 0x6E, 0xE5, 0x12, 0x11, 0x67, 0x5D, 0xF2, 0x0C, 0x02, 0x2C, 0xB3,
+  0x0B, 0x05, 0x2A, 0xCE, 0x0A, 0xFB, 0x95, 0xB6, 0x62, 0x1C, 0x95, 0xCF,
+  0x8A, 0x5B, 0x35, 0x80, 0xAE, 0x8B, 0x39, 0x79, 0xA4, 0x87, 0x63, 0x35,
+  0xC1, 0x1E, 0xDC, 0xAB, 0xBF, 0x26, 0x89, 0x0E, 0x90, 0xC5, 0x01, 0x16,
+  0x06, 0xED, 0xBC, 0xEE, 0x3C, 0xC7, 0x9C, 0x73, 0x77, 0xF1, 0xB9, 0x51,
+  0x1B, 0x1B, 0x3A, 0x6B, 0x93, 0xFB, 0x3B, 0xC1, 0xB6, 0x32, 0x17, 0x62,
+  0x49, 0x72, 0x5C, 0x38, 0x97, 0xB4, 0xA8, 0xD4, 0x45, 0x7F, 0xC0, 0x99,
+  0x16, 0xB8, 0x47, 0x47, 0xC0, 0x58, 0xED, 0xA9, 0xB0, 0x39, 0xB5, 0x1A,
+  0x89, 0x41, 0x9B, 0xE6, 0xC1, 0xE0, 0x98, 0xE7, 0xF7, 0xEC, 0x93, 0x00,
+  0x21, 0x97, 0xDA, 0xA1, 0xC7, 0xAD, 0x27, 0x8D, 0x1B, 0x6C, 0x75, 0x97,
+  0xF8, 0x7D, 0x57, 0xA9, 0x11, 0x98, 0x31, 0x64, 0x9E, 0x77, 0x09, 0x65,
+  0xCD, 0x61, 0xD0, 0xB2, 0xCD, 0xA8, 0xBC, 0x9A, 0x1B, 0xA3, 0x4E, 0x26,
+  0x57, 0xC4, 0x7E, 0xAB, 0xD4, 0x82, 0xBF, 0x0A, 0x1E, 0x89, 0xD3, 0xE1,
+  0x9A, 0x18, 0x81, 0x6C, 0xDB, 0x19, 0xCA, 0x13, 0x41, 0xED, 0x92, 0xD1,
+  0xF1, 0xDB, 0x2B, 0xF4, 0xA9, 0xF9, 0x9E, 0xCF, 0x65, 0xDA, 0x28, 0xD0,
+  0x3A, 0xF6, 0x2D, 0xC1
+};
+
+static const unsigned char TA1_RSA_E[] = {
+  0x01, 0x00, 0x01
+};
+
+static const br_x509_trust_anchor TAs[2] = {
+  {
+    { (unsigned char *)TA0_DN, sizeof TA0_DN },
+    BR_X509_TA_CA,
+    {
+      BR_KEYTYPE_EC,
+      { .ec = {
+        BR_EC_secp256r1,
+        (unsigned char *)TA0_EC_Q, sizeof TA0_EC_Q,
+      } }
+    }
+  },
+  {
+    { (unsigned char *)TA1_DN, sizeof TA1_DN },
+    BR_X509_TA_CA,
+    {
+      BR_KEYTYPE_RSA,
+      { .rsa = {
+        (unsigned char *)TA1_RSA_N, sizeof TA1_RSA_N,
+        (unsigned char *)TA1_RSA_E, sizeof TA1_RSA_E,
+      } }
+    }
+  }
+};
+
+#define TAs_NUM   2
+
+#endif
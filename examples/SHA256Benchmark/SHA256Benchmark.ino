@@ -0,0 +1,62 @@
+/*
+  ArduinoBearSSL SHA256 Benchmark Example
+
+  This sketch measures the hashing throughput of SHA1 and SHA256 and
+  prints it in bytes per second and cycles per byte. On Cortex-M3/M4
+  boards (e.g. SAMD51) SHA256 uses the assembly compression function,
+  on Cortex-M0+ (SAMD21) the generic C code.
+
+  Circuit:
+  - Nano 33 IoT (SAMD21) or any SAMD51 board
+
+  This example code is in the public domain.
+*/
+
+#include <ArduinoBearSSL.h>
+#include "SHA1.h"
+#include "SHA256.h"
+
+#define BUFFER_SIZE 1024
+#define ROUNDS 64
+
+uint8_t buffer[BUFFER_SIZE];
+
+void setup() {
+  Serial.begin(9600);
+  while (!Serial);
+}
+
+void loop() {
+  run("SHA1", SHA1);
+  run("SHA256", SHA256);
+
+  Serial.println();
+  while (1);
+}
+
+void run(const char* name, SHAClass& sha) {
+  unsigned long start = micros();
+
+  sha.beginHash();
+  for (int r = 0; r < ROUNDS; r++) {
+    sha.write(buffer, BUFFER_SIZE);
+  }
+  sha.endHash();
+
+  printResult(name, micros() - start);
+
+  while (sha.available()) {
+    sha.read();
+  }
+}
+
+void printResult(const char* name, unsigned long elapsed) {
+  float bytes = (float)BUFFER_SIZE * ROUNDS;
+
+  Serial.print(name);
+  Serial.print(": ");
+  Serial.print(bytes * 1000000.0 / elapsed, 0);
+  Serial.print(" bytes/s, ");
+  Serial.print((float)elapsed * (F_CPU / 1000000) / bytes, 1);
+  Serial.println(" cycles/byte");
+}
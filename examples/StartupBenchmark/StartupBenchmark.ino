@@ -0,0 +1,189 @@
+/*
+  ArduinoBearSSL Startup Benchmark Example
+
+  This sketch measures what the library costs before any data moves:
+  - the time from reset to setup(), which includes the global
+    constructors of the library objects (ArduinoBearSSL, SHA256, AES128,
+    ...) along with the core's own startup
+  - the construction of those objects, timed again here one by one
+  - the setup of connect() up to the ClientHello, on the first connect()
+    (context initialization, entropy) and on the next ones, which only
+    reset the context
+
+  The transport below accepts the ClientHello and then closes, so no
+  network or server is needed and connect() itself fails: only the time
+  spent in the library before the first byte is sent is reported.
+
+  Circuit:
+  - any board
+
+  This example code is in the public domain.
+*/
+
+#include <ArduinoBearSSL.h>
+#include "AES128.h"
+#include "AESGCM.h"
+#include "SHA256.h"
+
+#define CONNECTS 10
+
+// records when the ClientHello is written, then reports the peer gone
+class HelloClient : public Client {
+public:
+  HelloClient() : _connected(false), _helloSent(0) {}
+
+  unsigned long helloSent() {
+    return _helloSent;
+  }
+
+  virtual int connect(IPAddress, uint16_t) {
+    return begin();
+  }
+
+  virtual int connect(const char*, uint16_t) {
+    return begin();
+  }
+
+  virtual size_t write(uint8_t b) {
+    return write(&b, 1);
+  }
+
+  virtual size_t write(const uint8_t*, size_t size) {
+    if (!_helloSent) {
+      _helloSent = micros();
+    }
+    _connected = false;
+
+    return size;
+  }
+
+  virtual int available() {
+    return 0;
+  }
+
+  virtual int read() {
+    return -1;
+  }
+
+  virtual int read(uint8_t*, size_t) {
+    return -1;
+  }
+
+  virtual int peek() {
+    return -1;
+  }
+
+  virtual void flush() {
+  }
+
+  virtual void stop() {
+    _connected = false;
+  }
+
+  virtual uint8_t connected() {
+    return _connected;
+  }
+
+  virtual operator bool() {
+    return _connected;
+  }
+
+private:
+  int begin() {
+    _connected = true;
+    _helloSent = 0;
+
+    return 1;
+  }
+
+  bool _connected;
+  unsigned long _helloSent;
+};
+
+HelloClient hello;
+BearSSLClient client(hello);
+
+unsigned long bootTime;
+
+unsigned long benchmarkTime() {
+  return 1798761600UL; // 2027-01-01
+}
+
+void printConstructor(const char* name, unsigned long elapsed) {
+  Serial.print("  ");
+  Serial.print(name);
+  for (int i = strlen(name); i < 20; i++) {
+    Serial.print(' ');
+  }
+  Serial.print(elapsed);
+  Serial.println(" us");
+}
+
+template<class T>
+void timeConstructor(const char* name) {
+  unsigned long start = micros();
+  T object;
+  unsigned long elapsed = micros() - start;
+
+  printConstructor(name, elapsed);
+}
+
+// on the heap, the context does not fit on the stack of most boards
+void timeClientConstructor() {
+  unsigned long start = micros();
+  BearSSLClient* object = new BearSSLClient(hello);
+  unsigned long elapsed = micros() - start;
+
+  delete object;
+  printConstructor("BearSSLClient (new)", elapsed);
+}
+
+unsigned long timeConnect() {
+  unsigned long start = micros();
+
+  client.connect("example.com", 443);
+  client.stop();
+
+  return hello.helloSent() - start;
+}
+
+void setup() {
+  bootTime = micros();
+
+  Serial.begin(9600);
+  while (!Serial);
+
+  ArduinoBearSSL.onGetTime(benchmarkTime);
+}
+
+void loop() {
+  Serial.print("Reset to setup(): ");
+  Serial.print(bootTime);
+  Serial.println(" us");
+
+  Serial.println("Constructors:");
+  timeConstructor<ArduinoBearSSLClass>("ArduinoBearSSLClass");
+  timeConstructor<SHA256Class>("SHA256Class");
+  timeConstructor<AES128Class>("AES128Class");
+  timeConstructor<AESGCMClass>("AESGCMClass");
+  timeClientConstructor();
+
+  Serial.println("connect() up to the ClientHello:");
+
+  unsigned long first = timeConnect();
+  unsigned long next = 0;
+
+  for (int i = 0; i < CONNECTS; i++) {
+    next += timeConnect();
+  }
+
+  Serial.print("  first: ");
+  Serial.print(first);
+  Serial.println(" us");
+  Serial.print("  next:  ");
+  Serial.print(next / CONNECTS);
+  Serial.println(" us");
+
+  Serial.println();
+  while (1);
+}
@@ -0,0 +1,10 @@
+#ifndef ARDUINO_BEARSSL_CONFIG_H_
+#define ARDUINO_BEARSSL_CONFIG_H_
+
+/* Enabling this define allows the usage of ArduinoBearSSL without crypto chip. */
+//#define ARDUINO_DISABLE_ECCX08
+
+/* Enabling this define counts the cycles spent in the record encryption. */
+//#define BEAR_SSL_CRYPTO_STATS
+
+#endif /* ARDUINO_BEARSSL_CONFIG_H_ */
@@ -0,0 +1,315 @@
+/*
+  ArduinoBearSSL Throughput Benchmark Example
+
+  This sketch uploads and then downloads a large payload over HTTPS
+  through BearSSLClient, on WiFiNINA or MKRGSM, and reports:
+  - the application throughput of each direction
+  - the upload write() latency and the time between received records
+  - the share of the download spent waiting for data, i.e. the CPU time
+    left for the rest of the sketch
+  - with BEAR_SSL_CRYPTO_STATS in ArduinoBearSSLConfig.h, the share
+    spent encrypting and decrypting records
+
+  Change the switches below to compare record sizes, flush policies and
+  cipher suites. The server must accept a POST of PAYLOAD_SIZE bytes on
+  uploadPath and return at least PAYLOAD_SIZE bytes on downloadPath.
+
+  Circuit:
+  - MKR WiFi 1010 or Nano 33 IoT board (WiFiNINA)
+  - MKR GSM 1400 board, with USE_MKRGSM defined
+
+  This example code is in the public domain.
+*/
+
+//#define USE_MKRGSM
+
+#ifdef USE_MKRGSM
+#include <MKRGSM.h>
+#else
+#include <SPI.h>
+#include <WiFiNINA.h>
+#endif
+#include <ArduinoBearSSL.h>
+
+// maximum fragment length to negotiate (512, 1024, 2048 or 4096) with
+// record buffers to match, 0 keeps the default buffers
+#define RECORD_SIZE 0
+// BearSSLClient::FlushPolicy::Immediate or Buffered
+#define FLUSH_POLICY BearSSLClient::FlushPolicy::Immediate
+// BearSSLClient::Profile::Full, EcdsaGcmOnly, ChaChaOnly, Minimal or Tls12Sha256
+#define PROFILE BearSSLClient::Profile::Full
+#define PAYLOAD_SIZE (128 * 1024UL)
+#define WRITE_SIZE 512
+
+char server[] = "example.com";
+char uploadPath[] = "/upload";
+char downloadPath[] = "/download";
+
+#ifdef USE_MKRGSM
+const char pin[] = "";
+const char apn[] = "apn";
+const char login[] = "login";
+const char password[] = "pass";
+
+GPRS gprs;
+GSM gsmAccess;
+GSMClient client;
+#else
+char ssid[] = "yourNetwork";    // your network SSID (name)
+char pass[] = "secretPassword"; // your network password
+
+WiFiClient client;
+#endif
+
+BearSSLClient sslClient(client);
+
+uint8_t payload[WRITE_SIZE];
+
+unsigned long getTime() {
+#ifdef USE_MKRGSM
+  return gsmAccess.getTime();
+#else
+  return WiFi.getTime();
+#endif
+}
+
+void setup() {
+  Serial.begin(9600);
+  while (!Serial);
+
+#ifdef USE_MKRGSM
+  while (gsmAccess.begin(pin) != GSM_READY || gprs.attachGPRS(apn, login, password) != GPRS_READY) {
+    Serial.println("Not connected");
+    delay(1000);
+  }
+#else
+  while (WiFi.begin(ssid, pass) != WL_CONNECTED) {
+    Serial.println("Not connected");
+    delay(5000);
+  }
+#endif
+  Serial.println("Connected to the network");
+
+  ArduinoBearSSL.onGetTime(getTime);
+
+  sslClient.setProfile(PROFILE);
+  sslClient.setFlushPolicy(FLUSH_POLICY);
+  if (RECORD_SIZE) {
+    sslClient.setMaxFragmentLength(RECORD_SIZE);
+  }
+
+  for (size_t i = 0; i < sizeof(payload); i++) {
+    payload[i] = 'a' + i % 26;
+  }
+}
+
+void loop() {
+  upload();
+  download();
+
+  while (1);
+}
+
+void upload() {
+  if (!connect()) {
+    return;
+  }
+
+  sslClient.print("POST ");
+  sslClient.print(uploadPath);
+  sslClient.println(" HTTP/1.1");
+  sslClient.print("Host: ");
+  sslClient.println(server);
+  sslClient.print("Content-Length: ");
+  sslClient.println(PAYLOAD_SIZE);
+  sslClient.println("Connection: close");
+  sslClient.println();
+
+  resetCryptoStats();
+
+  unsigned long writes = 0;
+  unsigned long slowest = 0;
+  unsigned long start = micros();
+
+  for (unsigned long sent = 0; sent < PAYLOAD_SIZE; sent += WRITE_SIZE) {
+    unsigned long writeStart = micros();
+
+    if (sslClient.write(payload, WRITE_SIZE) != WRITE_SIZE) {
+      Serial.println("Upload failed");
+      sslClient.stop();
+      return;
+    }
+
+    unsigned long latency = micros() - writeStart;
+
+    if (latency > slowest) {
+      slowest = latency;
+    }
+    writes++;
+  }
+  sslClient.flush();
+
+  unsigned long elapsed = micros() - start;
+
+  Serial.println("Upload");
+  printThroughput(PAYLOAD_SIZE, elapsed);
+  Serial.print("  write() latency: ");
+  Serial.print(elapsed / writes);
+  Serial.print(" us average, ");
+  Serial.print(slowest);
+  Serial.println(" us max");
+  printCryptoShare(elapsed);
+
+  sslClient.stop();
+}
+
+void download() {
+  if (!connect()) {
+    return;
+  }
+
+  sslClient.print("GET ");
+  sslClient.print(downloadPath);
+  sslClient.println(" HTTP/1.1");
+  sslClient.print("Host: ");
+  sslClient.println(server);
+  sslClient.println("Connection: close");
+  sslClient.println();
+
+  if (!skipHeaders()) {
+    Serial.println("No response");
+    sslClient.stop();
+    return;
+  }
+
+  resetCryptoStats();
+
+  unsigned long received = 0;
+  unsigned long records = 0;
+  unsigned long slowest = 0;
+  unsigned long waiting = 0;
+  unsigned long start = micros();
+  unsigned long last = start;
+
+  while (received < PAYLOAD_SIZE) {
+    unsigned long pollStart = micros();
+    size_t length;
+    const uint8_t* data = sslClient.peekBuffer(length);
+
+    if (data == NULL) {
+      if (!sslClient.connected()) {
+        break;
+      }
+
+      // nothing decrypted yet, the CPU would be free for other work
+      waiting += micros() - pollStart;
+      continue;
+    }
+
+    // each buffer holds the plaintext of one record
+    unsigned long now = micros();
+
+    if (now - last > slowest) {
+      slowest = now - last;
+    }
+    last = now;
+    records++;
+
+    received += length;
+    sslClient.consume(length);
+  }
+
+  unsigned long elapsed = micros() - start;
+
+  Serial.println("Download");
+  printThroughput(received, elapsed);
+  Serial.print("  records: ");
+  Serial.print(records);
+  if (records) {
+    Serial.print(", ");
+    Serial.print(elapsed / records);
+    Serial.print(" us apart on average, ");
+    Serial.print(slowest);
+    Serial.print(" us max");
+  }
+  Serial.println();
+  Serial.print("  idle: ");
+  Serial.print(100.0 * waiting / elapsed, 1);
+  Serial.println(" %");
+  printCryptoShare(elapsed);
+
+  sslClient.stop();
+}
+
+int connect() {
+  Serial.print("Connecting to ");
+  Serial.println(server);
+
+  if (!sslClient.connect(server, 443)) {
+    Serial.print("Connection failed, error ");
+    Serial.println(sslClient.errorCode());
+    return 0;
+  }
+
+  return 1;
+}
+
+// skip the response headers, up to the empty line
+int skipHeaders() {
+  unsigned long start = millis();
+  int matched = 0;
+
+  while (matched < 4 && millis() - start < 10000) {
+    int c = sslClient.read();
+
+    if (c < 0) {
+      if (!sslClient.connected()) {
+        return 0;
+      }
+      continue;
+    }
+
+    if (c == "\r\n\r\n"[matched]) {
+      matched++;
+    } else {
+      matched = (c == '\r') ? 1 : 0;
+    }
+  }
+
+  return (matched == 4);
+}
+
+void printThroughput(unsigned long bytes, unsigned long elapsed) {
+  Serial.print("  ");
+  Serial.print(bytes);
+  Serial.print(" bytes in ");
+  Serial.print(elapsed / 1000);
+  Serial.print(" ms, ");
+  Serial.print(bytes * 1000.0 / elapsed, 1);
+  Serial.println(" kB/s");
+}
+
+void resetCryptoStats() {
+#ifdef BEAR_SSL_CRYPTO_STATS
+  ArduinoBearSSL.resetCryptoStats();
+#endif
+}
+
+void printCryptoShare(unsigned long elapsed) {
+#ifdef BEAR_SSL_CRYPTO_STATS
+  uint64_t cycles = 0;
+
+  for (int i = 0; i <= (int)ArduinoBearSSLClass::CryptoOperation::CbcDecrypt; i++) {
+    BearSSLCryptoStats stats;
+
+    ArduinoBearSSL.cryptoStats((ArduinoBearSSLClass::CryptoOperation)i, stats);
+    cycles += stats.cycles;
+  }
+
+  Serial.print("  record encryption: ");
+  Serial.print(100.0 * cycles / ((float)elapsed * (F_CPU / 1000000)), 1);
+  Serial.println(" % of the CPU");
+#else
+  (void)elapsed;
+#endif
+}
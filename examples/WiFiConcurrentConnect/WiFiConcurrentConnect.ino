@@ -0,0 +1,119 @@
+/*
+  ArduinoBearSSL Concurrent Connect Example
+
+  This sketch connects to several HTTPS servers at once: the handshakes
+  are started with connectAsync() and driven by a BearSSLConnectionSet,
+  so the round trips to the servers overlap instead of adding up. Each
+  server gets a GET request once its handshake completes, and the time
+  to the first byte of each response is printed.
+
+  With setWorkerCore(true), on a dual-core board (e.g. the Nano RP2040
+  Connect with the Raspberry Pi Pico core) the public key operations of
+  the handshakes run one at a time on the second core, while the other
+  handshakes keep exchanging records on the first one.
+
+  Circuit:
+  - MKR WiFi 1010, Nano 33 IoT or Nano RP2040 Connect board (WiFiNINA)
+
+  This example code is in the public domain.
+*/
+
+#include <SPI.h>
+#include <WiFiNINA.h>
+#include <ArduinoBearSSL.h>
+
+#define SERVERS 3
+
+char ssid[] = "yourNetwork";    // your network SSID (name)
+char pass[] = "secretPassword"; // your network password
+
+const char* servers[SERVERS] = { "example.com", "arduino.cc", "github.com" };
+
+WiFiClient client0;
+WiFiClient client1;
+WiFiClient client2;
+BearSSLClient sslClient0(client0);
+BearSSLClient sslClient1(client1);
+BearSSLClient sslClient2(client2);
+
+BearSSLClient* sslClients[SERVERS] = { &sslClient0, &sslClient1, &sslClient2 };
+BearSSLConnectionSet connections;
+
+unsigned long start;
+int done = 0;
+
+unsigned long getTime() {
+  return WiFi.getTime();
+}
+
+void setup() {
+  Serial.begin(9600);
+  while (!Serial);
+
+  while (WiFi.begin(ssid, pass) != WL_CONNECTED) {
+    Serial.println("Not connected");
+    delay(5000);
+  }
+  Serial.println("Connected to the network");
+
+  ArduinoBearSSL.onGetTime(getTime);
+
+  connections.setWorkerCore(true);
+
+  start = millis();
+
+  for (int i = 0; i < SERVERS; i++) {
+    // the transport is opened here, the handshake runs in loop()
+    if (!sslClients[i]->connectAsync(servers[i], 443)) {
+      Serial.print("Connection to ");
+      Serial.print(servers[i]);
+      Serial.println(" failed");
+      done++;
+      continue;
+    }
+
+    connections.add(*sslClients[i], onEvent, (void*)servers[i]);
+  }
+}
+
+void loop() {
+  if (done < SERVERS) {
+    connections.poll();
+  }
+}
+
+void onEvent(BearSSLClient& client, int events, void* arg) {
+  const char* server = (const char*)arg;
+
+  if (events & BEAR_SSL_EVENT_CONNECTED) {
+    printTime(server, "handshake done");
+
+    client.print("GET / HTTP/1.1\r\nHost: ");
+    client.print(server);
+    client.print("\r\nConnection: close\r\n\r\n");
+  }
+
+  if (events & BEAR_SSL_EVENT_READABLE) {
+    printTime(server, "first response bytes");
+
+    client.stop();
+    connections.remove(client);
+    done++;
+  } else if (events & BEAR_SSL_EVENT_CLOSED) {
+    Serial.print(server);
+    Serial.print(": closed, error ");
+    Serial.println(client.errorCode());
+
+    connections.remove(client);
+    done++;
+  }
+}
+
+void printTime(const char* server, const char* step) {
+  Serial.print(server);
+  Serial.print(": ");
+  Serial.print(step);
+  Serial.print(" after ");
+  Serial.print(millis() - start);
+  Serial.println(" ms");
+}
@@ -0,0 +1,157 @@
+/*
+  ArduinoBearSSL HTTPS Server Example
+
+  This sketch serves a small web page over HTTPS with BearSSLServer, e.g.
+  as the provisioning portal of a device. The sessions are kept in an LRU
+  cache, so a browser opening several connections to load a page, or
+  coming back a little later, resumes its session instead of running a
+  full handshake and an ECDSA signature each time.
+
+  server_credentials.h holds a P-256 test certificate for "localhost"
+  and its key, generated with extras/generate_der.py: browsers will warn
+  about it, replace it with a certificate and key of your own.
+
+  Circuit:
+  - MKR WiFi 1010 or Nano 33 IoT board
+
+  This example code is in the public domain.
+*/
+
+#include <SPI.h>
+#include <WiFiNINA.h>
+#include <ArduinoBearSSL.h>
+#include "server_credentials.h"
+
+char ssid[] = "yourNetwork";    // your network SSID (name)
+char pass[] = "secretPassword"; // your network password
+
+br_x509_certificate serverChain = { (unsigned char*)SERVER_CERT, sizeof(SERVER_CERT) };
+unsigned char serverKeyData[BR_EC_KBUF_PRIV_MAX_SIZE];
+br_ec_private_key serverKey;
+
+// room for 20 sessions
+#define SESSION_CACHE_SIZE (20 * BEAR_SSL_SERVER_SESSION_SIZE)
+
+WiFiServer server(443);
+BearSSLServer httpsServer(&serverChain, 1, &serverKey);
+BearSSLServerClient https(httpsServer);
+
+unsigned long requests = 0;
+
+void setup() {
+  Serial.begin(9600);
+  while (!Serial);
+
+  if (!decodeServerKey()) {
+    Serial.println("Server key decoding failed");
+    while (1);
+  }
+
+  while (WiFi.begin(ssid, pass) != WL_CONNECTED) {
+    Serial.println("Not connected");
+    delay(5000);
+  }
+
+  // with a certificate for the key in slot 0 of the board's ECC508/608,
+  // the chip signs the handshakes instead of the much slower software:
+  // httpsServer.setEccSlot(0);
+
+  // every browser accepts ECDHE-ECDSA-AES128-GCM-SHA256 on P-256
+  httpsServer.setProfile(BearSSLServer::Profile::Minimal);
+  httpsServer.setSessionCacheSize(SESSION_CACHE_SIZE);
+  server.begin();
+
+  Serial.print("Listening on https://");
+  Serial.println(WiFi.localIP());
+}
+
+void loop() {
+  WiFiClient client = server.available();
+
+  if (!client) {
+    return;
+  }
+
+  unsigned long start = millis();
+
+  if (!https.accept(client)) {
+    Serial.print("Handshake failed, error ");
+    Serial.println(https.errorCode());
+    return;
+  }
+
+  BearSSLSessionCacheStats stats;
+
+  httpsServer.sessionCacheStats(stats);
+
+  Serial.print("Handshake in ");
+  Serial.print(millis() - start);
+  Serial.print(" ms, sessions resumed: ");
+  Serial.print(stats.hits);
+  Serial.print(", not found: ");
+  Serial.print(stats.misses);
+  Serial.print(", stored: ");
+  Serial.println(stats.saves);
+
+  if (readRequest()) {
+    requests++;
+
+    https.println("HTTP/1.1 200 OK");
+    https.println("Content-Type: text/html");
+    https.println("Connection: close");
+    https.println();
+    https.println("<!DOCTYPE html><html><body>");
+    https.print("<p>Request ");
+    https.print(requests);
+    https.println(" served over TLS by ArduinoBearSSL.</p>");
+    https.println("</body></html>");
+  }
+
+  // sends the response and a close_notify, then closes the client
+  https.stop();
+}
+
+// skip the request, up to the empty line after the headers
+int readRequest() {
+  unsigned long start = millis();
+  int matched = 0;
+
+  while (matched < 4 && millis() - start < 5000) {
+    int c = https.read();
+
+    if (c < 0) {
+      if (!https.connected()) {
+        return 0;
+      }
+      continue;
+    }
+
+    if (c == "\r\n\r\n"[matched]) {
+      matched++;
+    } else {
+      matched = (c == '\r') ? 1 : 0;
+    }
+  }
+
+  return (matched == 4);
+}
+
+int decodeServerKey() {
+  static br_skey_decoder_context decoder;
+
+  br_skey_decoder_init(&decoder);
+  br_skey_decoder_push(&decoder, SERVER_KEY, sizeof(SERVER_KEY));
+
+  const br_ec_private_key* key = br_skey_decoder_get_ec(&decoder);
+
+  if (key == NULL || key->xlen > sizeof(serverKeyData)) {
+    return 0;
+  }
+
+  memcpy(serverKeyData, key->x, key->xlen);
+  serverKey.curve = key->curve;
+  serverKey.x = serverKeyData;
+  serverKey.xlen = key->xlen;
+
+  return 1;
+}
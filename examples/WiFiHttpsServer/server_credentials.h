@@ -0,0 +1,60 @@
+// generated by extras/generate_der.py from server.pem, server.key
+
+#ifndef _SERVER_CREDENTIALS_H_
+#define _SERVER_CREDENTIALS_H_
+
+#include "bearssl/bearssl_x509.h"
+
+static const unsigned char SERVER_CERT[] = {
+  0x30, 0x82, 0x01, 0x97, 0x30, 0x82, 0x01, 0x3D, 0xA0, 0x03, 0x02, 0x01,
+  0x02, 0x02, 0x01, 0x02, 0x30, 0x0A, 0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE,
+  0x3D, 0x04, 0x03, 0x02, 0x30, 0x1F, 0x31, 0x1D, 0x30, 0x1B, 0x06, 0x03,
+  0x55, 0x04, 0x03, 0x0C, 0x14, 0x42, 0x65, 0x61, 0x72, 0x53, 0x53, 0x4C,
+  0x20, 0x42, 0x65, 0x6E, 0x63, 0x68, 0x6D, 0x61, 0x72, 0x6B, 0x20, 0x43,
+  0x41, 0x30, 0x20, 0x17, 0x0D, 0x32, 0x36, 0x31, 0x30, 0x31, 0x34, 0x30,
+  0x38, 0x35, 0x36, 0x30, 0x38, 0x5A, 0x18, 0x0F, 0x32, 0x31, 0x32, 0x36,
+  0x30, 0x39, 0x32, 0x30, 0x30, 0x38, 0x35, 0x36, 0x30, 0x38, 0x5A, 0x30,
+  0x14, 0x31, 0x12, 0x30, 0x10, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0C, 0x09,
+  0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x68, 0x6F, 0x73, 0x74, 0x30, 0x59, 0x30,
+  0x13, 0x06, 0x07, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x02, 0x01, 0x06, 0x08,
+  0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x03, 0x01, 0x07, 0x03, 0x42, 0x00, 0x04,
+  0x39, 0x05, 0x8C, 0xE6, 0x85, 0xF5, 0x8A, 0x2E, 0x59, 0x9C, 0x33, 0x3D,
+  0x76, 0x89, 0x18, 0xEB, 0xDF, 0x64, 0x8C, 0x09, 0x76, 0x97, 0x42, 0x01,
+  0x5B, 0x9A, 0xBC, 0xA1, 0xA5, 0x58, 0x5D, 0xBD, 0xE1, 0xFD, 0x22, 0x0D,
+  0x2B, 0x24, 0x12, 0x3A, 0xC3, 0xF2, 0xDB, 0x9C, 0x85, 0x00, 0x42, 0x00,
+  0x05, 0x69, 0xF9, 0x76, 0xC8, 0xEB, 0xD0, 0x07, 0x58, 0x9C, 0x67, 0xC8,
+  0xB1, 0x1A, 0xB0, 0x6C, 0xA3, 0x73, 0x30, 0x71, 0x30, 0x14, 0x06, 0x03,
+  0x55, 0x1D, 0x11, 0x04, 0x0D, 0x30, 0x0B, 0x82, 0x09, 0x6C, 0x6F, 0x63,
+  0x61, 0x6C, 0x68, 0x6F, 0x73, 0x74, 0x30, 0x0E, 0x06, 0x03, 0x55, 0x1D,
+  0x0F, 0x01, 0x01, 0xFF, 0x04, 0x04, 0x03, 0x02, 0x07, 0x80, 0x30, 0x09,
+  0x06, 0x03, 0x55, 0x1D, 0x13, 0x04, 0x02, 0x30, 0x00, 0x30, 0x1D, 0x06,
+  0x03, 0x55, 0x1D, 0x0E, 0x04, 0x16, 0x04, 0x14, 0x28, 0x74, 0xCB, 0xBE,
+  0x02, 0xB9, 0x7E, 0x19, 0x20, 0xF0, 0x30, 0x3C, 0x48, 0x9B, 0xDE, 0x6C,
+  0x75, 0xBF, 0x96, 0x4F, 0x30, 0x1F, 0x06, 0x03, 0x55, 0x1D, 0x23, 0x04,
+  0x18, 0x30, 0x16, 0x80, 0x14, 0x89, 0x58, 0x46, 0x06, 0x65, 0x9F, 0x44,
+  0xE4, 0xA0, 0x4F, 0xD0, 0x10, 0xDD, 0x6F, 0xC2, 0x98, 0xDB, 0xC8, 0x9D,
+  0x59, 0x30, 0x0A, 0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x04, 0x03,
+  0x02, 0x03, 0x48, 0x00, 0x30, 0x45, 0x02, 0x20, 0x13, 0x92, 0x10, 0xCA,
+  0x30, 0xE9, 0x60, 0x17, 0x17, 0xE0, 0xB3, 0x93, 0x60, 0xD7, 0x29, 0x96,
+  0xAE, 0x9C, 0x4D, 0xEC, 0x91, 0xB6, 0xB3, 0xD4, 0x78, 0x16, 0xE3, 0xEE,
+  0xF2, 0xF3, 0x0C, 0x04, 0x02, 0x21, 0x00, 0x9B, 0xB7, 0x60, 0x14, 0x21,
+  0x3D, 0x1D, 0x33, 0x75, 0x99, 0x07, 0xC6, 0x6B, 0x08, 0xF0, 0x7A, 0x8C,
+  0x0A, 0xCC, 0x69, 0x5F, 0x1D, 0x9D, 0x44, 0x5E, 0x8D, 0x21, 0x2D, 0x3A,
+  0xF2, 0x40, 0x31
+};
+
+static const unsigned char SERVER_KEY[] = {
+  0x30, 0x77, 0x02, 0x01, 0x01, 0x04, 0x20, 0x7D, 0xB8, 0xFF, 0xF5, 0x7C,
+  0x41, 0x3A, 0xF8, 0x5F, 0x17, 0xFD, 0xDD, 0x6E, 0x0A, 0x53, 0xF3, 0x27,
+  0xEE, 0x13, 0x66, 0xCD, 0x4C, 0xAD, 0x84, 0xFB, 0x29, 0x67, 0x35, 0xEF,
+  0x19, 0x88, 0x08, 0xA0, 0x0A, 0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D,
+  0x03, 0x01, 0x07, 0xA1, 0x44, 0x03, 0x42, 0x00, 0x04, 0x39, 0x05, 0x8C,
+  0xE6, 0x85, 0xF5, 0x8A, 0x2E, 0x59, 0x9C, 0x33, 0x3D, 0x76, 0x89, 0x18,
+  0xEB, 0xDF, 0x64, 0x8C, 0x09, 0x76, 0x97, 0x42, 0x01, 0x5B, 0x9A, 0xBC,
+  0xA1, 0xA5, 0x58, 0x5D, 0xBD, 0xE1, 0xFD, 0x22, 0x0D, 0x2B, 0x24, 0x12,
+  0x3A, 0xC3, 0xF2, 0xDB, 0x9C, 0x85, 0x00, 0x42, 0x00, 0x05, 0x69, 0xF9,
+  0x76, 0xC8, 0xEB, 0xD0, 0x07, 0x58, 0x9C, 0x67, 0xC8, 0xB1, 0x1A, 0xB0,
+  0x6C
+};
+
+#endif
@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Arduino SA. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining
+# a copy of this software and associated documentation files (the
+# "Software"), to deal in the Software without restriction, including
+# without limitation the rights to use, copy, modify, merge, publish,
+# distribute, sublicense, and/or sell copies of the Software, and to
+# permit persons to whom the Software is furnished to do so, subject to
+# the following conditions:
+#
+# The above copyright notice and this permission notice shall be
+# included in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+# BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+# ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+
+"""Convert PEM certificates and keys to DER arrays in a C header.
+
+Every PEM object of the input files becomes a static const array, so that
+the sketch hands DER to BearSSLClient (setEccSlot(), setKey(),
+setEccCertParent(), setCertificateChain()) and skips the base64 decoding
+at boot; the DER form is also about 25% smaller in flash than the PEM
+text. Arrays are named after --name, or the file name, with a _CERT,
+_KEY or _DER suffix and an index when a file holds more than one object.
+Files with several certificates also get a br_x509_certificate chain.
+
+  extras/generate_der.py -o device_cert.h --name DEVICE device.pem
+  extras/generate_der.py -o credentials.h client.crt client.key chain.pem
+
+Only the Python standard library is used.
+"""
+
+import argparse
+import base64
+import os
+import re
+import sys
+
+from generate_trust_anchors import c_array
+
+PEM_RE = re.compile(rb"-----BEGIN ([A-Z0-9 ]+)-----(.*?)-----END \1-----", re.S)
+
+
+def load_pem(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    objects = []
+    for match in PEM_RE.finditer(data):
+        label = match.group(1).decode("ascii")
+        objects.append((label, base64.b64decode(b"".join(match.group(2).split()))))
+    return objects
+
+
+def suffix(label):
+    if label in ("CERTIFICATE", "X509 CERTIFICATE"):
+        return "CERT"
+    if label.endswith("PRIVATE KEY"):
+        return "KEY"
+    return "DER"
+
+
+def identifier(text):
+    name = re.sub(r"[^0-9A-Za-z_]", "_", text).upper()
+    return "_" + name if name[:1].isdigit() else name
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("paths", nargs="+", help="PEM files")
+    parser.add_argument("-o", "--output", required=True, help="C header to write")
+    parser.add_argument("--name", help="array name prefix (default: from the file name)")
+    args = parser.parse_args()
+
+    guard = "_" + identifier(os.path.basename(args.output)) + "_"
+    out = ["// generated by extras/generate_der.py from %s\n\n" %
+           ", ".join(os.path.basename(p) for p in args.paths),
+           "#ifndef %s\n#define %s\n\n" % (guard, guard),
+           '#include "bearssl/bearssl_x509.h"\n\n']
+    total = 0
+
+    for path in args.paths:
+        objects = load_pem(path)
+        if not objects:
+            sys.exit("%s: no PEM object" % path)
+
+        prefix = args.name if args.name and len(args.paths) == 1 else \
+            identifier(os.path.splitext(os.path.basename(path))[0])
+        certs = []
+        for i, (label, der) in enumerate(objects):
+            name = "%s_%s" % (prefix, suffix(label))
+            if len(objects) > 1:
+                name += "%d" % i
+            out.append(c_array(name, der))
+            total += len(der)
+            if suffix(label) == "CERT":
+                certs.append(name)
+
+        if len(certs) > 1:
+            out.append("static const br_x509_certificate %s_CHAIN[] = {\n" % prefix)
+            out.append(",\n".join("  { (unsigned char*)%s, sizeof(%s) }" % (c, c) for c in certs))
+            out.append("\n};\n\n")
+
+    out.append("#endif\n")
+    with open(args.output, "w") as f:
+        f.write("".join(out))
+    sys.stderr.write("%d bytes of DER\n" % total)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Arduino SA. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining
+# a copy of this software and associated documentation files (the
+# "Software"), to deal in the Software without restriction, including
+# without limitation the rights to use, copy, modify, merge, publish,
+# distribute, sublicense, and/or sell copies of the Software, and to
+# permit persons to whom the Software is furnished to do so, subject to
+# the following conditions:
+#
+# The above copyright notice and this permission notice shall be
+# included in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+# BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+# ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+
+
+"""Generate a BearSSLRevocationFilter image from CRLs or certificates.
+
+Every revoked certificate is added to a Bloom filter under the SHA-256 hash
+of its serial number (contents of the DER INTEGER) followed by its DER
+encoded issuer Name. The filter is sized for the requested false positive
+rate, which is the share of valid certificates that get rejected.
+
+  extras/generate_revocation_filter.py -o revoked.bin --crl ca.crl
+  extras/generate_revocation_filter.py --header REVOKED -o revoked.h certs/
+
+Certificates and CRLs may be DER or PEM, only the Python standard library
+is used.
+"""
+
+import argparse
+import base64
+import hashlib
+import math
+import struct
+import sys
+
+from generate_trust_anchors import c_array, der_children, der_read, load_der
+
+
+def load_crl(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if b"-----BEGIN X509 CRL-----" in data:
+        blocks = []
+        for block in data.split(b"-----BEGIN X509 CRL-----")[1:]:
+            body = block.split(b"-----END X509 CRL-----")[0]
+            blocks.append(base64.b64decode(b"".join(body.split())))
+        return blocks
+    return [data]
+
+
+def certificate_key(der):
+    _, start, end = der_read(der, 0)
+    _, start, end = der_read(der, start)
+    fields = der_children(der, start, end)
+    if fields[0][0] == 0xA0:
+        fields = fields[1:]
+    serial = der[fields[0][2]:fields[0][3]]
+    issuer = der[fields[2][1]:fields[2][3]]
+    return hashlib.sha256(serial + issuer).digest()
+
+
+def crl_keys(der):
+    _, start, end = der_read(der, 0)
+    _, start, end = der_read(der, start)
+    fields = der_children(der, start, end)
+    if fields[0][0] == 0x02:
+        fields = fields[1:]
+    issuer = der[fields[1][1]:fields[1][3]]
+    keys = []
+    # thisUpdate, optional nextUpdate, then the revokedCertificates SEQUENCE
+    for tag, _, cstart, cend in fields[3:]:
+        if tag != 0x30:
+            continue
+        for _, _, estart, eend in der_children(der, cstart, cend):
+            serial_tag, sstart, send = der_read(der, estart)
+            if serial_tag == 0x02:
+                keys.append(hashlib.sha256(der[sstart:send] + issuer).digest())
+        break
+    return keys
+
+
+def build_filter(keys, rate):
+    # optimal number of hashes for the rate, then the matching size
+    n = max(len(keys), 1)
+    hashes = min(255, max(1, int(math.ceil(-math.log2(rate)))))
+    bits = max(64, int(math.ceil(n * hashes / math.log(2))))
+    data = bytearray((bits + 7) // 8)
+    for key in keys:
+        h1, h2 = struct.unpack(">II", key[:8])
+        h2 |= 1
+        for i in range(hashes):
+            bit = ((h1 + i * h2) & 0xFFFFFFFF) % bits
+            data[bit >> 3] |= 1 << (bit & 7)
+    return b"BRF1" + struct.pack(">BI", hashes, bits) + bytes(data)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("paths", nargs="*", help="revoked certificate files")
+    parser.add_argument("--crl", action="append", default=[], help="CRL file, may be repeated")
+    parser.add_argument("-o", "--output", required=True, help="image (or C header) to write")
+    parser.add_argument("--header", metavar="NAME",
+                        help="write a C header with the image as array NAME instead")
+    parser.add_argument("--rate", type=float, default=0.001,
+                        help="false positive rate (default: 0.001)")
+    args = parser.parse_args()
+
+    keys = set()
+    for path in args.paths:
+        for der in load_der(path):
+            keys.add(certificate_key(der))
+    for path in args.crl:
+        for der in load_crl(path):
+            keys.update(crl_keys(der))
+
+    image = build_filter(sorted(keys), args.rate)
+    sys.stderr.write("%d certificates, %d bytes\n" % (len(keys), len(image)))
+
+    if args.header:
+        with open(args.output, "w") as f:
+            f.write("// generated by extras/generate_revocation_filter.py: %d revoked\n"
+                    "// certificates, false positive rate %g\n\n" % (len(keys), args.rate))
+            f.write(c_array(args.header, image))
+    else:
+        with open(args.output, "wb") as f:
+            f.write(image)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,337 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Arduino SA. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining
+# a copy of this software and associated documentation files (the
+# "Software"), to deal in the Software without restriction, including
+# without limitation the rights to use, copy, modify, merge, publish,
+# distribute, sublicense, and/or sell copies of the Software, and to
+# permit persons to whom the Software is furnished to do so, subject to
+# the following conditions:
+#
+# The above copyright notice and this permission notice shall be
+# included in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+# BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+# ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+
+"""Generate trust anchors from a directory of certificates.
+
+Produces the same C tables as "brssl ta", but deduplicated, sorted by the
+SHA-256 hash of the DN (the order used by BearSSLClient::setTrustAnchorIndex()
+and BearSSLTrustStore) and optionally restricted to RSA or EC keys. It can
+also write a BearSSLTrustStore image for external flash or an SD card.
+
+  extras/generate_trust_anchors.py -o src/BearSSLTrustAnchors.h extras/TrustAnchors
+  extras/generate_trust_anchors.py --key-types ec --image anchors.bin certs/
+
+Certificates may be DER or PEM, only the Python standard library is used.
+"""
+
+import argparse
+import base64
+import glob
+import hashlib
+import os
+import struct
+import sys
+
+BR_KEYTYPE_RSA = 1
+BR_KEYTYPE_EC = 2
+BR_X509_TA_CA = 0x0001
+
+CURVES = {
+    "1.2.840.10045.3.1.7": ("BR_EC_secp256r1", 23),
+    "1.3.132.0.34": ("BR_EC_secp384r1", 24),
+    "1.3.132.0.35": ("BR_EC_secp521r1", 25),
+}
+
+OID_RSA = "1.2.840.113549.1.1.1"
+OID_EC = "1.2.840.10045.2.1"
+OID_BASIC_CONSTRAINTS = "2.5.29.19"
+
+HEADER = """/*
+ * Copyright (c) 2018 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+"""
+
+
+def der_read(data, pos):
+    """Return (tag, content start, content end) of the element at pos."""
+    tag = data[pos]
+    length = data[pos + 1]
+    pos += 2
+    if length & 0x80:
+        count = length & 0x7F
+        length = int.from_bytes(data[pos:pos + count], "big")
+        pos += count
+    return tag, pos, pos + length
+
+
+def der_children(data, start, end):
+    children = []
+    while start < end:
+        tag, cstart, cend = der_read(data, start)
+        children.append((tag, start, cstart, cend))
+        start = cend
+    return children
+
+
+def der_oid(value):
+    first = value[0]
+    parts = [first // 40, first % 40]
+    n = 0
+    for b in value[1:]:
+        n = (n << 7) | (b & 0x7F)
+        if not b & 0x80:
+            parts.append(n)
+            n = 0
+    return ".".join(str(p) for p in parts)
+
+
+def der_uint(value):
+    # strip the sign byte, BearSSL wants unsigned big-endian
+    while len(value) > 1 and value[0] == 0:
+        value = value[1:]
+    return value
+
+
+def load_der(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if b"-----BEGIN CERTIFICATE-----" in data:
+        blocks = []
+        for block in data.split(b"-----BEGIN CERTIFICATE-----")[1:]:
+            body = block.split(b"-----END CERTIFICATE-----")[0]
+            blocks.append(base64.b64decode(b"".join(body.split())))
+        return blocks
+    return [data]
+
+
+def parse_certificate(der):
+    _, start, end = der_read(der, 0)
+    tbs = der_children(der, start, end)[0]
+    fields = der_children(der, tbs[2], tbs[3])
+    if fields[0][0] == 0xA0:
+        fields = fields[1:]
+    # serial, signature, issuer, validity, subject, spki, ...
+    subject = fields[4]
+    dn = der[subject[1]:subject[3]]
+
+    spki = der_children(der, fields[5][2], fields[5][3])
+    alg = der_children(der, spki[0][2], spki[0][3])
+    alg_oid = der_oid(der[alg[0][2]:alg[0][3]])
+    bits = der[spki[1][2] + 1:spki[1][3]]
+
+    if alg_oid == OID_RSA:
+        _, kstart, kend = der_read(bits, 0)
+        n, e = der_children(bits, kstart, kend)
+        key = (BR_KEYTYPE_RSA, der_uint(bits[n[2]:n[3]]), der_uint(bits[e[2]:e[3]]))
+    elif alg_oid == OID_EC:
+        curve_oid = der_oid(der[alg[1][2]:alg[1][3]])
+        if curve_oid not in CURVES:
+            raise ValueError("unsupported curve " + curve_oid)
+        key = (BR_KEYTYPE_EC, curve_oid, bits)
+    else:
+        raise ValueError("unsupported key type " + alg_oid)
+
+    flags = 0
+    for field in fields[6:]:
+        if field[0] != 0xA3:
+            continue
+        exts = der_children(der, field[2], field[3])[0]
+        for ext in der_children(der, exts[2], exts[3]):
+            parts = der_children(der, ext[2], ext[3])
+            if der_oid(der[parts[0][2]:parts[0][3]]) != OID_BASIC_CONSTRAINTS:
+                continue
+            value = parts[-1]
+            _, bstart, bend = der_read(der, value[2])
+            for item in der_children(der, bstart, bend):
+                if item[0] == 0x01 and der[item[2]] != 0:
+                    flags |= BR_X509_TA_CA
+
+    # v1 roots have no extensions, brssl trusts them as CAs as well
+    if not any(field[0] == 0xA3 for field in fields[6:]):
+        flags |= BR_X509_TA_CA
+
+    return dn, flags, key
+
+
+def dn_hash(dn):
+    return hashlib.sha256(dn).digest()
+
+
+def c_array(name, data):
+    lines = ["static const unsigned char %s[] = {" % name]
+    for i in range(0, len(data), 12):
+        chunk = data[i:i + 12]
+        sep = "," if i + 12 < len(data) else ""
+        lines.append("  " + ", ".join("0x%02X" % b for b in chunk) + sep)
+    lines.append("};")
+    return "\n".join(lines) + "\n\n"
+
+
+def emit_header(anchors, index):
+    out = [HEADER, "\n#ifndef _BEAR_SSL_TRUST_ANCHORS_H_\n#define _BEAR_SSL_TRUST_ANCHORS_H_\n\n",
+           '#include "bearssl/bearssl_ssl.h"\n\n',
+           "// The following was created by running extras/generate_trust_anchors.py\n",
+           "// in the extras/TrustAnchors directory, entries are sorted by the\n",
+           "// SHA-256 hash of their DN.\n\n"]
+
+    for i, (dn, flags, key) in enumerate(anchors):
+        out.append(c_array("TA%d_DN" % i, dn))
+        if key[0] == BR_KEYTYPE_RSA:
+            out.append(c_array("TA%d_RSA_N" % i, key[1]))
+            out.append(c_array("TA%d_RSA_E" % i, key[2]))
+        else:
+            out.append(c_array("TA%d_EC_Q" % i, key[2]))
+
+    out.append("static const br_x509_trust_anchor TAs[%d] = {\n" % len(anchors))
+    entries = []
+    for i, (dn, flags, key) in enumerate(anchors):
+        e = ["  {\n",
+             "    { (unsigned char *)TA%d_DN, sizeof TA%d_DN },\n" % (i, i),
+             "    %s,\n" % ("BR_X509_TA_CA" if flags & BR_X509_TA_CA else "0"),
+             "    {\n"]
+        if key[0] == BR_KEYTYPE_RSA:
+            e += ["      BR_KEYTYPE_RSA,\n",
+                  "      { .rsa = {\n",
+                  "        (unsigned char *)TA%d_RSA_N, sizeof TA%d_RSA_N,\n" % (i, i),
+                  "        (unsigned char *)TA%d_RSA_E, sizeof TA%d_RSA_E,\n" % (i, i),
+                  "      } }\n"]
+        else:
+            e += ["      BR_KEYTYPE_EC,\n",
+                  "      { .ec = {\n",
+                  "        %s,\n" % CURVES[key[1]][0],
+                  "        (unsigned char *)TA%d_EC_Q, sizeof TA%d_EC_Q,\n" % (i, i),
+                  "      } }\n"]
+        e += ["    }\n", "  }"]
+        entries.append("".join(e))
+    out.append(",\n".join(entries) + "\n};\n\n")
+    out.append("#define TAs_NUM   %d\n" % len(anchors))
+
+    if index:
+        out.append("\n// for BearSSLClient::setTrustAnchorIndex()\n")
+        out.append("static const br_x509_ta_index_entry TAs_INDEX[%d] = {\n" % len(anchors))
+        rows = []
+        for i, (dn, _, _) in enumerate(anchors):
+            rows.append("  { { %s }, %d }" % (", ".join("0x%02X" % b for b in dn_hash(dn)[:8]), i))
+        out.append(",\n".join(rows) + "\n};\n")
+
+    out.append("\n#endif\n")
+    return "".join(out)
+
+
+def record(dn, flags, key):
+    body = struct.pack(">BBH", flags, key[0], len(dn)) + dn
+    if key[0] == BR_KEYTYPE_RSA:
+        body += struct.pack(">H", len(key[1])) + key[1]
+        body += struct.pack(">H", len(key[2])) + key[2]
+    else:
+        body += struct.pack(">BB", CURVES[key[1]][1], len(key[2])) + key[2]
+    return struct.pack(">H", len(body) + 2) + body
+
+
+def emit_image(anchors):
+    # same layout as BearSSLTrustStore::serialize()
+    offset = 6 + 12 * len(anchors)
+    index = b""
+    records = b""
+    for dn, flags, key in anchors:
+        rec = record(dn, flags, key)
+        index += dn_hash(dn)[:8] + struct.pack(">I", offset + len(records))
+        records += rec
+    return b"BTA1" + struct.pack(">H", len(anchors)) + index + records
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("paths", nargs="+", help="certificate files or directories")
+    parser.add_argument("-o", "--output", help="C header to write (default: stdout)")
+    parser.add_argument("--image", help="also write a BearSSLTrustStore image")
+    parser.add_argument("--key-types", default="rsa,ec",
+                        help="comma separated key types to keep: rsa, ec")
+    parser.add_argument("--index", action="store_true",
+                        help="emit TAs_INDEX for BearSSLClient::setTrustAnchorIndex()")
+    parser.add_argument("--keep-order", action="store_true",
+                        help="keep the file order instead of sorting by DN hash")
+    args = parser.parse_args()
+
+    keep = set()
+    for t in args.key_types.split(","):
+        keep.add({"rsa": BR_KEYTYPE_RSA, "ec": BR_KEYTYPE_EC}[t.strip().lower()])
+
+    files = []
+    for path in args.paths:
+        if os.path.isdir(path):
+            files += sorted(glob.glob(os.path.join(path, "*.cer")) +
+                            glob.glob(os.path.join(path, "*.crt")) +
+                            glob.glob(os.path.join(path, "*.pem")) +
+                            glob.glob(os.path.join(path, "*.der")))
+        else:
+            files.append(path)
+
+    anchors = []
+    seen = set()
+    for path in files:
+        for der in load_der(path):
+            try:
+                dn, flags, key = parse_certificate(der)
+            except (ValueError, IndexError) as e:
+                sys.stderr.write("%s: skipped, %s\n" % (path, e))
+                continue
+            if key[0] not in keep:
+                continue
+            ident = (dn, key)
+            if ident in seen:
+                continue
+            seen.add(ident)
+            anchors.append((dn, flags, key))
+
+    if not args.keep_order:
+        anchors.sort(key=lambda a: dn_hash(a[0]))
+
+    header = emit_header(anchors, args.index)
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(header)
+    else:
+        sys.stdout.write(header)
+
+    if args.image:
+        with open(args.image, "wb") as f:
+            f.write(emit_image(anchors))
+
+    sys.stderr.write("%d trust anchors\n" % len(anchors))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef AEAD_PACKET_H
+#define AEAD_PACKET_H
+
+#include <Arduino.h>
+
+// One packet of a batch for AESGCMClass and ChaChaPolyClass, data is
+// encrypted or decrypted in place; nonce is 12 bytes, tag 16 bytes
+// (written when encrypting, checked when decrypting), valid is set to 1
+// once the packet is encrypted or authenticated
+struct AEADPacket {
+  const uint8_t *nonce;
+  const uint8_t *aad;
+  size_t aadLength;
+  uint8_t *data;
+  size_t length;
+  uint8_t *tag;
+  int valid;
+};
+
+#endif
@@ -25,30 +25,101 @@
 #include "AES128.h"
 
 AES128Class::AES128Class() :
-  EncryptionClass(AES128_BLOCK_SIZE, AES128_DIGEST_SIZE)
+  EncryptionClass(AES128_BLOCK_SIZE, AES128_DIGEST_SIZE),
+  cbcenc_impl(&br_aes_ct_cbcenc_vtable),
+  cbcdec_impl(&br_aes_ct_cbcdec_vtable),
+  keyed(0)
 {
+  // AES-NI on x86 hosts, the ARMv8 AES opcodes on AArch64, or the AES
+  // peripheral when enabled with BR_AES_HW
+  if (br_aes_x86ni_cbcenc_get_vtable() != NULL) {
+    cbcenc_impl = br_aes_x86ni_cbcenc_get_vtable();
+  }
+
+  if (br_aes_x86ni_cbcdec_get_vtable() != NULL) {
+    cbcdec_impl = br_aes_x86ni_cbcdec_get_vtable();
+  }
+
+  if (br_aes_armv8_cbcenc_get_vtable() != NULL) {
+    cbcenc_impl = br_aes_armv8_cbcenc_get_vtable();
+  }
+
+  if (br_aes_armv8_cbcdec_get_vtable() != NULL) {
+    cbcdec_impl = br_aes_armv8_cbcdec_get_vtable();
+  }
+
+  if (br_aes_hw_cbcenc_get_vtable() != NULL) {
+    cbcenc_impl = br_aes_hw_cbcenc_get_vtable();
+  }
+
+  if (br_aes_hw_cbcdec_get_vtable() != NULL) {
+    cbcdec_impl = br_aes_hw_cbcdec_get_vtable();
+  }
 }
 
 AES128Class::~AES128Class()
 {
 }
 
+void AES128Class::setImplementation(const br_block_cbcenc_class *enc, const br_block_cbcdec_class *dec)
+{
+  cbcenc_impl = enc;
+  cbcdec_impl = dec;
+  keyed = 0;
+}
+
+int AES128Class::setKey(const uint8_t *key, size_t size)
+{
+  keyed = 0;
+
+  if (size != 16 && size != 24 && size != 32) {
+    return 0;
+  }
+
+  cbcenc_impl->init(&cbcenc_ctx.vtable, key, size);
+  cbcdec_impl->init(&cbcdec_ctx.vtable, key, size);
+  keyed = 1;
+
+  return 1;
+}
+
+int AES128Class::encrypt(uint8_t *input, size_t block_size, uint8_t *iv)
+{
+  if (!keyed || block_size % AES128_BLOCK_SIZE != 0) {
+    return 0;
+  }
+
+  cbcenc_ctx.vtable->run(&cbcenc_ctx.vtable, iv, input, block_size);
+
+  return 1;
+}
+
+int AES128Class::decrypt(uint8_t *input, size_t block_size, uint8_t *iv)
+{
+  if (!keyed || block_size % AES128_BLOCK_SIZE != 0) {
+    return 0;
+  }
+
+  cbcdec_ctx.vtable->run(&cbcdec_ctx.vtable, iv, input, block_size);
+
+  return 1;
+}
+
 int AES128Class::runEncryption(uint8_t *key, size_t size, uint8_t *input, size_t block_size, uint8_t *iv)
 {
-  br_aes_ct_cbcenc_init(&cbcenc_ctx, key, size);
-  br_aes_ct_cbcenc_run(&cbcenc_ctx, iv, input, block_size); // block_size must be multiple of 16
+  // only the schedule this direction needs, the keyed one is dropped
+  keyed = 0;
+  cbcenc_impl->init(&cbcenc_ctx.vtable, key, size);
+  cbcenc_ctx.vtable->run(&cbcenc_ctx.vtable, iv, input, block_size); // block_size must be multiple of 16
 
   return 1;
 }
 
 int AES128Class::runDecryption(uint8_t *key, size_t size, uint8_t *input, size_t block_size, uint8_t *iv)
 {
-  br_aes_ct_cbcdec_init(&cbcdec_ctx, key, size);
-  br_aes_ct_cbcdec_run(&cbcdec_ctx, iv, input, block_size); // block_size must be multiple of 16
+  keyed = 0;
+  cbcdec_impl->init(&cbcdec_ctx.vtable, key, size);
+  cbcdec_ctx.vtable->run(&cbcdec_ctx.vtable, iv, input, block_size); // block_size must be multiple of 16
 
   return 1;
 }
-
-#ifndef ARDUINO_ARCH_MEGAAVR
-AES128Class AES128;
-#endif
\ No newline at end of file
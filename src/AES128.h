@@ -27,6 +27,7 @@
 
 #include <bearssl/bearssl_block.h>
 
+#include "BearSSLConfig.h"
 #include "Encryption.h"
 
 #define AES128_BLOCK_SIZE 16
@@ -38,15 +39,35 @@ public:
   AES128Class();
   virtual ~AES128Class();
 
+  // size is 16, 24 or 32 bytes, block_size a multiple of 16
+  virtual int setKey(const uint8_t *key, size_t size = AES128_BLOCK_SIZE);
+  virtual int encrypt(uint8_t *input, size_t block_size, uint8_t *iv);
+  virtual int decrypt(uint8_t *input, size_t block_size, uint8_t *iv);
+  using EncryptionClass::encrypt;
+  using EncryptionClass::decrypt;
+
+  // block cipher implementation, the constant-time br_aes_ct_* one by
+  // default (or AES-NI on x86 hosts, the ARMv8 AES opcodes on AArch64, or the
+  // AES peripheral, see BR_AES_HW in bearssl/config.h); ct64 suits 64-bit cores, small and big use lookup tables
+  // and trade side-channel resistance for speed, e.g.
+  // setImplementation(&br_aes_big_cbcenc_vtable, &br_aes_big_cbcdec_vtable),
+  // setKey() must be called again afterwards
+  void setImplementation(const br_block_cbcenc_class *enc, const br_block_cbcdec_class *dec);
+
 protected:
   virtual int runEncryption(uint8_t *key, size_t size, uint8_t *input, size_t block_size, uint8_t *iv);
   virtual int runDecryption(uint8_t *key, size_t size, uint8_t *input, size_t block_size, uint8_t *iv);
 
 private:
-  br_aes_ct_cbcenc_keys cbcenc_ctx;
-  br_aes_ct_cbcdec_keys cbcdec_ctx;
+  const br_block_cbcenc_class *cbcenc_impl;
+  const br_block_cbcdec_class *cbcdec_impl;
+  br_aes_gen_cbcenc_keys cbcenc_ctx;
+  br_aes_gen_cbcdec_keys cbcdec_ctx;
+  int keyed;
 };
 
+#if BEARSSL_ENABLE_CBC
 extern AES128Class AES128;
+#endif
 
 #endif
\ No newline at end of file
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "AESCCM.h"
+
+AESCCMClass::AESCCMClass() :
+  ctrcbc_impl(&br_aes_ct_ctrcbc_vtable),
+  keyed(0)
+{
+  // AES-NI on x86 hosts, the ARMv8 AES opcodes on AArch64
+  if (br_aes_x86ni_ctrcbc_get_vtable() != NULL) {
+    ctrcbc_impl = br_aes_x86ni_ctrcbc_get_vtable();
+  }
+
+  if (br_aes_armv8_ctrcbc_get_vtable() != NULL) {
+    ctrcbc_impl = br_aes_armv8_ctrcbc_get_vtable();
+  }
+}
+
+AESCCMClass::~AESCCMClass()
+{
+}
+
+void AESCCMClass::setImplementation(const br_block_ctrcbc_class *impl)
+{
+  ctrcbc_impl = impl;
+  keyed = 0;
+}
+
+int AESCCMClass::setKey(const uint8_t *key, size_t size)
+{
+  keyed = 0;
+
+  if (size != 16 && size != 24 && size != 32) {
+    return 0;
+  }
+
+  ctrcbc_impl->init(&ctrcbc_ctx.vtable, key, size);
+  br_ccm_init(&ccm_ctx, &ctrcbc_ctx.vtable);
+  keyed = 1;
+
+  return 1;
+}
+
+int AESCCMClass::encrypt(const uint8_t *nonce, size_t nonceLength, const uint8_t *aad, size_t aadLength, uint8_t *input, size_t length, uint8_t *tag, size_t tagLength)
+{
+  if (!run(1, nonce, nonceLength, aad, aadLength, input, length, tagLength)) {
+    return 0;
+  }
+
+  br_ccm_get_tag(&ccm_ctx, tag);
+
+  return 1;
+}
+
+int AESCCMClass::decrypt(const uint8_t *nonce, size_t nonceLength, const uint8_t *aad, size_t aadLength, uint8_t *input, size_t length, const uint8_t *tag, size_t tagLength)
+{
+  if (!run(0, nonce, nonceLength, aad, aadLength, input, length, tagLength)) {
+    return 0;
+  }
+
+  if (!br_ccm_check_tag(&ccm_ctx, tag)) {
+    memset(input, 0x00, length);
+    return 0;
+  }
+
+  return 1;
+}
+
+int AESCCMClass::run(int encrypt, const uint8_t *nonce, size_t nonceLength, const uint8_t *aad, size_t aadLength, uint8_t *input, size_t length, size_t tagLength)
+{
+  // CCM needs all lengths up front, and rejects invalid ones here
+  if (!keyed || !br_ccm_reset(&ccm_ctx, nonce, nonceLength, aadLength, length, tagLength)) {
+    return 0;
+  }
+
+  br_ccm_aad_inject(&ccm_ctx, aad, aadLength);
+  br_ccm_flip(&ccm_ctx);
+  br_ccm_run(&ccm_ctx, encrypt, input, length);
+
+  return 1;
+}
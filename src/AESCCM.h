@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef AESCCM_H
+#define AESCCM_H
+
+#include <Arduino.h>
+
+#include <bearssl/bearssl_block.h>
+#include <bearssl/bearssl_aead.h>
+
+#include "BearSSLConfig.h"
+
+#define AESCCM_BLOCK_SIZE 16
+#define AESCCM_NONCE_SIZE 13
+#define AESCCM_TAG_SIZE 16
+
+class AESCCMClass {
+
+public:
+  AESCCMClass();
+  virtual ~AESCCMClass();
+
+  // size is 16, 24 or 32 bytes, the key is reused by every call
+  int setKey(const uint8_t *key, size_t size = AESCCM_BLOCK_SIZE);
+
+  // block cipher implementation, see AES128Class::setImplementation(),
+  // e.g. &br_aes_big_ctrcbc_vtable
+  void setImplementation(const br_block_ctrcbc_class *impl);
+
+  // authenticated encryption in place, the nonce is 7 to 13 bytes and
+  // must never repeat for a key, tag gets tagLength bytes (4 to 16, even)
+  int encrypt(const uint8_t *nonce, size_t nonceLength, const uint8_t *aad, size_t aadLength, uint8_t *input, size_t length, uint8_t *tag, size_t tagLength = AESCCM_TAG_SIZE);
+
+  // 1 if the tag matches, otherwise input is cleared and 0 returned
+  int decrypt(const uint8_t *nonce, size_t nonceLength, const uint8_t *aad, size_t aadLength, uint8_t *input, size_t length, const uint8_t *tag, size_t tagLength = AESCCM_TAG_SIZE);
+
+private:
+  int run(int encrypt, const uint8_t *nonce, size_t nonceLength, const uint8_t *aad, size_t aadLength, uint8_t *input, size_t length, size_t tagLength);
+
+private:
+  const br_block_ctrcbc_class *ctrcbc_impl;
+  br_aes_gen_ctrcbc_keys ctrcbc_ctx;
+  br_ccm_context ccm_ctx;
+  int keyed;
+};
+
+#if BEARSSL_ENABLE_CCM
+extern AESCCMClass AESCCM;
+#endif
+
+#endif
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "AESCTR.h"
+
+AESCTRClass::AESCTRClass() :
+  ctr_impl(&br_aes_ct_ctr_vtable),
+  keyed(0),
+  keystream_used(AESCTR_GROUP_SIZE),
+  started(0)
+{
+  // AES-NI on x86 hosts, the ARMv8 AES opcodes on AArch64, or the AES
+  // peripheral when enabled with BR_AES_HW
+  if (br_aes_x86ni_ctr_get_vtable() != NULL) {
+    ctr_impl = br_aes_x86ni_ctr_get_vtable();
+  }
+
+  if (br_aes_armv8_ctr_get_vtable() != NULL) {
+    ctr_impl = br_aes_armv8_ctr_get_vtable();
+  }
+
+  if (br_aes_hw_ctr_get_vtable() != NULL) {
+    ctr_impl = br_aes_hw_ctr_get_vtable();
+  }
+}
+
+AESCTRClass::~AESCTRClass()
+{
+}
+
+void AESCTRClass::setImplementation(const br_block_ctr_class *impl)
+{
+  ctr_impl = impl;
+  keyed = 0;
+  started = 0;
+}
+
+int AESCTRClass::setKey(const uint8_t *key, size_t size)
+{
+  keyed = 0;
+  started = 0;
+
+  if (size != 16 && size != 24 && size != 32) {
+    return 0;
+  }
+
+  ctr_impl->init(&ctr_ctx.vtable, key, size);
+  keyed = 1;
+
+  return 1;
+}
+
+uint32_t AESCTRClass::run(const uint8_t *iv, uint32_t counter, uint8_t *input, size_t length)
+{
+  if (!keyed) {
+    return counter;
+  }
+
+  return ctr_ctx.vtable->run(&ctr_ctx.vtable, iv, counter, input, length);
+}
+
+int AESCTRClass::begin(const uint8_t *iv, uint32_t counter)
+{
+  if (!keyed) {
+    return 0;
+  }
+
+  memcpy(stream_iv, iv, AESCTR_IV_SIZE);
+  stream_counter = counter;
+  keystream_used = AESCTR_GROUP_SIZE;
+  started = 1;
+
+  return 1;
+}
+
+int AESCTRClass::update(uint8_t *input, size_t length)
+{
+  if (!started) {
+    return 0;
+  }
+
+  while (length > 0 && keystream_used < AESCTR_GROUP_SIZE) {
+    *input++ ^= keystream[keystream_used++];
+    length--;
+  }
+
+  size_t n = length - length % AESCTR_GROUP_SIZE;
+
+  if (n > 0) {
+    stream_counter = run(stream_iv, stream_counter, input, n);
+    input += n;
+    length -= n;
+  }
+
+  if (length > 0) {
+    memset(keystream, 0x00, AESCTR_GROUP_SIZE);
+    stream_counter = run(stream_iv, stream_counter, keystream, AESCTR_GROUP_SIZE);
+    keystream_used = 0;
+
+    while (length > 0) {
+      *input++ ^= keystream[keystream_used++];
+      length--;
+    }
+  }
+
+  return 1;
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef AESCTR_H
+#define AESCTR_H
+
+#include <Arduino.h>
+
+#include <bearssl/bearssl_block.h>
+
+#define AESCTR_BLOCK_SIZE 16
+#define AESCTR_IV_SIZE 12
+
+// keystream generated per group, a multiple of the blocks the bitsliced
+// implementations encrypt at once (2 for ct, 4 for ct64)
+#define AESCTR_GROUP_SIZE (4 * AESCTR_BLOCK_SIZE)
+
+class AESCTRClass {
+
+public:
+  AESCTRClass();
+  virtual ~AESCTRClass();
+
+  // size is 16, 24 or 32 bytes
+  int setKey(const uint8_t *key, size_t size = AESCTR_BLOCK_SIZE);
+
+  // block cipher implementation, see AES128Class::setImplementation(),
+  // e.g. &br_aes_big_ctr_vtable
+  void setImplementation(const br_block_ctr_class *impl);
+
+  // encrypts or decrypts in place, the counter block is the 12 byte iv
+  // followed by counter (big-endian); returns the counter following
+  // the data, so that a stream can be continued as long as all but the
+  // last length are multiples of 16
+  uint32_t run(const uint8_t *iv, uint32_t counter, uint8_t *input, size_t length);
+
+  // streaming variant of run() for chunks of any length: whole groups
+  // go straight to the implementation, the rest uses saved keystream
+  int begin(const uint8_t *iv, uint32_t counter);
+  int update(uint8_t *input, size_t length);
+
+private:
+  const br_block_ctr_class *ctr_impl;
+  br_aes_gen_ctr_keys ctr_ctx;
+  int keyed;
+
+  uint8_t stream_iv[AESCTR_IV_SIZE];
+  uint32_t stream_counter;
+  uint8_t keystream[AESCTR_GROUP_SIZE];
+  size_t keystream_used;
+  int started;
+};
+
+extern AESCTRClass AESCTR;
+
+#endif
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "AESCTRStream.h"
+
+AESCTRStream::AESCTRStream() :
+  _counter(0),
+  _source(NULL),
+  _arg(NULL),
+  _size(0),
+  _position(0),
+  _next(0),
+  _bufferStart(0)
+{
+}
+
+AESCTRStream::~AESCTRStream()
+{
+  memset(_buffer, 0x00, sizeof(_buffer));
+}
+
+int AESCTRStream::begin(const uint8_t *key, size_t keySize, const uint8_t *iv, uint32_t counter,
+                        AESCTRStreamSource source, void *arg, uint32_t size)
+{
+  _source = NULL;
+
+  if (source == NULL || !_ctr.setKey(key, keySize)) {
+    return 0;
+  }
+
+  memcpy(_iv, iv, AESCTR_IV_SIZE);
+  _counter = counter;
+  _source = source;
+  _arg = arg;
+  _size = size;
+  restart(0);
+
+  return 1;
+}
+
+void AESCTRStream::setImplementation(const br_block_ctr_class *impl)
+{
+  _ctr.setImplementation(impl);
+  _source = NULL;
+}
+
+int AESCTRStream::seek(uint32_t position)
+{
+  if (_source == NULL || position > _size) {
+    return 0;
+  }
+
+  // still within the buffered block
+  if (position >= _bufferStart && position <= _next) {
+    _position = position;
+    return 1;
+  }
+
+  restart(position);
+
+  return 1;
+}
+
+uint32_t AESCTRStream::position()
+{
+  return _position;
+}
+
+uint32_t AESCTRStream::size()
+{
+  return _size;
+}
+
+int AESCTRStream::read(uint8_t *buffer, size_t length)
+{
+  size_t total = 0;
+
+  if (_source == NULL) {
+    return -1;
+  }
+
+  // the rest of the buffered block first
+  if (_position < _next) {
+    size_t n = _next - _position;
+
+    if (n > length) {
+      n = length;
+    }
+
+    memcpy(buffer, _buffer + (_position - _bufferStart), n);
+    _position += n;
+    buffer += n;
+    length -= n;
+    total += n;
+  }
+
+  if (length > _size - _next) {
+    length = _size - _next;
+  }
+
+  if (length > 0) {
+    // decrypted in place, the keystream is already at _next
+    size_t n = _source(_next, buffer, length, _arg);
+
+    _ctr.update(buffer, n);
+    _next += n;
+    _position = _next;
+    _bufferStart = _next;
+    total += n;
+  }
+
+  return total ? (int)total : -1;
+}
+
+int AESCTRStream::available()
+{
+  return _size - _position;
+}
+
+int AESCTRStream::read()
+{
+  if (!fill()) {
+    return -1;
+  }
+
+  return _buffer[_position++ - _bufferStart];
+}
+
+int AESCTRStream::peek()
+{
+  if (!fill()) {
+    return -1;
+  }
+
+  return _buffer[_position - _bufferStart];
+}
+
+size_t AESCTRStream::write(uint8_t)
+{
+  // read-only
+  return 0;
+}
+
+void AESCTRStream::flush()
+{
+}
+
+int AESCTRStream::fill()
+{
+  if (_source == NULL) {
+    return 0;
+  }
+
+  if (_position < _next) {
+    return 1;
+  }
+
+  size_t length = _size - _next;
+
+  if (length > sizeof(_buffer)) {
+    length = sizeof(_buffer);
+  }
+
+  if (length == 0) {
+    return 0;
+  }
+
+  size_t n = _source(_next, _buffer, length, _arg);
+
+  _ctr.update(_buffer, n);
+  _bufferStart = _next;
+  _next += n;
+
+  return (n != 0);
+}
+
+void AESCTRStream::restart(uint32_t position)
+{
+  uint8_t skip[AESCTR_BLOCK_SIZE] = { 0 };
+
+  // the keystream of the whole block is made, the part before position
+  // is thrown away
+  _ctr.begin(_iv, _counter + position / AESCTR_BLOCK_SIZE);
+  _ctr.update(skip, position % AESCTR_BLOCK_SIZE);
+
+  _position = position;
+  _next = position;
+  _bufferStart = position;
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef AESCTR_STREAM_H
+#define AESCTR_STREAM_H
+
+#include <Arduino.h>
+
+#include "AESCTR.h"
+
+// reads length bytes at offset of the encrypted data, returns how many
+// were read, e.g. from external QSPI or SPI flash
+typedef size_t (*AESCTRStreamSource)(uint32_t offset, uint8_t *buffer, size_t length, void *arg);
+
+// Stream over AES-CTR encrypted data that is decrypted as it is read, so
+// that a blob never has to be decrypted whole into RAM. CTR lets any
+// position be computed on its own: seek() costs at most one block of
+// keystream. Single byte reads and peek() go through a one block buffer.
+//
+// Counter block: the 12 byte iv followed by counter + offset / 16
+// (big-endian), as with AESCTRClass::run().
+class AESCTRStream : public Stream {
+
+public:
+  AESCTRStream();
+  virtual ~AESCTRStream();
+
+  // key is 16, 24 or 32 bytes, size the length of the encrypted data
+  int begin(const uint8_t *key, size_t keySize, const uint8_t *iv, uint32_t counter,
+            AESCTRStreamSource source, void *arg, uint32_t size);
+
+  // see AESCTRClass::setImplementation(), before begin()
+  void setImplementation(const br_block_ctr_class *impl);
+
+  int seek(uint32_t position);
+  uint32_t position();
+  uint32_t size();
+
+  // plaintext, -1 or 0 at the end or if the source fails
+  int read(uint8_t *buffer, size_t length);
+
+  // Stream
+  virtual int available();
+  virtual int read();
+  virtual int peek();
+  virtual size_t write(uint8_t);
+  virtual void flush();
+  using Print::write;
+
+private:
+  int fill();
+  void restart(uint32_t position);
+
+  AESCTRClass _ctr;
+  uint8_t _iv[AESCTR_IV_SIZE];
+  uint32_t _counter;
+  AESCTRStreamSource _source;
+  void *_arg;
+  uint32_t _size;
+
+  uint32_t _position; // next byte returned
+  uint32_t _next;     // next byte of the source and of the keystream
+  uint32_t _bufferStart;
+  uint8_t _buffer[AESCTR_BLOCK_SIZE];
+};
+
+#endif
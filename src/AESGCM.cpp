@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "AESGCM.h"
+
+// as for TLS records: Cortex-M0/M0+ only have 32x32->32 multiplications
+#if defined(__ARM_ARCH_6M__)
+#define AESGCM_GHASH br_ghash_ctmul32
+#else
+#define AESGCM_GHASH br_ghash_ctmul
+#endif
+
+AESGCMClass::AESGCMClass() :
+  ctr_impl(&br_aes_ct_ctr_vtable),
+  keyed(0)
+{
+  // AES-NI on x86 hosts, the ARMv8 AES opcodes on AArch64, or the AES
+  // peripheral when enabled with BR_AES_HW
+  if (br_aes_x86ni_ctr_get_vtable() != NULL) {
+    ctr_impl = br_aes_x86ni_ctr_get_vtable();
+  }
+
+  if (br_aes_armv8_ctr_get_vtable() != NULL) {
+    ctr_impl = br_aes_armv8_ctr_get_vtable();
+  }
+
+  if (br_aes_hw_ctr_get_vtable() != NULL) {
+    ctr_impl = br_aes_hw_ctr_get_vtable();
+  }
+}
+
+AESGCMClass::~AESGCMClass()
+{
+}
+
+void AESGCMClass::setImplementation(const br_block_ctr_class *impl)
+{
+  ctr_impl = impl;
+  keyed = 0;
+}
+
+int AESGCMClass::setKey(const uint8_t *key, size_t size)
+{
+  keyed = 0;
+
+  if (size != 16 && size != 24 && size != 32) {
+    return 0;
+  }
+
+  // carry-less multiply opcodes on x86 hosts and AArch64
+  br_ghash ghash = br_ghash_pclmul_get();
+  if (ghash == 0) {
+    ghash = br_ghash_pmull_get();
+  }
+  if (ghash == 0) {
+    ghash = AESGCM_GHASH;
+  }
+
+  ctr_impl->init(&ctr_ctx.vtable, key, size);
+  br_gcm_init(&gcm_ctx, &ctr_ctx.vtable, ghash);
+  keyed = 1;
+
+  return 1;
+}
+
+int AESGCMClass::encrypt(const uint8_t *iv, size_t ivLength, const uint8_t *aad, size_t aadLength, uint8_t *input, size_t length, uint8_t *tag, size_t tagLength)
+{
+  if (!run(1, iv, ivLength, aad, aadLength, input, length, tagLength)) {
+    return 0;
+  }
+
+  br_gcm_get_tag_trunc(&gcm_ctx, tag, tagLength);
+
+  return 1;
+}
+
+int AESGCMClass::decrypt(const uint8_t *iv, size_t ivLength, const uint8_t *aad, size_t aadLength, uint8_t *input, size_t length, const uint8_t *tag, size_t tagLength)
+{
+  if (!run(0, iv, ivLength, aad, aadLength, input, length, tagLength)) {
+    return 0;
+  }
+
+  if (!br_gcm_check_tag_trunc(&gcm_ctx, tag, tagLength)) {
+    memset(input, 0x00, length);
+    return 0;
+  }
+
+  return 1;
+}
+
+int AESGCMClass::encrypt(AEADPacket *packets, size_t count, size_t tagLength)
+{
+  return runBatch(1, packets, count, tagLength);
+}
+
+int AESGCMClass::decrypt(AEADPacket *packets, size_t count, size_t tagLength)
+{
+  return runBatch(0, packets, count, tagLength);
+}
+
+int AESGCMClass::runBatch(int encrypt, AEADPacket *packets, size_t count, size_t tagLength)
+{
+  if (!keyed || tagLength == 0 || tagLength > AESGCM_TAG_SIZE) {
+    return 0;
+  }
+
+  int validCount = 0;
+
+  for (size_t i = 0; i < count; i++) {
+    AEADPacket *p = &packets[i];
+    uint8_t y[AESGCM_BLOCK_SIZE] = { 0 };
+    uint8_t lengths[AESGCM_BLOCK_SIZE];
+    uint8_t block[AESGCM_BLOCK_SIZE + AESGCM_BATCH_MERGE_SIZE];
+    size_t head = p->length < AESGCM_BATCH_MERGE_SIZE ? p->length : AESGCM_BATCH_MERGE_SIZE;
+    uint64_t aadBits = (uint64_t)p->aadLength << 3;
+    uint64_t dataBits = (uint64_t)p->length << 3;
+
+    p->valid = 0;
+
+    gcm_ctx.gh(y, gcm_ctx.h, p->aad, p->aadLength);
+
+    if (!encrypt) {
+      gcm_ctx.gh(y, gcm_ctx.h, p->data, p->length);
+    }
+
+    // counter 1 is E(J0) for the tag, the data starts at counter 2
+    memset(block, 0x00, AESGCM_BLOCK_SIZE);
+    memcpy(block + AESGCM_BLOCK_SIZE, p->data, head);
+    ctr_ctx.vtable->run(&ctr_ctx.vtable, p->nonce, 1, block, AESGCM_BLOCK_SIZE + head);
+    memcpy(p->data, block + AESGCM_BLOCK_SIZE, head);
+
+    if (p->length > head) {
+      ctr_ctx.vtable->run(&ctr_ctx.vtable, p->nonce, 2 + head / AESGCM_BLOCK_SIZE, p->data + head, p->length - head);
+    }
+
+    if (encrypt) {
+      gcm_ctx.gh(y, gcm_ctx.h, p->data, p->length);
+    }
+
+    for (int j = 0; j < 8; j++) {
+      lengths[j] = aadBits >> (56 - 8 * j);
+      lengths[8 + j] = dataBits >> (56 - 8 * j);
+    }
+    gcm_ctx.gh(y, gcm_ctx.h, lengths, sizeof(lengths));
+
+    if (encrypt) {
+      for (size_t j = 0; j < tagLength; j++) {
+        p->tag[j] = y[j] ^ block[j];
+      }
+      p->valid = 1;
+    } else {
+      uint8_t diff = 0;
+
+      for (size_t j = 0; j < tagLength; j++) {
+        diff |= p->tag[j] ^ y[j] ^ block[j];
+      }
+
+      if (diff != 0) {
+        memset(p->data, 0x00, p->length);
+        continue;
+      }
+      p->valid = 1;
+    }
+
+    validCount++;
+  }
+
+  return validCount;
+}
+
+int AESGCMClass::run(int encrypt, const uint8_t *iv, size_t ivLength, const uint8_t *aad, size_t aadLength, uint8_t *input, size_t length, size_t tagLength)
+{
+  if (!keyed || ivLength == 0 || tagLength == 0 || tagLength > AESGCM_TAG_SIZE) {
+    return 0;
+  }
+
+  br_gcm_reset(&gcm_ctx, iv, ivLength);
+  br_gcm_aad_inject(&gcm_ctx, aad, aadLength);
+  br_gcm_flip(&gcm_ctx);
+  br_gcm_run(&gcm_ctx, encrypt, input, length);
+
+  return 1;
+}
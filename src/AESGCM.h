@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef AESGCM_H
+#define AESGCM_H
+
+#include <Arduino.h>
+
+#include <bearssl/bearssl_block.h>
+#include <bearssl/bearssl_aead.h>
+
+#include "BearSSLConfig.h"
+#include "AEADPacket.h"
+
+#define AESGCM_BLOCK_SIZE 16
+#define AESGCM_IV_SIZE 12
+#define AESGCM_TAG_SIZE 16
+
+// packets up to this length get their data and tag mask (E(J0)) from a
+// single CTR call in a batch, so short packets keep the AES core busy;
+// must be a multiple of 16
+#ifndef AESGCM_BATCH_MERGE_SIZE
+#define AESGCM_BATCH_MERGE_SIZE 48
+#endif
+
+class AESGCMClass {
+
+public:
+  AESGCMClass();
+  virtual ~AESGCMClass();
+
+  // size is 16, 24 or 32 bytes, the key is reused by every call
+  int setKey(const uint8_t *key, size_t size = AESGCM_BLOCK_SIZE);
+
+  // block cipher implementation, see AES128Class::setImplementation(),
+  // e.g. &br_aes_big_ctr_vtable
+  void setImplementation(const br_block_ctr_class *impl);
+
+  // authenticated encryption in place, iv is normally 12 bytes and
+  // must never repeat for a key, tag gets tagLength bytes
+  int encrypt(const uint8_t *iv, size_t ivLength, const uint8_t *aad, size_t aadLength, uint8_t *input, size_t length, uint8_t *tag, size_t tagLength = AESGCM_TAG_SIZE);
+
+  // 1 if the tag matches, otherwise input is cleared and 0 returned
+  int decrypt(const uint8_t *iv, size_t ivLength, const uint8_t *aad, size_t aadLength, uint8_t *input, size_t length, const uint8_t *tag, size_t tagLength = AESGCM_TAG_SIZE);
+
+  // batches of packets with 12-byte nonces, skipping the per-call GCM
+  // setup; both return the number of valid packets, decrypt() clears the
+  // data of packets whose tag does not match
+  int encrypt(AEADPacket *packets, size_t count, size_t tagLength = AESGCM_TAG_SIZE);
+  int decrypt(AEADPacket *packets, size_t count, size_t tagLength = AESGCM_TAG_SIZE);
+
+private:
+  int runBatch(int encrypt, AEADPacket *packets, size_t count, size_t tagLength);
+  int run(int encrypt, const uint8_t *iv, size_t ivLength, const uint8_t *aad, size_t aadLength, uint8_t *input, size_t length, size_t tagLength);
+
+private:
+  const br_block_ctr_class *ctr_impl;
+  br_aes_gen_ctr_keys ctr_ctx;
+  br_gcm_context gcm_ctx;
+  int keyed;
+};
+
+#if BEARSSL_ENABLE_GCM
+extern AESGCMClass AESGCM;
+#endif
+
+#endif
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "AESKeyWrap.h"
+
+static const uint8_t AESKEYWRAP_IV[8] = { 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6 };
+
+AESKeyWrapClass::AESKeyWrapClass() :
+  keyed(0)
+{
+}
+
+AESKeyWrapClass::~AESKeyWrapClass()
+{
+}
+
+int AESKeyWrapClass::setKey(const uint8_t *kek, size_t size)
+{
+  keyed = aes.setKey(kek, size);
+
+  return keyed;
+}
+
+void AESKeyWrapClass::setImplementation(const br_block_cbcenc_class *enc, const br_block_cbcdec_class *dec)
+{
+  aes.setImplementation(enc, dec);
+  keyed = 0;
+}
+
+int AESKeyWrapClass::wrap(const uint8_t *input, size_t length, uint8_t *output)
+{
+  if (!keyed || length < 16 || length % 8 != 0) {
+    return 0;
+  }
+
+  size_t n = length / 8;
+  uint8_t *r = output + 8;
+  uint8_t b[16];
+  uint32_t t = 1;
+
+  memmove(r, input, length);
+  memcpy(b, AESKEYWRAP_IV, 8);
+
+  // a single CBC block with a zero IV is the plain block cipher
+  for (int j = 0; j < 6; j++) {
+    for (size_t i = 0; i < n; i++, t++) {
+      uint8_t iv[AES128_BLOCK_SIZE] = { 0 };
+
+      memcpy(b + 8, r + 8 * i, 8);
+      aes.encrypt(b, sizeof(b), iv);
+      memcpy(r + 8 * i, b + 8, 8);
+
+      b[4] ^= t >> 24;
+      b[5] ^= t >> 16;
+      b[6] ^= t >> 8;
+      b[7] ^= t;
+    }
+  }
+
+  memcpy(output, b, 8);
+  memset(b, 0x00, sizeof(b));
+
+  return 1;
+}
+
+int AESKeyWrapClass::unwrap(const uint8_t *input, size_t length, uint8_t *output)
+{
+  if (!keyed || length < 24 || length % 8 != 0) {
+    return 0;
+  }
+
+  size_t n = length / 8 - 1;
+  uint8_t b[16];
+  uint32_t t = 6 * n;
+  uint8_t diff = 0;
+
+  memcpy(b, input, 8);
+  memmove(output, input + 8, length - 8);
+
+  for (int j = 0; j < 6; j++) {
+    for (size_t i = n; i-- > 0; t--) {
+      uint8_t iv[AES128_BLOCK_SIZE] = { 0 };
+
+      b[4] ^= t >> 24;
+      b[5] ^= t >> 16;
+      b[6] ^= t >> 8;
+      b[7] ^= t;
+
+      memcpy(b + 8, output + 8 * i, 8);
+      aes.decrypt(b, sizeof(b), iv);
+      memcpy(output + 8 * i, b + 8, 8);
+    }
+  }
+
+  for (int i = 0; i < 8; i++) {
+    diff |= b[i] ^ AESKEYWRAP_IV[i];
+  }
+  memset(b, 0x00, sizeof(b));
+
+  if (diff != 0) {
+    memset(output, 0x00, length - 8);
+    return 0;
+  }
+
+  return 1;
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef AES_KEY_WRAP_H
+#define AES_KEY_WRAP_H
+
+#include <Arduino.h>
+
+#include "AES128.h"
+
+// bytes wrap() adds to the key data
+#define AESKEYWRAP_OVERHEAD 8
+
+// RFC 3394 key wrap: protects keys at rest with a key-encryption key
+// (KEK) and detects a wrong KEK or a damaged record on unwrap, without
+// an IV to store:
+//
+//   AESKeyWrap.setKey(kek, 16);
+//   AESKeyWrap.wrap(key, 16, wrapped);            // 24 bytes
+//   AESKeyWrap.unwrap(wrapped, 24, key);          // 0 if tampered with
+class AESKeyWrapClass {
+
+public:
+  AESKeyWrapClass();
+  virtual ~AESKeyWrapClass();
+
+  // size is 16, 24 or 32 bytes
+  int setKey(const uint8_t *kek, size_t size = AES128_BLOCK_SIZE);
+
+  // block cipher implementation, see AES128Class::setImplementation()
+  void setImplementation(const br_block_cbcenc_class *enc, const br_block_cbcdec_class *dec);
+
+  // length is a multiple of 8 and at least 16, output holds length +
+  // AESKEYWRAP_OVERHEAD bytes and may be input itself
+  int wrap(const uint8_t *input, size_t length, uint8_t *output);
+
+  // length is a multiple of 8 and at least 24, output holds length -
+  // AESKEYWRAP_OVERHEAD bytes and may be input itself; returns 0 and
+  // clears output if the integrity check fails
+  int unwrap(const uint8_t *input, size_t length, uint8_t *output);
+
+private:
+  AES128Class aes;
+  int keyed;
+};
+
+extern AESKeyWrapClass AESKeyWrap;
+
+#endif
@@ -24,9 +24,74 @@
 
 #include "ArduinoBearSSL.h"
 
+#ifndef ARDUINO_DISABLE_ECCX08
+#include <ArduinoECCX08.h>
+#endif
+
+#ifdef BEAR_SSL_CRYPTO_STATS
+#define CRYPTO_OPERATIONS 7
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+#define DEMCR      (*(volatile uint32_t*)0xE000EDFC)
+#define DWT_CTRL   (*(volatile uint32_t*)0xE0001000)
+#define DWT_CYCCNT (*(volatile uint32_t*)0xE0001004)
+#define DWT_LAR    (*(volatile uint32_t*)0xE0001FB0)
+#endif
+
+static BearSSLCryptoStats cryptoCounters[CRYPTO_OPERATIONS];
+static uint32_t cryptoStart;
+
+static uint32_t cycleCount()
+{
+#ifdef DWT_CYCCNT
+  // started on first use, the Cortex-M7 wants its lock register unlocked
+  if (!(DWT_CTRL & 1)) {
+    DEMCR |= (1UL << 24);
+    DWT_LAR = 0xC5ACCE55;
+    DWT_CYCCNT = 0;
+    DWT_CTRL |= 1;
+  }
+
+  return DWT_CYCCNT;
+#elif defined(F_CPU)
+  return micros() * (F_CPU / 1000000);
+#else
+  return micros();
+#endif
+}
+
+// hooks of the record layer and the X.509 engine, see bearssl/inner.h
+extern "C" void br_crypto_stat_begin(void)
+{
+  cryptoStart = cycleCount();
+}
+
+extern "C" void br_crypto_stat_end(int op, size_t len)
+{
+  BearSSLCryptoStats& counter = cryptoCounters[op];
+
+  counter.count++;
+  counter.bytes += len;
+  counter.cycles += (uint32_t)(cycleCount() - cryptoStart);
+}
+#endif
+
 ArduinoBearSSLClass::ArduinoBearSSLClass() :
-  _onGetTimeCallback(NULL)
+  _onGetTimeCallback(NULL),
+  _timeRefresh(0),
+  _syncTime(0),
+  _syncMillis(0),
+  _entropyLength(0),
+  _drbgState(DrbgState::Unseeded)
 {
+#ifndef ARDUINO_DISABLE_ECCX08
+  _secureElement = &ECCX08SecureElement;
+  _eccX08State = EccX08State::Unknown;
+  _eccX08Begun = false;
+  _eccX08Power = EccX08Power::Idle;
+#else
+  _secureElement = NULL;
+#endif
 }
 
 ArduinoBearSSLClass::~ArduinoBearSSLClass()
@@ -35,16 +100,199 @@ ArduinoBearSSLClass::~ArduinoBearSSLClass()
 
 unsigned long ArduinoBearSSLClass::getTime()
 {
-  if (_onGetTimeCallback) {
+  if (_timeRefresh == 0 && _onGetTimeCallback) {
     return _onGetTimeCallback();
   }
 
-  return 0;
+  unsigned long elapsed = millis() - _syncMillis;
+
+  if ((_syncTime == 0 || elapsed >= _timeRefresh) && _onGetTimeCallback) {
+    unsigned long now = _onGetTimeCallback();
+
+    // a failed query keeps the previous time running
+    if (now != 0) {
+      setTime(now);
+      return now;
+    }
+  }
+
+  if (_syncTime == 0) {
+    return 0;
+  }
+
+  return _syncTime + elapsed / 1000;
 }
 
 void ArduinoBearSSLClass::onGetTime(unsigned long(*callback)(void))
 {
   _onGetTimeCallback = callback;
+  _syncTime = 0;
+}
+
+void ArduinoBearSSLClass::setTimeCache(unsigned long refresh)
+{
+  _timeRefresh = refresh;
+}
+
+void ArduinoBearSSLClass::setTime(unsigned long time)
+{
+  _syncTime = time;
+  _syncMillis = millis();
+}
+
+void ArduinoBearSSLClass::setSecureElement(SecureElement* element)
+{
+  _secureElement = element;
+}
+
+SecureElement* ArduinoBearSSLClass::secureElement()
+{
+  return _secureElement;
+}
+
+int ArduinoBearSSLClass::fillEntropy(size_t length)
+{
+  size_t space = sizeof(_entropyPool) - _entropyLength;
+
+  if (length > space) {
+    length = space;
+  }
+
+  if (length) {
+    if (_secureElement == NULL || !_secureElement->ready() ||
+        !_secureElement->random(&_entropyPool[_entropyLength], length)) {
+      return 0;
+    }
+
+    _entropyLength += length;
+  }
+
+  return (_entropyLength == sizeof(_entropyPool));
+}
+
+size_t ArduinoBearSSLClass::entropyAvailable()
+{
+  return _entropyLength;
+}
+
+int ArduinoBearSSLClass::getEntropy(uint8_t data[], size_t length)
+{
+  if (length <= _entropyLength) {
+    // bytes are handed out once
+    _entropyLength -= length;
+    memcpy(data, &_entropyPool[_entropyLength], length);
+    memset(&_entropyPool[_entropyLength], 0x00, length);
+
+    return 1;
+  }
+
+  if (_secureElement == NULL || !_secureElement->ready()) {
+    return 0;
+  }
+
+  return _secureElement->random(data, length);
+}
+
+int ArduinoBearSSLClass::getRandom(uint8_t data[], size_t length)
+{
+  uint8_t seed[32];
+
+  if (_drbgState != DrbgState::Seeded) {
+    br_prng_seeder seeder = br_prng_seeder_system(NULL);
+
+    // the random generator of the board first (BR_RAND_HW), it does not
+    // wait for a bus; the secure element is mixed in later from the pool
+    if (seeder != 0) {
+      br_hmac_drbg_init(&_drbg, &br_sha256_vtable, NULL, 0);
+
+      if (seeder(&_drbg.vtable)) {
+        _drbgState = DrbgState::Seeded;
+      }
+    }
+
+    if (_drbgState != DrbgState::Seeded && getEntropy(seed, sizeof(seed))) {
+      br_hmac_drbg_init(&_drbg, &br_sha256_vtable, seed, sizeof(seed));
+      _drbgState = DrbgState::Seeded;
+    }
+
+    if (_drbgState != DrbgState::Seeded) {
+      // no real source, pseudo random until there is one
+      for (size_t i = 0; i < sizeof(seed); i++) {
+        seed[i] = random(0, 256);
+      }
+
+      unsigned long now = micros();
+
+      if (_drbgState == DrbgState::Unseeded) {
+        br_hmac_drbg_init(&_drbg, &br_sha256_vtable, seed, sizeof(seed));
+        _drbgState = DrbgState::Weak;
+      } else {
+        br_hmac_drbg_update(&_drbg, seed, sizeof(seed));
+      }
+      br_hmac_drbg_update(&_drbg, &now, sizeof(now));
+    }
+  } else if (_entropyLength >= sizeof(seed)) {
+    // fresh entropy that is already there costs no round trip
+    getEntropy(seed, sizeof(seed));
+    br_hmac_drbg_update(&_drbg, seed, sizeof(seed));
+  }
+
+  memset(seed, 0x00, sizeof(seed));
+  br_hmac_drbg_generate(&_drbg, data, length);
+
+  return (_drbgState == DrbgState::Seeded);
+}
+
+#ifndef ARDUINO_DISABLE_ECCX08
+bool ArduinoBearSSLClass::eccX08Ready()
+{
+  if (_eccX08State == EccX08State::Unknown) {
+    if (!ECCX08.begin()) {
+      _eccX08State = EccX08State::Missing;
+    } else {
+      _eccX08State = ECCX08.locked() ? EccX08State::Ready : EccX08State::Unlocked;
+      _eccX08Begun = true;
+    }
+  } else if (_eccX08State == EccX08State::Ready && !_eccX08Begun) {
+    // released with EccX08Power::End, only the bus needs setting up
+    if (!ECCX08.begin()) {
+      return false;
+    }
+    _eccX08Begun = true;
+  }
+
+  return (_eccX08State == EccX08State::Ready);
+}
+
+void ArduinoBearSSLClass::resetEccX08()
+{
+  _eccX08State = EccX08State::Unknown;
+}
+
+void ArduinoBearSSLClass::eccX08Release()
+{
+  if (_eccX08Power == EccX08Power::End && _eccX08Begun) {
+    ECCX08.end();
+    _eccX08Begun = false;
+  }
+}
+
+void ArduinoBearSSLClass::setEccX08Power(EccX08Power power)
+{
+  _eccX08Power = power;
+}
+#endif
+
+#ifdef BEAR_SSL_CRYPTO_STATS
+void ArduinoBearSSLClass::cryptoStats(CryptoOperation operation, BearSSLCryptoStats& stats)
+{
+  stats = cryptoCounters[(int)operation];
+}
+
+void ArduinoBearSSLClass::resetCryptoStats()
+{
+  memset(cryptoCounters, 0x00, sizeof(cryptoCounters));
 }
+#endif
 
 ArduinoBearSSLClass ArduinoBearSSL;
@@ -25,14 +25,35 @@
 #ifndef _ARDUINO_BEAR_SSL_H_
 #define _ARDUINO_BEAR_SSL_H_
 
-#if defined __has_include
-#  if __has_include (<ArduinoBearSSLConfig.h>)
-#    include <ArduinoBearSSLConfig.h>
-#  endif
-#endif
+#include "BearSSLConfig.h"
 
 #include "BearSSLClient.h"
+#include "BearSSLClientPool.h"
+#include "BearSSLConnectionSet.h"
+#include "BearSSLCoroutine.h"
+#include "BearSSLPskClient.h"
+#include "BearSSLReconnectPolicy.h"
+#include "BearSSLServer.h"
 #include "SHA1.h"
+#include "SecureElement.h"
+
+// bytes of entropy kept ahead of the connections, 32 per connection
+#ifndef BEAR_SSL_ENTROPY_POOL_SIZE
+#define BEAR_SSL_ENTROPY_POOL_SIZE 64
+#endif
+
+// setTimeCache() default, milliseconds between two onGetTime() calls
+#ifndef BEAR_SSL_TIME_REFRESH
+#define BEAR_SSL_TIME_REFRESH 86400000UL
+#endif
+
+#ifdef BEAR_SSL_CRYPTO_STATS
+struct BearSSLCryptoStats {
+  uint32_t count;  // operations, i.e. records or signatures
+  uint64_t bytes;  // protected bytes, signature bytes for X509Verify
+  uint64_t cycles; // CPU cycles spent in them
+};
+#endif
 
 class ArduinoBearSSLClass {
 public:
@@ -42,8 +63,105 @@ public:
   unsigned long getTime();
   void onGetTime(unsigned long(*)(void));
 
+  // keep the answer of the onGetTime() callback (the WiFi module, NTP,
+  // ...): getTime() then adds the millis() elapsed since, and only asks
+  // the callback again once refresh milliseconds have passed (below 49
+  // days, when millis() wraps) or while it answers 0. refresh 0 disables
+  // the cache, the default. setTime() hands over a time known otherwise
+  // (GPS, a server's Date header), kept until the callback is asked again.
+  void setTimeCache(unsigned long refresh = BEAR_SSL_TIME_REFRESH);
+  void setTime(unsigned long time);
+
+  // element for setEccSlot() signatures, ECDSA verification, ECDH and
+  // entropy: the ECCX08 unless ARDUINO_DISABLE_ECCX08 is set, NULL
+  // keeps everything in software
+  void setSecureElement(SecureElement* element);
+  SecureElement* secureElement();
+
+  // fill the entropy pool with up to length bytes from the secure
+  // element, e.g. at boot; BearSSLClient tops it up while it waits for
+  // the server, so that connections are seeded without a round trip to
+  // the element. Returns 1 once the pool is full
+  int fillEntropy(size_t length = BEAR_SSL_ENTROPY_POOL_SIZE);
+  size_t entropyAvailable();
+  // length bytes from the pool, or from the element when the pool runs
+  // short; 0 if there is no secure element
+  int getEntropy(uint8_t data[], size_t length);
+
+  // length bytes from a process-wide HMAC-DRBG that is seeded once, from
+  // the system seeder (the generator of the board) or the secure element,
+  // and then forked into each connection's engine; bytes left in the
+  // entropy pool are mixed in as they come. Returns 0 while no such source
+  // was found: the DRBG then runs on a weak seed from random() and
+  // micros(), and seeding is tried again on the next call
+  int getRandom(uint8_t data[], size_t length);
+
+#ifndef ARDUINO_DISABLE_ECCX08
+  enum class EccX08Power {
+    Idle, // keep the I2C bus set up between connections (default)
+    End   // ECCX08.end() after each handshake, e.g. to power the bus down
+  };
+
+  // true if an ECCX08 is present and locked. The first call probes it
+  // with ECCX08.begin() and locked(), the answer is kept until
+  // resetEccX08(), e.g. after the chip was provisioned
+  bool eccX08Ready();
+  void resetEccX08();
+
+  // called by BearSSLClient once a handshake is over
+  void eccX08Release();
+  void setEccX08Power(EccX08Power power);
+#endif
+
+#ifdef BEAR_SSL_CRYPTO_STATS
+  enum class CryptoOperation {
+    GcmEncrypt,
+    GcmDecrypt,
+    ChaChaPolyEncrypt,
+    ChaChaPolyDecrypt,
+    CbcEncrypt,
+    CbcDecrypt,
+    X509Verify // certificate signatures
+  };
+
+  // profiling counters of the record protection and certificate checks of
+  // all connections since boot or resetCryptoStats(). Cycles come from the
+  // DWT cycle counter on Cortex-M3/M4/M7 and are derived from micros()
+  // elsewhere, so they include interrupts taken meanwhile
+  void cryptoStats(CryptoOperation operation, BearSSLCryptoStats& stats);
+  void resetCryptoStats();
+#endif
+
 private:
   unsigned long (*_onGetTimeCallback)(void);
+  unsigned long _timeRefresh;
+  unsigned long _syncTime;   // 0 until synced
+  unsigned long _syncMillis;
+  SecureElement* _secureElement;
+  uint8_t _entropyPool[BEAR_SSL_ENTROPY_POOL_SIZE];
+  size_t _entropyLength;
+
+  enum class DrbgState {
+    Unseeded,
+    Weak,
+    Seeded
+  };
+
+  br_hmac_drbg_context _drbg;
+  DrbgState _drbgState;
+
+#ifndef ARDUINO_DISABLE_ECCX08
+  enum class EccX08State {
+    Unknown,
+    Missing,
+    Unlocked,
+    Ready
+  };
+
+  EccX08State _eccX08State;
+  bool _eccX08Begun;
+  EccX08Power _eccX08Power;
+#endif
 };
 
 extern ArduinoBearSSLClass ArduinoBearSSL;
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "BearSSLBufferPool.h"
+
+BearSSLBufferPool::BearSSLBufferPool(void* arena, size_t size, size_t ibufSize, size_t obufSize) :
+  _arena((unsigned char*)BEAR_SSL_BUFFER_ROUND((uintptr_t)arena)),
+  _ibufSize(ibufSize),
+  _obufSize(obufSize),
+  _stride(BEAR_SSL_BUFFER_ROUND(ibufSize) + BEAR_SSL_BUFFER_ROUND(obufSize)),
+  _slots(0),
+  _used(0)
+{
+  size_t padding = _arena - (unsigned char*)arena;
+
+  if (ibufSize && size > padding) {
+    _slots = (size - padding) / _stride;
+  }
+
+  if (_slots > BEAR_SSL_BUFFER_POOL_MAX_SLOTS) {
+    _slots = BEAR_SSL_BUFFER_POOL_MAX_SLOTS;
+  }
+}
+
+BearSSLBufferPool::~BearSSLBufferPool()
+{
+}
+
+int BearSSLBufferPool::lease(unsigned char** ibuf, unsigned char** obuf)
+{
+  for (int i = 0; i < _slots; i++) {
+    if ((_used & (1UL << i)) == 0) {
+      unsigned char* slot = _arena + i * _stride;
+
+      _used |= (1UL << i);
+
+      *ibuf = slot;
+      *obuf = _obufSize ? (slot + BEAR_SSL_BUFFER_ROUND(_ibufSize)) : NULL;
+
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+void BearSSLBufferPool::release(unsigned char* ibuf)
+{
+  if (ibuf < _arena) {
+    return;
+  }
+
+  size_t index = (ibuf - _arena) / _stride;
+
+  if ((int)index < _slots) {
+    _used &= ~(1UL << index);
+  }
+}
+
+size_t BearSSLBufferPool::ibufSize()
+{
+  return _ibufSize;
+}
+
+size_t BearSSLBufferPool::obufSize()
+{
+  return _obufSize;
+}
+
+int BearSSLBufferPool::slots()
+{
+  return _slots;
+}
+
+int BearSSLBufferPool::available()
+{
+  int count = 0;
+
+  for (int i = 0; i < _slots; i++) {
+    if ((_used & (1UL << i)) == 0) {
+      count++;
+    }
+  }
+
+  return count;
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _BEAR_SSL_BUFFER_POOL_H_
+#define _BEAR_SSL_BUFFER_POOL_H_
+
+#include <Arduino.h>
+
+#include "BearSSLConfig.h"
+
+#define BEAR_SSL_BUFFER_POOL_MAX_SLOTS 32
+
+// alignment of the record buffers that the library lays out (from the
+// heap, setBufferAllocator() or a pool), a power of two. The default is
+// the 32-byte cache line of the Cortex-M7: no buffer shares a line with
+// other data, so drivers can clean and invalidate the cache on a buffer
+// and DMA to and from it directly. 1 turns the padding off.
+#ifndef BEAR_SSL_BUFFER_ALIGN
+#define BEAR_SSL_BUFFER_ALIGN 32
+#endif
+
+#define BEAR_SSL_BUFFER_ROUND(size) \
+  (((size) + BEAR_SSL_BUFFER_ALIGN - 1) & ~(size_t)(BEAR_SSL_BUFFER_ALIGN - 1))
+
+#define BEAR_SSL_BUFFER_POOL_SIZE(slots, ibufSize, obufSize) \
+  ((slots) * (BEAR_SSL_BUFFER_ROUND(ibufSize) + BEAR_SSL_BUFFER_ROUND(obufSize)) + BEAR_SSL_BUFFER_ALIGN - 1)
+
+// for buffers given to setBuffers() or to a pool: aligned, and placed in
+// BEAR_SSL_DMA_SECTION when it is defined (e.g. a non-cacheable region
+// of a custom linker script). Declare the sizes with BEAR_SSL_BUFFER_ROUND().
+#ifdef BEAR_SSL_DMA_SECTION
+#define BEAR_SSL_DMA_BUFFER __attribute__((aligned(BEAR_SSL_BUFFER_ALIGN), section(BEAR_SSL_DMA_SECTION)))
+#else
+#define BEAR_SSL_DMA_BUFFER __attribute__((aligned(BEAR_SSL_BUFFER_ALIGN)))
+#endif
+
+// Splits one arena into equally sized input/output buffer pairs that
+// BearSSLClient instances lease on connect() and give back on stop(),
+// so RAM is bounded by the number of concurrent connections. Each
+// buffer starts on a BEAR_SSL_BUFFER_ALIGN boundary, size the arena with
+// BEAR_SSL_BUFFER_POOL_SIZE() to account for the padding.
+class BearSSLBufferPool {
+
+public:
+  BearSSLBufferPool(void* arena, size_t size, size_t ibufSize, size_t obufSize);
+  virtual ~BearSSLBufferPool();
+
+  int lease(unsigned char** ibuf, unsigned char** obuf);
+  void release(unsigned char* ibuf);
+
+  size_t ibufSize();
+  size_t obufSize();
+  int slots();
+  int available();
+
+private:
+  unsigned char* _arena;
+  size_t _ibufSize;
+  size_t _obufSize;
+  size_t _stride;
+  int _slots;
+  uint32_t _used;
+};
+
+#endif
@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "bearssl/bearssl.h"
+
+#include "BearSSLCertificate.h"
+
+static const uint8_t OID_COMMON_NAME[] = { 0x55, 0x04, 0x03 };
+
+BearSSLCertificate::BearSSLCertificate(const uint8_t* der, size_t length) :
+  _der(der),
+  _length(der ? length : 0)
+{
+}
+
+const uint8_t* BearSSLCertificate::der() const
+{
+  return _der;
+}
+
+size_t BearSSLCertificate::length() const
+{
+  return _length;
+}
+
+int BearSSLCertificate::field(Field field, const uint8_t*& value, size_t& length) const
+{
+  const uint8_t* p = _der;
+  const uint8_t* end = _der + _length;
+  const uint8_t* contents;
+  size_t contentsLength;
+  uint8_t tag;
+
+  // Certificate, then TBSCertificate
+  if (!readElement(p, end, tag, contents, contentsLength) || tag != 0x30) {
+    return 0;
+  }
+  p = contents;
+  if (!readElement(p, contents + contentsLength, tag, contents, contentsLength) || tag != 0x30) {
+    return 0;
+  }
+  p = contents;
+  end = contents + contentsLength;
+
+  // the version is optional, the next six fields are not
+  const uint8_t* start = p;
+
+  if (!readElement(p, end, tag, contents, contentsLength)) {
+    return 0;
+  }
+  if (tag == 0xa0) {
+    start = p;
+  } else {
+    p = start;
+  }
+
+  int index = 0;
+  int wanted = (int)field;
+
+  while (p < end) {
+    start = p;
+    if (!readElement(p, end, tag, contents, contentsLength)) {
+      return 0;
+    }
+
+    if (index < (int)Field::Extensions) {
+      if (index == wanted) {
+        value = start;
+        length = p - start;
+        return 1;
+      }
+      index++;
+    } else if (tag == 0xa3) {
+      // skip the optional unique identifiers, [1] and [2]
+      value = contents;
+      length = contentsLength;
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+int BearSSLCertificate::commonName(char* buffer, size_t size) const
+{
+  const uint8_t* name;
+  size_t nameLength;
+  const uint8_t* p;
+  const uint8_t* end;
+  const uint8_t* contents;
+  size_t contentsLength;
+  uint8_t tag;
+
+  if (!field(Field::Subject, name, nameLength)) {
+    return 0;
+  }
+
+  p = name;
+  if (!readElement(p, name + nameLength, tag, contents, contentsLength)) {
+    return 0;
+  }
+  p = contents;
+  end = contents + contentsLength;
+
+  // SEQUENCE OF SET OF SEQUENCE { type, value }
+  while (p < end) {
+    const uint8_t* rdn;
+    size_t rdnLength;
+
+    if (!readElement(p, end, tag, rdn, rdnLength) || tag != 0x31) {
+      return 0;
+    }
+
+    const uint8_t* q = rdn;
+
+    while (q < rdn + rdnLength) {
+      const uint8_t* attribute;
+      size_t attributeLength;
+      const uint8_t* oid;
+      size_t oidLength;
+      const uint8_t* string;
+      size_t stringLength;
+
+      if (!readElement(q, rdn + rdnLength, tag, attribute, attributeLength) || tag != 0x30) {
+        return 0;
+      }
+
+      const uint8_t* r = attribute;
+
+      if (!readElement(r, attribute + attributeLength, tag, oid, oidLength) || tag != 0x06 ||
+          !readElement(r, attribute + attributeLength, tag, string, stringLength)) {
+        return 0;
+      }
+
+      if (oidLength == sizeof(OID_COMMON_NAME) && memcmp(oid, OID_COMMON_NAME, oidLength) == 0) {
+        if (stringLength >= size) {
+          return 0;
+        }
+
+        memcpy(buffer, string, stringLength);
+        buffer[stringLength] = '\0';
+        return 1;
+      }
+    }
+  }
+
+  return 0;
+}
+
+int BearSSLCertificate::extension(const uint8_t* oid, size_t oidLength, const uint8_t*& value, size_t& length) const
+{
+  const uint8_t* extensions;
+  size_t extensionsLength;
+  const uint8_t* p;
+  const uint8_t* end;
+  const uint8_t* contents;
+  size_t contentsLength;
+  uint8_t tag;
+
+  if (!field(Field::Extensions, extensions, extensionsLength)) {
+    return 0;
+  }
+
+  p = extensions;
+  if (!readElement(p, extensions + extensionsLength, tag, contents, contentsLength) || tag != 0x30) {
+    return 0;
+  }
+  p = contents;
+  end = contents + contentsLength;
+
+  // SEQUENCE { extnID, critical BOOLEAN DEFAULT FALSE, extnValue }
+  while (p < end) {
+    const uint8_t* extension;
+    size_t extensionLength;
+    const uint8_t* id;
+    size_t idLength;
+
+    if (!readElement(p, end, tag, extension, extensionLength) || tag != 0x30) {
+      return 0;
+    }
+
+    const uint8_t* q = extension;
+    const uint8_t* extensionEnd = extension + extensionLength;
+
+    if (!readElement(q, extensionEnd, tag, id, idLength) || tag != 0x06) {
+      return 0;
+    }
+    if (idLength != oidLength || memcmp(id, oid, oidLength) != 0) {
+      continue;
+    }
+
+    if (!readElement(q, extensionEnd, tag, contents, contentsLength)) {
+      return 0;
+    }
+    if (tag == 0x01 && !readElement(q, extensionEnd, tag, contents, contentsLength)) {
+      return 0;
+    }
+    if (tag != 0x04) {
+      return 0;
+    }
+
+    value = contents;
+    length = contentsLength;
+    return 1;
+  }
+
+  return 0;
+}
+
+void BearSSLCertificate::fingerprint(uint8_t hash[32]) const
+{
+  br_sha256_context context;
+
+  br_sha256_init(&context);
+  br_sha256_update(&context, _der, _length);
+  br_sha256_out(&context, hash);
+}
+
+// one element at p, which is moved past it; single byte tags and definite
+// lengths of up to 3 bytes, as in certificates
+int BearSSLCertificate::readElement(const uint8_t*& p, const uint8_t* end, uint8_t& tag, const uint8_t*& value, size_t& length)
+{
+  if (end - p < 2) {
+    return 0;
+  }
+
+  tag = *p++;
+
+  size_t n = *p++;
+
+  if (n & 0x80) {
+    int bytes = n & 0x7f;
+
+    if (bytes == 0 || bytes > 3 || end - p < bytes) {
+      return 0;
+    }
+
+    n = 0;
+    while (bytes--) {
+      n = (n << 8) | *p++;
+    }
+  }
+
+  if ((size_t)(end - p) < n) {
+    return 0;
+  }
+
+  value = p;
+  length = n;
+  p += n;
+
+  return 1;
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _BEAR_SSL_CERTIFICATE_H_
+#define _BEAR_SSL_CERTIFICATE_H_
+
+#include <Arduino.h>
+
+// Read-only view of a DER encoded X.509 certificate. Nothing is copied
+// or decoded up front: each accessor walks the DER it points to when it
+// is called, so the view is as cheap as the pointer and length it holds
+// and only valid as long as the DER is.
+class BearSSLCertificate {
+
+public:
+  // fields of the TBSCertificate
+  enum class Field {
+    SerialNumber,
+    Signature,
+    Issuer,
+    Validity,
+    Subject,
+    SubjectPublicKeyInfo,
+    Extensions
+  };
+
+  BearSSLCertificate(const uint8_t* der, size_t length);
+
+  const uint8_t* der() const;
+  size_t length() const;
+
+  // the complete DER element (tag and length included) of the field,
+  // e.g. the Name to compare with another certificate's issuer or the
+  // SubjectPublicKeyInfo to hash for pinning; for Extensions, the
+  // SEQUENCE inside the [3] tag. 0 if the field is absent or the DER is
+  // malformed.
+  int field(Field field, const uint8_t*& value, size_t& length) const;
+
+  // the first common name of the subject, NUL terminated, 0 if there is
+  // none or it does not fit in size bytes
+  int commonName(char* buffer, size_t size) const;
+
+  // the contents of the OCTET STRING of the extension with the given
+  // OID (contents of the OBJECT IDENTIFIER, e.g. 55 1D 11 for the
+  // subject alternative names), 0 if the certificate doesn't have it
+  int extension(const uint8_t* oid, size_t oidLength, const uint8_t*& value, size_t& length) const;
+
+  // SHA-256 hash of the whole certificate
+  void fingerprint(uint8_t hash[32]) const;
+
+private:
+  static int readElement(const uint8_t*& p, const uint8_t* end, uint8_t& tag, const uint8_t*& value, size_t& length);
+
+  const uint8_t* _der;
+  size_t _length;
+};
+
+#endif
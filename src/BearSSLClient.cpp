@@ -29,10 +29,190 @@
 #endif
 
 #include "BearSSLTrustAnchors.h"
+#include "utility/crypto_hooks.h"
+#include "utility/ssl_features.h"
 #include "utility/eccX08_asn1.h"
+#include "utility/eccX08_ecdh.h"
+#include "utility/worker_core.h"
 
 #include "BearSSLClient.h"
 
+// record layer implementations per core, used instead of the portable
+// defaults BearSSL picks from BR_LOMUL/BR_64 alone, each of them can be
+// defined in ArduinoBearSSLConfig.h instead. AES stays the constant-time
+// aes_ct unless the sketch opts out of side-channel resistance, e.g. with
+// &br_aes_big_ctr_vtable (and the big CBC ones) for faster, table based
+// AES, or &br_ghash_tab4 for faster GHASH; table lookups leak the key
+// through the flash and XIP caches of Cortex-M0+ boards such as the SAMD21
+// and RP2040, so they are never a default there. With BR_AES_HW, the AES
+// peripheral is used instead of any of these AES choices.
+// BEAR_SSL_CLIENT_AES_CBCENC and BEAR_SSL_CLIENT_AES_CBCDEC go together;
+// the default ct CBC decryption already runs two blocks per bitsliced
+// call (four with ct64 on 64-bit hosts) over each whole record.
+#if defined(__ARM_ARCH_6M__)
+// Cortex-M0/M0+: only 32x32->32 multiplications
+#ifndef BEAR_SSL_CLIENT_GHASH
+#define BEAR_SSL_CLIENT_GHASH      &br_ghash_ctmul32
+#endif
+#ifndef BEAR_SSL_CLIENT_POLY1305
+#define BEAR_SSL_CLIENT_POLY1305   &br_poly1305_ctmul32_run
+#endif
+#elif defined(__ARM_ARCH_7EM__)
+// Cortex-M4/M7: single cycle, constant time UMULL
+#ifndef BEAR_SSL_CLIENT_AES_CTR
+#define BEAR_SSL_CLIENT_AES_CTR    &br_aes_ct_ctr_vtable
+#endif
+#ifndef BEAR_SSL_CLIENT_GHASH
+#define BEAR_SSL_CLIENT_GHASH      &br_ghash_ctmul
+#endif
+#ifndef BEAR_SSL_CLIENT_POLY1305
+#define BEAR_SSL_CLIENT_POLY1305   &br_poly1305_ctmul_run
+#endif
+#elif defined(ARDUINO_ARCH_AVR) || defined(ARDUINO_ARCH_MEGAAVR)
+// 8-bit cores: byte oriented AES, bitslicing 32-bit words costs too much
+#ifndef BEAR_SSL_CLIENT_AES_CTR
+#define BEAR_SSL_CLIENT_AES_CTR    &br_aes_small_ctr_vtable
+#endif
+#ifndef BEAR_SSL_CLIENT_AES_CBCDEC
+#define BEAR_SSL_CLIENT_AES_CBCENC &br_aes_small_cbcenc_vtable
+#define BEAR_SSL_CLIENT_AES_CBCDEC &br_aes_small_cbcdec_vtable
+#endif
+#endif
+
+// with BEARSSL_NO_HEAP nothing below comes from the heap: allocations
+// fail like an exhausted heap (the callers already cope with that) and
+// the optional contexts are the storage members of the client
+#ifdef BEARSSL_NO_HEAP
+#define BEAR_SSL_MALLOC(size)           NULL
+#define BEAR_SSL_REALLOC(ptr, size)     NULL
+#define BEAR_SSL_FREE(ptr)              ((void)(ptr))
+#define BEAR_SSL_CONTEXT(type, storage) (&(storage))
+#else
+#define BEAR_SSL_MALLOC(size)           malloc(size)
+#define BEAR_SSL_REALLOC(ptr, size)     realloc(ptr, size)
+#define BEAR_SSL_FREE(ptr)              free(ptr)
+#define BEAR_SSL_CONTEXT(type, storage) ((type*)allocate(sizeof(type)))
+#endif
+
+// fill byte of the memory statistics
+#define MEMORY_PAINT 0xa5
+
+// curves offered and accepted on TLS connections, defaults to everything
+// BearSSL implements. Define BEAR_SSL_CLIENT_EC_CURVES in
+// ArduinoBearSSLConfig.h as a mask of (1UL << BR_EC_xxx) values to link
+// only those curves (with a restricted profile, Profile::Full always pulls
+// in all of them). Servers with certificates on other curves are rejected.
+// Disabling P-384 or P-521 in BearSSLConfig.h sets the default mask.
+#if !defined(BEAR_SSL_CLIENT_EC_CURVES) && !(BEARSSL_ENABLE_P384 && BEARSSL_ENABLE_P521)
+#define BEAR_SSL_CLIENT_EC_CURVES ((1UL << BR_EC_secp256r1) | (1UL << BR_EC_curve25519) | \
+  (BEARSSL_ENABLE_P384 ? (1UL << BR_EC_secp384r1) : 0) | (BEARSSL_ENABLE_P521 ? (1UL << BR_EC_secp521r1) : 0))
+#endif
+
+#if !defined(BEAR_SSL_CLIENT_EC_CURVES)
+// all curves, through br_ec_get_default()
+#elif BEAR_SSL_CLIENT_EC_CURVES == (1UL << BR_EC_secp256r1) || BEAR_SSL_CLIENT_EC_CURVES == (1UL << BR_EC_curve25519)
+// a single curve, its implementation can be used without dispatching
+#else
+static const br_ec_impl* curveImpl(int curve)
+{
+  switch (curve) {
+#if BEAR_SSL_CLIENT_EC_CURVES & (1UL << BR_EC_secp256r1)
+    case BR_EC_secp256r1: return br_ec_p256_get_default();
+#endif
+#if BEAR_SSL_CLIENT_EC_CURVES & (1UL << BR_EC_secp384r1)
+    case BR_EC_secp384r1: return br_ec_prime_get_default();
+#endif
+#if BEAR_SSL_CLIENT_EC_CURVES & (1UL << BR_EC_secp521r1)
+    case BR_EC_secp521r1: return br_ec_prime_get_default();
+#endif
+#if BEAR_SSL_CLIENT_EC_CURVES & (1UL << BR_EC_curve25519)
+    case BR_EC_curve25519: return br_ec_c25519_get_default();
+#endif
+    default: return NULL;
+  }
+}
+
+static const unsigned char* curveGenerator(int curve, size_t* len)
+{
+  const br_ec_impl* impl = curveImpl(curve);
+
+  if (impl == NULL) {
+    *len = 0;
+    return NULL;
+  }
+
+  return impl->generator(curve, len);
+}
+
+static const unsigned char* curveOrder(int curve, size_t* len)
+{
+  const br_ec_impl* impl = curveImpl(curve);
+
+  if (impl == NULL) {
+    *len = 0;
+    return NULL;
+  }
+
+  return impl->order(curve, len);
+}
+
+static size_t curveXoff(int curve, size_t* len)
+{
+  const br_ec_impl* impl = curveImpl(curve);
+
+  if (impl == NULL) {
+    *len = 0;
+    return 0;
+  }
+
+  return impl->xoff(curve, len);
+}
+
+static uint32_t curveMul(unsigned char* G, size_t Glen, const unsigned char* x, size_t xlen, int curve)
+{
+  const br_ec_impl* impl = curveImpl(curve);
+
+  return impl ? impl->mul(G, Glen, x, xlen, curve) : 0;
+}
+
+static size_t curveMulgen(unsigned char* R, const unsigned char* x, size_t xlen, int curve)
+{
+  const br_ec_impl* impl = curveImpl(curve);
+
+  return impl ? impl->mulgen(R, x, xlen, curve) : 0;
+}
+
+static uint32_t curveMuladd(unsigned char* A, const unsigned char* B, size_t len, const unsigned char* x, size_t xlen, const unsigned char* y, size_t ylen, int curve)
+{
+  const br_ec_impl* impl = curveImpl(curve);
+
+  return impl ? impl->muladd(A, B, len, x, xlen, y, ylen, curve) : 0;
+}
+
+static const br_ec_impl configuredCurves = {
+  (uint32_t)(BEAR_SSL_CLIENT_EC_CURVES),
+  &curveGenerator,
+  &curveOrder,
+  &curveXoff,
+  &curveMul,
+  &curveMulgen,
+  &curveMuladd
+};
+#endif
+
+static const br_ec_impl* ecImplementation()
+{
+#if !defined(BEAR_SSL_CLIENT_EC_CURVES)
+  return br_ec_get_default();
+#elif BEAR_SSL_CLIENT_EC_CURVES == (1UL << BR_EC_secp256r1)
+  return br_ec_p256_get_default();
+#elif BEAR_SSL_CLIENT_EC_CURVES == (1UL << BR_EC_curve25519)
+  return br_ec_c25519_get_default();
+#else
+  return &configuredCurves;
+#endif
+}
+
 BearSSLClient::BearSSLClient(Client& client) :
   BearSSLClient(&client, TAs, TAs_NUM)
 {
@@ -47,477 +227,3266 @@ BearSSLClient::BearSSLClient(Client* client, const br_x509_trust_anchor* myTAs,
   _client(client),
   _TAs(myTAs),
   _numTAs(myNumTAs),
+  _taIndex(NULL),
+  _trustStore(NULL),
+  _taKeyCache(NULL),
+  _pinnedKey(false),
+  _pinnedSpki(NULL),
+  _chainCache(NULL),
+  _revocationFilter(NULL),
+  _revocation(NULL),
   _noSNI(false),
-  _skeyDecoder(NULL),
-  _ecChainLen(0)
+#ifndef BEAR_SSL_CLIENT_DISABLE_FULL_PROFILE
+  _profile(Profile::Full),
+#elif BEARSSL_ENABLE_GCM
+  _profile(Profile::EcdsaGcmOnly),
+#else
+  _profile(Profile::ChaChaOnly),
+#endif
+  _suiteOrder(SuiteOrder::Auto),
+  _onEngineInitCallback(NULL),
+  _engineReady(false),
+  _baseEc(NULL),
+  _baseRsaVrfy(NULL),
+  _baseX509Rsa(NULL),
+  _basePrf10(NULL),
+  _basePrfSha256(NULL),
+  _basePrfSha384(NULL),
+  _baseFlags(0),
+  _handshakeState(HandshakeState::Idle),
+  _handshakeStart(0),
+  _handshakeTimeout(0),
+  _ioWaitStart(0),
+  _ioTimeout(0),
+  _ioWaiting(false),
+  _clientError(0),
+  _earlyData(NULL),
+  _earlyDataLength(0),
+  _resumeSession(false),
+  _sessionValid(false),
+  _sessionResumed(false),
+  _sessionStore(NULL),
+  _sessionKey(0),
+  _pskIdentity(NULL),
+  _pskKey(NULL),
+  _pskKeyLength(0),
+  _clientKeyType(0),
+  _clientKeyData(NULL),
+  _rsaKeyCache(NULL),
+  _rsaKeyCacheInternal(false),
+  _ecChainLen(0),
+  _certChain(NULL),
+  _certChainLen(0),
+  _certReader(NULL),
+  _certReaderContext(NULL),
+  _ibuf(NULL),
+  _ibufSize(BEAR_SSL_CLIENT_IBUF_SIZE),
+  _obuf(NULL),
+  _obufSize(BEAR_SSL_CLIENT_OBUF_SIZE),
+  _buffersDynamic(false),
+  _ibufBlock(NULL),
+  _obufBlock(NULL),
+  _bufferAllocate(NULL),
+  _bufferRelease(NULL),
+  _bufferPool(NULL),
+  _buffersLeased(false),
+  _reuseHandshakeMemory(false),
+  _leanMode(false),
+  _flushPolicy(FlushPolicy::Immediate),
+  _flushDelay(0),
+  _writePendingSince(0),
+  _writePending(false),
+  _recordInitial(0),
+  _recordBoostAfter(BEAR_SSL_RECORD_BOOST_AFTER),
+  _recordIdleTimeout(BEAR_SSL_RECORD_IDLE_TIMEOUT),
+  _lastWrite(0),
+  _recordSent(0),
+  _recordFill(0),
+  _readAhead(false),
+  _transport(NULL),
+  _duplexBuf(NULL),
+  _duplexSize(0),
+  _duplexStart(0),
+  _duplexLen(0),
+  _pipeBuf(NULL),
+  _pipeLen(0),
+  _onDataCallback(NULL),
+  _onClosedCallback(NULL),
+  _onWaitCallback(NULL),
+  _ioBlocking(false),
+  _dataPending(false),
+  _lock(NULL),
+  _unlock(NULL),
+  _lockContext(NULL),
+  _closedReported(false),
+  _closing(false),
+  _fastClose(false),
+  _closeStart(0),
+  _closeTimeout(0),
+  _memoryStats(false),
+  _buffersPainted(false),
+  _stackDepth(0),
+  _stackUsed(0),
+  _ibufUsed(0),
+  _obufUsed(0),
+  _engineUsed(false),
+  _recordIn(0),
+  _recordOut(0),
+  _heapAllocated(0),
+  _heapLargest(0),
+  _handshakeTiming(false),
+  _connectStart(0),
+  _handshakeReporting(false),
+  _powerProfile(NULL),
+  _reportLast(0),
+  _reportIdle(false),
+  _trace(NULL),
+  _fixedSeed(NULL),
+  _fixedSeedLength(0),
+  _onKeyLogCallback(NULL),
+  _onPeerCertificateCallback(NULL),
+  _peerSpill(NULL),
+  _peerSpillSize(0),
+  _peerLength(0)
 {
+  _preparedKey = 0;
+  _ecdheKey.curve = 0;
+  _workerCore = false;
+  _cryptoHooks = false;
+  _eccEcdhSlot = -1;
+  _eccEcdhPending = false;
+
 #ifndef ARDUINO_DISABLE_ECCX08
-  _ecVrfy = eccX08_vrfy_asn1;
-  _ecSign = eccX08_sign_asn1;
+  _ecVrfy = eccX08_vrfy_auto_asn1;
 #else
   _ecVrfy = br_ecdsa_vrfy_asn1_get_default();
-  _ecSign = br_ecdsa_sign_asn1_get_default();
 #endif
+  _ecSign = secure_element_sign_asn1;
 
   _ecKey.curve = 0;
   _ecKey.x = NULL;
   _ecKey.xlen = 0;
+  _seKey.element = NULL;
+  _seKey.slot = -1;
 
   for (size_t i = 0; i < BEAR_SSL_CLIENT_CHAIN_SIZE; i++) {
     _ecCert[i].data = NULL;
     _ecCert[i].data_len = 0;
   }
-  _ecCertDynamic = false;
+  _ecCertDynamic[0] = false;
+  _ecCertDynamic[1] = false;
+
+  memset(&_handshakeStats, 0x00, sizeof(_handshakeStats));
+  memset(&_handshakeReport, 0x00, sizeof(_handshakeReport));
+  _x509Timing.started = 0;
+  _x509Timing.ended = 0;
+  _ecChainArena = NULL;
 }
 
 BearSSLClient::~BearSSLClient()
 {
-  if (_ecCertDynamic && _ecCert[0].data) {
-    free(_ecCert[0].data);
-    _ecCert[0].data = NULL;
+  freeCert(0);
+  freeCert(1);
+  BEAR_SSL_FREE(_ecChainArena);
+
+  BEAR_SSL_FREE(_clientKeyData);
+  _clientKeyData = NULL;
+
+  if (_rsaKeyCache) {
+    BEAR_SSL_FREE(_rsaKeyCache);
+    _rsaKeyCache = NULL;
+  }
+
+  if (_pinnedSpki) {
+    BEAR_SSL_FREE(_pinnedSpki);
+    _pinnedSpki = NULL;
+  }
+
+  if (_chainCache) {
+    BEAR_SSL_FREE(_chainCache);
+    _chainCache = NULL;
+  }
+
+  if (_taKeyCache) {
+    BEAR_SSL_FREE(_taKeyCache);
+    _taKeyCache = NULL;
   }
 
-  if (_skeyDecoder) {
-    free(_skeyDecoder);
-    _skeyDecoder = NULL;
+  if (_revocation) {
+    BEAR_SSL_FREE(_revocation);
+    _revocation = NULL;
   }
+
+  freeBuffers();
 }
 
 int BearSSLClient::connect(IPAddress ip, uint16_t port)
 {
+  Locked locked(this);
+
+  _connectStart = micros();
+
+  if (_preparedKey) {
+    _client->stop();
+    _preparedKey = 0;
+  }
+
   if (!_client->connect(ip, port)) {
     return 0;
   }
 
+  _sessionKey = 0;
+
   return connectSSL(NULL);
 }
 
 int BearSSLClient::connect(const char* host, uint16_t port)
 {
-  if (!_client->connect(host, port)) {
+  Locked locked(this);
+
+  _connectStart = micros();
+
+  if (!connectTransport(host, port)) {
     return 0;
   }
 
+  loadSession(host, port);
+
   return connectSSL(_noSNI ? NULL : host);
 }
 
-size_t BearSSLClient::write(uint8_t b)
+int BearSSLClient::connectAsync(IPAddress ip, uint16_t port)
 {
-  return write(&b, sizeof(b));
+  Locked locked(this);
+
+  _connectStart = micros();
+
+  if (_preparedKey) {
+    _client->stop();
+    _preparedKey = 0;
+  }
+
+  if (!_client->connect(ip, port)) {
+    return 0;
+  }
+
+  _sessionKey = 0;
+
+  return beginSSL(NULL);
 }
 
-size_t BearSSLClient::write(const uint8_t *buf, size_t size)
+int BearSSLClient::connectAsync(const char* host, uint16_t port)
 {
-  size_t written = 0;
+  Locked locked(this);
 
-  while (written < size) {
-    int result = br_sslio_write(&_ioc, buf, size - written);
+  _connectStart = micros();
 
-    if (result < 0) {
-      break;
-    }
+  if (!connectTransport(host, port)) {
+    return 0;
+  }
 
-    buf += result;
-    written += result;
+  loadSession(host, port);
+
+  return beginSSL(_noSNI ? NULL : host);
+}
+
+int BearSSLClient::prepare(const char* host, uint16_t port)
+{
+  Locked locked(this);
+
+  if (_preparedKey) {
+    _client->stop();
+    _preparedKey = 0;
   }
 
-  if (written == size && br_sslio_flush(&_ioc) < 0) {
+  if (!_client->connect(host, port)) {
     return 0;
   }
 
-  return written;
+  _preparedKey = BearSSLSessionStore::key(host, port);
+
+  if (ArduinoBearSSL.secureElement()) {
+    ArduinoBearSSL.secureElement()->ready();
+  }
+
+  ArduinoBearSSL.fillEntropy();
+
+  if (!_ecdheKey.curve) {
+#ifndef ARDUINO_DISABLE_ECCX08
+    if (_eccEcdhSlot >= 0 && eccX08_ecdhe_key_generate(&_ecdheKey, _eccEcdhSlot)) {
+      return 1;
+    }
+#endif
+
+    precomputeEcdheKey(BR_EC_secp256r1);
+  }
+
+  return 1;
 }
 
-int BearSSLClient::available()
+int BearSSLClient::connectTransport(const char* host, uint16_t port)
 {
-  int available = br_sslio_read_available(&_ioc);
+  uint32_t preparedKey = _preparedKey;
 
-  if (available < 0) {
-    available = 0;
+  _preparedKey = 0;
+
+  if (preparedKey == BearSSLSessionStore::key(host, port) && _client->connected()) {
+    return 1;
   }
 
-  return available;
+  if (preparedKey) {
+    _client->stop();
+  }
+
+  return _client->connect(host, port);
 }
 
-int BearSSLClient::read()
+// the stack is painted below the frame of paintStack(), which poll() calls
+// at the same depth as the engine. All Arduino cores have it grow down.
+// The first bytes are skipped, they may hold the locals of this leaf
+// function (e.g. in the x86-64 red zone).
+#define STACK_PAINT_SKIP 256
+
+static uint8_t* __attribute__((noinline)) paintStack(size_t depth)
 {
-  byte b;
+  uint8_t* top = (uint8_t*)__builtin_frame_address(0);
+  volatile uint8_t* p = top - STACK_PAINT_SKIP;
 
-  if (read(&b, sizeof(b)) == sizeof(b)) {
-    return b;
+  while (depth--) {
+    *--p = MEMORY_PAINT;
   }
 
-  return -1;
+  return top;
 }
 
-int BearSSLClient::read(uint8_t *buf, size_t size)
+static size_t __attribute__((noinline)) measureStack(const uint8_t* top, size_t depth)
 {
-  return br_sslio_read(&_ioc, buf, size);
+  const volatile uint8_t* p = top - STACK_PAINT_SKIP - depth;
+  size_t untouched = 0;
+
+  while (untouched < depth && p[untouched] == MEMORY_PAINT) {
+    untouched++;
+  }
+
+  return STACK_PAINT_SKIP + depth - untouched;
 }
 
-int BearSSLClient::peek()
+BearSSLClient::HandshakeState BearSSLClient::poll()
 {
-  byte b;
+  Locked locked(this);
 
-  if (br_sslio_peek(&_ioc, &b, sizeof(b)) == sizeof(b)) {
-    return b;
+  if (_handshakeState != HandshakeState::InProgress) {
+    return _handshakeState;
   }
 
-  return -1;
+  if (_handshakeTimeout && (millis() - _handshakeStart) >= _handshakeTimeout) {
+    _clientError = BEAR_SSL_CLIENT_ERR_TIMEOUT;
+    _handshakeState = HandshakeState::Failed;
+    br_ssl_engine_fail(&_sc.eng, BR_ERR_IO);
+    _client->stop();
+    returnBuffers();
+    endHandshakeReport();
+    traceHandshake();
+
+    if (ArduinoBearSSL.secureElement()) {
+      ArduinoBearSSL.secureElement()->release();
+    }
+
+    return _handshakeState;
+  }
+
+  // advance the engine by at most one transport operation
+  uint8_t* stackTop = _stackDepth ? paintStack(_stackDepth) : NULL;
+  int result = br_sslio_step(&_ioc, BR_SSL_SENDAPP | BR_SSL_RECVAPP);
+
+  if (stackTop) {
+    size_t used = measureStack(stackTop, _stackDepth);
+
+    if (used > _stackUsed) {
+      _stackUsed = used;
+    }
+  }
+
+  bool waiting = (result == 0 && !(br_ssl_engine_current_state(&_sc.eng) & BR_SSL_SENDREC));
+
+#ifndef ARDUINO_DISABLE_ECCX08
+  // the ECCX08 commands block until the chip is done: GenKey runs while
+  // the ClientHello travels and the server answers, the engine only
+  // needs the key once it has the server's whole first flight
+  if (waiting && _eccEcdhPending) {
+    unsigned long start = micros();
+
+    _eccEcdhPending = false;
+    eccX08_ecdhe_key_generate(&_ecdheKey, _eccEcdhSlot);
+    waiting = false;
+
+    if (_handshakeTiming) {
+      _handshakeStats.eccX08Ecdh = micros() - start;
+    }
+  }
+#endif
+
+  // the same wait refills the entropy pool for the next connections, one
+  // batch per step
+  if (waiting && ArduinoBearSSL.entropyAvailable() < BEAR_SSL_ENTROPY_POOL_SIZE) {
+    ArduinoBearSSL.fillEntropy(32);
+  }
+
+  if (result < 0) {
+    _handshakeState = HandshakeState::Failed;
+
+    // don't offer a session again that may have caused the failure
+    if (_sessionStore && _sessionKey && _sessionValid) {
+      _sessionStore->remove(_sessionKey);
+    }
+
+    returnBuffers();
+  } else if (result > 0) {
+    _handshakeState = HandshakeState::Established;
+    markStep(_handshakeStats.finished);
+    logKeys();
+
+    if (_resumeSession || _sessionStore || _pskIdentity) {
+      br_ssl_session_parameters session;
+
+      br_ssl_engine_get_session_parameters(&_sc.eng, &session);
+
+      // the server accepted our session if it echoed back the same ID
+      _sessionResumed = _sessionValid && session.session_id_len &&
+                        session.session_id_len == _session.session_id_len &&
+                        memcmp(session.session_id, _session.session_id, session.session_id_len) == 0;
+
+      _session = session;
+      _sessionValid = (session.session_id_len != 0);
+
+      if (_sessionStore && _sessionKey && _sessionValid && !_sessionResumed) {
+        _sessionStore->save(_sessionKey, &_session);
+      }
+    }
+
+    if (_earlyDataLength) {
+      size_t length = _earlyDataLength;
+
+      _earlyDataLength = 0;
+
+      if (writeRecords(_earlyData, length) != length || br_sslio_flush(&_ioc) < 0) {
+        _handshakeState = HandshakeState::Failed;
+        _client->stop();
+        returnBuffers();
+      }
+
+      _writePending = false;
+    }
+  }
+
+  if (_handshakeState != HandshakeState::InProgress) {
+    endHandshakeReport();
+    traceHandshake();
+
+    if (ArduinoBearSSL.secureElement()) {
+      ArduinoBearSSL.secureElement()->release();
+    }
+  }
+
+  return _handshakeState;
+}
+
+BearSSLClient::HandshakeState BearSSLClient::handshakeState()
+{
+  return _handshakeState;
+}
+
+void BearSSLClient::setEarlyData(const uint8_t* data, size_t length)
+{
+  _earlyData = data;
+  _earlyDataLength = (data != NULL) ? length : 0;
+}
+
+void BearSSLClient::setHandshakeTimeout(unsigned long timeout)
+{
+  _handshakeTimeout = timeout;
+}
+
+void BearSSLClient::setIOTimeout(unsigned long timeout)
+{
+  _ioTimeout = timeout;
+}
+
+void BearSSLClient::setResumeSession(bool resume)
+{
+  _resumeSession = resume;
+}
+
+int BearSSLClient::getSession(br_ssl_session_parameters* session)
+{
+  if (!_sessionValid) {
+    return 0;
+  }
+
+  *session = _session;
+
+  return 1;
+}
+
+void BearSSLClient::setSession(const br_ssl_session_parameters* session)
+{
+  _session = *session;
+  _sessionValid = (_session.session_id_len != 0);
+}
+
+void BearSSLClient::clearSession()
+{
+  memset(&_session, 0x00, sizeof(_session));
+  _sessionValid = false;
+}
+
+bool BearSSLClient::sessionResumed()
+{
+  return _sessionResumed;
+}
+
+void BearSSLClient::setSessionStore(BearSSLSessionStore* store)
+{
+  _sessionStore = store;
+}
+
+void BearSSLClient::setPSK(const char* identity, const uint8_t key[], size_t keyLength)
+{
+  _pskIdentity = identity;
+  _pskKey = key;
+  _pskKeyLength = keyLength;
+}
+
+int BearSSLClient::exportKeyingMaterial(const char* label, const uint8_t* context, size_t contextLength, uint8_t* out, size_t length)
+{
+  Locked locked(this);
+
+  if (_handshakeState != HandshakeState::Established) {
+    return 0;
+  }
+
+  return br_ssl_key_export(&_sc.eng, out, length, label, context, contextLength);
+}
+
+void BearSSLClient::setBuffers(unsigned char* ibuf, size_t ibufSize, unsigned char* obuf, size_t obufSize)
+{
+  freeBuffers();
+  _bufferPool = NULL;
+
+  _ibuf = ibuf;
+  _ibufSize = ibufSize;
+  _obuf = obufSize ? obuf : NULL;
+  _obufSize = obuf ? obufSize : 0;
+}
+
+void BearSSLClient::setBufferSizes(size_t ibufSize, size_t obufSize)
+{
+  freeBuffers();
+  _bufferPool = NULL;
+
+  _ibufSize = ibufSize;
+  _obufSize = obufSize;
+}
+
+void BearSSLClient::setBufferAllocator(void* (*allocate)(size_t size), void (*release)(void* ptr))
+{
+  freeBuffers();
+
+  _bufferAllocate = allocate;
+  _bufferRelease = release;
+}
+
+int BearSSLClient::setMaxFragmentLength(size_t length)
+{
+  switch (length) {
+    case 0:
+      setBufferSizes(BEAR_SSL_CLIENT_IBUF_SIZE, BEAR_SSL_CLIENT_OBUF_SIZE);
+      return 1;
+
+    case 512:
+    case 1024:
+    case 2048:
+    case 4096:
+      // the engine derives the advertised length from the buffer sizes,
+      // so the extension is sent as soon as the buffers are this small
+      setBufferSizes(length + BEAR_SSL_RECORD_IN_OVERHEAD, length + BEAR_SSL_RECORD_OUT_OVERHEAD);
+      return 1;
+
+    default:
+      return 0;
+  }
+}
+
+void BearSSLClient::setBufferPool(BearSSLBufferPool* pool)
+{
+  freeBuffers();
+  _bufferPool = pool;
+}
+
+void BearSSLClient::setReuseHandshakeMemory(bool reuse)
+{
+  _reuseHandshakeMemory = reuse;
+}
+
+void BearSSLClient::setLeanMode(bool lean)
+{
+  _leanMode = lean;
+  _engineReady = false;
+}
+
+void* BearSSLClient::handshakeMemory(size_t& size)
+{
+  if (!(_reuseHandshakeMemory || _leanMode) || _handshakeState != HandshakeState::Established) {
+    size = 0;
+    return NULL;
+  }
+
+  // the trust anchors and hashes of _xc are set up again by the next connect()
+  _engineReady = false;
+  size = sizeof(_xc);
+
+  return &_xc;
+}
+
+void* BearSSLClient::allocate(size_t size)
+{
+  void* ptr = BEAR_SSL_MALLOC(size);
+
+  if (ptr) {
+    _heapAllocated += size;
+
+    if (size > _heapLargest) {
+      _heapLargest = size;
+    }
+  }
+
+  return ptr;
+}
+
+unsigned char* BearSSLClient::allocateBuffer(size_t size, void*& block)
+{
+  // whole cache lines, whatever the alignment of the block
+  size_t padded = BEAR_SSL_BUFFER_ROUND(size) + BEAR_SSL_BUFFER_ALIGN - 1;
+
+  block = _bufferAllocate ? _bufferAllocate(padded) : allocate(padded);
+
+  if (block == NULL) {
+    return NULL;
+  }
+
+  return (unsigned char*)BEAR_SSL_BUFFER_ROUND((uintptr_t)block);
+}
+
+int BearSSLClient::allocateBuffers()
+{
+  if (_ibuf) {
+    return 1;
+  }
+
+  if (_bufferPool) {
+    if (!_bufferPool->lease(&_ibuf, &_obuf)) {
+      return 0;
+    }
+
+    _ibufSize = _bufferPool->ibufSize();
+    _obufSize = _bufferPool->obufSize();
+    _buffersLeased = true;
+
+    return 1;
+  }
+
+  _ibuf = allocateBuffer(_ibufSize, _ibufBlock);
+
+  if (_obufSize) {
+    _obuf = allocateBuffer(_obufSize, _obufBlock);
+  }
+
+  _buffersDynamic = true;
+
+  if (_ibuf == NULL || (_obufSize && _obuf == NULL)) {
+    freeBuffers();
+    return 0;
+  }
+
+  return 1;
+}
+
+void BearSSLClient::freeBuffers()
+{
+  returnBuffers();
+
+  if (_buffersDynamic) {
+    if (_bufferRelease) {
+      if (_ibufBlock) {
+        _bufferRelease(_ibufBlock);
+      }
+      if (_obufBlock) {
+        _bufferRelease(_obufBlock);
+      }
+    } else if (!_bufferAllocate) {
+      BEAR_SSL_FREE(_ibufBlock);
+      BEAR_SSL_FREE(_obufBlock);
+    }
+
+    _ibufBlock = NULL;
+    _obufBlock = NULL;
+    _buffersDynamic = false;
+  }
+
+  _ibuf = NULL;
+  _obuf = NULL;
+  _buffersPainted = false;
+}
+
+void BearSSLClient::returnBuffers()
+{
+  measureBuffers();
+
+  if (_buffersLeased) {
+    _bufferPool->release(_ibuf);
+
+    _ibuf = NULL;
+    _obuf = NULL;
+    _buffersLeased = false;
+    _buffersPainted = false;
+  }
+}
+
+void BearSSLClient::setMemoryStats(bool enable, size_t stackDepth)
+{
+  _memoryStats = enable;
+  _stackDepth = enable ? stackDepth : 0;
+}
+
+void BearSSLClient::memoryStats(BearSSLMemoryStats& stats)
+{
+  measureBuffers();
+  measureRecords();
+
+  stats.ibufUsed = _ibufUsed;
+  stats.ibufSize = _ibufSize;
+  stats.obufUsed = _obufUsed;
+  stats.obufSize = _obufSize;
+  stats.recordIn = _recordIn;
+  stats.recordOut = _recordOut;
+  stats.stackUsed = _stackUsed;
+  stats.heapAllocated = _heapAllocated;
+  stats.heapLargest = _heapLargest;
+}
+
+// bytes before the last one still holding the paint
+static size_t paintedUsed(const unsigned char* buf, size_t size)
+{
+  while (size && buf[size - 1] == MEMORY_PAINT) {
+    size--;
+  }
+
+  return size;
+}
+
+void BearSSLClient::measureBuffers()
+{
+  if (!_buffersPainted) {
+    return;
+  }
+
+  if (_ibuf) {
+    size_t used = paintedUsed(_ibuf, _ibufSize);
+
+    if (used > _ibufUsed) {
+      _ibufUsed = used;
+    }
+  }
+
+  if (_obuf) {
+    size_t used = paintedUsed(_obuf, _obufSize);
+
+    if (used > _obufUsed) {
+      _obufUsed = used;
+    }
+  }
+}
+
+void BearSSLClient::setHandshakeStats(bool enable)
+{
+  _handshakeTiming = enable;
+}
+
+void BearSSLClient::getHandshakeStats(BearSSLHandshakeStats& stats)
+{
+  stats = _handshakeStats;
+
+  // the X.509 engine keeps its own clock readings
+  if (_handshakeTiming && _x509Timing.started) {
+    stats.certificateReceived = _x509Timing.chain_start - _connectStart;
+  }
+
+  if (_handshakeTiming && _x509Timing.ended) {
+    stats.certificateValidated = _x509Timing.chain_end - _connectStart;
+  }
+}
+
+void BearSSLClient::setHandshakeReport(bool enable, const BearSSLPowerProfile* profile)
+{
+  _handshakeReporting = enable;
+  _powerProfile = profile;
+}
+
+void BearSSLClient::getHandshakeReport(BearSSLHandshakeReport& report)
+{
+  report = _handshakeReport;
+}
+
+void BearSSLClient::endHandshakeReport()
+{
+  if (!_handshakeReporting) {
+    return;
+  }
+
+  BearSSLHandshakeReport& report = _handshakeReport;
+
+  report.total = micros() - _connectStart;
+  report.busy = (report.total > report.waiting) ? report.total - report.waiting : 0;
+  report.established = (_handshakeState == HandshakeState::Established);
+  report.resumed = report.established && _sessionResumed;
+  report.suite = report.established ? _sc.eng.session.cipher_suite : 0;
+  report.energy = 0;
+
+  if (_powerProfile) {
+    const BearSSLPowerProfile& profile = *_powerProfile;
+
+    // V * mA * s = mJ
+    report.energy = profile.voltage * (profile.activeCurrent * report.busy + profile.waitCurrent * report.waiting) / 1000000.0f +
+                    (profile.txEnergy * report.bytesSent + profile.rxEnergy * report.bytesReceived) / 1000.0f;
+  }
+}
+
+void BearSSLClient::onKeyLog(void (*callback)(BearSSLClient& client, const char* line))
+{
+  _onKeyLogCallback = callback;
+}
+
+void BearSSLClient::logKeys()
+{
+  if (!_onKeyLogCallback) {
+    return;
+  }
+
+  static const char hex[] = "0123456789abcdef";
+  static const char label[] = "CLIENT_RANDOM ";
+  char line[sizeof(label) + 2 * sizeof(_sc.eng.client_random) + 1 + 2 * sizeof(_sc.eng.session.master_secret)];
+  char* p = line;
+
+  memcpy(p, label, sizeof(label) - 1);
+  p += sizeof(label) - 1;
+
+  for (size_t i = 0; i < sizeof(_sc.eng.client_random); i++) {
+    *p++ = hex[_sc.eng.client_random[i] >> 4];
+    *p++ = hex[_sc.eng.client_random[i] & 0x0f];
+  }
+  *p++ = ' ';
+  for (size_t i = 0; i < sizeof(_sc.eng.session.master_secret); i++) {
+    *p++ = hex[_sc.eng.session.master_secret[i] >> 4];
+    *p++ = hex[_sc.eng.session.master_secret[i] & 0x0f];
+  }
+  *p = '\0';
+
+  _onKeyLogCallback(*this, line);
+
+  // don't leave the master secret on the stack
+  memset(line, 0x00, sizeof(line));
+}
+
+void BearSSLClient::onPeerCertificate(void (*callback)(BearSSLClient& client, const BearSSLCertificate& certificate), uint8_t* spill, size_t spillSize)
+{
+  _onPeerCertificateCallback = callback;
+  _peerSpill = spill;
+  _peerSpillSize = spill ? spillSize : 0;
+  _peerLength = 0;
+}
+
+BearSSLCertificate BearSSLClient::peerCertificate()
+{
+  return BearSSLCertificate(_peerSpill, _peerLength);
+}
+
+void BearSSLClient::peerCertificateReady(void* ctx, const unsigned char* der, size_t length, unsigned err)
+{
+  BearSSLClient* client = (BearSSLClient*)ctx;
+
+  if (err != 0 || der == NULL) {
+    return;
+  }
+
+  // if it fits, the spill buffer holds all of it, in place or not
+  if (length <= client->_peerSpillSize) {
+    client->_peerLength = length;
+  }
+
+  if (client->_onPeerCertificateCallback) {
+    client->_onPeerCertificateCallback(*client, BearSSLCertificate(der, length));
+  }
+}
+
+void BearSSLClient::setTrace(BearSSLTrace* trace)
+{
+  _trace = trace;
+}
+
+void BearSSLClient::setFixedSeed(const uint8_t* seed, size_t length)
+{
+  _fixedSeed = seed;
+  _fixedSeedLength = seed ? length : 0;
+
+  // a fresh generator once the seed is dropped
+  _engineReady = false;
+}
+
+void BearSSLClient::traceHandshake()
+{
+  if (!_trace) {
+    return;
+  }
+
+  if (_handshakeState == HandshakeState::InProgress) {
+    _trace->start();
+  }
+
+  _trace->add(BearSSLTrace::Handshake, (uint8_t)_handshakeState, 0);
+
+  if (_handshakeState == HandshakeState::Failed) {
+    _trace->add(BearSSLTrace::Error, 0, errorCode());
+  }
+}
+
+void BearSSLClient::markStep(unsigned long& step)
+{
+  if (!_handshakeTiming || step) {
+    return;
+  }
+
+  unsigned long elapsed = micros() - _connectStart;
+
+  step = elapsed ? elapsed : 1;
+}
+
+void BearSSLClient::measureRecords()
+{
+  // the engine counts from its initialisation, kept across connections
+  // until the configuration changes
+  if (!_engineUsed) {
+    return;
+  }
+
+  if (br_ssl_engine_get_max_record_in(&_sc.eng) > _recordIn) {
+    _recordIn = br_ssl_engine_get_max_record_in(&_sc.eng);
+  }
+
+  if (br_ssl_engine_get_max_record_out(&_sc.eng) > _recordOut) {
+    _recordOut = br_ssl_engine_get_max_record_out(&_sc.eng);
+  }
+}
+
+void BearSSLClient::loadSession(const char* host, uint16_t port)
+{
+  if (_sessionStore == NULL) {
+    _sessionKey = 0;
+    return;
+  }
+
+  _sessionKey = BearSSLSessionStore::key(host, port);
+
+  if (!_sessionStore->load(_sessionKey, &_session)) {
+    clearSession();
+  } else {
+    _sessionValid = true;
+  }
+}
+
+size_t BearSSLClient::write(uint8_t b)
+{
+  return write(&b, sizeof(b));
+}
+
+size_t BearSSLClient::write(const uint8_t *buf, size_t size)
+{
+  Locked locked(this);
+
+  size_t written = writeRecords(buf, size);
+
+  if (written == size && written != 0 && flushPending(_flushPolicy == FlushPolicy::Immediate) < 0) {
+    return 0;
+  }
+
+  return written;
+}
+
+size_t BearSSLClient::writev(const BearSSLIoVec* iov, size_t count)
+{
+  Locked locked(this);
+
+  size_t total = 0;
+
+  for (size_t i = 0; i < count; i++) {
+    size_t written = writeRecords(iov[i].data, iov[i].length);
+
+    total += written;
+
+    if (written != iov[i].length) {
+      return total;
+    }
+  }
+
+  if (total != 0 && flushPending(_flushPolicy == FlushPolicy::Immediate) < 0) {
+    return 0;
+  }
+
+  return total;
+}
+
+size_t BearSSLClient::writeRecords(const uint8_t* buf, size_t size)
+{
+  if (_duplexBuf != NULL) {
+    return writeDuplex(buf, size);
+  }
+
+  size_t written = 0;
+
+  startRecords();
+
+  while (written < size) {
+    size_t length = size - written;
+    size_t room = recordRoom();
+
+    if (room != 0 && length > room) {
+      length = room;
+    }
+
+    Blocking blocking(this);
+    int result = br_sslio_write(&_ioc, buf, length);
+
+    if (result < 0) {
+      break;
+    }
+
+    buf += result;
+    written += result;
+    recordWritten(result);
+  }
+
+  if (written == 0) {
+    return 0;
+  }
+
+  // full records are sealed by the engine on their own, only the
+  // partially filled one is left pending in buffered mode
+  if (!_writePending) {
+    _writePending = true;
+    _writePendingSince = millis();
+  }
+
+  return written;
+}
+
+size_t BearSSLClient::writeDuplex(const uint8_t* buf, size_t size)
+{
+  Blocking blocking(this);
+  size_t written = 0;
+
+  startRecords();
+
+  while (written < size) {
+    unsigned state = br_ssl_engine_current_state(&_sc.eng);
+
+    if (state & BR_SSL_CLOSED) {
+      break;
+    }
+
+    if ((state & BR_SSL_RECVAPP) && parkReceived() != 0) {
+      continue;
+    }
+
+    if (state & BR_SSL_SENDAPP) {
+      size_t length;
+      unsigned char* out = br_ssl_engine_sendapp_buf(&_sc.eng, &length);
+      size_t room = recordRoom();
+
+      if (length > size - written) {
+        length = size - written;
+      }
+      if (room != 0 && length > room) {
+        length = room;
+      }
+
+      memcpy(out, buf + written, length);
+      br_ssl_engine_sendapp_ack(&_sc.eng, length);
+      written += length;
+      recordWritten(length);
+      continue;
+    }
+
+    if ((state & BR_SSL_RECVAPP) && !(state & BR_SSL_SENDREC)) {
+      // parking buffer full and nothing else to do, the application
+      // has to read before more can be sent
+      break;
+    }
+
+    if ((state & BR_SSL_RECVREC) && transportAvailable() > 0) {
+      size_t length;
+      unsigned char* in = br_ssl_engine_recvrec_buf(&_sc.eng, &length);
+      int result = clientRead(this, in, length);
+
+      if (result < 0) {
+        br_ssl_engine_fail(&_sc.eng, BR_ERR_IO);
+        break;
+      }
+
+      if (result > 0) {
+        br_ssl_engine_recvrec_ack(&_sc.eng, result);
+        continue;
+      }
+    }
+
+    if (br_sslio_step(&_ioc, BR_SSL_SENDAPP) < 0) {
+      break;
+    }
+  }
+
+  if (written == 0) {
+    return 0;
+  }
+
+  if (!_writePending) {
+    _writePending = true;
+    _writePendingSince = millis();
+  }
+
+  return written;
+}
+
+void BearSSLClient::startRecords()
+{
+  unsigned long now = millis();
+
+  // after a pause the congestion window may have shrunk again
+  if (_recordInitial != 0 && (now - _lastWrite) >= _recordIdleTimeout) {
+    _recordSent = 0;
+  }
+
+  _lastWrite = now;
+}
+
+size_t BearSSLClient::recordRoom()
+{
+  if (_recordInitial == 0 || _recordSent >= _recordBoostAfter) {
+    return 0;
+  }
+
+  return _recordInitial - _recordFill;
+}
+
+void BearSSLClient::recordWritten(size_t length)
+{
+  if (recordRoom() == 0) {
+    return;
+  }
+
+  _recordSent += length;
+  _recordFill += length;
+
+  // the engine would only seal the record once the output buffer is full
+  if (_recordFill >= _recordInitial) {
+    br_ssl_engine_flush(&_sc.eng, 0);
+    _recordFill = 0;
+  }
+}
+
+size_t BearSSLClient::parkReceived()
+{
+  size_t length;
+  unsigned char* in = br_ssl_engine_recvapp_buf(&_sc.eng, &length);
+
+  if (in == NULL) {
+    return 0;
+  }
+
+  // the application may still use the front half, only the back one fills
+  if (_pipeBuf != NULL) {
+    if (length > _duplexSize - _pipeLen) {
+      length = _duplexSize - _pipeLen;
+    }
+
+    memcpy(_pipeBuf + _pipeLen, in, length);
+    br_ssl_engine_recvapp_ack(&_sc.eng, length);
+    _pipeLen += length;
+    swapPipeline();
+
+    return length;
+  }
+
+  if (_duplexLen == 0) {
+    _duplexStart = 0;
+  } else if (_duplexStart + _duplexLen + length > _duplexSize && _duplexStart != 0) {
+    memmove(_duplexBuf, _duplexBuf + _duplexStart, _duplexLen);
+    _duplexStart = 0;
+  }
+
+  size_t room = _duplexSize - _duplexStart - _duplexLen;
+
+  if (length > room) {
+    length = room;
+  }
+
+  memcpy(_duplexBuf + _duplexStart + _duplexLen, in, length);
+  br_ssl_engine_recvapp_ack(&_sc.eng, length);
+  _duplexLen += length;
+
+  return length;
+}
+
+void BearSSLClient::setFullDuplex(uint8_t* buffer, size_t size)
+{
+  _duplexBuf = (size != 0) ? buffer : NULL;
+  _duplexSize = (buffer != NULL) ? size : 0;
+  _duplexStart = 0;
+  _duplexLen = 0;
+  _pipeBuf = NULL;
+  _pipeLen = 0;
+}
+
+void BearSSLClient::setRecordPipeline(uint8_t* buffer, size_t size)
+{
+  setFullDuplex(buffer, size / 2);
+
+  if (_duplexBuf != NULL) {
+    _pipeBuf = buffer + _duplexSize;
+  }
+}
+
+void BearSSLClient::fillPipeline()
+{
+  while (_pipeLen < _duplexSize) {
+    unsigned state = br_ssl_engine_current_state(&_sc.eng);
+
+    if (state & BR_SSL_RECVAPP) {
+      if (parkReceived() == 0) {
+        break;
+      }
+      continue;
+    }
+
+    if (!(state & BR_SSL_RECVREC) || transportAvailable() <= 0) {
+      break;
+    }
+
+    size_t length;
+    unsigned char* in = br_ssl_engine_recvrec_buf(&_sc.eng, &length);
+    int result = clientRead(this, in, length);
+
+    if (result < 0) {
+      br_ssl_engine_fail(&_sc.eng, BR_ERR_IO);
+      break;
+    }
+
+    if (result == 0) {
+      break;
+    }
+
+    br_ssl_engine_recvrec_ack(&_sc.eng, result);
+  }
+}
+
+void BearSSLClient::swapPipeline()
+{
+  if (_duplexLen != 0 || _pipeLen == 0) {
+    return;
+  }
+
+  uint8_t* front = _pipeBuf;
+
+  _pipeBuf = _duplexBuf;
+  _duplexBuf = front;
+  _duplexStart = 0;
+  _duplexLen = _pipeLen;
+  _pipeLen = 0;
+}
+
+void BearSSLClient::onData(void (*callback)(BearSSLClient& client))
+{
+  _onDataCallback = callback;
+}
+
+void BearSSLClient::onClosed(void (*callback)(BearSSLClient& client))
+{
+  _onClosedCallback = callback;
+}
+
+void BearSSLClient::setLock(void (*lock)(void* context), void (*unlock)(void* context), void* context)
+{
+  _lock = lock;
+  _unlock = unlock;
+  _lockContext = context;
+}
+
+BearSSLClient::Locked::Locked(BearSSLClient* client) :
+  _client(client)
+{
+  if (_client->_lock) {
+    _client->_lock(_client->_lockContext);
+  }
+}
+
+BearSSLClient::Locked::~Locked()
+{
+  if (_client->_unlock) {
+    _client->_unlock(_client->_lockContext);
+  }
+}
+
+void BearSSLClient::onWait(void (*callback)(BearSSLClient& client))
+{
+  _onWaitCallback = callback;
+}
+
+BearSSLClient::Blocking::Blocking(BearSSLClient* client) :
+  _client(client),
+  _blocking(client->_ioBlocking)
+{
+  _client->_ioBlocking = true;
+}
+
+BearSSLClient::Blocking::~Blocking()
+{
+  _client->_ioBlocking = _blocking;
+}
+
+void BearSSLClient::service()
+{
+  Locked locked(this);
+
+  if (_handshakeState == HandshakeState::InProgress) {
+    poll();
+  }
+
+  if (_handshakeState == HandshakeState::Idle || _closedReported) {
+    return;
+  }
+
+  if (_handshakeState == HandshakeState::Established) {
+    flushPending(false);
+
+    if (_dataPending || _duplexLen != 0 || transportAvailable() > 0) {
+      _dataPending = (available() > 0);
+    }
+
+    if (_dataPending) {
+      if (_onDataCallback) {
+        _onDataCallback(*this);
+      }
+
+      return;
+    }
+
+    if (connected()) {
+      return;
+    }
+  }
+
+  _closedReported = true;
+
+  if (_onClosedCallback) {
+    _onClosedCallback(*this);
+  }
+}
+
+int BearSSLClient::available()
+{
+  Locked locked(this);
+
+  flushPending(false);
+
+  if (_pipeBuf != NULL) {
+    fillPipeline();
+  }
+
+  if (_duplexLen != 0) {
+    return _duplexLen;
+  }
+
+  prefetchRecords();
+
+  int available = br_sslio_read_available(&_ioc);
+
+  if (available < 0) {
+    available = 0;
+  }
+
+  return available;
+}
+
+void BearSSLClient::prefetchRecords()
+{
+  // the engine asks for the record header first, then for the body: take
+  // both as far as the transport already has the bytes, so that a record
+  // is counted by available() as soon as it has fully arrived
+  for (;;) {
+    unsigned state = br_ssl_engine_current_state(&_sc.eng);
+
+    if ((state & BR_SSL_RECVAPP) || !(state & BR_SSL_RECVREC)) {
+      break;
+    }
+
+    int available = transportAvailable();
+
+    if (available <= 0) {
+      break;
+    }
+
+    size_t length;
+    unsigned char* in = br_ssl_engine_recvrec_buf(&_sc.eng, &length);
+
+    if ((size_t)available < length) {
+      length = available;
+    }
+
+    int result = clientRead(this, in, length);
+
+    if (result < 0) {
+      br_ssl_engine_fail(&_sc.eng, BR_ERR_IO);
+      break;
+    }
+
+    if (result == 0) {
+      break;
+    }
+
+    br_ssl_engine_recvrec_ack(&_sc.eng, result);
+  }
+}
+
+int BearSSLClient::read()
+{
+  byte b;
+
+  if (read(&b, sizeof(b)) == sizeof(b)) {
+    return b;
+  }
+
+  return -1;
+}
+
+int BearSSLClient::read(uint8_t *buf, size_t size)
+{
+  Locked locked(this);
+
+  // the peer usually waits for what we buffered before answering
+  flushPending(true);
+
+  if (_pipeBuf != NULL) {
+    fillPipeline();
+  }
+
+  if (_duplexLen != 0) {
+    if (size > _duplexLen) {
+      size = _duplexLen;
+    }
+
+    memcpy(buf, _duplexBuf + _duplexStart, size);
+    _duplexStart += size;
+    _duplexLen -= size;
+    swapPipeline();
+
+    return size;
+  }
+
+  Blocking blocking(this);
+
+  return br_sslio_read(&_ioc, buf, size);
+}
+
+int BearSSLClient::peek()
+{
+  Locked locked(this);
+
+  byte b;
+
+  flushPending(true);
+
+  if (_pipeBuf != NULL) {
+    fillPipeline();
+  }
+
+  if (_duplexLen != 0) {
+    return _duplexBuf[_duplexStart];
+  }
+
+  if (br_sslio_peek(&_ioc, &b, sizeof(b)) == sizeof(b)) {
+    return b;
+  }
+
+  return -1;
+}
+
+void BearSSLClient::setReadAhead(bool enable)
+{
+  _readAhead = enable;
+}
+
+const uint8_t* BearSSLClient::peekBuffer(size_t& length)
+{
+  Locked locked(this);
+
+  flushPending(true);
+
+  if (_pipeBuf != NULL) {
+    fillPipeline();
+  }
+
+  if (_duplexLen != 0) {
+    length = _duplexLen;
+    return _duplexBuf + _duplexStart;
+  }
+
+  // the engine's buffer would be drained by the next fill
+  if (_pipeBuf != NULL) {
+    length = 0;
+    return NULL;
+  }
+
+  if (br_sslio_read_available(&_ioc) <= 0) {
+    length = 0;
+    return NULL;
+  }
+
+  return br_ssl_engine_recvapp_buf(&_sc.eng, &length);
+}
+
+void BearSSLClient::consume(size_t length)
+{
+  Locked locked(this);
+
+  if (_duplexLen != 0) {
+    if (length > _duplexLen) {
+      length = _duplexLen;
+    }
+
+    _duplexStart += length;
+    _duplexLen -= length;
+    swapPipeline();
+    return;
+  }
+
+  br_ssl_engine_recvapp_ack(&_sc.eng, length);
+}
+
+uint8_t* BearSSLClient::reserveWrite(size_t& length)
+{
+  Locked locked(this);
+
+  Blocking blocking(this);
+  int result;
+
+  // pending records must go out before the engine accepts more data
+  while ((result = br_sslio_step(&_ioc, BR_SSL_SENDAPP)) == 0);
+
+  if (result < 0) {
+    length = 0;
+    return NULL;
+  }
+
+  uint8_t* buf = br_ssl_engine_sendapp_buf(&_sc.eng, &length);
+  size_t room = recordRoom();
+
+  if (room != 0 && length > room) {
+    length = room;
+  }
+
+  return buf;
+}
+
+int BearSSLClient::commitWrite(size_t length)
+{
+  Locked locked(this);
+
+  if (length == 0) {
+    return 1;
+  }
+
+  startRecords();
+  br_ssl_engine_sendapp_ack(&_sc.eng, length);
+  recordWritten(length);
+
+  if (!_writePending) {
+    _writePending = true;
+    _writePendingSince = millis();
+  }
+
+  return (flushPending(_flushPolicy == FlushPolicy::Immediate) == 0);
+}
+
+void BearSSLClient::flush()
+{
+  Locked locked(this);
+  Blocking blocking(this);
+
+  br_sslio_flush(&_ioc);
+  _writePending = false;
+  _recordFill = 0;
+
+  _client->flush();
+}
+
+int BearSSLClient::flushPending(bool force)
+{
+  if (!_writePending) {
+    return 0;
+  }
+
+  if (!force && (_flushDelay == 0 || (millis() - _writePendingSince) < _flushDelay)) {
+    return 0;
+  }
+
+  _writePending = false;
+  _recordFill = 0;
+
+  Blocking blocking(this);
+
+  return br_sslio_flush(&_ioc);
+}
+
+void BearSSLClient::setTransport(BearSSLTransport* transport)
+{
+  _transport = transport;
+}
+
+int BearSSLClient::transportAvailable()
+{
+  return _transport ? _transport->available() : _client->available();
+}
+
+void BearSSLClient::setFlushPolicy(FlushPolicy policy, unsigned long delay)
+{
+  _flushPolicy = policy;
+  _flushDelay = delay;
+}
+
+void BearSSLClient::setRecordSizing(size_t initialSize, size_t boostAfter, unsigned long idleTimeout)
+{
+  _recordInitial = initialSize;
+  _recordBoostAfter = boostAfter;
+  _recordIdleTimeout = idleTimeout;
+}
+
+void BearSSLClient::stop()
+{
+  Locked locked(this);
+  Blocking blocking(this);
+
+  while (stopAsync() == 0);
+}
+
+int BearSSLClient::stopAsync()
+{
+  Locked locked(this);
+
+  _handshakeState = HandshakeState::Idle;
+
+  // a transport opened by prepare() carries no TLS yet
+  if (_preparedKey) {
+    _preparedKey = 0;
+    _client->stop();
+  }
+
+  if (_client->connected()) {
+    if (!_closing) {
+      _closing = true;
+      _closeStart = millis();
+
+      if ((br_ssl_engine_current_state(&_sc.eng) & BR_SSL_CLOSED) == 0) {
+        br_ssl_engine_close(&_sc.eng);
+      }
+    }
+
+    unsigned state = br_ssl_engine_current_state(&_sc.eng);
+    bool wait = !_fastClose && (_closeTimeout == 0 || (millis() - _closeStart) < _closeTimeout);
+
+    if (state & BR_SSL_SENDREC) {
+      // our close_notify, and anything still buffered before it
+      if (br_sslio_step(&_ioc, 0) >= 0) {
+        return 0;
+      }
+    } else if (wait && (state & BR_SSL_RECVAPP)) {
+      size_t length;
+
+      // discard what the peer sends before its close_notify
+      br_ssl_engine_recvapp_buf(&_sc.eng, &length);
+      br_ssl_engine_recvapp_ack(&_sc.eng, length);
+      return 0;
+    } else if (wait && (state & BR_SSL_RECVREC)) {
+      if (br_sslio_step(&_ioc, 0) >= 0) {
+        return 0;
+      }
+    }
+
+    _client->stop();
+  }
+
+  _closing = false;
+  _writePending = false;
+  returnBuffers();
+
+  return 1;
+}
+
+void BearSSLClient::setCloseTimeout(unsigned long timeout)
+{
+  _closeTimeout = timeout;
+}
+
+void BearSSLClient::setFastClose(bool fast)
+{
+  _fastClose = fast;
+}
+
+uint8_t BearSSLClient::connected()
+{
+  Locked locked(this);
+
+  // parked data can still be read after the peer closed
+  if (_duplexLen != 0) {
+    return 1;
+  }
+
+  if (!_client->connected()) {
+    return 0;
+  }
+
+  unsigned state = br_ssl_engine_current_state(&_sc.eng);
+
+  if (state == BR_SSL_CLOSED) {
+    return 0;
+  }
+
+  return 1;
+}
+
+BearSSLClient::operator bool()
+{
+  return (*_client);  
+}
+
+void BearSSLClient::setInsecure(SNI insecure)
+{
+  switch (insecure) {
+    case SNI::Insecure : _noSNI = true; break;
+    default: _noSNI = false;
+  }
+}
+
+int BearSSLClient::precomputeEcdheKey(int curve)
+{
+  br_hmac_drbg_context rng;
+  unsigned char seed[32];
+
+  getEntropy(seed, sizeof(seed));
+  br_hmac_drbg_init(&rng, &br_sha256_vtable, seed, sizeof(seed));
+
+  return br_ssl_ecdhe_key_generate(&_ecdheKey, ecImplementation(), &rng.vtable, curve);
+}
+
+bool BearSSLClient::ecdheKeyPrecomputed()
+{
+  return (_ecdheKey.curve != 0);
+}
+
+void BearSSLClient::setWorkerCore(bool enable, void (*wait)())
+{
+  _workerCore = enable;
+  worker_core_set_wait(wait);
+}
+
+void BearSSLClient::setCryptoHooks(void (*begin)(), void (*end)())
+{
+  _cryptoHooks = (begin != NULL || end != NULL);
+  crypto_hooks_set(begin, end);
+}
+
+void BearSSLClient::setEccVrfy(br_ecdsa_vrfy vrfy)
+{
+  _ecVrfy = vrfy;
+}
+
+void BearSSLClient::setEccSign(br_ecdsa_sign sign)
+{
+  _ecSign = sign;
+}
+
+void BearSSLClient::setEccCert(br_x509_certificate cert)
+{
+  freeCert(0);
+  _ecCert[0] = cert;
+  _ecChainLen = 1;
+}
+
+void BearSSLClient::setEccChain(br_x509_certificate* chain, size_t chainLen)
+{
+  if (chainLen > BEAR_SSL_CLIENT_CHAIN_SIZE)
+    return;
+
+  freeCert(0);
+  freeCert(1);
+  for (size_t i = 0; i < chainLen; i++) {
+    _ecCert[i] = chain[i];
+  }
+  _ecChainLen = chainLen;
+}
+
+void BearSSLClient::setCertificateChain(const br_x509_certificate* chain, size_t chainLen, br_ssl_cert_reader reader, void* readerContext)
+{
+  _certChain = chainLen ? chain : NULL;
+  _certChainLen = _certChain ? chainLen : 0;
+  _certReader = reader;
+  _certReaderContext = readerContext;
+}
+
+void BearSSLClient::setEccEcdhSlot(int ecc508KeySlot)
+{
+  _eccEcdhSlot = ecc508KeySlot;
+
+  // a key made on the chip is no use to the software implementation
+  _ecdheKey.curve = 0;
+}
+
+void BearSSLClient::setEccSlot(int ecc508KeySlot, const byte cert[], int certLength)
+{
+  // the key stays in the secure element, x refers to its slot
+  _seKey.element = ArduinoBearSSL.secureElement();
+  _seKey.slot = ecc508KeySlot;
+  _ecKey.curve = BR_EC_secp256r1;
+  _ecKey.x = (unsigned char*)&_seKey;
+  _ecKey.xlen = 32;
+
+  freeCert(0);
+  _ecCert[0].data = (unsigned char*)cert;
+  _ecCert[0].data_len = certLength;
+  _ecChainLen = 1;
+
+#ifndef ARDUINO_DISABLE_ECCX08
+  _ecVrfy = eccX08_vrfy_auto_asn1;
+#else
+  _ecVrfy = br_ecdsa_vrfy_asn1_get_default();
+#endif
+  _ecSign = secure_element_sign_asn1;
+}
+
+void BearSSLClient::setEccSlot(int ecc508KeySlot, const char cert[], BearSSLDeviceCertCache* cache)
+{
+  // free old data
+  freeCert(0);
+
+  if (cache) {
+    size_t cachedLen;
+    bool allocated;
+    const uint8_t* cached = cache->certificate(ecc508KeySlot, cert, &cachedLen, &allocated);
+
+    if (cached) {
+      setEccSlot(ecc508KeySlot, cached, cachedLen);
+      _ecCertDynamic[0] = allocated;
+      return;
+    }
+  }
+
+  // assume the decoded cert is 3/4 the length of the input
+  size_t size = ((strlen(cert) * 3) + 3) / 4;
+  byte* der = (byte*)allocate(size);
+  size_t derLen = der ? pemToDer(cert, der, size) : 0;
+
+  if (derLen == 0) {
+    // failure
+    BEAR_SSL_FREE(der);
+    setEccSlot(ecc508KeySlot, NULL, 0);
+    return;
+  }
+
+  setEccSlot(ecc508KeySlot, der, derLen);
+  _ecCertDynamic[0] = true;
+
+  if (cache && cache->saveCertificate(ecc508KeySlot, cert, der, derLen)) {
+    size_t cachedLen;
+    bool allocated;
+    const uint8_t* cached = cache->certificate(ecc508KeySlot, cert, &cachedLen, &allocated);
+
+    // use the copy in place when the cache is memory mapped
+    if (cached && !allocated) {
+      setEccSlot(ecc508KeySlot, cached, cachedLen);
+    } else if (allocated) {
+      BEAR_SSL_FREE((void*)cached);
+    }
+  }
+}
+
+void BearSSLClient::setEccSlot(int ecc508KeySlot, const char cert[], byte buffer[], size_t size)
+{
+  setEccSlot(ecc508KeySlot, buffer, pemToDer(cert, buffer, size));
+}
+
+void BearSSLClient::setKey(const char key[], const char cert[])
+{
+  if (!decodeKey(key, NULL, 0)) {
+    return;
+  }
+
+  freeCert(0);
+
+  // assume the decoded cert is 3/4 the length of the input
+  size_t size = ((strlen(cert) * 3) + 3) / 4;
+  byte* der = (byte*)allocate(size);
+  size_t derLen = der ? pemToDer(cert, der, size) : 0;
+
+  if (derLen == 0) {
+    // failure
+    BEAR_SSL_FREE(der);
+    return;
+  }
+
+  _ecCert[0].data = der;
+  _ecCert[0].data_len = derLen;
+  _ecChainLen = 1;
+  _ecCertDynamic[0] = true;
+}
+
+void BearSSLClient::setKey(const char key[], const byte cert[], int certLength)
+{
+  if (!decodeKey(key, NULL, 0)) {
+    return;
+  }
+
+  freeCert(0);
+
+  _ecCert[0].data = (unsigned char*)cert;
+  _ecCert[0].data_len = certLength;
+  _ecChainLen = 1;
+}
+
+void BearSSLClient::setKey(const byte key[], int keyLength, const byte cert[], int certLength)
+{
+  if (!decodeKey(NULL, key, keyLength)) {
+    return;
+  }
+
+  freeCert(0);
+
+  _ecCert[0].data = (unsigned char*)cert;
+  _ecCert[0].data_len = certLength;
+  _ecChainLen = 1;
+}
+
+#ifdef BEARSSL_NO_HEAP
+// shared by the clients, it is only used while setKey() runs
+static br_skey_decoder_context skeyDecoder;
+#endif
+
+static void releaseDecoder(br_skey_decoder_context* decoder)
+{
+  // the decoder held a copy of the private key
+  memset(decoder, 0x00, sizeof(br_skey_decoder_context));
+  BEAR_SSL_FREE(decoder);
+}
+
+int BearSSLClient::decodeKey(const char pem[], const byte der[], size_t derLength)
+{
+  // a key that fails to decode leaves the client without one
+  BEAR_SSL_FREE(_clientKeyData);
+  _clientKeyData = NULL;
+  _clientKeyType = 0;
+
+  // the decoder has room for the largest keys, it is only kept while
+  // decoding
+  br_skey_decoder_context* decoder = BEAR_SSL_CONTEXT(br_skey_decoder_context, skeyDecoder);
+
+  if (decoder == NULL) {
+    return 0;
+  }
+
+  br_skey_decoder_init(decoder);
+
+  if (pem) {
+    // try to decode the key
+    br_pem_decoder_context pemDecoder;
+    size_t keyLen = strlen(pem);
+
+    br_pem_decoder_init(&pemDecoder);
+
+    while (keyLen) {
+      size_t len = br_pem_decoder_push(&pemDecoder, pem, keyLen);
+
+      pem += len;
+      keyLen -= len;
+
+      switch (br_pem_decoder_event(&pemDecoder)) {
+        case BR_PEM_BEGIN_OBJ:
+          br_pem_decoder_setdest(&pemDecoder, BearSSLClient::clientAppendKey, decoder);
+          break;
+
+        case BR_PEM_END_OBJ:
+          if (br_skey_decoder_last_error(decoder) != 0) {
+            releaseDecoder(decoder);
+            return 0;
+          }
+          break;
+
+        case BR_PEM_ERROR:
+          releaseDecoder(decoder);
+          return 0;
+      }
+    }
+  } else {
+    br_skey_decoder_push(decoder, der, derLength);
+  }
+
+  int kept = (br_skey_decoder_last_error(decoder) == 0) && keepKey(decoder);
+
+  releaseDecoder(decoder);
+
+  if (!kept) {
+    return 0;
+  }
+
+  if (_rsaKeyCache) {
+    rsa_key_cache_reset(_rsaKeyCache);
+  }
+
+  // decode the factors and compute the CRT constants once, instead of in
+  // every handshake
+  if (_clientKeyType == BR_KEYTYPE_RSA) {
+    prepareRsaKey();
+  } else if (_rsaKeyCacheInternal) {
+    BEAR_SSL_FREE(_rsaKeyCache);
+    _rsaKeyCache = NULL;
+    _rsaKeyCacheInternal = false;
+  }
+
+  return 1;
+}
+
+int BearSSLClient::keepKey(const br_skey_decoder_context* decoder)
+{
+  const br_ec_private_key* ec = br_skey_decoder_get_ec(decoder);
+  const br_rsa_private_key* rsa = br_skey_decoder_get_rsa(decoder);
+  size_t size;
+
+  if (ec) {
+    size = ec->xlen;
+  } else if (rsa && BEARSSL_ENABLE_RSA) {
+    size = rsa->plen + rsa->qlen + rsa->dplen + rsa->dqlen + rsa->iqlen;
+  } else {
+    return 0;
+  }
+
+#ifdef BEARSSL_NO_HEAP
+  unsigned char* data = (size <= sizeof(_clientKeyStorage)) ? _clientKeyStorage : NULL;
+#else
+  unsigned char* data = (unsigned char*)allocate(size);
+#endif
+
+  if (data == NULL) {
+    return 0;
+  }
+
+  _clientKeyData = data;
+
+  if (ec) {
+    _clientKeyType = BR_KEYTYPE_EC;
+    _clientEcKey.curve = ec->curve;
+    _clientEcKey.x = data;
+    _clientEcKey.xlen = ec->xlen;
+    memcpy(data, ec->x, ec->xlen);
+  } else {
+    _clientKeyType = BR_KEYTYPE_RSA;
+    _clientRsaKey.n_bitlen = rsa->n_bitlen;
+    _clientRsaKey.p = data;
+    _clientRsaKey.plen = rsa->plen;
+    memcpy(data, rsa->p, rsa->plen);
+    data += rsa->plen;
+    _clientRsaKey.q = data;
+    _clientRsaKey.qlen = rsa->qlen;
+    memcpy(data, rsa->q, rsa->qlen);
+    data += rsa->qlen;
+    _clientRsaKey.dp = data;
+    _clientRsaKey.dplen = rsa->dplen;
+    memcpy(data, rsa->dp, rsa->dplen);
+    data += rsa->dplen;
+    _clientRsaKey.dq = data;
+    _clientRsaKey.dqlen = rsa->dqlen;
+    memcpy(data, rsa->dq, rsa->dqlen);
+    data += rsa->dqlen;
+    _clientRsaKey.iq = data;
+    _clientRsaKey.iqlen = rsa->iqlen;
+    memcpy(data, rsa->iq, rsa->iqlen);
+  }
+
+  return 1;
+}
+
+int BearSSLClient::setRsaKeyCache(void* buffer, size_t size)
+{
+  if (buffer == NULL) {
+    BEAR_SSL_FREE(_rsaKeyCache);
+    _rsaKeyCache = NULL;
+    _rsaKeyCacheInternal = false;
+    return 1;
+  }
+
+  if (_rsaKeyCache == NULL) {
+    _rsaKeyCache = BEAR_SSL_CONTEXT(rsa_key_cache_context, _rsaKeyCacheStorage);
+
+    if (_rsaKeyCache == NULL) {
+      return 0;
+    }
+  }
+
+  _rsaKeyCacheInternal = false;
+  rsa_key_cache_init(_rsaKeyCache, buffer, size);
+
+  return 1;
+}
+
+void BearSSLClient::prepareRsaKey()
+{
+  const br_rsa_private_key* key = &_clientRsaKey;
+
+  // without a buffer from setRsaKeyCache(), keep the key right after
+  // the context
+  if (_rsaKeyCache == NULL || _rsaKeyCacheInternal) {
+    size_t size = rsa_key_cache_key_size(key->n_bitlen);
+
+    BEAR_SSL_FREE(_rsaKeyCache);
+    _rsaKeyCache = (rsa_key_cache_context*)allocate(sizeof(rsa_key_cache_context) + size);
+    _rsaKeyCacheInternal = (_rsaKeyCache != NULL);
+
+    if (_rsaKeyCache == NULL) {
+      return;
+    }
+
+    rsa_key_cache_init(_rsaKeyCache, _rsaKeyCache + 1, size);
+  }
+
+  rsa_key_cache_set_key(_rsaKeyCache, key);
+}
+
+void BearSSLClient::setEccCertParent(const char cert[])
+{
+  // free old data
+  freeCert(1);
+
+  // assume the decoded cert is 3/4 the length of the input
+  size_t size = ((strlen(cert) * 3) + 3) / 4;
+  byte* der = (byte*)allocate(size);
+  size_t derLen = der ? pemToDer(cert, der, size) : 0;
+
+  if (derLen == 0) {
+    // failure
+    BEAR_SSL_FREE(der);
+    return;
+  }
+
+  setEccCertParent(der, derLen);
+  _ecCertDynamic[1] = true;
+}
+
+void BearSSLClient::setEccCertParent(const char cert[], byte buffer[], size_t size)
+{
+  size_t derLen = pemToDer(cert, buffer, size);
+
+  if (derLen) {
+    setEccCertParent(buffer, derLen);
+  }
+}
+
+void BearSSLClient::setEccCertParent(const byte cert[], int certLength)
+{
+  freeCert(1);
+
+  _ecCert[1].data = (unsigned char*)cert;
+  _ecCert[1].data_len = certLength;
+  _ecChainLen = 2;
+}
+
+int BearSSLClient::setChainPem(const char pem[])
+{
+  // assume the decoded chain is 3/4 the length of the input
+  size_t size = ((strlen(pem) * 3) + 3) / 4;
+  size_t lengths[BEAR_SSL_CLIENT_CHAIN_SIZE];
+  byte* arena = (byte*)allocate(size);
+  int count = arena ? decodeChain(pem, arena, size, lengths) : 0;
+
+  if (count == 0) {
+    BEAR_SSL_FREE(arena);
+    return 0;
+  }
+
+  // give back what the headers and line breaks took
+  size_t used = 0;
+
+  for (int i = 0; i < count; i++) {
+    used += lengths[i];
+  }
+
+  byte* shrunk = (byte*)BEAR_SSL_REALLOC(arena, used);
+
+  if (shrunk) {
+    arena = shrunk;
+  }
+
+  useChain(arena, lengths, count);
+  _ecChainArena = arena;
+
+  return count;
+}
+
+int BearSSLClient::setChainPem(const char pem[], byte buffer[], size_t size)
+{
+  size_t lengths[BEAR_SSL_CLIENT_CHAIN_SIZE];
+  int count = decodeChain(pem, buffer, size, lengths);
+
+  if (count) {
+    useChain(buffer, lengths, count);
+  }
+
+  return count;
+}
+
+int BearSSLClient::decodeChain(const char pem[], byte der[], size_t size, size_t lengths[BEAR_SSL_CLIENT_CHAIN_SIZE])
+{
+  br_pem_decoder_context pemDecoder;
+  PemOutput output = { der, size, 0, false };
+  size_t pemLen = strlen(pem);
+  size_t start = 0;
+  int count = 0;
+  bool cert = false;
+
+  br_pem_decoder_init(&pemDecoder);
+
+  while (pemLen) {
+    size_t len = br_pem_decoder_push(&pemDecoder, pem, pemLen);
+
+    pem += len;
+    pemLen -= len;
+
+    switch (br_pem_decoder_event(&pemDecoder)) {
+      case BR_PEM_BEGIN_OBJ:
+        // other objects of the bundle, e.g. a key, are skipped
+        cert = (strcmp(br_pem_decoder_name(&pemDecoder), "CERTIFICATE") == 0);
+        start = output.length;
+        br_pem_decoder_setdest(&pemDecoder, cert ? BearSSLClient::pemAppend : NULL, &output);
+        break;
+
+      case BR_PEM_END_OBJ:
+        if (!cert || output.length == start) {
+          break;
+        }
+
+        if (output.overflow || count == BEAR_SSL_CLIENT_CHAIN_SIZE) {
+          return 0;
+        }
+
+        lengths[count++] = output.length - start;
+        break;
+
+      case BR_PEM_ERROR:
+        // failure
+        return 0;
+    }
+  }
+
+  return count;
+}
+
+void BearSSLClient::useChain(byte der[], const size_t lengths[], int count)
+{
+  freeCert(0);
+  freeCert(1);
+
+  // the new chain replaces the one of a previous setChainPem()
+  if (_ecChainArena && der != _ecChainArena) {
+    BEAR_SSL_FREE(_ecChainArena);
+  }
+  _ecChainArena = NULL;
+
+  for (int i = 0; i < count; i++) {
+    _ecCert[i].data = der;
+    _ecCert[i].data_len = lengths[i];
+    der += lengths[i];
+  }
+  _ecChainLen = count;
+}
+
+size_t BearSSLClient::pemToDer(const char pem[], byte der[], size_t size)
+{
+  br_pem_decoder_context pemDecoder;
+  PemOutput output = { der, size, 0, false };
+  size_t pemLen = strlen(pem);
+
+  br_pem_decoder_init(&pemDecoder);
+
+  while (pemLen) {
+    size_t len = br_pem_decoder_push(&pemDecoder, pem, pemLen);
+
+    pem += len;
+    pemLen -= len;
+
+    switch (br_pem_decoder_event(&pemDecoder)) {
+      case BR_PEM_BEGIN_OBJ:
+        output.length = 0;
+        br_pem_decoder_setdest(&pemDecoder, BearSSLClient::pemAppend, &output);
+        break;
+
+      case BR_PEM_END_OBJ:
+        if (output.overflow) {
+          return 0;
+        } else if (output.length) {
+          // done
+          return output.length;
+        }
+        break;
+
+      case BR_PEM_ERROR:
+        // failure
+        return 0;
+    }
+  }
+
+  return 0;
+}
+
+void BearSSLClient::freeCert(int index)
+{
+  if (_ecCertDynamic[index] && _ecCert[index].data) {
+    BEAR_SSL_FREE(_ecCert[index].data);
+  }
+
+  _ecCert[index].data = NULL;
+  _ecCert[index].data_len = 0;
+  _ecCertDynamic[index] = false;
+}
+
+int BearSSLClient::errorCode()
+{
+  if (_clientError) {
+    return _clientError;
+  }
+
+  return br_ssl_engine_last_error(&_sc.eng);
+}
+
+int BearSSLClient::connectSSL(const char* host)
+{
+  if (!beginSSL(host)) {
+    return 0;
+  }
+
+  Blocking blocking(this);
+
+  while (poll() == HandshakeState::InProgress);
+
+  return (_handshakeState == HandshakeState::Established);
+}
+
+void BearSSLClient::setTrustAnchorIndex(const br_x509_ta_index_entry* index)
+{
+  _taIndex = index;
+}
+
+int BearSSLClient::buildTrustAnchorIndex(const br_x509_trust_anchor* tas, int count, br_x509_ta_index_entry* index)
+{
+  for (int i = 0; i < count; i++) {
+    br_sha256_context ctx;
+    unsigned char hash[br_sha256_SIZE];
+    br_x509_ta_index_entry entry;
+
+    br_sha256_init(&ctx);
+    br_sha256_update(&ctx, tas[i].dn.data, tas[i].dn.len);
+    br_sha256_out(&ctx, hash);
+
+    memcpy(entry.dn_hash, hash, sizeof(entry.dn_hash));
+    entry.ta = i;
+
+    // insertion sort, this runs once at startup
+    int j = i;
+
+    while (j > 0 && memcmp(index[j - 1].dn_hash, entry.dn_hash, sizeof(entry.dn_hash)) > 0) {
+      index[j] = index[j - 1];
+      j--;
+    }
+
+    index[j] = entry;
+  }
+
+  return count;
+}
+
+void BearSSLClient::setTrustStore(BearSSLTrustStore* store)
+{
+  _trustStore = store;
+}
+
+int BearSSLClient::setTrustAnchorKeyCache(void* buffer, size_t size)
+{
+  if (buffer == NULL) {
+    BEAR_SSL_FREE(_taKeyCache);
+    _taKeyCache = NULL;
+    return 1;
+  }
+
+  if (_taKeyCache == NULL) {
+    _taKeyCache = BEAR_SSL_CONTEXT(ta_key_cache_context, _taKeyCacheStorage);
+
+    if (_taKeyCache == NULL) {
+      return 0;
+    }
+  }
+
+  ta_key_cache_init(_taKeyCache, buffer, size, _TAs, _numTAs);
+
+  return 1;
+}
+
+void BearSSLClient::setPinnedPublicKey(const br_x509_pkey* key)
+{
+  _pinnedKey = (key != NULL);
+
+  if (key == NULL) {
+    return;
+  }
+
+  if (key->key_type == BR_KEYTYPE_RSA) {
+    br_x509_knownkey_init_rsa(&_knownKey, &key->key.rsa, BR_KEYTYPE_KEYX | BR_KEYTYPE_SIGN);
+  } else {
+    br_x509_knownkey_init_ec(&_knownKey, &key->key.ec, BR_KEYTYPE_KEYX | BR_KEYTYPE_SIGN);
+  }
+}
+
+int BearSSLClient::setPinnedSpkiHash(const uint8_t hash[32])
+{
+  if (hash == NULL) {
+    BEAR_SSL_FREE(_pinnedSpki);
+    _pinnedSpki = NULL;
+    return 1;
+  }
+
+  if (_pinnedSpki == NULL) {
+    _pinnedSpki = BEAR_SSL_CONTEXT(x509_pinned_context, _pinnedSpkiStorage);
+
+    if (_pinnedSpki == NULL) {
+      return 0;
+    }
+  }
+
+  x509_pinned_init(_pinnedSpki, hash);
+
+  return 1;
+}
+
+int BearSSLClient::setChainCache(void* buffer, size_t size)
+{
+  if (buffer == NULL) {
+    BEAR_SSL_FREE(_chainCache);
+    _chainCache = NULL;
+    return 1;
+  }
+
+  if (_chainCache == NULL) {
+    _chainCache = BEAR_SSL_CONTEXT(x509_cached_context, _chainCacheStorage);
+
+    if (_chainCache == NULL) {
+      return 0;
+    }
+  }
+
+  x509_cached_init(_chainCache, &_xc, buffer, size);
+
+  return 1;
+}
+
+int BearSSLClient::setRevocationFilter(BearSSLRevocationFilter* filter)
+{
+  if (filter == NULL) {
+    BEAR_SSL_FREE(_revocation);
+    _revocation = NULL;
+    _revocationFilter = NULL;
+    return 1;
+  }
+
+  if (_revocation == NULL) {
+    _revocation = BEAR_SSL_CONTEXT(x509_revocation_context, _revocationStorage);
+
+    if (_revocation == NULL) {
+      return 0;
+    }
+  }
+
+  _revocationFilter = filter;
+
+  return 1;
+}
+
+// the restricted profiles without the algorithms disabled in
+// BearSSLConfig.h; a profile left without a cipher suite is refused
+#define BEAR_SSL_CLIENT_HAS_SHA256_PROFILE (BEARSSL_ENABLE_GCM || BEARSSL_ENABLE_CHACHA || BEARSSL_ENABLE_CBC)
+
+#if BEARSSL_ENABLE_GCM
+static const uint16_t ecdsaGcmSuites[] = {
+  BR_TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256,
+#if BEARSSL_ENABLE_SHA384
+  BR_TLS_ECDHE_ECDSA_WITH_AES_256_GCM_SHA384
+#endif
+};
+
+static const uint16_t minimalSuites[] = {
+  BR_TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256
+};
+#endif
+
+#if BEARSSL_ENABLE_CHACHA
+static const uint16_t chaChaSuites[] = {
+  BR_TLS_ECDHE_ECDSA_WITH_CHACHA20_POLY1305_SHA256,
+#if BEARSSL_ENABLE_RSA
+  BR_TLS_ECDHE_RSA_WITH_CHACHA20_POLY1305_SHA256
+#endif
+};
+#endif
+
+#if BEAR_SSL_CLIENT_HAS_SHA256_PROFILE
+static const uint16_t sha256Suites[] = {
+#if BEARSSL_ENABLE_GCM
+  BR_TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256,
+#if BEARSSL_ENABLE_RSA
+  BR_TLS_ECDHE_RSA_WITH_AES_128_GCM_SHA256,
+#endif
+#endif
+#if BEARSSL_ENABLE_CHACHA
+  BR_TLS_ECDHE_ECDSA_WITH_CHACHA20_POLY1305_SHA256,
+#if BEARSSL_ENABLE_RSA
+  BR_TLS_ECDHE_RSA_WITH_CHACHA20_POLY1305_SHA256,
+#endif
+#endif
+#if BEARSSL_ENABLE_CBC
+  BR_TLS_ECDHE_ECDSA_WITH_AES_128_CBC_SHA256,
+#if BEARSSL_ENABLE_RSA
+  BR_TLS_ECDHE_RSA_WITH_AES_128_CBC_SHA256,
+#endif
+#endif
+};
+#endif
+
+int BearSSLClient::setProfile(Profile profile)
+{
+#ifdef BEAR_SSL_CLIENT_DISABLE_FULL_PROFILE
+  if (profile == Profile::Full) {
+    return 0;
+  }
+#endif
+  if (((profile == Profile::EcdsaGcmOnly || profile == Profile::Minimal) && !BEARSSL_ENABLE_GCM) ||
+      (profile == Profile::ChaChaOnly && !BEARSSL_ENABLE_CHACHA) ||
+      (profile == Profile::Tls12Sha256 && !BEAR_SSL_CLIENT_HAS_SHA256_PROFILE)) {
+    return 0;
+  }
+
+  _profile = profile;
+  _engineReady = false;
+
+  return 1;
+}
+
+void BearSSLClient::initProfile()
+{
+#ifndef BEAR_SSL_CLIENT_DISABLE_FULL_PROFILE
+  if (_profile == Profile::Full) {
+#if BEARSSL_ENABLE_ALL
+    br_ssl_client_init_full(&_sc, &_xc, _TAs, _numTAs);
+#ifdef BEAR_SSL_CLIENT_EC_CURVES
+    br_ssl_engine_set_ec(&_sc.eng, ecImplementation());
+#endif
+#else
+    // br_ssl_client_init_full() would link every algorithm back in
+    br_ssl_client_zero(&_sc);
+    br_x509_minimal_init(&_xc, &br_sha256_vtable, _TAs, _numTAs);
+    ssl_features_init(&_sc.eng, &_xc, ecImplementation());
+#if BEARSSL_ENABLE_RSA
+    br_ssl_client_set_default_rsapub(&_sc);
+#endif
+    br_ssl_engine_set_x509(&_sc.eng, &_xc.vtable);
+#endif
+    return;
+  }
+#endif
+
+  br_ssl_client_zero(&_sc);
+  br_ssl_engine_set_versions(&_sc.eng, BR_TLS12, BR_TLS12);
+  br_x509_minimal_init(&_xc, &br_sha256_vtable, _TAs, _numTAs);
+
+  br_ssl_engine_set_hash(&_sc.eng, br_sha256_ID, &br_sha256_vtable);
+  br_x509_minimal_set_hash(&_xc, br_sha256_ID, &br_sha256_vtable);
+  br_ssl_engine_set_prf_sha256(&_sc.eng, &br_tls12_sha256_prf);
+
+#if BEARSSL_ENABLE_SHA384
+  if (_profile != Profile::Minimal) {
+    br_x509_minimal_set_hash(&_xc, br_sha384_ID, &br_sha384_vtable);
+  }
+
+  // every hash set in the engine is run over the whole handshake; with
+  // SHA-256 alone it is also the only one the signature_algorithms
+  // extension offers, so the server signs with it
+  if (_profile != Profile::Minimal && _profile != Profile::Tls12Sha256) {
+    br_ssl_engine_set_hash(&_sc.eng, br_sha384_ID, &br_sha384_vtable);
+    br_ssl_engine_set_prf_sha384(&_sc.eng, &br_tls12_sha384_prf);
+  }
+#endif
+
+  switch (_profile) {
+#if BEARSSL_ENABLE_CHACHA
+    case Profile::ChaChaOnly:
+      br_ssl_engine_set_suites(&_sc.eng, chaChaSuites, sizeof(chaChaSuites) / sizeof(chaChaSuites[0]));
+      setDefaultEcdsa();
+      setDefaultRsa();
+      br_ssl_engine_set_default_chapol(&_sc.eng);
+      break;
+#endif
+
+#if BEAR_SSL_CLIENT_HAS_SHA256_PROFILE
+    case Profile::Tls12Sha256:
+      br_ssl_engine_set_suites(&_sc.eng, sha256Suites, sizeof(sha256Suites) / sizeof(sha256Suites[0]));
+      setDefaultEcdsa();
+      setDefaultRsa();
+#if BEARSSL_ENABLE_GCM
+      br_ssl_engine_set_default_aes_gcm(&_sc.eng);
+#endif
+#if BEARSSL_ENABLE_CHACHA
+      br_ssl_engine_set_default_chapol(&_sc.eng);
+#endif
+#if BEARSSL_ENABLE_CBC
+      br_ssl_engine_set_default_aes_cbc(&_sc.eng);
+#endif
+      break;
+#endif
+
+#if BEARSSL_ENABLE_GCM
+    case Profile::Minimal:
+      br_ssl_engine_set_suites(&_sc.eng, minimalSuites, sizeof(minimalSuites) / sizeof(minimalSuites[0]));
+      br_ssl_engine_set_ec(&_sc.eng, &br_ec_p256_m15);
+      br_ssl_engine_set_ecdsa(&_sc.eng, br_ecdsa_vrfy_asn1_get_default());
+      br_ssl_engine_set_default_aes_gcm(&_sc.eng);
+      break;
+
+    default:
+      br_ssl_engine_set_suites(&_sc.eng, ecdsaGcmSuites, sizeof(ecdsaGcmSuites) / sizeof(ecdsaGcmSuites[0]));
+      setDefaultEcdsa();
+      br_ssl_engine_set_default_aes_gcm(&_sc.eng);
+      break;
+#else
+    default:
+      break;
+#endif
+  }
+
+  br_x509_minimal_set_ecdsa(&_xc, br_ssl_engine_get_ec(&_sc.eng), br_ssl_engine_get_ecdsa(&_sc.eng));
+  br_ssl_engine_set_x509(&_sc.eng, &_xc.vtable);
+}
+
+void BearSSLClient::setDefaultEcdsa()
+{
+#ifdef BEAR_SSL_CLIENT_EC_CURVES
+  br_ssl_engine_set_ec(&_sc.eng, ecImplementation());
+  br_ssl_engine_set_ecdsa(&_sc.eng, br_ecdsa_vrfy_asn1_get_default());
+#else
+  br_ssl_engine_set_default_ecdsa(&_sc.eng);
+#endif
 }
 
-void BearSSLClient::flush()
+void BearSSLClient::setDefaultRsa()
 {
-  br_sslio_flush(&_ioc);
+#if BEARSSL_ENABLE_RSA
+  br_ssl_engine_set_default_rsavrfy(&_sc.eng);
+  br_x509_minimal_set_rsa(&_xc, br_ssl_engine_get_rsavrfy(&_sc.eng));
+#endif
+}
 
-  _client->flush();
+void BearSSLClient::setSuiteOrder(SuiteOrder order)
+{
+  _suiteOrder = order;
+  _engineReady = false;
 }
 
-void BearSSLClient::stop()
+static bool isChaChaSuite(uint16_t suite)
 {
-  if (_client->connected()) {
-    if ((br_ssl_engine_current_state(&_sc.eng) & BR_SSL_CLOSED) == 0) {
-      br_sslio_close(&_ioc);
-    }
+  return (suite == BR_TLS_ECDHE_ECDSA_WITH_CHACHA20_POLY1305_SHA256 ||
+          suite == BR_TLS_ECDHE_RSA_WITH_CHACHA20_POLY1305_SHA256);
+}
 
-    _client->stop();
+// the suites whose records are MACed with HMAC/SHA-1, all the 3DES ones
+// among them
+static bool isSha1MacSuite(uint16_t suite)
+{
+  switch (suite) {
+    case BR_TLS_ECDHE_ECDSA_WITH_AES_128_CBC_SHA:
+    case BR_TLS_ECDHE_RSA_WITH_AES_128_CBC_SHA:
+    case BR_TLS_ECDHE_ECDSA_WITH_AES_256_CBC_SHA:
+    case BR_TLS_ECDHE_RSA_WITH_AES_256_CBC_SHA:
+    case BR_TLS_ECDH_ECDSA_WITH_AES_128_CBC_SHA:
+    case BR_TLS_ECDH_RSA_WITH_AES_128_CBC_SHA:
+    case BR_TLS_ECDH_ECDSA_WITH_AES_256_CBC_SHA:
+    case BR_TLS_ECDH_RSA_WITH_AES_256_CBC_SHA:
+    case BR_TLS_RSA_WITH_AES_128_CBC_SHA:
+    case BR_TLS_RSA_WITH_AES_256_CBC_SHA:
+    case BR_TLS_ECDHE_ECDSA_WITH_3DES_EDE_CBC_SHA:
+    case BR_TLS_ECDHE_RSA_WITH_3DES_EDE_CBC_SHA:
+    case BR_TLS_ECDH_ECDSA_WITH_3DES_EDE_CBC_SHA:
+    case BR_TLS_ECDH_RSA_WITH_3DES_EDE_CBC_SHA:
+    case BR_TLS_RSA_WITH_3DES_EDE_CBC_SHA:
+      return true;
+
+    default:
+      return false;
   }
 }
 
-uint8_t BearSSLClient::connected()
+void BearSSLClient::orderSuites()
 {
-  if (!_client->connected()) {
-    return 0;
+  bool chaChaFirst = (_suiteOrder == SuiteOrder::ChaChaFirst);
+
+  if (_suiteOrder == SuiteOrder::Auto) {
+    // without AES instructions or peripheral ChaCha20-Poly1305 is the
+    // faster AEAD
+    // (the implementation macros are internal to bearssl, but the
+    // _get_vtable() functions always exist and return NULL when unavailable)
+    chaChaFirst = (br_aes_x86ni_ctr_get_vtable() == NULL &&
+                   br_aes_pwr8_ctr_get_vtable() == NULL &&
+                   br_aes_armv8_ctr_get_vtable() == NULL &&
+                   br_aes_hw_ctr_get_vtable() == NULL);
   }
 
-  unsigned state = br_ssl_engine_current_state(&_sc.eng);
+  // stable partition, keeps the profile's order within each group
+  uint16_t* suites = _sc.eng.suites_buf;
+  size_t count = _sc.eng.suites_num;
+  size_t next = 0;
 
-  if (state == BR_SSL_CLOSED) {
-    return 0;
-  }
+  for (size_t i = 0; i < count; i++) {
+    if (isChaChaSuite(suites[i]) == chaChaFirst) {
+      uint16_t suite = suites[i];
 
-  return 1;
+      memmove(&suites[next + 1], &suites[next], (i - next) * sizeof(suites[0]));
+      suites[next++] = suite;
+    }
+  }
 }
 
-BearSSLClient::operator bool()
+void BearSSLClient::onEngineInit(void (*callback)(br_ssl_engine_context* engine))
 {
-  return (*_client);  
+  _onEngineInitCallback = callback;
+  _engineReady = false;
 }
 
-void BearSSLClient::setInsecure(SNI insecure)
+void BearSSLClient::initLeanMode()
 {
-  switch (insecure) {
-    case SNI::Insecure : _noSNI = true; break;
-    default: _noSNI = false;
+  // every hash set in the engine is run over the whole handshake, TLS 1.2
+  // only needs those of its PRFs and of the signatures
+  br_ssl_engine_set_versions(&_sc.eng, BR_TLS12, BR_TLS12);
+  br_ssl_engine_set_hash(&_sc.eng, br_md5_ID, NULL);
+  br_ssl_engine_set_hash(&_sc.eng, br_sha1_ID, NULL);
+  br_ssl_engine_set_hash(&_sc.eng, br_sha224_ID, NULL);
+  br_ssl_engine_set_prf10(&_sc.eng, NULL);
+
+  // the engine takes the HMAC hash of a CBC suite from the handshake
+  // hashes, those MACed with SHA-1 must not be negotiated without it (the
+  // restricted profiles only have AEAD and SHA-256 suites)
+  uint16_t* suites = _sc.eng.suites_buf;
+  size_t count = _sc.eng.suites_num;
+  size_t next = 0;
+
+  for (size_t i = 0; i < count; i++) {
+    if (!isSha1MacSuite(suites[i])) {
+      suites[next++] = suites[i];
+    }
   }
+  _sc.eng.suites_num = (unsigned char)next;
 }
 
-void BearSSLClient::setEccVrfy(br_ecdsa_vrfy vrfy)
+void BearSSLClient::initImplementations()
 {
-  _ecVrfy = vrfy;
-}
+  // only touch what the profile uses, so unused code is not linked in
+  bool gcm = BEARSSL_ENABLE_GCM && (_profile != Profile::ChaChaOnly);
+  bool chapol = BEARSSL_ENABLE_CHACHA && (_profile == Profile::Full || _profile == Profile::ChaChaOnly || _profile == Profile::Tls12Sha256);
+  bool cbc = BEARSSL_ENABLE_CBC && (_profile == Profile::Full || _profile == Profile::Tls12Sha256);
+
+  (void)gcm;
+  (void)chapol;
+  (void)cbc;
+
+  // the AES peripheral (BR_AES_HW) the engine defaults picked is kept
+  // over any software AES; the vtables are NULL without it
+#ifdef BEAR_SSL_CLIENT_AES_CTR
+  if (gcm && br_aes_hw_ctr_get_vtable() == NULL) {
+    br_ssl_engine_set_aes_ctr(&_sc.eng, BEAR_SSL_CLIENT_AES_CTR);
+  }
+#endif
+#ifdef BEAR_SSL_CLIENT_AES_CBCDEC
+  if (cbc && br_aes_hw_cbcenc_get_vtable() == NULL) {
+    br_ssl_engine_set_aes_cbc(&_sc.eng, BEAR_SSL_CLIENT_AES_CBCENC, BEAR_SSL_CLIENT_AES_CBCDEC);
+  }
+#endif
+#ifdef BEAR_SSL_CLIENT_GHASH
+  if (gcm) {
+    br_ssl_engine_set_ghash(&_sc.eng, BEAR_SSL_CLIENT_GHASH);
+  }
+#endif
+#ifdef BEAR_SSL_CLIENT_POLY1305
+  if (chapol) {
+    br_ssl_engine_set_poly1305(&_sc.eng, BEAR_SSL_CLIENT_POLY1305);
+  }
+#endif
 
-void BearSSLClient::setEccSign(br_ecdsa_sign sign)
-{
-  _ecSign = sign;
+  if (_onEngineInitCallback) {
+    _onEngineInitCallback(&_sc.eng);
+  }
 }
 
-void BearSSLClient::setEccCert(br_x509_certificate cert)
+void BearSSLClient::initEngine()
 {
-  _ecCert[0] = cert;
-  _ecChainLen = 1;
+  // initialize client context with the profile's algorithms and hardcoded trust anchors
+  measureRecords();
+  initProfile();
+  _engineUsed = true;
+  orderSuites();
+  initImplementations();
+  if (_leanMode) {
+    initLeanMode();
+  }
+
+  _baseEc = br_ssl_engine_get_ec(&_sc.eng);
+  _baseRsaVrfy = br_ssl_engine_get_rsavrfy(&_sc.eng);
+  _baseX509Rsa = _xc.irsa;
+  _basePrf10 = _sc.eng.prf10;
+  _basePrfSha256 = _sc.eng.prf_sha256;
+  _basePrfSha384 = _sc.eng.prf_sha384;
+  _baseFlags = br_ssl_engine_get_flags(&_sc.eng);
+  _engineReady = true;
 }
 
-void BearSSLClient::setEccChain(br_x509_certificate* chain, size_t chainLen)
+void BearSSLClient::restoreEngine()
 {
-  if (chainLen > BEAR_SSL_CLIENT_CHAIN_SIZE)
-    return;
-
-  for (size_t i = 0; i < chainLen; i++) {
-    _ecCert[i] = chain[i];
-  }
-  _ecChainLen = chainLen;
+  // undo what beginSSL() wrapped or set for the previous connection only
+  br_ssl_engine_set_ec(&_sc.eng, _baseEc);
+  br_ssl_engine_set_rsavrfy(&_sc.eng, _baseRsaVrfy);
+  br_x509_minimal_set_rsa(&_xc, _baseX509Rsa);
+  _sc.eng.prf10 = _basePrf10;
+  _sc.eng.prf_sha256 = _basePrfSha256;
+  _sc.eng.prf_sha384 = _basePrfSha384;
+  br_ssl_engine_set_all_flags(&_sc.eng, _baseFlags);
+
+  br_ssl_engine_set_x509(&_sc.eng, &_xc.vtable);
+  // transportRead() looks at the error of the last chain before the next
+  // one starts
+  _xc.err = 0;
+  br_x509_minimal_set_ta_loader(&_xc, NULL, NULL);
+  br_x509_minimal_set_ta_rsa_vrfy(&_xc, NULL, NULL);
+  br_x509_minimal_set_ta_ecdsa_vrfy(&_xc, NULL, NULL);
+
+  br_ssl_client_set_ecdhe_key(&_sc, NULL);
+  br_ssl_engine_set_cert_reader(&_sc.eng, NULL, NULL);
+  _sc.client_auth_vtable = NULL;
 }
 
-void BearSSLClient::setEccSlot(int ecc508KeySlot, const byte cert[], int certLength)
+int BearSSLClient::beginSSL(const char* host)
 {
-  // HACK: put the key slot info. in the br_ec_private_key structure
-  _ecKey.curve = 23;
-  _ecKey.x = (unsigned char*)ecc508KeySlot;
-  _ecKey.xlen = 32;
-
-  _ecCert[0].data = (unsigned char*)cert;
-  _ecCert[0].data_len = certLength;
-  _ecChainLen = 1;
-  _ecCertDynamic = false;
+  _clientError = 0;
+  _writePending = false;
+  _recordSent = 0;
+  _recordFill = 0;
+  _lastWrite = millis();
+  _duplexStart = 0;
+  _duplexLen = 0;
+  _pipeLen = 0;
+  _dataPending = false;
+  _closedReported = false;
+  _closing = false;
+
+  if (!allocateBuffers()) {
+    _clientError = BEAR_SSL_CLIENT_ERR_NO_BUFFERS;
+    _handshakeState = HandshakeState::Failed;
+    return 0;
+  }
 
-#ifndef ARDUINO_DISABLE_ECCX08
-  _ecVrfy = eccX08_vrfy_asn1;
-  _ecSign = eccX08_sign_asn1;
-#else
-  _ecVrfy = br_ecdsa_vrfy_asn1_get_default();
-  _ecSign = br_ecdsa_sign_asn1_get_default();
-#endif
-}
+  // the profile's algorithms and the hardcoded trust anchors only need
+  // br_ssl_client_reset() between two connections
+  if (_engineReady) {
+    restoreEngine();
+  } else {
+    initEngine();
+  }
+  if (_workerCore) {
+    // before the ECCX08 wraps the EC implementation, so that its ECDH
+    // stays on this core
+    br_rsa_pkcs1_vrfy rsaVrfy = worker_core_rsa_pkcs1_vrfy(br_ssl_engine_get_rsavrfy(&_sc.eng));
+
+    br_ssl_engine_set_ec(&_sc.eng, worker_core_ec_impl(br_ssl_engine_get_ec(&_sc.eng)));
+    if (rsaVrfy) {
+      br_ssl_engine_set_rsavrfy(&_sc.eng, rsaVrfy);
+      br_x509_minimal_set_rsa(&_xc, rsaVrfy);
+    }
+  }
+  if (_cryptoHooks) {
+    // outside the worker core, the clock is raised for its whole job
+    br_rsa_pkcs1_vrfy rsaVrfy = crypto_hooks_rsa_pkcs1_vrfy(br_ssl_engine_get_rsavrfy(&_sc.eng));
+
+    br_ssl_engine_set_ec(&_sc.eng, crypto_hooks_ec_impl(br_ssl_engine_get_ec(&_sc.eng)));
+    if (rsaVrfy) {
+      br_ssl_engine_set_rsavrfy(&_sc.eng, rsaVrfy);
+      br_x509_minimal_set_rsa(&_xc, rsaVrfy);
+    }
+    crypto_hooks_prf(&_sc.eng);
+  }
+  br_x509_minimal_set_ta_index(&_xc, _taIndex);
+  if (_trustStore) {
+    br_x509_minimal_set_ta_loader(&_xc, BearSSLTrustStore::load, _trustStore);
+  }
+  if (_taKeyCache) {
+    br_x509_minimal_set_ta_rsa_vrfy(&_xc, ta_key_cache_rsa_vrfy, _taKeyCache);
 
-void BearSSLClient::setEccSlot(int ecc508KeySlot, const char cert[])
-{
-  // try to decode the cert
-  br_pem_decoder_context pemDecoder;
+    // the EC keys only serve the software verifier, not the ECCX08
+    if (_ecVrfy == br_ecdsa_vrfy_asn1_get_default()) {
+      br_x509_minimal_set_ta_ecdsa_vrfy(&_xc, ta_key_cache_ecdsa_vrfy, _taKeyCache);
+    }
+  }
 
-  size_t certLen = strlen(cert);
+  if (_pinnedKey) {
+    br_ssl_engine_set_x509(&_sc.eng, &_knownKey.vtable);
+  } else if (_pinnedSpki) {
+    br_ssl_engine_set_x509(&_sc.eng, &_pinnedSpki->vtable);
+  } else if (_chainCache) {
+    br_ssl_engine_set_x509(&_sc.eng, &_chainCache->vtable);
+  }
 
-  // free old data
-  if (_ecCertDynamic && _ecCert[0].data) {
-    free(_ecCert[0].data);
-    _ecCert[0].data = NULL;
+  // the revocation check wraps whichever validation was chosen
+  if (_revocation) {
+    x509_revocation_init(_revocation, _sc.eng.x509ctx, BearSSLRevocationFilter::check, _revocationFilter, BEAR_SSL_CLIENT_ERR_REVOKED);
+    br_ssl_engine_set_x509(&_sc.eng, &_revocation->vtable);
   }
 
-  // assume the decoded cert is 3/4 the length of the input
-  _ecCert[0].data = (unsigned char*)malloc(((certLen * 3) + 3) / 4);
-  _ecCert[0].data_len = 0;
-  _ecChainLen = 1;
+  if (_onPeerCertificateCallback || _peerSpill) {
+    _peerLength = 0;
+    x509_peer_init(&_x509Peer, _sc.eng.x509ctx, &_sc.eng, peerCertificateReady, this, _peerSpill, _peerSpillSize);
+    br_ssl_engine_set_x509(&_sc.eng, &_x509Peer.vtable);
+  }
 
-  br_pem_decoder_init(&pemDecoder);
+  if (_handshakeTiming) {
+    memset(&_handshakeStats, 0x00, sizeof(_handshakeStats));
+    markStep(_handshakeStats.connected);
+    x509_timing_init(&_x509Timing, _sc.eng.x509ctx, micros);
+    br_ssl_engine_set_x509(&_sc.eng, &_x509Timing.vtable);
+  }
 
-  while (certLen) {
-    size_t len = br_pem_decoder_push(&pemDecoder, cert, certLen);
+  if (_handshakeReporting) {
+    // connecting the transport is waiting too
+    memset(&_handshakeReport, 0x00, sizeof(_handshakeReport));
+    _handshakeReport.waiting = micros() - _connectStart;
+    _reportIdle = false;
+  }
 
-    cert += len;
-    certLen -= len;
+  if (_memoryStats) {
+    // keep the marks of the previous connection
+    measureBuffers();
+    memset(_ibuf, MEMORY_PAINT, _ibufSize);
+    if (_obuf) {
+      memset(_obuf, MEMORY_PAINT, _obufSize);
+    }
+    _buffersPainted = true;
+  }
 
-    switch (br_pem_decoder_event(&pemDecoder)) {
-      case BR_PEM_BEGIN_OBJ:
-        br_pem_decoder_setdest(&pemDecoder, BearSSLClient::clientAppendCert, this);
-        break;
+  unsigned char* obuf = _obuf;
+  size_t obufSize = _obufSize;
 
-      case BR_PEM_END_OBJ:
-        if (_ecCert[0].data_len) {
-          // done
-          setEccSlot(ecc508KeySlot, _ecCert[0].data, _ecCert[0].data_len);
-          _ecCertDynamic = true;
-          return;
-        }
-        break;
+  // records sealed in place in the driver's buffer
+  if (_transport) {
+    size_t size;
+    uint8_t* buffer = _transport->acquireTxBuffer(size);
 
-      case BR_PEM_ERROR:
-        // failure
-        free(_ecCert[0].data);
-        setEccSlot(ecc508KeySlot, NULL, 0);
-        return;
+    if (buffer != NULL && size >= 512 + BEAR_SSL_RECORD_OUT_OVERHEAD) {
+      obuf = buffer;
+      obufSize = size;
     }
   }
-}
 
-void BearSSLClient::setKey(const char key[], const char cert[])
-{
-  // try to decode the key and cert
-  br_pem_decoder_context pemDecoder;
+  br_ssl_engine_set_buffers_bidi(&_sc.eng, _ibuf, _ibufSize, obuf, obufSize);
 
-  size_t keyLen = strlen(key);
-  size_t certLen = strlen(cert);
+  // a renegotiation would validate the chain again in _xc
+  if (_reuseHandshakeMemory || _leanMode) {
+    br_ssl_engine_add_flags(&_sc.eng, BR_OPT_NO_RENEGOTIATION);
+  }
 
-  br_pem_decoder_init(&pemDecoder);
+  if (_fixedSeed) {
+    // the same state on every connect(), without the system seeder
+    br_hmac_drbg_init(&_sc.eng.rng, &br_sha256_vtable, _fixedSeed, _fixedSeedLength);
+    _sc.eng.rng_init_done = 2;
+    _sc.eng.rng_os_rand_done = 1;
+  } else {
+    // inject entropy in engine
+    unsigned char entropy[32];
+
+    getEntropy(entropy, sizeof(entropy));
+    br_ssl_engine_inject_entropy(&_sc.eng, entropy, sizeof(entropy));
+  }
+
+  _eccEcdhPending = false;
+#ifndef ARDUINO_DISABLE_ECCX08
+  // a key precomputed in software is still used first, otherwise poll()
+  // has the chip make one once the ClientHello is sent
+  if (_eccEcdhSlot >= 0 && br_ssl_engine_get_ec(&_sc.eng) != NULL) {
+    _eccEcdhPending = !_ecdheKey.curve;
+    br_ssl_engine_set_ec(&_sc.eng, eccX08_ec_impl(br_ssl_engine_get_ec(&_sc.eng)));
+  }
+#endif
 
-  if (_skeyDecoder == NULL) {
-    _skeyDecoder = (br_skey_decoder_context*)malloc(sizeof(br_skey_decoder_context));
+  if (_ecdheKey.curve || _eccEcdhPending) {
+    br_ssl_client_set_ecdhe_key(&_sc, &_ecdheKey);
   }
 
-  br_skey_decoder_init(_skeyDecoder);
+  // add custom ECDSA vfry and EC sign
+  br_ssl_engine_set_ecdsa(&_sc.eng, _ecVrfy);
+  br_x509_minimal_set_ecdsa(&_xc, br_ssl_engine_get_ec(&_sc.eng), br_ssl_engine_get_ecdsa(&_sc.eng));
 
-  while (keyLen) {
-    size_t len = br_pem_decoder_push(&pemDecoder, key, keyLen);
+  // enable client auth
+  const br_x509_certificate* chain = _certChain ? _certChain : _ecCert;
+  size_t chainLen = _certChain ? _certChainLen : (_ecCert[0].data_len ? _ecChainLen : 0);
+
+  if (chainLen) {
+    if (_clientKeyType) {
+      if (_clientKeyType == BR_KEYTYPE_EC) {
+        br_ssl_client_set_single_ec(&_sc, chain, chainLen, &_clientEcKey, BR_KEYTYPE_KEYX | BR_KEYTYPE_SIGN, BR_KEYTYPE_EC, br_ssl_engine_get_ec(&_sc.eng), br_ecdsa_sign_asn1_get_default());
+      } else if (BEARSSL_ENABLE_RSA && _clientKeyType == BR_KEYTYPE_RSA) {
+        const br_rsa_private_key* rsaKey = &_clientRsaKey;
+
+        if (_rsaKeyCache == NULL) {
+          prepareRsaKey();
+        }
 
-    key += len;
-    keyLen -= len;
+        const br_rsa_private_key* cachedKey = _rsaKeyCache ? rsa_key_cache_set_key(_rsaKeyCache, rsaKey) : NULL;
 
-    switch (br_pem_decoder_event(&pemDecoder)) {
-      case BR_PEM_BEGIN_OBJ:
-        br_pem_decoder_setdest(&pemDecoder, BearSSLClient::clientAppendKey, this);
-        break;
+        br_rsa_pkcs1_sign rsaSign = cachedKey ? rsa_key_cache_get_sign(_rsaKeyCache) : br_rsa_pkcs1_sign_get_default();
 
-      case BR_PEM_END_OBJ:
-        if (br_skey_decoder_last_error(_skeyDecoder) != 0) {
-          return;
+        if (_cryptoHooks) {
+          rsaSign = crypto_hooks_rsa_pkcs1_sign(rsaSign);
         }
-        break;
 
-      case BR_PEM_ERROR:
-        return;
+        br_ssl_client_set_single_rsa(&_sc, chain, chainLen, cachedKey ? cachedKey : rsaKey, rsaSign);
+      }
+    } else {
+      br_ssl_client_set_single_ec(&_sc, chain, chainLen, &_ecKey, BR_KEYTYPE_KEYX | BR_KEYTYPE_SIGN, BR_KEYTYPE_EC, br_ssl_engine_get_ec(&_sc.eng), _ecSign);
     }
-  }
 
-  // assume the decoded cert is 3/4 the length of the input
-  _ecCert[0].data = (unsigned char*)malloc(((certLen * 3) + 3) / 4);
-  _ecCert[0].data_len = 0;
-  _ecChainLen = 1;
+    if (_certChain) {
+      br_ssl_engine_set_cert_reader(&_sc.eng, _certReader, _certReaderContext);
+    }
+  }
 
-  br_pem_decoder_init(&pemDecoder);
+  if (_pskIdentity != NULL) {
+    BearSSLSessionStore::pskSession(_pskIdentity, _pskKey, _pskKeyLength, &_session);
+    _sessionValid = true;
+  }
 
-  while (certLen) {
-    size_t len = br_pem_decoder_push(&pemDecoder, cert, certLen);
+  // offer the saved session, if any, the server decides whether to resume it
+  bool resume = (_resumeSession || _sessionStore || _pskIdentity) && _sessionValid;
 
-    cert += len;
-    certLen -= len;
+  if (resume) {
+    br_ssl_engine_set_session_parameters(&_sc.eng, &_session);
+  }
+  _sessionResumed = false;
 
-    switch (br_pem_decoder_event(&pemDecoder)) {
-      case BR_PEM_BEGIN_OBJ:
-        br_pem_decoder_setdest(&pemDecoder, BearSSLClient::clientAppendCert, this);
-        break;
+  // set the hostname used for SNI
+  br_ssl_client_reset(&_sc, host, resume ? 1 : 0);
 
-      case BR_PEM_END_OBJ:
-        if (_ecCert[0].data_len) {
-          // done
-          _ecCertDynamic = true;
-          return;
-        }
-        break;
+  // get the current time and set it for X.509 validation, a pinned key or
+  // SPKI never looks at the validity dates: skip the (network) time query
+  if (!_pinnedKey && _pinnedSpki == NULL) {
+    uint32_t now = ArduinoBearSSL.getTime();
+    uint32_t days = now / 86400 + 719528;
+    uint32_t sec = now % 86400;
 
-      case BR_PEM_ERROR:
-        // failure
-        free(_ecCert[0].data);
-        _ecCert[0].data = NULL;
-        return;
-    }
+    br_x509_minimal_set_time(&_xc, days, sec);
   }
-}
 
-void BearSSLClient::setEccCertParent(const char cert[])
-{
-  // try to decode the cert
-  br_pem_decoder_context pemDecoder;
+  // use our own socket I/O operations
+  br_sslio_init(&_ioc, &_sc.eng, BearSSLClient::clientRead, this, BearSSLClient::clientWrite, this);
 
-  size_t certLen = strlen(cert);
+  _handshakeStart = millis();
+  _ioWaiting = false;
 
-  // free old data
-  if (_ecCertDynamic && _ecCert[1].data) {
-    free(_ecCert[1].data);
-    _ecCert[1].data = NULL;
+  // push out the ClientHello, poll() drives the rest of the handshake
+  br_ssl_engine_flush(&_sc.eng, 0);
+
+  if (br_ssl_engine_current_state(&_sc.eng) & BR_SSL_CLOSED) {
+    _handshakeState = HandshakeState::Failed;
+    returnBuffers();
+    return 0;
   }
 
-  // assume the decoded cert is 3/4 the length of the input
-  _ecCert[1].data = (unsigned char*)malloc(((certLen * 3) + 3) / 4);
-  _ecCert[1].data_len = 0;
-  _ecChainLen = 2;
+  _handshakeState = HandshakeState::InProgress;
+  traceHandshake();
 
-  br_pem_decoder_init(&pemDecoder);
+  return 1;
+}
 
-  while (certLen) {
-    size_t len = br_pem_decoder_push(&pemDecoder, cert, certLen);
+bool BearSSLClient::ioExpired()
+{
+  if (_ioTimeout == 0) {
+    return false;
+  }
 
-    cert += len;
-    certLen -= len;
+  unsigned long now = millis();
 
-    switch (br_pem_decoder_event(&pemDecoder)) {
-      case BR_PEM_BEGIN_OBJ:
-        br_pem_decoder_setdest(&pemDecoder, BearSSLClient::parentAppendCert, this);
-        break;
+  if (!_ioWaiting) {
+    _ioWaiting = true;
+    _ioWaitStart = now;
+  } else if ((now - _ioWaitStart) >= _ioTimeout) {
+    _clientError = BEAR_SSL_CLIENT_ERR_TIMEOUT;
+    return true;
+  }
 
-      case BR_PEM_END_OBJ:
-        if (_ecCert[1].data_len) {
-          // done
-          _ecCertDynamic = true;
-          return;
-        }
-        break;
+  return false;
+}
 
-      case BR_PEM_ERROR:
-        // failure
-        free(_ecCert[1].data);
-        return;
-    }
+void BearSSLClient::ioIdle()
+{
+  if (_ioBlocking && _onWaitCallback) {
+    _onWaitCallback(*this);
   }
 }
 
-int BearSSLClient::errorCode()
+void BearSSLClient::getEntropy(unsigned char* entropy, size_t length)
 {
-  return br_ssl_engine_last_error(&_sc.eng);
+  // forked from the shared DRBG, which falls back to pseudo random
+  // without a secure element or system seeder
+  ArduinoBearSSL.getRandom(entropy, length);
 }
 
-int BearSSLClient::connectSSL(const char* host)
+// #define DEBUGSERIAL Serial
+
+int BearSSLClient::clientRead(void *ctx, unsigned char *buf, size_t len)
 {
-  // initialize client context with all algorithms and hardcoded trust anchors
-  br_ssl_client_init_full(&_sc, &_xc, _TAs, _numTAs);
+  BearSSLClient* bc = (BearSSLClient*)ctx;
 
-  br_ssl_engine_set_buffers_bidi(&_sc.eng, _ibuf, sizeof(_ibuf), _obuf, sizeof(_obuf));
+  if (!bc->_trace && (!bc->_handshakeReporting || bc->_handshakeState != HandshakeState::InProgress)) {
+    return transportRead(ctx, buf, len);
+  }
 
-  // inject entropy in engine
-  unsigned char entropy[32];
+  return bc->measureIo(false, buf, len);
+}
 
-#ifndef ARDUINO_DISABLE_ECCX08
-  if (!ECCX08.begin() || !ECCX08.locked() || !ECCX08.random(entropy, sizeof(entropy))) {
-#endif
-    // no ECCX08 or random failed, fallback to pseudo random
-    for (size_t i = 0; i < sizeof(entropy); i++) {
-      entropy[i] = random(0, 255);
-    }
-#ifndef ARDUINO_DISABLE_ECCX08
+int BearSSLClient::clientWrite(void *ctx, const unsigned char *buf, size_t len)
+{
+  BearSSLClient* bc = (BearSSLClient*)ctx;
+
+  if (!bc->_trace && (!bc->_handshakeReporting || bc->_handshakeState != HandshakeState::InProgress)) {
+    return transportWrite(ctx, buf, len);
   }
-#endif
-  br_ssl_engine_inject_entropy(&_sc.eng, entropy, sizeof(entropy));
 
-  // add custom ECDSA vfry and EC sign
-  br_ssl_engine_set_ecdsa(&_sc.eng, _ecVrfy);
-  br_x509_minimal_set_ecdsa(&_xc, br_ssl_engine_get_ec(&_sc.eng), br_ssl_engine_get_ecdsa(&_sc.eng));
+  return bc->measureIo(true, (unsigned char*)buf, len);
+}
 
-  // enable client auth
-  if (_ecCert[0].data_len) {
-    if (_skeyDecoder) {
-      int skeyType = br_skey_decoder_key_type(_skeyDecoder);
-
-      if (skeyType == BR_KEYTYPE_EC) {
-        br_ssl_client_set_single_ec(&_sc, _ecCert, _ecChainLen, br_skey_decoder_get_ec(_skeyDecoder), BR_KEYTYPE_KEYX | BR_KEYTYPE_SIGN, BR_KEYTYPE_EC, br_ec_get_default(), br_ecdsa_sign_asn1_get_default());
-      } else if (skeyType == BR_KEYTYPE_RSA) {
-        br_ssl_client_set_single_rsa(&_sc, _ecCert, _ecChainLen, br_skey_decoder_get_rsa(_skeyDecoder), br_rsa_pkcs1_sign_get_default());
-      }
-    } else {
-      br_ssl_client_set_single_ec(&_sc, _ecCert, _ecChainLen, &_ecKey, BR_KEYTYPE_KEYX | BR_KEYTYPE_SIGN, BR_KEYTYPE_EC, br_ec_get_default(), _ecSign);
-    }
+int BearSSLClient::measureIo(bool out, unsigned char* buf, size_t len)
+{
+  bool reporting = _handshakeReporting && _handshakeState == HandshakeState::InProgress;
+  unsigned long start = micros();
+
+  if (_trace) {
+    _trace->state(br_ssl_engine_current_state(&_sc.eng));
   }
 
-  // set the hostname used for SNI
-  br_ssl_client_reset(&_sc, host, 0);
+  // nothing came in or out since the last call, the engine only looped
+  if (reporting && _reportIdle) {
+    _handshakeReport.waiting += start - _reportLast;
+  }
 
-  // get the current time and set it for X.509 validation
-  uint32_t now = ArduinoBearSSL.getTime();
-  uint32_t days = now / 86400 + 719528;
-  uint32_t sec = now % 86400;
+  int result = out ? transportWrite(this, buf, len) : transportRead(this, buf, len);
 
-  br_x509_minimal_set_time(&_xc, days, sec);
+  if (reporting) {
+    _reportLast = micros();
+    _reportIdle = (result == 0);
+    _handshakeReport.waiting += _reportLast - start;
+    if (result > 0) {
+      (out ? _handshakeReport.bytesSent : _handshakeReport.bytesReceived) += result;
+    }
+  }
 
-  // use our own socket I/O operations
-  br_sslio_init(&_ioc, &_sc.eng, BearSSLClient::clientRead, _client, BearSSLClient::clientWrite, _client);
+  if (_trace) {
+    _trace->transport(out, buf, result);
+  }
 
-  br_sslio_flush(&_ioc);
+  return result;
+}
 
-  while (1) {
-    unsigned state = br_ssl_engine_current_state(&_sc.eng);
+int BearSSLClient::transportRead(void *ctx, unsigned char *buf, size_t len)
+{
+  BearSSLClient* bc = (BearSSLClient*)ctx;
+  Client* c = bc->_client;
+
+  // the X.509 engine rejects the end-entity certificate (wrong host name,
+  // expired, ...) as soon as it is parsed, before any signature check:
+  // fail right away instead of receiving the rest of the chain first
+  if (bc->_handshakeState == HandshakeState::InProgress && bc->_xc.err != 0 && bc->_xc.err != BR_ERR_X509_OK) {
+    br_ssl_engine_fail(&bc->_sc.eng, bc->_xc.err);
+    return -1;
+  }
 
-    if (state & BR_SSL_SENDAPP) {
-      break;
-    } else if (state & BR_SSL_CLOSED) {
-      return 0;
+  int result;
+
+  if (bc->_transport) {
+    result = bc->_transport->read(buf, len);
+    if (result < 0) {
+      return -1;
     }
-  }
+  } else {
+    if (bc->_readAhead) {
+      int available = c->available();
 
-  return 1;
-}
+      if (available <= 0) {
+        if (!c->connected()) {
+          return -1;
+        }
 
-// #define DEBUGSERIAL Serial
+        if (bc->ioExpired()) {
+          return -1;
+        }
 
-int BearSSLClient::clientRead(void *ctx, unsigned char *buf, size_t len)
-{
-  Client* c = (Client*)ctx;
+        bc->ioIdle();
+        return 0;
+      }
 
-  if (!c->connected()) {
-    return -1;
+      if ((size_t)available < len) {
+        len = available;
+      }
+    } else if (!c->connected()) {
+      return -1;
+    }
+
+    result = c->read(buf, len);
   }
 
-  int result = c->read(buf, len);
-  if (result == -1) {
+  if (result <= 0) {
+    // nothing received yet, give up once the I/O deadline has passed
+    if (bc->ioExpired()) {
+      return -1;
+    }
+
+    bc->ioIdle();
     return 0;
   }
 
+  bc->_ioWaiting = false;
+
+  if (bc->_handshakeState == HandshakeState::InProgress) {
+    bc->markStep(bc->_handshakeStats.serverHelloReceived);
+  }
+
 #ifdef DEBUGSERIAL
   DEBUGSERIAL.print("BearSSLClient::clientRead - ");
   DEBUGSERIAL.print(result);
@@ -536,9 +3505,10 @@ int BearSSLClient::clientRead(void *ctx, unsigned char *buf, size_t len)
   return result;
 }
 
-int BearSSLClient::clientWrite(void *ctx, const unsigned char *buf, size_t len)
+int BearSSLClient::transportWrite(void *ctx, const unsigned char *buf, size_t len)
 {
-  Client* c = (Client*)ctx;
+  BearSSLClient* bc = (BearSSLClient*)ctx;
+  Client* c = bc->_client;
 
 #ifdef DEBUGSERIAL
   DEBUGSERIAL.print("BearSSLClient::clientWrite - ");
@@ -555,38 +3525,63 @@ int BearSSLClient::clientWrite(void *ctx, const unsigned char *buf, size_t len)
   DEBUGSERIAL.println();
 #endif
 
-  if (!c->connected()) {
-    return -1;
+  int result;
+
+  if (bc->_transport) {
+    result = bc->_transport->commit(buf, len);
+    if (result < 0) {
+      return -1;
+    }
+  } else {
+    if (!c->connected()) {
+      return -1;
+    }
+
+    result = c->write(buf, len);
   }
 
-  int result = c->write(buf, len);
   if (result == 0) {
-    return -1;
+    // without a deadline a stalled write is an error, otherwise retry until it expires
+    if (bc->_ioTimeout == 0 || bc->ioExpired()) {
+      return -1;
+    }
+
+    bc->ioIdle();
+    return 0;
   }
 
-  return result;
-}
+  bc->_ioWaiting = false;
 
-void BearSSLClient::clientAppendCert(void *ctx, const void *data, size_t len)
-{
-  BearSSLClient* c = (BearSSLClient*)ctx;
+  if (bc->_handshakeState == HandshakeState::InProgress && bc->_handshakeTiming) {
+    BearSSLHandshakeStats& stats = bc->_handshakeStats;
+
+    bc->markStep(stats.clientHelloSent);
 
-  memcpy(&c->_ecCert[0].data[c->_ecCert[0].data_len], data, len);
-  c->_ecCert[0].data_len += len;
+    // the second flight starts once the chain and the server's key
+    // exchange have been checked and the ECDHE computed
+    if (bc->_x509Timing.ended) {
+      bc->markStep(stats.keyExchangeSent);
+    }
+  }
+
+  return result;
 }
 
 void BearSSLClient::clientAppendKey(void *ctx, const void *data, size_t len)
 {
-  BearSSLClient* c = (BearSSLClient*)ctx;
-
-  br_skey_decoder_push(c->_skeyDecoder, data, len);
+  br_skey_decoder_push((br_skey_decoder_context*)ctx, data, len);
 }
 
-void BearSSLClient::parentAppendCert(void *ctx, const void *data, size_t len)
+void BearSSLClient::pemAppend(void *ctx, const void *data, size_t len)
 {
-  BearSSLClient* c = (BearSSLClient*)ctx;
+  PemOutput* output = (PemOutput*)ctx;
+
+  if (len > output->size - output->length) {
+    output->overflow = true;
+    return;
+  }
 
-  memcpy(&c->_ecCert[1].data[c->_ecCert[1].data_len], data, len);
-  c->_ecCert[1].data_len += len;
+  memcpy(&output->der[output->length], data, len);
+  output->length += len;
 }
 
@@ -25,23 +25,137 @@
 #ifndef _BEAR_SSL_CLIENT_H_
 #define _BEAR_SSL_CLIENT_H_
 
+// worst case record overhead on top of the plaintext, see ssl_engine.c
+#define BEAR_SSL_RECORD_IN_OVERHEAD 325
+#define BEAR_SSL_RECORD_OUT_OVERHEAD 85
+
 #ifndef BEAR_SSL_CLIENT_OBUF_SIZE
-#define BEAR_SSL_CLIENT_OBUF_SIZE 512 + 85
+#define BEAR_SSL_CLIENT_OBUF_SIZE 512 + BEAR_SSL_RECORD_OUT_OVERHEAD
 #endif
 
 #ifndef BEAR_SSL_CLIENT_IBUF_SIZE
-#define BEAR_SSL_CLIENT_IBUF_SIZE 8192 + 85 + 325 - BEAR_SSL_CLIENT_OBUF_SIZE
+#define BEAR_SSL_CLIENT_IBUF_SIZE 8192 + BEAR_SSL_RECORD_OUT_OVERHEAD + BEAR_SSL_RECORD_IN_OVERHEAD - BEAR_SSL_CLIENT_OBUF_SIZE
 #endif
 
 #ifndef BEAR_SSL_CLIENT_CHAIN_SIZE
 #define BEAR_SSL_CLIENT_CHAIN_SIZE 3
 #endif
 
+// setRecordSizing() defaults: bytes sent in small records before they grow
+// to the output buffer size, and the idle time that makes them small again
+#ifndef BEAR_SSL_RECORD_BOOST_AFTER
+#define BEAR_SSL_RECORD_BOOST_AFTER 16384
+#endif
+
+#ifndef BEAR_SSL_RECORD_IDLE_TIMEOUT
+#define BEAR_SSL_RECORD_IDLE_TIMEOUT 1000
+#endif
+
+// with BEARSSL_NO_HEAP the client takes nothing from the heap: the record
+// buffers must come from setBuffers() or setBufferPool(), PEM text is
+// only decoded by the overloads with a buffer, and the optional contexts
+// and the setKey() key are kept in the object
+#ifdef BEARSSL_NO_HEAP
+#ifndef BEAR_SSL_CLIENT_KEY_SIZE
+#ifdef BEAR_SSL_EC_ONLY
+#define BEAR_SSL_CLIENT_KEY_SIZE 66
+#else
+// the CRT factors of a 2048-bit RSA key, an EC key needs at most 66
+#define BEAR_SSL_CLIENT_KEY_SIZE 640
+#endif
+#endif
+#endif
+
+// bytes per entry of a setChainCache() buffer
+#define BEAR_SSL_CHAIN_CACHE_RECORD_SIZE X509_CACHED_RECORD_SIZE
+
+// errors reported by errorCode() in addition to the BR_ERR_* engine codes
+#define BEAR_SSL_CLIENT_ERR_TIMEOUT     1024 // handshake or I/O deadline expired
+#define BEAR_SSL_CLIENT_ERR_NO_BUFFERS  1025 // record buffers could not be obtained
+#define BEAR_SSL_CLIENT_ERR_REVOKED     1026 // a certificate of the chain is revoked
+#define BEAR_SSL_CLIENT_ERR_NOT_RESUMED 1027 // the server did not resume the PSK session
+
 #include <Arduino.h>
 #include <Client.h>
 
 #include "bearssl/bearssl.h"
 
+#include "BearSSLBufferPool.h"
+#include "BearSSLCertificate.h"
+#include "BearSSLConfig.h"
+#include "BearSSLDeviceCertCache.h"
+#include "BearSSLRevocationFilter.h"
+#include "BearSSLSessionStore.h"
+#include "BearSSLTrace.h"
+#include "BearSSLTransport.h"
+#include "BearSSLTrustStore.h"
+#include "SecureElement.h"
+#include "utility/ta_key_cache.h"
+#include "utility/rsa_key_cache.h"
+#include "utility/x509_cached.h"
+#include "utility/x509_peer.h"
+#include "utility/x509_pinned.h"
+#include "utility/x509_revocation.h"
+#include "utility/x509_timing.h"
+
+struct BearSSLIoVec {
+  const uint8_t* data;
+  size_t length;
+};
+
+// see BearSSLClient::memoryStats()
+struct BearSSLMemoryStats {
+  size_t ibufUsed;      // high-water marks of the record buffers
+  size_t ibufSize;
+  size_t obufUsed;
+  size_t obufSize;
+  size_t recordIn;      // largest encrypted record received (with header)
+  size_t recordOut;     // largest record sent (with header and overhead)
+  size_t stackUsed;     // deepest stack below poll() during handshakes
+  size_t heapAllocated; // total requested from the heap by this client
+  size_t heapLargest;   // largest single request (e.g. the key decoder)
+};
+
+// microseconds from the start of connect() to each step of the last
+// handshake timed, 0 for the steps it did not reach or skipped (a resumed
+// session has no certificate and key exchange)
+struct BearSSLHandshakeStats {
+  unsigned long connected;            // transport connected (TCP, ...)
+  unsigned long clientHelloSent;
+  unsigned long serverHelloReceived;  // first bytes of the server's answer
+  unsigned long certificateReceived;  // start of its Certificate message
+  unsigned long certificateValidated; // chain verified up to a trust anchor
+  unsigned long keyExchangeSent;      // ClientKeyExchange after the ECDHE
+  unsigned long finished;             // server Finished checked
+  unsigned long eccX08Ecdh;           // duration of the ECCX08 GenKey
+};
+
+// current draw of the board, for the energy estimate of
+// BearSSLClient::getHandshakeReport()
+struct BearSSLPowerProfile {
+  float voltage;       // V
+  float activeCurrent; // mA while computing
+  float waitCurrent;   // mA while waiting on the transport
+  float txEnergy;      // uJ per byte sent (e.g. by the radio)
+  float rxEnergy;      // uJ per byte received
+};
+
+// CPU and wait time of the last handshake reported, from the start of
+// connect(): the time spent in the transport (connecting, sending,
+// receiving and onWait()) and spinning between two transport calls that
+// moved nothing is waiting, the rest is busy
+struct BearSSLHandshakeReport {
+  unsigned long total;   // microseconds until established or failed
+  unsigned long busy;
+  unsigned long waiting;
+  size_t bytesSent;      // TLS records, with their headers
+  size_t bytesReceived;
+  bool established;
+  bool resumed;
+  uint16_t suite;        // negotiated cipher suite, 0 if none
+  float energy;          // mJ from the power profile, 0 without one
+};
+
 class BearSSLClient : public Client {
 
 public:
@@ -52,18 +166,304 @@ public:
 
 
   inline void setClient(Client& client) { _client = &client; }
+  inline Client* getClient() { return _client; }
 
 
   virtual int connect(IPAddress ip, uint16_t port);
   virtual int connect(const char* host, uint16_t port);
+
+  enum class HandshakeState {
+    Idle,
+    InProgress,
+    Established,
+    Failed
+  };
+
+  // start the TLS handshake without waiting for it, call poll() until it
+  // no longer reports HandshakeState::InProgress
+  int connectAsync(IPAddress ip, uint16_t port);
+  int connectAsync(const char* host, uint16_t port);
+  HandshakeState poll();
+  HandshakeState handshakeState();
+
+  // queue the first request for the next handshake, it is sealed and sent
+  // as soon as the handshake completes, before connect() returns or poll()
+  // reports HandshakeState::Established. data must stay valid until then.
+  void setEarlyData(const uint8_t* data, size_t length);
+
+  // look trust anchors up by binary search instead of hashing every DN,
+  // index must have one entry per anchor (see buildTrustAnchorIndex())
+  void setTrustAnchorIndex(const br_x509_ta_index_entry* index);
+  static int buildTrustAnchorIndex(const br_x509_trust_anchor* tas, int count, br_x509_ta_index_entry* index);
+
+  // look up issuers that are not among the trust anchors in a store
+  void setTrustStore(BearSSLTrustStore* store);
+
+  // keep trust anchor keys decoded in buffer after their first use, so
+  // later handshakes skip that setup: RSA keys (a bit over twice the
+  // modulus size per anchor) then use a faster exponentiation for the
+  // public exponent, P-256 keys (about 1.2 kB per anchor) a precomputed
+  // window table with the software ECDSA verifier. NULL disables it.
+  int setTrustAnchorKeyCache(void* buffer, size_t size);
+
+  // skip chain validation for servers whose key is known in advance:
+  // setPinnedPublicKey() accepts exactly that key (the certificates are
+  // not even decoded), setPinnedSpkiHash() accepts an end-entity
+  // certificate whose SubjectPublicKeyInfo has that SHA-256 hash
+  // (RFC 7469 pin-sha256). Neither needs the time from onGetTime(). It is
+  // the closest BearSSL gets to RFC 7250 raw public keys: the server
+  // still sends certificates, but with setPinnedPublicKey() they are
+  // skipped unparsed. NULL goes back to trust anchor validation.
+  void setPinnedPublicKey(const br_x509_pkey* key);
+  int setPinnedSpkiHash(const uint8_t hash[32]);
+
+  // remember end-entity certificates that passed validation in buffer
+  // (BEAR_SSL_CHAIN_CACHE_RECORD_SIZE bytes per host), when a server sends
+  // the same certificate again within its validity period the signatures
+  // of the chain are not verified again. Keep buffer in RAM that survives
+  // resets to benefit across reboots, and clear it when the trust anchors
+  // change. NULL disables the cache.
+  int setChainCache(void* buffer, size_t size);
+
+  // reject chains with a certificate in the revocation filter
+  // (BEAR_SSL_CLIENT_ERR_REVOKED), checked as each certificate arrives,
+  // whatever the validation mode. NULL disables the check.
+  int setRevocationFilter(BearSSLRevocationFilter* filter);
+
+  enum class Profile {
+    Full,         // everything br_ssl_client_init_full() offers
+    EcdsaGcmOnly, // ECDHE-ECDSA with AES-128/256-GCM, TLS 1.2
+    ChaChaOnly,   // ECDHE-ECDSA/RSA with ChaCha20-Poly1305, TLS 1.2
+    Minimal,      // ECDHE-ECDSA-AES128-GCM-SHA256 on P-256 only
+    Tls12Sha256   // ECDHE-ECDSA/RSA with AES-128-GCM, ChaCha20-Poly1305 or
+                  // AES-128-CBC-SHA256, TLS 1.2: the handshake is hashed
+                  // with SHA-256 only, instead of the MD5, SHA-1, SHA-224,
+                  // SHA-256, SHA-384 and SHA-512 of Profile::Full
+  };
+
+  // cipher suites and algorithm implementations set up by the first
+  // connect() and kept for the next ones, until the profile, suite order,
+  // engine callback or lean mode change. The restricted profiles only
+  // reference the code they use; define
+  // BEAR_SSL_CLIENT_DISABLE_FULL_PROFILE to drop the rest from the build.
+  // Every profile leaves out the algorithms disabled in BearSSLConfig.h
+  // (BEARSSL_ENABLE_*), returns 0 if none of its suites remain.
+  int setProfile(Profile profile);
+
+  enum class SuiteOrder {
+    Auto,        // ChaCha20 first unless BearSSL has AES hardware support
+    ChaChaFirst,
+    AesFirst
+  };
+
+  // order of the profile's suites in the ClientHello, servers that honor
+  // the client's preference pick the first one they support
+  void setSuiteOrder(SuiteOrder order);
+
+  // called once the profile's algorithms have been set up, on the first
+  // connect() and the one after a configuration change, e.g. to pick
+  // other br_ssl_engine_set_aes_ctr()/set_ghash() choices than the
+  // per-core defaults
+  void onEngineInit(void (*callback)(br_ssl_engine_context* engine));
+
+  // deadlines in milliseconds, 0 disables them
+  void setHandshakeTimeout(unsigned long timeout);
+  void setIOTimeout(unsigned long timeout);
+
+  // session resumption, the session negotiated by the last successful
+  // handshake is offered again on the next connect
+  void setResumeSession(bool resume);
+  int getSession(br_ssl_session_parameters* session);
+  void setSession(const br_ssl_session_parameters* session);
+  void clearSession();
+  bool sessionResumed();
+
+  // persist sessions per host:port, implies session resumption
+  void setSessionStore(BearSSLSessionStore* store);
+
+  // pre-shared key: every connect() offers the session derived from
+  // identity and key (see BearSSLSessionStore::pskSession()), a server
+  // with the same PSK resumes it without certificates or public key
+  // operations; others run a full handshake. identity and key must stay
+  // valid, NULL disables the PSK.
+  void setPSK(const char* identity, const uint8_t key[], size_t keyLength);
+
+  // RFC 5705 keying material exporter: length bytes derived from the
+  // master secret of the established connection, label and context (NULL
+  // for the variant without context), the same the server computes, e.g.
+  // to key application-level encryption without a further exchange.
+  // Returns 0 while no connection is established
+  int exportKeyingMaterial(const char* label, const uint8_t* context, size_t contextLength, uint8_t* out, size_t length);
+
+  // generate the ephemeral ECDHE key of the next handshake ahead of time,
+  // e.g. from loop() while the device is otherwise idle. The next connect()
+  // uses it if the server picks that curve (BR_EC_secp256r1 or
+  // BR_EC_curve25519), saving a point multiplication in the handshake;
+  // otherwise it is kept for a later one.
+  int precomputeEcdheKey(int curve = BR_EC_secp256r1);
+  bool ecdheKeyPrecomputed();
+
+  // do ahead of a connect() to host:port everything but the handshake:
+  // resolve the name and open the transport, wake up the secure element,
+  // fill the entropy pool and make the P-256 ECDHE key (on the ECCX08
+  // with setEccEcdhSlot()). The next connect() to the same host and port
+  // then goes straight to the ClientHello if the transport is still open,
+  // and opens a new one otherwise. Returns 0 if the transport could not
+  // be opened.
+  int prepare(const char* host, uint16_t port = 443);
+
+  // run the point multiplications and RSA verifications of the handshake
+  // on the other core of an ESP32 or RP2040 (see utility/worker_core.h),
+  // wait is called meanwhile and must not use this client. The ECCX08
+  // and setTrustAnchorKeyCache() keep their operations on this core.
+  void setWorkerCore(bool enable, void (*wait)() = NULL);
+
+  // begin and end are called around the CPU-heavy operations of the
+  // handshake (ECDHE, signature verifications and signatures, key
+  // derivation), e.g. to raise the CPU clock during them only and run the
+  // network waits at a low clock. They are shared by all connections (see
+  // utility/crypto_hooks.h); NULL for both disables them.
+  void setCryptoHooks(void (*begin)(), void (*end)());
+
+  // record buffers, must be set before connect(). By default buffers of
+  // BEAR_SSL_CLIENT_IBUF_SIZE and BEAR_SSL_CLIENT_OBUF_SIZE bytes are
+  // allocated on the first connect() (never with BEARSSL_NO_HEAP).
+  // Passing a NULL or empty output buffer shares the input buffer for
+  // both directions.
+  void setBuffers(unsigned char* ibuf, size_t ibufSize, unsigned char* obuf, size_t obufSize);
+  void setBufferSizes(size_t ibufSize, size_t obufSize);
+
+  // take the buffers of setBufferSizes() from allocate() instead of the
+  // heap, e.g. from a non-cacheable or DMA capable region (also with
+  // BEARSSL_NO_HEAP); NULL restores malloc(). Like the heap ones they are
+  // padded to BEAR_SSL_BUFFER_ALIGN boundaries, so that a transport can
+  // DMA directly to and from the record buffers. release can be NULL
+  // if the memory is never given back.
+  void setBufferAllocator(void* (*allocate)(size_t size), void (*release)(void* ptr));
+
+  // negotiate the RFC 6066 maximum fragment length (512, 1024, 2048 or 4096)
+  // and size the record buffers to match, 0 restores the default buffers.
+  // Servers are free to ignore the extension, larger records are then
+  // rejected.
+  int setMaxFragmentLength(size_t length);
+
+  // lease the record buffers from a shared pool while connected
+  void setBufferPool(BearSSLBufferPool* pool);
+
+  // the X.509 context (about 3 kB, see BEAR_SSL_EC_ONLY) is only used by
+  // the handshake. With reuse enabled, renegotiation is refused and
+  // handshakeMemory() hands it to the sketch once the connection is
+  // established (NULL before); it is overwritten by the next connect()
+  void setReuseHandshakeMemory(bool reuse);
+  void* handshakeMemory(size_t& size);
+
+  // lean mode: TLS 1.2 only, whatever the profile, without the MD5, SHA-1
+  // and SHA-224 handshake hashes and the TLS 1.0 PRF that only serve the
+  // older versions (and the signatures nobody makes with them), so also
+  // without the CBC suites MACed with SHA-1 (3DES among them), and no
+  // renegotiation, which also makes the X.509 context free for
+  // handshakeMemory() once connected, as with setReuseHandshakeMemory()
+  void setLeanMode(bool lean);
+
+  enum class FlushPolicy {
+    Immediate, // seal and send a record at the end of every write()
+    Buffered   // only when the output buffer is full, on flush() or read()
+  };
+
+  // with FlushPolicy::Buffered, pending data is also sent once it is older
+  // than delay milliseconds (checked on the next write() or available())
+  void setFlushPolicy(FlushPolicy policy, unsigned long delay = 0);
+
+  // dynamic record sizing: at the start of the connection and after
+  // idleTimeout milliseconds without a write, records are sealed every
+  // initialSize bytes (about one TCP segment, 1300 or so) so the peer can
+  // decrypt each one as soon as it arrives; once boostAfter bytes went out
+  // they fill the output buffer again. Only useful with an output buffer
+  // larger than initialSize; 0 (the default) always fills the buffer.
+  void setRecordSizing(size_t initialSize, size_t boostAfter = BEAR_SSL_RECORD_BOOST_AFTER, unsigned long idleTimeout = BEAR_SSL_RECORD_IDLE_TIMEOUT);
+
+  // read-ahead mode asks the transport how much is available and only reads
+  // then, instead of calling connected() and read() on every engine request.
+  // The engine asks for the record header first and then the exact body
+  // length, so each record takes two transport reads.
+  void setReadAhead(bool enable);
+
+  // move the records through transport instead of the Client's read() and
+  // write(), e.g. to let a network driver encrypt in place in its own
+  // buffer (see BearSSLTransport.h); NULL goes back to the Client
+  void setTransport(BearSSLTransport* transport);
+
+  // zero-copy access to the engine's plaintext buffers: peekBuffer() returns
+  // the decrypted data received so far (NULL if none), consume() releases
+  // part of it. reserveWrite() returns where the next bytes to send can be
+  // written, commitWrite() hands them over to the engine.
+  const uint8_t* peekBuffer(size_t& length);
+  void consume(size_t length);
+  uint8_t* reserveWrite(size_t& length);
+  int commitWrite(size_t length);
+
+  // full-duplex mode: while write() waits for room in the engine, records
+  // that arrive are decrypted and their plaintext parked in buffer, so the
+  // peer's data never blocks our output (and a shared record buffer no
+  // longer fails when both sides talk at once). read(), available(),
+  // peek() and peekBuffer() drain the parked data first. NULL disables it.
+  void setFullDuplex(uint8_t* buffer, size_t size);
+
+  // double-buffered reception, full-duplex mode with buffer split in two
+  // halves: the application reads one (peekBuffer() returns it whole)
+  // while the records that arrive meanwhile are decrypted into the other,
+  // which takes over once the first is consumed. available() and
+  // service() take in what the transport holds without blocking, so with
+  // setLock() a second task (e.g. on the other core) can decrypt record
+  // N+1 while the application still processes record N, outside the lock.
+  // Each half should hold a full record. NULL disables it.
+  void setRecordPipeline(uint8_t* buffer, size_t size);
+
+  // event-driven use: call service() from loop(), onData is invoked while
+  // decrypted data is waiting and onClosed once the connection is gone.
+  // The engine is only pumped when the transport has bytes available.
+  void onData(void (*callback)(BearSSLClient& client));
+  void onClosed(void (*callback)(BearSSLClient& client));
+  void service();
+
+  // sharing one connection between tasks (e.g. a reader and a writer
+  // under Mbed OS or FreeRTOS): every call that touches the engine or the
+  // transport holds the lock, from connect() to stop(). It must be
+  // recursive (rtos::Mutex, a FreeRTOS recursive mutex) and the reader
+  // should only call read() once available() reports data, as a blocking
+  // read() keeps the lock until a record arrives. Set it before the
+  // tasks start, NULL disables locking.
+  void setLock(void (*lock)(void* context), void (*unlock)(void* context), void* context);
+
+  // called each time a blocking call (connect(), read(), write(), flush(),
+  // stop(), ...) finds nothing to receive or no room to send, instead of
+  // spinning at full power until the peer answers: e.g. __WFI() with
+  // the network driver's interrupt, delay(1), an RTOS yield or a wait on
+  // the driver's event. poll(), available(), peek() and service() never
+  // call it. NULL (the default) spins as before.
+  void onWait(void (*callback)(BearSSLClient& client));
+
+  // gather several buffers into as few records as possible, the flush
+  // policy is applied once after the last buffer
+  size_t writev(const BearSSLIoVec* iov, size_t count);
+
   virtual size_t write(uint8_t);
   virtual size_t write(const uint8_t *buf, size_t size);
+  // decrypts what the transport already received, without waiting for more
   virtual int available();
   virtual int read();
   virtual int read(uint8_t *buf, size_t size);
   virtual int peek();
   virtual void flush();
   virtual void stop();
+
+  // close without blocking: the first call sends close_notify, call again
+  // until it returns 1. The peer's close_notify is awaited for at most the
+  // close timeout (0 waits like stop() always did). In fast close mode the
+  // transport is stopped as soon as our close_notify is sent.
+  int stopAsync();
+  void setCloseTimeout(unsigned long timeout);
+  void setFastClose(bool fast);
   virtual uint8_t connected();
   virtual operator bool();
 
@@ -81,42 +481,366 @@ public:
   void setEccCert(br_x509_certificate cert);
   void setEccChain(br_x509_certificate* chain, size_t chainLen);
 
+  // send a client chain of any length from where it is stored, e.g. DER
+  // certificates in flash, instead of copying it into the client. The
+  // array must stay valid while connecting. With a reader the data
+  // pointers are only handed back to it, to read the certificates in
+  // chunks of up to 256 bytes from storage that is not memory-mapped.
+  // The private key still comes from setKey() or setEccSlot(), NULL goes
+  // back to the chain they set.
+  void setCertificateChain(const br_x509_certificate* chain, size_t chainLen, br_ssl_cert_reader reader = NULL, void* readerContext = NULL);
+
+  // the private key of ecc508KeySlot stays in the element selected with
+  // ArduinoBearSSL.setSecureElement() (the ECCX08 by default), which
+  // signs the handshakes
   void setEccSlot(int ecc508KeySlot, const byte cert[], int certLength);
-  void setEccSlot(int ecc508KeySlot, const char cert[]);
+  // with a cache the decoded certificate is stored there and used
+  // directly on the next calls, instead of decoding the PEM text again
+  void setEccSlot(int ecc508KeySlot, const char cert[], BearSSLDeviceCertCache* cache = NULL);
+  // decode the certificate into buffer instead of the heap, see pemToDer()
+  void setEccSlot(int ecc508KeySlot, const char cert[], byte buffer[], size_t size);
+
+  // compute the key exchange of P-256 handshakes on the secure element,
+  // with a new key pair in ecc508KeySlot for each connection (the slot must
+  // allow GenKey and ECDH), made while the server prepares its answer to
+  // the ClientHello. -1 turns it off. Handshakes go on in
+  // software if the element cannot do ECDH in that slot.
+  void setEccEcdhSlot(int ecc508KeySlot);
+
   void setKey(const char key[], const char cert[]);
+  // the certificate, or key and certificate, already in DER form, used in
+  // place (e.g. const data in flash)
+  void setKey(const char key[], const byte cert[], int certLength);
+  void setKey(const byte key[], int keyLength, const byte cert[], int certLength);
+
+  // keep the RSA key of setKey() decoded in buffer between handshakes, so
+  // client authentication skips that setup. The rest of the buffer is
+  // the work area of the signature: with a 2048-bit key, 1.6 kB gives
+  // the same speed as the stack, 3.3 kB a 4-bit window and 5.7 kB a 5-bit
+  // one (up to 10% fewer multiplications). Without a buffer, or with
+  // NULL, setKey() keeps just the decoded key (about 450 bytes for
+  // 2048 bits) on the heap and the work area stays on the stack.
+  int setRsaKeyCache(void* buffer, size_t size);
   void setEccCertParent(const char cert[]);
+  void setEccCertParent(const char cert[], byte buffer[], size_t size);
+  void setEccCertParent(const byte cert[], int certLength);
+
+  // decode the first object of a PEM text into der, e.g. a static buffer,
+  // without using the heap. Returns its length, 0 if there is none or it
+  // does not fit in size bytes (3/4 of the PEM length is always enough)
+  static size_t pemToDer(const char pem[], byte der[], size_t size);
+
+  // all the certificates of a PEM bundle (device certificate first) as
+  // the client chain, decoded into one allocation or into buffer. Other
+  // objects of the bundle are skipped, the private key still comes from
+  // setKey() or setEccSlot(), which must be called before. Returns the
+  // number of certificates, 0 on failure or beyond
+  // BEAR_SSL_CLIENT_CHAIN_SIZE
+  int setChainPem(const char pem[]);
+  int setChainPem(const char pem[], byte buffer[], size_t size);
 
   int errorCode();
 
+  // memory instrumentation for sizing buffers and task stacks: with
+  // enable, each connect() paints the record buffers and stackDepth bytes
+  // of stack below poll() (0 skips it), so that memoryStats() reports how
+  // much of them the connections have used so far. The stack use is
+  // approximate and at least 256 bytes. Heap requests and the largest
+  // records (the buffer sizes the peers have actually needed) are always
+  // counted.
+  void setMemoryStats(bool enable, size_t stackDepth = 4096);
+  void memoryStats(BearSSLMemoryStats& stats);
+
+  // time the steps of the next handshakes, e.g. to tell a slow network
+  // from a slow certificate verification or secure element
+  void setHandshakeStats(bool enable);
+  void getHandshakeStats(BearSSLHandshakeStats& stats);
+
+  // account the CPU time, wait time and bytes of the next handshakes, and
+  // with a profile (kept by reference) estimate the energy they cost, to
+  // compare suites, resumption or pinning by joules per connect
+  void setHandshakeReport(bool enable, const BearSSLPowerProfile* profile = NULL);
+  void getHandshakeReport(BearSSLHandshakeReport& report);
+
+  // record the engine events of the following connections in trace
+  // (handshake and engine states, transport I/O, record headers,
+  // errors), to be dumped after the fact; NULL stops tracing
+  void setTrace(BearSSLTrace* trace);
+
+  // hands a line in the NSS key log format ("CLIENT_RANDOM <random>
+  // <master secret>", without newline) to callback after each handshake,
+  // for decrypting captures in Wireshark. It discloses the session keys:
+  // for analysis only, never in production. NULL disables it.
+  void onKeyLog(void (*callback)(BearSSLClient& client, const char* line));
+
+  // start the random generator of every connection from seed instead of
+  // the DRBG, so that given the same time and configuration the client
+  // sends the same bytes each time, e.g. to replay recorded server
+  // answers in a benchmark. Anybody knowing the seed knows the keys: for
+  // testing only, never in production. NULL goes back to the DRBG.
+  void setFixedSeed(const uint8_t* seed, size_t length);
+
+  // hands the server certificate to callback once its chain is accepted,
+  // without a copy or a second parse: the view points into the record
+  // buffer and is only valid during the callback. With a spill buffer the
+  // certificate is also copied there if it fits, so that it is available
+  // when the chain spans several records and after the handshake, with
+  // peerCertificate(). NULL and no buffer disable it.
+  void onPeerCertificate(void (*callback)(BearSSLClient& client, const BearSSLCertificate& certificate), uint8_t* spill = NULL, size_t spillSize = 0);
+  // the certificate of the last handshake kept in the spill buffer, empty
+  // (length() 0) without one or after a resumption, which sends none
+  BearSSLCertificate peerCertificate();
+
 private:
+  // destination of pemToDer()
+  struct PemOutput {
+    byte* der;
+    size_t size;
+    size_t length;
+    bool overflow;
+  };
+
+  // holds the lock of setLock() for the lifetime of the object
+  class Locked {
+  public:
+    Locked(BearSSLClient* client);
+    ~Locked();
+
+  private:
+    BearSSLClient* _client;
+  };
+
+  // marks a blocking call, where the transport callbacks wait with onWait
+  class Blocking {
+  public:
+    Blocking(BearSSLClient* client);
+    ~Blocking();
+
+  private:
+    BearSSLClient* _client;
+    bool _blocking;
+  };
+
   int connectSSL(const char* host);
+  int beginSSL(const char* host);
+  void initProfile();
+  void setDefaultEcdsa();
+  void setDefaultRsa();
+  void initImplementations();
+  void initLeanMode();
+  void orderSuites();
+  void initEngine();
+  void restoreEngine();
+  bool ioExpired();
+  void ioIdle();
+  static void getEntropy(unsigned char* entropy, size_t length);
+  int connectTransport(const char* host, uint16_t port);
+  void loadSession(const char* host, uint16_t port);
+  void prepareRsaKey();
+  void* allocate(size_t size);
+  unsigned char* allocateBuffer(size_t size, void*& block);
+  int allocateBuffers();
+  void freeBuffers();
+  void returnBuffers();
+  void measureBuffers();
+  void measureRecords();
+  void markStep(unsigned long& step);
+  void endHandshakeReport();
+  void traceHandshake();
+  void logKeys();
+  static void peerCertificateReady(void* ctx, const unsigned char* der, size_t length, unsigned err);
+  int transportAvailable();
+  void prefetchRecords();
+  size_t writeRecords(const uint8_t* buf, size_t size);
+  void startRecords();
+  size_t recordRoom();
+  void recordWritten(size_t length);
+  size_t writeDuplex(const uint8_t* buf, size_t size);
+  size_t parkReceived();
+  void fillPipeline();
+  void swapPipeline();
+  int flushPending(bool force);
   static int clientRead(void *ctx, unsigned char *buf, size_t len);
   static int clientWrite(void *ctx, const unsigned char *buf, size_t len);
-  static void clientAppendCert(void *ctx, const void *data, size_t len);
+  static int transportRead(void *ctx, unsigned char *buf, size_t len);
+  static int transportWrite(void *ctx, const unsigned char *buf, size_t len);
+  int measureIo(bool out, unsigned char* buf, size_t len);
   static void clientAppendKey(void *ctx, const void *data, size_t len);
-  static void parentAppendCert(void *ctx, const void *data, size_t len);
+  static void pemAppend(void *ctx, const void *data, size_t len);
+  int decodeKey(const char pem[], const byte der[], size_t derLength);
+  int keepKey(const br_skey_decoder_context* decoder);
+  void freeCert(int index);
+  int decodeChain(const char pem[], byte der[], size_t size, size_t lengths[BEAR_SSL_CLIENT_CHAIN_SIZE]);
+  void useChain(byte der[], const size_t lengths[], int count);
 
 private:
   Client* _client;
   const br_x509_trust_anchor* _TAs;
   int _numTAs;
+  const br_x509_ta_index_entry* _taIndex;
+  BearSSLTrustStore* _trustStore;
+  ta_key_cache_context* _taKeyCache;
+  bool _pinnedKey;
+  br_x509_knownkey_context _knownKey;
+  x509_pinned_context* _pinnedSpki;
+  x509_cached_context* _chainCache;
+  BearSSLRevocationFilter* _revocationFilter;
+  x509_revocation_context* _revocation;
+#ifdef BEARSSL_NO_HEAP
+  ta_key_cache_context _taKeyCacheStorage;
+  x509_pinned_context _pinnedSpkiStorage;
+  x509_cached_context _chainCacheStorage;
+  x509_revocation_context _revocationStorage;
+#endif
 
   bool _noSNI;
+  Profile _profile;
+  SuiteOrder _suiteOrder;
+  void (*_onEngineInitCallback)(br_ssl_engine_context* engine);
+  // what initEngine() set up, before each connect() wraps it
+  bool _engineReady;
+  const br_ec_impl* _baseEc;
+  br_rsa_pkcs1_vrfy _baseRsaVrfy;
+  br_rsa_pkcs1_vrfy _baseX509Rsa;
+  br_tls_prf_impl _basePrf10;
+  br_tls_prf_impl _basePrfSha256;
+  br_tls_prf_impl _basePrfSha384;
+  uint32_t _baseFlags;
+  HandshakeState _handshakeState;
+  unsigned long _handshakeStart;
+  unsigned long _handshakeTimeout;
+  unsigned long _ioWaitStart;
+  unsigned long _ioTimeout;
+  bool _ioWaiting;
+  int _clientError;
+  const uint8_t* _earlyData;
+  size_t _earlyDataLength;
+
+  bool _resumeSession;
+  bool _sessionValid;
+  bool _sessionResumed;
+  br_ssl_session_parameters _session;
+  BearSSLSessionStore* _sessionStore;
+  uint32_t _sessionKey;
+  const char* _pskIdentity;
+  const uint8_t* _pskKey;
+  size_t _pskKeyLength;
+  // host:port of the transport opened by prepare(), 0 if none
+  uint32_t _preparedKey;
+
+  br_ssl_ecdhe_key _ecdheKey;
+  bool _workerCore;
+  bool _cryptoHooks;
 
   br_ecdsa_vrfy _ecVrfy;
   br_ecdsa_sign _ecSign;
+  int _eccEcdhSlot;
+  bool _eccEcdhPending;
 
   br_ec_private_key _ecKey;
-  br_skey_decoder_context* _skeyDecoder;
+  secure_element_key _seKey;
+  // key of setKey(), copied out of the decoder into _clientKeyData
+  int _clientKeyType;
+  br_ec_private_key _clientEcKey;
+  br_rsa_private_key _clientRsaKey;
+  unsigned char* _clientKeyData;
+  rsa_key_cache_context* _rsaKeyCache;
+  bool _rsaKeyCacheInternal;
+#ifdef BEARSSL_NO_HEAP
+  unsigned char _clientKeyStorage[BEAR_SSL_CLIENT_KEY_SIZE];
+  rsa_key_cache_context _rsaKeyCacheStorage;
+#endif
   br_x509_certificate _ecCert[BEAR_SSL_CLIENT_CHAIN_SIZE];
   int _ecChainLen;
-  bool _ecCertDynamic;
+  const br_x509_certificate* _certChain;
+  size_t _certChainLen;
+  br_ssl_cert_reader _certReader;
+  void* _certReaderContext;
+  // the first two certificates can come from malloc()
+  bool _ecCertDynamic[2];
+  byte* _ecChainArena;
 
   br_ssl_client_context _sc;
   br_x509_minimal_context _xc;
-  unsigned char _ibuf[BEAR_SSL_CLIENT_IBUF_SIZE];
-  unsigned char _obuf[BEAR_SSL_CLIENT_OBUF_SIZE];
+  unsigned char* _ibuf;
+  size_t _ibufSize;
+  unsigned char* _obuf;
+  size_t _obufSize;
+  bool _buffersDynamic;
+  void* _ibufBlock;
+  void* _obufBlock;
+  void* (*_bufferAllocate)(size_t size);
+  void (*_bufferRelease)(void* ptr);
+  BearSSLBufferPool* _bufferPool;
+  bool _buffersLeased;
+  bool _reuseHandshakeMemory;
+  bool _leanMode;
+
+  FlushPolicy _flushPolicy;
+  unsigned long _flushDelay;
+  unsigned long _writePendingSince;
+  bool _writePending;
+  size_t _recordInitial;
+  size_t _recordBoostAfter;
+  unsigned long _recordIdleTimeout;
+  unsigned long _lastWrite;
+  size_t _recordSent;
+  size_t _recordFill;
+  bool _readAhead;
+  BearSSLTransport* _transport;
+  uint8_t* _duplexBuf;
+  size_t _duplexSize;
+  size_t _duplexStart;
+  size_t _duplexLen;
+  uint8_t* _pipeBuf;
+  size_t _pipeLen;
+  void (*_onDataCallback)(BearSSLClient& client);
+  void (*_onClosedCallback)(BearSSLClient& client);
+  void (*_onWaitCallback)(BearSSLClient& client);
+  bool _ioBlocking;
+  bool _dataPending;
+  void (*_lock)(void* context);
+  void (*_unlock)(void* context);
+  void* _lockContext;
+  bool _closedReported;
+  bool _closing;
+  bool _fastClose;
+  unsigned long _closeStart;
+  unsigned long _closeTimeout;
   br_sslio_context _ioc;
+
+  bool _memoryStats;
+  bool _buffersPainted;
+  size_t _stackDepth;
+  size_t _stackUsed;
+  size_t _ibufUsed;
+  size_t _obufUsed;
+  bool _engineUsed;
+  size_t _recordIn;
+  size_t _recordOut;
+  size_t _heapAllocated;
+  size_t _heapLargest;
+
+  bool _handshakeTiming;
+  unsigned long _connectStart;
+  BearSSLHandshakeStats _handshakeStats;
+  x509_timing_context _x509Timing;
+
+  bool _handshakeReporting;
+  const BearSSLPowerProfile* _powerProfile;
+  BearSSLHandshakeReport _handshakeReport;
+  unsigned long _reportLast;
+  bool _reportIdle;
+  BearSSLTrace* _trace;
+  const uint8_t* _fixedSeed;
+  size_t _fixedSeedLength;
+  void (*_onKeyLogCallback)(BearSSLClient& client, const char* line);
+
+  void (*_onPeerCertificateCallback)(BearSSLClient& client, const BearSSLCertificate& certificate);
+  uint8_t* _peerSpill;
+  size_t _peerSpillSize;
+  size_t _peerLength;
+  x509_peer_context _x509Peer;
 };
 
 #endif
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "BearSSLClientPool.h"
+
+BearSSLClientPool::BearSSLClientPool() :
+  _count(0),
+  _idleTimeout(0)
+{
+}
+
+BearSSLClientPool::~BearSSLClientPool()
+{
+}
+
+int BearSSLClientPool::add(BearSSLClient& client)
+{
+  if (_count >= BEAR_SSL_CLIENT_POOL_SIZE) {
+    return 0;
+  }
+
+  Entry& entry = _entries[_count++];
+
+  entry.client = &client;
+  entry.key = 0;
+  entry.releasedAt = 0;
+  entry.inUse = false;
+
+  return 1;
+}
+
+BearSSLClient* BearSSLClientPool::acquire(const char* host, uint16_t port)
+{
+  uint32_t key = BearSSLSessionStore::key(host, port);
+  Entry* spare = NULL;
+
+  for (int i = 0; i < _count; i++) {
+    Entry& entry = _entries[i];
+
+    if (entry.inUse) {
+      continue;
+    }
+
+    if (entry.key == key && alive(entry)) {
+      entry.inUse = true;
+      return entry.client;
+    }
+
+    // prefer a free slot, then the one idle for the longest time
+    if (spare == NULL || (spare->key != 0 && (entry.key == 0 ||
+        (long)(entry.releasedAt - spare->releasedAt) < 0))) {
+      spare = &entry;
+    }
+  }
+
+  if (spare == NULL) {
+    return NULL;
+  }
+
+  if (spare->key != 0) {
+    spare->client->stop();
+    spare->key = 0;
+  }
+
+  if (!spare->client->connect(host, port)) {
+    spare->client->stop();
+    return NULL;
+  }
+
+  spare->key = key;
+  spare->inUse = true;
+
+  return spare->client;
+}
+
+void BearSSLClientPool::release(BearSSLClient* client)
+{
+  for (int i = 0; i < _count; i++) {
+    Entry& entry = _entries[i];
+
+    if (entry.client == client) {
+      entry.inUse = false;
+      entry.releasedAt = millis();
+
+      if (entry.key != 0 && !client->connected()) {
+        client->stop();
+        entry.key = 0;
+      }
+
+      return;
+    }
+  }
+}
+
+void BearSSLClientPool::setIdleTimeout(unsigned long timeout)
+{
+  _idleTimeout = timeout;
+}
+
+void BearSSLClientPool::maintain()
+{
+  for (int i = 0; i < _count; i++) {
+    Entry& entry = _entries[i];
+
+    if (entry.inUse || entry.key == 0) {
+      continue;
+    }
+
+    if (!alive(entry) ||
+        (_idleTimeout != 0 && (millis() - entry.releasedAt) >= _idleTimeout)) {
+      entry.client->stop();
+      entry.key = 0;
+    }
+  }
+}
+
+bool BearSSLClientPool::alive(Entry& entry)
+{
+  BearSSLClient* client = entry.client;
+
+  // available() picks up a pending close_notify; anything else the peer
+  // sent while idle would be mistaken for the next response
+  if (client->available() != 0 || !client->connected()) {
+    return false;
+  }
+
+  return true;
+}
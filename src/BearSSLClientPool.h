@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef _BEAR_SSL_CLIENT_POOL_H_
+#define _BEAR_SSL_CLIENT_POOL_H_
+
+#ifndef BEAR_SSL_CLIENT_POOL_SIZE
+#define BEAR_SSL_CLIENT_POOL_SIZE 4
+#endif
+
+#include "BearSSLClient.h"
+
+// Keeps established connections open after release() and hands them out
+// again when the same host:port is acquired, so repeated short requests
+// skip the handshake. The clients are owned by the caller.
+class BearSSLClientPool {
+
+public:
+  BearSSLClientPool();
+  virtual ~BearSSLClientPool();
+
+  int add(BearSSLClient& client);
+
+  // returns a connected client or NULL if none is free or connect() failed
+  BearSSLClient* acquire(const char* host, uint16_t port);
+  void release(BearSSLClient* client);
+
+  // idle connections older than timeout milliseconds are closed by
+  // maintain(), 0 keeps them until the peer goes away
+  void setIdleTimeout(unsigned long timeout);
+  void maintain();
+
+private:
+  struct Entry {
+    BearSSLClient* client;
+    uint32_t key;
+    unsigned long releasedAt;
+    bool inUse;
+  };
+
+  bool alive(Entry& entry);
+
+  Entry _entries[BEAR_SSL_CLIENT_POOL_SIZE];
+  int _count;
+  unsigned long _idleTimeout;
+};
+
+#endif
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _BEAR_SSL_CONFIG_H_
+#define _BEAR_SSL_CONFIG_H_
+
+// options of the sketch (ARDUINO_DISABLE_ECCX08, BEARSSL_NO_HEAP,
+// BEAR_SSL_EC_ONLY, ...), included by every header whose layout depends
+// on them, so that the library and the sketch agree
+#if defined __has_include
+#  if __has_include (<ArduinoBearSSLConfig.h>)
+#    include <ArduinoBearSSLConfig.h>
+#  endif
+#endif
+
+// algorithms set up for TLS connections and by the global objects, each
+// can be set to 0 in ArduinoBearSSLConfig.h to leave its code out of the
+// link: the client and server profiles then offer the remaining cipher
+// suites only, and the matching global object (AES128, DES, ...) is not
+// defined, a sketch needing one anyway can still create its own
+#ifndef BEARSSL_ENABLE_RSA
+// RSA key exchange, signatures and certificates, not with BEAR_SSL_EC_ONLY
+#ifdef BEAR_SSL_EC_ONLY
+#define BEARSSL_ENABLE_RSA 0
+#else
+#define BEARSSL_ENABLE_RSA 1
+#endif
+#endif
+#ifndef BEARSSL_ENABLE_GCM
+#define BEARSSL_ENABLE_GCM 1    // AES-GCM suites, AESGCM
+#endif
+#ifndef BEARSSL_ENABLE_CBC
+#define BEARSSL_ENABLE_CBC 1    // AES-CBC suites, AES128
+#endif
+#ifndef BEARSSL_ENABLE_3DES
+#define BEARSSL_ENABLE_3DES 1   // 3DES-EDE-CBC suites, DES
+#endif
+#ifndef BEARSSL_ENABLE_CCM
+#define BEARSSL_ENABLE_CCM 1    // AES-CCM suites, AESCCM
+#endif
+#ifndef BEARSSL_ENABLE_CHACHA
+#define BEARSSL_ENABLE_CHACHA 1 // ChaCha20-Poly1305 suites, ChaChaPoly, BearSSLPskClient
+#endif
+#ifndef BEARSSL_ENABLE_SHA384
+#define BEARSSL_ENABLE_SHA384 1 // SHA-384 and SHA-512: _SHA384 suites and signatures, SHA384, SHA512
+#endif
+#ifndef BEARSSL_ENABLE_P384
+#define BEARSSL_ENABLE_P384 1   // P-384 for ECDHE and certificates, P384
+#endif
+#ifndef BEARSSL_ENABLE_P521
+#define BEARSSL_ENABLE_P521 1   // P-521 for ECDHE and certificates
+#endif
+
+#define BEARSSL_ENABLE_ALL (BEARSSL_ENABLE_RSA && BEARSSL_ENABLE_GCM && BEARSSL_ENABLE_CBC && \
+  BEARSSL_ENABLE_3DES && BEARSSL_ENABLE_CCM && BEARSSL_ENABLE_CHACHA && BEARSSL_ENABLE_SHA384 && \
+  BEARSSL_ENABLE_P384 && BEARSSL_ENABLE_P521)
+
+#endif
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "BearSSLConnectionSet.h"
+
+BearSSLConnectionSet* BearSSLConnectionSet::_waiting = NULL;
+
+BearSSLConnectionSet::BearSSLConnectionSet() :
+  _count(0),
+  _workerCore(false)
+{
+}
+
+BearSSLConnectionSet::~BearSSLConnectionSet()
+{
+  if (_waiting == this) {
+    _waiting = NULL;
+  }
+}
+
+int BearSSLConnectionSet::add(BearSSLClient& client, BearSSLConnectionCallback callback, void* arg)
+{
+  if (_count >= BEAR_SSL_CONNECTION_SET_SIZE) {
+    return 0;
+  }
+
+  Entry& entry = _entries[_count++];
+
+  entry.client = &client;
+  entry.callback = callback;
+  entry.arg = arg;
+  entry.readable = false;
+  entry.open = (client.handshakeState() != BearSSLClient::HandshakeState::Failed);
+  entry.busy = false;
+  entry.pending = 0;
+
+  if (_workerCore) {
+    client.setWorkerCore(true, workerWait);
+  }
+
+  return 1;
+}
+
+void BearSSLConnectionSet::remove(BearSSLClient& client)
+{
+  for (int i = 0; i < _count; i++) {
+    if (_entries[i].client == &client) {
+      _count--;
+
+      for (int j = i; j < _count; j++) {
+        _entries[j] = _entries[j + 1];
+      }
+
+      return;
+    }
+  }
+}
+
+int BearSSLConnectionSet::count()
+{
+  return _count;
+}
+
+void BearSSLConnectionSet::setWorkerCore(bool enable)
+{
+  _workerCore = enable;
+
+  if (enable) {
+    _waiting = this;
+  } else if (_waiting == this) {
+    _waiting = NULL;
+  }
+
+  for (int i = 0; i < _count; i++) {
+    _entries[i].client->setWorkerCore(enable, enable ? workerWait : NULL);
+  }
+}
+
+void BearSSLConnectionSet::workerWait()
+{
+  if (_waiting) {
+    _waiting->stepHandshakes();
+  }
+}
+
+// one step of each handshake that is not the one waiting, without
+// callbacks: the application may be in one of them
+void BearSSLConnectionSet::stepHandshakes()
+{
+  for (int i = 0; i < _count; i++) {
+    Entry& entry = _entries[i];
+
+    if (entry.busy || !entry.open || entry.client->handshakeState() != BearSSLClient::HandshakeState::InProgress) {
+      continue;
+    }
+
+    entry.busy = true;
+    if (entry.client->poll() == BearSSLClient::HandshakeState::Established) {
+      entry.pending |= BEAR_SSL_EVENT_CONNECTED;
+    }
+    entry.busy = false;
+  }
+}
+
+int BearSSLConnectionSet::poll()
+{
+  int reported = 0;
+
+  for (int i = 0; i < _count; i++) {
+    Entry& entry = _entries[i];
+    BearSSLClient* client = entry.client;
+    int events = entry.pending;
+
+    if (entry.busy) {
+      continue;
+    }
+
+    entry.pending = 0;
+
+    BearSSLClient::HandshakeState state = client->handshakeState();
+
+    if (!entry.open) {
+      // closed ones are reported once, until they are connected again
+      if (state == BearSSLClient::HandshakeState::InProgress ||
+          (state == BearSSLClient::HandshakeState::Established && client->connected())) {
+        entry.open = true;
+        entry.readable = false;
+      } else {
+        continue;
+      }
+    }
+
+    if (state == BearSSLClient::HandshakeState::InProgress) {
+      entry.busy = true;
+      state = client->poll();
+      entry.busy = false;
+
+      if (state == BearSSLClient::HandshakeState::Established) {
+        events |= BEAR_SSL_EVENT_CONNECTED;
+      }
+    }
+
+    if (state == BearSSLClient::HandshakeState::Failed) {
+      events |= BEAR_SSL_EVENT_CLOSED;
+    } else if (state == BearSSLClient::HandshakeState::Established) {
+      // only go through the engine when the transport has something or
+      // plaintext was left unread last time, neither costs a blocking read
+      if (entry.readable || client->getClient()->available() > 0) {
+        entry.readable = (client->available() > 0);
+      }
+
+      if (entry.readable) {
+        events |= BEAR_SSL_EVENT_READABLE;
+      } else if (!client->connected()) {
+        events |= BEAR_SSL_EVENT_CLOSED;
+      }
+    }
+
+    if (events & BEAR_SSL_EVENT_CLOSED) {
+      entry.open = false;
+    }
+
+    if (events) {
+      reported++;
+
+      if (entry.callback) {
+        entry.callback(*client, events, entry.arg);
+      }
+    }
+  }
+
+  return reported;
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef _BEAR_SSL_CONNECTION_SET_H_
+#define _BEAR_SSL_CONNECTION_SET_H_
+
+#ifndef BEAR_SSL_CONNECTION_SET_SIZE
+#define BEAR_SSL_CONNECTION_SET_SIZE 4
+#endif
+
+#include "BearSSLClient.h"
+
+// events passed to the callback, ORed together
+#define BEAR_SSL_EVENT_CONNECTED 0x01 // handshake started with connectAsync() completed
+#define BEAR_SSL_EVENT_READABLE  0x02 // decrypted data can be read
+#define BEAR_SSL_EVENT_CLOSED    0x04 // connection closed or handshake failed
+
+typedef void (*BearSSLConnectionCallback)(BearSSLClient& client, int events, void* arg);
+
+// Services several BearSSLClient instances from one loop, like select():
+// every poll() looks at each client's transport once, performs at most one
+// engine step per client and reports what became ready.
+class BearSSLConnectionSet {
+
+public:
+  BearSSLConnectionSet();
+  virtual ~BearSSLConnectionSet();
+
+  int add(BearSSLClient& client, BearSSLConnectionCallback callback, void* arg = NULL);
+  void remove(BearSSLClient& client);
+  int count();
+
+  // returns the number of clients that reported events
+  int poll();
+
+  // run the public key operations of the handshakes on the other core
+  // (see BearSSLClient::setWorkerCore()), one at a time. While one client
+  // waits for its operation, the handshakes of the others keep stepping,
+  // so their round trips overlap with it; their events are reported by
+  // the next poll(). Applies to the clients added before and after.
+  void setWorkerCore(bool enable);
+
+private:
+  struct Entry {
+    BearSSLClient* client;
+    BearSSLConnectionCallback callback;
+    void* arg;
+    bool readable;
+    bool open;
+    bool busy;   // in its own poll(), further up the stack
+    int pending; // events of steps taken while another client waited
+  };
+
+  void stepHandshakes();
+  static void workerWait();
+
+  Entry _entries[BEAR_SSL_CONNECTION_SET_SIZE];
+  int _count;
+  bool _workerCore;
+
+  static BearSSLConnectionSet* _waiting;
+};
+
+#endif
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "BearSSLCoroutine.h"
+
+#ifdef BEAR_SSL_COROUTINES
+
+BearSSLAwaiter* BearSSLAwait::_waiting = NULL;
+
+bool BearSSLAwaiter::await_ready()
+{
+  return ready();
+}
+
+void BearSSLAwaiter::await_suspend(std::coroutine_handle<> handle)
+{
+  _handle = handle;
+  _next = BearSSLAwait::_waiting;
+  BearSSLAwait::_waiting = this;
+}
+
+BearSSLConnectAwaiter::BearSSLConnectAwaiter(BearSSLClient& client, const char* host, uint16_t port) :
+  _client(client),
+  _host(host),
+  _port(port),
+  _started(false),
+  _failed(false)
+{
+}
+
+int BearSSLConnectAwaiter::await_resume()
+{
+  return !_failed && _client.handshakeState() == BearSSLClient::HandshakeState::Established;
+}
+
+bool BearSSLConnectAwaiter::ready()
+{
+  if (!_started) {
+    _started = true;
+
+    if (!_client.connectAsync(_host, _port)) {
+      _failed = true;
+      return true;
+    }
+  }
+
+  return (_client.poll() != BearSSLClient::HandshakeState::InProgress);
+}
+
+BearSSLReadAwaiter::BearSSLReadAwaiter(BearSSLClient& client, uint8_t* buf, size_t size) :
+  _client(client),
+  _buf(buf),
+  _size(size)
+{
+}
+
+int BearSSLReadAwaiter::await_resume()
+{
+  if (_client.available() <= 0) {
+    return -1;
+  }
+
+  return _client.read(_buf, _size);
+}
+
+bool BearSSLReadAwaiter::ready()
+{
+  return (_client.available() > 0 || !_client.connected());
+}
+
+BearSSLDelayAwaiter::BearSSLDelayAwaiter(unsigned long ms) :
+  _start(millis()),
+  _ms(ms)
+{
+}
+
+bool BearSSLDelayAwaiter::ready()
+{
+  return (millis() - _start) >= _ms;
+}
+
+BearSSLConnectAwaiter BearSSLAwait::connect(BearSSLClient& client, const char* host, uint16_t port)
+{
+  return BearSSLConnectAwaiter(client, host, port);
+}
+
+BearSSLReadAwaiter BearSSLAwait::read(BearSSLClient& client, uint8_t* buf, size_t size)
+{
+  return BearSSLReadAwaiter(client, buf, size);
+}
+
+BearSSLDelayAwaiter BearSSLAwait::delay(unsigned long ms)
+{
+  return BearSSLDelayAwaiter(ms);
+}
+
+int BearSSLAwait::poll()
+{
+  BearSSLAwaiter** link = &_waiting;
+  int waiting = 0;
+
+  while (*link) {
+    BearSSLAwaiter* awaiter = *link;
+
+    if (!awaiter->ready()) {
+      link = &awaiter->_next;
+      waiting++;
+      continue;
+    }
+
+    // unlinked before it runs, the coroutine may wait again
+    *link = awaiter->_next;
+    awaiter->_handle.resume();
+  }
+
+  return waiting;
+}
+
+#endif
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _BEAR_SSL_COROUTINE_H_
+#define _BEAR_SSL_COROUTINE_H_
+
+// only with compilers that implement C++20 coroutines (e.g. GCC 11 and
+// later with -std=gnu++20, GCC 10 also needs -fcoroutines)
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define BEAR_SSL_COROUTINES 1
+#endif
+#endif
+
+#ifdef BEAR_SSL_COROUTINES
+
+#include <coroutine>
+
+#include "BearSSLClient.h"
+
+// Return type of the coroutines that use BearSSLAwait: they start right
+// away, run until their first co_await that has to wait, and free their
+// frame when they return. Nothing is handed back to the caller.
+class BearSSLTask {
+
+public:
+  struct promise_type {
+    BearSSLTask get_return_object() { return BearSSLTask(); }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() {}
+  };
+};
+
+// base of the awaitables: a suspended coroutine waits in a list that
+// BearSSLAwait::poll() walks, and is resumed once ready() holds
+class BearSSLAwaiter {
+
+public:
+  bool await_ready();
+  void await_suspend(std::coroutine_handle<> handle);
+
+protected:
+  virtual bool ready() = 0;
+
+private:
+  friend class BearSSLAwait;
+
+  std::coroutine_handle<> _handle;
+  BearSSLAwaiter* _next;
+};
+
+class BearSSLConnectAwaiter : public BearSSLAwaiter {
+
+public:
+  BearSSLConnectAwaiter(BearSSLClient& client, const char* host, uint16_t port);
+
+  // 1 once the handshake is established, 0 if it failed
+  int await_resume();
+
+protected:
+  virtual bool ready();
+
+private:
+  BearSSLClient& _client;
+  const char* _host;
+  uint16_t _port;
+  bool _started;
+  bool _failed;
+};
+
+class BearSSLReadAwaiter : public BearSSLAwaiter {
+
+public:
+  BearSSLReadAwaiter(BearSSLClient& client, uint8_t* buf, size_t size);
+
+  // bytes read, -1 once the connection is closed
+  int await_resume();
+
+protected:
+  virtual bool ready();
+
+private:
+  BearSSLClient& _client;
+  uint8_t* _buf;
+  size_t _size;
+};
+
+class BearSSLDelayAwaiter : public BearSSLAwaiter {
+
+public:
+  BearSSLDelayAwaiter(unsigned long ms);
+
+  void await_resume() {}
+
+protected:
+  virtual bool ready();
+
+private:
+  unsigned long _start;
+  unsigned long _ms;
+};
+
+// Sequential protocol code over the non-blocking client, e.g.
+//
+//   BearSSLTask fetch() {
+//     if (!co_await BearSSLAwait::connect(sslClient, "example.com", 443)) {
+//       co_return;
+//     }
+//     sslClient.print("GET / HTTP/1.1\r\nHost: example.com\r\n\r\n");
+//     int n = co_await BearSSLAwait::read(sslClient, buffer, sizeof(buffer));
+//     ...
+//   }
+//
+// with BearSSLAwait::poll() called from loop(): while a coroutine waits
+// for the handshake or for data, loop() and the other coroutines keep
+// running. Writes complete as with write(), they do not suspend.
+class BearSSLAwait {
+
+public:
+  // connectAsync() and poll() until the handshake is over
+  static BearSSLConnectAwaiter connect(BearSSLClient& client, const char* host, uint16_t port);
+  // waits until data can be read without blocking, then read()
+  static BearSSLReadAwaiter read(BearSSLClient& client, uint8_t* buf, size_t size);
+  static BearSSLDelayAwaiter delay(unsigned long ms);
+
+  // resumes the coroutines that can go on, returns how many still wait
+  static int poll();
+
+private:
+  friend class BearSSLAwaiter;
+
+  static BearSSLAwaiter* _waiting;
+};
+
+#endif
+
+#endif
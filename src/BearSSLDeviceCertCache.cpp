@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ArduinoBearSSL.h"
+
+#include "BearSSLDeviceCertCache.h"
+
+#define HEADER_SLOT       4
+#define HEADER_PEM_KEY    5
+#define HEADER_FLAGS      9
+#define HEADER_LENGTH     10
+#define HEADER_PUBLIC_KEY 12
+#define HEADER_CHECKSUM   76
+
+#define FLAG_CERTIFICATE 0x01
+#define FLAG_PUBLIC_KEY  0x02
+
+static void enc16(uint8_t* p, uint16_t value)
+{
+  p[0] = value >> 8;
+  p[1] = value;
+}
+
+static uint16_t dec16(const uint8_t* p)
+{
+  return ((uint16_t)p[0] << 8) | p[1];
+}
+
+static void enc32(uint8_t* p, uint32_t value)
+{
+  enc16(p, value >> 16);
+  enc16(p + 2, value);
+}
+
+static uint32_t dec32(const uint8_t* p)
+{
+  return ((uint32_t)dec16(p) << 16) | dec16(p + 2);
+}
+
+static uint32_t fnv1a(uint32_t hash, const uint8_t* data, size_t length)
+{
+  while (length--) {
+    hash ^= *data++;
+    hash *= 16777619UL;
+  }
+
+  return hash;
+}
+
+BearSSLDeviceCertCache::BearSSLDeviceCertCache()
+{
+}
+
+BearSSLDeviceCertCache::~BearSSLDeviceCertCache()
+{
+}
+
+int BearSSLDeviceCertCache::write(uint32_t /*offset*/, const void* /*buffer*/, size_t /*length*/)
+{
+  return 0;
+}
+
+const uint8_t* BearSSLDeviceCertCache::map(uint32_t /*offset*/)
+{
+  return NULL;
+}
+
+const uint8_t* BearSSLDeviceCertCache::certificate(int slot, const char pem[], size_t* length, bool* allocated)
+{
+  uint8_t header[BEAR_SSL_DEVICE_CERT_HEADER_SIZE];
+
+  *length = 0;
+  *allocated = false;
+
+  if (!readHeader(header) || header[HEADER_SLOT] != slot || !(header[HEADER_FLAGS] & FLAG_CERTIFICATE) ||
+      dec32(&header[HEADER_PEM_KEY]) != fnv1a(2166136261UL, (const uint8_t*)pem, strlen(pem))) {
+    return NULL;
+  }
+
+  size_t derLength = dec16(&header[HEADER_LENGTH]);
+  const uint8_t* der = map(BEAR_SSL_DEVICE_CERT_HEADER_SIZE);
+
+  if (der == NULL) {
+#ifdef BEARSSL_NO_HEAP
+    return NULL;
+#else
+    uint8_t* copy = (uint8_t*)malloc(derLength);
+
+    if (copy == NULL || !read(BEAR_SSL_DEVICE_CERT_HEADER_SIZE, copy, derLength)) {
+      free(copy);
+      return NULL;
+    }
+
+    der = copy;
+    *allocated = true;
+#endif
+  }
+
+  *length = derLength;
+
+  return der;
+}
+
+int BearSSLDeviceCertCache::saveCertificate(int slot, const char pem[], const uint8_t* der, size_t length)
+{
+  uint8_t header[BEAR_SSL_DEVICE_CERT_HEADER_SIZE];
+  uint8_t flags = FLAG_CERTIFICATE;
+
+  if (length == 0 || length > 0xffff) {
+    return 0;
+  }
+
+  // a public key already read for this slot is kept
+  if (readHeader(header) && header[HEADER_SLOT] == slot && (header[HEADER_FLAGS] & FLAG_PUBLIC_KEY)) {
+    flags |= FLAG_PUBLIC_KEY;
+  } else {
+    memset(header, 0x00, sizeof(header));
+  }
+
+  memcpy(header, "BDC1", 4);
+  header[HEADER_SLOT] = slot;
+  enc32(&header[HEADER_PEM_KEY], fnv1a(2166136261UL, (const uint8_t*)pem, strlen(pem)));
+  header[HEADER_FLAGS] = flags;
+  enc16(&header[HEADER_LENGTH], length);
+
+  // the certificate goes first, an interrupted update leaves a header
+  // whose checksum does not match
+  if (!write(BEAR_SSL_DEVICE_CERT_HEADER_SIZE, der, length)) {
+    return 0;
+  }
+
+  return writeHeader(header);
+}
+
+int BearSSLDeviceCertCache::publicKey(int slot, uint8_t publicKey[64])
+{
+  uint8_t header[BEAR_SSL_DEVICE_CERT_HEADER_SIZE];
+  int valid = readHeader(header) && header[HEADER_SLOT] == slot;
+
+  if (valid && (header[HEADER_FLAGS] & FLAG_PUBLIC_KEY)) {
+    memcpy(publicKey, &header[HEADER_PUBLIC_KEY], 64);
+    return 1;
+  }
+
+  SecureElement* element = ArduinoBearSSL.secureElement();
+
+  if (element == NULL || !element->ready() || !element->publicKey(slot, publicKey)) {
+    return 0;
+  }
+
+  if (!valid) {
+    memset(header, 0x00, sizeof(header));
+    memcpy(header, "BDC1", 4);
+    header[HEADER_SLOT] = slot;
+  }
+
+  header[HEADER_FLAGS] |= FLAG_PUBLIC_KEY;
+  memcpy(&header[HEADER_PUBLIC_KEY], publicKey, 64);
+
+  // the key is good even if it cannot be stored
+  writeHeader(header);
+
+  return 1;
+}
+
+int BearSSLDeviceCertCache::readHeader(uint8_t header[BEAR_SSL_DEVICE_CERT_HEADER_SIZE])
+{
+  if (!read(0, header, BEAR_SSL_DEVICE_CERT_HEADER_SIZE) || memcmp(header, "BDC1", 4) != 0) {
+    return 0;
+  }
+
+  size_t length = (header[HEADER_FLAGS] & FLAG_CERTIFICATE) ? dec16(&header[HEADER_LENGTH]) : 0;
+
+  return dec32(&header[HEADER_CHECKSUM]) == checksum(header, length);
+}
+
+int BearSSLDeviceCertCache::writeHeader(uint8_t header[BEAR_SSL_DEVICE_CERT_HEADER_SIZE])
+{
+  size_t length = (header[HEADER_FLAGS] & FLAG_CERTIFICATE) ? dec16(&header[HEADER_LENGTH]) : 0;
+
+  enc32(&header[HEADER_CHECKSUM], checksum(header, length));
+
+  return write(0, header, BEAR_SSL_DEVICE_CERT_HEADER_SIZE);
+}
+
+uint32_t BearSSLDeviceCertCache::checksum(const uint8_t header[BEAR_SSL_DEVICE_CERT_HEADER_SIZE], size_t length)
+{
+  uint32_t hash = fnv1a(2166136261UL, header, HEADER_CHECKSUM);
+  uint32_t offset = BEAR_SSL_DEVICE_CERT_HEADER_SIZE;
+  uint8_t buffer[64];
+
+  // the certificate as stored, so that saveCertificate() also checks
+  // what was written
+  while (length) {
+    size_t chunk = length < sizeof(buffer) ? length : sizeof(buffer);
+
+    if (!read(offset, buffer, chunk)) {
+      return ~dec32(&header[HEADER_CHECKSUM]);
+    }
+
+    hash = fnv1a(hash, buffer, chunk);
+    offset += chunk;
+    length -= chunk;
+  }
+
+  return hash;
+}
+
+BearSSLMemoryDeviceCertCache::BearSSLMemoryDeviceCertCache(const void* image, size_t size) :
+  _image((const uint8_t*)image),
+  _writable(NULL),
+  _size(size)
+{
+}
+
+BearSSLMemoryDeviceCertCache::BearSSLMemoryDeviceCertCache(void* image, size_t size) :
+  _image((const uint8_t*)image),
+  _writable((uint8_t*)image),
+  _size(size)
+{
+}
+
+BearSSLMemoryDeviceCertCache::~BearSSLMemoryDeviceCertCache()
+{
+}
+
+int BearSSLMemoryDeviceCertCache::read(uint32_t offset, void* buffer, size_t length)
+{
+  if (offset > _size || length > _size - offset) {
+    return 0;
+  }
+
+  memcpy(buffer, _image + offset, length);
+
+  return 1;
+}
+
+int BearSSLMemoryDeviceCertCache::write(uint32_t offset, const void* buffer, size_t length)
+{
+  if (_writable == NULL || offset > _size || length > _size - offset) {
+    return 0;
+  }
+
+  memcpy(_writable + offset, buffer, length);
+
+  return 1;
+}
+
+const uint8_t* BearSSLMemoryDeviceCertCache::map(uint32_t offset)
+{
+  return (offset <= _size) ? _image + offset : NULL;
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _BEAR_SSL_DEVICE_CERT_CACHE_H_
+#define _BEAR_SSL_DEVICE_CERT_CACHE_H_
+
+#include <Arduino.h>
+
+#include "bearssl/bearssl.h"
+
+#include "BearSSLConfig.h"
+
+// size of the record header: magic, slot, PEM key, flags, DER length,
+// public key and checksum; the DER certificate follows
+#define BEAR_SSL_DEVICE_CERT_HEADER_SIZE (4 + 1 + 4 + 1 + 2 + 64 + 4)
+
+// Keeps the device certificate of an ECCX08 slot in DER form, and the
+// public key of the slot, once they have been reconstructed, so that
+// later boots skip the PEM decoding (see BearSSLClient::setEccSlot())
+// and the read of the key from the chip. Subclasses implement read() for
+// their storage and write() to fill it; storage that is memory mapped
+// (e.g. internal or QSPI flash) also implements map(), the certificate
+// is then used in place instead of being copied to RAM.
+class BearSSLDeviceCertCache {
+
+public:
+  BearSSLDeviceCertCache();
+  virtual ~BearSSLDeviceCertCache();
+
+  // copy length bytes at offset of the storage into buffer, 1 on success
+  virtual int read(uint32_t offset, void* buffer, size_t length) = 0;
+
+  // copy length bytes of buffer to offset of the storage, 1 on success,
+  // caches are read-only unless this is overridden
+  virtual int write(uint32_t offset, const void* buffer, size_t length);
+
+  // address of offset for memory mapped storage, NULL otherwise
+  virtual const uint8_t* map(uint32_t offset);
+
+  // DER certificate stored for this slot and PEM text, NULL if there is
+  // none. It is in place when the storage is mapped, otherwise in a
+  // buffer from malloc() that the caller frees (*allocated is set), or
+  // NULL with BEARSSL_NO_HEAP
+  const uint8_t* certificate(int slot, const char pem[], size_t* length, bool* allocated);
+  int saveCertificate(int slot, const char pem[], const uint8_t* der, size_t length);
+
+  // public key (X and Y) of slot, read from the secure element and
+  // stored with the certificate if it is not known yet
+  int publicKey(int slot, uint8_t publicKey[64]);
+
+private:
+  int readHeader(uint8_t header[BEAR_SSL_DEVICE_CERT_HEADER_SIZE]);
+  int writeHeader(uint8_t header[BEAR_SSL_DEVICE_CERT_HEADER_SIZE]);
+  uint32_t checksum(const uint8_t header[BEAR_SSL_DEVICE_CERT_HEADER_SIZE], size_t length);
+};
+
+// A cache in memory, e.g. memory mapped flash written by the sketch or
+// RAM that is retained during deep sleep.
+class BearSSLMemoryDeviceCertCache : public BearSSLDeviceCertCache {
+
+public:
+  BearSSLMemoryDeviceCertCache(const void* image, size_t size);
+  // a writable image is filled by BearSSLClient::setEccSlot()
+  BearSSLMemoryDeviceCertCache(void* image, size_t size);
+  virtual ~BearSSLMemoryDeviceCertCache();
+
+  virtual int read(uint32_t offset, void* buffer, size_t length);
+  virtual int write(uint32_t offset, const void* buffer, size_t length);
+  virtual const uint8_t* map(uint32_t offset);
+
+private:
+  const uint8_t* _image;
+  uint8_t* _writable;
+  size_t _size;
+};
+
+#endif
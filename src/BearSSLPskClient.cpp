@@ -0,0 +1,372 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ArduinoBearSSL.h"
+#include "BearSSLPskClient.h"
+
+#if BEARSSL_ENABLE_CHACHA
+
+static const uint16_t pskSuites[] = {
+  BEAR_SSL_PSK_CLIENT_SUITE
+};
+
+// X.509 engine of a client that never validates a chain: a server that
+// sends one did not resume the session
+static void pskStartChain(const br_x509_class** /*ctx*/, const char* /*serverName*/)
+{
+}
+
+static void pskStartCert(const br_x509_class** /*ctx*/, uint32_t /*length*/)
+{
+}
+
+static void pskAppend(const br_x509_class** /*ctx*/, const unsigned char* /*buf*/, size_t /*len*/)
+{
+}
+
+static void pskEndCert(const br_x509_class** /*ctx*/)
+{
+}
+
+static unsigned pskEndChain(const br_x509_class** /*ctx*/)
+{
+  return BEAR_SSL_CLIENT_ERR_NOT_RESUMED;
+}
+
+static const br_x509_pkey* pskGetPkey(const br_x509_class* const* /*ctx*/, unsigned* /*usages*/)
+{
+  return NULL;
+}
+
+static const br_x509_class pskX509Vtable = {
+  sizeof(const br_x509_class*),
+  pskStartChain,
+  pskStartCert,
+  pskAppend,
+  pskEndCert,
+  pskEndChain,
+  pskGetPkey
+};
+
+BearSSLPskClient::BearSSLPskClient(Client& client) :
+  _client(&client),
+  _connected(false),
+  _identity(NULL),
+  _key(NULL),
+  _keyLength(0),
+  _x509(&pskX509Vtable),
+  _handshakeTimeout(BEAR_SSL_PSK_CLIENT_HANDSHAKE_TIMEOUT),
+  _handshaking(false),
+  _error(0)
+{
+}
+
+BearSSLPskClient::~BearSSLPskClient()
+{
+  stop();
+}
+
+void BearSSLPskClient::setPSK(const char* identity, const uint8_t key[], size_t keyLength)
+{
+  _identity = identity;
+  _key = key;
+  _keyLength = keyLength;
+}
+
+int BearSSLPskClient::connect(IPAddress ip, uint16_t port)
+{
+  stop();
+
+  if (!_client->connect(ip, port)) {
+    _error = 0;
+    return 0;
+  }
+
+  return connectSSL(NULL);
+}
+
+int BearSSLPskClient::connect(const char* host, uint16_t port)
+{
+  stop();
+
+  if (!_client->connect(host, port)) {
+    _error = 0;
+    return 0;
+  }
+
+  return connectSSL(host);
+}
+
+int BearSSLPskClient::connectSSL(const char* host)
+{
+  _error = 0;
+
+  if (_identity == NULL) {
+    _error = BR_ERR_BAD_PARAM;
+    _client->stop();
+    return 0;
+  }
+
+  // only what a resumed ChaCha20-Poly1305 session runs
+  br_ssl_client_zero(&_sc);
+  br_ssl_engine_set_versions(&_sc.eng, BR_TLS12, BR_TLS12);
+  br_ssl_engine_set_suites(&_sc.eng, pskSuites, sizeof(pskSuites) / sizeof(pskSuites[0]));
+  br_ssl_engine_set_hash(&_sc.eng, br_sha256_ID, &br_sha256_vtable);
+  br_ssl_engine_set_prf_sha256(&_sc.eng, &br_tls12_sha256_prf);
+  br_ssl_engine_set_chapol(&_sc.eng, &br_sslrec_in_chapol_vtable, &br_sslrec_out_chapol_vtable);
+  br_ssl_engine_set_chacha20(&_sc.eng, &br_chacha20_ct_run);
+  // the 32x32->64 multiplications of ctmul are slow on small cores
+  br_ssl_engine_set_poly1305(&_sc.eng, &br_poly1305_ctmul32_run);
+  br_ssl_engine_set_x509(&_sc.eng, &_x509);
+  br_ssl_engine_add_flags(&_sc.eng, BR_OPT_NO_RENEGOTIATION);
+
+  br_ssl_engine_set_buffers_bidi(&_sc.eng, _ibuf, sizeof(_ibuf), _obuf, sizeof(_obuf));
+
+  unsigned char entropy[32];
+
+  ArduinoBearSSL.getRandom(entropy, sizeof(entropy));
+  br_ssl_engine_inject_entropy(&_sc.eng, entropy, sizeof(entropy));
+
+  br_ssl_session_parameters session;
+
+  BearSSLSessionStore::pskSession(_identity, _key, _keyLength, &session, BEAR_SSL_PSK_CLIENT_SUITE);
+  br_ssl_engine_set_session_parameters(&_sc.eng, &session);
+  memset(&session, 0x00, sizeof(session));
+
+  if (!br_ssl_client_reset(&_sc, host, 1)) {
+    _error = br_ssl_engine_last_error(&_sc.eng);
+    _client->stop();
+    return 0;
+  }
+
+  br_sslio_init(&_ioc, &_sc.eng, BearSSLPskClient::clientRead, this, BearSSLPskClient::clientWrite, this);
+
+  _handshaking = true;
+  _connected = true;
+
+  unsigned long start = millis();
+
+  for (;;) {
+    int result = br_sslio_step(&_ioc, BR_SSL_SENDAPP | BR_SSL_RECVAPP);
+
+    if (result > 0) {
+      break;
+    }
+
+    if (result < 0) {
+      _error = br_ssl_engine_last_error(&_sc.eng);
+    } else if ((millis() - start) >= _handshakeTimeout) {
+      _error = BEAR_SSL_CLIENT_ERR_TIMEOUT;
+    } else {
+      continue;
+    }
+
+    _handshaking = false;
+    _connected = false;
+    _client->stop();
+    return 0;
+  }
+
+  _handshaking = false;
+
+  return 1;
+}
+
+size_t BearSSLPskClient::write(uint8_t b)
+{
+  return write(&b, sizeof(b));
+}
+
+size_t BearSSLPskClient::write(const uint8_t *buf, size_t size)
+{
+  if (!_connected) {
+    return 0;
+  }
+
+  // full records go out right away, the rest on flush()
+  if (br_sslio_write_all(&_ioc, buf, size) < 0) {
+    return 0;
+  }
+
+  return size;
+}
+
+int BearSSLPskClient::available()
+{
+  if (!_connected) {
+    return 0;
+  }
+
+  // the server usually waits for the request before answering
+  flush();
+
+  int available = br_sslio_read_available(&_ioc);
+
+  if (available < 0) {
+    available = 0;
+  }
+
+  return available;
+}
+
+int BearSSLPskClient::read()
+{
+  byte b;
+
+  if (read(&b, sizeof(b)) == sizeof(b)) {
+    return b;
+  }
+
+  return -1;
+}
+
+int BearSSLPskClient::read(uint8_t *buf, size_t size)
+{
+  // never blocks, like the transport clients
+  if (available() == 0) {
+    return -1;
+  }
+
+  return br_sslio_read(&_ioc, buf, size);
+}
+
+int BearSSLPskClient::peek()
+{
+  byte b;
+
+  if (available() == 0 || br_sslio_peek(&_ioc, &b, sizeof(b)) != sizeof(b)) {
+    return -1;
+  }
+
+  return b;
+}
+
+void BearSSLPskClient::flush()
+{
+  if (!_connected) {
+    return;
+  }
+
+  br_sslio_flush(&_ioc);
+}
+
+void BearSSLPskClient::stop()
+{
+  if (!_connected) {
+    return;
+  }
+
+  if ((br_ssl_engine_current_state(&_sc.eng) & BR_SSL_CLOSED) == 0) {
+    br_ssl_engine_close(&_sc.eng);
+
+    // send what is buffered and our close_notify
+    while ((br_ssl_engine_current_state(&_sc.eng) & BR_SSL_SENDREC) && br_sslio_step(&_ioc, 0) >= 0);
+  }
+
+  _client->stop();
+  _connected = false;
+}
+
+uint8_t BearSSLPskClient::connected()
+{
+  if (!_connected) {
+    return 0;
+  }
+
+  unsigned state = br_ssl_engine_current_state(&_sc.eng);
+
+  if (state == BR_SSL_CLOSED) {
+    return 0;
+  }
+
+  // decrypted data can still be read after the peer closed
+  if (state & BR_SSL_RECVAPP) {
+    return 1;
+  }
+
+  return _client->connected();
+}
+
+BearSSLPskClient::operator bool()
+{
+  return _connected;
+}
+
+void BearSSLPskClient::setHandshakeTimeout(unsigned long timeout)
+{
+  _handshakeTimeout = timeout;
+}
+
+int BearSSLPskClient::errorCode()
+{
+  if (_connected) {
+    int error = br_ssl_engine_last_error(&_sc.eng);
+
+    if (error != BR_ERR_OK) {
+      return error;
+    }
+  }
+
+  return _error;
+}
+
+int BearSSLPskClient::clientRead(void *ctx, unsigned char *buf, size_t len)
+{
+  Client* c = ((BearSSLPskClient*)ctx)->_client;
+  int available = c->available();
+
+  if (available <= 0) {
+    // nothing received yet, the callers poll again
+    return c->connected() ? 0 : -1;
+  }
+
+  if ((size_t)available < len) {
+    len = available;
+  }
+
+  int result = c->read(buf, len);
+
+  return (result < 0) ? 0 : result;
+}
+
+int BearSSLPskClient::clientWrite(void *ctx, const unsigned char *buf, size_t len)
+{
+  BearSSLPskClient* pc = (BearSSLPskClient*)ctx;
+  Client* c = pc->_client;
+
+  if (!c->connected()) {
+    return -1;
+  }
+
+  int result = c->write(buf, len);
+
+  if (result == 0) {
+    // connect() retries until its deadline, afterwards it is an error
+    return pc->_handshaking ? 0 : -1;
+  }
+
+  return result;
+}
+
+#endif
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _BEAR_SSL_PSK_CLIENT_H_
+#define _BEAR_SSL_PSK_CLIENT_H_
+
+#include "BearSSLClient.h"
+
+// records of up to 512 bytes, negotiated with the maximum fragment
+// length extension from the input buffer size
+#ifndef BEAR_SSL_PSK_CLIENT_IBUF_SIZE
+#define BEAR_SSL_PSK_CLIENT_IBUF_SIZE 512 + BEAR_SSL_RECORD_IN_OVERHEAD
+#endif
+
+#ifndef BEAR_SSL_PSK_CLIENT_OBUF_SIZE
+#define BEAR_SSL_PSK_CLIENT_OBUF_SIZE 512 + BEAR_SSL_RECORD_OUT_OVERHEAD
+#endif
+
+#ifndef BEAR_SSL_PSK_CLIENT_HANDSHAKE_TIMEOUT
+#define BEAR_SSL_PSK_CLIENT_HANDSHAKE_TIMEOUT 10000
+#endif
+
+// the suite of the PSK session, for BearSSLServer::setPSK()
+#define BEAR_SSL_PSK_CLIENT_SUITE BR_TLS_ECDHE_ECDSA_WITH_CHACHA20_POLY1305_SHA256
+
+#if BEARSSL_ENABLE_CHACHA
+// A TLS client for the smallest boards (e.g. the Nano Every, 6 kB of RAM
+// and 48 kB of flash): it only resumes the session derived from a
+// pre-shared key (see BearSSLSessionStore::pskSession()) with
+// ChaCha20-Poly1305, SHA-256 and record buffers of about 1.4 kB in the
+// object, so that no X.509, public key, AES or other hash code is linked.
+// The server must run BearSSLServer with setPSK() for the same identity,
+// key and BEAR_SSL_PSK_CLIENT_SUITE; a server that does not resume the
+// session fails the connect() (BEAR_SSL_CLIENT_ERR_NOT_RESUMED).
+class BearSSLPskClient : public Client {
+
+public:
+  BearSSLPskClient(Client& client);
+  virtual ~BearSSLPskClient();
+
+  // identity and key must stay valid, they are read on every connect()
+  void setPSK(const char* identity, const uint8_t key[], size_t keyLength);
+
+  virtual int connect(IPAddress ip, uint16_t port);
+  virtual int connect(const char* host, uint16_t port);
+
+  virtual size_t write(uint8_t);
+  virtual size_t write(const uint8_t *buf, size_t size);
+
+  virtual int available();
+  virtual int read();
+  virtual int read(uint8_t *buf, size_t size);
+  virtual int peek();
+  virtual void flush();
+  virtual void stop();
+  virtual uint8_t connected();
+  virtual operator bool();
+
+  using Print::write;
+
+  // milliseconds connect() waits for the handshake to complete
+  void setHandshakeTimeout(unsigned long timeout);
+
+  // BR_ERR_* engine error or BEAR_SSL_CLIENT_ERR_* of the last failure
+  int errorCode();
+
+private:
+  int connectSSL(const char* host);
+  static int clientRead(void *ctx, unsigned char *buf, size_t len);
+  static int clientWrite(void *ctx, const unsigned char *buf, size_t len);
+
+  Client* _client;
+  bool _connected;
+  const char* _identity;
+  const uint8_t* _key;
+  size_t _keyLength;
+
+  br_ssl_client_context _sc;
+  br_sslio_context _ioc;
+  const br_x509_class* _x509;
+
+  unsigned char _ibuf[BEAR_SSL_PSK_CLIENT_IBUF_SIZE];
+  unsigned char _obuf[BEAR_SSL_PSK_CLIENT_OBUF_SIZE];
+
+  unsigned long _handshakeTimeout;
+  bool _handshaking;
+  int _error;
+};
+#endif
+
+#endif
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ArduinoBearSSL.h"
+#include "BearSSLReconnectPolicy.h"
+
+// TLS alert sent by a server that failed on its side
+#define ALERT_INTERNAL_ERROR 80
+
+BearSSLReconnectPolicy::BearSSLReconnectPolicy(BearSSLClient& client, unsigned long baseDelay, unsigned long maxDelay) :
+  _client(&client),
+  _baseDelay(baseDelay),
+  _maxDelay(maxDelay),
+  _maxAttempts(0)
+{
+  _client->setResumeSession(true);
+
+  reset();
+}
+
+BearSSLReconnectPolicy::~BearSSLReconnectPolicy()
+{
+}
+
+void BearSSLReconnectPolicy::setMaxAttempts(unsigned int attempts)
+{
+  _maxAttempts = attempts;
+}
+
+BearSSLReconnectPolicy::Status BearSSLReconnectPolicy::maintain(const char* host, uint16_t port)
+{
+  if (_client->connected()) {
+    _connected = true;
+    return Status::Connected;
+  }
+
+  if (_failed) {
+    return Status::Failed;
+  }
+
+  if (_connected) {
+    // the connection was lost: don't come back with everybody else
+    _connected = false;
+    schedule();
+    return Status::Waiting;
+  }
+
+  if (nextAttempt() != 0) {
+    return Status::Waiting;
+  }
+
+  // without a handshake state left from the last attempt, a failure is
+  // the transport's
+  _client->stop();
+
+  if (_client->connect(host, port)) {
+    _attempts = 0;
+    _lastError = 0;
+    _fullHandshake = false;
+    _connected = true;
+    return Status::Connected;
+  }
+
+  bool handshakeFailed = (_client->handshakeState() == BearSSLClient::HandshakeState::Failed);
+
+  _lastError = handshakeFailed ? _client->errorCode() : 0;
+  _attempts++;
+
+  if (handshakeFailed && !retryable(_lastError)) {
+    br_ssl_session_parameters session;
+
+    int offered = _client->getSession(&session);
+
+    memset(&session, 0x00, sizeof(session));
+
+    if (_fullHandshake || !offered) {
+      _failed = true;
+      return Status::Failed;
+    }
+
+    // the server may have refused the session, try once without it
+    _client->clearSession();
+    _fullHandshake = true;
+  }
+
+  if (_maxAttempts && _attempts >= _maxAttempts) {
+    _failed = true;
+    return Status::Failed;
+  }
+
+  schedule();
+
+  return Status::Waiting;
+}
+
+void BearSSLReconnectPolicy::reset()
+{
+  _attempts = 0;
+  _waitStart = 0;
+  _delay = 0;
+  _lastError = 0;
+  _connected = false;
+  _failed = false;
+  _fullHandshake = false;
+}
+
+unsigned int BearSSLReconnectPolicy::attempts()
+{
+  return _attempts;
+}
+
+unsigned long BearSSLReconnectPolicy::nextAttempt()
+{
+  unsigned long elapsed = millis() - _waitStart;
+
+  return (elapsed < _delay) ? _delay - elapsed : 0;
+}
+
+int BearSSLReconnectPolicy::lastError()
+{
+  return _lastError;
+}
+
+bool BearSSLReconnectPolicy::retryable(int error)
+{
+  switch (error) {
+    case 0:
+    case BR_ERR_IO:
+    case BR_ERR_BAD_MAC:
+    case BR_ERR_RECV_FATAL_ALERT + ALERT_INTERNAL_ERROR:
+    case BEAR_SSL_CLIENT_ERR_TIMEOUT:
+    case BEAR_SSL_CLIENT_ERR_NO_BUFFERS:
+      return true;
+
+    default:
+      return false;
+  }
+}
+
+void BearSSLReconnectPolicy::schedule()
+{
+  unsigned long limit = _baseDelay;
+
+  for (unsigned int i = 0; i < _attempts && limit < _maxDelay; i++) {
+    limit <<= 1;
+  }
+
+  if (limit > _maxDelay) {
+    limit = _maxDelay;
+  }
+
+  uint32_t random = 0;
+
+  ArduinoBearSSL.getRandom((uint8_t*)&random, sizeof(random));
+
+  _waitStart = millis();
+  _delay = limit ? random % (limit + 1) : 0;
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _BEAR_SSL_RECONNECT_POLICY_H_
+#define _BEAR_SSL_RECONNECT_POLICY_H_
+
+// first and largest delay between two attempts, in milliseconds
+#ifndef BEAR_SSL_RECONNECT_BASE_DELAY
+#define BEAR_SSL_RECONNECT_BASE_DELAY 1000
+#endif
+
+#ifndef BEAR_SSL_RECONNECT_MAX_DELAY
+#define BEAR_SSL_RECONNECT_MAX_DELAY 300000
+#endif
+
+#include "BearSSLClient.h"
+
+// Reconnects a BearSSLClient from loop() after it failed or lost its
+// connection, with exponential backoff and full jitter: each delay is
+// drawn at random (from the DRBG, so that devices do not draw the same
+// sequence) below base * 2^attempts, capped at the maximum. Even the
+// first attempt after a connection is lost waits a random delay, so a
+// fleet that lost its broker at once does not come back at once.
+//
+// Session resumption is enabled on the client and the session is kept
+// across transport and timeout failures, so that the server mostly sees
+// abbreviated handshakes while it recovers. A failed handshake that
+// offered a session is retried once with a full handshake; other
+// handshake failures (certificate, protocol or configuration errors)
+// are not retryable and stop the policy until reset().
+class BearSSLReconnectPolicy {
+
+public:
+  enum class Status {
+    Connected,
+    Waiting,  // for the next attempt
+    Failed    // not retryable, or no attempts left
+  };
+
+  BearSSLReconnectPolicy(BearSSLClient& client, unsigned long baseDelay = BEAR_SSL_RECONNECT_BASE_DELAY, unsigned long maxDelay = BEAR_SSL_RECONNECT_MAX_DELAY);
+  virtual ~BearSSLReconnectPolicy();
+
+  // attempts in a row before giving up, 0 (the default) never gives up
+  void setMaxAttempts(unsigned int attempts);
+
+  // call from loop(): connects (blocking) when the next attempt is due
+  Status maintain(const char* host, uint16_t port);
+
+  // clears the failure and the backoff, e.g. after changing settings
+  void reset();
+
+  unsigned int attempts();
+  // milliseconds to wait before the next attempt
+  unsigned long nextAttempt();
+  // errorCode() of the last failed attempt, 0 for a transport failure
+  int lastError();
+
+  // transport failures, I/O errors and timeouts, corrupted records, the
+  // peer's internal_error alert and missing buffers
+  static bool retryable(int error);
+
+private:
+  void schedule();
+
+  BearSSLClient* _client;
+  unsigned long _baseDelay;
+  unsigned long _maxDelay;
+  unsigned int _maxAttempts;
+  unsigned int _attempts;
+  unsigned long _waitStart;
+  unsigned long _delay;
+  int _lastError;
+  bool _connected;
+  bool _failed;
+  bool _fullHandshake;
+};
+
+#endif
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "BearSSLRevocationFilter.h"
+
+#define HEADER_SIZE 9
+
+static uint32_t dec32(const uint8_t* p)
+{
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+BearSSLRevocationFilter::BearSSLRevocationFilter() :
+  _hashes(-1),
+  _bits(0)
+{
+}
+
+BearSSLRevocationFilter::~BearSSLRevocationFilter()
+{
+}
+
+int BearSSLRevocationFilter::valid()
+{
+  if (_hashes < 0) {
+    uint8_t header[HEADER_SIZE];
+
+    _hashes = 0;
+
+    if (read(0, header, sizeof(header)) && memcmp(header, "BRF1", 4) == 0) {
+      _bits = dec32(header + 5);
+
+      if (_bits != 0) {
+        _hashes = header[4];
+      }
+    }
+  }
+
+  return _hashes > 0;
+}
+
+int BearSSLRevocationFilter::contains(const uint8_t key[32])
+{
+  if (!valid()) {
+    return 0;
+  }
+
+  // double hashing over the first 8 bytes of the key
+  uint32_t h1 = dec32(key);
+  uint32_t h2 = dec32(key + 4) | 1;
+
+  for (int i = 0; i < _hashes; i++) {
+    uint32_t bit = (h1 + (uint32_t)i * h2) % _bits;
+    uint8_t b;
+
+    if (!read(HEADER_SIZE + (bit >> 3), &b, 1) || !(b & (1 << (bit & 7)))) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+int BearSSLRevocationFilter::check(void* ctx, const unsigned char key[32])
+{
+  return ((BearSSLRevocationFilter*)ctx)->contains(key);
+}
+
+BearSSLMemoryRevocationFilter::BearSSLMemoryRevocationFilter(const void* image, size_t size) :
+  _image((const uint8_t*)image),
+  _size(size)
+{
+}
+
+BearSSLMemoryRevocationFilter::~BearSSLMemoryRevocationFilter()
+{
+}
+
+int BearSSLMemoryRevocationFilter::read(uint32_t offset, void* buffer, size_t length)
+{
+  if (offset > _size || length > _size - offset) {
+    return 0;
+  }
+
+  memcpy(buffer, _image + offset, length);
+
+  return 1;
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _BEAR_SSL_REVOCATION_FILTER_H_
+#define _BEAR_SSL_REVOCATION_FILTER_H_
+
+#include <Arduino.h>
+
+#include "bearssl/bearssl.h"
+
+// Bloom filter of revoked certificates, built with
+// extras/generate_revocation_filter.py from CRLs or certificates. A
+// certificate is identified by the SHA-256 hash of its serial number
+// (contents of the DER INTEGER) followed by its DER encoded issuer Name.
+// The image starts with "BRF1", the number of hash functions (1 byte)
+// and the size of the filter in bits (4 bytes, big-endian), followed by
+// the filter bits. Subclasses implement read() for their storage.
+class BearSSLRevocationFilter {
+
+public:
+  BearSSLRevocationFilter();
+  virtual ~BearSSLRevocationFilter();
+
+  // copy length bytes at offset of the image into buffer, 1 on success
+  virtual int read(uint32_t offset, void* buffer, size_t length) = 0;
+
+  // 1 if the image is valid, an invalid image revokes nothing
+  int valid();
+
+  // 1 if the certificate key is in the filter: it is revoked, or it is
+  // a false positive at the rate the filter was built for
+  int contains(const uint8_t key[32]);
+
+  // x509_revocation_check, ctx is the BearSSLRevocationFilter
+  static int check(void* ctx, const unsigned char key[32]);
+
+private:
+  int _hashes;
+  uint32_t _bits;
+};
+
+// An image in memory mapped storage, e.g. program or QSPI flash.
+class BearSSLMemoryRevocationFilter : public BearSSLRevocationFilter {
+
+public:
+  BearSSLMemoryRevocationFilter(const void* image, size_t size);
+  virtual ~BearSSLMemoryRevocationFilter();
+
+  virtual int read(uint32_t offset, void* buffer, size_t length);
+
+private:
+  const uint8_t* _image;
+  size_t _size;
+};
+
+#endif
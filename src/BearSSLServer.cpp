@@ -0,0 +1,603 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ArduinoBearSSL.h"
+#include "BearSSLServer.h"
+#include "utility/ssl_features.h"
+
+BearSSLServer::BearSSLServer(const br_x509_certificate* chain, size_t chainLen, const br_ec_private_key* key, unsigned issuerKeyType) :
+  _chain(chain),
+  _chainLen(chainLen),
+  _ecKey(key),
+  _rsaKey(NULL),
+  _issuerKeyType(issuerKeyType),
+#ifndef BEAR_SSL_SERVER_DISABLE_FULL_PROFILE
+  _profile(Profile::Full),
+#else
+  _profile(Profile::Minimal),
+#endif
+  _cacheStore(NULL),
+  _cacheSize(0),
+  _ownCache(false),
+  _psk(false)
+{
+  _seKey.element = NULL;
+  _seKey.slot = -1;
+  session_cache_stats_init(&_cacheStats, NULL);
+}
+
+BearSSLServer::BearSSLServer(const br_x509_certificate* chain, size_t chainLen, const br_rsa_private_key* key) :
+  _chain(chain),
+  _chainLen(chainLen),
+  _ecKey(NULL),
+  _rsaKey(key),
+  _issuerKeyType(BR_KEYTYPE_RSA),
+#ifndef BEAR_SSL_SERVER_DISABLE_FULL_PROFILE
+  _profile(Profile::Full),
+#else
+  _profile(Profile::Minimal),
+#endif
+  _cacheStore(NULL),
+  _cacheSize(0),
+  _ownCache(false),
+  _psk(false)
+{
+  _seKey.element = NULL;
+  _seKey.slot = -1;
+  session_cache_stats_init(&_cacheStats, NULL);
+}
+
+BearSSLServer::~BearSSLServer()
+{
+  freeCache();
+}
+
+void BearSSLServer::setSessionCache(void* store, size_t size)
+{
+  freeCache();
+
+  if (store == NULL || size == 0) {
+    return;
+  }
+
+  _cacheStore = (unsigned char*)store;
+  _cacheSize = size;
+
+  br_ssl_session_cache_lru_init(&_cache, _cacheStore, _cacheSize);
+  resetSessionCacheStats();
+}
+
+int BearSSLServer::setSessionCacheSize(size_t size)
+{
+  freeCache();
+
+  if (size == 0) {
+    return 1;
+  }
+
+#ifdef BEARSSL_NO_HEAP
+  void* store = NULL;
+#else
+  void* store = malloc(size);
+#endif
+
+  if (store == NULL) {
+    return 0;
+  }
+
+  setSessionCache(store, size);
+  _ownCache = true;
+
+  return 1;
+}
+
+void BearSSLServer::setPSK(const char* identity, const uint8_t key[], size_t keyLength, uint16_t suite)
+{
+  _psk = (identity != NULL);
+
+  if (_psk) {
+    BearSSLSessionStore::pskSession(identity, key, keyLength, &_pskSession, suite);
+  } else {
+    memset(&_pskSession, 0x00, sizeof(_pskSession));
+  }
+}
+
+void BearSSLServer::sessionCacheStats(BearSSLSessionCacheStats& stats)
+{
+  stats.hits = _cacheStats.hits;
+  stats.misses = _cacheStats.misses;
+  stats.saves = _cacheStats.saves;
+  stats.capacity = _cacheSize / BEAR_SSL_SERVER_SESSION_SIZE;
+}
+
+void BearSSLServer::resetSessionCacheStats()
+{
+  _cacheStats.hits = 0;
+  _cacheStats.misses = 0;
+  _cacheStats.saves = 0;
+}
+
+void BearSSLServer::freeCache()
+{
+  if (_ownCache) {
+    // the cached sessions hold master secrets
+    memset(_cacheStore, 0x00, _cacheSize);
+    free(_cacheStore);
+  }
+
+  _cacheStore = NULL;
+  _cacheSize = 0;
+  _ownCache = false;
+}
+
+void BearSSLServer::setEccSlot(int ecc508KeySlot)
+{
+  // the key stays in the secure element, x refers to its slot
+  _seKey.element = (ecc508KeySlot < 0) ? NULL : ArduinoBearSSL.secureElement();
+  _seKey.slot = ecc508KeySlot;
+  _seEcKey.curve = BR_EC_secp256r1;
+  _seEcKey.x = (unsigned char*)&_seKey;
+  _seEcKey.xlen = 32;
+}
+
+int BearSSLServer::setProfile(Profile profile)
+{
+#ifdef BEAR_SSL_SERVER_DISABLE_FULL_PROFILE
+  if (profile == Profile::Full) {
+    return 0;
+  }
+#endif
+  if ((profile == Profile::Minimal && !BEARSSL_ENABLE_GCM) ||
+      (profile == Profile::ChaChaOnly && !BEARSSL_ENABLE_CHACHA)) {
+    return 0;
+  }
+
+  _profile = profile;
+
+  return 1;
+}
+
+int BearSSLServer::init(br_ssl_server_context* sc)
+{
+  if (_ecKey == NULL && _rsaKey == NULL && _seKey.element == NULL) {
+    return 0;
+  }
+
+  if (!BEARSSL_ENABLE_RSA && _rsaKey != NULL && _seKey.element == NULL) {
+    return 0;
+  }
+
+#ifndef BEAR_SSL_SERVER_DISABLE_FULL_PROFILE
+  if (_profile == Profile::Full) {
+#if BEARSSL_ENABLE_ALL
+    if (_rsaKey != NULL) {
+      br_ssl_server_init_full_rsa(sc, _chain, _chainLen, _rsaKey);
+    } else {
+      br_ssl_server_init_full_ec(sc, _chain, _chainLen, _issuerKeyType, _ecKey);
+    }
+#else
+    initFeatures(sc);
+#endif
+  } else
+#endif
+  {
+    initProfile(sc);
+  }
+
+  if (_seKey.element != NULL) {
+    secure_element_scert_init(&_sePolicy, _chain, _chainLen, &_seEcKey);
+    br_ssl_server_set_policy(sc, &_sePolicy.vtable);
+  }
+
+  // the PSK session in front of the LRU cache, both behind the counters
+  const br_ssl_session_cache_class** cache = (_cacheStore != NULL) ? &_cache.vtable : NULL;
+
+  if (_psk) {
+    session_cache_psk_init(&_pskCache, cache, &_pskSession);
+    cache = &_pskCache.vtable;
+  }
+
+  if (cache != NULL) {
+    _cacheStats.inner = cache;
+    br_ssl_server_set_cache(sc, &_cacheStats.vtable);
+  }
+
+  // a client asking for renegotiations would make us sign over and over
+  br_ssl_engine_add_flags(&sc->eng, BR_OPT_NO_RENEGOTIATION);
+
+  return 1;
+}
+
+// like br_ssl_server_init_minf2g() and friends, without br_ec_all_m15:
+// every browser offers P-256 for ECDHE
+void BearSSLServer::initProfile(br_ssl_server_context* sc)
+{
+  static const uint16_t suites[][2] = {
+    { BR_TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256, BR_TLS_ECDHE_RSA_WITH_AES_128_GCM_SHA256 },
+    { BR_TLS_ECDHE_ECDSA_WITH_CHACHA20_POLY1305_SHA256, BR_TLS_ECDHE_RSA_WITH_CHACHA20_POLY1305_SHA256 }
+  };
+  bool chapol = BEARSSL_ENABLE_CHACHA && (_profile == Profile::ChaChaOnly);
+  bool rsa = BEARSSL_ENABLE_RSA && (_rsaKey != NULL && _seKey.element == NULL);
+
+  br_ssl_server_zero(sc);
+  br_ssl_engine_set_versions(&sc->eng, BR_TLS12, BR_TLS12);
+  br_ssl_engine_set_suites(&sc->eng, &suites[chapol][rsa], 1);
+  br_ssl_engine_set_ec(&sc->eng, &br_ec_p256_m15);
+
+  if (rsa) {
+#if BEARSSL_ENABLE_RSA
+    br_ssl_server_set_single_rsa(sc, _chain, _chainLen, _rsaKey, BR_KEYTYPE_SIGN,
+      br_rsa_private_get_default(), br_rsa_pkcs1_sign_get_default());
+#endif
+  } else {
+    br_ssl_server_set_single_ec(sc, _chain, _chainLen, _ecKey, BR_KEYTYPE_SIGN,
+      0, &br_ec_p256_m15, br_ecdsa_i15_sign_asn1);
+  }
+
+  br_ssl_engine_set_hash(&sc->eng, br_sha256_ID, &br_sha256_vtable);
+  br_ssl_engine_set_prf_sha256(&sc->eng, &br_tls12_sha256_prf);
+
+  if (chapol) {
+#if BEARSSL_ENABLE_CHACHA
+    br_ssl_engine_set_default_chapol(&sc->eng);
+#endif
+  } else {
+#if BEARSSL_ENABLE_GCM
+    br_ssl_engine_set_default_aes_gcm(&sc->eng);
+#endif
+  }
+}
+
+#if !BEARSSL_ENABLE_ALL
+// br_ssl_server_init_full_ec/rsa() without the algorithms disabled in
+// BearSSLConfig.h, which they would otherwise link in
+void BearSSLServer::initFeatures(br_ssl_server_context* sc)
+{
+  // P-384 and P-521 share the generic prime curve code, without both the
+  // restricted profiles' P-256 implementation does
+#if BEARSSL_ENABLE_P384 || BEARSSL_ENABLE_P521
+  const br_ec_impl* ec = br_ec_get_default();
+#else
+  const br_ec_impl* ec = &br_ec_p256_m15;
+#endif
+
+  br_ssl_server_zero(sc);
+  ssl_features_init(&sc->eng, NULL, ec);
+
+#if BEARSSL_ENABLE_RSA
+  if (_rsaKey != NULL) {
+    br_ssl_server_set_single_rsa(sc, _chain, _chainLen, _rsaKey, BR_KEYTYPE_KEYX | BR_KEYTYPE_SIGN,
+      br_rsa_private_get_default(), br_rsa_pkcs1_sign_get_default());
+    return;
+  }
+#endif
+
+  br_ssl_server_set_single_ec(sc, _chain, _chainLen, _ecKey, BR_KEYTYPE_KEYX | BR_KEYTYPE_SIGN,
+    _issuerKeyType, ec, br_ecdsa_sign_asn1_get_default());
+}
+#endif
+
+BearSSLServerClient::BearSSLServerClient(BearSSLServer& server) :
+  _server(server),
+  _client(NULL),
+  _ibuf(NULL),
+  _ibufSize(0),
+  _obuf(NULL),
+  _obufSize(0),
+  _ownBuffers(false),
+  _handshakeTimeout(BEAR_SSL_SERVER_HANDSHAKE_TIMEOUT),
+  _handshakeStart(0),
+  _handshaking(false),
+  _error(0)
+{
+}
+
+BearSSLServerClient::~BearSSLServerClient()
+{
+  stop();
+
+  if (_ownBuffers) {
+    free(_ibuf);
+    free(_obuf);
+  }
+}
+
+int BearSSLServerClient::accept(Client& client)
+{
+  stop();
+
+  _error = 0;
+
+  if (_ibuf == NULL) {
+#ifndef BEARSSL_NO_HEAP
+    _ibuf = (unsigned char*)malloc(BEAR_SSL_SERVER_IBUF_SIZE);
+    _obuf = (unsigned char*)malloc(BEAR_SSL_SERVER_OBUF_SIZE);
+#endif
+
+    if (_ibuf == NULL || _obuf == NULL) {
+      free(_ibuf);
+      free(_obuf);
+      _ibuf = NULL;
+      _obuf = NULL;
+      _error = BEAR_SSL_CLIENT_ERR_NO_BUFFERS;
+      client.stop();
+      return 0;
+    }
+
+    _ibufSize = BEAR_SSL_SERVER_IBUF_SIZE;
+    _obufSize = BEAR_SSL_SERVER_OBUF_SIZE;
+    _ownBuffers = true;
+  }
+
+  if (!_server.init(&_sc)) {
+    _error = BR_ERR_BAD_PARAM;
+    client.stop();
+    return 0;
+  }
+
+  br_ssl_engine_set_buffers_bidi(&_sc.eng, _ibuf, _ibufSize, _obuf, _obufSize);
+
+  unsigned char entropy[32];
+
+  ArduinoBearSSL.getRandom(entropy, sizeof(entropy));
+  br_ssl_engine_inject_entropy(&_sc.eng, entropy, sizeof(entropy));
+
+  if (!br_ssl_server_reset(&_sc)) {
+    _error = br_ssl_engine_last_error(&_sc.eng);
+    client.stop();
+    return 0;
+  }
+
+  _client = &client;
+  br_sslio_init(&_ioc, &_sc.eng, BearSSLServerClient::clientRead, this, BearSSLServerClient::clientWrite, this);
+
+  _handshaking = true;
+  _handshakeStart = millis();
+
+  for (;;) {
+    int result = br_sslio_step(&_ioc, BR_SSL_SENDAPP | BR_SSL_RECVAPP);
+
+    if (result > 0) {
+      break;
+    }
+
+    if (result < 0) {
+      _error = br_ssl_engine_last_error(&_sc.eng);
+    } else if ((millis() - _handshakeStart) >= _handshakeTimeout) {
+      _error = BEAR_SSL_CLIENT_ERR_TIMEOUT;
+    } else {
+      continue;
+    }
+
+    _handshaking = false;
+    _client->stop();
+    _client = NULL;
+    return 0;
+  }
+
+  _handshaking = false;
+
+  return 1;
+}
+
+int BearSSLServerClient::connect(IPAddress /*ip*/, uint16_t /*port*/)
+{
+  return 0;
+}
+
+int BearSSLServerClient::connect(const char* /*host*/, uint16_t /*port*/)
+{
+  return 0;
+}
+
+size_t BearSSLServerClient::write(uint8_t b)
+{
+  return write(&b, sizeof(b));
+}
+
+size_t BearSSLServerClient::write(const uint8_t *buf, size_t size)
+{
+  if (_client == NULL) {
+    return 0;
+  }
+
+  // full records go out right away, the rest on flush()
+  if (br_sslio_write_all(&_ioc, buf, size) < 0) {
+    return 0;
+  }
+
+  return size;
+}
+
+int BearSSLServerClient::available()
+{
+  if (_client == NULL) {
+    return 0;
+  }
+
+  // the peer usually waits for our response before sending more
+  flush();
+
+  int available = br_sslio_read_available(&_ioc);
+
+  if (available < 0) {
+    available = 0;
+  }
+
+  return available;
+}
+
+int BearSSLServerClient::read()
+{
+  byte b;
+
+  if (read(&b, sizeof(b)) == sizeof(b)) {
+    return b;
+  }
+
+  return -1;
+}
+
+int BearSSLServerClient::read(uint8_t *buf, size_t size)
+{
+  // never blocks, like the transport clients
+  if (available() == 0) {
+    return -1;
+  }
+
+  return br_sslio_read(&_ioc, buf, size);
+}
+
+int BearSSLServerClient::peek()
+{
+  byte b;
+
+  if (available() == 0 || br_sslio_peek(&_ioc, &b, sizeof(b)) != sizeof(b)) {
+    return -1;
+  }
+
+  return b;
+}
+
+void BearSSLServerClient::flush()
+{
+  if (_client == NULL) {
+    return;
+  }
+
+  br_sslio_flush(&_ioc);
+}
+
+void BearSSLServerClient::stop()
+{
+  if (_client == NULL) {
+    return;
+  }
+
+  if ((br_ssl_engine_current_state(&_sc.eng) & BR_SSL_CLOSED) == 0) {
+    br_ssl_engine_close(&_sc.eng);
+
+    // send what is buffered and our close_notify, without waiting for
+    // the browser's: it usually just drops the connection
+    while ((br_ssl_engine_current_state(&_sc.eng) & BR_SSL_SENDREC) && br_sslio_step(&_ioc, 0) >= 0);
+  }
+
+  _client->stop();
+  _client = NULL;
+}
+
+uint8_t BearSSLServerClient::connected()
+{
+  if (_client == NULL) {
+    return 0;
+  }
+
+  unsigned state = br_ssl_engine_current_state(&_sc.eng);
+
+  if (state == BR_SSL_CLOSED) {
+    return 0;
+  }
+
+  // decrypted data can still be read after the peer closed
+  if (state & BR_SSL_RECVAPP) {
+    return 1;
+  }
+
+  return _client->connected();
+}
+
+BearSSLServerClient::operator bool()
+{
+  return (_client != NULL);
+}
+
+void BearSSLServerClient::setBuffers(unsigned char* ibuf, size_t ibufSize, unsigned char* obuf, size_t obufSize)
+{
+  if (_ownBuffers) {
+    free(_ibuf);
+    free(_obuf);
+    _ownBuffers = false;
+  }
+
+  _ibuf = ibuf;
+  _ibufSize = ibufSize;
+  _obuf = obuf;
+  _obufSize = obufSize;
+}
+
+void BearSSLServerClient::setHandshakeTimeout(unsigned long timeout)
+{
+  _handshakeTimeout = timeout;
+}
+
+int BearSSLServerClient::errorCode()
+{
+  if (_client != NULL) {
+    int error = br_ssl_engine_last_error(&_sc.eng);
+
+    if (error != BR_ERR_OK) {
+      return error;
+    }
+  }
+
+  return _error;
+}
+
+int BearSSLServerClient::clientRead(void *ctx, unsigned char *buf, size_t len)
+{
+  Client* c = ((BearSSLServerClient*)ctx)->_client;
+  int available = c->available();
+
+  if (available <= 0) {
+    // nothing received yet, the callers poll again
+    return c->connected() ? 0 : -1;
+  }
+
+  if ((size_t)available < len) {
+    len = available;
+  }
+
+  int result = c->read(buf, len);
+
+  return (result < 0) ? 0 : result;
+}
+
+int BearSSLServerClient::clientWrite(void *ctx, const unsigned char *buf, size_t len)
+{
+  BearSSLServerClient* sc = (BearSSLServerClient*)ctx;
+  Client* c = sc->_client;
+
+  if (!c->connected()) {
+    return -1;
+  }
+
+  int result = c->write(buf, len);
+
+  if (result == 0) {
+    // accept() retries until its deadline, afterwards it is an error
+    return sc->_handshaking ? 0 : -1;
+  }
+
+  return result;
+}
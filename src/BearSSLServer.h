@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _BEAR_SSL_SERVER_H_
+#define _BEAR_SSL_SERVER_H_
+
+#include "BearSSLClient.h"
+#include "SecureElement.h"
+#include "utility/secure_element_scert.h"
+#include "utility/session_cache_psk.h"
+#include "utility/session_cache_stats.h"
+
+// browsers do not negotiate smaller records, the server must take 16 kB
+#ifndef BEAR_SSL_SERVER_IBUF_SIZE
+#define BEAR_SSL_SERVER_IBUF_SIZE 16384 + BEAR_SSL_RECORD_IN_OVERHEAD
+#endif
+
+#ifndef BEAR_SSL_SERVER_OBUF_SIZE
+#define BEAR_SSL_SERVER_OBUF_SIZE 512 + BEAR_SSL_RECORD_OUT_OVERHEAD
+#endif
+
+// bytes per session in the session cache, see ssl_lru.c
+#define BEAR_SSL_SERVER_SESSION_SIZE 100
+
+#ifndef BEAR_SSL_SERVER_HANDSHAKE_TIMEOUT
+#define BEAR_SSL_SERVER_HANDSHAKE_TIMEOUT 10000
+#endif
+
+struct BearSSLSessionCacheStats {
+  uint32_t hits;     // sessions resumed
+  uint32_t misses;   // resumptions refused: unknown, evicted or forgotten
+  uint32_t saves;    // sessions stored after a full handshake
+  size_t capacity;   // sessions the cache holds
+};
+
+// Certificate chain, private key and session cache of a TLS server, e.g.
+// a local HTTPS provisioning portal. The connections accepted through
+// BearSSLServerClient share the session cache, so a browser opening
+// several connections only pays for one full handshake.
+class BearSSLServer {
+
+public:
+  // chain and key must stay valid as long as the server; issuerKeyType is
+  // the key type of the CA that signed the EC certificate. key may be
+  // NULL when setEccSlot() provides it.
+  BearSSLServer(const br_x509_certificate* chain, size_t chainLen, const br_ec_private_key* key, unsigned issuerKeyType = BR_KEYTYPE_EC);
+  BearSSLServer(const br_x509_certificate* chain, size_t chainLen, const br_rsa_private_key* key);
+  virtual ~BearSSLServer();
+
+  // the P-256 key of the certificate is in this slot of the secure
+  // element (see ArduinoBearSSL.setSecureElement()), which signs the
+  // handshakes instead of software ECDSA; -1 goes back to the key given
+  // to the constructor
+  void setEccSlot(int ecc508KeySlot);
+
+  // resume sessions from an LRU cache kept in store, at
+  // BEAR_SSL_SERVER_SESSION_SIZE bytes per session; NULL disables resumption
+  void setSessionCache(void* store, size_t size);
+  // same with size bytes from the heap, 0 frees them
+  int setSessionCacheSize(size_t size);
+
+  // resume the session derived from identity and key for clients with
+  // the same PSK (see BearSSLClient::setPSK()), with or without a session
+  // cache; their handshakes skip the certificate and the signature. The
+  // profile must accept suite, e.g. ChaCha20 for BearSSLPskClient. NULL
+  // disables it.
+  void setPSK(const char* identity, const uint8_t key[], size_t keyLength,
+              uint16_t suite = BR_TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256);
+
+  void sessionCacheStats(BearSSLSessionCacheStats& stats);
+  void resetSessionCacheStats();
+
+  enum class Profile {
+    Full,       // everything br_ssl_server_init_full_ec/rsa() accepts, less
+                // the algorithms disabled in BearSSLConfig.h
+    Minimal,    // ECDHE with AES128-GCM-SHA256 on P-256, TLS 1.2
+    ChaChaOnly  // ECDHE with ChaCha20-Poly1305 on P-256, TLS 1.2
+  };
+
+  // cipher suites and algorithms of the connections accepted from now
+  // on. The restricted profiles need a P-256 key (EC) and only reference
+  // the code they use; define BEAR_SSL_SERVER_DISABLE_FULL_PROFILE to
+  // drop the rest from the build.
+  int setProfile(Profile profile);
+
+private:
+  friend class BearSSLServerClient;
+
+  int init(br_ssl_server_context* sc);
+  void initProfile(br_ssl_server_context* sc);
+#if !BEARSSL_ENABLE_ALL
+  void initFeatures(br_ssl_server_context* sc);
+#endif
+
+  const br_x509_certificate* _chain;
+  size_t _chainLen;
+  const br_ec_private_key* _ecKey;
+  const br_rsa_private_key* _rsaKey;
+  unsigned _issuerKeyType;
+  Profile _profile;
+
+  secure_element_key _seKey;
+  br_ec_private_key _seEcKey;
+  secure_element_scert_context _sePolicy;
+
+  void freeCache();
+
+  unsigned char* _cacheStore;
+  size_t _cacheSize;
+  bool _ownCache;
+  br_ssl_session_cache_lru _cache;
+  session_cache_stats_context _cacheStats;
+  bool _psk;
+  br_ssl_session_parameters _pskSession;
+  session_cache_psk_context _pskCache;
+};
+
+// One TLS connection of a BearSSLServer over a transport connection
+// accepted by the sketch, e.g. from WiFiServer::available().
+class BearSSLServerClient : public Client {
+
+public:
+  BearSSLServerClient(BearSSLServer& server);
+  virtual ~BearSSLServerClient();
+
+  // runs the handshake on client, which must stay valid until stop();
+  // returns 1 once the connection is established, 0 on failure
+  int accept(Client& client);
+
+  // servers do not connect, these always fail
+  virtual int connect(IPAddress ip, uint16_t port);
+  virtual int connect(const char* host, uint16_t port);
+
+  virtual size_t write(uint8_t);
+  virtual size_t write(const uint8_t *buf, size_t size);
+
+  virtual int available();
+  virtual int read();
+  virtual int read(uint8_t *buf, size_t size);
+  virtual int peek();
+  virtual void flush();
+  virtual void stop();
+  virtual uint8_t connected();
+  virtual operator bool();
+
+  using Print::write;
+
+  // BEAR_SSL_SERVER_IBUF_SIZE and BEAR_SSL_SERVER_OBUF_SIZE bytes are
+  // allocated on the first accept() otherwise
+  void setBuffers(unsigned char* ibuf, size_t ibufSize, unsigned char* obuf, size_t obufSize);
+
+  // milliseconds accept() waits for the handshake to complete
+  void setHandshakeTimeout(unsigned long timeout);
+
+  // BR_ERR_* engine error or BEAR_SSL_CLIENT_ERR_* of the last failure
+  int errorCode();
+
+private:
+  static int clientRead(void *ctx, unsigned char *buf, size_t len);
+  static int clientWrite(void *ctx, const unsigned char *buf, size_t len);
+
+  BearSSLServer& _server;
+  Client* _client;
+
+  br_ssl_server_context _sc;
+  br_sslio_context _ioc;
+
+  unsigned char* _ibuf;
+  size_t _ibufSize;
+  unsigned char* _obuf;
+  size_t _obufSize;
+  bool _ownBuffers;
+
+  unsigned long _handshakeTimeout;
+  unsigned long _handshakeStart;
+  bool _handshaking;
+  int _error;
+};
+
+#endif
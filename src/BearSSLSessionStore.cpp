@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "BearSSLSessionStore.h"
+
+static void enc16(uint8_t* p, uint16_t value)
+{
+  p[0] = value >> 8;
+  p[1] = value;
+}
+
+static uint16_t dec16(const uint8_t* p)
+{
+  return ((uint16_t)p[0] << 8) | p[1];
+}
+
+static void enc32(uint8_t* p, uint32_t value)
+{
+  enc16(p, value >> 16);
+  enc16(p + 2, value);
+}
+
+static uint32_t dec32(const uint8_t* p)
+{
+  return ((uint32_t)dec16(p) << 16) | dec16(p + 2);
+}
+
+static uint32_t fnv1a(uint32_t hash, const uint8_t* data, size_t length)
+{
+  while (length--) {
+    hash ^= *data++;
+    hash *= 16777619UL;
+  }
+
+  return hash;
+}
+
+uint32_t BearSSLSessionStore::key(const char* host, uint16_t port)
+{
+  uint32_t hash = 2166136261UL;
+  uint8_t p[2] = { (uint8_t)(port >> 8), (uint8_t)port };
+
+  hash = fnv1a(hash, (const uint8_t*)host, strlen(host));
+  hash = fnv1a(hash, p, sizeof(p));
+
+  // 0 marks an empty record
+  return hash ? hash : 1;
+}
+
+void BearSSLSessionStore::serialize(uint32_t key, const br_ssl_session_parameters* session, uint8_t record[BEAR_SSL_SESSION_RECORD_SIZE])
+{
+  uint8_t* p = record;
+
+  enc32(p, key);
+  p += 4;
+  *p++ = session->session_id_len;
+  memcpy(p, session->session_id, 32);
+  p += 32;
+  enc16(p, session->version);
+  p += 2;
+  enc16(p, session->cipher_suite);
+  p += 2;
+  memcpy(p, session->master_secret, 48);
+  p += 48;
+  enc32(p, fnv1a(2166136261UL, record, p - record));
+}
+
+int BearSSLSessionStore::deserialize(const uint8_t record[BEAR_SSL_SESSION_RECORD_SIZE], uint32_t* key, br_ssl_session_parameters* session)
+{
+  const uint8_t* p = record;
+  size_t length = BEAR_SSL_SESSION_RECORD_SIZE - 4;
+
+  if (dec32(record + length) != fnv1a(2166136261UL, record, length)) {
+    return 0;
+  }
+
+  *key = dec32(p);
+  p += 4;
+  session->session_id_len = *p++;
+  memcpy(session->session_id, p, 32);
+  p += 32;
+  session->version = dec16(p);
+  p += 2;
+  session->cipher_suite = dec16(p);
+  p += 2;
+  memcpy(session->master_secret, p, 48);
+
+  if (*key == 0 || session->session_id_len == 0 || session->session_id_len > 32) {
+    return 0;
+  }
+
+  return 1;
+}
+
+void BearSSLSessionStore::pskSession(const char* identity, const uint8_t key[], size_t keyLength, br_ssl_session_parameters* session, uint16_t suite)
+{
+  br_sha256_context sha256;
+  br_tls_prf_seed_chunk seed = { identity, strlen(identity) };
+
+  br_sha256_init(&sha256);
+  br_sha256_update(&sha256, identity, seed.len);
+  br_sha256_out(&sha256, session->session_id);
+  session->session_id_len = sizeof(session->session_id);
+
+  // by default a suite every profile but ChaChaOnly accepts, on both ends
+  session->version = BR_TLS12;
+  session->cipher_suite = suite;
+
+  br_tls12_sha256_prf(session->master_secret, sizeof(session->master_secret), key, keyLength, "psk master secret", 1, &seed);
+}
+
+BearSSLMemorySessionStore::BearSSLMemorySessionStore(void* buffer, size_t size) :
+  _records((uint8_t*)buffer),
+  _count(size / BEAR_SSL_SESSION_RECORD_SIZE)
+{
+}
+
+BearSSLMemorySessionStore::~BearSSLMemorySessionStore()
+{
+}
+
+int BearSSLMemorySessionStore::load(uint32_t key, br_ssl_session_parameters* session)
+{
+  int index = find(key);
+
+  if (index < 0) {
+    return 0;
+  }
+
+  uint32_t recordKey;
+
+  return deserialize(&_records[index * BEAR_SSL_SESSION_RECORD_SIZE], &recordKey, session);
+}
+
+int BearSSLMemorySessionStore::save(uint32_t key, const br_ssl_session_parameters* session)
+{
+  if (_count == 0) {
+    return 0;
+  }
+
+  int index = find(key);
+
+  if (index < 0) {
+    // take the first free record, or evict the one the key maps to
+    index = key % _count;
+
+    for (int i = 0; i < _count; i++) {
+      uint32_t recordKey;
+      br_ssl_session_parameters unused;
+
+      if (!deserialize(&_records[i * BEAR_SSL_SESSION_RECORD_SIZE], &recordKey, &unused)) {
+        index = i;
+        break;
+      }
+    }
+  }
+
+  serialize(key, session, &_records[index * BEAR_SSL_SESSION_RECORD_SIZE]);
+
+  return 1;
+}
+
+void BearSSLMemorySessionStore::remove(uint32_t key)
+{
+  int index = find(key);
+
+  if (index >= 0) {
+    memset(&_records[index * BEAR_SSL_SESSION_RECORD_SIZE], 0x00, BEAR_SSL_SESSION_RECORD_SIZE);
+  }
+}
+
+int BearSSLMemorySessionStore::find(uint32_t key)
+{
+  for (int i = 0; i < _count; i++) {
+    uint32_t recordKey;
+    br_ssl_session_parameters session;
+
+    if (deserialize(&_records[i * BEAR_SSL_SESSION_RECORD_SIZE], &recordKey, &session) && recordKey == key) {
+      return i;
+    }
+  }
+
+  return -1;
+}
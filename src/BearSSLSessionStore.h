@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _BEAR_SSL_SESSION_STORE_H_
+#define _BEAR_SSL_SESSION_STORE_H_
+
+#include <Arduino.h>
+
+#include "bearssl/bearssl.h"
+
+// size of a serialized session record: key, session ID, version,
+// cipher suite, master secret and checksum
+#define BEAR_SSL_SESSION_RECORD_SIZE (4 + 1 + 32 + 2 + 2 + 48 + 4)
+
+class BearSSLSessionStore {
+
+public:
+  virtual ~BearSSLSessionStore() {}
+
+  // sessions are identified by a key derived from host and port, see key()
+  virtual int load(uint32_t key, br_ssl_session_parameters* session) = 0;
+  virtual int save(uint32_t key, const br_ssl_session_parameters* session) = 0;
+  virtual void remove(uint32_t key) = 0;
+
+  static uint32_t key(const char* host, uint16_t port);
+
+  // portable byte representation for EEPROM, flash or RTC RAM backends,
+  // deserialize() rejects records that were not written by serialize()
+  static void serialize(uint32_t key, const br_ssl_session_parameters* session, uint8_t record[BEAR_SSL_SESSION_RECORD_SIZE]);
+  static int deserialize(const uint8_t record[BEAR_SSL_SESSION_RECORD_SIZE], uint32_t* key, br_ssl_session_parameters* session);
+
+  // TLS 1.2 session both ends derive from a pre-shared identity and key,
+  // see BearSSLClient::setPSK() and BearSSLServer::setPSK(): the session
+  // ID is SHA-256(identity), the master secret PRF(key, identity). Both
+  // ends must use the same suite, which must be a TLS 1.2 SHA-256 one.
+  static void pskSession(const char* identity, const uint8_t key[], size_t keyLength, br_ssl_session_parameters* session,
+                         uint16_t suite = BR_TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256);
+};
+
+// Keeps session records in a caller-provided memory block, e.g. RTC RAM
+// that is retained during deep sleep.
+class BearSSLMemorySessionStore : public BearSSLSessionStore {
+
+public:
+  BearSSLMemorySessionStore(void* buffer, size_t size);
+  virtual ~BearSSLMemorySessionStore();
+
+  virtual int load(uint32_t key, br_ssl_session_parameters* session);
+  virtual int save(uint32_t key, const br_ssl_session_parameters* session);
+  virtual void remove(uint32_t key);
+
+private:
+  int find(uint32_t key);
+
+private:
+  uint8_t* _records;
+  int _count;
+};
+
+#endif
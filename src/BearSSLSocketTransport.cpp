@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "BearSSLSocketTransport.h"
+
+#ifdef BEAR_SSL_SOCKET_TRANSPORT
+
+#include <errno.h>
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include <lwip/sockets.h>
+
+#define socket_recv lwip_recv
+#define socket_send lwip_send
+#define socket_ioctl lwip_ioctl
+#define socket_select lwip_select
+#else
+#include <sys/ioctl.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+
+#define socket_recv ::recv
+#define socket_send ::send
+#define socket_ioctl ::ioctl
+#define socket_select ::select
+#endif
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+BearSSLSocketTransport::BearSSLSocketTransport(int (*socket)(void* context), void* context) :
+  _socket(socket),
+  _context(context),
+  _fd(-1)
+{
+}
+
+BearSSLSocketTransport::BearSSLSocketTransport(int fd) :
+  _socket(NULL),
+  _context(NULL),
+  _fd(fd)
+{
+}
+
+BearSSLSocketTransport::~BearSSLSocketTransport()
+{
+}
+
+int BearSSLSocketTransport::available()
+{
+  int fd = descriptor();
+  int count = 0;
+
+  if (fd < 0 || socket_ioctl(fd, FIONREAD, &count) < 0) {
+    return 0;
+  }
+
+  return count;
+}
+
+int BearSSLSocketTransport::read(uint8_t* buf, size_t size)
+{
+  int fd = descriptor();
+
+  if (fd < 0) {
+    return -1;
+  }
+
+  int result = socket_recv(fd, buf, size, MSG_DONTWAIT);
+
+  if (result > 0) {
+    return result;
+  }
+
+  // 0 is the peer's FIN
+  if (result < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+    return 0;
+  }
+
+  return -1;
+}
+
+int BearSSLSocketTransport::commit(const uint8_t* data, size_t length)
+{
+  int fd = descriptor();
+
+  if (fd < 0) {
+    return -1;
+  }
+
+  for (;;) {
+    int result = socket_send(fd, data, length, MSG_DONTWAIT | MSG_NOSIGNAL);
+
+    if (result >= 0) {
+      return result;
+    }
+
+    if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+      return -1;
+    }
+
+    // the send buffer is full, wait until the peer acknowledges some of it
+    fd_set set;
+    struct timeval timeout;
+
+    FD_ZERO(&set);
+    FD_SET(fd, &set);
+    timeout.tv_sec = BEAR_SSL_SOCKET_TIMEOUT / 1000;
+    timeout.tv_usec = (BEAR_SSL_SOCKET_TIMEOUT % 1000) * 1000;
+
+    result = socket_select(fd + 1, NULL, &set, NULL, &timeout);
+    if (result < 0 && errno != EINTR) {
+      return -1;
+    }
+    if (result == 0) {
+      // let BearSSLClient's I/O deadline decide
+      return 0;
+    }
+  }
+}
+
+int BearSSLSocketTransport::descriptor()
+{
+  return _socket ? _socket(_context) : _fd;
+}
+
+#endif
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _BEAR_SSL_SOCKET_TRANSPORT_H_
+#define _BEAR_SSL_SOCKET_TRANSPORT_H_
+
+#include "BearSSLConfig.h"
+#include "BearSSLTransport.h"
+
+// the lwIP socket API of the ESP32 core, BEAR_SSL_SOCKETS for other
+// boards (or host builds) with BSD sockets
+#if defined(ARDUINO_ARCH_ESP32) || defined(BEAR_SSL_SOCKETS)
+#define BEAR_SSL_SOCKET_TRANSPORT 1
+
+// how long commit() waits for room in the socket's send buffer
+#ifndef BEAR_SSL_SOCKET_TIMEOUT
+#define BEAR_SSL_SOCKET_TIMEOUT 5000
+#endif
+
+// Records go straight between the engine's buffers and the socket under
+// the Client, e.g. WiFiClient::fd() on ESP32: recv() copies the received
+// segments right into the engine's input buffer, without WiFiClient's own
+// receive buffer and connected() probe on every call. The socket is looked
+// up on each call through socket(context), so that it follows the
+// reconnections made by BearSSLClient, -1 while there is none.
+//
+//   int clientSocket(void*) { return wifiClient.fd(); }
+//   BearSSLSocketTransport transport(clientSocket, NULL);
+//   sslClient.setTransport(&transport);
+class BearSSLSocketTransport : public BearSSLTransport {
+
+public:
+  BearSSLSocketTransport(int (*socket)(void* context), void* context);
+  // a socket that does not change
+  BearSSLSocketTransport(int fd);
+  virtual ~BearSSLSocketTransport();
+
+  virtual int available();
+  virtual int read(uint8_t* buf, size_t size);
+  virtual int commit(const uint8_t* data, size_t length);
+
+private:
+  int descriptor();
+
+  int (*_socket)(void* context);
+  void* _context;
+  int _fd;
+};
+
+#endif
+
+#endif
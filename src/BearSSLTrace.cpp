@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "BearSSLTrace.h"
+
+static const char* const eventNames[] = {
+  "handshake", "state", "read", "write", "stall", "record in", "record out", "error"
+};
+
+BearSSLTrace::BearSSLTrace(BearSSLTraceEntry* entries, size_t size) :
+  _entries(entries),
+  _size(size)
+{
+  clear();
+}
+
+BearSSLTrace::~BearSSLTrace()
+{
+}
+
+void BearSSLTrace::clear()
+{
+  _next = 0;
+  _count = 0;
+  _dropped = 0;
+  start();
+}
+
+size_t BearSSLTrace::count()
+{
+  return _count;
+}
+
+unsigned long BearSSLTrace::dropped()
+{
+  return _dropped;
+}
+
+int BearSSLTrace::get(size_t index, BearSSLTraceEntry& entry)
+{
+  if (index >= _count) {
+    return 0;
+  }
+
+  entry = _entries[(_next + _size - _count + index) % _size];
+
+  return 1;
+}
+
+void BearSSLTrace::dump(Print& out)
+{
+  BearSSLTraceEntry first;
+
+  if (!get(0, first)) {
+    return;
+  }
+
+  if (_dropped) {
+    out.print(_dropped);
+    out.println(" entries dropped");
+  }
+
+  for (size_t i = 0; i < _count; i++) {
+    BearSSLTraceEntry entry;
+
+    get(i, entry);
+
+    out.print(entry.time - first.time);
+    out.print(" us ");
+    if (entry.event < sizeof(eventNames) / sizeof(eventNames[0])) {
+      out.print(eventNames[entry.event]);
+    } else {
+      out.print(entry.event);
+    }
+    out.print(' ');
+    out.print(entry.arg);
+    out.print(' ');
+    out.println(entry.value);
+  }
+}
+
+void BearSSLTrace::start()
+{
+  _state = 0;
+
+  for (int i = 0; i < 2; i++) {
+    _stalled[i] = false;
+    _headerLength[i] = 0;
+    _remaining[i] = 0;
+  }
+}
+
+void BearSSLTrace::add(uint8_t event, uint8_t arg, uint16_t value)
+{
+  if (_size == 0) {
+    return;
+  }
+
+  BearSSLTraceEntry& entry = _entries[_next];
+
+  entry.time = micros();
+  entry.event = event;
+  entry.arg = arg;
+  entry.value = value;
+
+  _next = (_next + 1) % _size;
+  if (_count < _size) {
+    _count++;
+  } else {
+    _dropped++;
+  }
+}
+
+void BearSSLTrace::state(unsigned state)
+{
+  if (state != _state) {
+    _state = state;
+    add(EngineState, state, 0);
+  }
+}
+
+void BearSSLTrace::transport(bool out, const uint8_t* data, int length)
+{
+  int direction = out ? 1 : 0;
+
+  if (length == 0) {
+    // only the first of a series of empty polls
+    if (!_stalled[direction]) {
+      _stalled[direction] = true;
+      add(Stall, direction, 0);
+    }
+    return;
+  }
+
+  _stalled[direction] = false;
+
+  if (length < 0) {
+    add(out ? Write : Read, 0, 0xffff);
+    return;
+  }
+
+  add(out ? Write : Read, 0, (length > 0xffff) ? 0xffff : length);
+  parse(direction, data, length);
+}
+
+void BearSSLTrace::parse(int direction, const uint8_t* data, size_t length)
+{
+  // follow the record boundaries of the stream, whatever the chunks
+  while (length) {
+    if (_remaining[direction]) {
+      size_t skip = (length < _remaining[direction]) ? length : _remaining[direction];
+
+      _remaining[direction] -= skip;
+      data += skip;
+      length -= skip;
+      continue;
+    }
+
+    uint8_t* header = _header[direction];
+
+    header[_headerLength[direction]++] = *data++;
+    length--;
+
+    if (_headerLength[direction] == sizeof(_header[direction])) {
+      uint16_t recordLength = (header[3] << 8) | header[4];
+
+      _headerLength[direction] = 0;
+      _remaining[direction] = recordLength;
+      add(direction ? RecordOut : RecordIn, header[0], recordLength);
+    }
+  }
+}
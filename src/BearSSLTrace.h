@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _BEAR_SSL_TRACE_H_
+#define _BEAR_SSL_TRACE_H_
+
+#include <Arduino.h>
+
+// one event of a BearSSLTrace, 8 bytes
+struct BearSSLTraceEntry {
+  uint32_t time;  // micros()
+  uint8_t event;  // BearSSLTrace::Event
+  uint8_t arg;    // record content type, engine state bits, ...
+  uint16_t value; // byte count, record length, error code, ...
+};
+
+// Fixed-size ring of binary events that BearSSLClient records while it
+// runs (see BearSSLClient::setTrace()): handshake and engine state
+// changes, transport reads and writes, the header of each record in both
+// directions and errors. Recording is a few stores per transport call,
+// so unlike DEBUGSERIAL in BearSSLClient.cpp it leaves the timing alone;
+// the oldest entries are overwritten, and the trace is read or dumped
+// after the fact.
+class BearSSLTrace {
+
+public:
+  enum Event {
+    Handshake,   // arg: BearSSLClient::HandshakeState
+    EngineState, // arg: BR_SSL_CLOSED, BR_SSL_SENDREC, ... bits
+    Read,        // value: bytes received from the transport
+    Write,       // value: bytes sent to the transport
+    Stall,       // arg: 0 read, 1 write, the first call that moved nothing
+    RecordIn,    // arg: content type, value: length of the record body
+    RecordOut,
+    Error        // value: BearSSLClient::errorCode()
+  };
+
+  BearSSLTrace(BearSSLTraceEntry* entries, size_t size);
+  virtual ~BearSSLTrace();
+
+  void clear();
+  // entries held, oldest first, and entries overwritten since clear()
+  size_t count();
+  unsigned long dropped();
+  int get(size_t index, BearSSLTraceEntry& entry);
+  // one line per entry, times relative to the oldest one
+  void dump(Print& out);
+
+  // recording, called by BearSSLClient
+  void start();
+  void add(uint8_t event, uint8_t arg, uint16_t value);
+  void state(unsigned state);
+  void transport(bool out, const uint8_t* data, int length);
+
+private:
+  void parse(int direction, const uint8_t* data, size_t length);
+
+  BearSSLTraceEntry* _entries;
+  size_t _size;
+  size_t _next;
+  size_t _count;
+  unsigned long _dropped;
+  unsigned _state;
+  bool _stalled[2];
+  uint8_t _header[2][5];
+  size_t _headerLength[2];
+  size_t _remaining[2];
+};
+
+#endif
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _BEAR_SSL_TRANSPORT_H_
+#define _BEAR_SSL_TRANSPORT_H_
+
+#include <Arduino.h>
+
+// Record I/O below BearSSLClient, see BearSSLClient::setTransport(). The
+// Client passed to BearSSLClient still opens, checks and closes the
+// connection; the transport only moves the TLS records, so that a network
+// driver can take them without going through Client::write() and its copy
+// into the driver's own buffer.
+//
+// BearSSL seals each record in place in its output buffer, which is set
+// once per connection. A driver that sends from its own memory (an SPI
+// command buffer, a DMA region, ...) lends that memory with
+// acquireTxBuffer(): the records are then encrypted right where the driver
+// picks them up, and commit() only has to send them.
+class BearSSLTransport {
+
+public:
+  virtual ~BearSSLTransport() {}
+
+  // bytes that can be read without waiting
+  virtual int available() = 0;
+  // into the engine's input buffer: the bytes read, 0 if none arrived
+  // yet, -1 once the connection is closed
+  virtual int read(uint8_t* buf, size_t size) = 0;
+
+  // the output buffer for the next connection, called before each
+  // handshake; it must stay valid until the connection is closed. NULL
+  // (the default), or less than 512 + BEAR_SSL_RECORD_OUT_OVERHEAD bytes,
+  // keeps the client's output buffer.
+  virtual uint8_t* acquireTxBuffer(size_t& size) {
+    size = 0;
+    return NULL;
+  }
+  // sends length bytes of data, which points into the acquireTxBuffer()
+  // buffer when there is one: the bytes taken, 0 to be called again later,
+  // -1 on error. The engine reuses them as soon as commit() returns.
+  virtual int commit(const uint8_t* data, size_t length) = 0;
+};
+
+#endif
@@ -0,0 +1,635 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "BearSSLTrustStore.h"
+
+#define HEADER_SIZE 6
+#define INDEX_ENTRY_SIZE 12
+
+static void enc16(uint8_t* p, uint16_t value)
+{
+  p[0] = value >> 8;
+  p[1] = value;
+}
+
+static uint16_t dec16(const uint8_t* p)
+{
+  return ((uint16_t)p[0] << 8) | p[1];
+}
+
+static void enc32(uint8_t* p, uint32_t value)
+{
+  enc16(p, value >> 16);
+  enc16(p + 2, value);
+}
+
+static uint32_t dec32(const uint8_t* p)
+{
+  return ((uint32_t)dec16(p) << 16) | dec16(p + 2);
+}
+
+static size_t recordSize(const br_x509_trust_anchor* ta)
+{
+  size_t size = 2 + 1 + 1 + 2 + ta->dn.len;
+
+  if (ta->pkey.key_type == BR_KEYTYPE_RSA) {
+    size += 2 + ta->pkey.key.rsa.nlen + 2 + ta->pkey.key.rsa.elen;
+  } else {
+    size += 1 + 1 + ta->pkey.key.ec.qlen;
+  }
+
+  return size;
+}
+
+// the DN may already be in place when the record is built in the
+// buffer it was collected into, see encode()
+static void writeRecord(const br_x509_trust_anchor* ta, uint8_t* p)
+{
+  enc16(p, recordSize(ta));
+  p += 2;
+  *p++ = ta->flags;
+  *p++ = ta->pkey.key_type;
+  enc16(p, ta->dn.len);
+  p += 2;
+  memmove(p, ta->dn.data, ta->dn.len);
+  p += ta->dn.len;
+
+  if (ta->pkey.key_type == BR_KEYTYPE_RSA) {
+    enc16(p, ta->pkey.key.rsa.nlen);
+    memcpy(p + 2, ta->pkey.key.rsa.n, ta->pkey.key.rsa.nlen);
+    p += 2 + ta->pkey.key.rsa.nlen;
+    enc16(p, ta->pkey.key.rsa.elen);
+    memcpy(p + 2, ta->pkey.key.rsa.e, ta->pkey.key.rsa.elen);
+    p += 2 + ta->pkey.key.rsa.elen;
+  } else {
+    *p++ = ta->pkey.key.ec.curve;
+    *p++ = ta->pkey.key.ec.qlen;
+    memcpy(p, ta->pkey.key.ec.q, ta->pkey.key.ec.qlen);
+    p += ta->pkey.key.ec.qlen;
+  }
+}
+
+static void indexEntry(const br_x509_trust_anchor* ta, uint32_t offset, uint8_t entry[INDEX_ENTRY_SIZE])
+{
+  br_sha256_context ctx;
+  uint8_t hash[br_sha256_SIZE];
+
+  br_sha256_init(&ctx);
+  br_sha256_update(&ctx, ta->dn.data, ta->dn.len);
+  br_sha256_out(&ctx, hash);
+
+  memcpy(entry, hash, 8);
+  enc32(entry + 8, offset);
+}
+
+struct DnBuffer {
+  uint8_t* data;
+  size_t length;
+  size_t size;
+  int overflow;
+};
+
+static void appendDn(void* ctx, const void* buf, size_t len)
+{
+  DnBuffer* dn = (DnBuffer*)ctx;
+
+  if (len > dn->size - dn->length) {
+    dn->overflow = 1;
+    return;
+  }
+
+  memcpy(dn->data + dn->length, buf, len);
+  dn->length += len;
+}
+
+BearSSLTrustStore::BearSSLTrustStore() :
+  _count(-1),
+  _loaded(0)
+{
+}
+
+BearSSLTrustStore::~BearSSLTrustStore()
+{
+}
+
+int BearSSLTrustStore::write(uint32_t /*offset*/, const void* /*buffer*/, size_t /*length*/)
+{
+  return 0;
+}
+
+int BearSSLTrustStore::count()
+{
+  if (_count < 0) {
+    _count = readCount();
+
+    if (_count < 0) {
+      _count = 0;
+    }
+  }
+
+  return _count;
+}
+
+int BearSSLTrustStore::readCount()
+{
+  uint8_t header[HEADER_SIZE];
+
+  if (!read(0, header, sizeof(header)) || memcmp(header, "BTA1", 4) != 0) {
+    return -1;
+  }
+
+  return dec16(header + 4);
+}
+
+int BearSSLTrustStore::readIndex(int i, uint8_t entry[INDEX_ENTRY_SIZE])
+{
+  return read(HEADER_SIZE + (uint32_t)i * INDEX_ENTRY_SIZE, entry, INDEX_ENTRY_SIZE);
+}
+
+int BearSSLTrustStore::writeIndex(int i, const uint8_t entry[INDEX_ENTRY_SIZE])
+{
+  return write(HEADER_SIZE + (uint32_t)i * INDEX_ENTRY_SIZE, entry, INDEX_ENTRY_SIZE);
+}
+
+// first index entry not below dnHash, -1 on read errors
+int BearSSLTrustStore::lowerBound(const unsigned char* dnHash)
+{
+  uint8_t entry[INDEX_ENTRY_SIZE];
+  int lo = 0;
+  int hi = count();
+
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+
+    if (!readIndex(mid, entry)) {
+      return -1;
+    }
+
+    if (memcmp(entry, dnHash, 8) < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  return lo;
+}
+
+const br_x509_trust_anchor* BearSSLTrustStore::find(const unsigned char* dnHash, size_t n)
+{
+  uint8_t entry[INDEX_ENTRY_SIZE];
+  int lo = lowerBound(dnHash);
+
+  if (lo < 0 || (size_t)lo + n >= (size_t)_count || !readIndex(lo + n, entry) || memcmp(entry, dnHash, 8) != 0) {
+    return NULL;
+  }
+
+  return decode(dec32(entry + 8));
+}
+
+const br_x509_trust_anchor* BearSSLTrustStore::decode(uint32_t offset)
+{
+  if (offset == _loaded) {
+    return &_ta;
+  }
+
+  _loaded = 0;
+
+  uint8_t* p = _buffer;
+  size_t length;
+
+  if (!read(offset, p, 2)) {
+    return NULL;
+  }
+
+  length = dec16(p);
+
+  if (length < 6 || length > sizeof(_buffer) || !read(offset, p, length)) {
+    return NULL;
+  }
+
+  const uint8_t* end = p + length;
+
+  p += 2;
+  _ta.flags = *p++;
+  _ta.pkey.key_type = *p++;
+  _ta.dn.len = dec16(p);
+  p += 2;
+  _ta.dn.data = p;
+  p += _ta.dn.len;
+
+  if (_ta.pkey.key_type == BR_KEYTYPE_RSA) {
+    if (p + 2 > end) {
+      return NULL;
+    }
+    _ta.pkey.key.rsa.nlen = dec16(p);
+    _ta.pkey.key.rsa.n = p + 2;
+    p += 2 + _ta.pkey.key.rsa.nlen;
+
+    if (p + 2 > end) {
+      return NULL;
+    }
+    _ta.pkey.key.rsa.elen = dec16(p);
+    _ta.pkey.key.rsa.e = p + 2;
+    p += 2 + _ta.pkey.key.rsa.elen;
+  } else if (_ta.pkey.key_type == BR_KEYTYPE_EC) {
+    if (p + 2 > end) {
+      return NULL;
+    }
+    _ta.pkey.key.ec.curve = p[0];
+    _ta.pkey.key.ec.qlen = p[1];
+    _ta.pkey.key.ec.q = p + 2;
+    p += 2 + _ta.pkey.key.ec.qlen;
+  } else {
+    return NULL;
+  }
+
+  if (p != end) {
+    return NULL;
+  }
+
+  _loaded = offset;
+
+  return &_ta;
+}
+
+const br_x509_trust_anchor* BearSSLTrustStore::load(void* ctx, const unsigned char* dnHash, size_t n)
+{
+  return ((BearSSLTrustStore*)ctx)->find(dnHash, n);
+}
+
+size_t BearSSLTrustStore::serialize(const br_x509_trust_anchor* tas, int count, uint8_t* image, size_t size)
+{
+  size_t total = HEADER_SIZE + (size_t)count * INDEX_ENTRY_SIZE;
+
+  for (int i = 0; i < count; i++) {
+    total += recordSize(&tas[i]);
+  }
+
+  if (image == NULL) {
+    return total;
+  }
+
+  if (size < total || count > 0xffff) {
+    return 0;
+  }
+
+  memcpy(image, "BTA1", 4);
+  enc16(image + 4, count);
+
+  uint8_t* index = image + HEADER_SIZE;
+  uint32_t offset = HEADER_SIZE + (uint32_t)count * INDEX_ENTRY_SIZE;
+
+  for (int i = 0; i < count; i++) {
+    const br_x509_trust_anchor* ta = &tas[i];
+    uint8_t entry[INDEX_ENTRY_SIZE];
+
+    writeRecord(ta, image + offset);
+    indexEntry(ta, offset, entry);
+
+    // insertion sort of the index by DN hash
+    int j = i;
+
+    while (j > 0 && memcmp(index + (j - 1) * INDEX_ENTRY_SIZE, entry, 8) > 0) {
+      memcpy(index + j * INDEX_ENTRY_SIZE, index + (j - 1) * INDEX_ENTRY_SIZE, INDEX_ENTRY_SIZE);
+      j--;
+    }
+
+    memcpy(index + j * INDEX_ENTRY_SIZE, entry, INDEX_ENTRY_SIZE);
+
+    offset += recordSize(ta);
+  }
+
+  return total;
+}
+
+int BearSSLTrustStore::clear()
+{
+  uint8_t header[HEADER_SIZE];
+
+  memcpy(header, "BTA1", 4);
+  enc16(header + 4, 0);
+
+  if (!write(0, header, sizeof(header))) {
+    return 0;
+  }
+
+  _count = 0;
+  _loaded = 0;
+
+  return 1;
+}
+
+int BearSSLTrustStore::add(const uint8_t* der, size_t length)
+{
+  uint8_t entry[INDEX_ENTRY_SIZE];
+  size_t size = encode(der, length, entry);
+  int n = readCount();
+
+  if (size == 0 || n < 0 || n >= 0xffff) {
+    return 0;
+  }
+
+  _count = n;
+
+  if (findRecord(entry, size) >= 0) {
+    return 1;
+  }
+
+  // the index grows by one entry, records starting below its new end
+  // are moved behind the last record first
+  uint32_t indexEnd = HEADER_SIZE + (uint32_t)(n + 1) * INDEX_ENTRY_SIZE;
+  uint32_t end;
+
+  for (;;) {
+    int first;
+    uint32_t firstOffset;
+    uint8_t moved[INDEX_ENTRY_SIZE];
+    uint8_t header[2];
+
+    end = indexEnd;
+
+    if (!scan(&first, &firstOffset, &end)) {
+      return 0;
+    }
+
+    if (first < 0 || firstOffset >= indexEnd) {
+      break;
+    }
+
+    if (!read(firstOffset, header, sizeof(header)) || !move(firstOffset, end, dec16(header))) {
+      return 0;
+    }
+
+    if (!readIndex(first, moved)) {
+      return 0;
+    }
+
+    enc32(moved + 8, end);
+
+    if (!writeIndex(first, moved)) {
+      return 0;
+    }
+  }
+
+  if (!write(end, _buffer, size)) {
+    return 0;
+  }
+
+  enc32(entry + 8, end);
+
+  // shift the entries above the new one, the index stays sorted and
+  // the count is only written once it is complete
+  int pos = lowerBound(entry);
+
+  if (pos < 0) {
+    return 0;
+  }
+
+  for (int i = n; i > pos; i--) {
+    uint8_t shifted[INDEX_ENTRY_SIZE];
+
+    if (!readIndex(i - 1, shifted) || !writeIndex(i, shifted)) {
+      return 0;
+    }
+  }
+
+  if (!writeIndex(pos, entry)) {
+    return 0;
+  }
+
+  return update(n + 1);
+}
+
+int BearSSLTrustStore::remove(const uint8_t* der, size_t length)
+{
+  uint8_t entry[INDEX_ENTRY_SIZE];
+  size_t size = encode(der, length, entry);
+  int n = readCount();
+
+  if (size == 0 || n < 0) {
+    return 0;
+  }
+
+  _count = n;
+
+  int i = findRecord(entry, size);
+
+  if (i < 0) {
+    return 0;
+  }
+
+  for (; i < n - 1; i++) {
+    uint8_t shifted[INDEX_ENTRY_SIZE];
+
+    if (!readIndex(i + 1, shifted) || !writeIndex(i, shifted)) {
+      return 0;
+    }
+  }
+
+  return update(n - 1);
+}
+
+// build the record for a certificate in the internal buffer, returns
+// its size or 0 if it cannot be decoded or does not fit
+size_t BearSSLTrustStore::encode(const uint8_t* der, size_t length, uint8_t entry[INDEX_ENTRY_SIZE])
+{
+  br_x509_decoder_context dc;
+  br_x509_trust_anchor ta;
+  DnBuffer dn = { _buffer + 6, 0, sizeof(_buffer) - 6, 0 };
+
+  _loaded = 0;
+
+  br_x509_decoder_init(&dc, appendDn, &dn);
+  br_x509_decoder_push(&dc, der, length);
+
+  const br_x509_pkey* pkey = br_x509_decoder_get_pkey(&dc);
+
+  if (pkey == NULL || dn.overflow) {
+    return 0;
+  }
+
+  ta.dn.data = dn.data;
+  ta.dn.len = dn.length;
+  ta.flags = br_x509_decoder_isCA(&dc) ? BR_X509_TA_CA : 0;
+  ta.pkey = *pkey;
+
+  size_t size = recordSize(&ta);
+
+  if (size > sizeof(_buffer) || size > 0xffff) {
+    return 0;
+  }
+
+  indexEntry(&ta, 0, entry);
+  writeRecord(&ta, _buffer);
+
+  return size;
+}
+
+// index of the anchor whose record equals the one in the internal
+// buffer, -1 if there is none
+int BearSSLTrustStore::findRecord(const uint8_t entry[INDEX_ENTRY_SIZE], size_t length)
+{
+  uint8_t other[INDEX_ENTRY_SIZE];
+
+  for (int i = lowerBound(entry); i >= 0 && i < _count; i++) {
+    if (!readIndex(i, other) || memcmp(other, entry, 8) != 0) {
+      break;
+    }
+
+    if (matches(dec32(other + 8), length)) {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+// the flags are not compared, an anchor is the same for a DN and key
+int BearSSLTrustStore::matches(uint32_t offset, size_t length)
+{
+  uint8_t chunk[32];
+
+  for (size_t i = 0; i < length; i += sizeof(chunk)) {
+    size_t n = length - i < sizeof(chunk) ? length - i : sizeof(chunk);
+
+    if (!read(offset + i, chunk, n)) {
+      return 0;
+    }
+
+    if (i == 0) {
+      chunk[2] = _buffer[2];
+    }
+
+    if (memcmp(chunk, _buffer + i, n) != 0) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+// index and offset of the lowest record, and the end of the highest
+int BearSSLTrustStore::scan(int* first, uint32_t* firstOffset, uint32_t* end)
+{
+  *first = -1;
+
+  for (int i = 0; i < _count; i++) {
+    uint8_t entry[INDEX_ENTRY_SIZE];
+    uint8_t header[2];
+
+    if (!readIndex(i, entry)) {
+      return 0;
+    }
+
+    uint32_t offset = dec32(entry + 8);
+
+    if (!read(offset, header, sizeof(header))) {
+      return 0;
+    }
+
+    if (*first < 0 || offset < *firstOffset) {
+      *first = i;
+      *firstOffset = offset;
+    }
+
+    if (offset + dec16(header) > *end) {
+      *end = offset + dec16(header);
+    }
+  }
+
+  return 1;
+}
+
+int BearSSLTrustStore::move(uint32_t from, uint32_t to, size_t length)
+{
+  uint8_t chunk[32];
+
+  for (size_t i = 0; i < length; i += sizeof(chunk)) {
+    size_t n = length - i < sizeof(chunk) ? length - i : sizeof(chunk);
+
+    if (!read(from + i, chunk, n) || !write(to + i, chunk, n)) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+int BearSSLTrustStore::update(int count)
+{
+  uint8_t value[2];
+
+  enc16(value, count);
+
+  if (!write(4, value, sizeof(value))) {
+    return 0;
+  }
+
+  _count = count;
+  _loaded = 0;
+
+  return 1;
+}
+
+BearSSLMemoryTrustStore::BearSSLMemoryTrustStore(const void* image, size_t size) :
+  _image((const uint8_t*)image),
+  _writable(NULL),
+  _size(size)
+{
+}
+
+BearSSLMemoryTrustStore::BearSSLMemoryTrustStore(void* image, size_t size) :
+  _image((const uint8_t*)image),
+  _writable((uint8_t*)image),
+  _size(size)
+{
+}
+
+BearSSLMemoryTrustStore::~BearSSLMemoryTrustStore()
+{
+}
+
+int BearSSLMemoryTrustStore::read(uint32_t offset, void* buffer, size_t length)
+{
+  if (offset > _size || length > _size - offset) {
+    return 0;
+  }
+
+  memcpy(buffer, _image + offset, length);
+
+  return 1;
+}
+
+int BearSSLMemoryTrustStore::write(uint32_t offset, const void* buffer, size_t length)
+{
+  if (_writable == NULL || offset > _size || length > _size - offset) {
+    return 0;
+  }
+
+  memcpy(_writable + offset, buffer, length);
+
+  return 1;
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef _BEAR_SSL_TRUST_STORE_H_
+#define _BEAR_SSL_TRUST_STORE_H_
+
+#ifndef BEAR_SSL_TRUST_STORE_BUFFER_SIZE
+#define BEAR_SSL_TRUST_STORE_BUFFER_SIZE 1024
+#endif
+
+#include <Arduino.h>
+
+#include "bearssl/bearssl.h"
+
+// Trust anchors kept outside of program flash, e.g. in SPI flash or in a
+// file on an SD card, and decoded one at a time when the X.509 engine
+// looks for an issuer. The image starts with "BTA1" and the number of
+// anchors, followed by an index of (DN hash, offset) pairs sorted by
+// hash and one record per anchor, see serialize(). Subclasses implement
+// read() for their storage, and write() if the image can be updated in
+// place with add() and remove().
+class BearSSLTrustStore {
+
+public:
+  BearSSLTrustStore();
+  virtual ~BearSSLTrustStore();
+
+  // copy length bytes at offset of the image into buffer, 1 on success
+  virtual int read(uint32_t offset, void* buffer, size_t length) = 0;
+
+  // copy length bytes of buffer to offset of the image, 1 on success,
+  // stores are read-only unless this is overridden
+  virtual int write(uint32_t offset, const void* buffer, size_t length);
+
+  // number of anchors in the image, 0 if it is not valid
+  int count();
+
+  // n-th anchor whose DN hash starts like dnHash (SHA-256), decoded
+  // into an internal buffer that is reused by the next call
+  const br_x509_trust_anchor* find(const unsigned char* dnHash, size_t n);
+
+  // br_x509_ta_loader, ctx is the BearSSLTrustStore
+  static const br_x509_trust_anchor* load(void* ctx, const unsigned char* dnHash, size_t n);
+
+  // write an image without anchors, e.g. to blank storage
+  int clear();
+
+  // add or remove the anchor for a DER encoded certificate, so that CA
+  // rotations can be applied as deltas; records are appended and the
+  // index is updated in place, space of removed anchors is only reused
+  // when it is at the end of the image (serialize() compacts)
+  int add(const uint8_t* der, size_t length);
+  int remove(const uint8_t* der, size_t length);
+
+  // write the image for the given anchors, returns its size (image may
+  // be NULL to only compute it) or 0 if size is too small
+  static size_t serialize(const br_x509_trust_anchor* tas, int count, uint8_t* image, size_t size);
+
+private:
+  int readCount();
+  int readIndex(int i, uint8_t entry[12]);
+  int writeIndex(int i, const uint8_t entry[12]);
+  int lowerBound(const unsigned char* dnHash);
+  const br_x509_trust_anchor* decode(uint32_t offset);
+
+  size_t encode(const uint8_t* der, size_t length, uint8_t entry[12]);
+  int findRecord(const uint8_t entry[12], size_t length);
+  int matches(uint32_t offset, size_t length);
+  int scan(int* first, uint32_t* firstOffset, uint32_t* end);
+  int move(uint32_t from, uint32_t to, size_t length);
+  int update(int count);
+
+private:
+  int _count;
+  uint32_t _loaded;
+  br_x509_trust_anchor _ta;
+  uint8_t _buffer[BEAR_SSL_TRUST_STORE_BUFFER_SIZE];
+};
+
+// An image in memory mapped storage, e.g. QSPI flash.
+class BearSSLMemoryTrustStore : public BearSSLTrustStore {
+
+public:
+  BearSSLMemoryTrustStore(const void* image, size_t size);
+  // a writable image can be updated with add() and remove()
+  BearSSLMemoryTrustStore(void* image, size_t size);
+  virtual ~BearSSLMemoryTrustStore();
+
+  virtual int read(uint32_t offset, void* buffer, size_t length);
+  virtual int write(uint32_t offset, const void* buffer, size_t length);
+
+private:
+  const uint8_t* _image;
+  uint8_t* _writable;
+  size_t _size;
+};
+
+#endif
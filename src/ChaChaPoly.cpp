@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ChaChaPoly.h"
+
+// one-shot Poly1305 per core, the 32x32->64 multiplications of ctmul
+// are slow on Cortex-M0/M0+ and not constant-time on the Cortex-M3
+#if defined(__ARM_ARCH_6M__) || defined(__ARM_ARCH_7M__) || defined(ARDUINO_ARCH_AVR)
+#define CHACHAPOLY_POLY1305 br_poly1305_ctmul32_run
+#else
+#define CHACHAPOLY_POLY1305 br_poly1305_ctmul_run
+#endif
+
+enum {
+  MODE_NONE,
+  MODE_ENCRYPT,
+  MODE_DECRYPT
+};
+
+ChaChaPolyClass::ChaChaPolyClass() :
+  chacha_impl(&br_chacha20_ct_run),
+  _streamOffset(CHACHAPOLY_BLOCK_SIZE),
+  _counter(1),
+  keyed(0),
+  mode(MODE_NONE)
+{
+  if (br_chacha20_cortexm_get() != 0) {
+    chacha_impl = br_chacha20_cortexm_get();
+  } else if (br_chacha20_sse2_get() != 0) {
+    chacha_impl = br_chacha20_sse2_get();
+  }
+}
+
+ChaChaPolyClass::~ChaChaPolyClass()
+{
+}
+
+void ChaChaPolyClass::setImplementation(br_chacha20_run impl)
+{
+  chacha_impl = impl;
+  mode = MODE_NONE;
+}
+
+int ChaChaPolyClass::setKey(const uint8_t *key, size_t size)
+{
+  keyed = 0;
+  mode = MODE_NONE;
+
+  if (size != CHACHAPOLY_KEY_SIZE) {
+    return 0;
+  }
+
+  memcpy(_key, key, CHACHAPOLY_KEY_SIZE);
+  keyed = 1;
+
+  return 1;
+}
+
+int ChaChaPolyClass::encrypt(const uint8_t *nonce, const uint8_t *aad, size_t aadLength, uint8_t *input, size_t length, uint8_t *tag)
+{
+  mode = MODE_NONE;
+
+  if (!keyed) {
+    return 0;
+  }
+
+  CHACHAPOLY_POLY1305(_key, nonce, input, length, aad, aadLength, tag, chacha_impl, 1);
+
+  return 1;
+}
+
+int ChaChaPolyClass::decrypt(const uint8_t *nonce, const uint8_t *aad, size_t aadLength, uint8_t *input, size_t length, const uint8_t *tag)
+{
+  uint8_t computed[CHACHAPOLY_TAG_SIZE];
+
+  mode = MODE_NONE;
+
+  if (!keyed) {
+    return 0;
+  }
+
+  CHACHAPOLY_POLY1305(_key, nonce, input, length, aad, aadLength, computed, chacha_impl, 0);
+
+  if (!equals(computed, tag)) {
+    memset(input, 0x00, length);
+    return 0;
+  }
+
+  return 1;
+}
+
+int ChaChaPolyClass::encrypt(AEADPacket *packets, size_t count)
+{
+  mode = MODE_NONE;
+
+  if (!keyed) {
+    return 0;
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    AEADPacket *p = &packets[i];
+
+    CHACHAPOLY_POLY1305(_key, p->nonce, p->data, p->length, p->aad, p->aadLength, p->tag, chacha_impl, 1);
+    p->valid = 1;
+  }
+
+  return count;
+}
+
+int ChaChaPolyClass::decrypt(AEADPacket *packets, size_t count)
+{
+  uint8_t computed[CHACHAPOLY_TAG_SIZE];
+  int validCount = 0;
+
+  mode = MODE_NONE;
+
+  if (!keyed) {
+    return 0;
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    AEADPacket *p = &packets[i];
+
+    CHACHAPOLY_POLY1305(_key, p->nonce, p->data, p->length, p->aad, p->aadLength, computed, chacha_impl, 0);
+    p->valid = equals(computed, p->tag);
+
+    if (!p->valid) {
+      memset(p->data, 0x00, p->length);
+      continue;
+    }
+
+    validCount++;
+  }
+
+  return validCount;
+}
+
+int ChaChaPolyClass::beginEncrypt(const uint8_t *nonce, const uint8_t *aad, size_t aadLength)
+{
+  return begin(MODE_ENCRYPT, nonce, aad, aadLength);
+}
+
+int ChaChaPolyClass::beginDecrypt(const uint8_t *nonce, const uint8_t *aad, size_t aadLength)
+{
+  return begin(MODE_DECRYPT, nonce, aad, aadLength);
+}
+
+int ChaChaPolyClass::update(uint8_t *input, size_t length)
+{
+  if (mode == MODE_NONE) {
+    return 0;
+  }
+
+  // the MAC covers the ciphertext
+  if (mode == MODE_DECRYPT) {
+    br_poly1305_ctmul32_update(&poly_ctx, input, length);
+  }
+
+  run(input, length);
+
+  if (mode == MODE_ENCRYPT) {
+    br_poly1305_ctmul32_update(&poly_ctx, input, length);
+  }
+
+  return 1;
+}
+
+int ChaChaPolyClass::end(uint8_t *tag)
+{
+  uint8_t computed[CHACHAPOLY_TAG_SIZE];
+  int currentMode = mode;
+
+  if (currentMode == MODE_NONE) {
+    return 0;
+  }
+
+  br_poly1305_ctmul32_get_tag(&poly_ctx, computed);
+  mode = MODE_NONE;
+  memset(_stream, 0x00, sizeof(_stream));
+
+  if (currentMode == MODE_ENCRYPT) {
+    memcpy(tag, computed, CHACHAPOLY_TAG_SIZE);
+    return 1;
+  }
+
+  return equals(computed, tag);
+}
+
+int ChaChaPolyClass::begin(int mode, const uint8_t *nonce, const uint8_t *aad, size_t aadLength)
+{
+  this->mode = MODE_NONE;
+
+  if (!keyed) {
+    return 0;
+  }
+
+  memcpy(_nonce, nonce, CHACHAPOLY_NONCE_SIZE);
+  _counter = 1;
+  _streamOffset = CHACHAPOLY_BLOCK_SIZE;
+
+  br_poly1305_ctmul32_init(&poly_ctx, _key, _nonce, chacha_impl);
+  br_poly1305_ctmul32_aad_inject(&poly_ctx, aad, aadLength);
+  br_poly1305_ctmul32_flip(&poly_ctx);
+
+  this->mode = mode;
+
+  return 1;
+}
+
+void ChaChaPolyClass::run(uint8_t *input, size_t length)
+{
+  // leftover keystream of the previous call first
+  while (length > 0 && _streamOffset < CHACHAPOLY_BLOCK_SIZE) {
+    *input++ ^= _stream[_streamOffset++];
+    length--;
+  }
+
+  // whole blocks directly on the data
+  size_t blocks = length & ~(size_t)(CHACHAPOLY_BLOCK_SIZE - 1);
+
+  if (blocks > 0) {
+    _counter = chacha_impl(_key, _nonce, _counter, input, blocks);
+    input += blocks;
+    length -= blocks;
+  }
+
+  // keep the rest of a partial block for the next call
+  if (length > 0) {
+    memset(_stream, 0x00, sizeof(_stream));
+    _counter = chacha_impl(_key, _nonce, _counter, _stream, sizeof(_stream));
+    _streamOffset = 0;
+
+    while (length > 0) {
+      *input++ ^= _stream[_streamOffset++];
+      length--;
+    }
+  }
+}
+
+int ChaChaPolyClass::equals(const uint8_t *a, const uint8_t *b)
+{
+  // constant-time comparison
+  uint8_t diff = 0;
+
+  for (int i = 0; i < CHACHAPOLY_TAG_SIZE; i++) {
+    diff |= a[i] ^ b[i];
+  }
+
+  return (diff == 0);
+}
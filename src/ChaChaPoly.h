@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CHACHAPOLY_H
+#define CHACHAPOLY_H
+
+#include <Arduino.h>
+
+#include <bearssl/bearssl_block.h>
+
+#include "BearSSLConfig.h"
+#include "AEADPacket.h"
+
+#define CHACHAPOLY_KEY_SIZE 32
+#define CHACHAPOLY_NONCE_SIZE 12
+#define CHACHAPOLY_TAG_SIZE 16
+#define CHACHAPOLY_BLOCK_SIZE 64
+
+// ChaCha20-Poly1305 AEAD (RFC 8439)
+class ChaChaPolyClass {
+
+public:
+  ChaChaPolyClass();
+  virtual ~ChaChaPolyClass();
+
+  // key is 32 bytes and is reused by every call
+  int setKey(const uint8_t *key, size_t size = CHACHAPOLY_KEY_SIZE);
+
+  // ChaCha20 implementation, e.g. &br_chacha20_ct_run
+  void setImplementation(br_chacha20_run impl);
+
+  // authenticated encryption in place, nonce is 12 bytes and must never
+  // repeat for a key, tag gets 16 bytes
+  int encrypt(const uint8_t *nonce, const uint8_t *aad, size_t aadLength, uint8_t *input, size_t length, uint8_t *tag);
+
+  // 1 if the tag matches, otherwise input is cleared and 0 returned
+  int decrypt(const uint8_t *nonce, const uint8_t *aad, size_t aadLength, uint8_t *input, size_t length, const uint8_t *tag);
+
+  // batches of packets, both return the number of valid packets,
+  // decrypt() clears the data of packets whose tag does not match
+  int encrypt(AEADPacket *packets, size_t count);
+  int decrypt(AEADPacket *packets, size_t count);
+
+  // streaming: begin, update() in place with chunks of any length, then
+  // end(), which stores the tag when encrypting or checks it when
+  // decrypting; decrypted chunks must not be trusted until end() returns 1
+  int beginEncrypt(const uint8_t *nonce, const uint8_t *aad, size_t aadLength);
+  int beginDecrypt(const uint8_t *nonce, const uint8_t *aad, size_t aadLength);
+  int update(uint8_t *input, size_t length);
+  int end(uint8_t *tag);
+
+private:
+  int begin(int mode, const uint8_t *nonce, const uint8_t *aad, size_t aadLength);
+  void run(uint8_t *input, size_t length);
+  static int equals(const uint8_t *a, const uint8_t *b);
+
+private:
+  br_chacha20_run chacha_impl;
+  br_poly1305_ctmul32_context poly_ctx;
+  uint8_t _key[CHACHAPOLY_KEY_SIZE];
+  uint8_t _nonce[CHACHAPOLY_NONCE_SIZE];
+  uint8_t _stream[CHACHAPOLY_BLOCK_SIZE];
+  size_t _streamOffset;
+  uint32_t _counter;
+  int keyed;
+  int mode;
+};
+
+#if BEARSSL_ENABLE_CHACHA
+extern ChaChaPolyClass ChaChaPoly;
+#endif
+
+#endif
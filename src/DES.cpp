@@ -25,7 +25,10 @@
 #include "DES.h"
 
 DESClass::DESClass() :
-  EncryptionClass(DES_BLOCK_SIZE, DES_DIGEST_SIZE)
+  EncryptionClass(DES_BLOCK_SIZE, DES_DIGEST_SIZE),
+  cbcenc_impl(&br_des_ct_cbcenc_vtable),
+  cbcdec_impl(&br_des_ct_cbcdec_vtable),
+  keyed(0)
 {
 }
 
@@ -33,23 +36,64 @@ DESClass::~DESClass()
 {
 }
 
-int DESClass::runEncryption(uint8_t *key, size_t size, uint8_t *input, size_t block_size, uint8_t *iv)
+void DESClass::setImplementation(const br_block_cbcenc_class *enc, const br_block_cbcdec_class *dec)
+{
+  cbcenc_impl = enc;
+  cbcdec_impl = dec;
+  keyed = 0;
+}
+
+int DESClass::setKey(const uint8_t *key, size_t size)
 {
-  br_des_ct_cbcenc_init(&cbcenc_ctx, key, size);
-  br_des_ct_cbcenc_run(&cbcenc_ctx, iv, input, block_size); // block_size must be multiple of 8
+  keyed = 0;
+
+  if (size != 8 && size != 16 && size != 24) {
+    return 0;
+  }
+
+  cbcenc_impl->init(&cbcenc_ctx.vtable, key, size);
+  cbcdec_impl->init(&cbcdec_ctx.vtable, key, size);
+  keyed = 1;
 
   return 1;
 }
 
-int DESClass::runDecryption(uint8_t *key, size_t size, uint8_t *input, size_t block_size, uint8_t *iv)
+int DESClass::encrypt(uint8_t *input, size_t block_size, uint8_t *iv)
+{
+  if (!keyed || block_size % DES_BLOCK_SIZE != 0) {
+    return 0;
+  }
+
+  cbcenc_ctx.vtable->run(&cbcenc_ctx.vtable, iv, input, block_size);
+
+  return 1;
+}
+
+int DESClass::decrypt(uint8_t *input, size_t block_size, uint8_t *iv)
+{
+  if (!keyed || block_size % DES_BLOCK_SIZE != 0) {
+    return 0;
+  }
+
+  cbcdec_ctx.vtable->run(&cbcdec_ctx.vtable, iv, input, block_size);
+
+  return 1;
+}
+
+int DESClass::runEncryption(uint8_t *key, size_t size, uint8_t *input, size_t block_size, uint8_t *iv)
 {
-  br_des_ct_cbcdec_init(&cbcdec_ctx, key, size);
-  br_des_ct_cbcdec_run(&cbcdec_ctx, iv, input, block_size); // block_size must be multiple of 8
+  keyed = 0;
+  cbcenc_impl->init(&cbcenc_ctx.vtable, key, size);
+  cbcenc_ctx.vtable->run(&cbcenc_ctx.vtable, iv, input, block_size); // block_size must be multiple of 8
 
   return 1;
 }
 
+int DESClass::runDecryption(uint8_t *key, size_t size, uint8_t *input, size_t block_size, uint8_t *iv)
+{
+  keyed = 0;
+  cbcdec_impl->init(&cbcdec_ctx.vtable, key, size);
+  cbcdec_ctx.vtable->run(&cbcdec_ctx.vtable, iv, input, block_size); // block_size must be multiple of 8
 
-#ifndef ARDUINO_ARCH_MEGAAVR
-DESClass DES;
-#endif
\ No newline at end of file
+  return 1;
+}
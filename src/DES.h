@@ -27,6 +27,7 @@
 
 #include <bearssl/bearssl_block.h>
 
+#include "BearSSLConfig.h"
 #include "Encryption.h"
 
 #define DES_BLOCK_SIZE 8
@@ -38,15 +39,32 @@ public:
   DESClass();
   virtual ~DESClass();
 
+  // size is 8 bytes (DES) or 16 or 24 (3DES), block_size a multiple of 8
+  virtual int setKey(const uint8_t *key, size_t size = DES_BLOCK_SIZE);
+  virtual int encrypt(uint8_t *input, size_t block_size, uint8_t *iv);
+  virtual int decrypt(uint8_t *input, size_t block_size, uint8_t *iv);
+  using EncryptionClass::encrypt;
+  using EncryptionClass::decrypt;
+
+  // block cipher implementation, the constant-time br_des_ct_* one by
+  // default; the table based br_des_tab_* is faster but not constant-time,
+  // setKey() must be called again afterwards
+  void setImplementation(const br_block_cbcenc_class *enc, const br_block_cbcdec_class *dec);
+
 protected:
   virtual int runEncryption(uint8_t *key, size_t size, uint8_t *input, size_t block_size, uint8_t *iv);
   virtual int runDecryption(uint8_t *key, size_t size, uint8_t *input, size_t block_size, uint8_t *iv);
 
 private:
-  br_des_ct_cbcenc_keys cbcenc_ctx;
-  br_des_ct_cbcdec_keys cbcdec_ctx;
+  const br_block_cbcenc_class *cbcenc_impl;
+  const br_block_cbcdec_class *cbcdec_impl;
+  br_des_gen_cbcenc_keys cbcenc_ctx;
+  br_des_gen_cbcdec_keys cbcdec_ctx;
+  int keyed;
 };
 
+#if BEARSSL_ENABLE_3DES
 extern DESClass DES;
+#endif
 
 #endif
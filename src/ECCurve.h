@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef EC_CURVE_H
+#define EC_CURVE_H
+
+#include <Arduino.h>
+
+#include <bearssl/bearssl_ec.h>
+
+#include "BearSSLConfig.h"
+
+// Curves for ECDH<Curve> and ECDSA<Curve>. Each one binds to the bearssl
+// code of that curve alone, so a sketch only links the curves it uses,
+// and calls skip the curve dispatch of br_ec_get_default(). Key sizes
+// are in bytes, public keys and peer keys are uncompressed points for
+// the NIST curves and the 32-byte u coordinate for X25519.
+#define EC_CURVE(name, id, privateKeySize, publicKeySize, secretSize, getImpl) \
+  struct name { \
+    enum { \
+      ID = id, \
+      PRIVATE_KEY_SIZE = privateKeySize, \
+      PUBLIC_KEY_SIZE = publicKeySize, \
+      SHARED_SECRET_SIZE = secretSize, \
+      SIGNATURE_SIZE = 2 * privateKeySize \
+    }; \
+    static const br_ec_impl *impl() { return getImpl(); } \
+  }
+
+EC_CURVE(P256, BR_EC_secp256r1, 32, 65, 32, br_ec_p256_get_default);
+#if BEARSSL_ENABLE_P384
+EC_CURVE(P384, BR_EC_secp384r1, 48, 97, 48, br_ec_prime_get_default);
+#endif
+EC_CURVE(X25519, BR_EC_curve25519, 32, 32, 32, br_ec_c25519_get_default);
+
+#undef EC_CURVE
+
+#endif
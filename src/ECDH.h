@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ECDH_H
+#define ECDH_H
+
+#include <Arduino.h>
+
+#include <bearssl/bearssl_ec.h>
+#include <bearssl/bearssl_rand.h>
+
+#include "ECCurve.h"
+
+// Elliptic curve Diffie-Hellman on one curve, e.g. ECDH<P256>:
+//
+//   ECDH<X25519> ecdh;
+//   ecdh.generateKey(&rng.vtable);
+//   ecdh.publicKey(ourKey);        // send to the peer
+//   ecdh.sharedSecret(peerKey, sizeof(peerKey), secret);
+//
+// the shared secret is the X coordinate of the shared point, it should
+// go through a KDF (see HKDF) before it is used as a key
+template <typename Curve>
+class ECDH {
+
+public:
+  enum {
+    PRIVATE_KEY_SIZE = Curve::PRIVATE_KEY_SIZE,
+    PUBLIC_KEY_SIZE = Curve::PUBLIC_KEY_SIZE,
+    SHARED_SECRET_SIZE = Curve::SHARED_SECRET_SIZE
+  };
+
+  ECDH()
+  {
+    _key.curve = Curve::ID;
+    _key.x = _keyData;
+    _key.xlen = 0;
+  }
+
+  ~ECDH()
+  {
+    clear();
+  }
+
+  // new random private key, rng is e.g. the vtable of a seeded
+  // br_hmac_drbg_context
+  int generateKey(const br_prng_class **rng)
+  {
+    _key.xlen = br_ec_keygen(rng, Curve::impl(), &_key, _keyData, Curve::ID);
+
+    return _key.xlen != 0;
+  }
+
+  // stored private key (big-endian), it is copied
+  int setPrivateKey(const uint8_t *key, size_t length)
+  {
+    if (length == 0 || length > sizeof(_keyData)) {
+      return 0;
+    }
+
+    memcpy(_keyData, key, length);
+    _key.xlen = length;
+
+    return 1;
+  }
+
+  // key gets PUBLIC_KEY_SIZE bytes, returns that length or 0 without a
+  // private key
+  size_t publicKey(uint8_t *key)
+  {
+    if (_key.xlen == 0) {
+      return 0;
+    }
+
+    return br_ec_compute_pub(Curve::impl(), NULL, key, &_key);
+  }
+
+  // secret gets SHARED_SECRET_SIZE bytes, returns 0 if peerKey is not a
+  // valid point of the curve
+  int sharedSecret(const uint8_t *peerKey, size_t length, uint8_t *secret)
+  {
+    const br_ec_impl *impl = Curve::impl();
+    uint8_t point[PUBLIC_KEY_SIZE];
+    size_t xlen;
+    size_t xoff;
+
+    if (_key.xlen == 0 || length != sizeof(point)) {
+      return 0;
+    }
+
+    memcpy(point, peerKey, length);
+
+    if (!impl->mul(point, length, _key.x, _key.xlen, Curve::ID)) {
+      return 0;
+    }
+
+    xoff = impl->xoff(Curve::ID, &xlen);
+    memcpy(secret, point + xoff, xlen);
+
+    return 1;
+  }
+
+  // wipe the private key
+  void clear()
+  {
+    memset(_keyData, 0x00, sizeof(_keyData));
+    _key.xlen = 0;
+  }
+
+private:
+  br_ec_private_key _key;
+  uint8_t _keyData[PRIVATE_KEY_SIZE];
+};
+
+#endif
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ECDSA_H
+#define ECDSA_H
+
+#include <Arduino.h>
+
+#include <bearssl/bearssl_ec.h>
+#include <bearssl/bearssl_hash.h>
+
+#include "ECCurve.h"
+
+// ECDSA on one NIST curve, e.g. ECDSA<P256>, over a digest computed
+// beforehand (see SHA256, or SignatureVerifier to hash and verify a
+// stream). Signatures are raw r || s, SIGNATURE_SIZE bytes:
+//
+//   ECDSA<P256> ecdsa;
+//   ecdsa.setPrivateKey(key, sizeof(key));
+//   ecdsa.sign(digest, signature);
+//
+//   ecdsa.setPublicKey(peerKey, sizeof(peerKey));
+//   if (ecdsa.verify(digest, sizeof(digest), signature, sizeof(signature))) ...
+template <typename Curve>
+class ECDSA {
+
+  static_assert(Curve::ID != BR_EC_curve25519, "ECDSA needs a NIST curve");
+
+public:
+  enum {
+    PRIVATE_KEY_SIZE = Curve::PRIVATE_KEY_SIZE,
+    PUBLIC_KEY_SIZE = Curve::PUBLIC_KEY_SIZE,
+    SIGNATURE_SIZE = Curve::SIGNATURE_SIZE
+  };
+
+  ECDSA()
+  {
+    _privateKey.curve = Curve::ID;
+    _privateKey.x = _privateKeyData;
+    _privateKey.xlen = 0;
+    _publicKey.curve = Curve::ID;
+    _publicKey.q = _publicKeyData;
+    _publicKey.qlen = 0;
+  }
+
+  ~ECDSA()
+  {
+    memset(_privateKeyData, 0x00, sizeof(_privateKeyData));
+  }
+
+  // new random key pair, see ECDH::generateKey()
+  int generateKey(const br_prng_class **rng)
+  {
+    _privateKey.xlen = br_ec_keygen(rng, Curve::impl(), &_privateKey, _privateKeyData, Curve::ID);
+
+    return _privateKey.xlen != 0 && computePublicKey();
+  }
+
+  // the public key is derived too, so signatures can be checked with
+  // the same object
+  int setPrivateKey(const uint8_t *key, size_t length)
+  {
+    if (length == 0 || length > sizeof(_privateKeyData)) {
+      return 0;
+    }
+
+    memcpy(_privateKeyData, key, length);
+    _privateKey.xlen = length;
+
+    return computePublicKey();
+  }
+
+  // uncompressed point, PUBLIC_KEY_SIZE bytes
+  int setPublicKey(const uint8_t *key, size_t length)
+  {
+    if (length != sizeof(_publicKeyData)) {
+      return 0;
+    }
+
+    memcpy(_publicKeyData, key, length);
+    _publicKey.qlen = length;
+
+    return 1;
+  }
+
+  // key gets PUBLIC_KEY_SIZE bytes, returns that length or 0 without a key
+  size_t publicKey(uint8_t *key)
+  {
+    memcpy(key, _publicKeyData, _publicKey.qlen);
+
+    return _publicKey.qlen;
+  }
+
+  // deterministic (RFC 6979) signature of the digest made with hash,
+  // signature gets SIGNATURE_SIZE bytes, returns that length or 0
+  size_t sign(const uint8_t *digest, uint8_t *signature, const br_hash_class *hash = &br_sha256_vtable)
+  {
+    if (_privateKey.xlen == 0) {
+      return 0;
+    }
+
+    return br_ecdsa_sign_raw_get_default()(Curve::impl(), hash, digest, &_privateKey, signature);
+  }
+
+  // 1 if signature is valid for the digest and the public key
+  int verify(const uint8_t *digest, size_t digestLength, const uint8_t *signature, size_t length)
+  {
+    if (_publicKey.qlen == 0) {
+      return 0;
+    }
+
+    return br_ecdsa_vrfy_raw_get_default()(Curve::impl(), digest, digestLength, &_publicKey, signature, length) == 1;
+  }
+
+private:
+  int computePublicKey()
+  {
+    _publicKey.qlen = br_ec_compute_pub(Curve::impl(), NULL, _publicKeyData, &_privateKey);
+
+    return _publicKey.qlen != 0;
+  }
+
+private:
+  br_ec_private_key _privateKey;
+  br_ec_public_key _publicKey;
+  uint8_t _privateKeyData[PRIVATE_KEY_SIZE];
+  uint8_t _publicKeyData[PUBLIC_KEY_SIZE];
+};
+
+#endif
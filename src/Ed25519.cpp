@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Ed25519.h"
+
+Ed25519::Ed25519() :
+  _hasPrivateKey(false),
+  _hasPublicKey(false)
+{
+}
+
+Ed25519::~Ed25519()
+{
+  clear();
+}
+
+int Ed25519::generateKey(const br_prng_class **rng)
+{
+  (*rng)->generate(rng, _privateKey, sizeof(_privateKey));
+  br_ed25519_m31_public_key(_publicKey, _privateKey);
+  _hasPrivateKey = true;
+  _hasPublicKey = true;
+
+  return 1;
+}
+
+int Ed25519::setPrivateKey(const uint8_t *key, size_t length)
+{
+  if (length != sizeof(_privateKey)) {
+    return 0;
+  }
+
+  memcpy(_privateKey, key, length);
+  br_ed25519_m31_public_key(_publicKey, _privateKey);
+  _hasPrivateKey = true;
+  _hasPublicKey = true;
+
+  return 1;
+}
+
+int Ed25519::setPublicKey(const uint8_t *key, size_t length)
+{
+  if (length != sizeof(_publicKey)) {
+    return 0;
+  }
+
+  memcpy(_publicKey, key, length);
+  _hasPrivateKey = false;
+  _hasPublicKey = true;
+
+  return 1;
+}
+
+size_t Ed25519::publicKey(uint8_t *key)
+{
+  if (!_hasPublicKey) {
+    return 0;
+  }
+
+  memcpy(key, _publicKey, sizeof(_publicKey));
+
+  return sizeof(_publicKey);
+}
+
+size_t Ed25519::sign(const uint8_t *message, size_t length, uint8_t *signature)
+{
+  if (!_hasPrivateKey) {
+    return 0;
+  }
+
+  return br_ed25519_m31_sign(signature, _privateKey, _publicKey, message, length);
+}
+
+int Ed25519::verify(const uint8_t *message, size_t length, const uint8_t *signature, size_t signatureLength)
+{
+  if (!_hasPublicKey || signatureLength != SIGNATURE_SIZE) {
+    return 0;
+  }
+
+  return br_ed25519_m31_verify(signature, _publicKey, message, length) == 1;
+}
+
+void Ed25519::clear()
+{
+  memset(_privateKey, 0x00, sizeof(_privateKey));
+  _hasPrivateKey = false;
+}
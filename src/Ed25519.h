@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ED25519_H
+#define ED25519_H
+
+#include <Arduino.h>
+
+#include <bearssl/bearssl_ec.h>
+#include <bearssl/bearssl_rand.h>
+
+// Ed25519 signatures (RFC 8032) over whole messages, hashed internally
+// with SHA-512. Signing is deterministic, so it needs no random source:
+//
+//   Ed25519 ed25519;
+//   ed25519.setPrivateKey(seed, sizeof(seed));
+//   ed25519.sign(message, length, signature);
+//
+//   ed25519.setPublicKey(peerKey, sizeof(peerKey));
+//   if (ed25519.verify(message, length, signature, sizeof(signature))) ...
+class Ed25519 {
+
+public:
+  enum {
+    PRIVATE_KEY_SIZE = BR_ED25519_SECRET_SIZE,
+    PUBLIC_KEY_SIZE = BR_ED25519_PUBLIC_KEY_SIZE,
+    SIGNATURE_SIZE = BR_ED25519_SIGNATURE_SIZE
+  };
+
+  Ed25519();
+  virtual ~Ed25519();
+
+  // new random private key (seed), the public key is derived too
+  int generateKey(const br_prng_class **rng);
+
+  // 32-byte seed, the public key is derived too
+  int setPrivateKey(const uint8_t *key, size_t length);
+
+  int setPublicKey(const uint8_t *key, size_t length);
+
+  // key gets PUBLIC_KEY_SIZE bytes, returns that length or 0 without a key
+  size_t publicKey(uint8_t *key);
+
+  // signature gets SIGNATURE_SIZE bytes, returns that length or 0
+  size_t sign(const uint8_t *message, size_t length, uint8_t *signature);
+
+  // 1 if signature is valid for the message and the public key
+  int verify(const uint8_t *message, size_t length, const uint8_t *signature, size_t signatureLength);
+
+  // wipe the private key
+  void clear();
+
+private:
+  uint8_t _privateKey[PRIVATE_KEY_SIZE];
+  uint8_t _publicKey[PUBLIC_KEY_SIZE];
+  bool _hasPrivateKey;
+  bool _hasPublicKey;
+};
+
+#endif
@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ArduinoBearSSL.h"
+
+#include "EncryptedFile.h"
+
+#define NO_BLOCK 0xffffffffUL
+
+EncryptedFile::EncryptedFile() :
+  _open(false),
+  _failed(false),
+  _blocks(0),
+  _size(0),
+  _position(0),
+  _index(NO_BLOCK),
+  _length(0),
+  _dirty(false)
+{
+  _storage.read = NULL;
+  _storage.write = NULL;
+  _storage.arg = NULL;
+}
+
+EncryptedFile::~EncryptedFile()
+{
+  memset(_block, 0x00, sizeof(_block));
+}
+
+int EncryptedFile::begin(const uint8_t *key, size_t keySize, const EncryptedFileStorage& storage, uint32_t storedSize)
+{
+  _open = false;
+  _failed = false;
+  _index = NO_BLOCK;
+  _dirty = false;
+  _position = 0;
+  _size = 0;
+
+  if (storage.read == NULL || storage.write == NULL || !_gcm.setKey(key, keySize)) {
+    return 0;
+  }
+
+  _storage = storage;
+  _blocks = storedSize / ENCRYPTED_FILE_SLOT_SIZE;
+  _open = true;
+
+  // the size is the one of the last block
+  if (_blocks) {
+    if (!load(_blocks - 1)) {
+      _open = false;
+      return 0;
+    }
+
+    _size = (_blocks - 1) * ENCRYPTED_FILE_BLOCK_SIZE + _length;
+  }
+
+  return 1;
+}
+
+int EncryptedFile::end()
+{
+  int result = store() && !_failed;
+
+  memset(_block, 0x00, sizeof(_block));
+  _index = NO_BLOCK;
+  _open = false;
+
+  return result;
+}
+
+int EncryptedFile::seek(uint32_t position)
+{
+  if (!_open || position > _size) {
+    return 0;
+  }
+
+  _position = position;
+
+  return 1;
+}
+
+uint32_t EncryptedFile::position()
+{
+  return _position;
+}
+
+uint32_t EncryptedFile::size()
+{
+  return _size;
+}
+
+uint32_t EncryptedFile::storedSize(uint32_t size)
+{
+  return (size + ENCRYPTED_FILE_BLOCK_SIZE - 1) / ENCRYPTED_FILE_BLOCK_SIZE * ENCRYPTED_FILE_SLOT_SIZE;
+}
+
+bool EncryptedFile::failed()
+{
+  return _failed;
+}
+
+int EncryptedFile::read(uint8_t *buffer, size_t length)
+{
+  size_t total = 0;
+
+  while (length > 0 && _position < _size) {
+    uint32_t offset = _position % ENCRYPTED_FILE_BLOCK_SIZE;
+
+    if (!load(_position / ENCRYPTED_FILE_BLOCK_SIZE)) {
+      break;
+    }
+
+    size_t n = _length - offset;
+
+    if (n > length) {
+      n = length;
+    }
+
+    memcpy(buffer, _block + offset, n);
+    _position += n;
+    buffer += n;
+    length -= n;
+    total += n;
+  }
+
+  return total ? (int)total : -1;
+}
+
+int EncryptedFile::available()
+{
+  return _size - _position;
+}
+
+int EncryptedFile::read()
+{
+  uint8_t b;
+
+  return (read(&b, sizeof(b)) == sizeof(b)) ? b : -1;
+}
+
+int EncryptedFile::peek()
+{
+  if (_position >= _size || !load(_position / ENCRYPTED_FILE_BLOCK_SIZE)) {
+    return -1;
+  }
+
+  return _block[_position % ENCRYPTED_FILE_BLOCK_SIZE];
+}
+
+size_t EncryptedFile::write(uint8_t data)
+{
+  return write(&data, sizeof(data));
+}
+
+size_t EncryptedFile::write(const uint8_t *buffer, size_t size)
+{
+  size_t total = 0;
+
+  while (size > 0) {
+    uint32_t offset = _position % ENCRYPTED_FILE_BLOCK_SIZE;
+
+    if (!load(_position / ENCRYPTED_FILE_BLOCK_SIZE)) {
+      setWriteError();
+      break;
+    }
+
+    size_t n = ENCRYPTED_FILE_BLOCK_SIZE - offset;
+
+    if (n > size) {
+      n = size;
+    }
+
+    memcpy(_block + offset, buffer, n);
+    if (offset + n > _length) {
+      _length = offset + n;
+    }
+    _dirty = true;
+
+    _position += n;
+    buffer += n;
+    size -= n;
+    total += n;
+
+    if (_position > _size) {
+      _size = _position;
+    }
+  }
+
+  return total;
+}
+
+void EncryptedFile::flush()
+{
+  store();
+}
+
+int EncryptedFile::load(uint32_t index)
+{
+  if (!_open) {
+    return 0;
+  }
+
+  if (index == _index) {
+    return 1;
+  }
+
+  if (!store()) {
+    return 0;
+  }
+
+  _index = NO_BLOCK;
+
+  // a new block at the end of the file
+  if (index >= _blocks) {
+    memset(_block, 0x00, sizeof(_block));
+    _index = index;
+    _length = 0;
+    return 1;
+  }
+
+  uint32_t offset = index * ENCRYPTED_FILE_SLOT_SIZE;
+  uint8_t header[ENCRYPTED_FILE_HEADER_SIZE];
+  uint8_t tag[AESGCM_TAG_SIZE];
+  uint8_t aad[6];
+
+  if (_storage.read(offset, header, sizeof(header), _storage.arg) != sizeof(header) ||
+      _storage.read(offset + sizeof(header), _block, sizeof(_block), _storage.arg) != sizeof(_block) ||
+      _storage.read(offset + sizeof(header) + sizeof(_block), tag, sizeof(tag), _storage.arg) != sizeof(tag)) {
+    _failed = true;
+    return 0;
+  }
+
+  uint16_t length = (header[AESGCM_IV_SIZE] << 8) | header[AESGCM_IV_SIZE + 1];
+
+  authData(index, length, aad);
+
+  if (length > sizeof(_block) ||
+      !_gcm.decrypt(header, AESGCM_IV_SIZE, aad, sizeof(aad), _block, sizeof(_block), tag)) {
+    _failed = true;
+    return 0;
+  }
+
+  _index = index;
+  _length = length;
+
+  return 1;
+}
+
+int EncryptedFile::store()
+{
+  if (!_dirty) {
+    return 1;
+  }
+
+  uint32_t offset = _index * ENCRYPTED_FILE_SLOT_SIZE;
+  uint8_t header[ENCRYPTED_FILE_HEADER_SIZE];
+  uint8_t tag[AESGCM_TAG_SIZE];
+  uint8_t aad[6];
+
+  ArduinoBearSSL.getRandom(header, AESGCM_IV_SIZE);
+  header[AESGCM_IV_SIZE] = _length >> 8;
+  header[AESGCM_IV_SIZE + 1] = _length;
+  authData(_index, _length, aad);
+
+  _gcm.encrypt(header, AESGCM_IV_SIZE, aad, sizeof(aad), _block, sizeof(_block), tag);
+
+  int result = _storage.write(offset, header, sizeof(header), _storage.arg) == sizeof(header) &&
+               _storage.write(offset + sizeof(header), _block, sizeof(_block), _storage.arg) == sizeof(_block) &&
+               _storage.write(offset + sizeof(header) + sizeof(_block), tag, sizeof(tag), _storage.arg) == sizeof(tag);
+
+  // CTR again with the same nonce gives the plaintext back, the block
+  // stays usable without reading it again
+  uint8_t unused[AESGCM_TAG_SIZE];
+
+  _gcm.encrypt(header, AESGCM_IV_SIZE, aad, sizeof(aad), _block, sizeof(_block), unused);
+
+  if (!result) {
+    _failed = true;
+    return 0;
+  }
+
+  _dirty = false;
+  if (_index >= _blocks) {
+    _blocks = _index + 1;
+  }
+
+  return 1;
+}
+
+void EncryptedFile::authData(uint32_t index, uint16_t length, uint8_t aad[6])
+{
+  aad[0] = index >> 24;
+  aad[1] = index >> 16;
+  aad[2] = index >> 8;
+  aad[3] = index;
+  aad[4] = length >> 8;
+  aad[5] = length;
+}
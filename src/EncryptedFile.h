@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ENCRYPTED_FILE_H
+#define ENCRYPTED_FILE_H
+
+#include <Arduino.h>
+
+#include "BearSSLConfig.h"
+#include "AESGCM.h"
+
+// plaintext bytes per block, the block is kept in RAM
+#ifndef ENCRYPTED_FILE_BLOCK_SIZE
+#define ENCRYPTED_FILE_BLOCK_SIZE 4096
+#endif
+
+#define ENCRYPTED_FILE_HEADER_SIZE (AESGCM_IV_SIZE + 2)
+// bytes each block takes in storage
+#define ENCRYPTED_FILE_SLOT_SIZE (ENCRYPTED_FILE_HEADER_SIZE + ENCRYPTED_FILE_BLOCK_SIZE + AESGCM_TAG_SIZE)
+
+// random access to the stored bytes, e.g. seek() and read() or write() on
+// an SD File; both return how many bytes were transferred
+struct EncryptedFileStorage {
+  size_t (*read)(uint32_t offset, uint8_t *buffer, size_t length, void *arg);
+  size_t (*write)(uint32_t offset, const uint8_t *buffer, size_t length, void *arg);
+  void *arg;
+};
+
+// A file of AES-GCM blocks that can be read and rewritten in place: each
+// block of ENCRYPTED_FILE_BLOCK_SIZE bytes is stored on its own as
+//
+//   nonce (12) | length (2) | ciphertext (ENCRYPTED_FILE_BLOCK_SIZE) | tag (16)
+//
+// with a fresh random nonce on every write and the block number and
+// length authenticated along, so that reads and writes only touch the
+// blocks they cover. Blocks cannot be moved within the file unnoticed,
+// but dropping the last ones, or putting back an older version of a
+// block or a block of another file with the same key, is not detected:
+// use one key per file and keep the size elsewhere if that matters.
+//
+// Writes go to the block held in RAM, it is sealed and stored when
+// another block is needed, on flush() and on end().
+class EncryptedFile : public Stream {
+
+public:
+  EncryptedFile();
+  virtual ~EncryptedFile();
+
+  // storedSize is the current size of the storage, 0 for a new file.
+  // Returns 0 if the key is invalid or the last block fails to verify
+  int begin(const uint8_t *key, size_t keySize, const EncryptedFileStorage& storage, uint32_t storedSize = 0);
+  // stores the pending block, returns 0 if that fails
+  int end();
+
+  // anywhere up to size(), writing there extends the file
+  int seek(uint32_t position);
+  uint32_t position();
+  uint32_t size();
+  // bytes the storage holds for size() bytes of plaintext
+  static uint32_t storedSize(uint32_t size);
+
+  // true once a block failed to verify or the storage failed
+  bool failed();
+
+  // plaintext, -1 at the end of the file or if a block does not verify
+  int read(uint8_t *buffer, size_t length);
+
+  // Stream
+  virtual int available();
+  virtual int read();
+  virtual int peek();
+  virtual size_t write(uint8_t data);
+  virtual size_t write(const uint8_t *buffer, size_t size);
+  virtual void flush();
+  using Print::write;
+
+private:
+  int load(uint32_t index);
+  int store();
+  void authData(uint32_t index, uint16_t length, uint8_t aad[6]);
+
+  AESGCMClass _gcm;
+  EncryptedFileStorage _storage;
+  bool _open;
+  bool _failed;
+  uint32_t _blocks;   // blocks in storage
+  uint32_t _size;
+  uint32_t _position;
+
+  uint32_t _index;    // block held in _block, NO_BLOCK if none
+  uint16_t _length;   // plaintext bytes in it
+  bool _dirty;
+  uint8_t _block[ENCRYPTED_FILE_BLOCK_SIZE];
+};
+
+#endif
@@ -24,39 +24,227 @@
 
 #include "Encryption.h"
 
+#define MODE_NONE    0
+#define MODE_ENCRYPT 1
+#define MODE_DECRYPT 2
+
 EncryptionClass::EncryptionClass(int blockSize, int digestSize) :
   _blockSize(blockSize),
-  _digestSize(digestSize)
+  _digestSize(digestSize),
+  _dataLength(0),
+  _mode(MODE_NONE)
 {
-  _data = (uint8_t*)malloc(_digestSize);
-  _secret = (uint8_t*)malloc(_blockSize);
-  _ivector = (uint8_t*)malloc(_blockSize);
 }
 
 EncryptionClass::~EncryptionClass()
 {
-  if (_secret) {
-    free(_secret);
-    _secret = NULL;
+}
+
+int EncryptionClass::runEnc(uint8_t *_secret, size_t _secretLength, uint8_t *_data, size_t _dataLength, uint8_t *_ivector)
+{
+  return runEncryption(_secret, _secretLength, _data, _dataLength, _ivector);
+}
+
+int EncryptionClass::runDec(uint8_t *_secret, size_t _secretLength, uint8_t *_data, size_t _dataLength, uint8_t *_ivector)
+{
+  return runDecryption(_secret, _secretLength, _data, _dataLength, _ivector);
+}
+
+int EncryptionClass::setKey(const uint8_t * /*key*/, size_t /*size*/)
+{
+  return 0;
+}
+
+int EncryptionClass::encrypt(uint8_t * /*input*/, size_t /*block_size*/, uint8_t * /*iv*/)
+{
+  return 0;
+}
+
+int EncryptionClass::decrypt(uint8_t * /*input*/, size_t /*block_size*/, uint8_t * /*iv*/)
+{
+  return 0;
+}
+
+int EncryptionClass::encrypt(const uint8_t *input, uint8_t *output, size_t block_size, uint8_t *iv)
+{
+  memmove(output, input, block_size);
+
+  return encrypt(output, block_size, iv);
+}
+
+int EncryptionClass::decrypt(const uint8_t *input, uint8_t *output, size_t block_size, uint8_t *iv)
+{
+  memmove(output, input, block_size);
+
+  return decrypt(output, block_size, iv);
+}
+
+int EncryptionClass::mac(const uint8_t *input, size_t block_size, uint8_t *mac)
+{
+  // several blocks per call keep the per call overhead of the cipher low
+  uint8_t chunk[4 * ENCRYPTION_MAX_BLOCK_SIZE];
+
+  if (block_size % _blockSize != 0) {
+    return 0;
   }
 
-  if (_data) {
-    free(_data);
-    _data = NULL;
+  while (block_size > 0) {
+    size_t n = block_size < sizeof(chunk) ? block_size : sizeof(chunk);
+
+    memcpy(chunk, input, n);
+
+    if (encrypt(chunk, n, mac) == 0) {
+      return 0;
+    }
+
+    input += n;
+    block_size -= n;
   }
 
-  if (_ivector) {
-    free(_ivector);
-    _ivector = NULL;
+  memset(chunk, 0x00, sizeof(chunk));
+
+  return 1;
+}
+
+int EncryptionClass::beginEncrypt(const uint8_t *key, size_t size, const uint8_t *iv)
+{
+  return begin(MODE_ENCRYPT, key, size, iv);
+}
+
+int EncryptionClass::beginDecrypt(const uint8_t *key, size_t size, const uint8_t *iv)
+{
+  return begin(MODE_DECRYPT, key, size, iv);
+}
+
+int EncryptionClass::begin(int mode, const uint8_t *key, size_t size, const uint8_t *iv)
+{
+  _mode = MODE_NONE;
+  _dataLength = 0;
+
+  if (_blockSize > ENCRYPTION_MAX_BLOCK_SIZE || setKey(key, size) == 0) {
+    return 0;
   }
+
+  memcpy(_ivector, iv, _blockSize);
+  _mode = mode;
+
+  return 1;
 }
 
-int EncryptionClass::runEnc(uint8_t *_secret, size_t _secretLength, uint8_t *_data, size_t _dataLength, uint8_t *_ivector)
+int EncryptionClass::run(uint8_t *output, size_t length)
 {
-  return runEncryption(_secret, _secretLength, _data, _dataLength, _ivector);
+  if (_mode == MODE_ENCRYPT) {
+    return encrypt(output, length, _ivector);
+  } else {
+    return decrypt(output, length, _ivector);
+  }
 }
 
-int EncryptionClass::runDec(uint8_t *_secret, size_t _secretLength, uint8_t *_data, size_t _dataLength, uint8_t *_ivector)
+int EncryptionClass::update(const uint8_t *input, uint8_t *output, size_t length)
 {
-  return runDecryption(_secret, _secretLength, _data, _dataLength, _ivector);
-}
\ No newline at end of file
+  int written = 0;
+
+  if (_mode == MODE_NONE) {
+    return -1;
+  }
+
+  while (length > 0) {
+    // a full block is only decrypted once more data follows, the last
+    // one is left for end() to remove the padding
+    if (_dataLength == _blockSize) {
+      memcpy(output + written, _data, _blockSize);
+
+      if (run(output + written, _blockSize) == 0) {
+        return -1;
+      }
+
+      written += _blockSize;
+      _dataLength = 0;
+    }
+
+    if (_dataLength == 0 && length > (size_t)_blockSize) {
+      size_t n = ((length - 1) / _blockSize) * _blockSize;
+
+      memcpy(output + written, input, n);
+
+      if (run(output + written, n) == 0) {
+        return -1;
+      }
+
+      written += n;
+      input += n;
+      length -= n;
+    }
+
+    size_t n = _blockSize - _dataLength;
+
+    if (n > length) {
+      n = length;
+    }
+
+    memcpy(_data + _dataLength, input, n);
+    _dataLength += n;
+    input += n;
+    length -= n;
+  }
+
+  return written;
+}
+
+int EncryptionClass::end(uint8_t *output)
+{
+  int mode = _mode;
+  int length = _dataLength;
+  int written = 0;
+
+  _mode = MODE_NONE;
+  _dataLength = 0;
+
+  if (mode == MODE_ENCRYPT) {
+    // a full block is followed by a block of padding
+    if (length == _blockSize) {
+      memcpy(output, _data, _blockSize);
+
+      if (encrypt(output, _blockSize, _ivector) == 0) {
+        return -1;
+      }
+
+      written = _blockSize;
+      length = 0;
+    }
+
+    memcpy(output + written, _data, length);
+    memset(output + written + length, _blockSize - length, _blockSize - length);
+
+    memset(_data, 0x00, _blockSize);
+
+    if (encrypt(output + written, _blockSize, _ivector) == 0) {
+      return -1;
+    }
+
+    return written + _blockSize;
+  }
+
+  if (mode != MODE_DECRYPT || length != _blockSize || decrypt(_data, _blockSize, _ivector) == 0) {
+    return -1;
+  }
+
+  // check the padding without branching on its bytes
+  int padding = _data[_blockSize - 1];
+  int bad = (padding == 0) | (padding > _blockSize);
+
+  for (int i = 0; i < _blockSize; i++) {
+    bad |= (i >= _blockSize - padding) & (_data[i] != padding);
+  }
+
+  if (bad) {
+    memset(_data, 0x00, _blockSize);
+    return -1;
+  }
+
+  written = _blockSize - padding;
+  memcpy(output, _data, written);
+  memset(_data, 0x00, _blockSize);
+
+  return written;
+}
@@ -27,6 +27,9 @@
 
 #include <Arduino.h>
 
+// largest block size of the subclasses, for the streaming state
+#define ENCRYPTION_MAX_BLOCK_SIZE 16
+
 class EncryptionClass {
 
 public:
@@ -36,20 +39,49 @@ public:
   int runEnc(uint8_t *_secret, size_t _secretLength, uint8_t *_data, size_t _dataLength, uint8_t *_ivector);
   int runDec(uint8_t *_secret, size_t _secretLength, uint8_t *_data, size_t _dataLength, uint8_t *_ivector);
 
+  // keyed CBC, the key schedule is expanded once by setKey() and
+  // reused by encrypt() and decrypt(), 0 if not supported
+  virtual int setKey(const uint8_t *key, size_t size);
+  virtual int encrypt(uint8_t *input, size_t block_size, uint8_t *iv);
+  virtual int decrypt(uint8_t *input, size_t block_size, uint8_t *iv);
+
+  // out-of-place variants, input can be read-only (e.g. in flash) or
+  // the same buffer as output
+  int encrypt(const uint8_t *input, uint8_t *output, size_t block_size, uint8_t *iv);
+  int decrypt(const uint8_t *input, uint8_t *output, size_t block_size, uint8_t *iv);
+
+  // CBC-MAC over input without modifying it: mac holds the IV (usually
+  // zeros) on entry and the last ciphertext block on return, so long
+  // messages can be processed in several calls
+  int mac(const uint8_t *input, size_t block_size, uint8_t *mac);
+
+  // streaming CBC with PKCS#7 padding for data that does not fit in
+  // memory: update() takes any length, keeps partial blocks and chains
+  // the IV, end() writes the padded (or unpadded) final block; both
+  // return the number of bytes written to output, or -1 on error, and
+  // output needs room for length plus one block and must not overlap
+  // input
+  int beginEncrypt(const uint8_t *key, size_t size, const uint8_t *iv);
+  int beginDecrypt(const uint8_t *key, size_t size, const uint8_t *iv);
+  int update(const uint8_t *input, uint8_t *output, size_t length);
+  int end(uint8_t *output);
+
 protected:
   virtual int runEncryption(uint8_t *key, size_t size, uint8_t *input, size_t block_size, uint8_t *iv) = 0;
   virtual int runDecryption(uint8_t *key, size_t size, uint8_t *input, size_t block_size, uint8_t *iv) = 0;
 
+private:
+  int begin(int mode, const uint8_t *key, size_t size, const uint8_t *iv);
+  int run(uint8_t *output, size_t length);
+
 private:
   int _blockSize;
   int _digestSize;
 
-  uint8_t* _secret;
-  int _secretLength;
-  uint8_t* _ivector;
-  int _ivectorLength;
-  uint8_t* _data;
+  uint8_t _ivector[ENCRYPTION_MAX_BLOCK_SIZE];
+  uint8_t _data[ENCRYPTION_MAX_BLOCK_SIZE];
   int _dataLength;
+  int _mode;
 };
 
 #endif
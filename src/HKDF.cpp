@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "HKDF.h"
+
+HKDFClass::HKDFClass() :
+  extracted(0)
+{
+}
+
+HKDFClass::~HKDFClass()
+{
+  memset(&ctx, 0x00, sizeof(ctx));
+}
+
+int HKDFClass::extract(const br_hash_class *digest, const uint8_t *salt, size_t saltLength, const uint8_t *ikm, size_t ikmLength)
+{
+  if (digest == NULL) {
+    extracted = 0;
+    return 0;
+  }
+
+  if (salt == NULL || saltLength == 0) {
+    br_hkdf_init(&ctx, digest, BR_HKDF_NO_SALT, 0);
+  } else {
+    br_hkdf_init(&ctx, digest, salt, saltLength);
+  }
+  br_hkdf_inject(&ctx, ikm, ikmLength);
+  br_hkdf_flip(&ctx);
+  extracted = 1;
+
+  return 1;
+}
+
+size_t HKDFClass::expand(const uint8_t *info, size_t infoLength, uint8_t *output, size_t length)
+{
+  if (!extracted) {
+    return 0;
+  }
+
+  return br_hkdf_produce(&ctx, info, infoLength, output, length);
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef HKDF_H
+#define HKDF_H
+
+#include <Arduino.h>
+
+#include <bearssl/bearssl_hash.h>
+#include <bearssl/bearssl_kdf.h>
+
+// RFC 5869 key derivation over a bearssl hash vtable, e.g.
+// &br_sha256_vtable:
+//
+//   HKDF.extract(&br_sha256_vtable, salt, sizeof(salt), ikm, sizeof(ikm));
+//   HKDF.expand(info, sizeof(info), okm, sizeof(okm));
+class HKDFClass {
+
+public:
+  HKDFClass();
+  virtual ~HKDFClass();
+
+  // a NULL or empty salt is replaced by HashLen zero bytes
+  int extract(const br_hash_class *digest, const uint8_t *salt, size_t saltLength, const uint8_t *ikm, size_t ikmLength);
+
+  // may be called again with the same info to continue the output,
+  // returns the number of bytes produced (up to 255 * digest size in total)
+  size_t expand(const uint8_t *info, size_t infoLength, uint8_t *output, size_t length);
+
+private:
+  br_hkdf_context ctx;
+  int extracted;
+};
+
+extern HKDFClass HKDF;
+
+#endif
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "HMAC.h"
+
+HMACClass::HMACClass() :
+  keyed(0)
+{
+}
+
+HMACClass::~HMACClass()
+{
+  memset(&key_ctx, 0x00, sizeof(key_ctx));
+  memset(&ctx, 0x00, sizeof(ctx));
+}
+
+int HMACClass::setKey(const br_hash_class *digest, const uint8_t *key, size_t length)
+{
+  if (digest == NULL) {
+    keyed = 0;
+    return 0;
+  }
+
+  br_hmac_key_init(&key_ctx, digest, key, length);
+  keyed = 1;
+
+  return 1;
+}
+
+int HMACClass::begin(size_t outLength)
+{
+  if (!keyed) {
+    return 0;
+  }
+
+  br_hmac_init(&ctx, &key_ctx, outLength);
+
+  return 1;
+}
+
+void HMACClass::update(const uint8_t *data, size_t length)
+{
+  br_hmac_update(&ctx, data, length);
+}
+
+size_t HMACClass::end(uint8_t *mac)
+{
+  return br_hmac_out(&ctx, mac);
+}
+
+size_t HMACClass::mac(const uint8_t *data, size_t length, uint8_t *mac)
+{
+  if (!begin()) {
+    return 0;
+  }
+
+  update(data, length);
+
+  return end(mac);
+}
+
+size_t HMACClass::size()
+{
+  if (!keyed) {
+    return 0;
+  }
+
+  return (br_hmac_key_get_digest(&key_ctx)->desc >> BR_HASHDESC_OUT_OFF) & BR_HASHDESC_OUT_MASK;
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef HMAC_H
+#define HMAC_H
+
+#include <Arduino.h>
+
+#include <bearssl/bearssl_hash.h>
+#include <bearssl/bearssl_hmac.h>
+
+// HMAC over a bearssl hash vtable, e.g. &br_sha256_vtable; compared to
+// SHAClass::beginHmac() the hash is called directly, not through Stream,
+// and no memory is allocated
+class HMACClass {
+
+public:
+  HMACClass();
+  virtual ~HMACClass();
+
+  // the padded key is hashed once here and reused by every begin()
+  int setKey(const br_hash_class *digest, const uint8_t *key, size_t length);
+
+  // outLength truncates the MAC, 0 selects the digest size
+  int begin(size_t outLength = 0);
+  void update(const uint8_t *data, size_t length);
+  // returns the MAC length
+  size_t end(uint8_t *mac);
+
+  // begin(), update() and end() in one call
+  size_t mac(const uint8_t *data, size_t length, uint8_t *mac);
+
+  size_t size();
+
+private:
+  br_hmac_key_context key_ctx;
+  br_hmac_context ctx;
+  int keyed;
+};
+
+extern HMACClass HMAC;
+
+#endif
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "HMACContext.h"
+
+HMACContext::HMACContext(SHAClass& sha) :
+  _sha(&sha),
+  _stateLength(0)
+{
+}
+
+HMACContext::~HMACContext()
+{
+  memset(_inner, 0x00, sizeof(_inner));
+  memset(_outer, 0x00, sizeof(_outer));
+}
+
+int HMACContext::setKey(const String& secret)
+{
+  return setKey((const uint8_t*)secret.c_str(), secret.length());
+}
+
+int HMACContext::setKey(const char* secret)
+{
+  return setKey((const uint8_t*)secret, strlen(secret));
+}
+
+int HMACContext::setKey(const byte secret[], int length)
+{
+  uint8_t digest[HMAC_STATE_SIZE - 8];
+
+  _stateLength = 0;
+
+  if (_sha->digestSize() > (int)sizeof(digest)) {
+    return 0;
+  }
+
+  if (length > _sha->blockSize()) {
+    if (_sha->beginHash() == 0) {
+      return 0;
+    } else if (_sha->write(secret, length) != (size_t)length) {
+      return 0;
+    } else if (_sha->endHash(digest) == 0) {
+      return 0;
+    }
+
+    length = _sha->digestSize();
+    secret = digest;
+  }
+
+  if (!padState(secret, length, 0x36, _inner) || !padState(secret, length, 0x5c, _outer)) {
+    _stateLength = 0;
+    return 0;
+  }
+
+  return 1;
+}
+
+int HMACContext::padState(const byte secret[], int length, uint8_t pad, uint8_t* state)
+{
+  int blockSize = _sha->blockSize();
+  uint8_t block[blockSize];
+
+  memset(block, pad, blockSize);
+
+  for (int i = 0; i < length; i++) {
+    block[i] ^= secret[i];
+  }
+
+  if (_sha->beginHash() == 0) {
+    return 0;
+  }
+
+  if (_sha->write(block, blockSize) != (size_t)blockSize) {
+    return 0;
+  }
+
+  memset(block, 0x00, blockSize);
+  _stateLength = _sha->saveState(state, HMAC_STATE_SIZE);
+
+  return (_stateLength != 0);
+}
+
+int HMACContext::begin()
+{
+  if (_stateLength == 0) {
+    return 0;
+  }
+
+  return _sha->restoreState(_inner, _stateLength);
+}
+
+int HMACContext::end()
+{
+  uint8_t digest[HMAC_STATE_SIZE - 8];
+
+  if (_stateLength == 0 || _sha->endHash(digest) == 0) {
+    return 0;
+  }
+
+  int length = _sha->digestSize();
+
+  if (!_sha->restoreState(_outer, _stateLength)) {
+    return 0;
+  }
+
+  if (_sha->write(digest, length) != (size_t)length) {
+    return 0;
+  }
+
+  return _sha->endHash();
+}
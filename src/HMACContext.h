@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef HMAC_CONTEXT_H
+#define HMAC_CONTEXT_H
+
+#include <Arduino.h>
+
+#include "SHA.h"
+
+// saveState() output at a block boundary: length and chaining value
+#define HMAC_STATE_SIZE (8 + 64)
+
+// HMAC with a fixed key: the inner and outer pad blocks are hashed once
+// by setKey(), each begin()/end() then starts from those midstates, e.g.
+//
+//   HMACContext hmac(SHA256);
+//   hmac.setKey(key, sizeof(key));
+//   hmac.begin();
+//   SHA256.write(data, length);
+//   hmac.end();
+//   SHA256.readBytes(mac, SHA256_DIGEST_SIZE);
+class HMACContext {
+
+public:
+  HMACContext(SHAClass& sha);
+  virtual ~HMACContext();
+
+  int setKey(const String& secret);
+  int setKey(const char* secret);
+  int setKey(const byte secret[], int length);
+
+  // the message is written to the hash object in between, and the MAC
+  // read back from it after end()
+  int begin();
+  int end();
+
+private:
+  int padState(const byte secret[], int length, uint8_t pad, uint8_t* state);
+
+private:
+  SHAClass* _sha;
+  uint8_t _inner[HMAC_STATE_SIZE];
+  uint8_t _outer[HMAC_STATE_SIZE];
+  size_t _stateLength;
+};
+
+#endif
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef HASH_H
+#define HASH_H
+
+#include <Arduino.h>
+
+#include <bearssl/bearssl_hash.h>
+
+// single bytes written to a Hash are collected here and passed to
+// bearssl together
+#ifndef HASH_BUFFER_SIZE
+#define HASH_BUFFER_SIZE 16
+#endif
+
+// maps a bearssl context type to its functions; SHA-224 and SHA-512
+// share the context type of SHA-256 and SHA-384 and have their own
+// traits, see SHA224Hash and SHA512Hash
+template <typename Context> struct HashTraits;
+
+#define HASH_TRAITS(name, context, id, blockSize) \
+  struct name { \
+    enum { BLOCK_SIZE = blockSize, DIGEST_SIZE = br_ ## id ## _SIZE }; \
+    static void init(context *ctx) { br_ ## id ## _init(ctx); } \
+    static void update(context *ctx, const uint8_t *data, size_t length) { br_ ## id ## _update(ctx, data, length); } \
+    static void out(const context *ctx, uint8_t *digest) { br_ ## id ## _out(ctx, digest); } \
+  }
+
+template <> HASH_TRAITS(HashTraits<br_md5_context>, br_md5_context, md5, 64);
+template <> HASH_TRAITS(HashTraits<br_sha1_context>, br_sha1_context, sha1, 64);
+template <> HASH_TRAITS(HashTraits<br_sha256_context>, br_sha256_context, sha256, 64);
+template <> HASH_TRAITS(HashTraits<br_sha384_context>, br_sha384_context, sha384, 128);
+HASH_TRAITS(SHA224HashTraits, br_sha224_context, sha224, 64);
+HASH_TRAITS(SHA512HashTraits, br_sha512_context, sha512, 128);
+
+#undef HASH_TRAITS
+
+// Header-only hash over a bearssl context, e.g. Hash<br_sha256_context>.
+// Unlike SHAClass nothing is virtual below Print::write(), so update()
+// inlines into the caller, and bytes written one at a time (e.g. by
+// print()) are batched before they reach bearssl.
+template <typename Context, typename Traits = HashTraits<Context> >
+class Hash : public Print {
+
+public:
+  enum { BLOCK_SIZE = Traits::BLOCK_SIZE, DIGEST_SIZE = Traits::DIGEST_SIZE };
+
+  Hash() { begin(); }
+
+  void begin()
+  {
+    Traits::init(&_ctx);
+    _length = 0;
+  }
+
+  void update(uint8_t data)
+  {
+    _buffer[_length++] = data;
+
+    if (_length == sizeof(_buffer)) {
+      flushBuffer();
+    }
+  }
+
+  void update(const uint8_t *data, size_t length)
+  {
+    if (length >= sizeof(_buffer) || _length + length >= sizeof(_buffer)) {
+      flushBuffer();
+      Traits::update(&_ctx, data, length);
+      return;
+    }
+
+    while (length--) {
+      _buffer[_length++] = *data++;
+    }
+  }
+
+  // digest gets DIGEST_SIZE bytes, the hash can be continued afterwards
+  void end(uint8_t *digest)
+  {
+    flushBuffer();
+    Traits::out(&_ctx, digest);
+  }
+
+  // Print
+  virtual size_t write(uint8_t data) { update(data); return 1; }
+  virtual size_t write(const uint8_t *buffer, size_t size) { update(buffer, size); return size; }
+  using Print::write;
+
+private:
+  void flushBuffer()
+  {
+    if (_length) {
+      Traits::update(&_ctx, _buffer, _length);
+      _length = 0;
+    }
+  }
+
+private:
+  Context _ctx;
+  uint8_t _buffer[HASH_BUFFER_SIZE];
+  size_t _length;
+};
+
+typedef Hash<br_md5_context> MD5Hash;
+typedef Hash<br_sha1_context> SHA1Hash;
+typedef Hash<br_sha224_context, SHA224HashTraits> SHA224Hash;
+typedef Hash<br_sha256_context> SHA256Hash;
+typedef Hash<br_sha384_context> SHA384Hash;
+typedef Hash<br_sha512_context, SHA512HashTraits> SHA512Hash;
+
+#endif
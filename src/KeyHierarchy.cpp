@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "KeyHierarchy.h"
+
+// prefix of the info the wrapping keys are derived with, the NUL keeps
+// it apart from any label given to derive() as a string
+static const char KEY_HIERARCHY_WRAP_PREFIX[] = "wrap";
+
+KeyHierarchy::KeyHierarchy() :
+  _ready(false)
+{
+}
+
+KeyHierarchy::~KeyHierarchy()
+{
+  end();
+}
+
+int KeyHierarchy::begin(const uint8_t *kek, size_t kekSize, const uint8_t *wrappedMaster, size_t wrappedLength, const uint8_t *salt, size_t saltLength)
+{
+  AESKeyWrapClass kw;
+  uint8_t master[32];
+
+  end();
+
+  if (wrappedLength > sizeof(master) + AESKEYWRAP_OVERHEAD) {
+    return 0;
+  }
+
+  if (!kw.setKey(kek, kekSize) || !kw.unwrap(wrappedMaster, wrappedLength, master)) {
+    return 0;
+  }
+
+  int result = setMaster(master, wrappedLength - AESKEYWRAP_OVERHEAD, salt, saltLength);
+
+  memset(master, 0x00, sizeof(master));
+
+  return result;
+}
+
+int KeyHierarchy::setMaster(const uint8_t *master, size_t masterSize, const uint8_t *salt, size_t saltLength)
+{
+  end();
+
+  if (master == NULL || masterSize == 0) {
+    return 0;
+  }
+
+  if (salt == NULL || saltLength == 0) {
+    br_hkdf_init(&_prk, &br_sha256_vtable, BR_HKDF_NO_SALT, 0);
+  } else {
+    br_hkdf_init(&_prk, &br_sha256_vtable, salt, saltLength);
+  }
+  br_hkdf_inject(&_prk, master, masterSize);
+  br_hkdf_flip(&_prk);
+  _ready = true;
+
+  return 1;
+}
+
+void KeyHierarchy::end()
+{
+  memset(&_prk, 0x00, sizeof(_prk));
+  _ready = false;
+}
+
+bool KeyHierarchy::ready()
+{
+  return _ready;
+}
+
+int KeyHierarchy::derive(const char *label, uint8_t *key, size_t length)
+{
+  return derive((const uint8_t *)label, strlen(label), key, length);
+}
+
+int KeyHierarchy::derive(const uint8_t *info, size_t infoLength, uint8_t *key, size_t length)
+{
+  if (!_ready || length == 0 || length > 255 * br_sha256_SIZE) {
+    return 0;
+  }
+
+  // expand from a copy, the flipped context is the pseudorandom key
+  br_hkdf_context hc = _prk;
+
+  br_hkdf_produce(&hc, info, infoLength, key, length);
+  memset(&hc, 0x00, sizeof(hc));
+
+  return 1;
+}
+
+int KeyHierarchy::wrap(const char *label, const uint8_t *key, size_t length, uint8_t *wrapped)
+{
+  AESKeyWrapClass kw;
+
+  if (!wrappingKey(label, kw)) {
+    return 0;
+  }
+
+  return kw.wrap(key, length, wrapped);
+}
+
+int KeyHierarchy::unwrap(const char *label, const uint8_t *wrapped, size_t wrappedLength, uint8_t *key)
+{
+  AESKeyWrapClass kw;
+
+  if (!wrappingKey(label, kw)) {
+    return 0;
+  }
+
+  return kw.unwrap(wrapped, wrappedLength, key);
+}
+
+int KeyHierarchy::wrappingKey(const char *label, AESKeyWrapClass &kw)
+{
+  uint8_t info[sizeof(KEY_HIERARCHY_WRAP_PREFIX) + KEY_HIERARCHY_MAX_LABEL_SIZE];
+  uint8_t kek[32];
+  size_t labelLength = strlen(label);
+
+  if (labelLength > KEY_HIERARCHY_MAX_LABEL_SIZE) {
+    return 0;
+  }
+
+  memcpy(info, KEY_HIERARCHY_WRAP_PREFIX, sizeof(KEY_HIERARCHY_WRAP_PREFIX));
+  memcpy(info + sizeof(KEY_HIERARCHY_WRAP_PREFIX), label, labelLength);
+
+  int result = derive(info, sizeof(KEY_HIERARCHY_WRAP_PREFIX) + labelLength, kek, sizeof(kek)) && kw.setKey(kek, sizeof(kek));
+
+  memset(kek, 0x00, sizeof(kek));
+
+  return result;
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef KEY_HIERARCHY_H
+#define KEY_HIERARCHY_H
+
+#include <Arduino.h>
+
+#include <bearssl/bearssl_kdf.h>
+
+#include "AESKeyWrap.h"
+
+// longest label wrap() and unwrap() accept
+#ifndef KEY_HIERARCHY_MAX_LABEL_SIZE
+#define KEY_HIERARCHY_MAX_LABEL_SIZE 32
+#endif
+
+// Per-service keys under one master key. Only the master key is stored,
+// wrapped (RFC 3394) with a device key, and only it is unwrapped at boot;
+// begin() turns it into an HKDF-SHA256 pseudorandom key and clears it.
+// Each service key is then expanded from that, with the service label
+// as info, when it is first needed, and can be cleared right after use:
+//
+//   KeyHierarchy keys;
+//   keys.begin(deviceKey, 16, wrappedMaster, sizeof(wrappedMaster));
+//   ...
+//   uint8_t mqttKey[16];
+//   keys.derive("mqtt", mqttKey, sizeof(mqttKey));
+//
+// Keys that cannot be derived, e.g. handed out by a server, are stored
+// wrapped under a key derived for their label instead, see wrap().
+class KeyHierarchy {
+
+public:
+  KeyHierarchy();
+  virtual ~KeyHierarchy();
+
+  // unwraps the master key with kek, see AESKeyWrapClass::unwrap();
+  // the salt, e.g. a device serial number, is optional
+  int begin(const uint8_t *kek, size_t kekSize, const uint8_t *wrappedMaster, size_t wrappedLength, const uint8_t *salt = NULL, size_t saltLength = 0);
+  // same with a master key already in the clear, e.g. read from a
+  // secure element
+  int setMaster(const uint8_t *master, size_t masterSize, const uint8_t *salt = NULL, size_t saltLength = 0);
+  // clears the pseudorandom key
+  void end();
+  bool ready();
+
+  // up to 255 * 32 bytes of key for label; the same label always gives
+  // the same key, nothing is kept between calls
+  int derive(const char *label, uint8_t *key, size_t length);
+  int derive(const uint8_t *info, size_t infoLength, uint8_t *key, size_t length);
+
+  // wraps length bytes of key (a multiple of 8, at least 16) into
+  // length + AESKEYWRAP_OVERHEAD bytes, under an AES-256 key derived
+  // for label that derive() with a string label never produces
+  int wrap(const char *label, const uint8_t *key, size_t length, uint8_t *wrapped);
+  int unwrap(const char *label, const uint8_t *wrapped, size_t wrappedLength, uint8_t *key);
+
+private:
+  int wrappingKey(const char *label, AESKeyWrapClass &kw);
+
+  br_hkdf_context _prk;
+  bool _ready;
+};
+
+#endif
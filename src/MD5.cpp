@@ -54,6 +54,21 @@ int MD5Class::end(uint8_t *digest)
   return 1;
 }
 
-#ifndef ARDUINO_ARCH_MEGAAVR
-MD5Class MD5;
-#endif
\ No newline at end of file
+int MD5Class::state(uint8_t *value, uint64_t *count)
+{
+  *count = br_md5_state(&_ctx, value);
+  memcpy(value + MD5_DIGEST_SIZE, _ctx.buf, *count % MD5_BLOCK_SIZE);
+
+  return 1;
+}
+
+int MD5Class::setState(const uint8_t *value, uint64_t count)
+{
+  size_t buffered = count % MD5_BLOCK_SIZE;
+
+  br_md5_init(&_ctx);
+  br_md5_set_state(&_ctx, value, count - buffered);
+  br_md5_update(&_ctx, value + MD5_DIGEST_SIZE, buffered);
+
+  return 1;
+}
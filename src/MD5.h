@@ -42,6 +42,8 @@ protected:
   virtual int begin();
   virtual int update(const uint8_t *buffer, size_t size);
   virtual int end(uint8_t *digest);
+  virtual int state(uint8_t *value, uint64_t *count);
+  virtual int setState(const uint8_t *value, uint64_t count);
 
 private:
   br_md5_context _ctx;
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "MerkleVerifier.h"
+
+MerkleVerifier::MerkleVerifier()
+{
+}
+
+MerkleVerifier::~MerkleVerifier()
+{
+}
+
+int MerkleVerifier::hashChunks(const uint8_t* const chunks[], size_t count, size_t length, uint8_t digests[][MERKLE_DIGEST_SIZE])
+{
+  if (count == 0) {
+    return 0;
+  }
+
+  br_sha256_multi(digests, (const void* const*)chunks, count, length);
+
+  return 1;
+}
+
+int MerkleVerifier::verifyChunks(const uint8_t* const chunks[], size_t count, size_t length, const uint8_t expected[][MERKLE_DIGEST_SIZE])
+{
+  uint8_t digests[MERKLE_BATCH_SIZE][MERKLE_DIGEST_SIZE];
+
+  if (count == 0) {
+    return 0;
+  }
+
+  while (count > 0) {
+    size_t batch = count < MERKLE_BATCH_SIZE ? count : MERKLE_BATCH_SIZE;
+
+    br_sha256_multi(digests, (const void* const*)chunks, batch, length);
+
+    if (memcmp(digests, expected, batch * MERKLE_DIGEST_SIZE) != 0) {
+      return 0;
+    }
+
+    chunks += batch;
+    expected += batch;
+    count -= batch;
+  }
+
+  return 1;
+}
+
+int MerkleVerifier::computeRoot(uint8_t nodes[][MERKLE_DIGEST_SIZE], size_t count, uint8_t root[MERKLE_DIGEST_SIZE])
+{
+  uint8_t digests[MERKLE_BATCH_SIZE][MERKLE_DIGEST_SIZE];
+  const void* pairs[MERKLE_BATCH_SIZE];
+
+  if (count == 0) {
+    return 0;
+  }
+
+  while (count > 1) {
+    size_t parents = count / 2;
+
+    // the pairs of a level are adjacent in nodes: 64-byte messages
+    for (size_t i = 0; i < parents; i += MERKLE_BATCH_SIZE) {
+      size_t batch = parents - i < MERKLE_BATCH_SIZE ? parents - i : MERKLE_BATCH_SIZE;
+
+      for (size_t j = 0; j < batch; j++) {
+        pairs[j] = nodes[2 * (i + j)];
+      }
+
+      br_sha256_multi(digests, pairs, batch, 2 * MERKLE_DIGEST_SIZE);
+      memcpy(nodes[i], digests, batch * MERKLE_DIGEST_SIZE);
+    }
+
+    if (count & 1) {
+      memmove(nodes[parents], nodes[count - 1], MERKLE_DIGEST_SIZE);
+      parents++;
+    }
+
+    count = parents;
+  }
+
+  memcpy(root, nodes[0], MERKLE_DIGEST_SIZE);
+
+  return 1;
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MERKLE_VERIFIER_H
+#define MERKLE_VERIFIER_H
+
+#include <Arduino.h>
+
+#include <bearssl/bearssl_hash.h>
+
+#define MERKLE_DIGEST_SIZE 32
+
+// chunks hashed per br_sha256_multi() call, a multiple of 4 keeps the
+// SSE2 lanes full
+#ifndef MERKLE_BATCH_SIZE
+#define MERKLE_BATCH_SIZE 8
+#endif
+
+// SHA-256 Merkle tree over fixed-size chunks: leaves are the chunk
+// digests, a parent is the digest of its two children concatenated and
+// an odd node at the end of a level moves up unchanged. Equal-length
+// messages are hashed together with br_sha256_multi(), which runs them
+// in parallel where the CPU allows and in sequence otherwise.
+class MerkleVerifier {
+
+public:
+  MerkleVerifier();
+  virtual ~MerkleVerifier();
+
+  // chunks all have length bytes, digests gets one leaf per chunk
+  int hashChunks(const uint8_t* const chunks[], size_t count, size_t length, uint8_t digests[][MERKLE_DIGEST_SIZE]);
+
+  // 1 if every chunk hashes to its expected leaf
+  int verifyChunks(const uint8_t* const chunks[], size_t count, size_t length, const uint8_t expected[][MERKLE_DIGEST_SIZE]);
+
+  // reduces count leaves to the root, nodes is overwritten
+  int computeRoot(uint8_t nodes[][MERKLE_DIGEST_SIZE], size_t count, uint8_t root[MERKLE_DIGEST_SIZE]);
+};
+
+#endif
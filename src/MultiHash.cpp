@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "MultiHash.h"
+
+static const br_hash_class* const MULTIHASH_IMPLS[] = {
+  NULL,
+  &br_md5_vtable,
+  &br_sha1_vtable,
+  &br_sha224_vtable,
+  &br_sha256_vtable,
+  &br_sha384_vtable,
+  &br_sha512_vtable
+};
+
+MultiHashClass::MultiHashClass() :
+  _digests(0),
+  _digestIndex(0),
+  _digestLength(0)
+{
+  br_multihash_zero(&_ctx);
+}
+
+MultiHashClass::~MultiHashClass()
+{
+}
+
+int MultiHashClass::beginHash(int digests)
+{
+  _digestIndex = 0;
+  _digestLength = 0;
+
+  if (digests == 0 || (digests & ~0x7e) != 0) {
+    _digests = 0;
+    return 0;
+  }
+
+  br_multihash_zero(&_ctx);
+
+  for (int id = br_md5_ID; id <= br_sha512_ID; id++) {
+    if (digests & (1 << id)) {
+      br_multihash_setimpl(&_ctx, id, MULTIHASH_IMPLS[id]);
+    }
+  }
+
+  br_multihash_init(&_ctx);
+  _digests = digests;
+
+  return 1;
+}
+
+int MultiHashClass::endHash()
+{
+  if (_digests == 0) {
+    return 0;
+  }
+
+  _digestIndex = 0;
+  _digestLength = 0;
+
+  for (int id = br_md5_ID; id <= br_sha512_ID; id++) {
+    if (_digests & (1 << id)) {
+      _digestLength += br_multihash_out(&_ctx, id, _digest + _digestLength);
+    }
+  }
+
+  return 1;
+}
+
+size_t MultiHashClass::getDigest(int digest, uint8_t *output)
+{
+  size_t offset = 0;
+
+  if ((digest & _digests) == 0 || (digest & (digest - 1)) != 0 || _digestLength == 0) {
+    return 0;
+  }
+
+  // digests are stored in ID order, skip the ones before this one
+  for (int id = br_md5_ID; id <= br_sha512_ID; id++) {
+    if ((1 << id) == digest) {
+      size_t size = (MULTIHASH_IMPLS[id]->desc >> BR_HASHDESC_OUT_OFF) & BR_HASHDESC_OUT_MASK;
+
+      memcpy(output, _digest + offset, size);
+      return size;
+    }
+
+    if (_digests & (1 << id)) {
+      offset += (MULTIHASH_IMPLS[id]->desc >> BR_HASHDESC_OUT_OFF) & BR_HASHDESC_OUT_MASK;
+    }
+  }
+
+  return 0;
+}
+
+int MultiHashClass::available()
+{
+  return (_digestLength - _digestIndex);
+}
+
+int MultiHashClass::read()
+{
+  if (!available()) {
+    return -1;
+  }
+
+  return _digest[_digestIndex++];
+}
+
+size_t MultiHashClass::readBytes(char *buffer, size_t length)
+{
+  int toCopy = available();
+
+  if (toCopy > (int)length) {
+    toCopy = length;
+  }
+
+  memcpy(buffer, _digest + _digestIndex, toCopy);
+  _digestIndex += toCopy;
+
+  return toCopy;
+}
+
+int MultiHashClass::peek()
+{
+  if (!available()) {
+    return -1;
+  }
+
+  return _digest[_digestIndex];
+}
+
+void MultiHashClass::flush()
+{
+  // no-op
+}
+
+size_t MultiHashClass::write(uint8_t data)
+{
+  return write(&data, sizeof(data));
+}
+
+size_t MultiHashClass::write(const uint8_t *buffer, size_t size)
+{
+  if (_digests == 0) {
+    setWriteError();
+    return 0;
+  }
+
+  br_multihash_update(&_ctx, buffer, size);
+
+  return size;
+}
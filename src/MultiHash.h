@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MULTI_HASH_H
+#define MULTI_HASH_H
+
+#include <Arduino.h>
+
+#include <bearssl/bearssl_hash.h>
+
+#define MULTIHASH_MD5    (1 << br_md5_ID)
+#define MULTIHASH_SHA1   (1 << br_sha1_ID)
+#define MULTIHASH_SHA224 (1 << br_sha224_ID)
+#define MULTIHASH_SHA256 (1 << br_sha256_ID)
+#define MULTIHASH_SHA384 (1 << br_sha384_ID)
+#define MULTIHASH_SHA512 (1 << br_sha512_ID)
+
+// all digests together, see read()
+#define MULTIHASH_MAX_SIZE (16 + 20 + 28 + 32 + 48 + 64)
+
+// Several digests of the same data in one pass, e.g.
+//
+//   MultiHash.beginHash(MULTIHASH_MD5 | MULTIHASH_SHA1 | MULTIHASH_SHA256);
+//   while (file.available()) {
+//     MultiHash.write(buffer, file.read(buffer, sizeof(buffer)));
+//   }
+//   MultiHash.endHash();
+//   MultiHash.getDigest(MULTIHASH_SHA256, sha256);
+class MultiHashClass : public Stream {
+
+public:
+  MultiHashClass();
+  virtual ~MultiHashClass();
+
+  // digests is a mask of MULTIHASH_* values
+  int beginHash(int digests = MULTIHASH_MD5 | MULTIHASH_SHA1 | MULTIHASH_SHA256);
+  int endHash();
+
+  // copies one selected digest after endHash(), returns its size or 0
+  size_t getDigest(int digest, uint8_t *output);
+
+  // Stream, reads the selected digests concatenated, MD5 first
+  virtual int available();
+  virtual int read();
+  virtual int peek();
+  virtual void flush();
+
+  // Print
+  virtual size_t write(uint8_t data);
+  virtual size_t write(const uint8_t *buffer, size_t size);
+
+  size_t readBytes(char* buffer, size_t length);
+  size_t readBytes(uint8_t* buffer, size_t length) { return readBytes((char *)buffer, length); }
+
+private:
+  br_multihash_context _ctx;
+  int _digests;
+
+  uint8_t _digest[MULTIHASH_MAX_SIZE];
+  int _digestIndex;
+  int _digestLength;
+};
+
+extern MultiHashClass MultiHash;
+
+#endif
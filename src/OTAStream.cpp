@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "OTAStream.h"
+
+OTAStream::OTAStream() :
+  _storage(NULL),
+  _verifier(NULL),
+  _checkHash(false),
+  _failed(false),
+  _length(0),
+  _transferred(0)
+{
+  br_sha256_init(&_hash);
+}
+
+OTAStream::~OTAStream()
+{
+}
+
+int OTAStream::begin(Print& storage, size_t length)
+{
+  _storage = &storage;
+  _verifier = NULL;
+  _checkHash = false;
+  _failed = false;
+  _length = length;
+  _transferred = 0;
+  br_sha256_init(&_hash);
+
+  return 1;
+}
+
+void OTAStream::setExpectedHash(const uint8_t hash[32])
+{
+  memcpy(_expectedHash, hash, sizeof(_expectedHash));
+  _checkHash = true;
+}
+
+void OTAStream::setVerifier(SignatureVerifier* verifier)
+{
+  _verifier = verifier;
+}
+
+int OTAStream::transfer(BearSSLClient& client, unsigned long timeout)
+{
+  unsigned long last = millis();
+
+  while (_length == 0 || _transferred < _length) {
+    size_t length;
+    const uint8_t* data = client.peekBuffer(length);
+
+    if (data == NULL) {
+      if (!client.connected()) {
+        return (_length == 0 && !_failed);
+      }
+
+      if (timeout && (millis() - last) >= timeout) {
+        return 0;
+      }
+
+      continue;
+    }
+
+    if (_length && length > _length - _transferred) {
+      length = _length - _transferred;
+    }
+
+    if (write(data, length) != length) {
+      return 0;
+    }
+
+    client.consume(length);
+    last = millis();
+  }
+
+  return !_failed;
+}
+
+int OTAStream::end(const uint8_t* signature, size_t length)
+{
+  int result = !_failed && _storage != NULL && (_length == 0 || _transferred == _length);
+
+  if (_checkHash) {
+    uint8_t hash[32];
+    uint8_t diff = 0;
+
+    digest(hash);
+    for (size_t i = 0; i < sizeof(hash); i++) {
+      diff |= hash[i] ^ _expectedHash[i];
+    }
+
+    if (diff != 0) {
+      result = 0;
+    }
+  }
+
+  // always ended, so that the verifier can be started again
+  if (_verifier && !_verifier->end(signature, length)) {
+    result = 0;
+  }
+
+  _storage = NULL;
+  _verifier = NULL;
+
+  return result;
+}
+
+size_t OTAStream::transferred()
+{
+  return _transferred;
+}
+
+void OTAStream::digest(uint8_t hash[32])
+{
+  br_sha256_out(&_hash, hash);
+}
+
+size_t OTAStream::write(uint8_t data)
+{
+  return write(&data, sizeof(data));
+}
+
+size_t OTAStream::write(const uint8_t* buffer, size_t size)
+{
+  if (_storage == NULL || _failed) {
+    setWriteError();
+    return 0;
+  }
+
+  size_t written = _storage->write(buffer, size);
+
+  // only what reached the storage counts
+  br_sha256_update(&_hash, buffer, written);
+  if (_verifier) {
+    _verifier->write(buffer, written);
+  }
+  _transferred += written;
+
+  if (written != size) {
+    _failed = true;
+    setWriteError();
+  }
+
+  return written;
+}
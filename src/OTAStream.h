@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef OTA_STREAM_H
+#define OTA_STREAM_H
+
+#include <Arduino.h>
+
+#include "bearssl/bearssl.h"
+
+#include "BearSSLClient.h"
+#include "SignatureVerifier.h"
+
+// Writes a firmware image to storage as it is decrypted, in one pass: the
+// plaintext of each record is taken from the client's buffer (see
+// BearSSLClient::peekBuffer()), written to storage (e.g. a Print over the
+// inactive flash bank) and hashed on the way, before the record is
+// released. Nothing is buffered in between.
+//
+//   ota.begin(storage, contentLength);
+//   ota.setExpectedHash(sha256);       // and/or ota.setVerifier(&verifier)
+//   if (ota.transfer(sslClient) && ota.end(signature, signatureLength)) ...
+//
+// storage and the verifier must stay valid until end()
+class OTAStream : public Print {
+
+public:
+  OTAStream();
+  virtual ~OTAStream();
+
+  // length bytes are expected, 0 reads until the connection is closed
+  int begin(Print& storage, size_t length = 0);
+
+  // SHA-256 the image must have
+  void setExpectedHash(const uint8_t hash[32]);
+  // verifier started with beginEcdsa() or beginRsa(), for a signature
+  // over the image
+  void setVerifier(SignatureVerifier* verifier);
+
+  // writes what the client receives until the image is complete, returns
+  // 0 if storage fails, the connection is closed early or nothing
+  // arrives for timeout milliseconds (0 waits forever)
+  int transfer(BearSSLClient& client, unsigned long timeout = 10000);
+
+  // 1 if the whole image was written and matches the expected hash and
+  // the signature (where set), the latter is ignored without a verifier
+  int end(const uint8_t* signature = NULL, size_t length = 0);
+
+  size_t transferred();
+  // SHA-256 of what was written so far
+  void digest(uint8_t hash[32]);
+
+  // Print, for images that come from elsewhere
+  virtual size_t write(uint8_t data);
+  virtual size_t write(const uint8_t* buffer, size_t size);
+  using Print::write;
+
+private:
+  Print* _storage;
+  SignatureVerifier* _verifier;
+  br_sha256_context _hash;
+  uint8_t _expectedHash[32];
+  bool _checkHash;
+  bool _failed;
+  size_t _length;
+  size_t _transferred;
+};
+
+#endif
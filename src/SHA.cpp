@@ -24,17 +24,28 @@
 
 #include "SHA.h"
 
-SHAClass::SHAClass(int blockSize, int digestSize) :
+#if defined(ARDUINO_ARCH_ESP32)
+#if __has_include(<spi_flash_mmap.h>)
+#include <spi_flash_mmap.h>
+#else
+#include <esp_spi_flash.h>
+#endif
+#endif
+
+SHAClass::SHAClass(int blockSize, int digestSize, int stateSize) :
   _blockSize(blockSize),
   _digestSize(digestSize),
-  _digestIndex(digestSize)
+  _stateSize(stateSize ? stateSize : digestSize),
+  _digest(NULL),
+  _digestIndex(digestSize),
+  _secret(NULL),
+  _secretLength(0)
 {
-  _digest = (uint8_t*)malloc(_digestSize);
-  _secret = (uint8_t*)malloc(_blockSize);
 }
 
 SHAClass::~SHAClass()
 {
+#ifndef BEARSSL_NO_HEAP
   if (_secret) {
     free(_secret);
     _secret = NULL;
@@ -44,6 +55,7 @@ SHAClass::~SHAClass()
     free(_digest);
     _digest = NULL;
   }
+#endif
 }
 
 int SHAClass::beginHash()
@@ -55,13 +67,22 @@ int SHAClass::beginHash()
 
 int SHAClass::endHash()
 {
-  if (end(_digest) == 0) {
-    _digestIndex = _digestSize;
+  _digestIndex = _digestSize;
+
+  if (!allocDigest() || end(_digest) == 0) {
     return 0;
-  } else {
-    _digestIndex = 0;
-    return 1;
   }
+
+  _digestIndex = 0;
+
+  return 1;
+}
+
+int SHAClass::endHash(uint8_t *digest)
+{
+  _digestIndex = _digestSize;
+
+  return end(digest);
 }
 
 int SHAClass::beginHmac(const String& secret)
@@ -76,16 +97,30 @@ int SHAClass::beginHmac(const char* secret)
 
 int SHAClass::beginHmac(const byte secret[], int length)
 {
+  uint8_t digest[SHA_DIGEST_MAX_SIZE];
+
+  if (_secret == NULL) {
+#ifdef BEARSSL_NO_HEAP
+    _secret = _secretBuffer;
+#else
+    _secret = (uint8_t*)malloc(_blockSize);
+#endif
+
+    if (_secret == NULL) {
+      return 0;
+    }
+  }
+
   if (length > _blockSize) {
     if (beginHash() == 0) {
       return 0;
     } else if (write(secret, length) != (size_t)length) {
       return 0;
-    } else if (endHash() == 0) {
+    } else if (endHash(digest) == 0) {
       return 0;
     }
-    secret = _digest;
-    _secretLength = _digestSize;;
+    secret = digest;
+    _secretLength = _digestSize;
   } else {
     _secretLength = length;
   }
@@ -109,7 +144,22 @@ int SHAClass::beginHmac(const byte secret[], int length)
 
 int SHAClass::endHmac()
 {
-  if (endHash() == 0) {
+  _digestIndex = _digestSize;
+
+  if (!allocDigest() || endHmac(_digest) == 0) {
+    return 0;
+  }
+
+  _digestIndex = 0;
+
+  return 1;
+}
+
+int SHAClass::endHmac(uint8_t *digest)
+{
+  uint8_t inner[SHA_DIGEST_MAX_SIZE];
+
+  if (_secret == NULL || endHash(inner) == 0) {
     return 0;
   }
 
@@ -128,11 +178,151 @@ int SHAClass::endHmac()
     return 0;
   }
 
-  if (write(_digest, _digestSize) != (size_t)_digestSize) {
+  if (write(inner, _digestSize) != (size_t)_digestSize) {
+    return 0;
+  }
+
+  return endHash(digest);
+}
+
+bool SHAClass::verifyHmac(const uint8_t* expected, size_t length)
+{
+  uint8_t diff = 0;
+
+  if (available() != _digestSize || length == 0 || length > (size_t)_digestSize) {
+    return false;
+  }
+
+  for (size_t i = 0; i < length; i++) {
+    diff |= _digest[i] ^ expected[i];
+  }
+  _digestIndex = _digestSize;
+
+  return (diff == 0);
+}
+
+size_t SHAClass::saveState(uint8_t *state, size_t size)
+{
+  uint8_t value[SHA_STATE_MAX_SIZE];
+  uint64_t count;
+
+  if (this->state(value, &count) == 0) {
+    return 0;
+  }
+
+  size_t valueLength = _stateSize + (size_t)(count % _blockSize);
+
+  if (size < 8 + valueLength) {
+    return 0;
+  }
+
+  for (int i = 0; i < 8; i++) {
+    state[i] = count >> (56 - 8 * i);
+  }
+  memcpy(state + 8, value, valueLength);
+
+  return 8 + valueLength;
+}
+
+int SHAClass::restoreState(const uint8_t *state, size_t size)
+{
+  uint64_t count = 0;
+
+  if (size < 8) {
+    return 0;
+  }
+
+  for (int i = 0; i < 8; i++) {
+    count = (count << 8) | state[i];
+  }
+
+  if (size != 8 + _stateSize + (size_t)(count % _blockSize)) {
     return 0;
   }
 
-  return endHash();
+  _digestIndex = _digestSize;
+
+  return setState(state + 8, count);
+}
+
+int SHAClass::hashFlashRegion(uint32_t address, size_t length)
+{
+#if defined(ARDUINO_ARCH_ESP32)
+  // flash is mapped by the MMU, one 64 KB page at a time
+  while (length > 0) {
+    uint32_t page = address & ~(uint32_t)(SPI_FLASH_MMU_PAGE_SIZE - 1);
+    size_t offset = address - page;
+    size_t chunk = SPI_FLASH_MMU_PAGE_SIZE - offset;
+    const void* mapped;
+    spi_flash_mmap_handle_t handle;
+
+    if (chunk > length) {
+      chunk = length;
+    }
+
+    if (spi_flash_mmap(page, SPI_FLASH_MMU_PAGE_SIZE, SPI_FLASH_MMAP_DATA, &mapped, &handle) != ESP_OK) {
+      return 0;
+    }
+
+    int result = update((const uint8_t*)mapped + offset, chunk);
+
+    spi_flash_munmap(handle);
+
+    if (result == 0) {
+      return 0;
+    }
+
+    address += chunk;
+    length -= chunk;
+  }
+
+  return 1;
+#elif defined(__AVR__)
+  // program memory is a separate address space
+  uint8_t buffer[32];
+
+  while (length > 0) {
+    size_t chunk = length < sizeof(buffer) ? length : sizeof(buffer);
+
+    memcpy_P(buffer, (const void*)(uintptr_t)address, chunk);
+
+    if (update(buffer, chunk) == 0) {
+      return 0;
+    }
+
+    address += chunk;
+    length -= chunk;
+  }
+
+  return 1;
+#else
+  // flash is in the CPU address space
+  return update((const uint8_t*)(uintptr_t)address, length);
+#endif
+}
+
+int SHAClass::allocDigest()
+{
+  // only needed to read the digest back through Stream
+  if (_digest == NULL) {
+#ifdef BEARSSL_NO_HEAP
+    _digest = _digestBuffer;
+#else
+    _digest = (uint8_t*)malloc(_digestSize);
+#endif
+  }
+
+  return (_digest != NULL);
+}
+
+int SHAClass::blockSize()
+{
+  return _blockSize;
+}
+
+int SHAClass::digestSize()
+{
+  return _digestSize;
 }
 
 int SHAClass::available()
@@ -27,19 +27,54 @@
 
 #include <Arduino.h>
 
+#include "BearSSLConfig.h"
+
+// largest saveState() output: total length, chaining value and up to a
+// block of buffered input
+#define SHA_STATE_MAX_SIZE (8 + 64 + 128)
+
+#define SHA_DIGEST_MAX_SIZE 64
+#define SHA_BLOCK_MAX_SIZE 128
+
 class SHAClass : public Stream {
 
 public:
-  SHAClass(int blockSize, int digestSize);
+  // stateSize is the chaining value size, 0 if it is the digest size
+  SHAClass(int blockSize, int digestSize, int stateSize = 0);
   virtual ~SHAClass();
 
   int beginHash();
   int endHash();
+  // writes digestSize() bytes to digest instead of the Stream buffer;
+  // as long as only these are used, the object allocates no memory
+  // (with BEARSSL_NO_HEAP it never does, both buffers are members)
+  int endHash(uint8_t *digest);
 
+  // the padded key block is allocated on the first beginHmac()
   int beginHmac(const String& secret);
   int beginHmac(const char* secret);
   int beginHmac(const byte secret[], int length);
   int endHmac();
+  int endHmac(uint8_t *digest);
+
+  // compares the first length bytes of the MAC computed by endHmac()
+  // with expected in constant time, instead of reading it out; the
+  // digest is consumed either way
+  bool verifyHmac(const uint8_t* expected, size_t length);
+
+  // running state of the current hash, to continue it later (e.g. after
+  // deep sleep) with restoreState(), write() and endHash(); saveState()
+  // returns the number of bytes stored, or 0 if size is too small
+  size_t saveState(uint8_t *state, size_t size);
+  int restoreState(const uint8_t *state, size_t size);
+
+  // hashes length bytes of flash at address into the current hash,
+  // reading the memory-mapped flash in place where the board has it
+  // (with BR_SHA_HW the blocks then go to the peripheral by DMA)
+  int hashFlashRegion(uint32_t address, size_t length);
+
+  int blockSize();
+  int digestSize();
 
   // Stream
   virtual int available();
@@ -59,14 +94,28 @@ protected:
   virtual int update(const uint8_t *buffer, size_t size) = 0;
   virtual int end(uint8_t *digest) = 0;
 
+  // chaining value (state size) followed by the count % block size
+  // buffered bytes, and the total length hashed so far
+  virtual int state(uint8_t* /*value*/, uint64_t* /*count*/) { return 0; }
+  virtual int setState(const uint8_t* /*value*/, uint64_t /*count*/) { return 0; }
+
+private:
+  int allocDigest();
+
 private:
   int _blockSize;
   int _digestSize;
+  int _stateSize;
 
   uint8_t* _digest;
   int _digestIndex;
   uint8_t* _secret;
   int _secretLength;
+
+#ifdef BEARSSL_NO_HEAP
+  uint8_t _digestBuffer[SHA_DIGEST_MAX_SIZE];
+  uint8_t _secretBuffer[SHA_BLOCK_MAX_SIZE];
+#endif
 };
 
 #endif
@@ -54,4 +54,21 @@ int SHA1Class::end(uint8_t *digest)
   return 1;
 }
 
-SHA1Class SHA1;
+int SHA1Class::state(uint8_t *value, uint64_t *count)
+{
+  *count = br_sha1_state(&_ctx, value);
+  memcpy(value + SHA1_DIGEST_SIZE, _ctx.buf, *count % SHA1_BLOCK_SIZE);
+
+  return 1;
+}
+
+int SHA1Class::setState(const uint8_t *value, uint64_t count)
+{
+  size_t buffered = count % SHA1_BLOCK_SIZE;
+
+  br_sha1_init(&_ctx);
+  br_sha1_set_state(&_ctx, value, count - buffered);
+  br_sha1_update(&_ctx, value + SHA1_DIGEST_SIZE, buffered);
+
+  return 1;
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "SHA224.h"
+
+SHA224Class::SHA224Class() :
+  SHAClass(SHA224_BLOCK_SIZE, SHA224_DIGEST_SIZE, SHA224_STATE_SIZE)
+{
+}
+
+SHA224Class::~SHA224Class()
+{
+}
+
+int SHA224Class::begin()
+{
+  br_sha224_init(&_ctx);
+
+  return 1;
+}
+
+int SHA224Class::update(const uint8_t *buffer, size_t size)
+{
+  br_sha224_update(&_ctx, buffer, size);
+
+  return 1;
+}
+
+int SHA224Class::end(uint8_t *digest)
+{
+  br_sha224_out(&_ctx, digest);
+
+  return 1;
+}
+
+int SHA224Class::state(uint8_t *value, uint64_t *count)
+{
+  *count = br_sha224_state(&_ctx, value);
+  memcpy(value + SHA224_STATE_SIZE, _ctx.buf, *count % SHA224_BLOCK_SIZE);
+
+  return 1;
+}
+
+int SHA224Class::setState(const uint8_t *value, uint64_t count)
+{
+  size_t buffered = count % SHA224_BLOCK_SIZE;
+
+  br_sha224_init(&_ctx);
+  br_sha224_set_state(&_ctx, value, count - buffered);
+  br_sha224_update(&_ctx, value + SHA224_STATE_SIZE, buffered);
+
+  return 1;
+}
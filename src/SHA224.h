@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHA224_H
+#define SHA224_H
+
+#include <bearssl/bearssl_hash.h>
+
+#include "SHA.h"
+
+#define SHA224_BLOCK_SIZE 64
+#define SHA224_DIGEST_SIZE 28
+#define SHA224_STATE_SIZE 32
+
+class SHA224Class: public SHAClass {
+
+public:
+  SHA224Class();
+  virtual ~SHA224Class();
+
+protected:
+  virtual int begin();
+  virtual int update(const uint8_t *buffer, size_t size);
+  virtual int end(uint8_t *digest);
+  virtual int state(uint8_t *value, uint64_t *count);
+  virtual int setState(const uint8_t *value, uint64_t count);
+
+private:
+  br_sha224_context _ctx;
+};
+
+extern SHA224Class SHA224;
+
+#endif
@@ -54,6 +54,21 @@ int SHA256Class::end(uint8_t *digest)
   return 1;
 }
 
-#ifndef ARDUINO_ARCH_MEGAAVR
-SHA256Class SHA256;
-#endif
+int SHA256Class::state(uint8_t *value, uint64_t *count)
+{
+  *count = br_sha256_state(&_ctx, value);
+  memcpy(value + SHA256_DIGEST_SIZE, _ctx.buf, *count % SHA256_BLOCK_SIZE);
+
+  return 1;
+}
+
+int SHA256Class::setState(const uint8_t *value, uint64_t count)
+{
+  size_t buffered = count % SHA256_BLOCK_SIZE;
+
+  br_sha256_init(&_ctx);
+  br_sha256_set_state(&_ctx, value, count - buffered);
+  br_sha256_update(&_ctx, value + SHA256_DIGEST_SIZE, buffered);
+
+  return 1;
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHA384_H
+#define SHA384_H
+
+#include <bearssl/bearssl_hash.h>
+
+#include "BearSSLConfig.h"
+#include "SHA.h"
+
+#define SHA384_BLOCK_SIZE 128
+#define SHA384_DIGEST_SIZE 48
+#define SHA384_STATE_SIZE 64
+
+class SHA384Class: public SHAClass {
+
+public:
+  SHA384Class();
+  virtual ~SHA384Class();
+
+protected:
+  virtual int begin();
+  virtual int update(const uint8_t *buffer, size_t size);
+  virtual int end(uint8_t *digest);
+  virtual int state(uint8_t *value, uint64_t *count);
+  virtual int setState(const uint8_t *value, uint64_t count);
+
+private:
+  br_sha384_context _ctx;
+};
+
+#if BEARSSL_ENABLE_SHA384
+extern SHA384Class SHA384;
+#endif
+
+#endif
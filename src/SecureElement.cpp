@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ArduinoBearSSL.h"
+
+#ifndef ARDUINO_DISABLE_ECCX08
+#include <ArduinoECCX08.h>
+#endif
+
+#include "SecureElement.h"
+
+#define BR_MAX_EC_SIZE   528
+#define FIELD_LEN   ((BR_MAX_EC_SIZE + 7) >> 3)
+
+SecureElement::SecureElement()
+{
+}
+
+SecureElement::~SecureElement()
+{
+}
+
+void SecureElement::release()
+{
+}
+
+int SecureElement::verify(const uint8_t /*hash*/[32], const uint8_t /*signature*/[64], const uint8_t /*publicKey*/[64])
+{
+  return 0;
+}
+
+int SecureElement::ecdh(int /*slot*/, const uint8_t /*publicKey*/[64], uint8_t /*secret*/[32])
+{
+  return 0;
+}
+
+int SecureElement::generateKey(int /*slot*/, uint8_t /*publicKey*/[64])
+{
+  return 0;
+}
+
+int SecureElement::publicKey(int /*slot*/, uint8_t /*publicKey*/[64])
+{
+  return 0;
+}
+
+#ifndef ARDUINO_DISABLE_ECCX08
+// ECCX08Class::ecdh() is missing from older ArduinoECCX08 releases, the
+// offload is then reported as unsupported instead of failing the build
+template <typename T>
+static auto chipEcdh(T& chip, int slot, const byte publicKey[], byte output[], int) -> decltype(chip.ecdh(slot, ECCX08_ECDH_MODE, publicKey, output))
+{
+  return chip.ecdh(slot, ECCX08_ECDH_MODE, publicKey, output);
+}
+
+template <typename T>
+static int chipEcdh(T&, int, const byte[], byte[], long)
+{
+  return 0;
+}
+
+ECCX08SecureElementClass::ECCX08SecureElementClass()
+{
+}
+
+ECCX08SecureElementClass::~ECCX08SecureElementClass()
+{
+}
+
+bool ECCX08SecureElementClass::ready()
+{
+  return ArduinoBearSSL.eccX08Ready();
+}
+
+void ECCX08SecureElementClass::release()
+{
+  ArduinoBearSSL.eccX08Release();
+}
+
+int ECCX08SecureElementClass::random(uint8_t data[], size_t length)
+{
+  return ECCX08.random(data, length);
+}
+
+int ECCX08SecureElementClass::sign(int slot, const uint8_t hash[32], uint8_t signature[64])
+{
+  return ECCX08.ecSign(slot, hash, signature);
+}
+
+int ECCX08SecureElementClass::verify(const uint8_t hash[32], const uint8_t signature[64], const uint8_t publicKey[64])
+{
+  return ECCX08.ecdsaVerify(hash, signature, publicKey);
+}
+
+int ECCX08SecureElementClass::ecdh(int slot, const uint8_t publicKey[64], uint8_t secret[32])
+{
+  return chipEcdh(ECCX08, slot, publicKey, secret, 0);
+}
+
+int ECCX08SecureElementClass::generateKey(int slot, uint8_t publicKey[64])
+{
+  return ECCX08.generatePrivateKey(slot, publicKey);
+}
+
+int ECCX08SecureElementClass::publicKey(int slot, uint8_t publicKey[64])
+{
+  return ECCX08.generatePublicKey(slot, publicKey);
+}
+
+ECCX08SecureElementClass ECCX08SecureElement;
+#endif
+
+size_t
+secure_element_sign_asn1(const br_ec_impl * /*impl*/,
+  const br_hash_class * /*hf*/, const void *hash_value,
+  const br_ec_private_key *sk, void *sig)
+{
+  const secure_element_key* key = (const secure_element_key*)sk->x;
+  unsigned char rsig[64 + 12];
+
+  if (sk->curve != BR_EC_secp256r1 || key == NULL || key->element == NULL || !key->element->ready()) {
+    return 0;
+  }
+
+  if (!key->element->sign(key->slot, (const uint8_t*)hash_value, (uint8_t*)rsig)) {
+    return 0;
+  }
+
+  size_t sig_len = br_ecdsa_raw_to_asn1(rsig, 64);
+  memcpy(sig, rsig, sig_len);
+  return sig_len;
+}
+
+uint32_t
+secure_element_vrfy_asn1(const br_ec_impl * /*impl*/,
+  const void *hash, size_t hash_len,
+  const br_ec_public_key *pk,
+  const void *sig, size_t sig_len)
+{
+  SecureElement* element = ArduinoBearSSL.secureElement();
+
+  /*
+   * We use a double-sized buffer because a malformed ASN.1 signature
+   * may trigger a size expansion when converting to "raw" format.
+   */
+  unsigned char rsig[(FIELD_LEN << 2) + 24];
+
+  if (sig_len > ((sizeof rsig) >> 1)) {
+    return 0;
+  }
+
+  memcpy(rsig, sig, sig_len);
+  sig_len = br_ecdsa_asn1_to_raw(rsig, sig_len);
+
+  if (hash_len != 32 || pk->curve != BR_EC_secp256r1 || pk->qlen != 65 || sig_len != 64) {
+    return 0;
+  }
+
+  if (element == NULL || !element->ready()) {
+    return 0;
+  }
+
+  // the element takes X || Y, without the 0x04 of the uncompressed point
+  return element->verify((const uint8_t*)hash, (const uint8_t*)rsig, (const uint8_t*)&pk->q[1]) ? 1 : 0;
+}
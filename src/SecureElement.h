@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _SECURE_ELEMENT_H_
+#define _SECURE_ELEMENT_H_
+
+#include <Arduino.h>
+
+#include "bearssl/bearssl.h"
+
+// ECDH command mode of ArduinoECCX08 compatible libraries: private key
+// in the slot, shared secret returned in the clear (ATECC508A compatible)
+#ifndef ECCX08_ECDH_MODE
+#define ECCX08_ECDH_MODE 0x00
+#endif
+
+// The operations BearSSLClient hands to a secure element: P-256 ECDSA
+// with the key of a slot, ECDSA verification, ECDH, random numbers and
+// the keys of the slots. Signatures are raw (r || s), public keys X || Y.
+// Every method but ready(), random() and sign() is optional; the default
+// returns 0 and the work stays in software. Subclass it for parts whose
+// library does not follow the ArduinoECCX08 API, e.g. a TPM, and select
+// it with ArduinoBearSSL.setSecureElement().
+class SecureElement {
+
+public:
+  SecureElement();
+  virtual ~SecureElement();
+
+  // true if the element is present and provisioned
+  virtual bool ready() = 0;
+  // called once a handshake is over, e.g. to power the element down
+  virtual void release();
+
+  virtual int random(uint8_t data[], size_t length) = 0;
+
+  virtual int sign(int slot, const uint8_t hash[32], uint8_t signature[64]) = 0;
+  virtual int verify(const uint8_t hash[32], const uint8_t signature[64], const uint8_t publicKey[64]);
+
+  // X coordinate of the shared point, with the private key of slot
+  virtual int ecdh(int slot, const uint8_t publicKey[64], uint8_t secret[32]);
+
+  // new key pair in slot, and public key of the key pair in slot
+  virtual int generateKey(int slot, uint8_t publicKey[64]);
+  virtual int publicKey(int slot, uint8_t publicKey[64]);
+};
+
+// A secure element whose library follows the ArduinoECCX08 API, e.g.
+// the SE050 of the Portenta boards:
+//
+//   #include <SE05X.h>
+//   SecureElementAdapter<SE05XClass> se050(SE05X);
+//   ...
+//   ArduinoBearSSL.setSecureElement(&se050);
+//
+// ecdh() is used if the library has it, with ECCX08_ECDH_MODE.
+template <typename T>
+class SecureElementAdapter : public SecureElement {
+
+public:
+  SecureElementAdapter(T& chip) :
+    _chip(chip),
+    _begun(0)
+  {
+  }
+
+  virtual bool ready()
+  {
+    if (_begun == 0) {
+      _begun = _chip.begin() ? 1 : -1;
+    }
+
+    return (_begun > 0);
+  }
+
+  virtual int random(uint8_t data[], size_t length)
+  {
+    return _chip.random(data, length);
+  }
+
+  virtual int sign(int slot, const uint8_t hash[32], uint8_t signature[64])
+  {
+    return _chip.ecSign(slot, hash, signature);
+  }
+
+  virtual int verify(const uint8_t hash[32], const uint8_t signature[64], const uint8_t publicKey[64])
+  {
+    return _chip.ecdsaVerify(hash, signature, publicKey);
+  }
+
+  virtual int ecdh(int slot, const uint8_t publicKey[64], uint8_t secret[32])
+  {
+    return chipEcdh(_chip, slot, publicKey, secret, 0);
+  }
+
+  virtual int generateKey(int slot, uint8_t publicKey[64])
+  {
+    return _chip.generatePrivateKey(slot, publicKey);
+  }
+
+  virtual int publicKey(int slot, uint8_t publicKey[64])
+  {
+    return _chip.generatePublicKey(slot, publicKey);
+  }
+
+private:
+  template <typename U>
+  static auto chipEcdh(U& chip, int slot, const uint8_t publicKey[], uint8_t secret[], int) -> decltype(chip.ecdh(slot, ECCX08_ECDH_MODE, publicKey, secret))
+  {
+    return chip.ecdh(slot, ECCX08_ECDH_MODE, publicKey, secret);
+  }
+
+  template <typename U>
+  static int chipEcdh(U&, int, const uint8_t[], uint8_t[], long)
+  {
+    return 0;
+  }
+
+  T& _chip;
+  int _begun;
+};
+
+#ifndef ARDUINO_DISABLE_ECCX08
+// The ECCX08 (ATECC508A / ATECC608), the default secure element. It
+// goes through ArduinoBearSSL.eccX08Ready() and eccX08Release().
+class ECCX08SecureElementClass : public SecureElement {
+
+public:
+  ECCX08SecureElementClass();
+  virtual ~ECCX08SecureElementClass();
+
+  virtual bool ready();
+  virtual void release();
+
+  virtual int random(uint8_t data[], size_t length);
+
+  virtual int sign(int slot, const uint8_t hash[32], uint8_t signature[64]);
+  virtual int verify(const uint8_t hash[32], const uint8_t signature[64], const uint8_t publicKey[64]);
+
+  virtual int ecdh(int slot, const uint8_t publicKey[64], uint8_t secret[32]);
+
+  virtual int generateKey(int slot, uint8_t publicKey[64]);
+  virtual int publicKey(int slot, uint8_t publicKey[64]);
+};
+
+extern ECCX08SecureElementClass ECCX08SecureElement;
+#endif
+
+// P-256 private key held by a secure element: br_ec_private_key.x
+// points to it, for secure_element_sign_asn1()
+typedef struct {
+  SecureElement* element;
+  int slot;
+} secure_element_key;
+
+// br_ecdsa_sign and br_ecdsa_vrfy for BearSSL. The signature uses the
+// element and slot of the key, the verification the element selected
+// with ArduinoBearSSL.setSecureElement(); both only do P-256 with
+// SHA-256.
+size_t
+secure_element_sign_asn1(const br_ec_impl *impl,
+  const br_hash_class *hf, const void *hash_value,
+  const br_ec_private_key *sk, void *sig);
+
+uint32_t
+secure_element_vrfy_asn1(const br_ec_impl *impl,
+  const void *hash, size_t hash_len,
+  const br_ec_public_key *pk,
+  const void *sig, size_t sig_len);
+
+#endif
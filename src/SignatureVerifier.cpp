@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ArduinoBearSSL.h"
+#include "utility/eccX08_asn1.h"
+
+#include "SignatureVerifier.h"
+
+static const unsigned char* hashOid(const br_hash_class* hash)
+{
+  switch ((hash->desc >> BR_HASHDESC_ID_OFF) & BR_HASHDESC_ID_MASK) {
+    case br_sha1_ID: return BR_HASH_OID_SHA1;
+    case br_sha224_ID: return BR_HASH_OID_SHA224;
+    case br_sha256_ID: return BR_HASH_OID_SHA256;
+    case br_sha384_ID: return BR_HASH_OID_SHA384;
+    case br_sha512_ID: return BR_HASH_OID_SHA512;
+    default: return NULL;
+  }
+}
+
+SignatureVerifier::SignatureVerifier() :
+  _ecKey(NULL),
+  _rsaKey(NULL)
+{
+#ifndef ARDUINO_DISABLE_ECCX08
+  _ecVrfy = eccX08_vrfy_asn1;
+#else
+  _ecVrfy = br_ecdsa_vrfy_asn1_get_default();
+#endif
+
+  _hash.vtable = NULL;
+}
+
+SignatureVerifier::~SignatureVerifier()
+{
+}
+
+int SignatureVerifier::beginEcdsa(const br_ec_public_key* key, const br_hash_class* hash)
+{
+  _ecKey = NULL;
+  _rsaKey = NULL;
+  _hash.vtable = NULL;
+
+  if (key == NULL || hash == NULL) {
+    return 0;
+  }
+
+  hash->init(&_hash.vtable);
+  _ecKey = key;
+
+  return 1;
+}
+
+int SignatureVerifier::beginRsa(const br_rsa_public_key* key, const br_hash_class* hash)
+{
+  _ecKey = NULL;
+  _rsaKey = NULL;
+  _hash.vtable = NULL;
+
+  if (key == NULL || hash == NULL || hashOid(hash) == NULL) {
+    return 0;
+  }
+
+  hash->init(&_hash.vtable);
+  _rsaKey = key;
+
+  return 1;
+}
+
+int SignatureVerifier::end(const uint8_t* signature, size_t length)
+{
+  uint8_t digest[64];
+  size_t digestLength;
+  int result = 0;
+
+  if (_hash.vtable == NULL) {
+    return 0;
+  }
+
+  _hash.vtable->out(&_hash.vtable, digest);
+  digestLength = (_hash.vtable->desc >> BR_HASHDESC_OUT_OFF) & BR_HASHDESC_OUT_MASK;
+
+  if (_ecKey != NULL) {
+    const br_ec_public_key* key = _ecKey;
+    br_ecdsa_vrfy vrfy = _ecVrfy;
+
+#ifndef ARDUINO_DISABLE_ECCX08
+    // the ECCX08 only does P-256 with SHA-256
+    if (vrfy == eccX08_vrfy_asn1 && (key->curve != BR_EC_secp256r1 || digestLength != 32)) {
+      vrfy = br_ecdsa_vrfy_asn1_get_default();
+    }
+#endif
+
+    result = vrfy(br_ec_get_default(), digest, digestLength, key, signature, length);
+  } else if (_rsaKey != NULL) {
+    uint8_t signedDigest[64];
+
+    if (br_rsa_pkcs1_vrfy_get_default()(signature, length, hashOid(_hash.vtable), digestLength, _rsaKey, signedDigest)) {
+      uint8_t diff = 0;
+
+      for (size_t i = 0; i < digestLength; i++) {
+        diff |= signedDigest[i] ^ digest[i];
+      }
+      result = (diff == 0);
+    }
+  }
+
+  _ecKey = NULL;
+  _rsaKey = NULL;
+  _hash.vtable = NULL;
+
+  return result ? 1 : 0;
+}
+
+void SignatureVerifier::setEccVrfy(br_ecdsa_vrfy vrfy)
+{
+  _ecVrfy = vrfy;
+}
+
+size_t SignatureVerifier::write(uint8_t data)
+{
+  return write(&data, sizeof(data));
+}
+
+size_t SignatureVerifier::write(const uint8_t* buffer, size_t size)
+{
+  if (_hash.vtable == NULL) {
+    setWriteError();
+    return 0;
+  }
+
+  _hash.vtable->update(&_hash.vtable, buffer, size);
+
+  return size;
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SIGNATURE_VERIFIER_H
+#define SIGNATURE_VERIFIER_H
+
+#include <Arduino.h>
+
+#include "bearssl/bearssl.h"
+
+// Verifies a signature over data written to it, hashing as it goes so
+// that e.g. a firmware image never has to be held in memory:
+//
+//   verifier.beginEcdsa(&publicKey);
+//   while (image.available()) {
+//     verifier.write(buffer, image.read(buffer, sizeof(buffer)));
+//   }
+//   if (verifier.end(signature, signatureLength)) ...
+//
+// the key must stay valid until end()
+class SignatureVerifier : public Print {
+
+public:
+  SignatureVerifier();
+  virtual ~SignatureVerifier();
+
+  // hash is the digest the signature was made over
+  int beginEcdsa(const br_ec_public_key* key, const br_hash_class* hash = &br_sha256_vtable);
+  int beginRsa(const br_rsa_public_key* key, const br_hash_class* hash = &br_sha256_vtable);
+
+  // ASN.1 (DER) ECDSA or PKCS#1 v1.5 RSA signature, 1 if it is valid
+  int end(const uint8_t* signature, size_t length);
+
+  // ECDSA implementation, by default the ECCX08 for P-256 when it is
+  // enabled, see BearSSLClient::setEccVrfy()
+  void setEccVrfy(br_ecdsa_vrfy vrfy);
+
+  // Print
+  virtual size_t write(uint8_t data);
+  virtual size_t write(const uint8_t* buffer, size_t size);
+  using Print::write;
+
+private:
+  br_hash_compat_context _hash;
+  const br_ec_public_key* _ecKey;
+  const br_rsa_public_key* _rsaKey;
+  br_ecdsa_vrfy _ecVrfy;
+};
+
+#endif
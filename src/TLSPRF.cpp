@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "TLSPRF.h"
+
+TLSPRFClass::TLSPRFClass()
+{
+}
+
+TLSPRFClass::~TLSPRFClass()
+{
+}
+
+int TLSPRFClass::sha256(uint8_t *output, size_t length, const uint8_t *secret, size_t secretLength, const char *label, const uint8_t *seed, size_t seedLength)
+{
+  br_tls_prf_seed_chunk chunk = { seed, seedLength };
+
+  br_tls12_sha256_prf(output, length, secret, secretLength, label, 1, &chunk);
+
+  return 1;
+}
+
+int TLSPRFClass::sha384(uint8_t *output, size_t length, const uint8_t *secret, size_t secretLength, const char *label, const uint8_t *seed, size_t seedLength)
+{
+  br_tls_prf_seed_chunk chunk = { seed, seedLength };
+
+  br_tls12_sha384_prf(output, length, secret, secretLength, label, 1, &chunk);
+
+  return 1;
+}
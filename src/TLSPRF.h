@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef TLS_PRF_H
+#define TLS_PRF_H
+
+#include <Arduino.h>
+
+#include <bearssl/bearssl_prf.h>
+
+// TLS 1.2 PRF (RFC 5246 section 5), as used for key expansion, e.g.
+//
+//   TLSPRF.sha256(keys, sizeof(keys), secret, 48, "key expansion", randoms, 64);
+//
+// seed is the concatenation of the seed parts, label is excluded from it
+class TLSPRFClass {
+
+public:
+  TLSPRFClass();
+  virtual ~TLSPRFClass();
+
+  int sha256(uint8_t *output, size_t length, const uint8_t *secret, size_t secretLength, const char *label, const uint8_t *seed, size_t seedLength);
+  int sha384(uint8_t *output, size_t length, const uint8_t *secret, size_t secretLength, const char *label, const uint8_t *seed, size_t seedLength);
+};
+
+extern TLSPRFClass TLSPRF;
+
+#endif
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define BR_ENABLE_INTRINSICS   1
+#include "inner.h"
+
+/*
+ * This code contains the AES key schedule implementation using the
+ * ARMv8 opcodes.
+ */
+
+#if BR_ARMV8_CE
+
+static const unsigned char Rcon[] = {
+	0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1B, 0x36
+};
+
+/*
+ * With all four columns equal, ShiftRows is the identity and AESE with
+ * an all-zero key is SubBytes alone, which gives a constant-time
+ * SubWord().
+ */
+static inline uint32_t
+SubWord(uint32_t x)
+{
+	uint8x16_t y;
+
+	y = vaeseq_u8(vreinterpretq_u8_u32(vdupq_n_u32(x)), vdupq_n_u8(0));
+	return vgetq_lane_u32(vreinterpretq_u32_u8(y), 0);
+}
+
+/* see inner.h */
+unsigned
+br_aes_armv8_keysched_enc(unsigned char *skey, const void *key, size_t len)
+{
+	uint32_t sk[60];
+	unsigned num_rounds;
+	int i, j, k, nk, nkf;
+
+	switch (len) {
+	case 16:
+		num_rounds = 10;
+		break;
+	case 24:
+		num_rounds = 12;
+		break;
+	case 32:
+		num_rounds = 14;
+		break;
+	default:
+		return 0;
+	}
+	nk = (int)(len >> 2);
+	nkf = (int)((num_rounds + 1) << 2);
+	for (i = 0; i < nk; i ++) {
+		sk[i] = br_dec32be((const unsigned char *)key + (i << 2));
+	}
+	for (i = nk, j = 0, k = 0; i < nkf; i ++) {
+		uint32_t tmp;
+
+		tmp = sk[i - 1];
+		if (j == 0) {
+			tmp = (tmp << 8) | (tmp >> 24);
+			tmp = SubWord(tmp) ^ ((uint32_t)Rcon[k] << 24);
+		} else if (nk > 6 && j == 4) {
+			tmp = SubWord(tmp);
+		}
+		sk[i] = sk[i - nk] ^ tmp;
+		if (++ j == nk) {
+			j = 0;
+			k ++;
+		}
+	}
+	br_range_enc32be(skey, sk, nkf);
+	return num_rounds;
+}
+
+/* see inner.h */
+unsigned
+br_aes_armv8_keysched_dec(unsigned char *skey, const void *key, size_t len)
+{
+	unsigned char tmp[16 * 15];
+	unsigned u, num_rounds;
+
+	num_rounds = br_aes_armv8_keysched_enc(tmp, key, len);
+	if (num_rounds == 0) {
+		return 0;
+	}
+
+	/*
+	 * Equivalent inverse cipher: subkeys in reverse order, with
+	 * InvMixColumns applied to all but the first and last.
+	 */
+	memcpy(skey, tmp + (num_rounds << 4), 16);
+	for (u = 1; u < num_rounds; u ++) {
+		vst1q_u8(skey + (u << 4), vaesimcq_u8(
+			vld1q_u8(tmp + ((num_rounds - u) << 4))));
+	}
+	memcpy(skey + (num_rounds << 4), tmp, 16);
+	return num_rounds;
+}
+
+#endif
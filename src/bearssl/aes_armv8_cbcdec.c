@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define BR_ENABLE_INTRINSICS   1
+#include "inner.h"
+
+#if BR_ARMV8_CE
+
+/* see bearssl_block.h */
+const br_block_cbcdec_class *
+br_aes_armv8_cbcdec_get_vtable(void)
+{
+	return &br_aes_armv8_cbcdec_vtable;
+}
+
+/* see bearssl_block.h */
+void
+br_aes_armv8_cbcdec_init(br_aes_armv8_cbcdec_keys *ctx,
+	const void *key, size_t len)
+{
+	ctx->vtable = &br_aes_armv8_cbcdec_vtable;
+	ctx->num_rounds = br_aes_armv8_keysched_dec(ctx->skey.sk, key, len);
+}
+
+/* see bearssl_block.h */
+void
+br_aes_armv8_cbcdec_run(const br_aes_armv8_cbcdec_keys *ctx,
+	void *iv, void *data, size_t len)
+{
+	unsigned char *buf;
+	unsigned num_rounds;
+	uint8x16_t sk[15], ivx;
+
+	buf = data;
+	num_rounds = ctx->num_rounds;
+	br_aes_armv8_load_subkeys(sk, ctx->skey.sk, num_rounds);
+	ivx = vld1q_u8(iv);
+
+	/*
+	 * Blocks are independent when decrypting, so four of them go
+	 * through the AES pipeline together.
+	 */
+	while (len >= 64) {
+		uint8x16_t x0, x1, x2, x3, y0, y1, y2, y3;
+		unsigned u;
+
+		y0 = vld1q_u8(buf +  0);
+		y1 = vld1q_u8(buf + 16);
+		y2 = vld1q_u8(buf + 32);
+		y3 = vld1q_u8(buf + 48);
+		x0 = y0;
+		x1 = y1;
+		x2 = y2;
+		x3 = y3;
+		for (u = 0; u < num_rounds - 1; u ++) {
+			x0 = vaesimcq_u8(vaesdq_u8(x0, sk[u]));
+			x1 = vaesimcq_u8(vaesdq_u8(x1, sk[u]));
+			x2 = vaesimcq_u8(vaesdq_u8(x2, sk[u]));
+			x3 = vaesimcq_u8(vaesdq_u8(x3, sk[u]));
+		}
+		x0 = veorq_u8(vaesdq_u8(x0, sk[u]), sk[num_rounds]);
+		x1 = veorq_u8(vaesdq_u8(x1, sk[u]), sk[num_rounds]);
+		x2 = veorq_u8(vaesdq_u8(x2, sk[u]), sk[num_rounds]);
+		x3 = veorq_u8(vaesdq_u8(x3, sk[u]), sk[num_rounds]);
+		vst1q_u8(buf +  0, veorq_u8(x0, ivx));
+		vst1q_u8(buf + 16, veorq_u8(x1, y0));
+		vst1q_u8(buf + 32, veorq_u8(x2, y1));
+		vst1q_u8(buf + 48, veorq_u8(x3, y2));
+		ivx = y3;
+		buf += 64;
+		len -= 64;
+	}
+	while (len > 0) {
+		uint8x16_t x, y;
+
+		y = vld1q_u8(buf);
+		x = br_aes_armv8_decrypt_block(sk, num_rounds, y);
+		vst1q_u8(buf, veorq_u8(x, ivx));
+		ivx = y;
+		buf += 16;
+		len -= 16;
+	}
+	vst1q_u8(iv, ivx);
+}
+
+/* see bearssl_block.h */
+const br_block_cbcdec_class br_aes_armv8_cbcdec_vtable = {
+	sizeof(br_aes_armv8_cbcdec_keys),
+	16,
+	4,
+	(void (*)(const br_block_cbcdec_class **, const void *, size_t))
+		&br_aes_armv8_cbcdec_init,
+	(void (*)(const br_block_cbcdec_class *const *, void *, void *, size_t))
+		&br_aes_armv8_cbcdec_run
+};
+
+#else
+
+/* see bearssl_block.h */
+const br_block_cbcdec_class *
+br_aes_armv8_cbcdec_get_vtable(void)
+{
+	return NULL;
+}
+
+#endif
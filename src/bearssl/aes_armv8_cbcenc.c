@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define BR_ENABLE_INTRINSICS   1
+#include "inner.h"
+
+#if BR_ARMV8_CE
+
+/* see bearssl_block.h */
+const br_block_cbcenc_class *
+br_aes_armv8_cbcenc_get_vtable(void)
+{
+	return &br_aes_armv8_cbcenc_vtable;
+}
+
+/* see bearssl_block.h */
+void
+br_aes_armv8_cbcenc_init(br_aes_armv8_cbcenc_keys *ctx,
+	const void *key, size_t len)
+{
+	ctx->vtable = &br_aes_armv8_cbcenc_vtable;
+	ctx->num_rounds = br_aes_armv8_keysched_enc(ctx->skey.sk, key, len);
+}
+
+/* see bearssl_block.h */
+void
+br_aes_armv8_cbcenc_run(const br_aes_armv8_cbcenc_keys *ctx,
+	void *iv, void *data, size_t len)
+{
+	unsigned char *buf;
+	unsigned num_rounds;
+	uint8x16_t sk[15], ivx;
+
+	buf = data;
+	num_rounds = ctx->num_rounds;
+	br_aes_armv8_load_subkeys(sk, ctx->skey.sk, num_rounds);
+	ivx = vld1q_u8(iv);
+	while (len > 0) {
+		ivx = veorq_u8(ivx, vld1q_u8(buf));
+		ivx = br_aes_armv8_encrypt_block(sk, num_rounds, ivx);
+		vst1q_u8(buf, ivx);
+		buf += 16;
+		len -= 16;
+	}
+	vst1q_u8(iv, ivx);
+}
+
+/* see bearssl_block.h */
+const br_block_cbcenc_class br_aes_armv8_cbcenc_vtable = {
+	sizeof(br_aes_armv8_cbcenc_keys),
+	16,
+	4,
+	(void (*)(const br_block_cbcenc_class **, const void *, size_t))
+		&br_aes_armv8_cbcenc_init,
+	(void (*)(const br_block_cbcenc_class *const *, void *, void *, size_t))
+		&br_aes_armv8_cbcenc_run
+};
+
+#else
+
+/* see bearssl_block.h */
+const br_block_cbcenc_class *
+br_aes_armv8_cbcenc_get_vtable(void)
+{
+	return NULL;
+}
+
+#endif
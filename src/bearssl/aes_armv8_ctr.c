@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define BR_ENABLE_INTRINSICS   1
+#include "inner.h"
+
+#if BR_ARMV8_CE
+
+/* see bearssl_block.h */
+const br_block_ctr_class *
+br_aes_armv8_ctr_get_vtable(void)
+{
+	return &br_aes_armv8_ctr_vtable;
+}
+
+/* see bearssl_block.h */
+void
+br_aes_armv8_ctr_init(br_aes_armv8_ctr_keys *ctx,
+	const void *key, size_t len)
+{
+	ctx->vtable = &br_aes_armv8_ctr_vtable;
+	ctx->num_rounds = br_aes_armv8_keysched_enc(ctx->skey.sk, key, len);
+}
+
+/* see bearssl_block.h */
+uint32_t
+br_aes_armv8_ctr_run(const br_aes_armv8_ctr_keys *ctx,
+	const void *iv, uint32_t cc, void *data, size_t len)
+{
+	unsigned char *buf;
+	unsigned char ivbuf[16];
+	unsigned num_rounds;
+	uint8x16_t sk[15];
+	uint32x4_t ivw;
+	unsigned u;
+
+	buf = data;
+	memcpy(ivbuf, iv, 12);
+	memset(ivbuf + 12, 0, 4);
+	num_rounds = ctx->num_rounds;
+	br_aes_armv8_load_subkeys(sk, ctx->skey.sk, num_rounds);
+	ivw = vreinterpretq_u32_u8(vld1q_u8(ivbuf));
+	while (len > 0) {
+		uint8x16_t x0, x1, x2, x3;
+
+		x0 = vreinterpretq_u8_u32(
+			vsetq_lane_u32(br_swap32(cc + 0), ivw, 3));
+		x1 = vreinterpretq_u8_u32(
+			vsetq_lane_u32(br_swap32(cc + 1), ivw, 3));
+		x2 = vreinterpretq_u8_u32(
+			vsetq_lane_u32(br_swap32(cc + 2), ivw, 3));
+		x3 = vreinterpretq_u8_u32(
+			vsetq_lane_u32(br_swap32(cc + 3), ivw, 3));
+		for (u = 0; u < num_rounds - 1; u ++) {
+			x0 = vaesmcq_u8(vaeseq_u8(x0, sk[u]));
+			x1 = vaesmcq_u8(vaeseq_u8(x1, sk[u]));
+			x2 = vaesmcq_u8(vaeseq_u8(x2, sk[u]));
+			x3 = vaesmcq_u8(vaeseq_u8(x3, sk[u]));
+		}
+		x0 = veorq_u8(vaeseq_u8(x0, sk[u]), sk[num_rounds]);
+		x1 = veorq_u8(vaeseq_u8(x1, sk[u]), sk[num_rounds]);
+		x2 = veorq_u8(vaeseq_u8(x2, sk[u]), sk[num_rounds]);
+		x3 = veorq_u8(vaeseq_u8(x3, sk[u]), sk[num_rounds]);
+		if (len >= 64) {
+			vst1q_u8(buf +  0, veorq_u8(x0, vld1q_u8(buf +  0)));
+			vst1q_u8(buf + 16, veorq_u8(x1, vld1q_u8(buf + 16)));
+			vst1q_u8(buf + 32, veorq_u8(x2, vld1q_u8(buf + 32)));
+			vst1q_u8(buf + 48, veorq_u8(x3, vld1q_u8(buf + 48)));
+			buf += 64;
+			len -= 64;
+			cc += 4;
+		} else {
+			unsigned char tmp[64];
+
+			vst1q_u8(tmp +  0, x0);
+			vst1q_u8(tmp + 16, x1);
+			vst1q_u8(tmp + 32, x2);
+			vst1q_u8(tmp + 48, x3);
+			for (u = 0; u < len; u ++) {
+				buf[u] ^= tmp[u];
+			}
+			cc += (uint32_t)(len + 15) >> 4;
+			break;
+		}
+	}
+	return cc;
+}
+
+/* see bearssl_block.h */
+const br_block_ctr_class br_aes_armv8_ctr_vtable = {
+	sizeof(br_aes_armv8_ctr_keys),
+	16,
+	4,
+	(void (*)(const br_block_ctr_class **, const void *, size_t))
+		&br_aes_armv8_ctr_init,
+	(uint32_t (*)(const br_block_ctr_class *const *,
+		const void *, uint32_t, void *, size_t))
+		&br_aes_armv8_ctr_run
+};
+
+#else
+
+/* see bearssl_block.h */
+const br_block_ctr_class *
+br_aes_armv8_ctr_get_vtable(void)
+{
+	return NULL;
+}
+
+#endif
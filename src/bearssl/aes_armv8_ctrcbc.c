@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define BR_ENABLE_INTRINSICS   1
+#include "inner.h"
+
+#if BR_ARMV8_CE
+
+/* see bearssl_block.h */
+const br_block_ctrcbc_class *
+br_aes_armv8_ctrcbc_get_vtable(void)
+{
+	return &br_aes_armv8_ctrcbc_vtable;
+}
+
+/* see bearssl_block.h */
+void
+br_aes_armv8_ctrcbc_init(br_aes_armv8_ctrcbc_keys *ctx,
+	const void *key, size_t len)
+{
+	ctx->vtable = &br_aes_armv8_ctrcbc_vtable;
+	ctx->num_rounds = br_aes_armv8_keysched_enc(ctx->skey.sk, key, len);
+}
+
+/*
+ * Write the current counter value (big-endian, 128 bits) in dst[],
+ * then increment it.
+ */
+static inline void
+next_counter(unsigned char *dst, uint64_t *hi, uint64_t *lo)
+{
+	br_enc64be(dst, *hi);
+	br_enc64be(dst + 8, *lo);
+	*lo += 1;
+	*hi += (uint64_t)(*lo == 0);
+}
+
+/*
+ * Encrypt two independent blocks; the AES opcodes are pipelined, so
+ * this costs about as much as a single block.
+ */
+static inline void
+aes_enc2(const uint8x16_t *sk, unsigned num_rounds,
+	uint8x16_t *x0, uint8x16_t *x1)
+{
+	uint8x16_t y0, y1;
+	unsigned u;
+
+	y0 = *x0;
+	y1 = *x1;
+	for (u = 0; u < num_rounds - 1; u ++) {
+		y0 = vaesmcq_u8(vaeseq_u8(y0, sk[u]));
+		y1 = vaesmcq_u8(vaeseq_u8(y1, sk[u]));
+	}
+	*x0 = veorq_u8(vaeseq_u8(y0, sk[u]), sk[num_rounds]);
+	*x1 = veorq_u8(vaeseq_u8(y1, sk[u]), sk[num_rounds]);
+}
+
+/* see bearssl_block.h */
+void
+br_aes_armv8_ctrcbc_ctr(const br_aes_armv8_ctrcbc_keys *ctx,
+	void *ctr, void *data, size_t len)
+{
+	unsigned char *buf;
+	unsigned char tmp[32];
+	uint8x16_t sk[15];
+	uint64_t hi, lo;
+	unsigned num_rounds;
+
+	num_rounds = ctx->num_rounds;
+	br_aes_armv8_load_subkeys(sk, ctx->skey.sk, num_rounds);
+	hi = br_dec64be(ctr);
+	lo = br_dec64be((unsigned char *)ctr + 8);
+	buf = data;
+	while (len > 0) {
+		uint8x16_t x0, x1;
+
+		next_counter(tmp, &hi, &lo);
+		if (len >= 32) {
+			next_counter(tmp + 16, &hi, &lo);
+		}
+		x0 = vld1q_u8(tmp);
+		x1 = vld1q_u8(tmp + 16);
+		aes_enc2(sk, num_rounds, &x0, &x1);
+		vst1q_u8(buf, veorq_u8(x0, vld1q_u8(buf)));
+		if (len >= 32) {
+			vst1q_u8(buf + 16, veorq_u8(x1, vld1q_u8(buf + 16)));
+			buf += 32;
+			len -= 32;
+		} else {
+			buf += 16;
+			len -= 16;
+		}
+	}
+	br_enc64be(ctr, hi);
+	br_enc64be((unsigned char *)ctr + 8, lo);
+}
+
+/* see bearssl_block.h */
+void
+br_aes_armv8_ctrcbc_mac(const br_aes_armv8_ctrcbc_keys *ctx,
+	void *cbcmac, const void *data, size_t len)
+{
+	const unsigned char *buf;
+	uint8x16_t sk[15], cm;
+	unsigned num_rounds;
+
+	num_rounds = ctx->num_rounds;
+	br_aes_armv8_load_subkeys(sk, ctx->skey.sk, num_rounds);
+	cm = vld1q_u8(cbcmac);
+	buf = data;
+	while (len > 0) {
+		cm = veorq_u8(cm, vld1q_u8(buf));
+		cm = br_aes_armv8_encrypt_block(sk, num_rounds, cm);
+		buf += 16;
+		len -= 16;
+	}
+	vst1q_u8(cbcmac, cm);
+}
+
+/* see bearssl_block.h */
+void
+br_aes_armv8_ctrcbc_encrypt(const br_aes_armv8_ctrcbc_keys *ctx,
+	void *ctr, void *cbcmac, void *data, size_t len)
+{
+	/*
+	 * CBC-MAC runs over the encrypted blocks, so it lags by one
+	 * block: each iteration encrypts the next counter along with
+	 * the CBC-MAC input of the previous block.
+	 */
+	unsigned char *buf;
+	unsigned char tmp[16];
+	uint8x16_t sk[15], cm;
+	uint64_t hi, lo;
+	unsigned num_rounds;
+	int first_iter;
+
+	num_rounds = ctx->num_rounds;
+	br_aes_armv8_load_subkeys(sk, ctx->skey.sk, num_rounds);
+	hi = br_dec64be(ctr);
+	lo = br_dec64be((unsigned char *)ctr + 8);
+	cm = vld1q_u8(cbcmac);
+	buf = data;
+	first_iter = 1;
+	while (len > 0) {
+		uint8x16_t x;
+
+		next_counter(tmp, &hi, &lo);
+		x = vld1q_u8(tmp);
+		if (first_iter) {
+			x = br_aes_armv8_encrypt_block(sk, num_rounds, x);
+			first_iter = 0;
+		} else {
+			aes_enc2(sk, num_rounds, &x, &cm);
+		}
+		x = veorq_u8(x, vld1q_u8(buf));
+		vst1q_u8(buf, x);
+		cm = veorq_u8(cm, x);
+		buf += 16;
+		len -= 16;
+	}
+	if (!first_iter) {
+		cm = br_aes_armv8_encrypt_block(sk, num_rounds, cm);
+	}
+	br_enc64be(ctr, hi);
+	br_enc64be((unsigned char *)ctr + 8, lo);
+	vst1q_u8(cbcmac, cm);
+}
+
+/* see bearssl_block.h */
+void
+br_aes_armv8_ctrcbc_decrypt(const br_aes_armv8_ctrcbc_keys *ctx,
+	void *ctr, void *cbcmac, void *data, size_t len)
+{
+	unsigned char *buf;
+	unsigned char tmp[16];
+	uint8x16_t sk[15], cm;
+	uint64_t hi, lo;
+	unsigned num_rounds;
+
+	num_rounds = ctx->num_rounds;
+	br_aes_armv8_load_subkeys(sk, ctx->skey.sk, num_rounds);
+	hi = br_dec64be(ctr);
+	lo = br_dec64be((unsigned char *)ctr + 8);
+	cm = vld1q_u8(cbcmac);
+	buf = data;
+	while (len > 0) {
+		uint8x16_t x, y;
+
+		y = vld1q_u8(buf);
+		next_counter(tmp, &hi, &lo);
+		x = vld1q_u8(tmp);
+		cm = veorq_u8(cm, y);
+		aes_enc2(sk, num_rounds, &x, &cm);
+		vst1q_u8(buf, veorq_u8(x, y));
+		buf += 16;
+		len -= 16;
+	}
+	br_enc64be(ctr, hi);
+	br_enc64be((unsigned char *)ctr + 8, lo);
+	vst1q_u8(cbcmac, cm);
+}
+
+/* see bearssl_block.h */
+const br_block_ctrcbc_class br_aes_armv8_ctrcbc_vtable = {
+	sizeof(br_aes_armv8_ctrcbc_keys),
+	16,
+	4,
+	(void (*)(const br_block_ctrcbc_class **, const void *, size_t))
+		&br_aes_armv8_ctrcbc_init,
+	(void (*)(const br_block_ctrcbc_class *const *,
+		void *, void *, void *, size_t))
+		&br_aes_armv8_ctrcbc_encrypt,
+	(void (*)(const br_block_ctrcbc_class *const *,
+		void *, void *, void *, size_t))
+		&br_aes_armv8_ctrcbc_decrypt,
+	(void (*)(const br_block_ctrcbc_class *const *,
+		void *, void *, size_t))
+		&br_aes_armv8_ctrcbc_ctr,
+	(void (*)(const br_block_ctrcbc_class *const *,
+		void *, const void *, size_t))
+		&br_aes_armv8_ctrcbc_mac
+};
+
+#else
+
+/* see bearssl_block.h */
+const br_block_ctrcbc_class *
+br_aes_armv8_ctrcbc_get_vtable(void)
+{
+	return NULL;
+}
+
+#endif
@@ -27,7 +27,7 @@
 /*
  * Inverse S-box (used in key schedule for decryption).
  */
-static const unsigned char iS[] = {
+static const unsigned char iS[] BR_FAST_TABLE = {
 	0x52, 0x09, 0x6A, 0xD5, 0x30, 0x36, 0xA5, 0x38, 0xBF, 0x40, 0xA3, 0x9E,
 	0x81, 0xF3, 0xD7, 0xFB, 0x7C, 0xE3, 0x39, 0x82, 0x9B, 0x2F, 0xFF, 0x87,
 	0x34, 0x8E, 0x43, 0x44, 0xC4, 0xDE, 0xE9, 0xCB, 0x54, 0x7B, 0x94, 0x32,
@@ -52,7 +52,7 @@ static const unsigned char iS[] = {
 	0x55, 0x21, 0x0C, 0x7D
 };
 
-static const uint32_t iSsm0[] = {
+static const uint32_t iSsm0[] BR_FAST_TABLE = {
 	0x51F4A750, 0x7E416553, 0x1A17A4C3, 0x3A275E96, 0x3BAB6BCB, 0x1F9D45F1,
 	0xACFA58AB, 0x4BE30393, 0x2030FA55, 0xAD766DF6, 0x88CC7691, 0xF5024C25,
 	0x4FE5D7FC, 0xC52ACBD7, 0x26354480, 0xB562A38F, 0xDEB15A49, 0x25BA1B67,
@@ -184,7 +184,7 @@ rotr(uint32_t x, int n)
 #define iSboxExt3(x)   (rotr(iSsm0[x], 24))
 
 /* see bearssl.h */
-void
+BR_FAST_FUNC void
 br_aes_big_decrypt(unsigned num_rounds, const uint32_t *skey, void *data)
 {
 	unsigned char *buf;
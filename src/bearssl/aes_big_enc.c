@@ -24,9 +24,9 @@
 
 #include "inner.h"
 
-#define S   br_aes_S
+#define S(x)   BR_FLASH_BYTE(br_aes_S, x)
 
-static const uint32_t Ssm0[] = {
+static const uint32_t Ssm0[] BR_FAST_TABLE = {
 	0xC66363A5, 0xF87C7C84, 0xEE777799, 0xF67B7B8D, 0xFFF2F20D, 0xD66B6BBD,
 	0xDE6F6FB1, 0x91C5C554, 0x60303050, 0x02010103, 0xCE6767A9, 0x562B2B7D,
 	0xE7FEFE19, 0xB5D7D762, 0x4DABABE6, 0xEC76769A, 0x8FCACA45, 0x1F82829D,
@@ -85,7 +85,7 @@ rotr(uint32_t x, int n)
 
 
 /* see bearssl.h */
-void
+BR_FAST_FUNC void
 br_aes_big_encrypt(unsigned num_rounds, const uint32_t *skey, void *data)
 {
 	unsigned char *buf;
@@ -130,22 +130,22 @@ br_aes_big_encrypt(unsigned num_rounds, const uint32_t *skey, void *data)
 		s2 ^= skey[(u << 2) + 2];
 		s3 ^= skey[(u << 2) + 3];
 	}
-	t0 = ((uint32_t)S[s0 >> 24] << 24)
-		| ((uint32_t)S[(s1 >> 16) & 0xFF] << 16)
-		| ((uint32_t)S[(s2 >> 8) & 0xFF] << 8)
-		| (uint32_t)S[s3 & 0xFF];
-	t1 = ((uint32_t)S[s1 >> 24] << 24)
-		| ((uint32_t)S[(s2 >> 16) & 0xFF] << 16)
-		| ((uint32_t)S[(s3 >> 8) & 0xFF] << 8)
-		| (uint32_t)S[s0 & 0xFF];
-	t2 = ((uint32_t)S[s2 >> 24] << 24)
-		| ((uint32_t)S[(s3 >> 16) & 0xFF] << 16)
-		| ((uint32_t)S[(s0 >> 8) & 0xFF] << 8)
-		| (uint32_t)S[s1 & 0xFF];
-	t3 = ((uint32_t)S[s3 >> 24] << 24)
-		| ((uint32_t)S[(s0 >> 16) & 0xFF] << 16)
-		| ((uint32_t)S[(s1 >> 8) & 0xFF] << 8)
-		| (uint32_t)S[s2 & 0xFF];
+	t0 = ((uint32_t)S(s0 >> 24) << 24)
+		| ((uint32_t)S((s1 >> 16) & 0xFF) << 16)
+		| ((uint32_t)S((s2 >> 8) & 0xFF) << 8)
+		| (uint32_t)S(s3 & 0xFF);
+	t1 = ((uint32_t)S(s1 >> 24) << 24)
+		| ((uint32_t)S((s2 >> 16) & 0xFF) << 16)
+		| ((uint32_t)S((s3 >> 8) & 0xFF) << 8)
+		| (uint32_t)S(s0 & 0xFF);
+	t2 = ((uint32_t)S(s2 >> 24) << 24)
+		| ((uint32_t)S((s3 >> 16) & 0xFF) << 16)
+		| ((uint32_t)S((s0 >> 8) & 0xFF) << 8)
+		| (uint32_t)S(s1 & 0xFF);
+	t3 = ((uint32_t)S(s3 >> 24) << 24)
+		| ((uint32_t)S((s0 >> 16) & 0xFF) << 16)
+		| ((uint32_t)S((s1 >> 8) & 0xFF) << 8)
+		| (uint32_t)S(s2 & 0xFF);
 	s0 = t0 ^ skey[num_rounds << 2];
 	s1 = t1 ^ skey[(num_rounds << 2) + 1];
 	s2 = t2 ^ skey[(num_rounds << 2) + 2];
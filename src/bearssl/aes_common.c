@@ -24,15 +24,15 @@
 
 #include "inner.h"
 
-static const uint32_t Rcon[] = {
+static const uint32_t Rcon[] BR_FLASH_TABLE = {
 	0x01000000, 0x02000000, 0x04000000, 0x08000000, 0x10000000, 0x20000000,
 	0x40000000, 0x80000000, 0x1B000000, 0x36000000
 };
 
-#define S   br_aes_S
+#define S(x)   BR_FLASH_BYTE(br_aes_S, x)
 
 /* see inner.h */
-const unsigned char br_aes_S[] = {
+const unsigned char br_aes_S[] BR_FAST_TABLE BR_FLASH_TABLE = {
 	0x63, 0x7C, 0x77, 0x7B, 0xF2, 0x6B, 0x6F, 0xC5, 0x30, 0x01, 0x67, 0x2B,
 	0xFE, 0xD7, 0xAB, 0x76, 0xCA, 0x82, 0xC9, 0x7D, 0xFA, 0x59, 0x47, 0xF0,
 	0xAD, 0xD4, 0xA2, 0xAF, 0x9C, 0xA4, 0x72, 0xC0, 0xB7, 0xFD, 0x93, 0x26,
@@ -60,10 +60,10 @@ const unsigned char br_aes_S[] = {
 static uint32_t
 SubWord(uint32_t x)
 {
-	return ((uint32_t)S[x >> 24] << 24)
-		| ((uint32_t)S[(x >> 16) & 0xFF] << 16)
-		| ((uint32_t)S[(x >> 8) & 0xFF] << 8)
-		| (uint32_t)S[x & 0xFF];
+	return ((uint32_t)S(x >> 24) << 24)
+		| ((uint32_t)S((x >> 16) & 0xFF) << 16)
+		| ((uint32_t)S((x >> 8) & 0xFF) << 8)
+		| (uint32_t)S(x & 0xFF);
 }
 
 /* see inner.h */
@@ -98,7 +98,7 @@ br_aes_keysched(uint32_t *skey, const void *key, size_t key_len)
 		tmp = skey[i - 1];
 		if (j == 0) {
 			tmp = (tmp << 8) | (tmp >> 24);
-			tmp = SubWord(tmp) ^ Rcon[k];
+			tmp = SubWord(tmp) ^ BR_FLASH_U32(Rcon, k);
 		} else if (nk > 6 && j == 4) {
 			tmp = SubWord(tmp);
 		}
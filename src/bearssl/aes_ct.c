@@ -25,7 +25,7 @@
 #include "inner.h"
 
 /* see inner.h */
-void
+BR_FAST_FUNC void
 br_aes_ct_bitslice_Sbox(uint32_t *q)
 {
 	/*
@@ -202,7 +202,7 @@ br_aes_ct_bitslice_Sbox(uint32_t *q)
 }
 
 /* see inner.h */
-void
+BR_FAST_FUNC void
 br_aes_ct_ortho(uint32_t *q)
 {
 #define SWAPN(cl, ch, s, x, y)   do { \
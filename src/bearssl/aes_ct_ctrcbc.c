@@ -400,6 +400,242 @@ br_aes_ct_ctrcbc_decrypt(const br_aes_ct_ctrcbc_keys *ctx,
 	br_enc32le((unsigned char *)cbcmac + 12, cm3);
 }
 
+#ifdef ARDUINO
+
+/*
+ * Get block 'k' of the AAD as it is injected in CBC-MAC, i.e. with
+ * the encoded AAD length before it and zero padding at the end.
+ */
+static void
+ccm_aad_block(unsigned char *dst, size_t k,
+	const unsigned char *hdr, size_t hdr_len,
+	const unsigned char *aad, size_t aad_len)
+{
+	size_t u, off;
+
+	for (u = 0; u < 16; u ++) {
+		off = (k << 4) + u;
+		if (off < hdr_len) {
+			dst[u] = hdr[off];
+		} else if (off - hdr_len < aad_len) {
+			dst[u] = aad[off - hdr_len];
+		} else {
+			dst[u] = 0;
+		}
+	}
+}
+
+/* see bearssl_block.h */
+int
+br_aes_ct_ctrcbc_ccm_run(const br_aes_ct_ctrcbc_keys *ctx, int encrypt,
+	const void *nonce, size_t nonce_len, const void *aad, size_t aad_len,
+	void *data, size_t len, void *tag, size_t tag_len)
+{
+	/*
+	 * CBC-MAC is computed over B0, the AAD blocks and the plaintext
+	 * blocks (jobs m = 0, 1, ...), and CTR over the counter blocks
+	 * A0 (for the tag mask), A1, ... (jobs j = 0, 1, ...). CTR blocks
+	 * do not depend on the MAC, so iteration t runs MAC job t - ms
+	 * and CTR job t - cs in the two halves of the bitsliced core.
+	 * The offsets are chosen so that a plaintext block is MACed in
+	 * the same iteration as its encryption (read before it is
+	 * overwritten), or in an iteration after its decryption.
+	 */
+	unsigned char b0[16], hdr[10], tmp[16], tail[16], tagmask[16];
+	unsigned char *buf;
+	uint32_t iv0, iv1, iv2, iv3;
+	uint32_t cm0, cm1, cm2, cm3;
+	uint32_t sk_exp[120];
+	size_t hdr_len, aad_blocks, data_blocks, tail_len;
+	size_t mac_jobs, ctr_jobs, cs, ms, num, t, u;
+	uint64_t dl;
+	unsigned q;
+
+	if (nonce_len < 7 || nonce_len > 13) {
+		return 0;
+	}
+	if (tag_len < 4 || tag_len > 16 || (tag_len & 1) != 0) {
+		return 0;
+	}
+	q = 15 - (unsigned)nonce_len;
+
+	/*
+	 * Block B0 and the first counter block. The tag mask is CTR
+	 * output for A0, i.e. encryption of zeros.
+	 */
+	b0[0] = (aad_len > 0 ? 0x40 : 0x00)
+		| (((unsigned)tag_len - 2) << 2)
+		| (q - 1);
+	memcpy(b0 + 1, nonce, nonce_len);
+	dl = len;
+	for (u = 0; u < q; u ++) {
+		b0[15 - u] = (unsigned char)dl;
+		dl >>= 8;
+	}
+	if (dl != 0) {
+		return 0;
+	}
+	tmp[0] = q - 1;
+	memcpy(tmp + 1, nonce, nonce_len);
+	memset(tmp + 1 + nonce_len, 0, q);
+	iv0 = br_dec32be(tmp +  0);
+	iv1 = br_dec32be(tmp +  4);
+	iv2 = br_dec32be(tmp +  8);
+	iv3 = br_dec32be(tmp + 12);
+	memset(tagmask, 0, sizeof tagmask);
+
+	/*
+	 * AAD length header.
+	 */
+	if (aad_len == 0) {
+		hdr_len = 0;
+	} else if ((uint64_t)aad_len >> 32 != 0) {
+		hdr[0] = 0xFF;
+		hdr[1] = 0xFF;
+		br_enc64be(hdr + 2, (uint64_t)aad_len);
+		hdr_len = 10;
+	} else if (aad_len >= 0xFF00) {
+		hdr[0] = 0xFF;
+		hdr[1] = 0xFE;
+		br_enc32be(hdr + 2, (uint32_t)aad_len);
+		hdr_len = 6;
+	} else {
+		br_enc16be(hdr, (unsigned)aad_len);
+		hdr_len = 2;
+	}
+
+	/*
+	 * A partial last block is processed in tail[], zero-padded.
+	 */
+	buf = data;
+	aad_blocks = (hdr_len + aad_len + 15) >> 4;
+	data_blocks = (len + 15) >> 4;
+	tail_len = len & 15;
+	memset(tail, 0, sizeof tail);
+	if (tail_len != 0) {
+		memcpy(tail, buf + len - tail_len, tail_len);
+	}
+	mac_jobs = 1 + aad_blocks + data_blocks;
+	ctr_jobs = 1 + data_blocks;
+	if (encrypt) {
+		cs = aad_blocks;
+		ms = 0;
+	} else if (aad_blocks > 0) {
+		cs = aad_blocks - 1;
+		ms = 0;
+	} else {
+		cs = 0;
+		ms = 1;
+	}
+	num = cs + ctr_jobs;
+	if (num < ms + mac_jobs) {
+		num = ms + mac_jobs;
+	}
+
+	br_aes_ct_skey_expand(sk_exp, ctx->num_rounds, ctx->skey);
+	cm0 = 0;
+	cm1 = 0;
+	cm2 = 0;
+	cm3 = 0;
+	for (t = 0; t < num; t ++) {
+		uint32_t qq[8], carry;
+		const unsigned char *mblk;
+		unsigned char *cblk;
+		size_t j;
+
+		mblk = NULL;
+		cblk = NULL;
+		if (t >= ms && t - ms < mac_jobs) {
+			j = t - ms;
+			if (j == 0) {
+				mblk = b0;
+			} else if (j <= aad_blocks) {
+				ccm_aad_block(tmp, j - 1,
+					hdr, hdr_len, aad, aad_len);
+				mblk = tmp;
+			} else if (j - aad_blocks == data_blocks
+				&& tail_len != 0)
+			{
+				mblk = tail;
+			} else {
+				mblk = buf + ((j - aad_blocks - 1) << 4);
+			}
+		}
+		if (t >= cs && t - cs < ctr_jobs) {
+			j = t - cs;
+			if (j == 0) {
+				cblk = tagmask;
+			} else if (j == data_blocks && tail_len != 0) {
+				cblk = tail;
+			} else {
+				cblk = buf + ((j - 1) << 4);
+			}
+		}
+
+		qq[0] = br_swap32(iv0);
+		qq[2] = br_swap32(iv1);
+		qq[4] = br_swap32(iv2);
+		qq[6] = br_swap32(iv3);
+		if (mblk != NULL) {
+			qq[1] = cm0 ^ br_dec32le(mblk +  0);
+			qq[3] = cm1 ^ br_dec32le(mblk +  4);
+			qq[5] = cm2 ^ br_dec32le(mblk +  8);
+			qq[7] = cm3 ^ br_dec32le(mblk + 12);
+		} else {
+			qq[1] = 0;
+			qq[3] = 0;
+			qq[5] = 0;
+			qq[7] = 0;
+		}
+
+		br_aes_ct_ortho(qq);
+		br_aes_ct_bitslice_encrypt(ctx->num_rounds, sk_exp, qq);
+		br_aes_ct_ortho(qq);
+
+		if (mblk != NULL) {
+			cm0 = qq[1];
+			cm1 = qq[3];
+			cm2 = qq[5];
+			cm3 = qq[7];
+		}
+		if (cblk != NULL) {
+			br_enc32le(cblk +  0, qq[0] ^ br_dec32le(cblk +  0));
+			br_enc32le(cblk +  4, qq[2] ^ br_dec32le(cblk +  4));
+			br_enc32le(cblk +  8, qq[4] ^ br_dec32le(cblk +  8));
+			br_enc32le(cblk + 12, qq[6] ^ br_dec32le(cblk + 12));
+			if (cblk == tail && !encrypt) {
+				/*
+				 * CBC-MAC covers the plaintext padded
+				 * with zeros, not the extra stream bytes.
+				 */
+				memset(tail + tail_len, 0,
+					(sizeof tail) - tail_len);
+			}
+			iv3 ++;
+			carry = ~(iv3 | -iv3) >> 31;
+			iv2 += carry;
+			carry &= -(~(iv2 | -iv2) >> 31);
+			iv1 += carry;
+			carry &= -(~(iv1 | -iv1) >> 31);
+			iv0 += carry;
+		}
+	}
+	if (tail_len != 0) {
+		memcpy(buf + len - tail_len, tail, tail_len);
+	}
+
+	br_enc32le(tmp +  0, cm0);
+	br_enc32le(tmp +  4, cm1);
+	br_enc32le(tmp +  8, cm2);
+	br_enc32le(tmp + 12, cm3);
+	for (u = 0; u < tag_len; u ++) {
+		((unsigned char *)tag)[u] = tmp[u] ^ tagmask[u];
+	}
+	return 1;
+}
+
+#endif
+
 /* see bearssl_block.h */
 const br_block_ctrcbc_class br_aes_ct_ctrcbc_vtable = {
 	sizeof(br_aes_ct_ctrcbc_keys),
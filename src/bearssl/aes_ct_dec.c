@@ -25,7 +25,7 @@
 #include "inner.h"
 
 /* see inner.h */
-void
+BR_FAST_FUNC void
 br_aes_ct_bitslice_invSbox(uint32_t *q)
 {
 	/*
@@ -151,7 +151,7 @@ inv_mix_columns(uint32_t *q)
 }
 
 /* see inner.h */
-void
+BR_FAST_FUNC void
 br_aes_ct_bitslice_decrypt(unsigned num_rounds,
 	const uint32_t *skey, uint32_t *q)
 {
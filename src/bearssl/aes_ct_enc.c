@@ -93,7 +93,7 @@ mix_columns(uint32_t *q)
 }
 
 /* see inner.h */
-void
+BR_FAST_FUNC void
 br_aes_ct_bitslice_encrypt(unsigned num_rounds,
 	const uint32_t *skey, uint32_t *q)
 {
@@ -0,0 +1,379 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "inner.h"
+
+#if BR_AES_HW
+
+#if BR_AES_HW_ESP32
+#if defined __has_include
+#if __has_include("aes/esp_aes.h")
+#include "aes/esp_aes.h"
+#elif __has_include("esp32/aes.h")
+#include "esp32/aes.h"
+#else
+#include "hwcrypto/aes.h"
+#endif
+#else
+#include "hwcrypto/aes.h"
+#endif
+#elif BR_AES_HW_SAMD51
+#include <sam.h>
+#elif BR_AES_HW_NRF52
+#include <nrf.h>
+#endif
+
+/*
+ * Key lengths handled by the peripheral, others use aes_ct.
+ */
+static int
+hw_key_len(size_t len)
+{
+#if BR_AES_HW_ESP32
+	return len == 16 || len == 32;
+#elif BR_AES_HW_SAMD51
+	return len == 16 || len == 24 || len == 32;
+#else
+	return len == 16;
+#endif
+}
+
+#if BR_AES_HW_SAMD51
+
+/*
+ * Encrypt or decrypt one block in place, in ECB mode.
+ */
+static void
+hw_ecb(const unsigned char *key, size_t key_len,
+	int encrypt, unsigned char *block)
+{
+	size_t u;
+
+	MCLK->APBCMASK.reg |= MCLK_APBCMASK_AES;
+	AES->CTRLA.reg = 0;
+	AES->CTRLA.reg = AES_CTRLA_AESMODE(0)
+		| AES_CTRLA_KEYSIZE((key_len >> 3) - 2)
+		| (encrypt ? AES_CTRLA_CIPHER : 0);
+	AES->CTRLA.reg |= AES_CTRLA_ENABLE;
+	for (u = 0; u < (key_len >> 2); u ++) {
+		AES->KEYWORD[u].reg = br_dec32le(key + (u << 2));
+	}
+	for (u = 0; u < 4; u ++) {
+		AES->DATABUFPTR.reg = u;
+		AES->INDATA.reg = br_dec32le(block + (u << 2));
+	}
+	AES->CTRLB.reg |= AES_CTRLB_START;
+	while (!(AES->INTFLAG.reg & AES_INTFLAG_ENCCMP));
+	for (u = 0; u < 4; u ++) {
+		AES->DATABUFPTR.reg = u;
+		br_enc32le(block + (u << 2), AES->INDATA.reg);
+	}
+	AES->CTRLA.reg = 0;
+}
+
+#elif BR_AES_HW_NRF52
+
+/*
+ * The ECB peripheral reads key and cleartext from, and writes the
+ * ciphertext to, this structure in RAM.
+ */
+static struct {
+	unsigned char key[16];
+	unsigned char cleartext[16];
+	unsigned char ciphertext[16];
+} hw_ecb_data;
+
+/*
+ * Encrypt one block in place, in ECB mode. An encryption can be
+ * aborted when the radio needs the peripheral, and is then restarted.
+ */
+static void
+hw_ecb(const unsigned char *key, size_t key_len,
+	int encrypt, unsigned char *block)
+{
+	(void)key_len;
+	(void)encrypt;
+	memcpy(hw_ecb_data.key, key, 16);
+	memcpy(hw_ecb_data.cleartext, block, 16);
+	do {
+		NRF_ECB->ECBDATAPTR = (uint32_t)&hw_ecb_data;
+		NRF_ECB->EVENTS_ENDECB = 0;
+		NRF_ECB->EVENTS_ERRORECB = 0;
+		NRF_ECB->TASKS_STARTECB = 1;
+		while (NRF_ECB->EVENTS_ENDECB == 0
+			&& NRF_ECB->EVENTS_ERRORECB == 0);
+	} while (NRF_ECB->EVENTS_ENDECB == 0);
+	memcpy(block, hw_ecb_data.ciphertext, 16);
+	memset(&hw_ecb_data, 0, sizeof hw_ecb_data);
+}
+
+#endif
+
+#if !BR_AES_HW_ESP32
+static void
+xor_block(unsigned char *dst, const unsigned char *src)
+{
+	int i;
+
+	for (i = 0; i < 16; i ++) {
+		dst[i] ^= src[i];
+	}
+}
+#endif
+
+static void
+hw_cbcenc_init(const br_block_cbcenc_class **ctx,
+	const void *key, size_t len)
+{
+	br_aes_hw_cbcenc_keys *kc;
+
+	kc = (br_aes_hw_cbcenc_keys *)ctx;
+	if (!hw_key_len(len)) {
+		br_aes_ct_cbcenc_init(&kc->c_ct, key, len);
+		return;
+	}
+	kc->c_hw.vtable = br_aes_hw_cbcenc_get_vtable();
+	memcpy(kc->c_hw.key, key, len);
+	kc->c_hw.key_len = len;
+}
+
+static void
+hw_cbcenc_run(const br_block_cbcenc_class *const *ctx,
+	void *iv, void *data, size_t len)
+{
+	const br_aes_hw_cbcenc_keys *kc;
+#if BR_AES_HW_ESP32
+	esp_aes_context ac;
+
+	kc = (const br_aes_hw_cbcenc_keys *)ctx;
+	esp_aes_init(&ac);
+	esp_aes_setkey(&ac, kc->c_hw.key, kc->c_hw.key_len << 3);
+	esp_aes_crypt_cbc(&ac, ESP_AES_ENCRYPT, len, iv, data, data);
+	esp_aes_free(&ac);
+#else
+	unsigned char *buf, *ivbuf;
+
+	kc = (const br_aes_hw_cbcenc_keys *)ctx;
+	buf = data;
+	ivbuf = iv;
+	while (len > 0) {
+		xor_block(ivbuf, buf);
+		hw_ecb(kc->c_hw.key, kc->c_hw.key_len, 1, ivbuf);
+		memcpy(buf, ivbuf, 16);
+		buf += 16;
+		len -= 16;
+	}
+#endif
+}
+
+static const br_block_cbcenc_class hw_cbcenc_vtable = {
+	sizeof(br_aes_hw_cbcenc_keys),
+	16,
+	4,
+	&hw_cbcenc_init,
+	&hw_cbcenc_run
+};
+
+/* see bearssl_block.h */
+const br_block_cbcenc_class *
+br_aes_hw_cbcenc_get_vtable(void)
+{
+	return &hw_cbcenc_vtable;
+}
+
+#if !BR_AES_HW_NRF52
+
+static void
+hw_cbcdec_init(const br_block_cbcdec_class **ctx,
+	const void *key, size_t len)
+{
+	br_aes_hw_cbcdec_keys *kc;
+
+	kc = (br_aes_hw_cbcdec_keys *)ctx;
+	if (!hw_key_len(len)) {
+		br_aes_ct_cbcdec_init(&kc->c_ct, key, len);
+		return;
+	}
+	kc->c_hw.vtable = br_aes_hw_cbcdec_get_vtable();
+	memcpy(kc->c_hw.key, key, len);
+	kc->c_hw.key_len = len;
+}
+
+static void
+hw_cbcdec_run(const br_block_cbcdec_class *const *ctx,
+	void *iv, void *data, size_t len)
+{
+	const br_aes_hw_cbcdec_keys *kc;
+#if BR_AES_HW_ESP32
+	esp_aes_context ac;
+
+	kc = (const br_aes_hw_cbcdec_keys *)ctx;
+	esp_aes_init(&ac);
+	esp_aes_setkey(&ac, kc->c_hw.key, kc->c_hw.key_len << 3);
+	esp_aes_crypt_cbc(&ac, ESP_AES_DECRYPT, len, iv, data, data);
+	esp_aes_free(&ac);
+#else
+	unsigned char *buf, *ivbuf;
+	unsigned char tmp[16];
+
+	kc = (const br_aes_hw_cbcdec_keys *)ctx;
+	buf = data;
+	ivbuf = iv;
+	while (len > 0) {
+		memcpy(tmp, buf, 16);
+		hw_ecb(kc->c_hw.key, kc->c_hw.key_len, 0, buf);
+		xor_block(buf, ivbuf);
+		memcpy(ivbuf, tmp, 16);
+		buf += 16;
+		len -= 16;
+	}
+#endif
+}
+
+static const br_block_cbcdec_class hw_cbcdec_vtable = {
+	sizeof(br_aes_hw_cbcdec_keys),
+	16,
+	4,
+	&hw_cbcdec_init,
+	&hw_cbcdec_run
+};
+
+/* see bearssl_block.h */
+const br_block_cbcdec_class *
+br_aes_hw_cbcdec_get_vtable(void)
+{
+	return &hw_cbcdec_vtable;
+}
+
+#else
+
+/* see bearssl_block.h */
+const br_block_cbcdec_class *
+br_aes_hw_cbcdec_get_vtable(void)
+{
+	return NULL;
+}
+
+#endif
+
+static void
+hw_ctr_init(const br_block_ctr_class **ctx,
+	const void *key, size_t len)
+{
+	br_aes_hw_ctr_keys *kc;
+
+	kc = (br_aes_hw_ctr_keys *)ctx;
+	if (!hw_key_len(len)) {
+		br_aes_ct_ctr_init(&kc->c_ct, key, len);
+		return;
+	}
+	kc->c_hw.vtable = br_aes_hw_ctr_get_vtable();
+	memcpy(kc->c_hw.key, key, len);
+	kc->c_hw.key_len = len;
+}
+
+static uint32_t
+hw_ctr_run(const br_block_ctr_class *const *ctx,
+	const void *iv, uint32_t cc, void *data, size_t len)
+{
+	const br_aes_hw_ctr_keys *kc;
+	unsigned char ctr[16];
+#if BR_AES_HW_ESP32
+	esp_aes_context ac;
+	unsigned char stream[16];
+	size_t off;
+
+	kc = (const br_aes_hw_ctr_keys *)ctx;
+	memcpy(ctr, iv, 12);
+	br_enc32be(ctr + 12, cc);
+	off = 0;
+	esp_aes_init(&ac);
+	esp_aes_setkey(&ac, kc->c_hw.key, kc->c_hw.key_len << 3);
+	esp_aes_crypt_ctr(&ac, len, &off, ctr, stream, data, data);
+	esp_aes_free(&ac);
+	memset(stream, 0, sizeof stream);
+	return cc + (uint32_t)((len + 15) >> 4);
+#else
+	unsigned char *buf;
+
+	kc = (const br_aes_hw_ctr_keys *)ctx;
+	buf = data;
+	while (len > 0) {
+		size_t clen;
+		size_t u;
+
+		memcpy(ctr, iv, 12);
+		br_enc32be(ctr + 12, cc ++);
+		hw_ecb(kc->c_hw.key, kc->c_hw.key_len, 1, ctr);
+		clen = len < 16 ? len : 16;
+		for (u = 0; u < clen; u ++) {
+			buf[u] ^= ctr[u];
+		}
+		buf += clen;
+		len -= clen;
+	}
+	memset(ctr, 0, sizeof ctr);
+	return cc;
+#endif
+}
+
+static const br_block_ctr_class hw_ctr_vtable = {
+	sizeof(br_aes_hw_ctr_keys),
+	16,
+	4,
+	&hw_ctr_init,
+	&hw_ctr_run
+};
+
+/* see bearssl_block.h */
+const br_block_ctr_class *
+br_aes_hw_ctr_get_vtable(void)
+{
+	return &hw_ctr_vtable;
+}
+
+#else
+
+/* see bearssl_block.h */
+const br_block_cbcenc_class *
+br_aes_hw_cbcenc_get_vtable(void)
+{
+	return NULL;
+}
+
+/* see bearssl_block.h */
+const br_block_cbcdec_class *
+br_aes_hw_cbcdec_get_vtable(void)
+{
+	return NULL;
+}
+
+/* see bearssl_block.h */
+const br_block_ctr_class *
+br_aes_hw_ctr_get_vtable(void)
+{
+	return NULL;
+}
+
+#endif
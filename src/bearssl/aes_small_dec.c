@@ -27,7 +27,7 @@
 /*
  * Inverse S-box.
  */
-static const unsigned char iS[] = {
+static const unsigned char iS[] BR_FLASH_TABLE = {
 	0x52, 0x09, 0x6A, 0xD5, 0x30, 0x36, 0xA5, 0x38, 0xBF, 0x40, 0xA3, 0x9E,
 	0x81, 0xF3, 0xD7, 0xFB, 0x7C, 0xE3, 0x39, 0x82, 0x9B, 0x2F, 0xFF, 0x87,
 	0x34, 0x8E, 0x43, 0x44, 0xC4, 0xDE, 0xE9, 0xCB, 0x54, 0x7B, 0x94, 0x32,
@@ -74,7 +74,7 @@ inv_sub_bytes(unsigned *state)
 	int i;
 
 	for (i = 0; i < 16; i ++) {
-		state[i] = iS[state[i]];
+		state[i] = BR_FLASH_BYTE(iS, state[i]);
 	}
 }
 
@@ -24,7 +24,7 @@
 
 #include "inner.h"
 
-#define S   br_aes_S
+#define S(x)   BR_FLASH_BYTE(br_aes_S, x)
 
 static void
 add_round_key(unsigned *state, const uint32_t *skeys)
@@ -48,7 +48,7 @@ sub_bytes(unsigned *state)
 	int i;
 
 	for (i = 0; i < 16; i ++) {
-		state[i] = S[state[i]];
+		state[i] = S(state[i]);
 	}
 }
 
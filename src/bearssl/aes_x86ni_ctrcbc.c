@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define BR_ENABLE_INTRINSICS   1
+#include "inner.h"
+
+#if BR_AES_X86NI
+
+/* see bearssl_block.h */
+const br_block_ctrcbc_class *
+br_aes_x86ni_ctrcbc_get_vtable(void)
+{
+	return br_aes_x86ni_supported() ? &br_aes_x86ni_ctrcbc_vtable : NULL;
+}
+
+/* see bearssl_block.h */
+void
+br_aes_x86ni_ctrcbc_init(br_aes_x86ni_ctrcbc_keys *ctx,
+	const void *key, size_t len)
+{
+	ctx->vtable = &br_aes_x86ni_ctrcbc_vtable;
+	ctx->num_rounds = br_aes_x86ni_keysched_enc(ctx->skey.skni, key, len);
+}
+
+/*
+ * Write the current counter value (big-endian, 128 bits) in dst[],
+ * then increment it.
+ */
+static inline void
+next_counter(unsigned char *dst, uint64_t *hi, uint64_t *lo)
+{
+	br_enc64be(dst, *hi);
+	br_enc64be(dst + 8, *lo);
+	*lo += 1;
+	*hi += (uint64_t)(*lo == 0);
+}
+
+BR_TARGETS_X86_UP
+
+BR_TARGET("sse2,aes")
+static inline unsigned
+load_subkeys(__m128i *sk, const br_aes_x86ni_ctrcbc_keys *ctx)
+{
+	unsigned u, num_rounds;
+
+	num_rounds = ctx->num_rounds;
+	for (u = 0; u <= num_rounds; u ++) {
+		sk[u] = _mm_loadu_si128((void *)(ctx->skey.skni + (u << 4)));
+	}
+	return num_rounds;
+}
+
+BR_TARGET("sse2,aes")
+static inline __m128i
+aes_enc1(const __m128i *sk, unsigned num_rounds, __m128i x)
+{
+	unsigned u;
+
+	x = _mm_xor_si128(x, sk[0]);
+	for (u = 1; u < num_rounds; u ++) {
+		x = _mm_aesenc_si128(x, sk[u]);
+	}
+	return _mm_aesenclast_si128(x, sk[num_rounds]);
+}
+
+/*
+ * Encrypt two independent blocks; the AES-NI opcodes are pipelined,
+ * so this costs about as much as a single block.
+ */
+BR_TARGET("sse2,aes")
+static inline void
+aes_enc2(const __m128i *sk, unsigned num_rounds, __m128i *x0, __m128i *x1)
+{
+	__m128i y0, y1;
+	unsigned u;
+
+	y0 = _mm_xor_si128(*x0, sk[0]);
+	y1 = _mm_xor_si128(*x1, sk[0]);
+	for (u = 1; u < num_rounds; u ++) {
+		y0 = _mm_aesenc_si128(y0, sk[u]);
+		y1 = _mm_aesenc_si128(y1, sk[u]);
+	}
+	*x0 = _mm_aesenclast_si128(y0, sk[num_rounds]);
+	*x1 = _mm_aesenclast_si128(y1, sk[num_rounds]);
+}
+
+/* see bearssl_block.h */
+BR_TARGET("sse2,aes")
+void
+br_aes_x86ni_ctrcbc_ctr(const br_aes_x86ni_ctrcbc_keys *ctx,
+	void *ctr, void *data, size_t len)
+{
+	unsigned char *buf;
+	unsigned char tmp[32];
+	__m128i sk[15];
+	uint64_t hi, lo;
+	unsigned num_rounds;
+
+	num_rounds = load_subkeys(sk, ctx);
+	hi = br_dec64be(ctr);
+	lo = br_dec64be((unsigned char *)ctr + 8);
+	buf = data;
+	while (len > 0) {
+		__m128i x0, x1;
+
+		next_counter(tmp, &hi, &lo);
+		if (len >= 32) {
+			next_counter(tmp + 16, &hi, &lo);
+		}
+		x0 = _mm_loadu_si128((void *)tmp);
+		x1 = _mm_loadu_si128((void *)(tmp + 16));
+		aes_enc2(sk, num_rounds, &x0, &x1);
+		x0 = _mm_xor_si128(x0, _mm_loadu_si128((void *)buf));
+		_mm_storeu_si128((void *)buf, x0);
+		if (len >= 32) {
+			x1 = _mm_xor_si128(x1,
+				_mm_loadu_si128((void *)(buf + 16)));
+			_mm_storeu_si128((void *)(buf + 16), x1);
+			buf += 32;
+			len -= 32;
+		} else {
+			buf += 16;
+			len -= 16;
+		}
+	}
+	br_enc64be(ctr, hi);
+	br_enc64be((unsigned char *)ctr + 8, lo);
+}
+
+/* see bearssl_block.h */
+BR_TARGET("sse2,aes")
+void
+br_aes_x86ni_ctrcbc_mac(const br_aes_x86ni_ctrcbc_keys *ctx,
+	void *cbcmac, const void *data, size_t len)
+{
+	const unsigned char *buf;
+	__m128i sk[15], cm;
+	unsigned num_rounds;
+
+	num_rounds = load_subkeys(sk, ctx);
+	cm = _mm_loadu_si128(cbcmac);
+	buf = data;
+	while (len > 0) {
+		cm = _mm_xor_si128(cm, _mm_loadu_si128((const void *)buf));
+		cm = aes_enc1(sk, num_rounds, cm);
+		buf += 16;
+		len -= 16;
+	}
+	_mm_storeu_si128(cbcmac, cm);
+}
+
+/* see bearssl_block.h */
+BR_TARGET("sse2,aes")
+void
+br_aes_x86ni_ctrcbc_encrypt(const br_aes_x86ni_ctrcbc_keys *ctx,
+	void *ctr, void *cbcmac, void *data, size_t len)
+{
+	/*
+	 * CBC-MAC runs over the encrypted blocks, so it lags by one
+	 * block: each iteration encrypts the next counter along with
+	 * the CBC-MAC input of the previous block.
+	 */
+	unsigned char *buf;
+	unsigned char tmp[16];
+	__m128i sk[15], cm;
+	uint64_t hi, lo;
+	unsigned num_rounds;
+	int first_iter;
+
+	num_rounds = load_subkeys(sk, ctx);
+	hi = br_dec64be(ctr);
+	lo = br_dec64be((unsigned char *)ctr + 8);
+	cm = _mm_loadu_si128(cbcmac);
+	buf = data;
+	first_iter = 1;
+	while (len > 0) {
+		__m128i x;
+
+		next_counter(tmp, &hi, &lo);
+		x = _mm_loadu_si128((void *)tmp);
+		if (first_iter) {
+			x = aes_enc1(sk, num_rounds, x);
+			first_iter = 0;
+		} else {
+			aes_enc2(sk, num_rounds, &x, &cm);
+		}
+		x = _mm_xor_si128(x, _mm_loadu_si128((void *)buf));
+		_mm_storeu_si128((void *)buf, x);
+		cm = _mm_xor_si128(cm, x);
+		buf += 16;
+		len -= 16;
+	}
+	if (!first_iter) {
+		cm = aes_enc1(sk, num_rounds, cm);
+	}
+	br_enc64be(ctr, hi);
+	br_enc64be((unsigned char *)ctr + 8, lo);
+	_mm_storeu_si128(cbcmac, cm);
+}
+
+/* see bearssl_block.h */
+BR_TARGET("sse2,aes")
+void
+br_aes_x86ni_ctrcbc_decrypt(const br_aes_x86ni_ctrcbc_keys *ctx,
+	void *ctr, void *cbcmac, void *data, size_t len)
+{
+	unsigned char *buf;
+	unsigned char tmp[16];
+	__m128i sk[15], cm;
+	uint64_t hi, lo;
+	unsigned num_rounds;
+
+	num_rounds = load_subkeys(sk, ctx);
+	hi = br_dec64be(ctr);
+	lo = br_dec64be((unsigned char *)ctr + 8);
+	cm = _mm_loadu_si128(cbcmac);
+	buf = data;
+	while (len > 0) {
+		__m128i x, y;
+
+		y = _mm_loadu_si128((void *)buf);
+		next_counter(tmp, &hi, &lo);
+		x = _mm_loadu_si128((void *)tmp);
+		cm = _mm_xor_si128(cm, y);
+		aes_enc2(sk, num_rounds, &x, &cm);
+		_mm_storeu_si128((void *)buf, _mm_xor_si128(x, y));
+		buf += 16;
+		len -= 16;
+	}
+	br_enc64be(ctr, hi);
+	br_enc64be((unsigned char *)ctr + 8, lo);
+	_mm_storeu_si128(cbcmac, cm);
+}
+
+BR_TARGETS_X86_DOWN
+
+/* see bearssl_block.h */
+const br_block_ctrcbc_class br_aes_x86ni_ctrcbc_vtable = {
+	sizeof(br_aes_x86ni_ctrcbc_keys),
+	16,
+	4,
+	(void (*)(const br_block_ctrcbc_class **, const void *, size_t))
+		&br_aes_x86ni_ctrcbc_init,
+	(void (*)(const br_block_ctrcbc_class *const *,
+		void *, void *, void *, size_t))
+		&br_aes_x86ni_ctrcbc_encrypt,
+	(void (*)(const br_block_ctrcbc_class *const *,
+		void *, void *, void *, size_t))
+		&br_aes_x86ni_ctrcbc_decrypt,
+	(void (*)(const br_block_ctrcbc_class *const *,
+		void *, void *, size_t))
+		&br_aes_x86ni_ctrcbc_ctr,
+	(void (*)(const br_block_ctrcbc_class *const *,
+		void *, const void *, size_t))
+		&br_aes_x86ni_ctrcbc_mac
+};
+
+#else
+
+/* see bearssl_block.h */
+const br_block_ctrcbc_class *
+br_aes_x86ni_ctrcbc_get_vtable(void)
+{
+	return NULL;
+}
+
+#endif
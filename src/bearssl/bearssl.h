@@ -167,4 +167,23 @@ typedef struct {
  */
 const br_config_option *br_get_config(void);
 
+#ifdef ARDUINO
+/** \brief Set the lock of the static scratch area.
+ *
+ * With `BR_STATIC_SCRATCH` (see `"config.h"`), the RSA private and
+ * public key operations of the "i15" and "i31" code, and the ECDSA
+ * signature verification, take their work area from a single static
+ * buffer instead of the stack. When these may run from several tasks at
+ * the same time, a lock must be set: `lock` is called with `acquire`
+ * set to 1 before the buffer is used, and with `acquire` set to 0 once
+ * it is free again (e.g. to take and give a FreeRTOS mutex). `NULL`
+ * removes the lock. Without `BR_STATIC_SCRATCH` this function does not
+ * exist.
+ *
+ * \param lock   lock callback (or `NULL`).
+ * \param ctx    context pointer for the callback.
+ */
+void br_scratch_set_lock(void (*lock)(void *ctx, int acquire), void *ctx);
+#endif
+
 #endif
@@ -300,6 +300,7 @@ extern "C" {
  * | aes_ct64  | AES      |        16          | 16, 24 and 32       |
  * | aes_x86ni | AES      |        16          | 16, 24 and 32       |
  * | aes_pwr8  | AES      |        16          | 16, 24 and 32       |
+ * | aes_armv8 | AES      |        16          | 16, 24 and 32       |
  * | des_ct    | DES/3DES |         8          | 8, 16 and 24        |
  * | des_tab   | DES/3DES |         8          | 8, 16 and 24        |
  *
@@ -339,6 +340,9 @@ extern "C" {
  * 64-bit, both little-endian and big-endian). It uses the AES opcodes
  * present in POWER8 and later.
  *
+ * `aes_armv8` exists only on AArch64, when the compiler targets the ARMv8
+ * Cryptography Extensions (e.g. `-march=armv8-a+crypto`).
+ *
  * `des_tab` is a classic, table-based implementation of DES/3DES. It
  * is not constant-time.
  *
@@ -1348,6 +1352,37 @@ void br_aes_ct_ctrcbc_ctr(const br_aes_ct_ctrcbc_keys *ctx,
 void br_aes_ct_ctrcbc_mac(const br_aes_ct_ctrcbc_keys *ctx,
 	void *cbcmac, const void *data, size_t len);
 
+#ifdef ARDUINO
+
+/**
+ * \brief One-shot CCM with AES (`aes_ct` implementation).
+ *
+ * This computes the same result as the generic CCM code (`br_ccm_*`
+ * functions) over a `aes_ct` CTR+CBC-MAC context, but in a single
+ * pass in which each call to the bitsliced core computes one CTR block
+ * and one CBC-MAC block: the tag mask along with B0, the first data
+ * counter along with the AAD, and so on. The data is encrypted or
+ * decrypted in place; the tag is always computed (when decrypting,
+ * the caller compares it with the received value).
+ *
+ * \param ctx         context (already initialised).
+ * \param encrypt     non-zero for encryption, zero for decryption.
+ * \param nonce       nonce (7 to 13 bytes).
+ * \param nonce_len   nonce length (in bytes).
+ * \param aad         additional authenticated data.
+ * \param aad_len     AAD length (in bytes).
+ * \param data        data to encrypt or decrypt (updated).
+ * \param len         data length (in bytes).
+ * \param tag         output buffer for the tag.
+ * \param tag_len     tag length (4 to 16 bytes, even).
+ * \return  1 on success, 0 if a parameter is not supported by CCM.
+ */
+int br_aes_ct_ctrcbc_ccm_run(const br_aes_ct_ctrcbc_keys *ctx, int encrypt,
+	const void *nonce, size_t nonce_len, const void *aad, size_t aad_len,
+	void *data, size_t len, void *tag, size_t tag_len);
+
+#endif
+
 /*
  * 64-bit constant-time AES implementation. It is similar to 'aes_ct'
  * but uses 64-bit registers, making it about twice faster than 'aes_ct'
@@ -2151,6 +2186,378 @@ const br_block_ctr_class *br_aes_pwr8_ctr_get_vtable(void);
  */
 const br_block_ctrcbc_class *br_aes_pwr8_ctrcbc_get_vtable(void);
 
+#ifdef ARDUINO
+
+/*
+ * AES implementation "aes_hw" uses the AES peripheral of the board
+ * (SAMD51, nRF52, ESP32), see BR_AES_HW in config.h. Key lengths the
+ * peripheral does not handle fall back to "aes_ct": the init function
+ * then sets the context up for that implementation instead, which is
+ * why the contexts are unions. The nRF52 peripheral only encrypts, so
+ * there is no CBC decryption there.
+ */
+
+/**
+ * \brief Context for AES subkeys (`aes_hw` implementation, CBC encryption).
+ */
+typedef union {
+	const br_block_cbcenc_class *vtable;
+	br_aes_ct_cbcenc_keys c_ct;
+	struct {
+		const br_block_cbcenc_class *vtable;
+		unsigned char key[32];
+		size_t key_len;
+	} c_hw;
+} br_aes_hw_cbcenc_keys;
+
+/**
+ * \brief Context for AES subkeys (`aes_hw` implementation, CBC decryption).
+ */
+typedef union {
+	const br_block_cbcdec_class *vtable;
+	br_aes_ct_cbcdec_keys c_ct;
+	struct {
+		const br_block_cbcdec_class *vtable;
+		unsigned char key[32];
+		size_t key_len;
+	} c_hw;
+} br_aes_hw_cbcdec_keys;
+
+/**
+ * \brief Context for AES subkeys (`aes_hw` implementation, CTR encryption
+ * and decryption).
+ */
+typedef union {
+	const br_block_ctr_class *vtable;
+	br_aes_ct_ctr_keys c_ct;
+	struct {
+		const br_block_ctr_class *vtable;
+		unsigned char key[32];
+		size_t key_len;
+	} c_hw;
+} br_aes_hw_ctr_keys;
+
+/**
+ * \brief Obtain the `aes_hw` AES-CBC (encryption) implementation, if
+ * available.
+ *
+ * \return  the `aes_hw` AES-CBC (encryption) implementation, or `NULL`.
+ */
+const br_block_cbcenc_class *br_aes_hw_cbcenc_get_vtable(void);
+
+/**
+ * \brief Obtain the `aes_hw` AES-CBC (decryption) implementation, if
+ * available.
+ *
+ * \return  the `aes_hw` AES-CBC (decryption) implementation, or `NULL`.
+ */
+const br_block_cbcdec_class *br_aes_hw_cbcdec_get_vtable(void);
+
+/**
+ * \brief Obtain the `aes_hw` AES-CTR implementation, if available.
+ *
+ * \return  the `aes_hw` AES-CTR implementation, or `NULL`.
+ */
+const br_block_ctr_class *br_aes_hw_ctr_get_vtable(void);
+
+#endif
+
+#ifdef ARDUINO
+
+/*
+ * AES implementation using the ARMv8 Cryptography Extensions (AArch64),
+ * see BR_ARMV8_CE in inner.h.
+ */
+
+/** \brief AES block size (16 bytes). */
+#define br_aes_armv8_BLOCK_SIZE   16
+
+/**
+ * \brief Context for AES subkeys (`aes_armv8` implementation, CBC encryption).
+ *
+ * First field is a pointer to the vtable; it is set by the initialisation
+ * function. Other fields are not supposed to be accessed by user code.
+ */
+typedef struct {
+	/** \brief Pointer to vtable for this context. */
+	const br_block_cbcenc_class *vtable;
+#ifndef BR_DOXYGEN_IGNORE
+	union {
+		unsigned char sk[16 * 15];
+	} skey;
+	unsigned num_rounds;
+#endif
+} br_aes_armv8_cbcenc_keys;
+
+/**
+ * \brief Context for AES subkeys (`aes_armv8` implementation, CBC decryption).
+ *
+ * First field is a pointer to the vtable; it is set by the initialisation
+ * function. Other fields are not supposed to be accessed by user code.
+ */
+typedef struct {
+	/** \brief Pointer to vtable for this context. */
+	const br_block_cbcdec_class *vtable;
+#ifndef BR_DOXYGEN_IGNORE
+	union {
+		unsigned char sk[16 * 15];
+	} skey;
+	unsigned num_rounds;
+#endif
+} br_aes_armv8_cbcdec_keys;
+
+/**
+ * \brief Context for AES subkeys (`aes_armv8` implementation, CTR encryption
+ * and decryption).
+ *
+ * First field is a pointer to the vtable; it is set by the initialisation
+ * function. Other fields are not supposed to be accessed by user code.
+ */
+typedef struct {
+	/** \brief Pointer to vtable for this context. */
+	const br_block_ctr_class *vtable;
+#ifndef BR_DOXYGEN_IGNORE
+	union {
+		unsigned char sk[16 * 15];
+	} skey;
+	unsigned num_rounds;
+#endif
+} br_aes_armv8_ctr_keys;
+
+/**
+ * \brief Context for AES subkeys (`aes_armv8` implementation, CTR encryption
+ * and decryption + CBC-MAC).
+ *
+ * First field is a pointer to the vtable; it is set by the initialisation
+ * function. Other fields are not supposed to be accessed by user code.
+ */
+typedef struct {
+	/** \brief Pointer to vtable for this context. */
+	const br_block_ctrcbc_class *vtable;
+#ifndef BR_DOXYGEN_IGNORE
+	union {
+		unsigned char sk[16 * 15];
+	} skey;
+	unsigned num_rounds;
+#endif
+} br_aes_armv8_ctrcbc_keys;
+
+/**
+ * \brief Class instance for AES CBC encryption (`aes_armv8` implementation).
+ *
+ * Since this implementation might be omitted from the library, or the
+ * AES opcode unavailable on the current CPU, a pointer to this class
+ * instance should be obtained through `br_aes_armv8_cbcenc_get_vtable()`.
+ */
+extern const br_block_cbcenc_class br_aes_armv8_cbcenc_vtable;
+
+/**
+ * \brief Class instance for AES CBC decryption (`aes_armv8` implementation).
+ *
+ * Since this implementation might be omitted from the library, or the
+ * AES opcode unavailable on the current CPU, a pointer to this class
+ * instance should be obtained through `br_aes_armv8_cbcdec_get_vtable()`.
+ */
+extern const br_block_cbcdec_class br_aes_armv8_cbcdec_vtable;
+
+/**
+ * \brief Class instance for AES CTR encryption and decryption
+ * (`aes_armv8` implementation).
+ *
+ * Since this implementation might be omitted from the library, or the
+ * AES opcode unavailable on the current CPU, a pointer to this class
+ * instance should be obtained through `br_aes_armv8_ctr_get_vtable()`.
+ */
+extern const br_block_ctr_class br_aes_armv8_ctr_vtable;
+
+/**
+ * \brief Class instance for AES CTR encryption/decryption + CBC-MAC
+ * (`aes_armv8` implementation).
+ *
+ * Since this implementation might be omitted from the library, or the
+ * AES opcode unavailable on the current CPU, a pointer to this class
+ * instance should be obtained through `br_aes_armv8_ctrcbc_get_vtable()`.
+ */
+extern const br_block_ctrcbc_class br_aes_armv8_ctrcbc_vtable;
+
+/**
+ * \brief Context initialisation (key schedule) for AES CBC encryption
+ * (`aes_armv8` implementation).
+ *
+ * \param ctx   context to initialise.
+ * \param key   secret key.
+ * \param len   secret key length (in bytes).
+ */
+void br_aes_armv8_cbcenc_init(br_aes_armv8_cbcenc_keys *ctx,
+	const void *key, size_t len);
+
+/**
+ * \brief Context initialisation (key schedule) for AES CBC decryption
+ * (`aes_armv8` implementation).
+ *
+ * \param ctx   context to initialise.
+ * \param key   secret key.
+ * \param len   secret key length (in bytes).
+ */
+void br_aes_armv8_cbcdec_init(br_aes_armv8_cbcdec_keys *ctx,
+	const void *key, size_t len);
+
+/**
+ * \brief Context initialisation (key schedule) for AES CTR encryption
+ * and decryption (`aes_armv8` implementation).
+ *
+ * \param ctx   context to initialise.
+ * \param key   secret key.
+ * \param len   secret key length (in bytes).
+ */
+void br_aes_armv8_ctr_init(br_aes_armv8_ctr_keys *ctx,
+	const void *key, size_t len);
+
+/**
+ * \brief Context initialisation (key schedule) for AES CTR + CBC-MAC
+ * (`aes_armv8` implementation).
+ *
+ * \param ctx   context to initialise.
+ * \param key   secret key.
+ * \param len   secret key length (in bytes).
+ */
+void br_aes_armv8_ctrcbc_init(br_aes_armv8_ctrcbc_keys *ctx,
+	const void *key, size_t len);
+
+/**
+ * \brief CBC encryption with AES (`aes_armv8` implementation).
+ *
+ * \param ctx    context (already initialised).
+ * \param iv     IV (updated).
+ * \param data   data to encrypt (updated).
+ * \param len    data length (in bytes, MUST be multiple of 16).
+ */
+void br_aes_armv8_cbcenc_run(const br_aes_armv8_cbcenc_keys *ctx, void *iv,
+	void *data, size_t len);
+
+/**
+ * \brief CBC decryption with AES (`aes_armv8` implementation).
+ *
+ * \param ctx    context (already initialised).
+ * \param iv     IV (updated).
+ * \param data   data to decrypt (updated).
+ * \param len    data length (in bytes, MUST be multiple of 16).
+ */
+void br_aes_armv8_cbcdec_run(const br_aes_armv8_cbcdec_keys *ctx, void *iv,
+	void *data, size_t len);
+
+/**
+ * \brief CTR encryption and decryption with AES (`aes_armv8` implementation).
+ *
+ * \param ctx    context (already initialised).
+ * \param iv     IV (constant, 12 bytes).
+ * \param cc     initial block counter value.
+ * \param data   data to decrypt (updated).
+ * \param len    data length (in bytes).
+ * \return  new block counter value.
+ */
+uint32_t br_aes_armv8_ctr_run(const br_aes_armv8_ctr_keys *ctx,
+	const void *iv, uint32_t cc, void *data, size_t len);
+
+/**
+ * \brief CTR encryption + CBC-MAC with AES (`aes_armv8` implementation).
+ *
+ * \param ctx      context (already initialised).
+ * \param ctr      counter for CTR (16 bytes, updated).
+ * \param cbcmac   IV for CBC-MAC (updated).
+ * \param data     data to encrypt (updated).
+ * \param len      data length (in bytes, MUST be a multiple of 16).
+ */
+void br_aes_armv8_ctrcbc_encrypt(const br_aes_armv8_ctrcbc_keys *ctx,
+	void *ctr, void *cbcmac, void *data, size_t len);
+
+/**
+ * \brief CTR decryption + CBC-MAC with AES (`aes_armv8` implementation).
+ *
+ * \param ctx      context (already initialised).
+ * \param ctr      counter for CTR (16 bytes, updated).
+ * \param cbcmac   IV for CBC-MAC (updated).
+ * \param data     data to decrypt (updated).
+ * \param len      data length (in bytes, MUST be a multiple of 16).
+ */
+void br_aes_armv8_ctrcbc_decrypt(const br_aes_armv8_ctrcbc_keys *ctx,
+	void *ctr, void *cbcmac, void *data, size_t len);
+
+/**
+ * \brief CTR encryption/decryption with AES (`aes_armv8` implementation).
+ *
+ * \param ctx      context (already initialised).
+ * \param ctr      counter for CTR (16 bytes, updated).
+ * \param data     data to MAC (updated).
+ * \param len      data length (in bytes, MUST be a multiple of 16).
+ */
+void br_aes_armv8_ctrcbc_ctr(const br_aes_armv8_ctrcbc_keys *ctx,
+	void *ctr, void *data, size_t len);
+
+/**
+ * \brief CBC-MAC with AES (`aes_armv8` implementation).
+ *
+ * \param ctx      context (already initialised).
+ * \param cbcmac   IV for CBC-MAC (updated).
+ * \param data     data to MAC (unmodified).
+ * \param len      data length (in bytes, MUST be a multiple of 16).
+ */
+void br_aes_armv8_ctrcbc_mac(const br_aes_armv8_ctrcbc_keys *ctx,
+	void *cbcmac, const void *data, size_t len);
+
+/**
+ * \brief Obtain the `aes_armv8` AES-CBC (encryption) implementation, if
+ * available.
+ *
+ * This function returns a pointer to `br_aes_armv8_cbcenc_vtable`, if
+ * that implementation was compiled in the library, i.e. the compiler
+ * targets the ARMv8 Crypto Extensions. Otherwise, this function returns
+ * `NULL`.
+ *
+ * \return  the `aes_armv8` AES-CBC (encryption) implementation, or `NULL`.
+ */
+const br_block_cbcenc_class *br_aes_armv8_cbcenc_get_vtable(void);
+
+/**
+ * \brief Obtain the `aes_armv8` AES-CBC (decryption) implementation, if
+ * available.
+ *
+ * This function returns a pointer to `br_aes_armv8_cbcdec_vtable`, if
+ * that implementation was compiled in the library, i.e. the compiler
+ * targets the ARMv8 Crypto Extensions. Otherwise, this function returns
+ * `NULL`.
+ *
+ * \return  the `aes_armv8` AES-CBC (decryption) implementation, or `NULL`.
+ */
+const br_block_cbcdec_class *br_aes_armv8_cbcdec_get_vtable(void);
+
+/**
+ * \brief Obtain the `aes_armv8` AES-CTR implementation, if available.
+ *
+ * This function returns a pointer to `br_aes_armv8_ctr_vtable`, if
+ * that implementation was compiled in the library, i.e. the compiler
+ * targets the ARMv8 Crypto Extensions. Otherwise, this function returns
+ * `NULL`.
+ *
+ * \return  the `aes_armv8` AES-CTR implementation, or `NULL`.
+ */
+const br_block_ctr_class *br_aes_armv8_ctr_get_vtable(void);
+
+/**
+ * \brief Obtain the `aes_armv8` AES-CTR + CBC-MAC implementation, if
+ * available.
+ *
+ * This function returns a pointer to `br_aes_armv8_ctrcbc_vtable`, if
+ * that implementation was compiled in the library, i.e. the compiler
+ * targets the ARMv8 Crypto Extensions. Otherwise, this function returns
+ * `NULL`.
+ *
+ * \return  the `aes_armv8` AES-CTR implementation, or `NULL`.
+ */
+const br_block_ctrcbc_class *br_aes_armv8_ctrcbc_get_vtable(void);
+
+#endif
+
 /**
  * \brief Aggregate structure large enough to be used as context for
  * subkeys (CBC encryption) for all AES implementations.
@@ -2163,6 +2570,9 @@ typedef union {
 	br_aes_ct64_cbcenc_keys c_ct64;
 	br_aes_x86ni_cbcenc_keys c_x86ni;
 	br_aes_pwr8_cbcenc_keys c_pwr8;
+#ifdef ARDUINO
+	br_aes_armv8_cbcenc_keys c_armv8;
+#endif
 } br_aes_gen_cbcenc_keys;
 
 /**
@@ -2177,6 +2587,9 @@ typedef union {
 	br_aes_ct64_cbcdec_keys c_ct64;
 	br_aes_x86ni_cbcdec_keys c_x86ni;
 	br_aes_pwr8_cbcdec_keys c_pwr8;
+#ifdef ARDUINO
+	br_aes_armv8_cbcdec_keys c_armv8;
+#endif
 } br_aes_gen_cbcdec_keys;
 
 /**
@@ -2191,6 +2604,9 @@ typedef union {
 	br_aes_ct64_ctr_keys c_ct64;
 	br_aes_x86ni_ctr_keys c_x86ni;
 	br_aes_pwr8_ctr_keys c_pwr8;
+#ifdef ARDUINO
+	br_aes_armv8_ctr_keys c_armv8;
+#endif
 } br_aes_gen_ctr_keys;
 
 /**
@@ -2205,6 +2621,9 @@ typedef union {
 	br_aes_ct64_ctrcbc_keys c_ct64;
 	br_aes_x86ni_ctrcbc_keys c_x86ni;
 	br_aes_pwr8_ctrcbc_keys c_pwr8;
+#ifdef ARDUINO
+	br_aes_armv8_ctrcbc_keys c_armv8;
+#endif
 } br_aes_gen_ctrcbc_keys;
 
 /*
@@ -2489,6 +2908,35 @@ uint32_t br_chacha20_sse2_run(const void *key,
  */
 br_chacha20_run br_chacha20_sse2_get(void);
 
+#ifdef ARDUINO
+
+/**
+ * \brief ChaCha20 implementation (ARM Cortex-M, constant-time).
+ *
+ * This implementation is compiled only when `BR_ARMEL_CORTEXM_GCC` is
+ * enabled (see config.h). Use `br_chacha20_cortexm_get()` to safely
+ * obtain a pointer to that function.
+ *
+ * \see br_chacha20_run
+ *
+ * \param key    secret key (32 bytes).
+ * \param iv     IV (12 bytes).
+ * \param cc     initial counter value.
+ * \param data   data to encrypt or decrypt.
+ * \param len    data length (in bytes).
+ */
+uint32_t br_chacha20_cortexm_run(const void *key,
+	const void *iv, uint32_t cc, void *data, size_t len);
+
+/**
+ * \brief Obtain the `cortexm` ChaCha20 implementation, if available.
+ *
+ * \return  the `cortexm` ChaCha20 implementation, or `0`.
+ */
+br_chacha20_run br_chacha20_cortexm_get(void);
+
+#endif
+
 /**
  * \brief Type for a ChaCha20+Poly1305 AEAD implementation.
  *
@@ -2611,6 +3059,88 @@ void br_poly1305_ctmulq_run(const void *key, const void *iv,
  */
 br_poly1305_run br_poly1305_ctmulq_get(void);
 
+#ifdef ARDUINO
+
+/*
+ * Incremental ChaCha20+Poly1305 tag computation, for callers that get
+ * the AAD and data in pieces (the `br_poly1305_run` functions need a
+ * whole record at once). The arithmetic is that of `poly1305_ctmul32`.
+ * ChaCha20 itself is not run here: the caller encrypts with counter
+ * values starting at 1 and injects the _ciphertext_, i.e. after
+ * encryption, or before decryption.
+ *
+ * Usage: `br_poly1305_ctmul32_init()`, AAD chunks with
+ * `br_poly1305_ctmul32_aad_inject()`, `br_poly1305_ctmul32_flip()`,
+ * ciphertext chunks with `br_poly1305_ctmul32_update()`, and finally
+ * `br_poly1305_ctmul32_get_tag()` (which may be called several times).
+ */
+
+/**
+ * \brief Context for incremental ChaCha20+Poly1305 (`ctmul32`).
+ *
+ * The contents are opaque and shall not be accessed directly.
+ */
+typedef struct {
+#ifndef BR_DOXYGEN_IGNORE
+	uint32_t r[19];
+	uint32_t acc[10];
+	unsigned char s[16];
+	unsigned char buf[16];
+	size_t ptr;
+	uint64_t aad_len;
+	uint64_t data_len;
+	int flipped;
+#endif
+} br_poly1305_ctmul32_context;
+
+/**
+ * \brief Start an incremental ChaCha20+Poly1305 tag computation.
+ *
+ * \param ctx       context to initialise.
+ * \param key       secret key (32 bytes).
+ * \param iv        nonce (12 bytes).
+ * \param ichacha   implementation of ChaCha20 (for the MAC key).
+ */
+void br_poly1305_ctmul32_init(br_poly1305_ctmul32_context *ctx,
+	const void *key, const void *iv, br_chacha20_run ichacha);
+
+/**
+ * \brief Inject additional authenticated data.
+ *
+ * \param ctx    context.
+ * \param data   AAD chunk.
+ * \param len    chunk length (in bytes).
+ */
+void br_poly1305_ctmul32_aad_inject(br_poly1305_ctmul32_context *ctx,
+	const void *data, size_t len);
+
+/**
+ * \brief Finish the AAD injection.
+ *
+ * \param ctx   context.
+ */
+void br_poly1305_ctmul32_flip(br_poly1305_ctmul32_context *ctx);
+
+/**
+ * \brief Inject ciphertext.
+ *
+ * \param ctx    context.
+ * \param data   ciphertext chunk.
+ * \param len    chunk length (in bytes).
+ */
+void br_poly1305_ctmul32_update(br_poly1305_ctmul32_context *ctx,
+	const void *data, size_t len);
+
+/**
+ * \brief Compute the authentication tag (16 bytes).
+ *
+ * \param ctx   context.
+ * \param tag   output buffer for the tag.
+ */
+void br_poly1305_ctmul32_get_tag(br_poly1305_ctmul32_context *ctx, void *tag);
+
+#endif
+
 #ifdef __cplusplus
 }
 #endif
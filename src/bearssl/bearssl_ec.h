@@ -29,6 +29,9 @@
 #include <stdint.h>
 
 #include "bearssl_rand.h"
+#ifdef ARDUINO
+#include "bearssl_hmac.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -451,6 +454,18 @@ extern const br_ec_impl br_ec_p256_m15;
  */
 extern const br_ec_impl br_ec_p256_m31;
 
+#ifdef ARDUINO
+/**
+ * \brief EC implementation "m31" for P-384.
+ *
+ * This implementation uses specialised code for curve secp384r1 (also
+ * known as NIST P-384), with fixed-size field elements and fast
+ * modular reduction thanks to the field modulus special format,
+ * relying on multiplications of 31-bit values (MUL31).
+ */
+extern const br_ec_impl br_ec_p384_m31;
+#endif
+
 /**
  * \brief EC implementation "i15" (generic code) for Curve25519.
  *
@@ -525,10 +540,32 @@ extern const br_ec_impl br_ec_all_m15;
  *
  *   - `br_ec_c25519_m31` for Curve25519
  *   - `br_ec_p256_m31` for NIST P-256
- *   - `br_ec_prime_i31` for other curves (NIST P-384 and NIST-P512)
+ *   - `br_ec_p384_m31` for NIST P-384
+ *   - `br_ec_prime_i31` for other curves (NIST-P512)
  */
 extern const br_ec_impl br_ec_all_m31;
 
+#ifdef ARDUINO
+/**
+ * \brief Aggregate EC implementation "cortexm".
+ *
+ * This implementation is a wrapper for:
+ *
+ *   - `br_ec_c25519_m31` for Curve25519
+ *   - `br_ec_p256_m31` for NIST P-256
+ *   - `br_ec_prime_i31` for other curves (NIST P-384 and NIST-P512)
+ *
+ * On Cortex-M4 and M7 (ARMv7E-M), `br_ec_c25519_m31` and
+ * `br_ec_p256_m31` then use assembly field multiplication and squaring
+ * based on the constant-time UMLAL opcode, and `br_ec_prime_i31` uses
+ * the assembly Montgomery multiplication of `br_i31_montymul()` (if
+ * `BR_I31_CORTEXM` is disabled, the other curves use `br_ec_prime_i15`
+ * instead). It is the default returned by `br_ec_get_default()` on
+ * these cores.
+ */
+extern const br_ec_impl br_ec_all_cortexm;
+#endif
+
 /**
  * \brief Get the "default" EC implementation for the current system.
  *
@@ -539,6 +576,106 @@ extern const br_ec_impl br_ec_all_m31;
  */
 const br_ec_impl *br_ec_get_default(void);
 
+#ifdef ARDUINO
+/**
+ * \brief Get the preferred implementation of NIST P-256 alone.
+ *
+ * This is the P-256 code that `br_ec_get_default()` would use on the
+ * current system (`br_ec_p256_m31` or `br_ec_p256_m15`). Using it
+ * directly, instead of `br_ec_get_default()`, does not link the code
+ * of the other curves.
+ *
+ * \return  the P-256 implementation.
+ */
+const br_ec_impl *br_ec_p256_get_default(void);
+
+/**
+ * \brief Get the preferred implementation of Curve25519 alone.
+ *
+ * \see br_ec_p256_get_default()
+ *
+ * \return  the Curve25519 implementation.
+ */
+const br_ec_impl *br_ec_c25519_get_default(void);
+
+/**
+ * \brief Get the preferred generic implementation for NIST curves.
+ *
+ * This is `br_ec_prime_i31` or `br_ec_prime_i15`, as used for P-384 and
+ * P-521 by `br_ec_get_default()`.
+ *
+ * \see br_ec_p256_get_default()
+ *
+ * \return  the generic prime curve implementation.
+ */
+const br_ec_impl *br_ec_prime_get_default(void);
+#endif
+
+#ifdef ARDUINO
+/**
+ * \brief Ed25519 public key size (in bytes).
+ */
+#define BR_ED25519_PUBLIC_KEY_SIZE   32
+
+/**
+ * \brief Ed25519 private key (seed) size (in bytes).
+ */
+#define BR_ED25519_SECRET_SIZE   32
+
+/**
+ * \brief Ed25519 signature size (in bytes).
+ */
+#define BR_ED25519_SIGNATURE_SIZE   64
+
+/**
+ * \brief Compute an Ed25519 public key ("m31" code).
+ *
+ * The private key is the 32-byte seed of RFC 8032; the encoded public
+ * key (32 bytes) is written in `pub`. Ed25519 shares the field code of
+ * `br_ec_c25519_m31`, and multiplies the base point with a precomputed
+ * table (64 doublings and 64 additions).
+ *
+ * \param pub    destination for the public key.
+ * \param seed   private key (32 bytes).
+ */
+void br_ed25519_m31_public_key(unsigned char *pub, const unsigned char *seed);
+
+/**
+ * \brief Compute an Ed25519 signature ("m31" code).
+ *
+ * This is the "pure" Ed25519 of RFC 8032: the message is hashed (twice)
+ * with SHA-512, and the signature is deterministic, so no random source
+ * is needed. The public key may be provided (as computed by
+ * `br_ed25519_m31_public_key()`) to save its computation; with `NULL`,
+ * it is derived from the seed.
+ *
+ * \param sig       destination for the signature (64 bytes).
+ * \param seed      private key (32 bytes).
+ * \param pub       public key (32 bytes), or `NULL`.
+ * \param msg       message.
+ * \param msg_len   message length (in bytes).
+ * \return  the signature length (64).
+ */
+size_t br_ed25519_m31_sign(unsigned char *sig, const unsigned char *seed,
+	const unsigned char *pub, const void *msg, size_t msg_len);
+
+/**
+ * \brief Verify an Ed25519 signature ("m31" code).
+ *
+ * Non-canonical public keys, and signatures whose `S` half is not
+ * lower than the group order, are rejected. Verification does not run
+ * in constant time (all inputs are public).
+ *
+ * \param sig       signature (64 bytes).
+ * \param pub       public key (32 bytes).
+ * \param msg       message.
+ * \param msg_len   message length (in bytes).
+ * \return  1 on success, 0 on error.
+ */
+uint32_t br_ed25519_m31_verify(const unsigned char *sig,
+	const unsigned char *pub, const void *msg, size_t msg_len);
+#endif
+
 /**
  * \brief Convert a signature from "raw" to "asn1".
  *
@@ -799,6 +936,226 @@ br_ecdsa_vrfy br_ecdsa_vrfy_asn1_get_default(void);
  */
 br_ecdsa_vrfy br_ecdsa_vrfy_raw_get_default(void);
 
+#ifdef ARDUINO
+/**
+ * \brief Precomputed P-256 public key.
+ *
+ * This holds the window table of a public point (its multiples 1 to
+ * 15, in affine coordinates), in the internal format of the
+ * implementation that computed it, so that a signature verification
+ * with that key skips the point decoding, the curve equation check
+ * and the table construction, and uses mixed additions. It is made by
+ * `br_ec_p256_m15_precomp()` or `br_ec_p256_m31_precomp()`, and used
+ * by `br_ecdsa_i15_vrfy_raw_precomp()` and the other "precomp"
+ * verifiers. The table must stay unmodified as long as the key is
+ * used.
+ */
+typedef struct {
+	uint32_t (*muladd)(unsigned char *A, const uint32_t *table,
+		const unsigned char *x, size_t xlen,
+		const unsigned char *y, size_t ylen);
+	const uint32_t *table;
+} br_ec_p256_precomp_key;
+
+/**
+ * \brief Size (in 32-bit words) of the table of a precomputed P-256
+ * public key.
+ */
+#define BR_EC_P256_PRECOMP_WORDS   300
+
+/**
+ * \brief Precompute a P-256 public key for `br_ec_p256_m15`.
+ *
+ * The point `Q` (uncompressed format) is decoded and validated, and
+ * its window table is written in `table`, which must hold
+ * `BR_EC_P256_PRECOMP_WORDS` words. On error (invalid point), `pk`
+ * is left untouched.
+ *
+ * \param pk      precomputed key to fill.
+ * \param table   destination table.
+ * \param Q       encoded public point.
+ * \param Qlen    encoded public point length (in bytes).
+ * \return  1 on success, 0 on error.
+ */
+uint32_t br_ec_p256_m15_precomp(br_ec_p256_precomp_key *pk,
+	uint32_t *table, const void *Q, size_t Qlen);
+
+/**
+ * \brief Precompute a P-256 public key for `br_ec_p256_m31`.
+ *
+ * \see br_ec_p256_m15_precomp()
+ *
+ * \param pk      precomputed key to fill.
+ * \param table   destination table.
+ * \param Q       encoded public point.
+ * \param Qlen    encoded public point length (in bytes).
+ * \return  1 on success, 0 on error.
+ */
+uint32_t br_ec_p256_m31_precomp(br_ec_p256_precomp_key *pk,
+	uint32_t *table, const void *Q, size_t Qlen);
+
+/**
+ * \brief ECDSA signature verifier with a precomputed P-256 key, "i31"
+ * implementation, "raw" format.
+ *
+ * This is equivalent to `br_ecdsa_i31_vrfy_raw()` with the EC
+ * implementation and public key the precomputed key was made from.
+ *
+ * \param pk        precomputed public key.
+ * \param hash      signed data (hashed).
+ * \param hash_len  hash value length (in bytes).
+ * \param sig       signature.
+ * \param sig_len   signature length (in bytes).
+ * \return  1 on success, 0 on error.
+ */
+uint32_t br_ecdsa_i31_vrfy_raw_precomp(const br_ec_p256_precomp_key *pk,
+	const void *hash, size_t hash_len, const void *sig, size_t sig_len);
+
+/**
+ * \brief ECDSA signature verifier with a precomputed P-256 key, "i31"
+ * implementation, "asn1" format.
+ *
+ * \see br_ecdsa_i31_vrfy_raw_precomp()
+ *
+ * \param pk        precomputed public key.
+ * \param hash      signed data (hashed).
+ * \param hash_len  hash value length (in bytes).
+ * \param sig       signature.
+ * \param sig_len   signature length (in bytes).
+ * \return  1 on success, 0 on error.
+ */
+uint32_t br_ecdsa_i31_vrfy_asn1_precomp(const br_ec_p256_precomp_key *pk,
+	const void *hash, size_t hash_len, const void *sig, size_t sig_len);
+
+/**
+ * \brief ECDSA signature verifier with a precomputed P-256 key, "i15"
+ * implementation, "raw" format.
+ *
+ * \see br_ecdsa_i31_vrfy_raw_precomp()
+ *
+ * \param pk        precomputed public key.
+ * \param hash      signed data (hashed).
+ * \param hash_len  hash value length (in bytes).
+ * \param sig       signature.
+ * \param sig_len   signature length (in bytes).
+ * \return  1 on success, 0 on error.
+ */
+uint32_t br_ecdsa_i15_vrfy_raw_precomp(const br_ec_p256_precomp_key *pk,
+	const void *hash, size_t hash_len, const void *sig, size_t sig_len);
+
+/**
+ * \brief ECDSA signature verifier with a precomputed P-256 key, "i15"
+ * implementation, "asn1" format.
+ *
+ * \see br_ecdsa_i31_vrfy_raw_precomp()
+ *
+ * \param pk        precomputed public key.
+ * \param hash      signed data (hashed).
+ * \param hash_len  hash value length (in bytes).
+ * \param sig       signature.
+ * \param sig_len   signature length (in bytes).
+ * \return  1 on success, 0 on error.
+ */
+uint32_t br_ecdsa_i15_vrfy_asn1_precomp(const br_ec_p256_precomp_key *pk,
+	const void *hash, size_t hash_len, const void *sig, size_t sig_len);
+
+/**
+ * \brief Precomputed ECDSA private key.
+ *
+ * The RFC 6979 generation of the per-signature secret "k" keys an
+ * HMAC_DRBG with the private key followed by the hash value. This
+ * holds the HMAC state after the private key, so that each signature
+ * only processes the hash value from there, and skips the HMAC key
+ * setup. It is made by `br_ecdsa_sign_precomp_init()`; signatures are
+ * the same as those of `br_ecdsa_i31_sign_raw()` and the other
+ * signers. The private key is referenced, not copied, and must stay
+ * unmodified as long as the precomputed key is used. The structure
+ * contents are secret too.
+ */
+typedef struct {
+#ifndef BR_DOXYGEN_IGNORE
+	const br_ec_impl *impl;
+	const br_ec_private_key *sk;
+	br_hmac_context seed;
+#endif
+} br_ecdsa_sign_precomp_key;
+
+/**
+ * \brief Precompute an ECDSA private key.
+ *
+ * The key must be on NIST P-256, P-384 or P-521, and supported by
+ * `impl`; `hf` is the hash function of the values that will be
+ * signed. The result may be used with the "i31" and "i15" signers.
+ *
+ * \param pk     precomputed key to fill.
+ * \param impl   EC implementation to use.
+ * \param hf     hash function used to process the data.
+ * \param sk     EC private key.
+ * \return  1 on success, 0 on error.
+ */
+uint32_t br_ecdsa_sign_precomp_init(br_ecdsa_sign_precomp_key *pk,
+	const br_ec_impl *impl, const br_hash_class *hf,
+	const br_ec_private_key *sk);
+
+/**
+ * \brief ECDSA signature generator with a precomputed private key,
+ * "i31" implementation, "raw" format.
+ *
+ * This is equivalent to `br_ecdsa_i31_sign_raw()` with the EC
+ * implementation, hash function and private key the precomputed key
+ * was made from.
+ *
+ * \param pk           precomputed private key.
+ * \param hash_value   signed data (hashed).
+ * \param sig          destination buffer.
+ * \return  the signature length (in bytes), or 0 on error.
+ */
+size_t br_ecdsa_i31_sign_raw_precomp(const br_ecdsa_sign_precomp_key *pk,
+	const void *hash_value, void *sig);
+
+/**
+ * \brief ECDSA signature generator with a precomputed private key,
+ * "i31" implementation, "asn1" format.
+ *
+ * \see br_ecdsa_i31_sign_raw_precomp()
+ *
+ * \param pk           precomputed private key.
+ * \param hash_value   signed data (hashed).
+ * \param sig          destination buffer.
+ * \return  the signature length (in bytes), or 0 on error.
+ */
+size_t br_ecdsa_i31_sign_asn1_precomp(const br_ecdsa_sign_precomp_key *pk,
+	const void *hash_value, void *sig);
+
+/**
+ * \brief ECDSA signature generator with a precomputed private key,
+ * "i15" implementation, "raw" format.
+ *
+ * \see br_ecdsa_i31_sign_raw_precomp()
+ *
+ * \param pk           precomputed private key.
+ * \param hash_value   signed data (hashed).
+ * \param sig          destination buffer.
+ * \return  the signature length (in bytes), or 0 on error.
+ */
+size_t br_ecdsa_i15_sign_raw_precomp(const br_ecdsa_sign_precomp_key *pk,
+	const void *hash_value, void *sig);
+
+/**
+ * \brief ECDSA signature generator with a precomputed private key,
+ * "i15" implementation, "asn1" format.
+ *
+ * \see br_ecdsa_i31_sign_raw_precomp()
+ *
+ * \param pk           precomputed private key.
+ * \param hash_value   signed data (hashed).
+ * \param sig          destination buffer.
+ * \return  the signature length (in bytes), or 0 on error.
+ */
+size_t br_ecdsa_i15_sign_asn1_precomp(const br_ecdsa_sign_precomp_key *pk,
+	const void *hash_value, void *sig);
+#endif
+
 /**
  * \brief Maximum size for EC private key element buffer.
  *
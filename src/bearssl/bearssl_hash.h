@@ -1213,6 +1213,29 @@ void br_multihash_update(br_multihash_context *ctx,
  */
 size_t br_multihash_out(const br_multihash_context *ctx, int id, void *dst);
 
+#ifdef ARDUINO
+
+/**
+ * \brief Hash several messages of the same length with SHA-256.
+ *
+ * The `num` messages `data[0]` to `data[num - 1]`, of `len` bytes each,
+ * are hashed independently, and the digest of message `i` is written
+ * at offset `32 * i` in `out`. With SSE2, four messages are processed
+ * in lockstep, one per 32-bit lane; otherwise they are hashed one
+ * after the other with `br_sha256_vtable`. Equal lengths (e.g. the
+ * chunks of an image, or the node pairs of a Merkle tree) keep the
+ * lanes on the same schedule.
+ *
+ * \param out    destination for `32 * num` bytes.
+ * \param data   pointers to the messages.
+ * \param num    number of messages.
+ * \param len    length of each message (in bytes).
+ */
+void br_sha256_multi(void *out, const void *const *data,
+	size_t num, size_t len);
+
+#endif
+
 /**
  * \brief Type for a GHASH implementation.
  *
@@ -1339,6 +1362,49 @@ void br_ghash_pwr8(void *y, const void *h, const void *data, size_t len);
  */
 br_ghash br_ghash_pwr8_get(void);
 
+#ifdef ARDUINO
+
+/**
+ * \brief GHASH implementation using 4-bit tables.
+ *
+ * This implementation uses no multiplication; it computes a 256-byte
+ * table of multiples of the key for each call. Table lookups use
+ * secret indices, so it is NOT constant-time on CPUs with a data
+ * cache; it is meant for small cores (e.g. Cortex-M0+ with a slow
+ * multiplier) where that is not an issue. It is never selected by
+ * default.
+ *
+ * \param y      the array to update.
+ * \param h      the GHASH key.
+ * \param data   the input data (may be `NULL` if `len` is zero).
+ * \param len    the input data length (in bytes).
+ */
+void br_ghash_tab4(void *y, const void *h, const void *data, size_t len);
+
+/**
+ * \brief GHASH implementation using the ARMv8 `pmull` opcode.
+ *
+ * This implementation is available only on AArch64, when the compiler
+ * targets the ARMv8 Cryptography Extensions (see `BR_ARMV8_CE`). To
+ * safely obtain a pointer to this function when supported (or 0
+ * otherwise), use `br_ghash_pmull_get()`.
+ *
+ * \param y      the array to update.
+ * \param h      the GHASH key.
+ * \param data   the input data (may be `NULL` if `len` is zero).
+ * \param len    the input data length (in bytes).
+ */
+void br_ghash_pmull(void *y, const void *h, const void *data, size_t len);
+
+/**
+ * \brief Obtain the `pmull` GHASH implementation, if available.
+ *
+ * \return  the `pmull` GHASH implementation, or `0`.
+ */
+br_ghash br_ghash_pmull_get(void);
+
+#endif
+
 #ifdef __cplusplus
 }
 #endif
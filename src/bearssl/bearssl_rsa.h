@@ -556,6 +556,203 @@ uint32_t br_rsa_i31_pkcs1_vrfy(const unsigned char *x, size_t xlen,
 	const unsigned char *hash_oid, size_t hash_len,
 	const br_rsa_public_key *pk, unsigned char *hash_out);
 
+#ifdef ARDUINO
+/**
+ * \brief RSA public key in precomputed "i31" form.
+ *
+ * Holds the decoded modulus and the Montgomery constants, so that
+ * `br_rsa_i31_public_precomp()` does not recompute them for every
+ * operation. It is made with `br_rsa_i31_precomp_init()`.
+ */
+typedef struct {
+	/** \brief Decoded modulus. */
+	const uint32_t *m;
+	/** \brief R^2 mod m, in the same representation. */
+	const uint32_t *r2;
+	/** \brief -1/m mod 2^31. */
+	uint32_t m0i;
+	/** \brief Modulus length (in bytes). */
+	size_t nlen;
+	/** \brief Public exponent (unsigned big-endian). */
+	const unsigned char *e;
+	/** \brief Public exponent length (in bytes). */
+	size_t elen;
+} br_rsa_i31_precomp_key;
+
+/**
+ * \brief Buffer size (in words) for a precomputed "i31" key.
+ *
+ * \param bits   modulus size (in bits).
+ */
+#define BR_RSA_I31_PRECOMP_WORDS(bits)   (2 * (2 + ((bits) + 30) / 31))
+
+/**
+ * \brief Make the precomputed "i31" form of an RSA public key.
+ *
+ * The decoded modulus and R^2 are written into `buf`. The buffer, and
+ * the exponent of `pk`, must remain valid as long as `pp` is used.
+ *
+ * \param pp        precomputed key to fill.
+ * \param pk        RSA public key.
+ * \param buf       destination buffer.
+ * \param buf_len   buffer length (in words).
+ * \return  the number of words of `buf` used, or 0 on error.
+ */
+size_t br_rsa_i31_precomp_init(br_rsa_i31_precomp_key *pp,
+	const br_rsa_public_key *pk, uint32_t *buf, size_t buf_len);
+
+/**
+ * \brief RSA public key engine "i31" with a precomputed key.
+ *
+ * The exponent is treated as public: the exponentiation is a plain
+ * square-and-multiply over its bits, which suits the short exponents of
+ * CA keys better than the windowed constant-time code.
+ *
+ * \see br_rsa_public
+ *
+ * \param x      operand to exponentiate.
+ * \param xlen   length of the operand (in bytes).
+ * \param pp     precomputed RSA public key.
+ * \return  1 on success, 0 on error.
+ */
+uint32_t br_rsa_i31_public_precomp(unsigned char *x, size_t xlen,
+	const br_rsa_i31_precomp_key *pp);
+
+/**
+ * \brief RSA signature verification engine "i31" with a precomputed key.
+ *
+ * \see br_rsa_pkcs1_vrfy
+ *
+ * \param x          signature buffer.
+ * \param xlen       signature length (in bytes).
+ * \param hash_oid   encoded hash algorithm OID (or `NULL`).
+ * \param hash_len   expected hash value length (in bytes).
+ * \param pp         precomputed RSA public key.
+ * \param hash_out   output buffer for the hash value.
+ * \return  1 on success, 0 on error.
+ */
+uint32_t br_rsa_i31_pkcs1_vrfy_precomp(const unsigned char *x, size_t xlen,
+	const unsigned char *hash_oid, size_t hash_len,
+	const br_rsa_i31_precomp_key *pp, unsigned char *hash_out);
+
+/**
+ * \brief RSA private key in precomputed "i31" form.
+ *
+ * Holds the decoded factors, their Montgomery constants and 1/q mod p
+ * in Montgomery representation, so that `br_rsa_i31_private_precomp()`
+ * does not recompute them for every operation. It is made with
+ * `br_rsa_i31_priv_precomp_init()`.
+ */
+typedef struct {
+	/** \brief Decoded first factor. */
+	const uint32_t *p;
+	/** \brief Decoded second factor. */
+	const uint32_t *q;
+	/** \brief 1/q mod p, in Montgomery representation. */
+	const uint32_t *iq;
+	/** \brief -1/p mod 2^31. */
+	uint32_t p0i;
+	/** \brief -1/q mod 2^31. */
+	uint32_t q0i;
+	/** \brief Length of a factor-sized value (in words). */
+	size_t fwlen;
+	/** \brief Modulus bit length. */
+	uint32_t n_bitlen;
+	/** \brief First reduced private exponent (unsigned big-endian). */
+	const unsigned char *dp;
+	/** \brief First reduced private exponent length (in bytes). */
+	size_t dplen;
+	/** \brief Second reduced private exponent (unsigned big-endian). */
+	const unsigned char *dq;
+	/** \brief Second reduced private exponent length (in bytes). */
+	size_t dqlen;
+} br_rsa_i31_priv_precomp_key;
+
+/**
+ * \brief Length (in words) of a factor-sized "i31" value.
+ *
+ * \param bits   modulus size (in bits).
+ */
+#define BR_RSA_I31_FACTOR_WORDS(bits) \
+	(2 + ((((bits) + 64) >> 1) + 30) / 31)
+
+/**
+ * \brief Buffer size (in words) for a precomputed "i31" private key.
+ *
+ * \param bits   modulus size (in bits).
+ */
+#define BR_RSA_I31_PRIV_PRECOMP_WORDS(bits) \
+	(1 + 3 * BR_RSA_I31_FACTOR_WORDS(bits))
+
+/**
+ * \brief Work area size (in words) for `br_rsa_i31_private_precomp()`.
+ *
+ * The exponentiations use a window of `win` bits (2 to 5); each extra
+ * bit doubles the number of precomputed powers, and saves a share of
+ * the multiplications.
+ *
+ * \param bits   modulus size (in bits).
+ * \param win    window size (in bits).
+ */
+#define BR_RSA_I31_PRIV_TMP_WORDS(bits, win) \
+	(1 + ((1 << (win)) + 3) * BR_RSA_I31_FACTOR_WORDS(bits))
+
+/**
+ * \brief Make the precomputed "i31" form of an RSA private key.
+ *
+ * The decoded factors and 1/q mod p are written into `buf`. The buffer,
+ * and the reduced private exponents of `sk`, must remain valid as long
+ * as `pp` is used.
+ *
+ * \param pp        precomputed key to fill.
+ * \param sk        RSA private key.
+ * \param buf       destination buffer.
+ * \param buf_len   buffer length (in words).
+ * \return  the number of words of `buf` used, or 0 on error.
+ */
+size_t br_rsa_i31_priv_precomp_init(br_rsa_i31_priv_precomp_key *pp,
+	const br_rsa_private_key *sk, uint32_t *buf, size_t buf_len);
+
+/**
+ * \brief RSA private key engine "i31" with a precomputed key.
+ *
+ * This is the same CRT computation as `br_rsa_i31_private()`, with the
+ * per-key values taken from `pp` and the temporary values in the
+ * caller's work area `tmp` instead of the stack. The work area must
+ * hold at least `BR_RSA_I31_PRIV_TMP_WORDS(bits, 2)` words; larger
+ * areas select a larger exponentiation window.
+ *
+ * \see br_rsa_private
+ *
+ * \param x      operand to exponentiate.
+ * \param pp     precomputed RSA private key.
+ * \param tmp    work area.
+ * \param tlen   work area length (in words).
+ * \return  1 on success, 0 on error.
+ */
+uint32_t br_rsa_i31_private_precomp(unsigned char *x,
+	const br_rsa_i31_priv_precomp_key *pp, uint32_t *tmp, size_t tlen);
+
+/**
+ * \brief RSA signature generation engine "i31" with a precomputed key.
+ *
+ * \see br_rsa_pkcs1_sign
+ *
+ * \param hash_oid   encoded hash algorithm OID (or `NULL`).
+ * \param hash       hash value.
+ * \param hash_len   hash value length (in bytes).
+ * \param pp         precomputed RSA private key.
+ * \param x          output buffer for the signature value.
+ * \param tmp        work area (see `br_rsa_i31_private_precomp()`).
+ * \param tlen       work area length (in words).
+ * \return  1 on success, 0 on error.
+ */
+uint32_t br_rsa_i31_pkcs1_sign_precomp(const unsigned char *hash_oid,
+	const unsigned char *hash, size_t hash_len,
+	const br_rsa_i31_priv_precomp_key *pp, unsigned char *x,
+	uint32_t *tmp, size_t tlen);
+#endif
+
 /**
  * \brief RSA private key engine "i31".
  *
@@ -748,6 +945,203 @@ uint32_t br_rsa_i15_pkcs1_vrfy(const unsigned char *x, size_t xlen,
 	const unsigned char *hash_oid, size_t hash_len,
 	const br_rsa_public_key *pk, unsigned char *hash_out);
 
+#ifdef ARDUINO
+/**
+ * \brief RSA public key in precomputed "i15" form.
+ *
+ * Holds the decoded modulus and the Montgomery constants, so that
+ * `br_rsa_i15_public_precomp()` does not recompute them for every
+ * operation. It is made with `br_rsa_i15_precomp_init()`.
+ */
+typedef struct {
+	/** \brief Decoded modulus. */
+	const uint16_t *m;
+	/** \brief R^2 mod m, in the same representation. */
+	const uint16_t *r2;
+	/** \brief -1/m mod 2^15. */
+	uint16_t m0i;
+	/** \brief Modulus length (in bytes). */
+	size_t nlen;
+	/** \brief Public exponent (unsigned big-endian). */
+	const unsigned char *e;
+	/** \brief Public exponent length (in bytes). */
+	size_t elen;
+} br_rsa_i15_precomp_key;
+
+/**
+ * \brief Buffer size (in words) for a precomputed "i15" key.
+ *
+ * \param bits   modulus size (in bits).
+ */
+#define BR_RSA_I15_PRECOMP_WORDS(bits)   (1 + 2 * (2 + ((bits) + 14) / 15))
+
+/**
+ * \brief Make the precomputed "i15" form of an RSA public key.
+ *
+ * The decoded modulus and R^2 are written into `buf`. The buffer, and
+ * the exponent of `pk`, must remain valid as long as `pp` is used.
+ *
+ * \param pp        precomputed key to fill.
+ * \param pk        RSA public key.
+ * \param buf       destination buffer.
+ * \param buf_len   buffer length (in words).
+ * \return  the number of words of `buf` used, or 0 on error.
+ */
+size_t br_rsa_i15_precomp_init(br_rsa_i15_precomp_key *pp,
+	const br_rsa_public_key *pk, uint16_t *buf, size_t buf_len);
+
+/**
+ * \brief RSA public key engine "i15" with a precomputed key.
+ *
+ * The exponent is treated as public: the exponentiation is a plain
+ * square-and-multiply over its bits, which suits the short exponents of
+ * CA keys better than the windowed constant-time code.
+ *
+ * \see br_rsa_public
+ *
+ * \param x      operand to exponentiate.
+ * \param xlen   length of the operand (in bytes).
+ * \param pp     precomputed RSA public key.
+ * \return  1 on success, 0 on error.
+ */
+uint32_t br_rsa_i15_public_precomp(unsigned char *x, size_t xlen,
+	const br_rsa_i15_precomp_key *pp);
+
+/**
+ * \brief RSA signature verification engine "i15" with a precomputed key.
+ *
+ * \see br_rsa_pkcs1_vrfy
+ *
+ * \param x          signature buffer.
+ * \param xlen       signature length (in bytes).
+ * \param hash_oid   encoded hash algorithm OID (or `NULL`).
+ * \param hash_len   expected hash value length (in bytes).
+ * \param pp         precomputed RSA public key.
+ * \param hash_out   output buffer for the hash value.
+ * \return  1 on success, 0 on error.
+ */
+uint32_t br_rsa_i15_pkcs1_vrfy_precomp(const unsigned char *x, size_t xlen,
+	const unsigned char *hash_oid, size_t hash_len,
+	const br_rsa_i15_precomp_key *pp, unsigned char *hash_out);
+
+/**
+ * \brief RSA private key in precomputed "i15" form.
+ *
+ * Holds the decoded factors, their Montgomery constants and 1/q mod p
+ * in Montgomery representation, so that `br_rsa_i15_private_precomp()`
+ * does not recompute them for every operation. It is made with
+ * `br_rsa_i15_priv_precomp_init()`.
+ */
+typedef struct {
+	/** \brief Decoded first factor. */
+	const uint16_t *p;
+	/** \brief Decoded second factor. */
+	const uint16_t *q;
+	/** \brief 1/q mod p, in Montgomery representation. */
+	const uint16_t *iq;
+	/** \brief -1/p mod 2^15. */
+	uint16_t p0i;
+	/** \brief -1/q mod 2^15. */
+	uint16_t q0i;
+	/** \brief Length of a factor-sized value (in words). */
+	size_t fwlen;
+	/** \brief Modulus bit length. */
+	uint32_t n_bitlen;
+	/** \brief First reduced private exponent (unsigned big-endian). */
+	const unsigned char *dp;
+	/** \brief First reduced private exponent length (in bytes). */
+	size_t dplen;
+	/** \brief Second reduced private exponent (unsigned big-endian). */
+	const unsigned char *dq;
+	/** \brief Second reduced private exponent length (in bytes). */
+	size_t dqlen;
+} br_rsa_i15_priv_precomp_key;
+
+/**
+ * \brief Length (in words) of a factor-sized "i15" value.
+ *
+ * \param bits   modulus size (in bits).
+ */
+#define BR_RSA_I15_FACTOR_WORDS(bits) \
+	(2 + ((((bits) + 64) >> 1) + 14) / 15)
+
+/**
+ * \brief Buffer size (in words) for a precomputed "i15" private key.
+ *
+ * \param bits   modulus size (in bits).
+ */
+#define BR_RSA_I15_PRIV_PRECOMP_WORDS(bits) \
+	(1 + 3 * BR_RSA_I15_FACTOR_WORDS(bits))
+
+/**
+ * \brief Work area size (in words) for `br_rsa_i15_private_precomp()`.
+ *
+ * The exponentiations use a window of `win` bits (2 to 5); each extra
+ * bit doubles the number of precomputed powers, and saves a share of
+ * the multiplications.
+ *
+ * \param bits   modulus size (in bits).
+ * \param win    window size (in bits).
+ */
+#define BR_RSA_I15_PRIV_TMP_WORDS(bits, win) \
+	(1 + ((1 << (win)) + 3) * BR_RSA_I15_FACTOR_WORDS(bits))
+
+/**
+ * \brief Make the precomputed "i15" form of an RSA private key.
+ *
+ * The decoded factors and 1/q mod p are written into `buf`. The buffer,
+ * and the reduced private exponents of `sk`, must remain valid as long
+ * as `pp` is used.
+ *
+ * \param pp        precomputed key to fill.
+ * \param sk        RSA private key.
+ * \param buf       destination buffer.
+ * \param buf_len   buffer length (in words).
+ * \return  the number of words of `buf` used, or 0 on error.
+ */
+size_t br_rsa_i15_priv_precomp_init(br_rsa_i15_priv_precomp_key *pp,
+	const br_rsa_private_key *sk, uint16_t *buf, size_t buf_len);
+
+/**
+ * \brief RSA private key engine "i15" with a precomputed key.
+ *
+ * This is the same CRT computation as `br_rsa_i15_private()`, with the
+ * per-key values taken from `pp` and the temporary values in the
+ * caller's work area `tmp` instead of the stack. The work area must
+ * hold at least `BR_RSA_I15_PRIV_TMP_WORDS(bits, 2)` words; larger
+ * areas select a larger exponentiation window.
+ *
+ * \see br_rsa_private
+ *
+ * \param x      operand to exponentiate.
+ * \param pp     precomputed RSA private key.
+ * \param tmp    work area.
+ * \param tlen   work area length (in words).
+ * \return  1 on success, 0 on error.
+ */
+uint32_t br_rsa_i15_private_precomp(unsigned char *x,
+	const br_rsa_i15_priv_precomp_key *pp, uint16_t *tmp, size_t tlen);
+
+/**
+ * \brief RSA signature generation engine "i15" with a precomputed key.
+ *
+ * \see br_rsa_pkcs1_sign
+ *
+ * \param hash_oid   encoded hash algorithm OID (or `NULL`).
+ * \param hash       hash value.
+ * \param hash_len   hash value length (in bytes).
+ * \param pp         precomputed RSA private key.
+ * \param x          output buffer for the signature value.
+ * \param tmp        work area (see `br_rsa_i15_private_precomp()`).
+ * \param tlen       work area length (in words).
+ * \return  1 on success, 0 on error.
+ */
+uint32_t br_rsa_i15_pkcs1_sign_precomp(const unsigned char *hash_oid,
+	const unsigned char *hash, size_t hash_len,
+	const br_rsa_i15_priv_precomp_key *pp, unsigned char *x,
+	uint16_t *tmp, size_t tlen);
+#endif
+
 /**
  * \brief RSA private key engine "i15".
  *
@@ -1186,6 +1580,103 @@ br_rsa_keygen br_rsa_i62_keygen_get(void);
  */
 br_rsa_keygen br_rsa_keygen_get_default(void);
 
+#ifdef ARDUINO
+/**
+ * \brief Type for the search of a single RSA factor.
+ *
+ * This is the first half of a key pair generation split in independent
+ * steps, so that the two factors can be searched for concurrently
+ * (e.g. on two CPU cores). With `index` equal to 0, the function
+ * produces the factor p and the CRT exponent dp; with `index` equal to
+ * 1, it produces q and dq. Both are written in `kbuf_priv`, at the
+ * offsets that the matching `br_rsa_keygen` function would use, so
+ * the two calls may run at the same time on the same buffer, provided
+ * that they use distinct random sources.
+ *
+ * `size` and `pubexp` are interpreted as for `br_rsa_keygen`. Returned
+ * value is 1 on success, 0 on error (unsupported size or exponent).
+ *
+ * \param rng_ctx     source PRNG context (already initialized).
+ * \param kbuf_priv   buffer for the private key elements.
+ * \param size        target RSA modulus size (in bits).
+ * \param pubexp      public exponent to use, or zero.
+ * \param index       factor to produce (0 for p, 1 for q).
+ * \return  1 on success, 0 on error.
+ */
+typedef uint32_t (*br_rsa_keygen_factor)(const br_prng_class **rng_ctx,
+	void *kbuf_priv, unsigned size, uint32_t pubexp, int index);
+
+/**
+ * \brief Type for the completion of an RSA key pair generation.
+ *
+ * Once both factors have been produced with `br_rsa_keygen_factor`
+ * (same `kbuf_priv`, `size` and `pubexp`), this function fills `sk`
+ * (and `pk`, if not `NULL`) and computes the remaining elements, as
+ * `br_rsa_keygen` does. Returned value is 1 on success, 0 on error.
+ *
+ * \param sk          RSA private key structure (destination).
+ * \param kbuf_priv   buffer holding the two factors.
+ * \param pk          RSA public key structure (destination), or `NULL`.
+ * \param kbuf_pub    buffer for the public key elements, or `NULL`.
+ * \param size        target RSA modulus size (in bits).
+ * \param pubexp      public exponent to use, or zero.
+ * \return  1 on success, 0 on error.
+ */
+typedef uint32_t (*br_rsa_keygen_finish)(br_rsa_private_key *sk,
+	void *kbuf_priv, br_rsa_public_key *pk, void *kbuf_pub,
+	unsigned size, uint32_t pubexp);
+
+/**
+ * \brief RSA factor search with the "i15" engine.
+ *
+ * \see br_rsa_keygen_factor
+ */
+uint32_t br_rsa_i15_keygen_factor(const br_prng_class **rng_ctx,
+	void *kbuf_priv, unsigned size, uint32_t pubexp, int index);
+
+/**
+ * \brief RSA key pair completion with the "i15" engine.
+ *
+ * \see br_rsa_keygen_finish
+ */
+uint32_t br_rsa_i15_keygen_finish(br_rsa_private_key *sk,
+	void *kbuf_priv, br_rsa_public_key *pk, void *kbuf_pub,
+	unsigned size, uint32_t pubexp);
+
+/**
+ * \brief RSA factor search with the "i31" engine.
+ *
+ * \see br_rsa_keygen_factor
+ */
+uint32_t br_rsa_i31_keygen_factor(const br_prng_class **rng_ctx,
+	void *kbuf_priv, unsigned size, uint32_t pubexp, int index);
+
+/**
+ * \brief RSA key pair completion with the "i31" engine.
+ *
+ * \see br_rsa_keygen_finish
+ */
+uint32_t br_rsa_i31_keygen_finish(br_rsa_private_key *sk,
+	void *kbuf_priv, br_rsa_public_key *pk, void *kbuf_pub,
+	unsigned size, uint32_t pubexp);
+
+/**
+ * \brief Get the default RSA factor search implementation.
+ *
+ * \return  the default implementation.
+ */
+br_rsa_keygen_factor br_rsa_keygen_factor_get_default(void);
+
+/**
+ * \brief Get the default RSA key pair completion implementation.
+ *
+ * The returned function matches `br_rsa_keygen_factor_get_default()`.
+ *
+ * \return  the default implementation.
+ */
+br_rsa_keygen_finish br_rsa_keygen_finish_get_default(void);
+#endif
+
 /**
  * \brief Type for a modulus computing function.
  *
@@ -827,6 +827,19 @@ typedef struct {
 #define BR_MAX_CIPHER_SUITES   48
 #endif
 
+#ifdef ARDUINO
+/**
+ * \brief Certificate reader.
+ *
+ * Copies `len` bytes of certificate data into `dst`. `src` is the
+ * `data` pointer of the certificate being sent, advanced by the bytes
+ * already read; it is not dereferenced by the engine, so it may encode
+ * an address in storage that is not memory-mapped.
+ */
+typedef void (*br_ssl_cert_reader)(void *ctx,
+	const unsigned char *src, unsigned char *dst, size_t len);
+#endif
+
 /**
  * \brief Context structure for SSL engine.
  *
@@ -1065,6 +1078,17 @@ typedef struct {
 	size_t chain_len;
 	const unsigned char *cert_cur;
 	size_t cert_len;
+#ifdef ARDUINO
+	br_ssl_cert_reader cert_reader;
+	void *cert_reader_ctx;
+
+	/*
+	 * Largest encrypted record received and largest record sent
+	 * (header included) since the engine initialisation.
+	 */
+	size_t max_record_in;
+	size_t max_record_out;
+#endif
 
 	/*
 	 * List of supported protocol names (ALPN extension). If unset,
@@ -1095,6 +1119,14 @@ typedef struct {
 	br_tls_prf_impl prf10;
 	br_tls_prf_impl prf_sha256;
 	br_tls_prf_impl prf_sha384;
+
+	/*
+	 * HMAC key schedule over the master secret, shared by the TLS 1.2
+	 * PRF runs keyed with it (key block for each direction, Finished
+	 * messages, key export); dig_vtable is NULL until first use.
+	 */
+	br_hmac_key_context master_kc;
+
 	const br_block_cbcenc_class *iaes_cbcenc;
 	const br_block_cbcdec_class *iaes_cbcdec;
 	const br_block_ctr_class *iaes_ctr;
@@ -1290,6 +1322,60 @@ br_ssl_engine_set_x509(br_ssl_engine_context *cc, const br_x509_class **x509ctx)
 	cc->x509ctx = x509ctx;
 }
 
+#ifdef ARDUINO
+/**
+ * \brief Get the length of the largest encrypted record received.
+ *
+ * The length includes the 5-byte header. Such records must fit in the
+ * input buffer (unencrypted records are processed in chunks), so this
+ * is the input buffer size the peer has needed so far.
+ *
+ * \param cc   SSL engine context.
+ * \return  the largest record length, or 0.
+ */
+static inline size_t
+br_ssl_engine_get_max_record_in(const br_ssl_engine_context *cc)
+{
+	return cc->max_record_in;
+}
+
+/**
+ * \brief Get the length of the largest record sent.
+ *
+ * The length includes the 5-byte header and the encryption overhead;
+ * all outgoing records are assembled in the output buffer.
+ *
+ * \param cc   SSL engine context.
+ * \return  the largest record length, or 0.
+ */
+static inline size_t
+br_ssl_engine_get_max_record_out(const br_ssl_engine_context *cc)
+{
+	return cc->max_record_out;
+}
+
+/**
+ * \brief Set the reader for certificates sent by this engine.
+ *
+ * Without a reader, certificate data is read directly through the
+ * `data` pointers of the chain. With a reader, the chain is obtained
+ * in chunks of at most 256 bytes as the Certificate message is
+ * written, so it can be streamed from external storage. This must be
+ * set after the engine initialisation.
+ *
+ * \param cc       SSL engine context.
+ * \param reader   certificate reader, or `NULL`.
+ * \param ctx      context pointer passed to the reader.
+ */
+static inline void
+br_ssl_engine_set_cert_reader(br_ssl_engine_context *cc,
+	br_ssl_cert_reader reader, void *ctx)
+{
+	cc->cert_reader = reader;
+	cc->cert_reader_ctx = ctx;
+}
+#endif
+
 /**
  * \brief Set the supported protocol names.
  *
@@ -2590,6 +2676,29 @@ typedef struct {
 #endif
 } br_ssl_client_certificate_ec_context;
 
+#ifdef ARDUINO
+/**
+ * \brief Precomputed ephemeral ECDHE key.
+ *
+ * A client key pair generated ahead of a handshake with
+ * `br_ssl_ecdhe_key_generate()`, so that the handshake only has to
+ * compute the shared point. Scalars and points of up to 32 and 65
+ * bytes are supported, i.e. NIST P-256 and Curve25519. The key is
+ * used at most once: the engine clears the structure when it takes
+ * the key. Other fields are opaque.
+ */
+typedef struct {
+	/** \brief Curve identifier, 0 when no key is held. */
+	int curve;
+#ifndef BR_DOXYGEN_IGNORE
+	unsigned char key[32];
+	size_t key_len;
+	unsigned char point[65];
+	size_t point_len;
+#endif
+} br_ssl_ecdhe_key;
+#endif
+
 /**
  * \brief Context structure for a SSL client.
  *
@@ -2654,6 +2763,13 @@ struct br_ssl_client_context_ {
 	 * Implementations.
 	 */
 	br_rsa_public irsapub;
+
+#ifdef ARDUINO
+	/*
+	 * Precomputed ephemeral ECDHE key, if any.
+	 */
+	br_ssl_ecdhe_key *ecdhe_key;
+#endif
 #endif
 };
 
@@ -2811,6 +2927,43 @@ br_ssl_client_set_min_clienthello_len(br_ssl_client_context *cc, uint16_t len)
 	cc->min_clienthello_len = len;
 }
 
+#ifdef ARDUINO
+/**
+ * \brief Set the precomputed ephemeral ECDHE key.
+ *
+ * If the server selects an ECDHE suite on the curve of `key`, that
+ * key is used (and cleared) instead of generating a new one during
+ * the handshake. Otherwise the key is left untouched, for a later
+ * handshake. This must be set after the client initialisation; the
+ * structure must stay valid until the handshake completes.
+ *
+ * \param cc    client context.
+ * \param key   precomputed key, or `NULL`.
+ */
+static inline void
+br_ssl_client_set_ecdhe_key(br_ssl_client_context *cc, br_ssl_ecdhe_key *key)
+{
+	cc->ecdhe_key = key;
+}
+
+/**
+ * \brief Generate an ephemeral ECDHE key pair ahead of a handshake.
+ *
+ * The private key is produced as the handshake itself would do it,
+ * from the provided PRNG, and the public point is computed with
+ * `iec`. On failure (unsupported curve, or scalar or point too large
+ * for the structure), `key` is left empty.
+ *
+ * \param key     structure to fill.
+ * \param iec     EC implementation.
+ * \param rng     initialised PRNG.
+ * \param curve   curve identifier.
+ * \return  1 on success, 0 on error.
+ */
+int br_ssl_ecdhe_key_generate(br_ssl_ecdhe_key *key, const br_ec_impl *iec,
+	const br_prng_class **rng, int curve);
+#endif
+
 /**
  * \brief Prepare or reset a client context for a new connection.
  *
@@ -4056,6 +4209,8 @@ int br_sslio_read_all(br_sslio_context *cc, void *dst, size_t len);
 #ifdef ARDUINO
 int br_sslio_read_available(br_sslio_context *cc);
 int br_sslio_peek(br_sslio_context *cc, void *dst, size_t len);
+int br_sslio_step(br_sslio_context *cc, unsigned target);
+void br_ssl_engine_fail(br_ssl_engine_context *cc, int err);
 #endif
 
 /**
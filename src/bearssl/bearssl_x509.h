@@ -32,6 +32,11 @@
 #include "bearssl_hash.h"
 #include "bearssl_rsa.h"
 
+#ifdef ARDUINO
+/* BEAR_SSL_EC_ONLY changes the size of the contexts below */
+#include "../BearSSLConfig.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -551,9 +556,25 @@ void br_x509_knownkey_init_ec(br_x509_knownkey_context *ctx,
  * NIST P-521 (the largest curve we care to support), a public key is
  * encoded over 133 bytes only.
  */
+#ifdef ARDUINO
+/*
+ * With BEAR_SSL_EC_ONLY, all keys and signatures are ECDSA on curves up
+ * to P-521: 133 bytes for a key and 139 for an ASN.1 signature, which
+ * saves more than a kilobyte in each X.509 context. RSA keys and
+ * signatures are then rejected with BR_ERR_X509_LIMIT_EXCEEDED.
+ */
+#ifdef BEAR_SSL_EC_ONLY
+#define BR_X509_BUFSIZE_KEY   133
+#define BR_X509_BUFSIZE_SIG   139
+#endif
+#endif
+#ifndef BR_X509_BUFSIZE_KEY
 #define BR_X509_BUFSIZE_KEY   520
+#endif
+#ifndef BR_X509_BUFSIZE_SIG
 #define BR_X509_BUFSIZE_SIG   512
 #endif
+#endif
 
 /**
  * \brief Type for receiving a name element.
@@ -625,6 +646,59 @@ typedef struct {
 
 } br_name_element;
 
+#ifdef ARDUINO
+/**
+ * \brief Trust anchor index entry.
+ *
+ * An index has one entry per trust anchor, sorted by `dn_hash` (the
+ * first bytes of the SHA-256 hash of the anchor DN, compared as an
+ * unsigned big-endian value). `ta` is the position of the anchor in
+ * the array given to `br_x509_minimal_init()`.
+ */
+typedef struct {
+	unsigned char dn_hash[8];
+	uint16_t ta;
+} br_x509_ta_index_entry;
+
+/**
+ * \brief Trust anchor loader.
+ *
+ * Called with the SHA-256 hash of the DN being looked up, the loader
+ * returns the `n`-th trust anchor whose DN may match (the engine still
+ * checks the full hash), or `NULL` when there is none left. The returned
+ * anchor must stay valid until the next call.
+ */
+typedef const br_x509_trust_anchor *(*br_x509_ta_loader)(void *ctx,
+	const unsigned char *dn_hash, size_t n);
+
+/**
+ * \brief Trust anchor RSA signature verifier.
+ *
+ * Verifies a signature with the key of the trust anchor at position `ta`
+ * of the configured array, with the same parameters and result as a
+ * `br_rsa_pkcs1_vrfy` implementation, e.g. from a precomputed form of
+ * that key. It returns -1 when it can't handle that anchor, and the
+ * regular RSA implementation is then used.
+ */
+typedef int (*br_x509_ta_rsa_vrfy)(void *ctx, size_t ta,
+	const unsigned char *x, size_t xlen,
+	const unsigned char *hash_oid, size_t hash_len,
+	unsigned char *hash_out);
+
+/**
+ * \brief Trust anchor ECDSA signature verifier.
+ *
+ * Verifies an ECDSA signature ("asn1" format) over `hash` with the key
+ * of the trust anchor at position `ta` of the configured array, e.g.
+ * from a precomputed form of that key. It returns 1 if the signature
+ * is valid, 0 if it is not, and -1 when it can't handle that anchor,
+ * in which case the regular ECDSA implementation is used.
+ */
+typedef int (*br_x509_ta_ecdsa_vrfy)(void *ctx, size_t ta,
+	const void *hash, size_t hash_len,
+	const void *sig, size_t sig_len);
+#endif
+
 /**
  * \brief The "minimal" X.509 engine structure.
  *
@@ -699,6 +773,15 @@ typedef struct {
 	/* Configured trust anchors. */
 	const br_x509_trust_anchor *trust_anchors;
 	size_t trust_anchors_num;
+#ifdef ARDUINO
+	const br_x509_ta_index_entry *ta_index;
+	br_x509_ta_loader ta_loader;
+	void *ta_loader_ctx;
+	br_x509_ta_rsa_vrfy ta_rsa_vrfy;
+	void *ta_rsa_vrfy_ctx;
+	br_x509_ta_ecdsa_vrfy ta_ecdsa_vrfy;
+	void *ta_ecdsa_vrfy_ctx;
+#endif
 
 	/*
 	 * Multi-hasher for the TBS.
@@ -826,6 +909,81 @@ br_x509_minimal_set_ecdsa(br_x509_minimal_context *ctx,
 	ctx->iec = iec;
 }
 
+#ifdef ARDUINO
+/**
+ * \brief Set a trust anchor index for the X.509 "minimal" engine.
+ *
+ * With an index, anchors are located by binary search over the DN
+ * hashes instead of hashing every anchor DN for each lookup. The index
+ * is used only if the DN hash function is SHA-256; it must cover all
+ * configured anchors and stay valid as long as the context is used.
+ *
+ * \param ctx     validation context.
+ * \param index   sorted index (`trust_anchors_num` entries), or `NULL`.
+ */
+static inline void
+br_x509_minimal_set_ta_index(br_x509_minimal_context *ctx,
+	const br_x509_ta_index_entry *index)
+{
+	ctx->ta_index = index;
+}
+
+/**
+ * \brief Set a trust anchor loader for the X.509 "minimal" engine.
+ *
+ * Anchors provided by the loader are considered after the configured
+ * array, e.g. to fetch them on demand from external storage. Like the
+ * index, the loader is used only if the DN hash function is SHA-256.
+ *
+ * \param ctx          validation context.
+ * \param loader       loader callback, or `NULL`.
+ * \param loader_ctx   context pointer passed to the loader.
+ */
+static inline void
+br_x509_minimal_set_ta_loader(br_x509_minimal_context *ctx,
+	br_x509_ta_loader loader, void *loader_ctx)
+{
+	ctx->ta_loader = loader;
+	ctx->ta_loader_ctx = loader_ctx;
+}
+
+/**
+ * \brief Set an RSA verifier for trust anchor keys.
+ *
+ * The verifier is used for signatures made by RSA trust anchors of the
+ * configured array (not those of the loader).
+ *
+ * \param ctx        validation context.
+ * \param vrfy       verifier callback, or `NULL`.
+ * \param vrfy_ctx   context pointer passed to the verifier.
+ */
+static inline void
+br_x509_minimal_set_ta_rsa_vrfy(br_x509_minimal_context *ctx,
+	br_x509_ta_rsa_vrfy vrfy, void *vrfy_ctx)
+{
+	ctx->ta_rsa_vrfy = vrfy;
+	ctx->ta_rsa_vrfy_ctx = vrfy_ctx;
+}
+
+/**
+ * \brief Set an ECDSA verifier for trust anchor keys.
+ *
+ * The verifier is used for signatures made by EC trust anchors of the
+ * configured array (not those of the loader).
+ *
+ * \param ctx        validation context.
+ * \param vrfy       verifier callback, or `NULL`.
+ * \param vrfy_ctx   context pointer passed to the verifier.
+ */
+static inline void
+br_x509_minimal_set_ta_ecdsa_vrfy(br_x509_minimal_context *ctx,
+	br_x509_ta_ecdsa_vrfy vrfy, void *vrfy_ctx)
+{
+	ctx->ta_ecdsa_vrfy = vrfy;
+	ctx->ta_ecdsa_vrfy_ctx = vrfy_ctx;
+}
+#endif
+
 /**
  * \brief Initialise a "minimal" X.509 engine with default algorithms.
  *
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "inner.h"
+
+#if BR_ARMEL_CORTEXM_GCC
+
+/*
+ * ChaCha20 for the ARM Cortex-M cores (see BR_ARMEL_CORTEXM_GCC in
+ * config.h). Compared to chacha20_ct, the whole state is kept in local
+ * variables so that the compiler can allocate it in registers (all
+ * sixteen words fit on the M3/M4 with only a few spills), and the
+ * keystream is combined with the data one 32-bit word at a time when
+ * the buffer is aligned, instead of going through a temporary block.
+ *
+ * On ARMv7-M (Thumb-2), the quarter round is written in inline assembly
+ * with immediate rotations. The ARMv6-M (M0/M0+) instruction set only
+ * rotates by a register, which GCC already uses for the C expression.
+ */
+
+#if __thumb2__
+
+#define QROUND(a, b, c, d)   __asm__ ( \
+	"add  %[xa], %[xa], %[xb]\n\t" \
+	"eor  %[xd], %[xd], %[xa]\n\t" \
+	"ror  %[xd], %[xd], #16\n\t" \
+	"add  %[xc], %[xc], %[xd]\n\t" \
+	"eor  %[xb], %[xb], %[xc]\n\t" \
+	"ror  %[xb], %[xb], #20\n\t" \
+	"add  %[xa], %[xa], %[xb]\n\t" \
+	"eor  %[xd], %[xd], %[xa]\n\t" \
+	"ror  %[xd], %[xd], #24\n\t" \
+	"add  %[xc], %[xc], %[xd]\n\t" \
+	"eor  %[xb], %[xb], %[xc]\n\t" \
+	"ror  %[xb], %[xb], #25" \
+	: [xa] "+r" (a), [xb] "+r" (b), [xc] "+r" (c), [xd] "+r" (d))
+
+#else
+
+#define ROTL(x, n)   (((x) << (n)) | ((x) >> (32 - (n))))
+
+#define QROUND(a, b, c, d)   do { \
+		a += b; d ^= a; d = ROTL(d, 16); \
+		c += d; b ^= c; b = ROTL(b, 12); \
+		a += b; d ^= a; d = ROTL(d,  8); \
+		c += d; b ^= c; b = ROTL(b,  7); \
+	} while (0)
+
+#endif
+
+/* see bearssl_block.h */
+br_chacha20_run
+br_chacha20_cortexm_get(void)
+{
+	return &br_chacha20_cortexm_run;
+}
+
+/* see bearssl_block.h */
+uint32_t
+br_chacha20_cortexm_run(const void *key,
+	const void *iv, uint32_t cc, void *data, size_t len)
+{
+	unsigned char *buf;
+	uint32_t kw[8], ivw[3];
+	size_t u;
+
+	buf = data;
+	for (u = 0; u < 8; u ++) {
+		kw[u] = br_dec32le((const unsigned char *)key + (u << 2));
+	}
+	for (u = 0; u < 3; u ++) {
+		ivw[u] = br_dec32le((const unsigned char *)iv + (u << 2));
+	}
+	while (len > 0) {
+		uint32_t x0, x1, x2, x3, x4, x5, x6, x7;
+		uint32_t x8, x9, x10, x11, x12, x13, x14, x15;
+		uint32_t ks[16];
+		int i;
+
+		x0 = 0x61707865;
+		x1 = 0x3320646e;
+		x2 = 0x79622d32;
+		x3 = 0x6b206574;
+		x4 = kw[0];
+		x5 = kw[1];
+		x6 = kw[2];
+		x7 = kw[3];
+		x8 = kw[4];
+		x9 = kw[5];
+		x10 = kw[6];
+		x11 = kw[7];
+		x12 = cc;
+		x13 = ivw[0];
+		x14 = ivw[1];
+		x15 = ivw[2];
+		for (i = 0; i < 10; i ++) {
+			QROUND(x0, x4,  x8, x12);
+			QROUND(x1, x5,  x9, x13);
+			QROUND(x2, x6, x10, x14);
+			QROUND(x3, x7, x11, x15);
+			QROUND(x0, x5, x10, x15);
+			QROUND(x1, x6, x11, x12);
+			QROUND(x2, x7,  x8, x13);
+			QROUND(x3, x4,  x9, x14);
+		}
+		ks[0] = x0 + 0x61707865;
+		ks[1] = x1 + 0x3320646e;
+		ks[2] = x2 + 0x79622d32;
+		ks[3] = x3 + 0x6b206574;
+		ks[4] = x4 + kw[0];
+		ks[5] = x5 + kw[1];
+		ks[6] = x6 + kw[2];
+		ks[7] = x7 + kw[3];
+		ks[8] = x8 + kw[4];
+		ks[9] = x9 + kw[5];
+		ks[10] = x10 + kw[6];
+		ks[11] = x11 + kw[7];
+		ks[12] = x12 + cc;
+		ks[13] = x13 + ivw[0];
+		ks[14] = x14 + ivw[1];
+		ks[15] = x15 + ivw[2];
+
+		/*
+		 * The target is little-endian, so an aligned full block
+		 * is processed with word accesses.
+		 */
+		if (len >= 64 && ((uintptr_t)buf & 3) == 0) {
+			uint32_t *w;
+
+			w = (uint32_t *)(void *)buf;
+			for (u = 0; u < 16; u ++) {
+				w[u] ^= ks[u];
+			}
+			buf += 64;
+			len -= 64;
+		} else {
+			unsigned char tmp[64];
+			size_t clen;
+
+			for (u = 0; u < 16; u ++) {
+				br_enc32le(&tmp[u << 2], ks[u]);
+			}
+			clen = len < 64 ? len : 64;
+			for (u = 0; u < clen; u ++) {
+				buf[u] ^= tmp[u];
+			}
+			buf += clen;
+			len -= clen;
+		}
+		cc ++;
+	}
+	return cc;
+}
+
+#undef QROUND
+#undef ROTL
+
+#else
+
+/* see bearssl_block.h */
+br_chacha20_run
+br_chacha20_cortexm_get(void)
+{
+	return 0;
+}
+
+#endif
@@ -25,7 +25,7 @@
 #include "inner.h"
 
 /* see bearssl_block.h */
-uint32_t
+BR_FAST_FUNC uint32_t
 br_chacha20_ct_run(const void *key,
 	const void *iv, uint32_t cc, void *data, size_t len)
 {
@@ -50,7 +50,15 @@
  *
 #define BR_LOMUL   1
  */
-#ifdef ARDUINO
+
+/*
+ * Arduino boards are 32-bit (or smaller) microcontrollers, where the
+ * i15/m15 code is the safe default. Host builds on a 64-bit machine
+ * (simulators, native test environments) keep the autodetection, so
+ * that the i62 RSA and m31/i31 EC code is used there.
+ */
+#if defined(ARDUINO) && !defined(BR_LOMUL) \
+	&& !defined(__LP64__) && !defined(_WIN64)
 #define BR_LOMUL   1
 #endif
 
@@ -179,6 +187,101 @@
 #define BR_AES_X86NI   1
  */
 
+/*
+ * When BR_AES_HW is enabled, the AES peripheral of the board is used
+ * for AES-CBC and AES-CTR (hence AES-GCM), both for TLS records and by
+ * the AES wrapper classes. This is supported on SAMD51, nRF52 (AES-128
+ * encryption only) and ESP32, and ignored on other boards; key lengths
+ * the peripheral does not handle use the constant-time software code.
+ * The peripherals are not shared with other users of the same
+ * hardware (e.g. a BLE stack on nRF52), hence this is not enabled by
+ * default.
+ *
+#define BR_AES_HW   1
+ */
+
+/*
+ * When BR_SHA_HW is enabled, the SHA-1 and SHA-224/SHA-256 compression
+ * functions run on the hash peripheral of the board: the Integrity
+ * Check Monitor on SAMD51, the SHA accelerator on ESP32 variants that
+ * can resume from a saved state (S2, S3, C3 and later; the original
+ * ESP32 uses the software code). All users of these hash functions,
+ * including the TLS handshake hashes and the hash wrapper classes, then
+ * use the peripheral, with runs of whole input blocks handed over in a
+ * single call. As for BR_AES_HW, the ICM is not shared with other users
+ * of the same hardware, hence this is not enabled by default.
+ *
+#define BR_SHA_HW   1
+ */
+
+/*
+ * When BR_RAND_HW is enabled, br_prng_seeder_system() returns a seeder
+ * that reads the random number generator of the board: the TRNG on
+ * SAMD51, the RNG on nRF52 (not with a SoftDevice, which owns it), the
+ * ring oscillator on RP2040 and esp_fill_random() on ESP32, which is
+ * only a true random source while the radio or the bootloader entropy
+ * source is enabled. On Arduino builds this is enabled by default, and
+ * ignored on other boards; set it to 0 to disable it.
+ *
+#define BR_RAND_HW   0
+ */
+
+/*
+ * BR_EC_P256_GEN_TABLE_SIZE sets the number of precomputed tables of
+ * multiples of the generator used by the P-256 implementations
+ * (br_ec_p256_m15 and br_ec_p256_m31) to multiply the generator, i.e.
+ * for ECDHE key generation and ECDSA signing. With N tables (1, 2, 4
+ * or 8), that multiplication needs 256/N point doublings instead of
+ * 256; each table beyond the first uses 1080 (m31) or 1200 (m15) bytes
+ * of read-only data, which stays in flash. The default is 1.
+ *
+#define BR_EC_P256_GEN_TABLE_SIZE   4
+ */
+
+/*
+ * BR_RSA_WINDOW_BITS (2 to 5) sets the exponentiation window that the
+ * stack buffers of br_rsa_i15_private(), br_rsa_i31_private() and
+ * br_rsa_i62_private() can hold for the largest factors (4096-bit
+ * keys); smaller keys get a larger window (up to 5 bits) from the same
+ * buffer. Each extra bit doubles the number of factor-sized window
+ * temporaries on the stack: the default buffers take about 2.4 kB, 4
+ * takes about 6 kB and 5 about 10.5 kB. 4 makes a 2048-bit private key
+ * operation about 10% faster, and a 4096-bit one 30%. The default (0)
+ * keeps the stock buffers (a 1-bit window for 4096-bit keys, 3 bits for
+ * 2048-bit keys). The *_private_precomp() functions take their work area
+ * from the caller instead, where its size sets the window.
+ *
+#define BR_RSA_WINDOW_BITS   4
+ */
+
+/*
+ * When BR_STATIC_SCRATCH is enabled, the work areas of the RSA public
+ * and private key operations (br_rsa_i15_*() and br_rsa_i31_*()) and of
+ * ECDSA signature verification (br_ecdsa_i15_vrfy_raw() and
+ * br_ecdsa_i31_vrfy_raw()) come from one static buffer instead of the
+ * stack. This takes about 2 kB off the stack that each task running a
+ * TLS handshake needs, for a single buffer of that size shared by all
+ * of them (more with BR_RSA_WINDOW_BITS). If several tasks use these
+ * operations, a lock must be set with br_scratch_set_lock(); the
+ * operations then wait for each other.
+ *
+#define BR_STATIC_SCRATCH   1
+ */
+
+/*
+ * When BR_FAST_RAM is enabled, the inner loops of the AES (ct and big),
+ * GHASH (ctmul and ctmul32), SHA-256, ChaCha20, Poly1305 (ctmul and
+ * ctmul32) and P-256 (m15 and m31) implementations, and the tables they
+ * use, are placed in RAM instead of flash, which avoids the flash wait
+ * states on fast cores (Cortex-M7, ESP32, RP2040). This costs about 3 kB
+ * of RAM for the tables, and the size of the selected code. The section
+ * names can be set with BR_FAST_TEXT_SECTION and BR_FAST_DATA_SECTION,
+ * e.g. to the ITCM and DTCM sections of a custom linker script; see
+ * inner.h for the defaults.
+ *
+#define BR_FAST_RAM   1
+ */
+
 /*
  * When BR_SSE2 is enabled, SSE2 intrinsics will be used for some
  * algorithm implementations that use them (e.g. chacha20_sse2). If this
@@ -199,6 +302,19 @@
 #define BR_POWER8   1
  */
 
+/*
+ * When BR_ARMV8_CE is enabled, the implementations using the ARMv8
+ * Cryptography Extensions (AES, GHASH with pmull, SHA-1 and SHA-256)
+ * are compiled and used by default; SHA-1 and SHA-256 then always use
+ * the opcodes. If this is not enabled explicitly, it is enabled when
+ * the compiler targets little-endian AArch64 with the Crypto Extensions
+ * (e.g. -march=armv8-a+crypto), which is the case on Cortex-A53 boards
+ * such as the Portenta X8. If set explicitly to 0, that code will not
+ * be compiled at all.
+ *
+#define BR_ARMV8_CE   1
+ */
+
 /*
  * When BR_INT128 is enabled, then code using the 'unsigned __int64'
  * and 'unsigned __int128' types will be used to leverage 64x64->128
@@ -232,4 +348,21 @@
 #define BR_BE_UNALIGNED   1
  */
 
+/*
+ * When BR_ARM_UNALIGNED is enabled, then the 16-bit and 32-bit encoding
+ * and decoding functions (br_dec32be(), br_enc32le()...) used by the
+ * hash functions, AES and GHASH to load and store their blocks perform
+ * a single, possibly unaligned, memory access, with a REV instruction
+ * to swap the bytes of big-endian values, instead of four byte accesses
+ * and shifts. 64-bit values use two 32-bit accesses. This is for the
+ * little-endian ARMv7-M and ARMv8-M mainline cores (Cortex M3, M4, M7,
+ * M33), which allow unaligned LDR/STR but not unaligned LDRD/STRD or
+ * LDM/STM, so that BR_LE_UNALIGNED is not safe there. It is enabled by
+ * default with GCC and Clang when they allow unaligned accesses
+ * (__ARM_FEATURE_UNALIGNED, i.e. not with -mno-unaligned-access nor on
+ * Cortex M0/M0+). Set it to 0 to keep the byte accesses.
+ *
+#define BR_ARM_UNALIGNED   1
+ */
+
 #endif
@@ -32,6 +32,10 @@ api_generator(int curve, size_t *len)
 		return br_ec_p256_m31.generator(curve, len);
 	case BR_EC_curve25519:
 		return br_ec_c25519_m31.generator(curve, len);
+#ifdef ARDUINO
+	case BR_EC_secp384r1:
+		return br_ec_p384_m31.generator(curve, len);
+#endif
 	default:
 		return br_ec_prime_i31.generator(curve, len);
 	}
@@ -45,6 +49,10 @@ api_order(int curve, size_t *len)
 		return br_ec_p256_m31.order(curve, len);
 	case BR_EC_curve25519:
 		return br_ec_c25519_m31.order(curve, len);
+#ifdef ARDUINO
+	case BR_EC_secp384r1:
+		return br_ec_p384_m31.order(curve, len);
+#endif
 	default:
 		return br_ec_prime_i31.order(curve, len);
 	}
@@ -58,6 +66,10 @@ api_xoff(int curve, size_t *len)
 		return br_ec_p256_m31.xoff(curve, len);
 	case BR_EC_curve25519:
 		return br_ec_c25519_m31.xoff(curve, len);
+#ifdef ARDUINO
+	case BR_EC_secp384r1:
+		return br_ec_p384_m31.xoff(curve, len);
+#endif
 	default:
 		return br_ec_prime_i31.xoff(curve, len);
 	}
@@ -72,6 +84,10 @@ api_mul(unsigned char *G, size_t Glen,
 		return br_ec_p256_m31.mul(G, Glen, kb, kblen, curve);
 	case BR_EC_curve25519:
 		return br_ec_c25519_m31.mul(G, Glen, kb, kblen, curve);
+#ifdef ARDUINO
+	case BR_EC_secp384r1:
+		return br_ec_p384_m31.mul(G, Glen, kb, kblen, curve);
+#endif
 	default:
 		return br_ec_prime_i31.mul(G, Glen, kb, kblen, curve);
 	}
@@ -86,6 +102,10 @@ api_mulgen(unsigned char *R,
 		return br_ec_p256_m31.mulgen(R, x, xlen, curve);
 	case BR_EC_curve25519:
 		return br_ec_c25519_m31.mulgen(R, x, xlen, curve);
+#ifdef ARDUINO
+	case BR_EC_secp384r1:
+		return br_ec_p384_m31.mulgen(R, x, xlen, curve);
+#endif
 	default:
 		return br_ec_prime_i31.mulgen(R, x, xlen, curve);
 	}
@@ -103,6 +123,11 @@ api_muladd(unsigned char *A, const unsigned char *B, size_t len,
 	case BR_EC_curve25519:
 		return br_ec_c25519_m31.muladd(A, B, len,
 			x, xlen, y, ylen, curve);
+#ifdef ARDUINO
+	case BR_EC_secp384r1:
+		return br_ec_p384_m31.muladd(A, B, len,
+			x, xlen, y, ylen, curve);
+#endif
 	default:
 		return br_ec_prime_i31.muladd(A, B, len,
 			x, xlen, y, ylen, curve);
@@ -144,6 +144,16 @@ le30_to_le8(unsigned char *dst, size_t len, const uint32_t *src)
 	}
 }
 
+#if BR_EC_CORTEXM
+
+/*
+ * Assembly versions for Cortex-M4/M7, see ec_cortexm.c.
+ */
+#define mul9      br_ec_cortexm_mul9
+#define square9   br_ec_cortexm_square9
+
+#else
+
 /*
  * Multiply two integers. Source integers are represented as arrays of
  * nine 30-bit words, for values up to 2^270-1. Result is encoded over
@@ -334,6 +344,8 @@ square9(uint32_t *d, const uint32_t *a)
 	d[17] = (uint32_t)cc;
 }
 
+#endif
+
 /*
  * Perform a "final reduction" in field F255 (field for Curve25519)
  * The source value must be less than twice the modulus. If the value
@@ -767,3 +779,649 @@ const br_ec_impl br_ec_c25519_m31 = {
 	&api_mulgen,
 	&api_muladd
 };
+
+#ifdef ARDUINO
+
+/*
+ * Ed25519 (RFC 8032), on the field code above. Points are in extended
+ * twisted Edwards coordinates (X:Y:Z:T), with x = X/Z, y = Y/Z and
+ * T = X*Y/Z; all field values are lower than twice the modulus, as
+ * produced by the f255_*() functions.
+ */
+
+typedef struct {
+	uint32_t x[9], y[9], z[9], t[9];
+} ed_point;
+
+/*
+ * Precomputed affine point: y + x, y - x, 2*d*x*y.
+ */
+typedef struct {
+	uint32_t ypx[9], ymx[9], xy2d[9];
+} ed_niels;
+
+static const uint32_t ED_ZERO[9] = { 0 };
+static const uint32_t ED_ONE[9] = { 1 };
+
+static const uint32_t ED_D[] = {
+	0x135978A3, 0x17AD3728, 0x141D8AB7, 0x1C029350, 0x39E89800,
+	0x1D01E5DD, 0x3FE738CC, 0x1B3B8ADB, 0x00005203
+};
+
+static const uint32_t ED_D2[] = {
+	0x26B2F159, 0x2F5A6E50, 0x283B156E, 0x380526A0, 0x33D13000,
+	0x3A03CBBB, 0x3FCE7198, 0x367715B7, 0x00002406
+};
+
+static const uint32_t ED_SQRTM1[] = {
+	0x0A0EA0B0, 0x13B86C9D, 0x12FE478C, 0x10C601AB, 0x3BD7A72F,
+	0x340264F7, 0x1DF0B2B4, 0x092013F0, 0x00002B83
+};
+
+/*
+ * ED_GEN[i-1] is the sum of 2^(64*j)*B for all bits j set in i (base
+ * point B), for the 4-teeth comb of ed_mulgen().
+ */
+static const uint32_t ED_GEN[15][27] = {
+	{
+		0x358C3B85, 0x3EF24F1B, 0x38C0E192, 0x24CB71BE, 0x3D42C2CF,
+		0x2D226190, 0x0BA65270, 0x274E8CF5, 0x000007CF,
+		0x1740913E, 0x3440E417, 0x140BEB39, 0x0E67C174, 0x0F8A09FD,
+		0x0610D1A2, 0x01267A5C, 0x0BE4A63E, 0x000044FD,
+		0x077AAA68, 0x2F244816, 0x0AAC49EA, 0x367A08F3, 0x03598C26,
+		0x2DF72F75, 0x065A85A1, 0x1EDA27C3, 0x00006F11
+	},
+	{
+		0x37D1F515, 0x34A9979D, 0x3AA60F1C, 0x226461E3, 0x3C06E554,
+		0x1CEEF36A, 0x0C9FBB1B, 0x1E32EA5F, 0x00006548,
+		0x0DF6B0FE, 0x044E3B1E, 0x175F51B5, 0x25F6A279, 0x3AF1B953,
+		0x01E875C5, 0x0D650092, 0x3F6E8AC8, 0x00002102,
+		0x055CE6A1, 0x1A7B9014, 0x251AD299, 0x2F29DA04, 0x3DA41536,
+		0x2BD45EA9, 0x0B2BA3A1, 0x0976CA7B, 0x00000AD7
+	},
+	{
+		0x201E59E8, 0x01571615, 0x2480E600, 0x24CD0AD9, 0x05E44C87,
+		0x12AB43F9, 0x3CF2B3E1, 0x36399204, 0x000026EA,
+		0x1C8462A4, 0x2DD6E2DA, 0x3D31CD7C, 0x361BF159, 0x1342F62D,
+		0x25CBB220, 0x12F2FCD1, 0x2D65C3F0, 0x00000975,
+		0x1A5BA743, 0x0F3C8C0F, 0x2F1BA6E6, 0x2FE76054, 0x3367DA04,
+		0x1E4342A9, 0x2C5EA333, 0x1C11E77D, 0x00005346
+	},
+	{
+		0x2CAD8EA2, 0x20EC12FE, 0x08BE8845, 0x2DD0FA05, 0x10C5DB29,
+		0x3960EC20, 0x3BBAA2B1, 0x127963AC, 0x00002B54,
+		0x2B3DBE47, 0x3CE9D58B, 0x2BDA0B85, 0x3A8E1523, 0x347299F7,
+		0x0F94C515, 0x3D55100C, 0x3A79C589, 0x00001304,
+		0x2ADC9CFE, 0x22605349, 0x348DD0B7, 0x06EACFE2, 0x39C60A3C,
+		0x3F87FFE5, 0x1D693DA0, 0x378B5F0B, 0x00004468
+	},
+	{
+		0x23BC6748, 0x04609E37, 0x0B20EF72, 0x07FF5834, 0x3BB198E7,
+		0x06F94719, 0x03D4DF55, 0x0D993415, 0x000026A1,
+		0x13A339EE, 0x2548B4EC, 0x0D895292, 0x1489541B, 0x34F0F185,
+		0x28EB52B3, 0x2742EDFE, 0x1AEE9E50, 0x000049D7,
+		0x0D56E61D, 0x13E908CE, 0x351299A1, 0x074E51B0, 0x2DB18519,
+		0x355DB69E, 0x0EDC2247, 0x2BF8EA3F, 0x00004E1F
+	},
+	{
+		0x236A044C, 0x179C14F4, 0x38D87E31, 0x376F2C4E, 0x21A8283C,
+		0x25834B4C, 0x1BBA4519, 0x2683C3F1, 0x00004E55,
+		0x1C12701C, 0x3803A1DA, 0x39C3B5FF, 0x37370280, 0x02EB1B95,
+		0x25152C30, 0x3530CC16, 0x0874D7E1, 0x00007270,
+		0x27DF241E, 0x15C4101C, 0x2900D36A, 0x117BEAAC, 0x269ADEDF,
+		0x3B6D7182, 0x3C01DFE6, 0x2DCC01EE, 0x000064FC
+	},
+	{
+		0x2FD390CA, 0x23BD6331, 0x31A98FC3, 0x1E195D45, 0x02D65FEF,
+		0x02DE3F11, 0x086EF885, 0x319B5BF4, 0x00006F34,
+		0x3898DC04, 0x0FCF2ED0, 0x307B7279, 0x247FEC90, 0x34981D07,
+		0x36025B38, 0x09F6DD7B, 0x22E3A2E1, 0x00000B59,
+		0x0CC2F689, 0x073F0628, 0x129CE2A1, 0x045181ED, 0x0B594081,
+		0x2F011B00, 0x066C80A9, 0x0A2C2C6B, 0x00004121
+	},
+	{
+		0x080C1AC0, 0x19B73277, 0x338A436A, 0x28173D06, 0x1BD7C697,
+		0x2FCEFA57, 0x27DABA7E, 0x2E3DA35F, 0x00007DA0,
+		0x385675A6, 0x3DE08050, 0x2FDA9E8E, 0x1927CC2A, 0x1FA8CBA2,
+		0x07AD4173, 0x1C0B34CD, 0x16AE8753, 0x00004611,
+		0x03B5DA76, 0x103C654F, 0x1119E9BD, 0x2B1BDCC8, 0x3259601D,
+		0x318087FA, 0x34B4B03C, 0x221FA0D9, 0x00005A5F
+	},
+	{
+		0x0CA2C1F4, 0x2A358060, 0x068DF400, 0x17AC36F3, 0x2F4E9981,
+		0x19E91EE0, 0x315C0D7E, 0x0A24181F, 0x000045A0,
+		0x3D41F184, 0x3BCD9B47, 0x1CFE11EF, 0x1A528440, 0x10A74D8B,
+		0x27857805, 0x351BA4B3, 0x3C0F5AB4, 0x00004013,
+		0x2EE065CC, 0x340A0B71, 0x24AE646B, 0x2E653F48, 0x3CE87436,
+		0x3A6B63FA, 0x06E4F534, 0x1570767C, 0x00004822
+	},
+	{
+		0x31CEF800, 0x300FAB3D, 0x28AFEBB3, 0x0D9D5132, 0x29C47790,
+		0x3FA8A1A8, 0x15462383, 0x24EC2F19, 0x00004E85,
+		0x23E5638C, 0x0B78452A, 0x1C4F20D1, 0x0A92AA4A, 0x0B13A3BA,
+		0x034A75EE, 0x3794456B, 0x06925EE6, 0x00006BB9,
+		0x05E7D206, 0x2927991B, 0x263C4452, 0x0FBE7364, 0x2B529EB1,
+		0x2DB3A3B6, 0x3E39B50A, 0x1F5E6C3A, 0x000020CF
+	},
+	{
+		0x0AE75C48, 0x2F4A3D3A, 0x0000B60C, 0x3780A451, 0x3C21703C,
+		0x2EE72262, 0x30886373, 0x2214E7D5, 0x00007C11,
+		0x30FE7DCA, 0x36D24E77, 0x3A951CE7, 0x03AE43F2, 0x3E1D1DF5,
+		0x2F9870D5, 0x1469D098, 0x188DE226, 0x00000235,
+		0x215A4C03, 0x03DBBFEB, 0x0778E052, 0x11C2A50F, 0x19DE672F,
+		0x14280FF2, 0x2148379F, 0x00623441, 0x000038D2
+	},
+	{
+		0x0E6315DF, 0x0FA046B4, 0x2AEB2902, 0x19434178, 0x1D586C0B,
+		0x283D669D, 0x34DEEB7B, 0x3B751787, 0x0000043E,
+		0x07073217, 0x1B051FCB, 0x3AFD20CF, 0x146E467C, 0x01F802C6,
+		0x3F6FF5C1, 0x1073E258, 0x13EA53D1, 0x0000173C,
+		0x128DF9C4, 0x35C7A982, 0x373562D3, 0x1F9E018C, 0x1552B25B,
+		0x0145328A, 0x0C472D9B, 0x1C09264F, 0x00001E2A
+	},
+	{
+		0x145C811F, 0x00683EF3, 0x2EC08036, 0x2DEF1F64, 0x12407F24,
+		0x2B98AC5F, 0x25B26A0C, 0x10FB8188, 0x00005FCB,
+		0x3509FBA4, 0x041426E4, 0x1631B753, 0x236CDD81, 0x001C870D,
+		0x3B32E949, 0x2E77397D, 0x127D046C, 0x00000446,
+		0x1598215F, 0x303492B6, 0x036628C0, 0x1FE409B3, 0x16DCEA1B,
+		0x38BD55C0, 0x0E58F338, 0x06FE9730, 0x00000C8A
+	},
+	{
+		0x281D104C, 0x379C0ED5, 0x263CB458, 0x0BDE9644, 0x256C633D,
+		0x04305C73, 0x3E6CAAE7, 0x1F1FBF30, 0x00006B85,
+		0x0B2801C0, 0x27495AD2, 0x0400FC47, 0x27EFAB0F, 0x33BA417E,
+		0x06AC751C, 0x18ACAA75, 0x0AFD7750, 0x000009DE,
+		0x2FF0687F, 0x2FC43FCF, 0x1E37BA23, 0x2EBA8D3C, 0x26034D5E,
+		0x39849875, 0x242CAE49, 0x1B8AB0EC, 0x00005B46
+	},
+	{
+		0x07FBB842, 0x0DFBAD9D, 0x0811A8B1, 0x37D71D58, 0x38C89A79,
+		0x2E9DBDC7, 0x0FFC25A2, 0x0A958EF2, 0x00000995,
+		0x1C7EF83C, 0x0AA32D2F, 0x393C226A, 0x2D71BE97, 0x24E3A596,
+		0x2FAC6C19, 0x2CF2FD4E, 0x12B73971, 0x0000409B,
+		0x034350C4, 0x1354F6E6, 0x1F505B44, 0x0A64C169, 0x09FF2F89,
+		0x0BEA8965, 0x17D64FB2, 0x1A29C119, 0x000069B9
+	}
+};
+
+/*
+ * Group order L, big-endian.
+ */
+static const unsigned char ED_ORDER[] = {
+	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0xDE, 0xF9, 0xDE, 0xA2, 0xF7, 0x9C, 0xD6,
+	0x58, 0x12, 0x63, 0x1A, 0x5C, 0xF5, 0xD3, 0xED
+};
+
+/*
+ * Compute d = a^(2^252-3) (with invert = 0) or d = 1/a = a^(2^255-21)
+ * (with invert = 1), with the addition chain of api_mul().
+ */
+static void
+f255_pow_chain(uint32_t *d, const uint32_t *a, int invert)
+{
+	uint32_t t[9], u[9];
+	uint32_t e;
+	int i, n;
+
+	memcpy(t, a, sizeof t);
+	for (i = 0; i < 15; i ++) {
+		f255_square(t, t);
+		f255_mul(t, t, a);
+	}
+	memcpy(u, t, sizeof t);
+	for (i = 0; i < 14; i ++) {
+		int j;
+
+		for (j = 0; j < 16; j ++) {
+			f255_square(u, u);
+		}
+		f255_mul(u, u, t);
+	}
+	if (invert) {
+		e = 0x7FEB;
+		n = 15;
+	} else {
+		e = 0x0FFD;
+		n = 12;
+	}
+	for (i = n - 1; i >= 0; i --) {
+		f255_square(u, u);
+		if ((e >> i) & 1) {
+			f255_mul(u, u, a);
+		}
+	}
+	memcpy(d, u, sizeof u);
+}
+
+/*
+ * Return 1 if a and b are equal modulo p, 0 otherwise.
+ */
+static uint32_t
+f255_eq(const uint32_t *a, const uint32_t *b)
+{
+	uint32_t t[9], u[9], r;
+	int i;
+
+	memcpy(t, a, sizeof t);
+	memcpy(u, b, sizeof u);
+	reduce_final_f255(t);
+	reduce_final_f255(u);
+	r = 0;
+	for (i = 0; i < 9; i ++) {
+		r |= t[i] ^ u[i];
+	}
+	return EQ(r, 0);
+}
+
+static void
+ed_set_neutral(ed_point *P)
+{
+	memset(P, 0, sizeof *P);
+	P->y[0] = 1;
+	P->z[0] = 1;
+}
+
+/*
+ * Common end of the doubling and addition formulas: set P from E, F,
+ * G and H.
+ */
+static void
+ed_add_finish(ed_point *P, const uint32_t *e, const uint32_t *f,
+	const uint32_t *g, const uint32_t *h)
+{
+	f255_mul(P->x, e, f);
+	f255_mul(P->y, g, h);
+	f255_mul(P->t, e, h);
+	f255_mul(P->z, f, g);
+}
+
+/*
+ * P <- 2*P (dbl-2008-hwcd, with a = -1).
+ */
+static void
+ed_double(ed_point *P)
+{
+	uint32_t a[9], b[9], c[9], e[9], f[9], g[9], h[9];
+
+	f255_square(a, P->x);
+	f255_square(b, P->y);
+	f255_square(c, P->z);
+	f255_add(c, c, c);
+	f255_add(e, P->x, P->y);
+	f255_square(e, e);
+	f255_add(h, a, b);
+	f255_sub(e, e, h);
+	f255_sub(g, b, a);
+	f255_sub(f, g, c);
+	f255_sub(h, ED_ZERO, h);
+	ed_add_finish(P, e, f, g, h);
+}
+
+/*
+ * P <- P + Q (add-2008-hwcd-3). The formulas are complete, so this
+ * works for all inputs, including P = Q and the neutral.
+ */
+static void
+ed_add(ed_point *P, const ed_point *Q)
+{
+	uint32_t a[9], b[9], c[9], d[9], e[9], f[9], g[9], h[9];
+
+	f255_sub(a, P->y, P->x);
+	f255_sub(e, Q->y, Q->x);
+	f255_mul(a, a, e);
+	f255_add(b, P->y, P->x);
+	f255_add(e, Q->y, Q->x);
+	f255_mul(b, b, e);
+	f255_mul(c, P->t, Q->t);
+	f255_mul(c, c, ED_D2);
+	f255_mul(d, P->z, Q->z);
+	f255_add(d, d, d);
+	f255_sub(e, b, a);
+	f255_sub(f, d, c);
+	f255_add(g, d, c);
+	f255_add(h, b, a);
+	ed_add_finish(P, e, f, g, h);
+}
+
+/*
+ * P <- P + Q, with Q in precomputed affine form.
+ */
+static void
+ed_add_niels(ed_point *P, const ed_niels *Q)
+{
+	uint32_t a[9], b[9], c[9], d[9], e[9], f[9], g[9], h[9];
+
+	f255_sub(a, P->y, P->x);
+	f255_mul(a, a, Q->ymx);
+	f255_add(b, P->y, P->x);
+	f255_mul(b, b, Q->ypx);
+	f255_mul(c, P->t, Q->xy2d);
+	f255_add(d, P->z, P->z);
+	f255_sub(e, b, a);
+	f255_sub(f, d, c);
+	f255_add(g, d, c);
+	f255_add(h, b, a);
+	ed_add_finish(P, e, f, g, h);
+}
+
+/*
+ * Encode P (32 bytes): y, with the parity of x in the top bit.
+ */
+static void
+ed_encode(unsigned char *dst, const ed_point *P)
+{
+	uint32_t zi[9], x[9], y[9];
+
+	f255_pow_chain(zi, P->z, 1);
+	f255_mul(x, P->x, zi);
+	f255_mul(y, P->y, zi);
+	reduce_final_f255(x);
+	reduce_final_f255(y);
+	le30_to_le8(dst, 32, y);
+	dst[31] |= (unsigned char)((x[0] & 1) << 7);
+}
+
+/*
+ * Decode a point. Returned value is 1 on success, 0 if the encoding is
+ * not canonical or not on the curve. Variable-time (public keys only).
+ */
+static uint32_t
+ed_decode(ed_point *P, const unsigned char *src)
+{
+	unsigned char buf[32];
+	uint32_t u[9], v[9], w[9], x[9];
+	uint32_t sign;
+
+	memcpy(buf, src, 32);
+	sign = buf[31] >> 7;
+	buf[31] &= 0x7F;
+	P->y[8] = le8_to_le30(P->y, buf, 32);
+	memcpy(u, P->y, sizeof u);
+	if (reduce_final_f255(u)) {
+		return 0;
+	}
+
+	/*
+	 * x^2 = u/v with u = y^2 - 1 and v = d*y^2 + 1; the candidate
+	 * root is x = u*v^3*(u*v^7)^((p-5)/8).
+	 */
+	f255_square(w, P->y);
+	f255_sub(u, w, ED_ONE);
+	f255_mul(v, w, ED_D);
+	f255_add(v, v, ED_ONE);
+	f255_square(w, v);
+	f255_mul(w, w, v);
+	f255_mul(x, w, u);
+	f255_square(w, w);
+	f255_mul(w, w, v);
+	f255_mul(w, w, u);
+	f255_pow_chain(w, w, 0);
+	f255_mul(x, x, w);
+
+	f255_square(w, x);
+	f255_mul(w, w, v);
+	if (!f255_eq(w, u)) {
+		f255_sub(u, ED_ZERO, u);
+		if (!f255_eq(w, u)) {
+			return 0;
+		}
+		f255_mul(x, x, ED_SQRTM1);
+	}
+	reduce_final_f255(x);
+	if ((x[0] & 1) != sign) {
+		uint32_t nz;
+		int i;
+
+		nz = 0;
+		for (i = 0; i < 9; i ++) {
+			nz |= x[i];
+		}
+		if (nz == 0) {
+			return 0;
+		}
+		f255_sub(x, ED_ZERO, x);
+	}
+	memcpy(P->x, x, sizeof x);
+	memset(P->z, 0, sizeof P->z);
+	P->z[0] = 1;
+	f255_mul(P->t, P->x, P->y);
+	return 1;
+}
+
+/*
+ * P <- k*B for a 32-byte little-endian scalar k (constant-time): comb
+ * with four teeth 64 bits apart, i.e. 64 doublings and 64 additions.
+ */
+static void
+ed_mulgen(ed_point *P, const unsigned char *k)
+{
+	int i;
+
+	ed_set_neutral(P);
+	for (i = 63; i >= 0; i --) {
+		ed_niels Q;
+		uint32_t idx;
+		int j;
+
+		idx = ((uint32_t)(k[i >> 3] >> (i & 7)) & 1)
+			| (((uint32_t)(k[(i + 64) >> 3] >> (i & 7)) & 1) << 1)
+			| (((uint32_t)(k[(i + 128) >> 3] >> (i & 7)) & 1) << 2)
+			| (((uint32_t)(k[(i + 192) >> 3] >> (i & 7)) & 1) << 3);
+
+		memset(&Q, 0, sizeof Q);
+		Q.ypx[0] = 1;
+		Q.ymx[0] = 1;
+		for (j = 0; j < 15; j ++) {
+			CCOPY(EQ(idx, (uint32_t)j + 1), &Q, ED_GEN[j], sizeof Q);
+		}
+		ed_double(P);
+		ed_add_niels(P, &Q);
+	}
+}
+
+/*
+ * P <- k*P for a 32-byte little-endian scalar k, with a 4-bit window.
+ * Variable-time (verification only).
+ */
+static void
+ed_mul(ed_point *P, const unsigned char *k)
+{
+	ed_point W[15];
+	int i;
+
+	W[0] = *P;
+	for (i = 1; i < 15; i ++) {
+		W[i] = W[i - 1];
+		ed_add(&W[i], P);
+	}
+	ed_set_neutral(P);
+	for (i = 63; i >= 0; i --) {
+		unsigned w;
+
+		ed_double(P);
+		ed_double(P);
+		ed_double(P);
+		ed_double(P);
+		w = (k[i >> 1] >> ((i & 1) << 2)) & 0x0F;
+		if (w != 0) {
+			ed_add(P, &W[w - 1]);
+		}
+	}
+}
+
+/*
+ * Scalars modulo L are handled with the i31 code; these convert from
+ * little-endian (Ed25519) to big-endian (i31 codec) and back.
+ */
+static void
+sc_reverse(unsigned char *dst, const unsigned char *src, size_t len)
+{
+	size_t u;
+
+	for (u = 0; u < len; u ++) {
+		dst[u] = src[len - 1 - u];
+	}
+}
+
+/*
+ * d <- src mod L; src is little-endian (len <= 64 bytes).
+ */
+static void
+sc_reduce(uint32_t *d, const uint32_t *L, const unsigned char *src, size_t len)
+{
+	unsigned char buf[64];
+
+	sc_reverse(buf, src, len);
+	br_i31_decode_reduce(d, buf, len, L);
+}
+
+static void
+sc_encode(unsigned char *dst, const uint32_t *x)
+{
+	unsigned char buf[32];
+
+	br_i31_encode(buf, 32, x);
+	sc_reverse(dst, buf, 32);
+}
+
+/*
+ * Hash the concatenation of up to three chunks with SHA-512, and
+ * reduce the result modulo L.
+ */
+static void
+sc_hash(uint32_t *d, const uint32_t *L,
+	const void *a, size_t alen, const void *b, size_t blen,
+	const void *c, size_t clen)
+{
+	br_sha512_context hc;
+	unsigned char h[64];
+
+	br_sha512_init(&hc);
+	br_sha512_update(&hc, a, alen);
+	br_sha512_update(&hc, b, blen);
+	br_sha512_update(&hc, c, clen);
+	br_sha512_out(&hc, h);
+	sc_reduce(d, L, h, sizeof h);
+}
+
+/*
+ * Expand the 32-byte seed: clamped secret scalar a and nonce prefix.
+ */
+static void
+ed_expand(unsigned char *a, unsigned char *prefix, const unsigned char *seed)
+{
+	br_sha512_context hc;
+	unsigned char h[64];
+
+	br_sha512_init(&hc);
+	br_sha512_update(&hc, seed, 32);
+	br_sha512_out(&hc, h);
+	h[0] &= 0xF8;
+	h[31] &= 0x7F;
+	h[31] |= 0x40;
+	memcpy(a, h, 32);
+	if (prefix != NULL) {
+		memcpy(prefix, h + 32, 32);
+	}
+}
+
+/* see bearssl_ec.h */
+void
+br_ed25519_m31_public_key(unsigned char *pub, const unsigned char *seed)
+{
+	unsigned char a[32];
+	ed_point A;
+
+	ed_expand(a, NULL, seed);
+	ed_mulgen(&A, a);
+	ed_encode(pub, &A);
+}
+
+/* see bearssl_ec.h */
+size_t
+br_ed25519_m31_sign(unsigned char *sig, const unsigned char *seed,
+	const unsigned char *pub, const void *msg, size_t msg_len)
+{
+	unsigned char a[32], prefix[32], A[32], rb[32];
+	uint32_t L[10], r[10], k[10], x[10], z[20];
+	unsigned char zb[64];
+	ed_point R;
+
+	br_i31_decode(L, ED_ORDER, sizeof ED_ORDER);
+	ed_expand(a, prefix, seed);
+	if (pub == NULL) {
+		ed_mulgen(&R, a);
+		ed_encode(A, &R);
+	} else {
+		memcpy(A, pub, 32);
+	}
+
+	/*
+	 * r = H(prefix || M) mod L, R = r*B.
+	 */
+	sc_hash(r, L, prefix, 32, msg, msg_len, NULL, 0);
+	sc_encode(rb, r);
+	ed_mulgen(&R, rb);
+	ed_encode(sig, &R);
+
+	/*
+	 * S = (r + H(R || A || M)*a) mod L.
+	 */
+	sc_hash(k, L, sig, 32, A, 32, msg, msg_len);
+	sc_reduce(x, L, a, 32);
+	br_i31_zero(z, k[0]);
+	br_i31_mulacc(z, k, x);
+	br_i31_encode(zb, sizeof zb, z);
+	br_i31_decode_reduce(x, zb, sizeof zb, L);
+	br_i31_add(x, r, 1);
+	br_i31_sub(x, L, NOT(br_i31_sub(x, L, 0)));
+	sc_encode(sig + 32, x);
+	return 64;
+}
+
+/* see bearssl_ec.h */
+uint32_t
+br_ed25519_m31_verify(const unsigned char *sig, const unsigned char *pub,
+	const void *msg, size_t msg_len)
+{
+	uint32_t L[10], k[10];
+	unsigned char kb[32], sb[32], Rb[32];
+	ed_point A, P;
+	int i;
+
+	/*
+	 * S must be lower than L (no malleability).
+	 */
+	sc_reverse(sb, sig + 32, 32);
+	for (i = 0; i < 32; i ++) {
+		if (sb[i] != ED_ORDER[i]) {
+			break;
+		}
+	}
+	if (i == 32 || sb[i] > ED_ORDER[i]) {
+		return 0;
+	}
+
+	if (!ed_decode(&A, pub)) {
+		return 0;
+	}
+
+	/*
+	 * Check that S*B - H(R || A || M)*A encodes to R.
+	 */
+	br_i31_decode(L, ED_ORDER, sizeof ED_ORDER);
+	sc_hash(k, L, sig, 32, pub, 32, msg, msg_len);
+	sc_encode(kb, k);
+	f255_sub(A.x, ED_ZERO, A.x);
+	f255_sub(A.t, ED_ZERO, A.t);
+	ed_mul(&A, kb);
+	ed_mulgen(&P, sig + 32);
+	ed_add(&P, &A);
+	ed_encode(Rb, &P);
+	return memcmp(Rb, sig, 32) == 0;
+}
+
+#endif
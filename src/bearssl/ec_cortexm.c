@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "inner.h"
+
+#if BR_EC_CORTEXM
+
+/*
+ * Multiplication and squaring of 270-bit integers for the 31-bit
+ * P-256 and Curve25519 code (mul9() and square9() in ec_p256_m31.c and
+ * ec_c25519_m31.c), for Cortex-M4/M7 (see BR_EC_CORTEXM). On these cores,
+ * UMLAL is a single-cycle, constant-time opcode, so the nine words of
+ * the first operand are kept in r4..r12 and each column of the product
+ * is accumulated in r0:r1 with one UMLAL per partial product; the
+ * second operand is read through lr, and r3 points to the output.
+ * Bounds are the same as in the generic C code (the accumulator never
+ * exceeds 64 bits).
+ */
+
+#define EC_CM_MAC(A, off) \
+	"ldr    r2, [lr, #" #off "]\n\t" \
+	"umlal  r0, r1, " #A ", r2\n\t"
+
+#define EC_CM_SQR(A) \
+	"umlal  r0, r1, " #A ", " #A "\n\t"
+
+#define EC_CM_OUT(off) \
+	"bic    r2, r0, #0xC0000000\n\t" \
+	"str    r2, [r3, #" #off "]\n\t" \
+	"lsr    r0, r0, #30\n\t" \
+	"orr    r0, r0, r1, lsl #2\n\t" \
+	"lsr    r1, r1, #30\n\t"
+
+#define EC_CM_LOAD \
+	"ldr    lr, %[b]\n\t" \
+	"ldr    r3, %[d]\n\t" \
+	"ldr    r2, %[a]\n\t" \
+	"ldm    r2, {r4, r5, r6, r7, r8, r9, r10, r11, r12}\n\t" \
+	"mov    r0, #0\n\t" \
+	"mov    r1, #0\n\t"
+
+#define EC_CM_CLOBBERS \
+	"r0", "r1", "r2", "r3", "r4", "r5", "r6", "r7", "r8", "r9", \
+	"r10", "r11", "r12", "lr", "cc", "memory"
+
+/* see inner.h */
+void
+br_ec_cortexm_mul9(uint32_t *d, const uint32_t *a, const uint32_t *b)
+{
+	__asm__ __volatile__ (
+	EC_CM_LOAD
+	EC_CM_MAC(r4, 0)
+	EC_CM_OUT(0)
+	EC_CM_MAC(r5, 0)
+	EC_CM_MAC(r4, 4)
+	EC_CM_OUT(4)
+	EC_CM_MAC(r6, 0)
+	EC_CM_MAC(r5, 4)
+	EC_CM_MAC(r4, 8)
+	EC_CM_OUT(8)
+	EC_CM_MAC(r7, 0)
+	EC_CM_MAC(r6, 4)
+	EC_CM_MAC(r5, 8)
+	EC_CM_MAC(r4, 12)
+	EC_CM_OUT(12)
+	EC_CM_MAC(r8, 0)
+	EC_CM_MAC(r7, 4)
+	EC_CM_MAC(r6, 8)
+	EC_CM_MAC(r5, 12)
+	EC_CM_MAC(r4, 16)
+	EC_CM_OUT(16)
+	EC_CM_MAC(r9, 0)
+	EC_CM_MAC(r8, 4)
+	EC_CM_MAC(r7, 8)
+	EC_CM_MAC(r6, 12)
+	EC_CM_MAC(r5, 16)
+	EC_CM_MAC(r4, 20)
+	EC_CM_OUT(20)
+	EC_CM_MAC(r10, 0)
+	EC_CM_MAC(r9, 4)
+	EC_CM_MAC(r8, 8)
+	EC_CM_MAC(r7, 12)
+	EC_CM_MAC(r6, 16)
+	EC_CM_MAC(r5, 20)
+	EC_CM_MAC(r4, 24)
+	EC_CM_OUT(24)
+	EC_CM_MAC(r11, 0)
+	EC_CM_MAC(r10, 4)
+	EC_CM_MAC(r9, 8)
+	EC_CM_MAC(r8, 12)
+	EC_CM_MAC(r7, 16)
+	EC_CM_MAC(r6, 20)
+	EC_CM_MAC(r5, 24)
+	EC_CM_MAC(r4, 28)
+	EC_CM_OUT(28)
+	EC_CM_MAC(r12, 0)
+	EC_CM_MAC(r11, 4)
+	EC_CM_MAC(r10, 8)
+	EC_CM_MAC(r9, 12)
+	EC_CM_MAC(r8, 16)
+	EC_CM_MAC(r7, 20)
+	EC_CM_MAC(r6, 24)
+	EC_CM_MAC(r5, 28)
+	EC_CM_MAC(r4, 32)
+	EC_CM_OUT(32)
+	EC_CM_MAC(r12, 4)
+	EC_CM_MAC(r11, 8)
+	EC_CM_MAC(r10, 12)
+	EC_CM_MAC(r9, 16)
+	EC_CM_MAC(r8, 20)
+	EC_CM_MAC(r7, 24)
+	EC_CM_MAC(r6, 28)
+	EC_CM_MAC(r5, 32)
+	EC_CM_OUT(36)
+	EC_CM_MAC(r12, 8)
+	EC_CM_MAC(r11, 12)
+	EC_CM_MAC(r10, 16)
+	EC_CM_MAC(r9, 20)
+	EC_CM_MAC(r8, 24)
+	EC_CM_MAC(r7, 28)
+	EC_CM_MAC(r6, 32)
+	EC_CM_OUT(40)
+	EC_CM_MAC(r12, 12)
+	EC_CM_MAC(r11, 16)
+	EC_CM_MAC(r10, 20)
+	EC_CM_MAC(r9, 24)
+	EC_CM_MAC(r8, 28)
+	EC_CM_MAC(r7, 32)
+	EC_CM_OUT(44)
+	EC_CM_MAC(r12, 16)
+	EC_CM_MAC(r11, 20)
+	EC_CM_MAC(r10, 24)
+	EC_CM_MAC(r9, 28)
+	EC_CM_MAC(r8, 32)
+	EC_CM_OUT(48)
+	EC_CM_MAC(r12, 20)
+	EC_CM_MAC(r11, 24)
+	EC_CM_MAC(r10, 28)
+	EC_CM_MAC(r9, 32)
+	EC_CM_OUT(52)
+	EC_CM_MAC(r12, 24)
+	EC_CM_MAC(r11, 28)
+	EC_CM_MAC(r10, 32)
+	EC_CM_OUT(56)
+	EC_CM_MAC(r12, 28)
+	EC_CM_MAC(r11, 32)
+	EC_CM_OUT(60)
+	EC_CM_MAC(r12, 32)
+	EC_CM_OUT(64)
+	"str    r0, [r3, #68]"
+	:
+	: [d] "m" (d), [a] "m" (a), [b] "m" (b)
+	: EC_CM_CLOBBERS);
+}
+
+/* see inner.h */
+void
+br_ec_cortexm_square9(uint32_t *d, const uint32_t *a)
+{
+	/*
+	 * Cross products a[i]*a[j] (i < j) are computed as
+	 * (2*a[i])*a[j]; 2*a[i] still fits in 32 bits.
+	 */
+	uint32_t a2[8];
+	const uint32_t *b;
+	int i;
+
+	for (i = 0; i < 8; i ++) {
+		a2[i] = a[i] << 1;
+	}
+	b = a2;
+	__asm__ __volatile__ (
+	EC_CM_LOAD
+	EC_CM_SQR(r4)
+	EC_CM_OUT(0)
+	EC_CM_MAC(r5, 0)
+	EC_CM_OUT(4)
+	EC_CM_MAC(r6, 0)
+	EC_CM_SQR(r5)
+	EC_CM_OUT(8)
+	EC_CM_MAC(r7, 0)
+	EC_CM_MAC(r6, 4)
+	EC_CM_OUT(12)
+	EC_CM_MAC(r8, 0)
+	EC_CM_MAC(r7, 4)
+	EC_CM_SQR(r6)
+	EC_CM_OUT(16)
+	EC_CM_MAC(r9, 0)
+	EC_CM_MAC(r8, 4)
+	EC_CM_MAC(r7, 8)
+	EC_CM_OUT(20)
+	EC_CM_MAC(r10, 0)
+	EC_CM_MAC(r9, 4)
+	EC_CM_MAC(r8, 8)
+	EC_CM_SQR(r7)
+	EC_CM_OUT(24)
+	EC_CM_MAC(r11, 0)
+	EC_CM_MAC(r10, 4)
+	EC_CM_MAC(r9, 8)
+	EC_CM_MAC(r8, 12)
+	EC_CM_OUT(28)
+	EC_CM_MAC(r12, 0)
+	EC_CM_MAC(r11, 4)
+	EC_CM_MAC(r10, 8)
+	EC_CM_MAC(r9, 12)
+	EC_CM_SQR(r8)
+	EC_CM_OUT(32)
+	EC_CM_MAC(r12, 4)
+	EC_CM_MAC(r11, 8)
+	EC_CM_MAC(r10, 12)
+	EC_CM_MAC(r9, 16)
+	EC_CM_OUT(36)
+	EC_CM_MAC(r12, 8)
+	EC_CM_MAC(r11, 12)
+	EC_CM_MAC(r10, 16)
+	EC_CM_SQR(r9)
+	EC_CM_OUT(40)
+	EC_CM_MAC(r12, 12)
+	EC_CM_MAC(r11, 16)
+	EC_CM_MAC(r10, 20)
+	EC_CM_OUT(44)
+	EC_CM_MAC(r12, 16)
+	EC_CM_MAC(r11, 20)
+	EC_CM_SQR(r10)
+	EC_CM_OUT(48)
+	EC_CM_MAC(r12, 20)
+	EC_CM_MAC(r11, 24)
+	EC_CM_OUT(52)
+	EC_CM_MAC(r12, 24)
+	EC_CM_SQR(r11)
+	EC_CM_OUT(56)
+	EC_CM_MAC(r12, 28)
+	EC_CM_OUT(60)
+	EC_CM_SQR(r12)
+	EC_CM_OUT(64)
+	"str    r0, [r3, #68]"
+	:
+	: [d] "m" (d), [a] "m" (a), [b] "m" (b)
+	: EC_CM_CLOBBERS);
+}
+
+#undef EC_CM_MAC
+#undef EC_CM_SQR
+#undef EC_CM_OUT
+#undef EC_CM_LOAD
+#undef EC_CM_CLOBBERS
+
+#endif
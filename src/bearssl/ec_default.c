@@ -28,7 +28,9 @@
 const br_ec_impl *
 br_ec_get_default(void)
 {
-#if BR_LOMUL
+#if BR_EC_CORTEXM
+	return &br_ec_all_cortexm;
+#elif BR_LOMUL
 	return &br_ec_all_m15;
 #else
 	return &br_ec_all_m31;
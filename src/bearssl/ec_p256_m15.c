@@ -124,7 +124,7 @@ norm13(uint32_t *d, const uint32_t *w, size_t len)
 
 #if BR_SLOW_MUL15
 
-static void
+BR_FAST_FUNC static void
 mul20(uint32_t *d, const uint32_t *a, const uint32_t *b)
 {
 	/*
@@ -358,7 +358,7 @@ square20(uint32_t *d, const uint32_t *a)
 
 #else
 
-static void
+BR_FAST_FUNC static void
 mul20(uint32_t *d, const uint32_t *a, const uint32_t *b)
 {
 	uint32_t t[39];
@@ -766,7 +766,7 @@ mul20(uint32_t *d, const uint32_t *a, const uint32_t *b)
 	d[39] = norm13(d, t, 39);
 }
 
-static void
+BR_FAST_FUNC static void
 square20(uint32_t *d, const uint32_t *a)
 {
 	uint32_t t[39];
@@ -1058,7 +1058,7 @@ reduce_final_f256(uint32_t *d)
  * On input, upper word may be up to 13 bits (hence value up to 2^260-1);
  * on output, value fits on 257 bits and is lower than twice the modulus.
  */
-static void
+BR_FAST_FUNC static void
 mul_f256(uint32_t *d, const uint32_t *a, const uint32_t *b)
 {
 	uint32_t t[40], cc;
@@ -1148,7 +1148,7 @@ mul_f256(uint32_t *d, const uint32_t *a, const uint32_t *b)
  * bits (hence value up to 2^260-1); on output, value fits on 257 bits
  * and is lower than twice the modulus.
  */
-static void
+BR_FAST_FUNC static void
 square_f256(uint32_t *d, const uint32_t *a)
 {
 	uint32_t t[40], cc;
@@ -1913,11 +1913,585 @@ static const uint32_t Gwin[15][20] = {
 	  0x12CA0E51, 0x05A31D39, 0x171A192E, 0x016B0E4F }
 };
 
+#if BR_EC_P256_GEN_TABLE_SIZE > 1
+
+/*
+ * Comb tables for p256_mulgen(): the window of Gwin[] for each point
+ * 2^(i*256/BR_EC_P256_GEN_TABLE_SIZE)*G, for i = 1 to
+ * BR_EC_P256_GEN_TABLE_SIZE-1 (same encoding as Gwin[]).
+ */
+static const uint32_t Gcomb[BR_EC_P256_GEN_TABLE_SIZE - 1][15][20] = {
+#if BR_EC_P256_GEN_TABLE_SIZE >= 8
+	/* k*2^32*G */
+	{
+		{ 0x02D21943, 0x153C0886, 0x0FDB03A5, 0x06CB1197,
+		  0x10D51919, 0x0C581C76, 0x12B51322, 0x15F10485,
+		  0x1A050F22, 0x00FF18DA, 0x0CE50101, 0x1A2A0B1A,
+		  0x19090D50, 0x10CF0E2B, 0x0BA513D5, 0x0FB909BC,
+		  0x04FA0040, 0x06C4127C, 0x02C105B6, 0x01CD05F5 },
+		{ 0x141318C2, 0x1BA319F1, 0x03E00336, 0x17141839,
+		  0x150E1D10, 0x075B1E96, 0x0A650A34, 0x08680D95,
+		  0x038A0786, 0x00C21DE5, 0x1D5E12CF, 0x07D90CBB,
+		  0x10D309D0, 0x13240C5E, 0x19931969, 0x1130191C,
+		  0x1FF8005C, 0x0F231C0E, 0x1EAD0568, 0x009D13B9 },
+		{ 0x184902A8, 0x0F010477, 0x1C6C176A, 0x1A4A1173,
+		  0x047410E9, 0x045F02E0, 0x09270560, 0x05AE0E02,
+		  0x12021B4E, 0x0096195A, 0x0CD400BB, 0x1B951166,
+		  0x07B414DA, 0x1C570614, 0x16A313B9, 0x0BB11135,
+		  0x08260C25, 0x0F070483, 0x18E812E7, 0x01DC07A8 },
+		{ 0x13EC1344, 0x17270596, 0x1AB51AEA, 0x17400406,
+		  0x0FB9021A, 0x17F21806, 0x1EC3158A, 0x13A30864,
+		  0x066C0972, 0x00A4073C, 0x15B8064A, 0x13E50065,
+		  0x1DD01452, 0x194B0A57, 0x1BD01341, 0x070C0DC6,
+		  0x01FF00ED, 0x1D370B16, 0x06D60BF9, 0x01AC0088 },
+		{ 0x0E831E9E, 0x09F1021A, 0x061B0B50, 0x143E1A98,
+		  0x15041E7C, 0x167B0397, 0x0D951E0F, 0x1C27164F,
+		  0x0B751D65, 0x013A1E25, 0x1EC608EE, 0x1AC216B0,
+		  0x03D90F4D, 0x1B470E53, 0x13A300A2, 0x1A640433,
+		  0x015409C1, 0x15191595, 0x1377148E, 0x01AA0527 },
+		{ 0x19401418, 0x06191CCE, 0x071A1BB4, 0x13760000,
+		  0x13E70501, 0x0C7319C1, 0x0B610613, 0x151B1535,
+		  0x1D6C0863, 0x00F901AC, 0x08BF00EC, 0x1A7D1B4C,
+		  0x030D179D, 0x062F0F02, 0x1C170A7C, 0x11B509CB,
+		  0x115C1776, 0x1FD21531, 0x16670EBE, 0x01B2162E },
+		{ 0x0E24150F, 0x0EA1019F, 0x01031667, 0x15B714E5,
+		  0x12BA01B2, 0x09B618C5, 0x11B4046E, 0x07F5055C,
+		  0x13970135, 0x009512C4, 0x1EC514DF, 0x0DC81118,
+		  0x1562166C, 0x10161619, 0x1EFC1E42, 0x18E318A7,
+		  0x194C0F6C, 0x19B51633, 0x107D1743, 0x00E41B34 },
+		{ 0x19FE0E8C, 0x030908CA, 0x08D310B3, 0x1D82150F,
+		  0x1DEA0BBD, 0x1C841C02, 0x17E41EFC, 0x1A0F0D58,
+		  0x0E09128E, 0x002E1B04, 0x1E4F119F, 0x0D080DA8,
+		  0x0D5816EA, 0x054B0ED4, 0x12E21D84, 0x0FBC0EDF,
+		  0x0C90180B, 0x11461625, 0x0D74134B, 0x01A21FE3 },
+		{ 0x0BF40CBD, 0x18F41EFB, 0x0C0B0F40, 0x115E001F,
+		  0x1153067F, 0x19021192, 0x02291550, 0x02F6108D,
+		  0x15F81A6B, 0x00C80317, 0x162D05DB, 0x05200F2F,
+		  0x0D81006E, 0x163113FE, 0x15D0069F, 0x003D0AE7,
+		  0x14E30EB7, 0x1FA51CAB, 0x07EC029C, 0x01AD0BA2 },
+		{ 0x12BE110D, 0x1C560017, 0x13C4063A, 0x076A1CFF,
+		  0x157A02E9, 0x1E4D0E74, 0x09BC0B7C, 0x090F0C27,
+		  0x0D5E0939, 0x00920D1C, 0x102B0DBE, 0x0B2C00F1,
+		  0x12761832, 0x1D8C08CD, 0x05ED0DD5, 0x150816B3,
+		  0x162A0F99, 0x0FDF1FA5, 0x088B0507, 0x00C1165A },
+		{ 0x14351DDC, 0x14090C1F, 0x11EA1F70, 0x12F21D73,
+		  0x1F8E126B, 0x1BB61AE6, 0x0AB10C90, 0x09660914,
+		  0x058D1428, 0x01170E81, 0x0F1A09C4, 0x078B087A,
+		  0x172F1522, 0x1C9E1065, 0x16350CFD, 0x0D3210DE,
+		  0x0DFC1216, 0x11D71D96, 0x0E041C20, 0x01861026 },
+		{ 0x150401E1, 0x05830065, 0x107715DD, 0x051B05D2,
+		  0x12410C90, 0x142705D7, 0x0E240CF4, 0x1C620BF0,
+		  0x0CE01C09, 0x00E1016D, 0x12CF11EC, 0x15BD0991,
+		  0x11C01914, 0x0C6E1419, 0x12741F13, 0x02B00429,
+		  0x035B1415, 0x1DD90CF3, 0x15120931, 0x00AB0818 },
+		{ 0x12BF1582, 0x01CF0010, 0x112C0D17, 0x1D5B1B0E,
+		  0x00FC1909, 0x18B417F9, 0x134A03F7, 0x06FC0842,
+		  0x1A271ECD, 0x01160295, 0x19B90D4B, 0x0FFD17CD,
+		  0x03B30481, 0x174F0C58, 0x12B61B46, 0x0FC61F51,
+		  0x150A1A13, 0x18E70598, 0x027600D6, 0x013C15E9 },
+		{ 0x09FD13BB, 0x083D1284, 0x0C730D1D, 0x0A060FDD,
+		  0x1E290FBE, 0x17D41DE3, 0x163404AB, 0x13BA0763,
+		  0x0F1F07B7, 0x00A41BF6, 0x185A1E0E, 0x05A313D1,
+		  0x1B0008B7, 0x098D0003, 0x19310264, 0x01810A63,
+		  0x1E721543, 0x07070A83, 0x1EDF0104, 0x01960F67 },
+		{ 0x02F3197E, 0x08931E66, 0x18B403F1, 0x09E518F0,
+		  0x17830E22, 0x1B2C1E29, 0x02B71493, 0x0F121C7E,
+		  0x1CBE0264, 0x001404FF, 0x1CEB066F, 0x0F5707D4,
+		  0x01C90832, 0x014E1603, 0x1F931F6F, 0x1F43170F,
+		  0x1EC018E8, 0x107A1645, 0x1259025C, 0x01D606A5 }
+	},
+#endif
+#if BR_EC_P256_GEN_TABLE_SIZE >= 4
+	/* k*2^64*G */
+	{
+		{ 0x10A61B63, 0x0EB90D23, 0x0FBF090E, 0x15551594,
+		  0x114A093B, 0x04DC0977, 0x092C12E3, 0x15541612,
+		  0x15E10811, 0x001F0A08, 0x1A310EE7, 0x02481517,
+		  0x017A1E41, 0x0A0A03FA, 0x19A511A6, 0x07BE0622,
+		  0x056A0BCB, 0x150115BD, 0x174715DB, 0x017F1D12 },
+		{ 0x02FA17B5, 0x142D0EA8, 0x02C81794, 0x114A1CC9,
+		  0x0A9F1E44, 0x0D2C0200, 0x009E1030, 0x18E81B93,
+		  0x1A3E1F8D, 0x000606A1, 0x001A03FD, 0x0FDC15E7,
+		  0x0F790182, 0x11880AE3, 0x10A111C1, 0x1C701E8C,
+		  0x145506C1, 0x1AB01983, 0x03271DA8, 0x01100E8B },
+		{ 0x0D9E0DEC, 0x188A0FDF, 0x15FA1752, 0x025608A3,
+		  0x06DF0F3A, 0x17D412F2, 0x0B3205E7, 0x05EB1396,
+		  0x03271F91, 0x010B0CB0, 0x101F181F, 0x1A100812,
+		  0x1C7008F4, 0x069C1933, 0x06E4180B, 0x1F981B40,
+		  0x03FD02D2, 0x02A6198F, 0x1C7919D1, 0x01EC12C9 },
+		{ 0x00590322, 0x1C5C1956, 0x1E650015, 0x0C121944,
+		  0x12760CAC, 0x01AB04D2, 0x0B8C175C, 0x07821FE5,
+		  0x015C1B97, 0x014E058F, 0x0CBF1FE9, 0x076408C8,
+		  0x096B1393, 0x1E9C0265, 0x15C201A4, 0x08B41ADE,
+		  0x1C4C1915, 0x03F4158C, 0x13CB1AF3, 0x006102A6 },
+		{ 0x103D1030, 0x14B51921, 0x0B391288, 0x0C7C1613,
+		  0x01261AFF, 0x182D1CA7, 0x08FD1ACE, 0x028C1DE1,
+		  0x1BB60402, 0x002202C0, 0x1B0B1C3A, 0x154204AC,
+		  0x03A41F43, 0x0ADF0CA6, 0x043D1E15, 0x08C311C3,
+		  0x175C09F8, 0x1CCE0D31, 0x1C29118E, 0x010810CA },
+		{ 0x119A0020, 0x17A7045A, 0x17DC19AF, 0x13311BE6,
+		  0x050C0159, 0x02ED042B, 0x15031725, 0x09DD1788,
+		  0x0924075D, 0x00781C51, 0x13801655, 0x0550172E,
+		  0x06160610, 0x15FC1E4E, 0x00A90FCA, 0x1EFE0F63,
+		  0x04F3129F, 0x15EB1122, 0x0B2B171A, 0x00FE0241 },
+		{ 0x0D3B0F08, 0x1BB0071D, 0x16A7054E, 0x0A710EEF,
+		  0x019415F2, 0x16390ABE, 0x1B701242, 0x0E3A1C53,
+		  0x12241F64, 0x00301E13, 0x1C120993, 0x12C0175A,
+		  0x129900B3, 0x14F41828, 0x0FE41D74, 0x18E3199C,
+		  0x1BD40FDA, 0x035C1C5D, 0x0BFA0A1E, 0x011A1DBB },
+		{ 0x02150280, 0x00941A97, 0x138606CB, 0x070516C9,
+		  0x1815050C, 0x1E970647, 0x0D9C123E, 0x104F0604,
+		  0x1C6003AB, 0x00371FEA, 0x0EDC1261, 0x0E840D93,
+		  0x07DB0C9C, 0x13550749, 0x14C10A36, 0x053E06AA,
+		  0x15631585, 0x1A1300CC, 0x11060EB1, 0x005300AD },
+		{ 0x137D0D81, 0x1C67127E, 0x181F0CE8, 0x0E911032,
+		  0x0CE11365, 0x007400DF, 0x1AB61D77, 0x1CD706BB,
+		  0x0F031D05, 0x00B108BE, 0x18841594, 0x00C2178E,
+		  0x05C10540, 0x1A6514C0, 0x0BCC0BB2, 0x02FF09AF,
+		  0x1B410F87, 0x0C1C0306, 0x062D0C55, 0x000D0AD9 },
+		{ 0x1A220C74, 0x179603B4, 0x1BFF1F0E, 0x1AF61657,
+		  0x0CF21CB1, 0x03E515B1, 0x04101924, 0x17850BEE,
+		  0x15D007B6, 0x01B30A08, 0x119C0891, 0x1DA30BF0,
+		  0x053C05F9, 0x1AE50BBE, 0x196B0ABB, 0x1EF61413,
+		  0x1DC3140F, 0x01D90C39, 0x04F60B37, 0x0091191D },
+		{ 0x15A90583, 0x05E207E7, 0x009D0FB2, 0x19D80433,
+		  0x1F540A99, 0x0F1E19DB, 0x17361BB2, 0x17740903,
+		  0x06E60E7E, 0x003D1C08, 0x11F817AE, 0x04F0065E,
+		  0x0A65155B, 0x1F2E004B, 0x03560300, 0x172D054C,
+		  0x1FB600F4, 0x02960025, 0x15921A7A, 0x00B2111D },
+		{ 0x010D09BE, 0x11C012AC, 0x1A5B1E78, 0x13710B01,
+		  0x00C510C5, 0x16510CA3, 0x1B5C0258, 0x0E8F0A75,
+		  0x1E890ADD, 0x00CD0A93, 0x1D0A1A99, 0x0B470B00,
+		  0x1084088B, 0x05A201AA, 0x1CEB0442, 0x0FC3170F,
+		  0x0A7B0C56, 0x08E9132A, 0x13041047, 0x00211197 },
+		{ 0x050C158F, 0x047D107C, 0x13211B5C, 0x048D1ED5,
+		  0x027919B5, 0x157F08CB, 0x0E8A04CF, 0x14420E57,
+		  0x0B1E01D6, 0x009C12A0, 0x031B0F8A, 0x167E1452,
+		  0x1EB30A43, 0x0BF60B10, 0x02000408, 0x05381BEA,
+		  0x1FA503EE, 0x191A040C, 0x02DB19E8, 0x004A1D29 },
+		{ 0x139918BF, 0x1E870CC2, 0x02000EF0, 0x09D417FE,
+		  0x06880A69, 0x16620B32, 0x158D04EB, 0x150809F0,
+		  0x0A5E013E, 0x01C60750, 0x03C71170, 0x18810C3E,
+		  0x0DE00D23, 0x1EBA1C61, 0x01AE0EE4, 0x17E0147F,
+		  0x1AAC1754, 0x13CA0EA1, 0x0053072A, 0x01F10AC8 },
+		{ 0x049A1DB5, 0x0EB50119, 0x0D870E82, 0x04C311AF,
+		  0x11401798, 0x0B281467, 0x193F00ED, 0x0220138C,
+		  0x10B50DD6, 0x01ED059A, 0x08B30838, 0x09061B07,
+		  0x1F8013A3, 0x14681006, 0x116B1453, 0x18781D57,
+		  0x12F70572, 0x03B60B06, 0x183D0903, 0x01740378 }
+	},
+#endif
+#if BR_EC_P256_GEN_TABLE_SIZE >= 8
+	/* k*2^96*G */
+	{
+		{ 0x0891018E, 0x15520E5D, 0x00A01A84, 0x160E1328,
+		  0x174D0521, 0x11451A40, 0x040513A1, 0x0EF4195E,
+		  0x033012A6, 0x009416D4, 0x02791840, 0x15B41E93,
+		  0x16CE10BE, 0x0A830789, 0x03130DB1, 0x02C41F50,
+		  0x13020FBE, 0x113E0710, 0x10E70AC0, 0x01D604D1 },
+		{ 0x1C6A1842, 0x11DB132F, 0x1B3E01B6, 0x09B01156,
+		  0x0ED314BE, 0x1D660DF1, 0x0A391143, 0x1EA80D48,
+		  0x0F660CDA, 0x019903FA, 0x038800C7, 0x1C351252,
+		  0x1BE40567, 0x05A81619, 0x1AEF1159, 0x17231EDD,
+		  0x07630140, 0x1F871DD7, 0x00E619F2, 0x01850974 },
+		{ 0x0C2313FD, 0x1E811894, 0x19C8152E, 0x0D781A5C,
+		  0x1DDD1902, 0x0E510A78, 0x14950B99, 0x11740214,
+		  0x11911331, 0x00201901, 0x02E71805, 0x0C2C0B9E,
+		  0x081C1AFA, 0x01A11087, 0x067D1E19, 0x0B0B020F,
+		  0x13C109E6, 0x145B0323, 0x14111B8B, 0x01381A0C },
+		{ 0x01BE1A54, 0x07130F83, 0x026F023F, 0x0D971046,
+		  0x0B8D10B9, 0x0FD01898, 0x035A10F3, 0x1B191A00,
+		  0x09C80823, 0x00231220, 0x07711DF5, 0x18CA0502,
+		  0x156F1567, 0x04270134, 0x059F032B, 0x15EC06B9,
+		  0x1557113C, 0x17B40E90, 0x128B0726, 0x01051D72 },
+		{ 0x09F910F3, 0x0FDD1219, 0x1C6E1356, 0x1A5D1688,
+		  0x095A023E, 0x08100FC8, 0x0D2010D5, 0x04F71D7B,
+		  0x0C7F105F, 0x0071122B, 0x1F49017B, 0x01CE127A,
+		  0x0F9B1A06, 0x13050567, 0x1B2C03FA, 0x1B7A1907,
+		  0x084B054D, 0x16221BCE, 0x0BC316DC, 0x01071098 },
+		{ 0x0B8206CC, 0x0CDC0D3F, 0x06BB162B, 0x16DC0CB6,
+		  0x09400398, 0x061E1794, 0x12E812E9, 0x10ED108E,
+		  0x0092105A, 0x007E1E27, 0x03411E4D, 0x0F0A1964,
+		  0x1FEB0148, 0x1091182C, 0x131900DE, 0x0C9C11E8,
+		  0x04BA0DD9, 0x14DC1593, 0x0D9D0291, 0x01A1167C },
+		{ 0x17781584, 0x1CD2046D, 0x065F1543, 0x14711E48,
+		  0x13BD09A2, 0x1A6A0610, 0x0C7D1E3F, 0x17610561,
+		  0x05E70860, 0x00DF12E3, 0x098810F2, 0x13EF1087,
+		  0x01921C3C, 0x1AD20A29, 0x0ACC12F6, 0x18601167,
+		  0x0604023A, 0x03AE1B55, 0x01EC0B72, 0x01511C6A },
+		{ 0x0B4C0F73, 0x192B087F, 0x0C750355, 0x14E50972,
+		  0x0E5A0CB3, 0x1917035C, 0x171B1E7F, 0x04D0019D,
+		  0x17D212A3, 0x01381E93, 0x10671142, 0x08870F44,
+		  0x0F3E0122, 0x1ABD0A1E, 0x1CA5107C, 0x015B19A6,
+		  0x02120C1D, 0x018F0C5B, 0x18D51215, 0x01451129 },
+		{ 0x111215EF, 0x0A261011, 0x03C60E8F, 0x068C1D90,
+		  0x1286171D, 0x1C8B0C3B, 0x08AE090D, 0x1C5715CD,
+		  0x05C91F76, 0x00F00474, 0x1F19052E, 0x17DF06C6,
+		  0x1BB40A58, 0x0A270B50, 0x17A81ED0, 0x0370144C,
+		  0x00170940, 0x158F0953, 0x11B80BB5, 0x01330EDD },
+		{ 0x08BD1889, 0x0CAF02CD, 0x191D01BF, 0x1E151EE4,
+		  0x1DCC18A3, 0x099607B3, 0x0C6B0C6E, 0x09AF14DE,
+		  0x15FD1EC9, 0x01751D4C, 0x0FEE0A6C, 0x13FC19D2,
+		  0x19C71FA1, 0x1047189C, 0x0FF711D3, 0x0E4304E7,
+		  0x1A8C183B, 0x045A03C6, 0x15220E4A, 0x01CF0F30 },
+		{ 0x09E90EA7, 0x02211C4D, 0x0328093E, 0x04740FEA,
+		  0x14F70D08, 0x1F021BCA, 0x1DB909D5, 0x0A191831,
+		  0x0CA20A8B, 0x0186160F, 0x1B331BBD, 0x107D0782,
+		  0x0E2112B1, 0x14CA057C, 0x0EB60925, 0x113F1333,
+		  0x123107EF, 0x1D211D65, 0x16041391, 0x00A7059E },
+		{ 0x10190C75, 0x01661A9E, 0x18EA1FDF, 0x104D0E75,
+		  0x0D2716C1, 0x0CF50438, 0x174317E4, 0x11AC00D1,
+		  0x13EC17EF, 0x00050028, 0x160712B1, 0x008712DD,
+		  0x1EB316C3, 0x11231CC3, 0x0EE31171, 0x1AF309AB,
+		  0x1A8C193E, 0x0D271104, 0x08E81507, 0x011908D6 },
+		{ 0x01711099, 0x1BE11814, 0x00B218ED, 0x14CC0A10,
+		  0x0A9F1213, 0x16F51403, 0x1078018B, 0x1CA007CE,
+		  0x19411CDE, 0x01AB0473, 0x0AD605AF, 0x184E1951,
+		  0x17EB033B, 0x1F110C45, 0x12E712EF, 0x0A171160,
+		  0x089910D3, 0x1CDC1139, 0x0E7E0478, 0x010F1AF9 },
+		{ 0x025405E9, 0x0AC50F62, 0x1DD41C03, 0x01EC0B8B,
+		  0x0EE31598, 0x02BB0935, 0x0C000F83, 0x0B78020A,
+		  0x0917083C, 0x010C064A, 0x1CA0138B, 0x004D09B3,
+		  0x018F134B, 0x0EE304F9, 0x03970B22, 0x14590F5A,
+		  0x02710C1F, 0x0A5B1E7E, 0x10720B1B, 0x013411A2 },
+		{ 0x154A00A5, 0x0CAC118C, 0x135812B2, 0x16B41053,
+		  0x0A52035E, 0x09F31A1C, 0x09201E1A, 0x06B81300,
+		  0x0B090F32, 0x01410A83, 0x1CA80422, 0x110509A2,
+		  0x1FC9193F, 0x1BB41F46, 0x1363091C, 0x003007CF,
+		  0x19A60F9A, 0x0C850066, 0x15D316F7, 0x00440D03 }
+	},
+#endif
+#if BR_EC_P256_GEN_TABLE_SIZE >= 2
+	/* k*2^128*G */
+	{
+		{ 0x1C4D1D85, 0x109F1275, 0x1561157C, 0x0FB80A5F,
+		  0x17E115FF, 0x118C1D9B, 0x0C171D58, 0x0BCC1FEE,
+		  0x1CDF0EDB, 0x00881F5C, 0x17121B32, 0x1C67125C,
+		  0x128000C7, 0x12B41FEB, 0x19E9149B, 0x14950BFD,
+		  0x174E1953, 0x063D1B84, 0x0D5C0341, 0x005A1209 },
+		{ 0x135B065E, 0x08420846, 0x001D0EB0, 0x13D41FDA,
+		  0x1C010F77, 0x18100130, 0x080F12A3, 0x143A111D,
+		  0x0CDA0945, 0x014418E4, 0x05E61CFB, 0x0808000C,
+		  0x17F109EE, 0x1BE91003, 0x0D611F83, 0x0C1A1831,
+		  0x0E9E09DE, 0x041F10BA, 0x05E90AED, 0x010E0C80 },
+		{ 0x15361B68, 0x033303B7, 0x1961073E, 0x0AC10098,
+		  0x16EF1AD8, 0x0BBD1D3D, 0x18A61F96, 0x002F1D62,
+		  0x19F003CA, 0x01F10D94, 0x13B00DA9, 0x1A4B0C2B,
+		  0x1076169B, 0x1BB31172, 0x135D1D70, 0x01540FB1,
+		  0x02361DA5, 0x0A9018BC, 0x17AF0C44, 0x018603D3 },
+		{ 0x0BB81F0C, 0x03A70B13, 0x17540F6F, 0x1CC70F82,
+		  0x05650D16, 0x0F2A11FC, 0x131D0DD5, 0x032C0463,
+		  0x190F057E, 0x00510435, 0x0C480D78, 0x0E511B2D,
+		  0x003410A5, 0x1EEF1BD5, 0x03EE00E7, 0x02CE14BB,
+		  0x1BF01D14, 0x00650ABD, 0x00AC1DDC, 0x00D30D6E },
+		{ 0x09270753, 0x0BA91AFE, 0x193E066D, 0x00E513E1,
+		  0x0AF80173, 0x13DB1EDD, 0x07781872, 0x108F1152,
+		  0x0E9A1582, 0x01E614A2, 0x189D020C, 0x0B6B10BA,
+		  0x07820AA4, 0x0AE504B4, 0x062B02FC, 0x0A1C06F6,
+		  0x0F840A1B, 0x027F0E4F, 0x00F605EC, 0x00EB105E },
+		{ 0x1381013A, 0x0D260349, 0x0ED20F8B, 0x1E551DEA,
+		  0x1CA30D1B, 0x12A00CF2, 0x18611C05, 0x1C900150,
+		  0x07D70C5B, 0x012507D7, 0x0A430F14, 0x00B31173,
+		  0x00B80A53, 0x0C9E1FC8, 0x08D91839, 0x03C70411,
+		  0x16320BB5, 0x04181B16, 0x14910933, 0x0053134D },
+		{ 0x00C0017E, 0x0B9619CC, 0x11EB1239, 0x1FFA1B7C,
+		  0x0D78141F, 0x0CE61380, 0x1A0C05FB, 0x02E21920,
+		  0x1BA61A44, 0x019F141A, 0x106F1F50, 0x1CF71933,
+		  0x0BBB1A0A, 0x0F0D0DDE, 0x00011030, 0x0FB41E54,
+		  0x01D91958, 0x15220E04, 0x1D4D172B, 0x016C11ED },
+		{ 0x03F41E44, 0x10451BEB, 0x0BC014F5, 0x0BCE0768,
+		  0x0EA703FF, 0x067B18C1, 0x14830280, 0x138D1E05,
+		  0x033E1D4D, 0x00F702E2, 0x066812C3, 0x0E040AAA,
+		  0x11B21076, 0x0DB70F5C, 0x0B20057E, 0x1BAB0B6D,
+		  0x030313C7, 0x10161089, 0x19F21116, 0x01171189 },
+		{ 0x096D1860, 0x1032015E, 0x123D104C, 0x11060A68,
+		  0x0C080892, 0x1E2B16FA, 0x096B0D08, 0x1B9A0454,
+		  0x1A620AD5, 0x000E1579, 0x06841849, 0x0C0116E8,
+		  0x1BBD07D6, 0x0C991F09, 0x15941374, 0x070216F0,
+		  0x04D90D82, 0x13C91749, 0x1D3A13AD, 0x01FC05AB },
+		{ 0x01791082, 0x04FC0833, 0x175C1C63, 0x0B1B145E,
+		  0x1AC21E6C, 0x0F371FDA, 0x1FC8038D, 0x0FB719EE,
+		  0x0F2D05E9, 0x01040F23, 0x0C5E176C, 0x16850A65,
+		  0x0B260AC1, 0x0EEB0916, 0x0E6F1006, 0x177F1A21,
+		  0x16E7097A, 0x06D9145F, 0x109501E9, 0x00C31EE9 },
+		{ 0x11351A6B, 0x1ED2157A, 0x09611A9E, 0x14921B68,
+		  0x16E90CA2, 0x1D610EF7, 0x108600D7, 0x192D05A2,
+		  0x02660372, 0x01111EEA, 0x024B12F8, 0x028F0079,
+		  0x1EE70804, 0x051C0033, 0x0A420A9E, 0x0A281E23,
+		  0x136D045B, 0x17C11F49, 0x1B241D39, 0x00A20ABB },
+		{ 0x07C310D2, 0x0287107C, 0x0AAC0EEE, 0x04931934,
+		  0x0E7C0A00, 0x0B351348, 0x1D7508E7, 0x1DBD040B,
+		  0x1E551E40, 0x000B1C30, 0x130708CC, 0x06F9055B,
+		  0x0FC505F5, 0x0E6F0BAD, 0x1E171725, 0x15630B08,
+		  0x13D21998, 0x058A1AF3, 0x0C9A0F6D, 0x00690D57 },
+		{ 0x03900CAB, 0x091410A5, 0x18BF039C, 0x1A821CE6,
+		  0x00D01EA5, 0x0AB81BCB, 0x087B0E75, 0x0B7D0E39,
+		  0x065F0C05, 0x01C3082B, 0x058C05C9, 0x08A71D5D,
+		  0x12A70A6D, 0x0E3A0200, 0x18420A2A, 0x0FDD0F2F,
+		  0x1B7C0307, 0x190A1060, 0x07DB1E98, 0x01C01E5A },
+		{ 0x0FB510BA, 0x06AF1EF0, 0x1AA613A5, 0x17431C48,
+		  0x040801DE, 0x17DF001C, 0x0B2D191A, 0x003B007F,
+		  0x12540278, 0x0124047A, 0x15C70349, 0x082B1E68,
+		  0x1DD90D91, 0x16F51CA2, 0x02770478, 0x11331351,
+		  0x05D31E95, 0x05560F1D, 0x04970215, 0x01CF1A46 },
+		{ 0x0136042A, 0x051F17FB, 0x0DDB02A8, 0x0FC81AC4,
+		  0x01241BFB, 0x03CF19A8, 0x0D9A1893, 0x078F1943,
+		  0x1C3706A7, 0x00151A4E, 0x0FC008CA, 0x0C6610EE,
+		  0x0DB20910, 0x1DDE16AB, 0x193C0A39, 0x03C402CD,
+		  0x01711EDC, 0x0FC20EA5, 0x16E81478, 0x00E00A3D }
+	},
+#endif
+#if BR_EC_P256_GEN_TABLE_SIZE >= 8
+	/* k*2^160*G */
+	{
+		{ 0x1FC10F2A, 0x138E177D, 0x1A1D0AEE, 0x10E90BF7,
+		  0x14F20C35, 0x0E6E04C9, 0x11161F43, 0x06C21FD5,
+		  0x1AB30EC7, 0x011414D7, 0x118414B7, 0x13410B08,
+		  0x1B341C5F, 0x10C91231, 0x1E6F0533, 0x10B504AF,
+		  0x10140190, 0x117A1CDF, 0x042308B0, 0x00081570 },
+		{ 0x0E6B1F36, 0x00871100, 0x0A4D1E8B, 0x1E321064,
+		  0x1ABC19C8, 0x117B1E85, 0x17160604, 0x09B0134D,
+		  0x0BD40881, 0x009D0BE8, 0x19681C43, 0x118C1282,
+		  0x01E90C77, 0x11951515, 0x1A8116A5, 0x0FDF111E,
+		  0x02A91152, 0x04031FB9, 0x06C211EC, 0x01481E5D },
+		{ 0x19A40FA0, 0x09E405EA, 0x00EE1FB1, 0x0B201455,
+		  0x07071E24, 0x18490D2F, 0x11111236, 0x1105170A,
+		  0x09EE1DEB, 0x010D1AB2, 0x0D281CEE, 0x07010553,
+		  0x174504EE, 0x0C6A073F, 0x0B6106D9, 0x1ADE119C,
+		  0x01B719E8, 0x09B11569, 0x029E0BBC, 0x012903CE },
+		{ 0x0B1014FB, 0x033A152E, 0x03B21CC3, 0x0F511FAF,
+		  0x0B8E1C98, 0x1BE31162, 0x14F2096C, 0x1B641736,
+		  0x1E220FBF, 0x018C048B, 0x1D6F1FF7, 0x057B03ED,
+		  0x0FC50370, 0x1183189C, 0x184506E4, 0x10EF1E47,
+		  0x18E41868, 0x15880640, 0x1F640343, 0x01D40816 },
+		{ 0x09110C03, 0x083F1F26, 0x108117AF, 0x0FD01F97,
+		  0x1CA40CE7, 0x10B31D01, 0x0F3E1784, 0x075518FD,
+		  0x15D719FB, 0x01171C27, 0x13951B54, 0x0BEE10BA,
+		  0x10EA0A14, 0x1C3B1883, 0x04E41EC0, 0x0FCB0E8C,
+		  0x04581DBE, 0x0F4E0CED, 0x157F02E2, 0x00A1072E },
+		{ 0x090A1BFD, 0x0D2E1EA3, 0x115B1168, 0x04CF1C51,
+		  0x045F0074, 0x05AC1749, 0x1B1100EA, 0x0C531A16,
+		  0x15F01F52, 0x011613F3, 0x1AF6026B, 0x15E00291,
+		  0x16EB006E, 0x1A131486, 0x1FCE1502, 0x1524153F,
+		  0x17D81CAD, 0x02AF1BE5, 0x1D4D0822, 0x003E0CC1 },
+		{ 0x0D741300, 0x07451074, 0x01400B45, 0x008E1712,
+		  0x1AF01C47, 0x05E61CD6, 0x09851ADA, 0x01F81864,
+		  0x0E5D17E7, 0x01D0178B, 0x0A37025E, 0x01BF1745,
+		  0x18DD172A, 0x10BB1E30, 0x1EF517E1, 0x047809C1,
+		  0x1D3D15B8, 0x1C171F1E, 0x1D36151C, 0x008A06AB },
+		{ 0x14EB0B84, 0x17D31B43, 0x1CC31E97, 0x1BBD1A1A,
+		  0x137A0FFF, 0x060307F6, 0x1A0202C1, 0x04261C92,
+		  0x01160181, 0x016D1650, 0x053E0B21, 0x195403EF,
+		  0x1C150E1B, 0x1D5D113C, 0x1E111273, 0x09AE1EB4,
+		  0x1A231888, 0x10E40E18, 0x1A0B0292, 0x01271FCF },
+		{ 0x09300CB8, 0x0BAA1581, 0x0A971252, 0x10191AC8,
+		  0x141B0F4A, 0x174F16FD, 0x18131DA1, 0x05F00A8F,
+		  0x079108C9, 0x007E17EC, 0x02960964, 0x16961106,
+		  0x0199072F, 0x0A3F117B, 0x17D11E87, 0x0CCF00FC,
+		  0x1C6F0153, 0x13301C38, 0x06D61A49, 0x018A160D },
+		{ 0x11DD010E, 0x03F81C0C, 0x1C350EC1, 0x1B4F1130,
+		  0x1706154A, 0x1AFC159F, 0x17FE06AA, 0x1EB81364,
+		  0x1E39081C, 0x018814EF, 0x1770110A, 0x04C708E5,
+		  0x0DD10F2C, 0x07D70E7A, 0x133D0DB7, 0x1FCE1DB2,
+		  0x1A9205C3, 0x0C6B14B7, 0x020C0B36, 0x01CD1E89 },
+		{ 0x10E6160F, 0x088810B6, 0x097504AA, 0x153910C2,
+		  0x1CFC1698, 0x09B4000A, 0x1768074B, 0x1332195E,
+		  0x1115118D, 0x00661A15, 0x1EAB1D67, 0x0E6E1943,
+		  0x1C5904BF, 0x09971142, 0x1AFF0F5A, 0x1D4F0BC5,
+		  0x02C6000D, 0x0F9B06EA, 0x04F71124, 0x01A80BD4 },
+		{ 0x01F20011, 0x0DCC03B1, 0x174E16B9, 0x12BB16EC,
+		  0x032B1FE9, 0x078F15CC, 0x117B19DF, 0x05D31618,
+		  0x13BF1460, 0x00980C0B, 0x02EA1B0B, 0x04210D97,
+		  0x1F3B0991, 0x0853068F, 0x0C1A09CD, 0x0ED7055E,
+		  0x1A8017A5, 0x0528030C, 0x123B08D6, 0x00EE1AF0 },
+		{ 0x1ABB0342, 0x076D1AED, 0x11150F05, 0x10670664,
+		  0x0AD90C88, 0x0C121E76, 0x087C1D89, 0x001003DF,
+		  0x1AE008F0, 0x009004FA, 0x19BB0316, 0x02AB1AE5,
+		  0x0827164C, 0x0FAA01AA, 0x16510DC6, 0x1C661492,
+		  0x100B0848, 0x084803D9, 0x1EA1033A, 0x0000010F },
+		{ 0x1827088C, 0x0BC804E8, 0x046307B6, 0x02370DFE,
+		  0x018B13B8, 0x1C570E42, 0x0A66046F, 0x166310DD,
+		  0x1D3618FC, 0x010E0495, 0x0BB103C5, 0x1170167E,
+		  0x03B6031B, 0x1AF610F0, 0x1E770324, 0x19701949,
+		  0x0B661F59, 0x1FE508A1, 0x1A4019BA, 0x00211238 },
+		{ 0x1B4D12BE, 0x0E2E077F, 0x08E009F6, 0x09DB1044,
+		  0x15D201F7, 0x1C701B95, 0x19161BBA, 0x132F0BC4,
+		  0x0FCD05AE, 0x010110FC, 0x081612F5, 0x09721F10,
+		  0x145F1890, 0x166B12DE, 0x1F8A0B74, 0x163A16A6,
+		  0x00710765, 0x1BD014A6, 0x0A050009, 0x001504C8 }
+	},
+#endif
+#if BR_EC_P256_GEN_TABLE_SIZE >= 4
+	/* k*2^192*G */
+	{
+		{ 0x09B908BE, 0x041F1ECC, 0x1CA506CF, 0x12340F1A,
+		  0x0CB20395, 0x086217F1, 0x1B7F1834, 0x124E189C,
+		  0x13BD0784, 0x014D14E5, 0x1ABF15F4, 0x15700CF0,
+		  0x02CD1F2B, 0x01840A10, 0x1C120A92, 0x1A4F1B37,
+		  0x1C5D0BD2, 0x1102199A, 0x03A41B0B, 0x00CE13E1 },
+		{ 0x0BA51B08, 0x07290316, 0x0E921158, 0x19551BAB,
+		  0x13AF13B0, 0x1A540421, 0x130E0AA2, 0x1D011529,
+		  0x06960E62, 0x007E01B7, 0x08411C99, 0x0ABB0A65,
+		  0x1A9F0896, 0x120B1A23, 0x14181606, 0x063B06CB,
+		  0x0C031BE9, 0x045B0E61, 0x0A860E19, 0x00110F09 },
+		{ 0x18AE1864, 0x096A1A73, 0x069E0C05, 0x18D40732,
+		  0x092006FD, 0x1C4D13CD, 0x04760E7B, 0x1B6116BF,
+		  0x16BE05DE, 0x000F1BD9, 0x004807FE, 0x04A809DD,
+		  0x05451546, 0x07631339, 0x14FA070E, 0x03FA1417,
+		  0x0A060522, 0x1CD4141B, 0x12ED189D, 0x005B0CCC },
+		{ 0x0E3E027C, 0x003703F5, 0x1CA601C1, 0x17290F71,
+		  0x1F591228, 0x04FD05ED, 0x002D1315, 0x03A01783,
+		  0x194C118A, 0x01D8187F, 0x0EEF1E51, 0x002219F6,
+		  0x119E1ADF, 0x188E1A40, 0x07F11C46, 0x0EEB04A6,
+		  0x0B07182C, 0x0AF40742, 0x09EE01B2, 0x00051E87 },
+		{ 0x1E3E005E, 0x0A280F05, 0x00B50C69, 0x12A51395,
+		  0x1D9403CB, 0x0BE50302, 0x19D312F7, 0x188C0053,
+		  0x12FE006D, 0x010517D3, 0x07FF126B, 0x027A00B6,
+		  0x19800B96, 0x08D010B6, 0x0E7815D9, 0x042F12F4,
+		  0x090B0211, 0x0841089D, 0x064C0C96, 0x01C91862 },
+		{ 0x0BEE105C, 0x1C851887, 0x070D0C23, 0x1A9806C0,
+		  0x0E2A0F84, 0x0FA205B4, 0x11FD120E, 0x02EC05A6,
+		  0x1E6F1F79, 0x00B70C62, 0x1CB50309, 0x0A931CB2,
+		  0x120B056C, 0x10F4134A, 0x0CA81875, 0x0FEB0085,
+		  0x0DB61D5D, 0x090E13E0, 0x10B90DEA, 0x00850B64 },
+		{ 0x001B08B0, 0x1C3A1055, 0x0A4E180A, 0x05F11FBA,
+		  0x109904C2, 0x11C81E98, 0x0F2D18D3, 0x018D09F6,
+		  0x04DE012B, 0x004C07BF, 0x0F58011F, 0x1A4A166F,
+		  0x0E98013A, 0x1C3C0E6D, 0x0BF1140B, 0x0C9F1FDE,
+		  0x044212CD, 0x1F9D07F7, 0x16DF0386, 0x0115074A },
+		{ 0x03710050, 0x12660B79, 0x15F80C40, 0x072003D6,
+		  0x17AD0C2A, 0x02CF05F8, 0x16330983, 0x068F1D35,
+		  0x1DFF071E, 0x01341E6F, 0x131210D2, 0x1E8F0064,
+		  0x0F1817A3, 0x19961B7F, 0x0E5414FA, 0x04491BEA,
+		  0x1B381F3B, 0x1C4002DB, 0x0F361316, 0x01D302D3 },
+		{ 0x0F5C0034, 0x067D0545, 0x05250F10, 0x0BEA1BA3,
+		  0x0F980B33, 0x13CE1A4B, 0x153F059D, 0x04F20526,
+		  0x1EBB1A2C, 0x00DA1237, 0x15860E30, 0x06101E96,
+		  0x04B01E87, 0x1D4508FA, 0x18400210, 0x1C0A11D8,
+		  0x0F3C1649, 0x1A251CF5, 0x1228165D, 0x00790D1C },
+		{ 0x02CC0089, 0x1DF011F5, 0x1B0B0856, 0x06F50A34,
+		  0x10740677, 0x1BEB096E, 0x1792172B, 0x0F191D54,
+		  0x1E080B98, 0x003E0FE9, 0x012E1989, 0x166F1166,
+		  0x12800ED4, 0x1D101B96, 0x10EF01B2, 0x0D9A0747,
+		  0x05721B3F, 0x13CA171F, 0x0ECE1B7B, 0x00F809F0 },
+		{ 0x002915C8, 0x087B1F15, 0x189F0B51, 0x0C611236,
+		  0x1B2F10A5, 0x1F8A139B, 0x08911FB4, 0x11240E92,
+		  0x00F31BB9, 0x01270970, 0x0ACD1844, 0x0AE8020F,
+		  0x16FF1C49, 0x00920D6F, 0x0B350162, 0x1C2B0970,
+		  0x15420358, 0x185E1305, 0x14820980, 0x005A1103 },
+		{ 0x05FE00D8, 0x1CCE1C05, 0x0007050A, 0x10D21E92,
+		  0x038F02C8, 0x06E71500, 0x125A0298, 0x1764074A,
+		  0x03381B7E, 0x01F70466, 0x14021701, 0x04A11CDA,
+		  0x025A1775, 0x0C1A1709, 0x003F0907, 0x1C3D074A,
+		  0x0F27090F, 0x06C50C10, 0x09CD05FF, 0x002F1F1A },
+		{ 0x110207BA, 0x034A19A7, 0x1B290A26, 0x132D0EC3,
+		  0x0F2A0704, 0x0FAC1C0C, 0x0ED00E01, 0x0E570ECD,
+		  0x09481612, 0x007F0C2E, 0x0D920158, 0x1D9A13B7,
+		  0x04E9157F, 0x1CEE05C0, 0x0362020A, 0x12CC1B72,
+		  0x193101C9, 0x1BF21329, 0x17340217, 0x013A119E },
+		{ 0x0AE91AC8, 0x0EE4156C, 0x02770A9B, 0x1B3B0651,
+		  0x1C381E4E, 0x1D910B5F, 0x036D1122, 0x1653115A,
+		  0x13181BFD, 0x0191005F, 0x15CD0312, 0x1892188C,
+		  0x01AC0BF2, 0x1FD21B76, 0x07A8107B, 0x0B0D05F1,
+		  0x09E11421, 0x19FA130A, 0x00161749, 0x01A215F3 },
+		{ 0x16FB11C1, 0x1B7B0EB8, 0x191D000B, 0x17D51EED,
+		  0x00E11186, 0x1C67190E, 0x1B1D1A9D, 0x107A1741,
+		  0x01CF008E, 0x01B50C25, 0x061D01E3, 0x06901049,
+		  0x071D1B87, 0x019412D1, 0x0B741633, 0x01A402CF,
+		  0x0D7406F2, 0x039D1CE1, 0x00F2144E, 0x00EC0F2F }
+	},
+#endif
+#if BR_EC_P256_GEN_TABLE_SIZE >= 8
+	/* k*2^224*G */
+	{
+		{ 0x04AE1F07, 0x007E043A, 0x15EC06A7, 0x1F40061D,
+		  0x17EB15F3, 0x19C103FF, 0x0D830E70, 0x1BFD1BAD,
+		  0x02A10783, 0x00D11DAE, 0x03890655, 0x0EDF029E,
+		  0x1FBF190C, 0x1A5E0C42, 0x067A1293, 0x1B48140A,
+		  0x040204DF, 0x019C1BEF, 0x15D412E4, 0x0197187F },
+		{ 0x060A1FC7, 0x00A60760, 0x092C09D1, 0x1E2E0BA6,
+		  0x0B330623, 0x1CAB1950, 0x07841CD0, 0x01AB1FCF,
+		  0x02A40C1C, 0x01C30D03, 0x118C0024, 0x15081A0A,
+		  0x1B12017C, 0x041B1A6E, 0x18041245, 0x0FE81C23,
+		  0x1EC01120, 0x09FF07D1, 0x15611F38, 0x003D0A2A },
+		{ 0x15441692, 0x11F408CE, 0x11840E41, 0x1ADF0530,
+		  0x13891B08, 0x083109DD, 0x0B730412, 0x11E917A6,
+		  0x138C0166, 0x007717F2, 0x12880308, 0x17B610C6,
+		  0x1789193D, 0x0C68178B, 0x1E3E1C0C, 0x1DB414CC,
+		  0x0130151A, 0x0CF70125, 0x1B421651, 0x00141C87 },
+		{ 0x18F51A7E, 0x16B21FA0, 0x0F2B0A25, 0x04AE0262,
+		  0x178F049C, 0x18E508DF, 0x00DD1A7B, 0x005B1D08,
+		  0x0AED1A2A, 0x012C0F8C, 0x13E319C0, 0x14960CA3,
+		  0x189E03DF, 0x1CB80357, 0x0C341D0A, 0x042C1F84,
+		  0x11E517C5, 0x0726168A, 0x109E084A, 0x00B800AE },
+		{ 0x1BF501D7, 0x164610B0, 0x17261079, 0x0B1F026A,
+		  0x1D911936, 0x031B0793, 0x19421525, 0x020A18D4,
+		  0x04AD1752, 0x01590A2B, 0x1D4B13A2, 0x1F620126,
+		  0x1AF41DDE, 0x1B8804E4, 0x0F0F0DBF, 0x050E0862,
+		  0x182604B9, 0x19840250, 0x0B3E1D75, 0x00FE04B1 },
+		{ 0x0C691763, 0x0B1504FB, 0x0EA2002D, 0x08360F49,
+		  0x10B11C1B, 0x19041487, 0x04101207, 0x08340A30,
+		  0x10B21D59, 0x00F3130C, 0x02FB0BFC, 0x15611C2F,
+		  0x1135136A, 0x0EB0074D, 0x156D0BC1, 0x085F1F0F,
+		  0x060E1599, 0x0A7A009F, 0x1F400730, 0x01391E24 },
+		{ 0x19221B7F, 0x04F00734, 0x1FDF15DB, 0x12D20165,
+		  0x0D1B1D66, 0x11B014C4, 0x16101AF9, 0x0F811881,
+		  0x18261B66, 0x01F50411, 0x0EFB0BEF, 0x067B1C53,
+		  0x0EA31EF8, 0x1A4C093C, 0x0E5C1EEC, 0x01E31062,
+		  0x17D11ED4, 0x06D410B5, 0x01B314A8, 0x00340723 },
+		{ 0x042B00A9, 0x1174084D, 0x10BE06C3, 0x1FAC09BC,
+		  0x059F0960, 0x0C811688, 0x11B41478, 0x08720DEF,
+		  0x0C800599, 0x00DF08B6, 0x17290757, 0x01261DEE,
+		  0x02F70B96, 0x15781547, 0x17F119CD, 0x0D30170E,
+		  0x0A51152A, 0x18FD00DD, 0x061C115A, 0x013D0E83 },
+		{ 0x1F84153A, 0x1EF11F5D, 0x01CD0B61, 0x107F1C55,
+		  0x00C20914, 0x05F504AA, 0x195C0E1D, 0x0FB11359,
+		  0x155C11F5, 0x003A10C6, 0x0B471260, 0x0B3A1DA7,
+		  0x1F3E017C, 0x152101C1, 0x07A40E29, 0x1C2B1EB8,
+		  0x0986083C, 0x02431AF1, 0x1E1D1F19, 0x00111599 },
+		{ 0x01C9079A, 0x1B5300D8, 0x1A540590, 0x10F604F6,
+		  0x1F3704C0, 0x01AA1D65, 0x1A920720, 0x13910209,
+		  0x153F1C57, 0x016F0F7E, 0x10A90AE1, 0x1A150AD0,
+		  0x1E181DBB, 0x0D3102EB, 0x153F06E3, 0x1C8B017D,
+		  0x091E0461, 0x1ABA052F, 0x0FBE076F, 0x003A0BEA },
+		{ 0x09131C70, 0x022E04D9, 0x153805A3, 0x16660E8F,
+		  0x1F990BEA, 0x1C631183, 0x125915B2, 0x02261F76,
+		  0x106A1A3E, 0x00DB1BBA, 0x1B4D19B7, 0x1B470040,
+		  0x01ED1AD6, 0x03CA1A42, 0x01431AEC, 0x1ED51321,
+		  0x0A651AFE, 0x07C80000, 0x187E0744, 0x01970E4F },
+		{ 0x18A013A4, 0x0C120EB8, 0x1466169B, 0x19CD0247,
+		  0x183F0015, 0x0D17092D, 0x0BAF171B, 0x14A2022F,
+		  0x03D212E6, 0x012A013A, 0x1A8E038A, 0x12F51E77,
+		  0x0CE115A2, 0x0E1A1C37, 0x11301F84, 0x078F1C61,
+		  0x1E2215D6, 0x0F971D9A, 0x0C7F0304, 0x016C01C7 },
+		{ 0x010D154D, 0x1FAB1A21, 0x05271FB5, 0x10741559,
+		  0x12BC1B2B, 0x03F50772, 0x164E12BB, 0x0F1B0352,
+		  0x00830355, 0x005004D7, 0x172E1868, 0x19E106E3,
+		  0x086C0ADC, 0x1992078C, 0x0F780494, 0x00FF0305,
+		  0x1D4E1741, 0x17C2141B, 0x15F11851, 0x013D1612 },
+		{ 0x0320184E, 0x171809D8, 0x0BAC05F4, 0x13F30E06,
+		  0x039D039F, 0x1D801E52, 0x14D21793, 0x033E0128,
+		  0x19D508BF, 0x01961EE5, 0x1ADF1117, 0x14D50A5C,
+		  0x13200A21, 0x04780961, 0x10AC19EC, 0x150F0182,
+		  0x1D2800FD, 0x12481757, 0x1C8916DD, 0x006906BB },
+		{ 0x07250C10, 0x1CAB047A, 0x054D0917, 0x02551389,
+		  0x03CC16A8, 0x13FF0D5A, 0x01E605A0, 0x00EF0F5B,
+		  0x0BB100B1, 0x00670681, 0x089812A0, 0x1B501913,
+		  0x03370F76, 0x111E1073, 0x128119E7, 0x159E154F,
+		  0x02A61F78, 0x128F1D0E, 0x1DF61D6A, 0x01950617 }
+	},
+#endif
+
+};
+
+#endif
+
 /*
- * Lookup one of the Gwin[] values, by index. This is constant-time.
+ * Lookup one of the values of a window (Gwin[] or one of the Gcomb[]
+ * tables), by index. This is constant-time.
  */
 static void
-lookup_Gwin(p256_jacobian *T, uint32_t idx)
+lookup_Gwin(p256_jacobian *T, const uint32_t (*win)[20], uint32_t idx)
 {
 	uint32_t xy[20];
 	uint32_t k;
@@ -1929,7 +2503,7 @@ lookup_Gwin(p256_jacobian *T, uint32_t idx)
 
 		m = -EQ(idx, k + 1);
 		for (u = 0; u < 20; u ++) {
-			xy[u] |= m & Gwin[k][u];
+			xy[u] |= m & win[k][u];
 		}
 	}
 	for (u = 0; u < 10; u ++) {
@@ -1946,6 +2520,71 @@ lookup_Gwin(p256_jacobian *T, uint32_t idx)
  * Multiply the generator by an integer. The integer is assumed non-zero
  * and lower than the curve order.
  */
+#if BR_EC_P256_GEN_TABLE_SIZE > 1
+
+static void
+p256_mulgen(p256_jacobian *P, const unsigned char *x, size_t xlen)
+{
+	/*
+	 * Comb method: the 256-bit multiplier is split into
+	 * BR_EC_P256_GEN_TABLE_SIZE chunks of n bits, chunk i being
+	 * applied to 2^(i*n)*G with the corresponding window table.
+	 * Each step doubles Q four times, then adds the points for
+	 * the next 4 bits of every chunk; this needs only n doublings
+	 * instead of 256.
+	 *
+	 * The added point is never equal to Q or -Q, since their
+	 * multipliers are made of disjoint bits of a value lower than
+	 * the curve order. qz and the table lookups are as in the
+	 * single window code.
+	 */
+	unsigned char k[32];
+	p256_jacobian Q;
+	uint32_t qz;
+	int n, j;
+
+	/*
+	 * Extra leading bytes can only be zero.
+	 */
+	if (xlen > sizeof k) {
+		x += xlen - sizeof k;
+		xlen = sizeof k;
+	}
+	memset(k, 0, sizeof k - xlen);
+	memcpy(k + sizeof k - xlen, x, xlen);
+
+	n = 256 / BR_EC_P256_GEN_TABLE_SIZE;
+	memset(&Q, 0, sizeof Q);
+	qz = 1;
+	for (j = n - 4; j >= 0; j -= 4) {
+		int i;
+
+		p256_double(&Q);
+		p256_double(&Q);
+		p256_double(&Q);
+		p256_double(&Q);
+		for (i = 0; i < BR_EC_P256_GEN_TABLE_SIZE; i ++) {
+			uint32_t bits;
+			uint32_t bnz;
+			int e;
+			p256_jacobian T, U;
+
+			e = i * n + j;
+			bits = (k[31 - (e >> 3)] >> (e & 7)) & 0x0F;
+			bnz = NEQ(bits, 0);
+			lookup_Gwin(&T, i == 0 ? Gwin : Gcomb[i - 1], bits);
+			U = Q;
+			p256_add_mixed(&U, &T);
+			CCOPY(bnz & qz, &Q, &T, sizeof Q);
+			CCOPY(bnz & ~qz, &Q, &U, sizeof Q);
+			qz &= ~bnz;
+		}
+	}
+	*P = Q;
+}
+
+#else
+
 static void
 p256_mulgen(p256_jacobian *P, const unsigned char *x, size_t xlen)
 {
@@ -1978,7 +2617,7 @@ p256_mulgen(p256_jacobian *P, const unsigned char *x, size_t xlen)
 			p256_double(&Q);
 			bits = (bx >> 4) & 0x0F;
 			bnz = NEQ(bits, 0);
-			lookup_Gwin(&T, bits);
+			lookup_Gwin(&T, Gwin, bits);
 			U = Q;
 			p256_add_mixed(&U, &T);
 			CCOPY(bnz & qz, &Q, &T, sizeof Q);
@@ -1990,6 +2629,8 @@ p256_mulgen(p256_jacobian *P, const unsigned char *x, size_t xlen)
 	*P = Q;
 }
 
+#endif
+
 static const unsigned char P256_G[] = {
 	0x04, 0x6B, 0x17, 0xD1, 0xF2, 0xE1, 0x2C, 0x42, 0x47, 0xF8,
 	0xBC, 0xE6, 0xE5, 0x63, 0xA4, 0x40, 0xF2, 0x77, 0x03, 0x7D,
@@ -2128,3 +2769,117 @@ const br_ec_impl br_ec_p256_m15 = {
 	&api_mulgen,
 	&api_muladd
 };
+
+#ifdef ARDUINO
+/*
+ * Multiply a point, given by its window table (same format as Gwin[]),
+ * by an integer. The integer is assumed non-zero and lower than the
+ * curve order. This is the single window code of p256_mulgen().
+ */
+static void
+p256_mul_window(p256_jacobian *P, const uint32_t (*win)[20],
+	const unsigned char *x, size_t xlen)
+{
+	p256_jacobian Q;
+	uint32_t qz;
+
+	memset(&Q, 0, sizeof Q);
+	qz = 1;
+	while (xlen -- > 0) {
+		int k;
+		unsigned bx;
+
+		bx = *x ++;
+		for (k = 0; k < 2; k ++) {
+			uint32_t bits;
+			uint32_t bnz;
+			p256_jacobian T, U;
+
+			p256_double(&Q);
+			p256_double(&Q);
+			p256_double(&Q);
+			p256_double(&Q);
+			bits = (bx >> 4) & 0x0F;
+			bnz = NEQ(bits, 0);
+			lookup_Gwin(&T, win, bits);
+			U = Q;
+			p256_add_mixed(&U, &T);
+			CCOPY(bnz & qz, &Q, &T, sizeof Q);
+			CCOPY(bnz & ~qz, &Q, &U, sizeof Q);
+			qz &= ~bnz;
+			bx <<= 4;
+		}
+	}
+	*P = Q;
+}
+
+static uint32_t
+api_muladd_precomp(unsigned char *A, const uint32_t *table,
+	const unsigned char *x, size_t xlen,
+	const unsigned char *y, size_t ylen)
+{
+	p256_jacobian P, Q;
+	uint32_t t, z;
+	int i;
+
+	p256_mul_window(&P, (const uint32_t (*)[20])table, x, xlen);
+	p256_mulgen(&Q, y, ylen);
+
+	/*
+	 * Final addition, as in api_muladd().
+	 */
+	t = p256_add(&P, &Q);
+	reduce_final_f256(P.z);
+	z = 0;
+	for (i = 0; i < 20; i ++) {
+		z |= P.z[i];
+	}
+	z = EQ(z, 0);
+	p256_double(&Q);
+	CCOPY(z & ~t, &P, &Q, sizeof Q);
+	p256_to_affine(&P);
+	p256_encode(A, &P);
+	return ~(z & t) & 1;
+}
+
+/* see bearssl_ec.h */
+uint32_t
+br_ec_p256_m15_precomp(br_ec_p256_precomp_key *pk,
+	uint32_t *table, const void *Q, size_t Qlen)
+{
+	p256_jacobian P, T, U;
+	int k;
+
+	if (!p256_decode(&P, Q, Qlen)) {
+		return 0;
+	}
+
+	/*
+	 * Compute k*Q for k = 1 to 15, and store them in affine
+	 * coordinates, with two 13-bit limbs per word as in Gwin[].
+	 * This is done once per key, so the inversions are not batched.
+	 */
+	T = P;
+	for (k = 1; k <= 15; k ++) {
+		uint32_t *w;
+		int u;
+
+		if (k == 2) {
+			T = P;
+			p256_double(&T);
+		} else if (k > 2) {
+			p256_add(&T, &P);
+		}
+		U = T;
+		p256_to_affine(&U);
+		w = table + (k - 1) * 20;
+		for (u = 0; u < 10; u ++) {
+			w[u] = U.x[(u << 1) + 0] | (U.x[(u << 1) + 1] << 16);
+			w[u + 10] = U.y[(u << 1) + 0] | (U.y[(u << 1) + 1] << 16);
+		}
+	}
+	pk->muladd = &api_muladd_precomp;
+	pk->table = table;
+	return 1;
+}
+#endif
@@ -102,12 +102,22 @@ le30_to_be8(unsigned char *dst, size_t len, const uint32_t *src)
 	}
 }
 
+#if BR_EC_CORTEXM
+
+/*
+ * Assembly versions for Cortex-M4/M7, see ec_cortexm.c.
+ */
+#define mul9      br_ec_cortexm_mul9
+#define square9   br_ec_cortexm_square9
+
+#else
+
 /*
  * Multiply two integers. Source integers are represented as arrays of
  * nine 30-bit words, for values up to 2^270-1. Result is encoded over
  * 18 words of 30 bits each.
  */
-static void
+BR_FAST_FUNC static void
 mul9(uint32_t *d, const uint32_t *a, const uint32_t *b)
 {
 	/*
@@ -225,7 +235,7 @@ mul9(uint32_t *d, const uint32_t *a, const uint32_t *b)
  * Square a 270-bit integer, represented as an array of nine 30-bit words.
  * Result uses 18 words of 30 bits each.
  */
-static void
+BR_FAST_FUNC static void
 square9(uint32_t *d, const uint32_t *a)
 {
 	uint64_t t[17];
@@ -291,6 +301,8 @@ square9(uint32_t *d, const uint32_t *a)
 	}
 	d[17] = (uint32_t)cc;
 }
+#endif
+
 
 /*
  * Base field modulus for P-256.
@@ -388,7 +400,7 @@ sub_f256(uint32_t *d, const uint32_t *a, const uint32_t *b)
  * Compute a multiplication in F256. Source operands shall be less than
  * twice the modulus.
  */
-static void
+BR_FAST_FUNC static void
 mul_f256(uint32_t *d, const uint32_t *a, const uint32_t *b)
 {
 	uint32_t t[18];
@@ -500,7 +512,7 @@ mul_f256(uint32_t *d, const uint32_t *a, const uint32_t *b)
  * Compute a square in F256. Source operand shall be less than
  * twice the modulus.
  */
-static void
+BR_FAST_FUNC static void
 square_f256(uint32_t *d, const uint32_t *a)
 {
 	uint32_t t[18];
@@ -1262,11 +1274,585 @@ static const uint32_t Gwin[15][18] = {
 	  0x0FB8D64B, 0x0000B5B9 }
 };
 
+#if BR_EC_P256_GEN_TABLE_SIZE > 1
+
+/*
+ * Comb tables for p256_mulgen(): the window of Gwin[] for each point
+ * 2^(i*256/BR_EC_P256_GEN_TABLE_SIZE)*G, for i = 1 to
+ * BR_EC_P256_GEN_TABLE_SIZE-1 (same encoding as Gwin[]).
+ */
+static const uint32_t Gcomb[BR_EC_P256_GEN_TABLE_SIZE - 1][15][18] = {
+#if BR_EC_P256_GEN_TABLE_SIZE >= 8
+	/* k*2^32*G */
+	{
+		{ 0x185A5943, 0x296A7888, 0x065DFB63, 0x2E464D97,
+		  0x2C71DA1A, 0x15ACC898, 0x2AF89216, 0x1AD02BC8,
+		  0x00007FE3, 0x299CA101, 0x143454B1, 0x38AF212D,
+		  0x2CF5619E, 0x1CA6F174, 0x27D0101F, 0x236249F0,
+		  0x3516096D, 0x0000E697 },
+		{ 0x068278C2, 0x0DB7479F, 0x20E47C03, 0x37442E29,
+		  0x2DFA5AA1, 0x132A8D0E, 0x24343655, 0x251C51E1,
+		  0x00006177, 0x2FABD2CF, 0x340FB2CB, 0x317A1A69,
+		  0x1E5A6648, 0x18647332, 0x3FC01722, 0x0791F03B,
+		  0x39F5695A, 0x00004ECE },
+		{ 0x1F0922A8, 0x1A9E0247, 0x05CF8D97, 0x243A7495,
+		  0x2F8B808E, 0x09395808, 0x22D73809, 0x1A9016D3,
+		  0x00004B65, 0x199A80BB, 0x36B72B16, 0x1850F694,
+		  0x1CEE78AE, 0x18C4D6D4, 0x01330957, 0x3783920D,
+		  0x28C744B9, 0x0000EE1E },
+		{ 0x1A7D9344, 0x3AAE4E59, 0x101B56BA, 0x0886AE80,
+		  0x396019F7, 0x361D62AF, 0x29D1A193, 0x3C33625C,
+		  0x0000521C, 0x16B7064A, 0x14A7CA06, 0x295FBA14,
+		  0x04D07296, 0x06371B7A, 0x0FF83B4E, 0x1E9BAC58,
+		  0x0836B2FE, 0x0000D602 },
+		{ 0x29D07E9E, 0x1413E221, 0x2A60C36B, 0x279F287D,
+		  0x3D8E5EA0, 0x2CAF83EC, 0x1E13D93D, 0x255BAF59,
+		  0x00009D78, 0x03D8C8EE, 0x1375856B, 0x394C7B2F,
+		  0x1828B68E, 0x3210CE74, 0x0AA27074, 0x2A8CD654,
+		  0x279BBD23, 0x0000D514 },
+		{ 0x3B281418, 0x2D0C33CC, 0x0000E35B, 0x394066EC,
+		  0x39E7067C, 0x1B0984D8, 0x3A8DD4D5, 0x2CEB6218,
+		  0x00007C86, 0x3117E0EC, 0x2774FBB4, 0x3C0861B7,
+		  0x3A9F0C5E, 0x1AA72F82, 0x0AE5DDA3, 0x2FE954C6,
+		  0x2EB33BAF, 0x0000D958 },
+		{ 0x3DC4950F, 0x19DD4219, 0x13942076, 0x106CAB6F,
+		  0x1B631657, 0x0DA11B93, 0x13FA9572, 0x049CB84D,
+		  0x00004ACB, 0x23D8B4DF, 0x1B1B9111, 0x1866AC56,
+		  0x2790A02D, 0x31E29FDF, 0x0A63DB31, 0x3CDAD8CF,
+		  0x3483EDD0, 0x0000726C },
+		{ 0x2B3FCE8C, 0x2CC6128C, 0x143D1A70, 0x12EF7B05,
+		  0x02700BBD, 0x3F27BF39, 0x2D07B562, 0x04704CA3,
+		  0x0000176C, 0x23C9F19F, 0x3A9A10DA, 0x3B51AB16,
+		  0x17610A96, 0x1E3B7E5C, 0x248602DF, 0x38A35895,
+		  0x236BA4D2, 0x0000D17F },
+		{ 0x2D7E8CBD, 0x1031E9EF, 0x007D816F, 0x199FE2BC,
+		  0x01464A2A, 0x114D5432, 0x317B4234, 0x17AFC69A,
+		  0x0000640C, 0x3EC5A5DB, 0x1B8A40F2, 0x0FF9B020,
+		  0x01A7EC63, 0x1EAB9EBA, 0x271BADC0, 0x0FD2F2AE,
+		  0x223F60A7, 0x0000D6AE },
+		{ 0x1E57D10D, 0x0EB8AC01, 0x33FE7886, 0x10BA4ED5,
+		  0x26B9D2AF, 0x0DE2DF3C, 0x1487B09D, 0x1C6AF24E,
+		  0x00004934, 0x06056DBE, 0x0C96580F, 0x23364ED8,
+		  0x2B757B18, 0x045ACCBD, 0x3153E66A, 0x37EFFE96,
+		  0x1A445941, 0x000060D9 },
+		{ 0x3E86BDDC, 0x1C2812C1, 0x35CE3D5F, 0x349AE5E5,
+		  0x1B6B9BF1, 0x158B2437, 0x04B32451, 0x012C6D0A,
+		  0x00008BBA, 0x29E349C4, 0x088F1687, 0x0196E5F5,
+		  0x2B3F793D, 0x19437AC6, 0x2FE4859A, 0x08EBF659,
+		  0x26702708, 0x0000C340 },
+		{ 0x16A081E1, 0x374B0606, 0x174A0EF5, 0x0B240A36,
+		  0x13975E48, 0x31233D28, 0x1E312FC1, 0x2D670702,
+		  0x00007085, 0x0659F1EC, 0x052B7A99, 0x10663819,
+		  0x27C4D8DD, 0x1810A64E, 0x1ADD0545, 0x1EECB3CC,
+		  0x18A8924C, 0x000055A0 },
+		{ 0x0257F582, 0x05C39E01, 0x2C3A258D, 0x26427AB7,
+		  0x1A5FE41F, 0x1A50FDF1, 0x137E210A, 0x15D13FB3,
+		  0x00008B0A, 0x37372D4B, 0x205FFB7C, 0x31607664,
+		  0x36D1AE9E, 0x237D4656, 0x285684DF, 0x2C739662,
+		  0x2913B035, 0x00009E57 },
+		{ 0x113FB3BB, 0x07507B28, 0x3F758E6D, 0x0BEF940C,
+		  0x2A778FC5, 0x31A12AEF, 0x39DD1D8E, 0x3678F9ED,
+		  0x0000526F, 0x070B5E0E, 0x2DCB473D, 0x000F6008,
+		  0x0899131A, 0x00A98F26, 0x339550C3, 0x0383AA0F,
+		  0x27F6F841, 0x0000CB3D },
+		{ 0x185E797E, 0x3C5127E6, 0x23C31683, 0x1B8893CB,
+		  0x1678A6F0, 0x15BD24F6, 0x078971F8, 0x3FE5F099,
+		  0x00000A13, 0x139D666F, 0x0C9EAE7D, 0x180C3928,
+		  0x1FDBC29D, 0x21DC3FF2, 0x36063A3E, 0x083D5917,
+		  0x2592C897, 0x0000EB1A }
+	},
+#endif
+#if BR_EC_P256_GEN_TABLE_SIZE >= 4
+	/* k*2^64*G */
+	{
+		{ 0x0E14DB63, 0x039D72D2, 0x1651F7E9, 0x124EEAAB,
+		  0x2E25DE29, 0x0964B8C9, 0x1AAA5849, 0x08AF0A04,
+		  0x00000FA8, 0x1F462EE7, 0x10449151, 0x0FE82F5E,
+		  0x2C699414, 0x1F188B34, 0x2B52F2CF, 0x3A80D6F4,
+		  0x12BA3D76, 0x0000BFF4 },
+		{ 0x205F57B5, 0x25285AEA, 0x33245917, 0x3F912295,
+		  0x16080153, 0x04F40C1A, 0x1C746E4C, 0x21D1F7E3,
+		  0x0000031A, 0x1C0343FD, 0x209FB95E, 0x2B8DEF21,
+		  0x0C706310, 0x387A3214, 0x22A9B078, 0x0D58660E,
+		  0x0B193F6A, 0x0000883A },
+		{ 0x3DB3CDEC, 0x14B114FD, 0x228EBF57, 0x3BCE84AC,
+		  0x2A4BC8DB, 0x199179EF, 0x12F5CE59, 0x30193FE4,
+		  0x000085B2, 0x0A03F81F, 0x3D342081, 0x24CF8E08,
+		  0x2602CD39, 0x0C6D00DC, 0x1FE8B4BF, 0x1153663C,
+		  0x09E3CE74, 0x0000F64B },
+		{ 0x180B2322, 0x0578B995, 0x2513CCA0, 0x332B1825,
+		  0x15934A4E, 0x1C65D703, 0x33C17F95, 0x0F0AE6E5,
+		  0x0000A716, 0x2197FFE9, 0x24CEC88C, 0x09952D73,
+		  0x10693D38, 0x1A6B7AB8, 0x22664551, 0x31FA5633,
+		  0x269E5EBC, 0x0000308A },
+		{ 0x0607B030, 0x22296B92, 0x184D6732, 0x36BFD8F9,
+		  0x16F29C24, 0x07EEB3B0, 0x21467785, 0x00DDB100,
+		  0x0000110B, 0x33617C3A, 0x10EA844A, 0x3298749F,
+		  0x2F8555BE, 0x21C70C87, 0x3AE27E11, 0x2E6734C6,
+		  0x0AE14C63, 0x00008443 },
+		{ 0x2A334020, 0x2BEF4E45, 0x2F9AFB99, 0x20566663,
+		  0x3690ACA1, 0x281DC945, 0x14EEDE22, 0x114921D7,
+		  0x00003C71, 0x3A701655, 0x040AA172, 0x3938C2C6,
+		  0x0BF2ABF9, 0x3F3D8C15, 0x279CA7FD, 0x2AF5C488,
+		  0x01595DC6, 0x00007F09 },
+		{ 0x35A76F08, 0x13B76071, 0x3BBED4E5, 0x257C94E2,
+		  0x1CAAF832, 0x1B8490AC, 0x071D714F, 0x139127D9,
+		  0x00001878, 0x2B824993, 0x2CE58175, 0x20A25320,
+		  0x275D29E9, 0x31E671FC, 0x1EA3F6B1, 0x21AE7177,
+		  0x3B5FD287, 0x00008D76 },
+		{ 0x1C42A280, 0x32C129A9, 0x1B2670C6, 0x29430E0B,
+		  0x0B991F02, 0x2CE48FBD, 0x38279811, 0x2AE300EA,
+		  0x00001BFF, 0x0DDB9261, 0x271D08D9, 0x1D24FB6C,
+		  0x0A8DA6AA, 0x1F1AAA98, 0x2B1D614A, 0x1D098332,
+		  0x2D8833AC, 0x00002982 },
+		{ 0x3A6FAD81, 0x3A38CF27, 0x00CB03EC, 0x0CD95D23,
+		  0x3A037D9C, 0x15B75DC0, 0x1E6B9AEF, 0x3E781F41,
+		  0x000058A2, 0x3B109594, 0x10018578, 0x1300B825,
+		  0x22ECB4CB, 0x3FA6BD79, 0x1A0BE1C5, 0x160E0C1B,
+		  0x19316B15, 0x000006AB },
+		{ 0x13444C74, 0x03AF2C3B, 0x195F7FFF, 0x172C75ED,
+		  0x32D6C59E, 0x20864907, 0x2BC2AFB8, 0x08AE81ED,
+		  0x0000D9A8, 0x02338891, 0x3E7B46BF, 0x2EF8A785,
+		  0x1AAEF5CA, 0x3B504F2D, 0x2E1D03FD, 0x30ECB0E7,
+		  0x1D27B2CD, 0x000048E4 },
+		{ 0x1EB52583, 0x2C8BC47E, 0x10CC13AF, 0x22A673B0,
+		  0x0F676FEA, 0x39B6EC9E, 0x2BBA240E, 0x0837339F,
+		  0x00001EF0, 0x3A3F17AE, 0x16C9E065, 0x012D4CB5,
+		  0x30C03E5C, 0x1695306A, 0x3DB03D2E, 0x214B0097,
+		  0x1DAC969E, 0x00005944 },
+		{ 0x3021A9BE, 0x1E23812A, 0x2C074B7E, 0x2C3166E2,
+		  0x28B28C18, 0x1AE0962C, 0x1747A9D7, 0x13F44AB7,
+		  0x000066AA, 0x03A15A99, 0x22D68EB0, 0x06AA1088,
+		  0x19108B44, 0x21DC3F9D, 0x13DB159F, 0x3474CCA9,
+		  0x17982411, 0x000010C6 },
+		{ 0x30A1958F, 0x1708FB07, 0x3B56643B, 0x0E6D491B,
+		  0x3FA32C4F, 0x345133EA, 0x2A21395D, 0x2058F075,
+		  0x00004E4A, 0x08636F8A, 0x10ECFD45, 0x2C43D66A,
+		  0x010217EC, 0x1C6FA840, 0x3D28FB8A, 0x0C8D1033,
+		  0x2916DE7A, 0x00002574 },
+		{ 0x0A7338BF, 0x3C3D0ECC, 0x1FF8400E, 0x029A53A9,
+		  0x312CC8D1, 0x2C693AEC, 0x2A8427C2, 0x1052F04F,
+		  0x0000E31D, 0x3878F170, 0x08F102C3, 0x3185BC0D,
+		  0x33B93D75, 0x3051FC35, 0x1565D52F, 0x29E53A87,
+		  0x080299CA, 0x0000F8AB },
+		{ 0x24935DB5, 0x209D6A11, 0x06BDB0EE, 0x05E60987,
+		  0x14519E28, 0x09F83B56, 0x21104E33, 0x1A85AB75,
+		  0x0000F696, 0x1D166838, 0x28D20DB0, 0x001BF013,
+		  0x1D14E8D1, 0x3C755E2D, 0x17B95CB0, 0x31DB2C1A,
+		  0x38C1EA40, 0x0000BA0D }
+	},
+#endif
+#if BR_EC_P256_GEN_TABLE_SIZE >= 8
+	/* k*2^96*G */
+	{
+		{ 0x3512218E, 0x212AA4E5, 0x0CA0141A, 0x29486C1D,
+		  0x22E902E9, 0x202CE862, 0x277A6578, 0x141984A9,
+		  0x00004A5B, 0x0C4F3840, 0x2FAB69E9, 0x1E26D9D0,
+		  0x1B6C5506, 0x227D4062, 0x1813EF85, 0x089F1C42,
+		  0x11873AB0, 0x0000EB13 },
+		{ 0x3F8D5842, 0x2DA3B732, 0x055B67C1, 0x1D2F9361,
+		  0x3337C5DA, 0x11CC50FA, 0x2F543521, 0x3A7B3336,
+		  0x0000CC8F, 0x087100C7, 0x19F86B25, 0x18677C85,
+		  0x3C564B51, 0x11FB775D, 0x3B18502E, 0x2FC3F75C,
+		  0x3407367C, 0x0000C2A5 },
+		{ 0x118473FD, 0x0BBD0389, 0x29733915, 0x2E409AF1,
+		  0x28A9E3BB, 0x24AAE65C, 0x18BA0852, 0x018C8CCC,
+		  0x00001064, 0x385CF805, 0x3E9858B9, 0x021D039A,
+		  0x2F864343, 0x05883CCF, 0x1E0A7996, 0x3A2D8C8E,
+		  0x0CA08EE2, 0x00009C68 },
+		{ 0x0C37DA54, 0x0FCE26F8, 0x01184DE2, 0x2C2E5B2F,
+		  0x28626171, 0x1AD43CDF, 0x3D8CE800, 0x204E4208,
+		  0x000011C8, 0x08EE3DF5, 0x19F19450, 0x04D2ADF5,
+		  0x38CAC84E, 0x361AE4B3, 0x2ABC4F2B, 0x2BDA3A42,
+		  0x329459C9, 0x000082F5 },
+		{ 0x253F30F3, 0x159FBB21, 0x1A238DD3, 0x108FB4BB,
+		  0x083F212B, 0x29043550, 0x327BF5ED, 0x2B63FC17,
+		  0x000038C8, 0x2BE9217B, 0x01839D27, 0x159DF37A,
+		  0x20FEA60A, 0x3D641F65, 0x02595376, 0x0B116F39,
+		  0x185E1DB7, 0x000083C2 },
+		{ 0x3D7046CC, 0x0AD9B8D3, 0x32D8D776, 0x00E62DB8,
+		  0x0F5E5128, 0x1744BA4C, 0x2876C23A, 0x27049416,
+		  0x00003F78, 0x10683E4D, 0x121E1596, 0x20B3FD61,
+		  0x0837A123, 0x0E47A263, 0x25D37659, 0x1A6E564C,
+		  0x3C6CE8A4, 0x0000D0D9 },
+		{ 0x36EF1584, 0x10F9A446, 0x3920CBF5, 0x2A68A8E3,
+		  0x35184277, 0x23EF8FF4, 0x0BB09585, 0x232F3A18,
+		  0x00006FCB, 0x1D3110F2, 0x0F27DF08, 0x28A4325C,
+		  0x24BDB5A4, 0x30459D59, 0x30208EB0, 0x21D76D54,
+		  0x2A0F62DC, 0x0000A8F1 },
+		{ 0x3D698F73, 0x15725687, 0x25C98EA3, 0x132CE9CA,
+		  0x0B8D71CB, 0x38DF9FF2, 0x32680676, 0x13BE94A8,
+		  0x00009C7A, 0x120CF142, 0x08910EF4, 0x2879E7C1,
+		  0x2C1F357A, 0x2DE69B94, 0x10930742, 0x10C7B16C,
+		  0x29C6AC85, 0x0000A2C4 },
+		{ 0x062255EF, 0x23D44D01, 0x364078CE, 0x35C74D19,
+		  0x05B0EE50, 0x05724379, 0x2E2BD735, 0x342E4FDD,
+		  0x00007811, 0x1BE3252E, 0x162FBE6C, 0x2D43768A,
+		  0x07B4144E, 0x385132F5, 0x00BA5006, 0x1AC7A54C,
+		  0x1D8DC2ED, 0x000099BB },
+		{ 0x3517B889, 0x2FD95E2C, 0x3B9323A1, 0x2628FC2B,
+		  0x0B1ECFB9, 0x235B1B93, 0x14D7D379, 0x0CAFEFB2,
+		  0x0000BAF5, 0x09FDCA6C, 0x2867F99D, 0x227338FF,
+		  0x3C74E08F, 0x21939DFE, 0x14660EDC, 0x222D0F1B,
+		  0x30A91392, 0x0000E7BC },
+		{ 0x353D2EA7, 0x0F8443C4, 0x3FA86509, 0x3B4208E8,
+		  0x016F2A9E, 0x2DCA757E, 0x350CE0C7, 0x0F6512A2,
+		  0x0000C358, 0x0B667BBD, 0x2C60FA78, 0x15F1C432,
+		  0x32496994, 0x1FCCCDD6, 0x1189FBE2, 0x1E90F596,
+		  0x1EB024E4, 0x00005396 },
+		{ 0x3A032C75, 0x37C2CDA9, 0x39D71D5F, 0x3DB0609A,
+		  0x3A90E1A4, 0x3A1DF919, 0x38D60346, 0x289F65FB,
+		  0x00000280, 0x36C0F2B1, 0x30C10F2D, 0x330FD676,
+		  0x1C5C6247, 0x39A6ADDC, 0x14664FB5, 0x3693C413,
+		  0x16474541, 0x00008CA3 },
+		{ 0x102E3099, 0x3B77C381, 0x28401658, 0x3C84E998,
+		  0x3AD00D53, 0x03C062ED, 0x2E501F3A, 0x33CA0F37,
+		  0x0000D591, 0x055AC5AF, 0x0EF09D95, 0x3116FD63,
+		  0x3CBBFE22, 0x0BC5825C, 0x04CC34D4, 0x0E6E44E5,
+		  0x3973F11E, 0x000087EB },
+		{ 0x084A85E9, 0x00D58AF6, 0x2E2FBA9C, 0x1D6603D8,
+		  0x1DA4D5DC, 0x2003E0C5, 0x05BC0829, 0x0A48BA0F,
+		  0x00008619, 0x0F94138B, 0x12C09A9B, 0x13E431F3,
+		  0x3AC89DC6, 0x2CBD6872, 0x138B07E8, 0x352DF9F8,
+		  0x228392C6, 0x00009A46 },
+		{ 0x32A940A5, 0x2C995918, 0x014E6B12, 0x10D7AD69,
+		  0x39E8714A, 0x09078693, 0x235C4C01, 0x03584BCC,
+		  0x0000A0AA, 0x0B950422, 0x0FE20A9A, 0x3D1BF939,
+		  0x1A473769, 0x181F3E6C, 0x0D33E680, 0x3642819B,
+		  0x03AE9DBD, 0x00002234 }
+	},
+#endif
+#if BR_EC_P256_GEN_TABLE_SIZE >= 2
+	/* k*2^128*G */
+	{
+		{ 0x1789BD85, 0x1F213F27, 0x297EAC35, 0x0D7FDF70,
+		  0x06766EFC, 0x20BF5623, 0x35E67FB9, 0x1CE6FBB6,
+		  0x0000447D, 0x32E25B32, 0x31F8CF25, 0x3FAE5000,
+		  0x0D26E569, 0x0AAFF73D, 0x3A7654E9, 0x131EEE12,
+		  0x096AE0D0, 0x00002D48 },
+		{ 0x1A6B665E, 0x2C108484, 0x3F6803AE, 0x0BDDE7A9,
+		  0x0804C380, 0x007CA8F0, 0x1A1D4475, 0x2466D251,
+		  0x0000A263, 0x30BCDCFB, 0x3B901000, 0x000EFE29,
+		  0x0FE0F7D3, 0x0D60C5AC, 0x34F27798, 0x120FC2E9,
+		  0x002F4ABB, 0x00008732 },
+		{ 0x1EA6DB68, 0x0F86663B, 0x02632C27, 0x3EB61582,
+		  0x1EF4F6DD, 0x0537E597, 0x2017F58B, 0x14CF80F2,
+		  0x0000F8B6, 0x2E760DA9, 0x26F496C2, 0x05CA0ED6,
+		  0x2F5C3767, 0x2A3EC66B, 0x11B76942, 0x054862F0,
+		  0x13BD7B11, 0x0000C30F },
+		{ 0x0D771F0C, 0x1BC74EB1, 0x3E0AEA8F, 0x2B45B98E,
+		  0x1547F0AC, 0x18EB755E, 0x2196118E, 0x35C8795F,
+		  0x00002890, 0x35890D78, 0x295CA3B2, 0x2F540690,
+		  0x3039FDDF, 0x2752EC7D, 0x1F874505, 0x0032AAF7,
+		  0x2E056777, 0x000069B5 },
+		{ 0x3924E753, 0x1B5753AF, 0x0F8727C6, 0x005CC1CB,
+		  0x2DFB755F, 0x3BC61CA7, 0x2847C548, 0x2274D560,
+		  0x0000F352, 0x2B13A20C, 0x2916D70B, 0x12D0F04A,
+		  0x18BF15CA, 0x0E1BD8C5, 0x3C2286D4, 0x013FB93D,
+		  0x1E07B17B, 0x000075C1 },
+		{ 0x2670213A, 0x22DA4C34, 0x37A9DA4F, 0x1B46FCAB,
+		  0x1033CB94, 0x030F0165, 0x3E480543, 0x173EBB16,
+		  0x0000929F, 0x0D486F14, 0x14C16717, 0x3F20170A,
+		  0x0E0E593D, 0x2390451B, 0x3192ED47, 0x320C6C5A,
+		  0x0DA48A4C, 0x000029CD },
+		{ 0x3018017E, 0x0E572D9C, 0x2DF23D72, 0x0507FFF5,
+		  0x334E01AF, 0x10617ED9, 0x01716483, 0x1ADD3691,
+		  0x0000CFD0, 0x0E0DFF50, 0x02B9EF93, 0x3779777A,
+		  0x0C0C1E1A, 0x1A795000, 0x0ECE561F, 0x3A913810,
+		  0x2DEA6DCA, 0x0000B647 },
+		{ 0x2C7E9E44, 0x3D608BBE, 0x1DA17814, 0x38FFD79C,
+		  0x3DE305D4, 0x2418A00C, 0x19C6F816, 0x2219F753,
+		  0x00007B8B, 0x28CD12C3, 0x1D9C08AA, 0x3D723650,
+		  0x015F9B6E, 0x15ADB564, 0x181CF1F7, 0x280B4224,
+		  0x09CF9445, 0x00008BC6 },
+		{ 0x392DB860, 0x13206415, 0x29A247B0, 0x0224A20C,
+		  0x15DBE981, 0x0B5B423C, 0x1DCD1151, 0x39D312B5,
+		  0x00000755, 0x20D09849, 0x3598036E, 0x3C2777A7,
+		  0x24DD1933, 0x015BC2B2, 0x26CB608E, 0x19E4DD24,
+		  0x2BE9D4EB, 0x0000FE16 },
+		{ 0x0C2F3082, 0x18C9F883, 0x117AEB9C, 0x179B1637,
+		  0x1BFF6B58, 0x3E40E35E, 0x17DBE7BB, 0x2379697A,
+		  0x0000823C, 0x158BD76C, 0x306D0AA6, 0x245964CA,
+		  0x3C019DD6, 0x3FE885CD, 0x373A5EAE, 0x136CD17E,
+		  0x2984A87A, 0x000061FB },
+		{ 0x2A26BA6B, 0x27BDA557, 0x2DA12C3A, 0x0B28A925,
+		  0x30BBDEDD, 0x043035FA, 0x2C96968A, 0x2A1330DC,
+		  0x000088FB, 0x244972F8, 0x01051E07, 0x00CFDCE8,
+		  0x12A78A38, 0x14788D48, 0x1B6916D4, 0x1BE0FD26,
+		  0x3BD9274E, 0x0000512A },
+		{ 0x30F870D2, 0x3B850F07, 0x24D1558E, 0x22800927,
+		  0x1ACD21CF, 0x2BAA39D6, 0x0EDE902F, 0x30F2AF90,
+		  0x000005F0, 0x2E60E8CC, 0x3D4DF255, 0x2EB5F8A5,
+		  0x3DC95CDE, 0x31AC23C2, 0x1E96662A, 0x12C56BCE,
+		  0x1764D3DB, 0x000034B5 },
+		{ 0x14720CAB, 0x2712290A, 0x339B17E3, 0x07A97505,
+		  0x1C6F2C1A, 0x03DB9D55, 0x15BEB8E5, 0x2B32FB01,
+		  0x0000E1A0, 0x34B185C9, 0x1B514FD5, 0x080254EA,
+		  0x128A9C74, 0x2EBCBF08, 0x1BE0C1DF, 0x0C854183,
+		  0x1A3EDFA6, 0x0000E079 },
+		{ 0x01F6B0BA, 0x294D5FEF, 0x312354D3, 0x0077AE87,
+		  0x2F807081, 0x196E46AF, 0x001D81FD, 0x3A92A09E,
+		  0x00009211, 0x22B8E349, 0x245057E6, 0x328BBB2D,
+		  0x391E2DEB, 0x19CD444E, 0x2E9FA562, 0x12AB3C74,
+		  0x0624B885, 0x0000E7E9 },
+		{ 0x2C26C42A, 0x2A0A3F7F, 0x2B11BB62, 0x26FEDF91,
+		  0x27E6A024, 0x2CD624C7, 0x33C7E50D, 0x0EE1B9A9,
+		  0x00000AE9, 0x39F808CA, 0x0418CD0E, 0x1AADB649,
+		  0x228E7BBD, 0x220B3727, 0x0B8FB707, 0x07E13A94,
+		  0x3DB7451E, 0x00007028 }
+	},
+#endif
+#if BR_EC_P256_GEN_TABLE_SIZE >= 8
+	/* k*2^160*G */
+	{
+		{ 0x37F82F2A, 0x3BA71D77, 0x2FDF43AA, 0x130D61D2,
+		  0x3713269E, 0x08B7D0DC, 0x33617F56, 0x17D59BB1,
+		  0x00008A53, 0x223094B7, 0x17E682B0, 0x08C7669C,
+		  0x394CE193, 0x1A92BFCD, 0x00A06421, 0x08BD737E,
+		  0x30211A2C, 0x00000455 },
+		{ 0x01CD7F36, 0x22C10F10, 0x019149BE, 0x26723C65,
+		  0x3DFA1757, 0x38B18122, 0x14D84D36, 0x285EA220,
+		  0x00004EAF, 0x0B2D1C43, 0x1DE31928, 0x14543D2C,
+		  0x0DA9632B, 0x2FC47B50, 0x154C549F, 0x0201FEE4,
+		  0x1D36147B, 0x0000A479 },
+		{ 0x2B348FA0, 0x2C53C85E, 0x11541DDF, 0x3F891641,
+		  0x24B4BCE0, 0x088C8DB0, 0x3882DC2A, 0x324F777A,
+		  0x000086EA, 0x0DA51CEE, 0x3B8E0255, 0x1CFEE8A4,
+		  0x09B658D4, 0x2F46716C, 0x0DBE7A35, 0x04D8D5A4,
+		  0x0E14F2EF, 0x0000948F },
+		{ 0x396214FB, 0x30C67552, 0x3EBC765C, 0x37261EA3,
+		  0x31C58971, 0x27925B37, 0x3DB25CDA, 0x0BF113EF,
+		  0x0000C612, 0x37ADFFF7, 0x1C0AF63E, 0x2271F8A3,
+		  0x29B92307, 0x37F91F08, 0x07261A21, 0x3AC41903,
+		  0x16FB20D0, 0x0000EA20 },
+		{ 0x19222C03, 0x2BD07FF2, 0x3E5E1037, 0x2339DFA1,
+		  0x19F40794, 0x39F5E121, 0x33AAE3F5, 0x27AEBE7E,
+		  0x00008BF0, 0x2A72BB54, 0x0517DD0B, 0x220E1D4A,
+		  0x27B03877, 0x25BA309C, 0x22C76F9F, 0x27A733B4,
+		  0x2EABF8B8, 0x0000509C },
+		{ 0x0D215BFD, 0x1A1A5DEA, 0x31462B71, 0x381D099F,
+		  0x165D248B, 0x18883A8B, 0x2629E85B, 0x33AF87D4,
+		  0x00008B4F, 0x075EC26B, 0x1BABC029, 0x121ADD60,
+		  0x3540B427, 0x1254FFF9, 0x3EC72B6A, 0x2157EF96,
+		  0x01EA6A08, 0x00001F33 },
+		{ 0x11AE9300, 0x114E8B07, 0x1C48280B, 0x0711C11D,
+		  0x33735B5E, 0x0C2EB68B, 0x30FC6191, 0x0B72EDF9,
+		  0x0000E85E, 0x1546E25E, 0x0A837F74, 0x38C31BB7,
+		  0x2DF86177, 0x3C2707DE, 0x29ED6E08, 0x0E0BFC7B,
+		  0x2BE9B547, 0x0000451A },
+		{ 0x0E9D6B84, 0x25EFA7B4, 0x286B987E, 0x13FFF77B,
+		  0x019FDA6F, 0x1010B04C, 0x1213724B, 0x1008B060,
+		  0x0000B6D9, 0x3CA7CB21, 0x06F2A83E, 0x04F382AE,
+		  0x0C9CFABB, 0x177AD3C2, 0x111E2213, 0x28723863,
+		  0x0FD058A4, 0x000093FF },
+		{ 0x05260CB8, 0x14975558, 0x2B2152F2, 0x1BD2A033,
+		  0x27DBF683, 0x009F686E, 0x12F82A3F, 0x2C3C8A32,
+		  0x00003F5F, 0x1852C964, 0x0BED2D10, 0x05EC3327,
+		  0x0FA1D47F, 0x2783F2FA, 0x237854D9, 0x199870E3,
+		  0x0D36B692, 0x0000C558 },
+		{ 0x323BA10E, 0x3047F1C0, 0x04C386AE, 0x3552B69F,
+		  0x3E567EE0, 0x3FF1AAB5, 0x0F5C4D92, 0x2FF1CA07,
+		  0x0000C453, 0x16EE110A, 0x0B098E8E, 0x39E9BA2F,
+		  0x2B6DCFAE, 0x2776CA67, 0x149170FF, 0x2635D2DF,
+		  0x091062CD, 0x0000E6FA },
+		{ 0x1A1CD60F, 0x2A91110B, 0x03092EA4, 0x25A62A73,
+		  0x1A002B9F, 0x3B41D2D3, 0x1999657A, 0x1588AC63,
+		  0x00003368, 0x0FD57D67, 0x2FDCDD94, 0x050B8B24,
+		  0x3BD6932F, 0x27AF175F, 0x1630037A, 0x07CD9BA8,
+		  0x1427BC49, 0x0000D42F },
+		{ 0x043E4011, 0x2E5B983B, 0x1BB2E9D6, 0x1FFA6577,
+		  0x07D73065, 0x0BDE77CF, 0x02E9D862, 0x0B9DFD18,
+		  0x00004C30, 0x1C5D5B0B, 0x244842D9, 0x1A3FE769,
+		  0x127350A6, 0x2B957983, 0x1405E95D, 0x22940C33,
+		  0x3091DA35, 0x0000776B },
+		{ 0x37576342, 0x014EDBAE, 0x199222AF, 0x0B2220CE,
+		  0x0979D95B, 0x03E76258, 0x00080F7D, 0x3AD7023C,
+		  0x00004813, 0x17376316, 0x130557AE, 0x06A904F6,
+		  0x0B719F54, 0x33524ACA, 0x005A1238, 0x24240F66,
+		  0x0FF508CE, 0x00000004 },
+		{ 0x2304E88C, 0x2D97904E, 0x37F88C67, 0x1CEE046E,
+		  0x2BB90831, 0x13311BF8, 0x0B31C375, 0x15E9B63F,
+		  0x00008712, 0x397623C5, 0x06E2E167, 0x03C076C3,
+		  0x38C935ED, 0x386527CE, 0x1B37D672, 0x2FF2A285,
+		  0x38D2066E, 0x000010C8 },
+		{ 0x3F69B2BE, 0x3D9C5C77, 0x01111C09, 0x107DD3B7,
+		  0x386E56BA, 0x08B6EEB8, 0x2997AF13, 0x3C7E696B,
+		  0x000080C3, 0x0102D2F5, 0x2412E5F1, 0x0B7A8BF8,
+		  0x12DD2CD7, 0x1D5A9BF1, 0x0389D96C, 0x1DE85298,
+		  0x08502802, 0x00000A93 }
+	},
+#endif
+#if BR_EC_P256_GEN_TABLE_SIZE >= 4
+	/* k*2^192*G */
+	{
+		{ 0x313728BE, 0x33C83FEC, 0x3C6B94A6, 0x10E56468,
+		  0x315FC596, 0x1BFE0D10, 0x09276273, 0x259DE9E1,
+		  0x0000A6D3, 0x0357F5F4, 0x0AEAE0CF, 0x284059BF,
+		  0x12A48308, 0x27ECDF82, 0x22EAF4B4, 0x3881666B,
+		  0x211D26C2, 0x0000674F },
+		{ 0x1974BB08, 0x160E5231, 0x2EADD251, 0x3CEC32AB,
+		  0x2A108675, 0x1872A8B4, 0x2E80D4A6, 0x3734B398,
+		  0x00003F06, 0x15083C99, 0x259576A6, 0x288F53E8,
+		  0x0581A417, 0x1D9B2E83, 0x201EFA4C, 0x122DB985,
+		  0x09543386, 0x000008BC },
+		{ 0x0F15D864, 0x0152D5A7, 0x1CC8D3CC, 0x01BF71A8,
+		  0x26CF3524, 0x23B39EF8, 0x2DB0DAFC, 0x19B5F177,
+		  0x000007EF, 0x340907FE, 0x1189509D, 0x0CE4A8B5,
+		  0x11C38EC7, 0x3D505E9F, 0x10314887, 0x1E6A506D,
+		  0x0C976E27, 0x00002DB3 },
+		{ 0x15C7C27C, 0x30406E3F, 0x3DC794C1, 0x0C8A2E52,
+		  0x3E97B7EB, 0x016CC549, 0x21D05E0C, 0x3FCA6462,
+		  0x0000EC61, 0x19DDFE51, 0x37C0459F, 0x290233DA,
+		  0x0F11B11D, 0x359298FE, 0x183E0B1D, 0x257A1D09,
+		  0x074F706C, 0x000002FA },
+		{ 0x17C7C05E, 0x1A5450F0, 0x0E5416AC, 0x20F2E54B,
+		  0x328C0BB2, 0x0E9CBDD7, 0x1C46014F, 0x1397F01B,
+		  0x000082DF, 0x18FFF26B, 0x2584F40B, 0x02DB300B,
+		  0x057651A1, 0x17CBD1CF, 0x08588448, 0x2420A275,
+		  0x22326325, 0x0000E4E1 },
+		{ 0x1D7DD05C, 0x08F90B88, 0x1B00E1AC, 0x13E13530,
+		  0x1116D1C5, 0x0FEC839F, 0x1176169A, 0x22F37FDE,
+		  0x00005BB1, 0x0B96A309, 0x1B1527CB, 0x0D2A4165,
+		  0x061D61E9, 0x35821595, 0x2DB7575F, 0x24874F81,
+		  0x2485CB7A, 0x000042AD },
+		{ 0x140368B0, 0x02B87505, 0x3EE949D8, 0x09308BE3,
+		  0x247A6213, 0x396E34E3, 0x30C6A7D9, 0x3F26F04A,
+		  0x0000261E, 0x3DEB011F, 0x0EB49566, 0x39B5D301,
+		  0x0D02F878, 0x0FFF797E, 0x2214B359, 0x2FCE9FDC,
+		  0x0AB6F8E1, 0x00008A9D },
+		{ 0x246E2050, 0x1024CCB7, 0x0F5ABF0C, 0x2B0A8E40,
+		  0x2797E2F5, 0x319A60C5, 0x2347F4D6, 0x2FEFF9C7,
+		  0x00009A79, 0x126250D2, 0x28FD1E06, 0x2DFDE317,
+		  0x253EB32D, 0x24EFA9CA, 0x19C7CEC8, 0x2E200B6F,
+		  0x1379B4C5, 0x0000E98B },
+		{ 0x15EB8034, 0x040CFA54, 0x2E8CA4AF, 0x02CCD7D5,
+		  0x27692DF3, 0x29F96767, 0x0279149A, 0x37F5DE8B,
+		  0x00006D48, 0x1AB0CE30, 0x21CC21E9, 0x23E8961E,
+		  0x00843A8A, 0x05476308, 0x39E59278, 0x1D12F3D5,
+		  0x1C914597, 0x00003CB4 },
+		{ 0x14598089, 0x15BBE11F, 0x28D36168, 0x219DCDEA,
+		  0x35A5BA0E, 0x3C95CAF7, 0x078CF552, 0x29F042E6,
+		  0x00001F3F, 0x1825D989, 0x352CDF16, 0x2E5A500E,
+		  0x386CBA21, 0x0D1D1E1D, 0x2B96CFDB, 0x39E55C7C,
+		  0x307676DE, 0x00007C27 },
+		{ 0x140535C8, 0x1450F7F1, 0x08DB13EB, 0x3C2958C3,
+		  0x054E6F65, 0x048FED3F, 0x18923A49, 0x30079EEE,
+		  0x000093A5, 0x3D59B844, 0x1255D020, 0x35BEDFFC,
+		  0x28588124, 0x15A5C166, 0x2A10D638, 0x0C2F4C16,
+		  0x03A41260, 0x00002D44 },
+		{ 0x14BFC0D8, 0x02B99DC0, 0x3A4800E5, 0x38B221A5,
+		  0x33D40071, 0x12D0A60D, 0x2BB21D2A, 0x2619C6DF,
+		  0x0000FB91, 0x2A805701, 0x1D4943CD, 0x1C244B57,
+		  0x3A41D835, 0x1E9D2807, 0x393A43F8, 0x3362B041,
+		  0x1A4E697F, 0x000017FC },
+		{ 0x1E2047BA, 0x0986959A, 0x3B0F652A, 0x11C1265A,
+		  0x167031E5, 0x3683805F, 0x272BBB35, 0x2E4A4584,
+		  0x00003FB0, 0x1DB24158, 0x1FFB353B, 0x17009D35,
+		  0x1082B9DC, 0x266DC86C, 0x09887265, 0x3DF94CA7,
+		  0x1EB9A085, 0x00009D46 },
+		{ 0x315D3AC8, 0x26DDC956, 0x19444EEA, 0x0793B676,
+		  0x08AD7F87, 0x1B6C48BB, 0x1B29C568, 0x1F98C6FF,
+		  0x0000C881, 0x32B9A312, 0x3CB12588, 0x2DD8358B,
+		  0x041EFFA5, 0x0697C4F5, 0x0F0D0856, 0x1CFD4C29,
+		  0x3300B5D2, 0x0000D157 },
+		{ 0x22DF71C1, 0x02F6F6EB, 0x3BB723A0, 0x0C61AFAB,
+		  0x33E4381C, 0x18EEA778, 0x283D5D07, 0x250E7823,
+		  0x0000DAB0, 0x24C3A1E3, 0x21CD2104, 0x0B44E3BB,
+		  0x258CC329, 0x120B3D6E, 0x2BA1BC83, 0x21CEF385,
+		  0x2F079513, 0x0000763C }
+	},
+#endif
+#if BR_EC_P256_GEN_TABLE_SIZE >= 8
+	/* k*2^224*G */
+	{
+		{ 0x2895DF07, 0x29C0FC43, 0x1876BD86, 0x1D7CFE80,
+		  0x208FFEFD, 0x2C1B9C33, 0x3DFEEEB5, 0x2E1509E0,
+		  0x000068F6, 0x38712655, 0x031DBE29, 0x310BF7F9,
+		  0x14A4F4BC, 0x245028CF, 0x201137F6, 0x00CE6FBC,
+		  0x3FAEA4B9, 0x0000CBE1 },
+		{ 0x00C15FC7, 0x34414C76, 0x2E992589, 0x1988FC5C,
+		  0x15E54166, 0x3C273439, 0x00D5FF3C, 0x03152307,
+		  0x0000E1B4, 0x2A318024, 0x1F2A11A0, 0x29BB6241,
+		  0x24914837, 0x34708F00, 0x3604481F, 0x04FF9F47,
+		  0x2AAB0FCE, 0x00001EA8 },
+		{ 0x3AA89692, 0x1063E88C, 0x14C2308E, 0x0EC235BE,
+		  0x18A77671, 0x1B990490, 0x28F4DE99, 0x329C6059,
+		  0x00003BDF, 0x1A510308, 0x0F6F6D0C, 0x1E2EF139,
+		  0x370318D1, 0x1A5333C7, 0x098546BB, 0x167B8494,
+		  0x07DA1594, 0x00000A72 },
+		{ 0x031EBA7E, 0x096D65FA, 0x0989E56A, 0x3927095C,
+		  0x32A37EF1, 0x06EE9EF1, 0x202DF420, 0x0C576E8A,
+		  0x0000963E, 0x0E7C79C0, 0x37E92CCA, 0x0D5F13C3,
+		  0x2742B970, 0x167E1186, 0x0F2DF148, 0x23935A2A,
+		  0x2E84F212, 0x00005C02 },
+		{ 0x037EA1D7, 0x1E6C8D0B, 0x09AAE4D0, 0x0E4D963E,
+		  0x0D9E4FB2, 0x0A154946, 0x21056353, 0x2B256DD4,
+		  0x0000ACA8, 0x1BA973A2, 0x37BEC412, 0x13935E9D,
+		  0x3B6FF710, 0x072189E1, 0x01312E4A, 0x1CC20943,
+		  0x3159F75D, 0x00007F12 },
+		{ 0x2D8D3763, 0x0B562A4F, 0x3D25D440, 0x0F06D06C,
+		  0x02521E16, 0x208481F2, 0x141A28C0, 0x0C859756,
+		  0x000079CC, 0x3C5F6BFC, 0x1AAAC3C2, 0x1D3626B3,
+		  0x2AF05D60, 0x2FFC3EAD, 0x30756650, 0x053D027C,
+		  0x24FA01CC, 0x00009CF8 },
+		{ 0x13245B7F, 0x36C9E073, 0x0597FBF5, 0x1F59A5A4,
+		  0x185311A3, 0x3086BE63, 0x27C0E206, 0x11C136D9,
+		  0x0000FA90, 0x0DDF6BEF, 0x3E0CF7C5, 0x24F1D47E,
+		  0x27BB3498, 0x31C189CB, 0x3E8FB503, 0x036A42D6,
+		  0x230D9D2A, 0x00001A1C },
+		{ 0x348560A9, 0x30E2E884, 0x26F217C6, 0x3A583F58,
+		  0x00DA20B3, 0x0DA51E19, 0x143937BE, 0x36640166,
+		  0x00006FA2, 0x3AE52757, 0x25824DDE, 0x151C5EEB,
+		  0x0E736AF1, 0x185C3AFE, 0x128D4A9A, 0x2C7E8375,
+		  0x0330E456, 0x00009EBA },
+		{ 0x37F0953A, 0x187DE3F5, 0x315439AB, 0x124520FF,
+		  0x3A92A818, 0x0AE3874B, 0x17D8CD67, 0x06AAE47D,
+		  0x00001D43, 0x1D68F260, 0x1F1675DA, 0x0707E7C1,
+		  0x238A6A42, 0x15FAE0F4, 0x0C320F38, 0x1121EBC5,
+		  0x19F0EFC6, 0x000008D6 },
+		{ 0x2039279A, 0x2436A60D, 0x13DB4A85, 0x393021EC,
+		  0x157597E6, 0x1491C803, 0x39C88827, 0x3EA9FF15,
+		  0x0000B7BD, 0x02152AE1, 0x2EF42AAD, 0x0BAFC31D,
+		  0x39B8DA62, 0x0585F6A7, 0x08F11879, 0x3D5D14BD,
+		  0x2A7DF1DB, 0x00001D2F },
+		{ 0x25227C70, 0x28C45C4D, 0x3A3EA705, 0x0AFAACCC,
+		  0x31C60FF3, 0x12CD6CB8, 0x21137DDA, 0x3A83568F,
+		  0x00006DEE, 0x0369B9B7, 0x35B68E04, 0x29083DBA,
+		  0x1EBB0795, 0x2ACC8428, 0x132EBFBD, 0x03E40001,
+		  0x0FC3F1D1, 0x0000CBB9 },
+		{ 0x231413A4, 0x26D824EB, 0x091E8CD6, 0x3805739A,
+		  0x0BA4B707, 0x1D7DC6DA, 0x2A5108BD, 0x3A1E94B9,
+		  0x00009504, 0x1F51C38A, 0x28A5EBE7, 0x30DD9C35,
+		  0x07E11C35, 0x07F18626, 0x3115758F, 0x07CBF66B,
+		  0x0763F8C1, 0x0000B607 },
+		{ 0x0421B54D, 0x2D7F57A2, 0x1564A4FF, 0x26CAE0E9,
+		  0x3A9DCA57, 0x3274AEC7, 0x178D8D4A, 0x170418D5,
+		  0x00002813, 0x0EE5D868, 0x3733C26E, 0x1E310D8A,
+		  0x01253324, 0x3F8C15EF, 0x2A75D041, 0x1BE1506F,
+		  0x12AF8E14, 0x00009ED8 },
+		{ 0x2064184E, 0x3D2E309D, 0x38197585, 0x28E7E7E6,
+		  0x00794873, 0x2695E4FB, 0x319F04A2, 0x25CEAA2F,
+		  0x0000CB7B, 0x335BF117, 0x0869AAA5, 0x2586640A,
+		  0x267B08F0, 0x07860A15, 0x29403F6A, 0x19245D5F,
+		  0x3BE44DB7, 0x0000349A },
+		{ 0x28E4AC10, 0x05F95647, 0x0E24A9A9, 0x25AA04AB,
+		  0x3FB56879, 0x0F316827, 0x1077BD6C, 0x015D882C,
+		  0x0000339A, 0x0D1312A0, 0x1DB6A191, 0x01CC66EF,
+		  0x0E79E23D, 0x0F553E50, 0x1537DE2B, 0x2947F438,
+		  0x17EFB75A, 0x0000CA98 }
+	},
+#endif
+
+};
+
+#endif
+
 /*
- * Lookup one of the Gwin[] values, by index. This is constant-time.
+ * Lookup one of the values of a window (Gwin[] or one of the Gcomb[]
+ * tables), by index. This is constant-time.
  */
 static void
-lookup_Gwin(p256_jacobian *T, uint32_t idx)
+lookup_Gwin(p256_jacobian *T, const uint32_t (*win)[18], uint32_t idx)
 {
 	uint32_t xy[18];
 	uint32_t k;
@@ -1278,7 +1864,7 @@ lookup_Gwin(p256_jacobian *T, uint32_t idx)
 
 		m = -EQ(idx, k + 1);
 		for (u = 0; u < 18; u ++) {
-			xy[u] |= m & Gwin[k][u];
+			xy[u] |= m & win[k][u];
 		}
 	}
 	memcpy(T->x, &xy[0], sizeof T->x);
@@ -1291,6 +1877,71 @@ lookup_Gwin(p256_jacobian *T, uint32_t idx)
  * Multiply the generator by an integer. The integer is assumed non-zero
  * and lower than the curve order.
  */
+#if BR_EC_P256_GEN_TABLE_SIZE > 1
+
+static void
+p256_mulgen(p256_jacobian *P, const unsigned char *x, size_t xlen)
+{
+	/*
+	 * Comb method: the 256-bit multiplier is split into
+	 * BR_EC_P256_GEN_TABLE_SIZE chunks of n bits, chunk i being
+	 * applied to 2^(i*n)*G with the corresponding window table.
+	 * Each step doubles Q four times, then adds the points for
+	 * the next 4 bits of every chunk; this needs only n doublings
+	 * instead of 256.
+	 *
+	 * The added point is never equal to Q or -Q, since their
+	 * multipliers are made of disjoint bits of a value lower than
+	 * the curve order. qz and the table lookups are as in the
+	 * single window code.
+	 */
+	unsigned char k[32];
+	p256_jacobian Q;
+	uint32_t qz;
+	int n, j;
+
+	/*
+	 * Extra leading bytes can only be zero.
+	 */
+	if (xlen > sizeof k) {
+		x += xlen - sizeof k;
+		xlen = sizeof k;
+	}
+	memset(k, 0, sizeof k - xlen);
+	memcpy(k + sizeof k - xlen, x, xlen);
+
+	n = 256 / BR_EC_P256_GEN_TABLE_SIZE;
+	memset(&Q, 0, sizeof Q);
+	qz = 1;
+	for (j = n - 4; j >= 0; j -= 4) {
+		int i;
+
+		p256_double(&Q);
+		p256_double(&Q);
+		p256_double(&Q);
+		p256_double(&Q);
+		for (i = 0; i < BR_EC_P256_GEN_TABLE_SIZE; i ++) {
+			uint32_t bits;
+			uint32_t bnz;
+			int e;
+			p256_jacobian T, U;
+
+			e = i * n + j;
+			bits = (k[31 - (e >> 3)] >> (e & 7)) & 0x0F;
+			bnz = NEQ(bits, 0);
+			lookup_Gwin(&T, i == 0 ? Gwin : Gcomb[i - 1], bits);
+			U = Q;
+			p256_add_mixed(&U, &T);
+			CCOPY(bnz & qz, &Q, &T, sizeof Q);
+			CCOPY(bnz & ~qz, &Q, &U, sizeof Q);
+			qz &= ~bnz;
+		}
+	}
+	*P = Q;
+}
+
+#else
+
 static void
 p256_mulgen(p256_jacobian *P, const unsigned char *x, size_t xlen)
 {
@@ -1323,7 +1974,7 @@ p256_mulgen(p256_jacobian *P, const unsigned char *x, size_t xlen)
 			p256_double(&Q);
 			bits = (bx >> 4) & 0x0F;
 			bnz = NEQ(bits, 0);
-			lookup_Gwin(&T, bits);
+			lookup_Gwin(&T, Gwin, bits);
 			U = Q;
 			p256_add_mixed(&U, &T);
 			CCOPY(bnz & qz, &Q, &T, sizeof Q);
@@ -1335,6 +1986,8 @@ p256_mulgen(p256_jacobian *P, const unsigned char *x, size_t xlen)
 	*P = Q;
 }
 
+#endif
+
 static const unsigned char P256_G[] = {
 	0x04, 0x6B, 0x17, 0xD1, 0xF2, 0xE1, 0x2C, 0x42, 0x47, 0xF8,
 	0xBC, 0xE6, 0xE5, 0x63, 0xA4, 0x40, 0xF2, 0x77, 0x03, 0x7D,
@@ -1473,3 +2126,111 @@ const br_ec_impl br_ec_p256_m31 = {
 	&api_mulgen,
 	&api_muladd
 };
+
+#ifdef ARDUINO
+/*
+ * Multiply a point, given by its window table (same format as Gwin[]),
+ * by an integer. The integer is assumed non-zero and lower than the
+ * curve order. This is the single window code of p256_mulgen().
+ */
+static void
+p256_mul_window(p256_jacobian *P, const uint32_t (*win)[18],
+	const unsigned char *x, size_t xlen)
+{
+	p256_jacobian Q;
+	uint32_t qz;
+
+	memset(&Q, 0, sizeof Q);
+	qz = 1;
+	while (xlen -- > 0) {
+		int k;
+		unsigned bx;
+
+		bx = *x ++;
+		for (k = 0; k < 2; k ++) {
+			uint32_t bits;
+			uint32_t bnz;
+			p256_jacobian T, U;
+
+			p256_double(&Q);
+			p256_double(&Q);
+			p256_double(&Q);
+			p256_double(&Q);
+			bits = (bx >> 4) & 0x0F;
+			bnz = NEQ(bits, 0);
+			lookup_Gwin(&T, win, bits);
+			U = Q;
+			p256_add_mixed(&U, &T);
+			CCOPY(bnz & qz, &Q, &T, sizeof Q);
+			CCOPY(bnz & ~qz, &Q, &U, sizeof Q);
+			qz &= ~bnz;
+			bx <<= 4;
+		}
+	}
+	*P = Q;
+}
+
+static uint32_t
+api_muladd_precomp(unsigned char *A, const uint32_t *table,
+	const unsigned char *x, size_t xlen,
+	const unsigned char *y, size_t ylen)
+{
+	p256_jacobian P, Q;
+	uint32_t t, z;
+	int i;
+
+	p256_mul_window(&P, (const uint32_t (*)[18])table, x, xlen);
+	p256_mulgen(&Q, y, ylen);
+
+	/*
+	 * Final addition, as in api_muladd().
+	 */
+	t = p256_add(&P, &Q);
+	reduce_final_f256(P.z);
+	z = 0;
+	for (i = 0; i < 9; i ++) {
+		z |= P.z[i];
+	}
+	z = EQ(z, 0);
+	p256_double(&Q);
+	CCOPY(z & ~t, &P, &Q, sizeof Q);
+	p256_to_affine(&P);
+	p256_encode(A, &P);
+	return ~(z & t) & 1;
+}
+
+/* see bearssl_ec.h */
+uint32_t
+br_ec_p256_m31_precomp(br_ec_p256_precomp_key *pk,
+	uint32_t *table, const void *Q, size_t Qlen)
+{
+	p256_jacobian P, T, U;
+	int k;
+
+	if (!p256_decode(&P, Q, Qlen)) {
+		return 0;
+	}
+
+	/*
+	 * Compute k*Q for k = 1 to 15, and store them in affine
+	 * coordinates. This is done once per key, so the inversions
+	 * are not batched.
+	 */
+	T = P;
+	for (k = 1; k <= 15; k ++) {
+		if (k == 2) {
+			T = P;
+			p256_double(&T);
+		} else if (k > 2) {
+			p256_add(&T, &P);
+		}
+		U = T;
+		p256_to_affine(&U);
+		memcpy(table + (k - 1) * 18, U.x, sizeof U.x);
+		memcpy(table + (k - 1) * 18 + 9, U.y, sizeof U.y);
+	}
+	pk->muladd = &api_muladd_precomp;
+	pk->table = table;
+	return 1;
+}
+#endif
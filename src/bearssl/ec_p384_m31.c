@@ -0,0 +1,1282 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "inner.h"
+
+/*
+ * P-384 with 30-bit words, on the model of ec_p256_m31.c: field
+ * elements use thirteen words (390 bits), products are computed in
+ * full and then reduced with the special form of the modulus.
+ */
+
+/*
+ * If BR_NO_ARITH_SHIFT is undefined, or defined to 0, then we _assume_
+ * that right-shifting a signed negative integer copies the sign bit
+ * (arithmetic right-shift). See ec_p256_m31.c for details.
+ */
+#if BR_NO_ARITH_SHIFT
+#define ARSH(x, n)    (((uint32_t)(x) >> (n)) \
+                      | ((-((uint32_t)(x) >> 31)) << (32 - (n))))
+#define ARSHW(x, n)   (((uint64_t)(x) >> (n)) \
+                      | ((-((uint64_t)(x) >> 63)) << (64 - (n))))
+#else
+#define ARSH(x, n)    ((*(int32_t *)&(x)) >> (n))
+#define ARSHW(x, n)   ((*(int64_t *)&(x)) >> (n))
+#endif
+
+/*
+ * Convert an integer from unsigned big-endian encoding to a sequence of
+ * 30-bit words in little-endian order. The final "partial" word is
+ * returned.
+ */
+static uint32_t
+be8_to_le30(uint32_t *dst, const unsigned char *src, size_t len)
+{
+	uint32_t acc;
+	int acc_len;
+
+	acc = 0;
+	acc_len = 0;
+	while (len -- > 0) {
+		uint32_t b;
+
+		b = src[len];
+		if (acc_len < 22) {
+			acc |= b << acc_len;
+			acc_len += 8;
+		} else {
+			*dst ++ = (acc | (b << acc_len)) & 0x3FFFFFFF;
+			acc = b >> (30 - acc_len);
+			acc_len -= 22;
+		}
+	}
+	return acc;
+}
+
+/*
+ * Convert an integer (30-bit words, little-endian) to unsigned
+ * big-endian encoding. The total encoding length is provided; all
+ * the destination bytes will be filled.
+ */
+static void
+le30_to_be8(unsigned char *dst, size_t len, const uint32_t *src)
+{
+	uint32_t acc;
+	int acc_len;
+
+	acc = 0;
+	acc_len = 0;
+	while (len -- > 0) {
+		if (acc_len < 8) {
+			uint32_t w;
+
+			w = *src ++;
+			dst[len] = (unsigned char)(acc | (w << acc_len));
+			acc = w >> (8 - acc_len);
+			acc_len += 22;
+		} else {
+			dst[len] = (unsigned char)acc;
+			acc >>= 8;
+			acc_len -= 8;
+		}
+	}
+}
+
+/*
+ * Multiply two integers. Source integers are represented as arrays of
+ * thirteen 30-bit words, for values up to 2^390-1. Result is encoded
+ * over 26 words of 30 bits each.
+ */
+static void
+mul13(uint32_t *d, const uint32_t *a, const uint32_t *b)
+{
+	/*
+	 * Each column is the sum of at most 13 products of 30-bit
+	 * integers (less than 13*2^60), and the carry from the previous
+	 * column is less than 2^34, so this all fits on 64 bits.
+	 */
+	uint64_t t[25];
+	uint64_t cc;
+	int i, j;
+
+	memset(t, 0, sizeof t);
+	for (i = 0; i < 13; i ++) {
+		for (j = 0; j < 13; j ++) {
+			t[i + j] += MUL31(a[i], b[j]);
+		}
+	}
+
+	/*
+	 * Propagate carries.
+	 */
+	cc = 0;
+	for (i = 0; i < 25; i ++) {
+		uint64_t w;
+
+		w = t[i] + cc;
+		d[i] = (uint32_t)w & 0x3FFFFFFF;
+		cc = w >> 30;
+	}
+	d[25] = (uint32_t)cc;
+}
+
+/*
+ * Square a 390-bit integer, represented as an array of thirteen 30-bit
+ * words. Result uses 26 words of 30 bits each.
+ */
+static void
+square13(uint32_t *d, const uint32_t *a)
+{
+	/*
+	 * Cross products are computed once and doubled: at most six of
+	 * them per column, plus one square, hence the same bound as in
+	 * mul13().
+	 */
+	uint64_t t[25];
+	uint64_t cc;
+	int i, j;
+
+	memset(t, 0, sizeof t);
+	for (i = 0; i < 13; i ++) {
+		for (j = i + 1; j < 13; j ++) {
+			t[i + j] += MUL31(a[i], a[j]);
+		}
+	}
+	for (i = 0; i < 25; i ++) {
+		t[i] <<= 1;
+	}
+	for (i = 0; i < 13; i ++) {
+		t[i << 1] += MUL31(a[i], a[i]);
+	}
+
+	/*
+	 * Propagate carries.
+	 */
+	cc = 0;
+	for (i = 0; i < 25; i ++) {
+		uint64_t w;
+
+		w = t[i] + cc;
+		d[i] = (uint32_t)w & 0x3FFFFFFF;
+		cc = w >> 30;
+	}
+	d[25] = (uint32_t)cc;
+}
+
+/*
+ * Base field modulus for P-384.
+ */
+static const uint32_t F384[] = {
+
+	0x3FFFFFFF, 0x00000003, 0x00000000, 0x3FFFFFC0,
+	0x3FFFFEFF, 0x3FFFFFFF, 0x3FFFFFFF, 0x3FFFFFFF,
+	0x3FFFFFFF, 0x3FFFFFFF, 0x3FFFFFFF, 0x3FFFFFFF,
+	0x00FFFFFF
+};
+
+/*
+ * The 'b' curve equation coefficient for P-384.
+ */
+static const uint32_t P384_B[] = {
+
+	0x13EC2AEF, 0x2A1723B7, 0x22ED19D2, 0x158E6362,
+	0x13875AC6, 0x10223D40, 0x14112031, 0x271BBFA0,
+	0x2D19181D, 0x15AF8FE0, 0x3E4988E0, 0x29F88FB9,
+	0x00B3312F
+};
+
+/*
+ * Fold the top bits of a field element (13 words of 30 bits), above
+ * 2^384, with 2^384 = 2^128 + 2^96 - 2^32 + 1 mod p. The value is
+ * preserved modulo p, and it becomes lower than twice the modulus.
+ */
+static void
+norm_f384(uint32_t *d)
+{
+	uint32_t w, cc;
+	int i;
+
+	w = d[12] >> 24;
+	d[12] &= 0xFFFFFF;
+	d[0] += w;
+	d[1] -= w << 2;
+	d[3] += w << 6;
+	d[4] += w << 8;
+	cc = 0;
+	for (i = 0; i < 13; i ++) {
+		w = d[i] + cc;
+		d[i] = w & 0x3FFFFFFF;
+		cc = ARSH(w, 30);
+	}
+}
+
+/*
+ * Addition in the field. Source operands shall be smaller than twice
+ * the modulus; the result will fulfil the same property.
+ */
+static void
+add_f384(uint32_t *d, const uint32_t *a, const uint32_t *b)
+{
+	uint32_t w, cc;
+	int i;
+
+	cc = 0;
+	for (i = 0; i < 13; i ++) {
+		w = a[i] + b[i] + cc;
+		d[i] = w & 0x3FFFFFFF;
+		cc = w >> 30;
+	}
+	norm_f384(d);
+}
+
+/*
+ * Subtraction in the field. Source operands shall be smaller than twice
+ * the modulus; the result will fulfil the same property.
+ */
+static void
+sub_f384(uint32_t *d, const uint32_t *a, const uint32_t *b)
+{
+	uint32_t w;
+
+	/*
+	 * We really compute a - b + 2*p to make sure that the result is
+	 * positive; 2*p = 2^385 - 2^129 - 2^97 + 2^33 - 2.
+	 */
+	w = a[0] - b[0] - 0x00002;
+	d[0] = w & 0x3FFFFFFF;
+	w = a[1] - b[1] + ARSH(w, 30) + 0x00008;
+	d[1] = w & 0x3FFFFFFF;
+	w = a[2] - b[2] + ARSH(w, 30);
+	d[2] = w & 0x3FFFFFFF;
+	w = a[3] - b[3] + ARSH(w, 30) - 0x00080;
+	d[3] = w & 0x3FFFFFFF;
+	w = a[4] - b[4] + ARSH(w, 30) - 0x00200;
+	d[4] = w & 0x3FFFFFFF;
+	w = a[5] - b[5] + ARSH(w, 30);
+	d[5] = w & 0x3FFFFFFF;
+	w = a[6] - b[6] + ARSH(w, 30);
+	d[6] = w & 0x3FFFFFFF;
+	w = a[7] - b[7] + ARSH(w, 30);
+	d[7] = w & 0x3FFFFFFF;
+	w = a[8] - b[8] + ARSH(w, 30);
+	d[8] = w & 0x3FFFFFFF;
+	w = a[9] - b[9] + ARSH(w, 30);
+	d[9] = w & 0x3FFFFFFF;
+	w = a[10] - b[10] + ARSH(w, 30);
+	d[10] = w & 0x3FFFFFFF;
+	w = a[11] - b[11] + ARSH(w, 30);
+	d[11] = w & 0x3FFFFFFF;
+	w = a[12] - b[12] + ARSH(w, 30) + 0x2000000;
+	d[12] = w & 0x3FFFFFFF;
+	norm_f384(d);
+}
+
+/*
+ * Reduce a 780-bit product (26 words of 30 bits) modulo p. The result
+ * is lower than twice the modulus.
+ */
+static void
+reduce_f384(uint32_t *d, const uint32_t *t)
+{
+	uint64_t s[26];
+	uint64_t cc, x;
+	uint32_t z, c, w;
+	int i;
+
+	/*
+	 * The modulus is:
+	 *    p = 2^384 - 2^128 - 2^96 + 2^32 - 1
+	 * Therefore:
+	 *    2^384 = 2^128 + 2^96 - 2^32 + 1 mod p
+	 *
+	 * Word i (i >= 13) is at bit offset 30*i = 384 + 30*(i-13) + 6,
+	 * so for its value y:
+	 *    y*2^(30*i) = y*2^(30*(i-9)+14) + y*2^(30*(i-10)+12)
+	 *                 - y*2^(30*(i-12)+8) + y*2^(30*(i-13)+6) mod p
+	 *
+	 * Each term is split over two words. We use 64-bit intermediate
+	 * words, so that carries accumulate, and go from the top word
+	 * down, since the reinjected words may be above 2^384 again.
+	 */
+	for (i = 0; i < 26; i ++) {
+		s[i] = t[i];
+	}
+
+	for (i = 25; i >= 13; i --) {
+		uint64_t y;
+
+		y = s[i];
+		s[i - 8] += ARSHW(y, 16);
+		s[i - 9] += (y << 14) & 0x3FFFFFFF;
+		s[i - 9] += ARSHW(y, 18);
+		s[i - 10] += (y << 12) & 0x3FFFFFFF;
+		s[i - 11] -= ARSHW(y, 22);
+		s[i - 12] -= (y << 8) & 0x3FFFFFFF;
+		s[i - 12] += ARSHW(y, 24);
+		s[i - 13] += (y << 6) & 0x3FFFFFFF;
+	}
+
+	/*
+	 * Signed carry propagation. Each word received at most eight
+	 * contributions, each less than 2^30 plus a high part much
+	 * smaller than that, so the value above 2^384 (in cc) fits on
+	 * about a dozen bits.
+	 */
+	cc = 0;
+	x = 0;
+	for (i = 0; i < 13; i ++) {
+		x = s[i] + cc;
+		d[i] = (uint32_t)x & 0x3FFFFFFF;
+		cc = ARSHW(x, 30);
+	}
+	cc = ARSHW(x, 24);
+	d[12] &= 0xFFFFFF;
+
+	/*
+	 * One extra round of reduction, for cc*2^384, which means adding
+	 * cc*(2^128+2^96-2^32+1) to a 384-bit (nonnegative) value. If cc
+	 * is negative, then the modulus is added once, so that the result
+	 * is positive and still lower than twice the modulus.
+	 */
+	z = (uint32_t)cc;
+	c = z >> 31;
+	d[0] += z - c;
+	d[1] += (c - z) << 2;
+	d[3] += (z - c) << 6;
+	d[4] += (z - c) << 8;
+	d[12] += c << 24;
+	z = 0;
+	for (i = 0; i < 13; i ++) {
+		w = d[i] + z;
+		d[i] = w & 0x3FFFFFFF;
+		z = ARSH(w, 30);
+	}
+}
+
+/*
+ * Compute a multiplication in F384. Source operands shall be less than
+ * twice the modulus.
+ */
+static void
+mul_f384(uint32_t *d, const uint32_t *a, const uint32_t *b)
+{
+	uint32_t t[26];
+
+	mul13(t, a, b);
+	reduce_f384(d, t);
+}
+
+/*
+ * Compute a square in F384. Source operand shall be less than twice
+ * the modulus.
+ */
+static void
+square_f384(uint32_t *d, const uint32_t *a)
+{
+	uint32_t t[26];
+
+	square13(t, a);
+	reduce_f384(d, t);
+}
+
+/*
+ * Perform a "final reduction" in field F384 (field for curve P-384).
+ * The source value must be less than twice the modulus. If the value
+ * is not lower than the modulus, then the modulus is subtracted and
+ * this function returns 1; otherwise, it leaves it untouched and it
+ * returns 0.
+ */
+static uint32_t
+reduce_final_f384(uint32_t *d)
+{
+	uint32_t t[13];
+	uint32_t cc;
+	int i;
+
+	cc = 0;
+	for (i = 0; i < 13; i ++) {
+		uint32_t w;
+
+		w = d[i] - F384[i] - cc;
+		cc = w >> 31;
+		t[i] = w & 0x3FFFFFFF;
+	}
+	cc ^= 1;
+	CCOPY(cc, d, t, sizeof t);
+	return cc;
+}
+
+/*
+ * Jacobian coordinates for a point in P-384: affine coordinates (X,Y)
+ * are such that:
+ *   X = x / z^2
+ *   Y = y / z^3
+ * For the point at infinity, z = 0.
+ * Each point thus admits many possible representations.
+ *
+ * Coordinates are represented in arrays of 32-bit integers, each holding
+ * 30 bits of data. Values may also be slightly greater than the modulus,
+ * but they will always be lower than twice the modulus.
+ */
+typedef struct {
+	uint32_t x[13];
+	uint32_t y[13];
+	uint32_t z[13];
+} p384_jacobian;
+
+/*
+ * Convert a point to affine coordinates:
+ *  - If the point is the point at infinity, then all three coordinates
+ *    are set to 0.
+ *  - Otherwise, the 'z' coordinate is set to 1, and the 'x' and 'y'
+ *    coordinates are the 'X' and 'Y' affine coordinates.
+ * The coordinates are guaranteed to be lower than the modulus.
+ */
+static void
+p384_to_affine(p384_jacobian *P)
+{
+	uint32_t t1[13], t2[13];
+	int i;
+
+	/*
+	 * Invert z with a modular exponentiation: the modulus is
+	 * p = 2^384 - 2^128 - 2^96 + 2^32 - 1, and the exponent is
+	 * p-2. Exponent bit pattern (from high to low) is:
+	 *  - 255 bits of value 1
+	 *  - 1 bit of value 0
+	 *  - 32 bits of value 1
+	 *  - 64 bits of value 0
+	 *  - 30 bits of value 1
+	 *  - 1 bit of value 0
+	 *  - 1 bit of value 1
+	 * Thus, we precompute z^(2^30-1) and use it for each group of
+	 * 30 bits of value 1.
+	 *
+	 * If z = 0 (point at infinity) then the modular exponentiation
+	 * will yield 0, which leads to the expected result (all three
+	 * coordinates set to 0).
+	 */
+	memcpy(t1, P->z, sizeof P->z);
+	for (i = 0; i < 29; i ++) {
+		square_f384(t1, t1);
+		mul_f384(t1, t1, P->z);
+	}
+
+	/*
+	 * Square-and-multiply, starting with the 30 top bits. Bit i
+	 * (counted from the top) completes a group of 30 bits when i is
+	 * 59, 89... 239, 285 and 381; the other bits of value 1 are set
+	 * by multiplying with the original z.
+	 */
+	memcpy(t2, t1, sizeof t1);
+	for (i = 30; i < 384; i ++) {
+		square_f384(t2, t2);
+		if ((i < 240 && (i % 30) == 29) || i == 285 || i == 381) {
+			mul_f384(t2, t2, t1);
+		} else if ((i >= 240 && i < 255)
+			|| i == 286 || i == 287 || i == 383)
+		{
+			mul_f384(t2, t2, P->z);
+		}
+	}
+
+	/*
+	 * Now that we have 1/z, multiply x by 1/z^2 and y by 1/z^3.
+	 */
+	mul_f384(t1, t2, t2);
+	mul_f384(P->x, t1, P->x);
+	mul_f384(t1, t1, t2);
+	mul_f384(P->y, t1, P->y);
+	reduce_final_f384(P->x);
+	reduce_final_f384(P->y);
+
+	/*
+	 * Multiply z by 1/z. If z = 0, then this will yield 0, otherwise
+	 * this will set z to 1.
+	 */
+	mul_f384(P->z, P->z, t2);
+	reduce_final_f384(P->z);
+}
+
+/*
+ * Double a point in P-384. This function works for all valid points,
+ * including the point at infinity.
+ */
+static void
+p384_double(p384_jacobian *Q)
+{
+	/*
+	 * Doubling formulas are:
+	 *
+	 *   s = 4*x*y^2
+	 *   m = 3*(x + z^2)*(x - z^2)
+	 *   x' = m^2 - 2*s
+	 *   y' = m*(s - x') - 8*y^4
+	 *   z' = 2*y*z
+	 *
+	 * These formulas work for all points, including points of order 2
+	 * and points at infinity:
+	 *   - If y = 0 then z' = 0. But there is no such point in P-384
+	 *     anyway.
+	 *   - If z = 0 then z' = 0.
+	 */
+	uint32_t t1[13], t2[13], t3[13], t4[13];
+
+	/*
+	 * Compute z^2 in t1.
+	 */
+	square_f384(t1, Q->z);
+
+	/*
+	 * Compute x-z^2 in t2 and x+z^2 in t1.
+	 */
+	add_f384(t2, Q->x, t1);
+	sub_f384(t1, Q->x, t1);
+
+	/*
+	 * Compute 3*(x+z^2)*(x-z^2) in t1.
+	 */
+	mul_f384(t3, t1, t2);
+	add_f384(t1, t3, t3);
+	add_f384(t1, t3, t1);
+
+	/*
+	 * Compute 4*x*y^2 (in t2) and 2*y^2 (in t3).
+	 */
+	square_f384(t3, Q->y);
+	add_f384(t3, t3, t3);
+	mul_f384(t2, Q->x, t3);
+	add_f384(t2, t2, t2);
+
+	/*
+	 * Compute x' = m^2 - 2*s.
+	 */
+	square_f384(Q->x, t1);
+	sub_f384(Q->x, Q->x, t2);
+	sub_f384(Q->x, Q->x, t2);
+
+	/*
+	 * Compute z' = 2*y*z.
+	 */
+	mul_f384(t4, Q->y, Q->z);
+	add_f384(Q->z, t4, t4);
+
+	/*
+	 * Compute y' = m*(s - x') - 8*y^4. Note that we already have
+	 * 2*y^2 in t3.
+	 */
+	sub_f384(t2, t2, Q->x);
+	mul_f384(Q->y, t1, t2);
+	square_f384(t4, t3);
+	add_f384(t4, t4, t4);
+	sub_f384(Q->y, Q->y, t4);
+}
+
+/*
+ * Add point P2 to point P1.
+ *
+ * This function computes the wrong result in the following cases:
+ *
+ *   - If P1 == 0 but P2 != 0
+ *   - If P1 != 0 but P2 == 0
+ *   - If P1 == P2
+ *
+ * In all three cases, P1 is set to the point at infinity.
+ *
+ * Returned value is 0 if one of the following occurs:
+ *
+ *   - P1 and P2 have the same Y coordinate
+ *   - P1 == 0 and P2 == 0
+ *   - The Y coordinate of one of the points is 0 and the other point is
+ *     the point at infinity.
+ *
+ * The third case cannot actually happen with valid points, since a point
+ * with Y == 0 is a point of order 2, and there is no point of order 2 on
+ * curve P-384.
+ *
+ * Therefore, assuming that P1 != 0 and P2 != 0 on input, then the caller
+ * can apply the following:
+ *
+ *   - If the result is not the point at infinity, then it is correct.
+ *   - Otherwise, if the returned value is 1, then this is a case of
+ *     P1+P2 == 0, so the result is indeed the point at infinity.
+ *   - Otherwise, P1 == P2, so a "double" operation should have been
+ *     performed.
+ */
+static uint32_t
+p384_add(p384_jacobian *P1, const p384_jacobian *P2)
+{
+	/*
+	 * Addtions formulas are:
+	 *
+	 *   u1 = x1 * z2^2
+	 *   u2 = x2 * z1^2
+	 *   s1 = y1 * z2^3
+	 *   s2 = y2 * z1^3
+	 *   h = u2 - u1
+	 *   r = s2 - s1
+	 *   x3 = r^2 - h^3 - 2 * u1 * h^2
+	 *   y3 = r * (u1 * h^2 - x3) - s1 * h^3
+	 *   z3 = h * z1 * z2
+	 */
+	uint32_t t1[13], t2[13], t3[13], t4[13], t5[13], t6[13], t7[13];
+	uint32_t ret;
+	int i;
+
+	/*
+	 * Compute u1 = x1*z2^2 (in t1) and s1 = y1*z2^3 (in t3).
+	 */
+	square_f384(t3, P2->z);
+	mul_f384(t1, P1->x, t3);
+	mul_f384(t4, P2->z, t3);
+	mul_f384(t3, P1->y, t4);
+
+	/*
+	 * Compute u2 = x2*z1^2 (in t2) and s2 = y2*z1^3 (in t4).
+	 */
+	square_f384(t4, P1->z);
+	mul_f384(t2, P2->x, t4);
+	mul_f384(t5, P1->z, t4);
+	mul_f384(t4, P2->y, t5);
+
+	/*
+	 * Compute h = h2 - u1 (in t2) and r = s2 - s1 (in t4).
+	 * We need to test whether r is zero, so we will do some extra
+	 * reduce.
+	 */
+	sub_f384(t2, t2, t1);
+	sub_f384(t4, t4, t3);
+	reduce_final_f384(t4);
+	ret = 0;
+	for (i = 0; i < 13; i ++) {
+		ret |= t4[i];
+	}
+	ret = (ret | -ret) >> 31;
+
+	/*
+	 * Compute u1*h^2 (in t6) and h^3 (in t5);
+	 */
+	square_f384(t7, t2);
+	mul_f384(t6, t1, t7);
+	mul_f384(t5, t7, t2);
+
+	/*
+	 * Compute x3 = r^2 - h^3 - 2*u1*h^2.
+	 */
+	square_f384(P1->x, t4);
+	sub_f384(P1->x, P1->x, t5);
+	sub_f384(P1->x, P1->x, t6);
+	sub_f384(P1->x, P1->x, t6);
+
+	/*
+	 * Compute y3 = r*(u1*h^2 - x3) - s1*h^3.
+	 */
+	sub_f384(t6, t6, P1->x);
+	mul_f384(P1->y, t4, t6);
+	mul_f384(t1, t5, t3);
+	sub_f384(P1->y, P1->y, t1);
+
+	/*
+	 * Compute z3 = h*z1*z2.
+	 */
+	mul_f384(t1, P1->z, P2->z);
+	mul_f384(P1->z, t1, t2);
+
+	return ret;
+}
+
+/*
+ * Add point P2 to point P1. This is a specialised function for the
+ * case when P2 is a non-zero point in affine coordinate.
+ *
+ * This function computes the wrong result in the following cases:
+ *
+ *   - If P1 == 0
+ *   - If P1 == P2
+ *
+ * In both cases, P1 is set to the point at infinity.
+ *
+ * Returned value is 0 if one of the following occurs:
+ *
+ *   - P1 and P2 have the same Y coordinate
+ *   - The Y coordinate of P2 is 0 and P1 is the point at infinity.
+ *
+ * The second case cannot actually happen with valid points, since a point
+ * with Y == 0 is a point of order 2, and there is no point of order 2 on
+ * curve P-384.
+ *
+ * Therefore, assuming that P1 != 0 on input, then the caller
+ * can apply the following:
+ *
+ *   - If the result is not the point at infinity, then it is correct.
+ *   - Otherwise, if the returned value is 1, then this is a case of
+ *     P1+P2 == 0, so the result is indeed the point at infinity.
+ *   - Otherwise, P1 == P2, so a "double" operation should have been
+ *     performed.
+ */
+static uint32_t
+p384_add_mixed(p384_jacobian *P1, const p384_jacobian *P2)
+{
+	/*
+	 * Addtions formulas are:
+	 *
+	 *   u1 = x1
+	 *   u2 = x2 * z1^2
+	 *   s1 = y1
+	 *   s2 = y2 * z1^3
+	 *   h = u2 - u1
+	 *   r = s2 - s1
+	 *   x3 = r^2 - h^3 - 2 * u1 * h^2
+	 *   y3 = r * (u1 * h^2 - x3) - s1 * h^3
+	 *   z3 = h * z1
+	 */
+	uint32_t t1[13], t2[13], t3[13], t4[13], t5[13], t6[13], t7[13];
+	uint32_t ret;
+	int i;
+
+	/*
+	 * Compute u1 = x1 (in t1) and s1 = y1 (in t3).
+	 */
+	memcpy(t1, P1->x, sizeof t1);
+	memcpy(t3, P1->y, sizeof t3);
+
+	/*
+	 * Compute u2 = x2*z1^2 (in t2) and s2 = y2*z1^3 (in t4).
+	 */
+	square_f384(t4, P1->z);
+	mul_f384(t2, P2->x, t4);
+	mul_f384(t5, P1->z, t4);
+	mul_f384(t4, P2->y, t5);
+
+	/*
+	 * Compute h = h2 - u1 (in t2) and r = s2 - s1 (in t4).
+	 * We need to test whether r is zero, so we will do some extra
+	 * reduce.
+	 */
+	sub_f384(t2, t2, t1);
+	sub_f384(t4, t4, t3);
+	reduce_final_f384(t4);
+	ret = 0;
+	for (i = 0; i < 13; i ++) {
+		ret |= t4[i];
+	}
+	ret = (ret | -ret) >> 31;
+
+	/*
+	 * Compute u1*h^2 (in t6) and h^3 (in t5);
+	 */
+	square_f384(t7, t2);
+	mul_f384(t6, t1, t7);
+	mul_f384(t5, t7, t2);
+
+	/*
+	 * Compute x3 = r^2 - h^3 - 2*u1*h^2.
+	 */
+	square_f384(P1->x, t4);
+	sub_f384(P1->x, P1->x, t5);
+	sub_f384(P1->x, P1->x, t6);
+	sub_f384(P1->x, P1->x, t6);
+
+	/*
+	 * Compute y3 = r*(u1*h^2 - x3) - s1*h^3.
+	 */
+	sub_f384(t6, t6, P1->x);
+	mul_f384(P1->y, t4, t6);
+	mul_f384(t1, t5, t3);
+	sub_f384(P1->y, P1->y, t1);
+
+	/*
+	 * Compute z3 = h*z1*z2.
+	 */
+	mul_f384(P1->z, P1->z, t2);
+
+	return ret;
+}
+
+/*
+ * Decode a P-384 point. This function does not support the point at
+ * infinity. Returned value is 0 if the point is invalid, 1 otherwise.
+ */
+static uint32_t
+p384_decode(p384_jacobian *P, const void *src, size_t len)
+{
+	const unsigned char *buf;
+	uint32_t tx[13], ty[13], t1[13], t2[13];
+	uint32_t bad;
+	int i;
+
+	if (len != 97) {
+		return 0;
+	}
+	buf = src;
+
+	/*
+	 * First byte must be 0x04 (uncompressed format). We could support
+	 * "hybrid format" (first byte is 0x06 or 0x07, and encodes the
+	 * least significant bit of the Y coordinate), but it is explicitly
+	 * forbidden by RFC 5480 (section 2.2).
+	 */
+	bad = NEQ(buf[0], 0x04);
+
+	/*
+	 * Decode the coordinates, and check that they are both lower
+	 * than the modulus.
+	 */
+	tx[12] = be8_to_le30(tx, buf + 1, 48);
+	ty[12] = be8_to_le30(ty, buf + 49, 48);
+	bad |= reduce_final_f384(tx);
+	bad |= reduce_final_f384(ty);
+
+	/*
+	 * Check curve equation.
+	 */
+	square_f384(t1, tx);
+	mul_f384(t1, tx, t1);
+	square_f384(t2, ty);
+	sub_f384(t1, t1, tx);
+	sub_f384(t1, t1, tx);
+	sub_f384(t1, t1, tx);
+	add_f384(t1, t1, P384_B);
+	sub_f384(t1, t1, t2);
+	reduce_final_f384(t1);
+	for (i = 0; i < 13; i ++) {
+		bad |= t1[i];
+	}
+
+	/*
+	 * Copy coordinates to the point structure.
+	 */
+	memcpy(P->x, tx, sizeof tx);
+	memcpy(P->y, ty, sizeof ty);
+	memset(P->z, 0, sizeof P->z);
+	P->z[0] = 1;
+	return NEQ(bad, 0) ^ 1;
+}
+
+/*
+ * Encode a point into a buffer. This function assumes that the point is
+ * valid, in affine coordinates, and not the point at infinity.
+ */
+static void
+p384_encode(void *dst, const p384_jacobian *P)
+{
+	unsigned char *buf;
+
+	buf = dst;
+	buf[0] = 0x04;
+	le30_to_be8(buf + 1, 48, P->x);
+	le30_to_be8(buf + 49, 48, P->y);
+}
+
+/*
+ * Multiply a curve point by an integer. The integer is assumed to be
+ * lower than the curve order, and the base point must not be the point
+ * at infinity.
+ */
+static void
+p384_mul(p384_jacobian *P, const unsigned char *x, size_t xlen)
+{
+	/*
+	 * qz is a flag that is initially 1, and remains equal to 1
+	 * as long as the point is the point at infinity.
+	 *
+	 * We use a 2-bit window to handle multiplier bits by pairs.
+	 * The precomputed window really is the points P2 and P3.
+	 */
+	uint32_t qz;
+	p384_jacobian P2, P3, Q, T, U;
+
+	/*
+	 * Compute window values.
+	 */
+	P2 = *P;
+	p384_double(&P2);
+	P3 = *P;
+	p384_add(&P3, &P2);
+
+	/*
+	 * We start with Q = 0. We process multiplier bits 2 by 2.
+	 */
+	memset(&Q, 0, sizeof Q);
+	qz = 1;
+	while (xlen -- > 0) {
+		int k;
+
+		for (k = 6; k >= 0; k -= 2) {
+			uint32_t bits;
+			uint32_t bnz;
+
+			p384_double(&Q);
+			p384_double(&Q);
+			T = *P;
+			U = Q;
+			bits = (*x >> k) & (uint32_t)3;
+			bnz = NEQ(bits, 0);
+			CCOPY(EQ(bits, 2), &T, &P2, sizeof T);
+			CCOPY(EQ(bits, 3), &T, &P3, sizeof T);
+			p384_add(&U, &T);
+			CCOPY(bnz & qz, &Q, &T, sizeof Q);
+			CCOPY(bnz & ~qz, &Q, &U, sizeof Q);
+			qz &= ~bnz;
+		}
+		x ++;
+	}
+	*P = Q;
+}
+
+
+/*
+ * Precomputed window: k*G points, where G is the curve generator, and k
+ * is an integer from 1 to 15 (inclusive). The X and Y coordinates of
+ * the point are encoded as 13 words of 30 bits each (little-endian
+ * order).
+ */
+static const uint32_t Gwin[15][26] = {
+
+	{ 0x32760AB7, 0x295178E1, 0x355296C3, 0x00BC976F,
+	  0x142A3855, 0x1D078209, 0x39B9859F, 0x0ED8A2E9,
+	  0x2D746E1D, 0x1C7BCC82, 0x1378EB1C, 0x08AFA2C1,
+	  0x00AA87CA, 0x10EA0E5F, 0x290C75F2, 0x17E819D7,
+	  0x182C7387, 0x30B8C00A, 0x28C44ED7, 0x2147CE9D,
+	  0x076F4A26, 0x1C29F8F4, 0x22FE4A4B, 0x06F5D9E9,
+	  0x12A5898B, 0x003617DE },
+
+	{ 0x1295DF61, 0x2E5AA71D, 0x20E64F85, 0x383A1BAF,
+	  0x396E9E4F, 0x081F467E, 0x034D651D, 0x165669BD,
+	  0x17F08902, 0x0117156E, 0x2D969260, 0x015EE8F4,
+	  0x0008D999, 0x0A940E80, 0x054079C0, 0x139E22D6,
+	  0x3F50FA53, 0x2AB4255F, 0x39417C95, 0x0C43E904,
+	  0x361D6F1B, 0x3A74B275, 0x237FF5B6, 0x0EDB7BFE,
+	  0x3E96C6CF, 0x008E80F1 },
+
+	{ 0x0500C831, 0x0B5F971C, 0x026580D0, 0x022EEB94,
+	  0x166DA6B4, 0x13C9034D, 0x1CD06BEA, 0x0E44080B,
+	  0x3D98CB9D, 0x31F97F71, 0x21464793, 0x35181BFE,
+	  0x00077A41, 0x0A2F1DF1, 0x197CA180, 0x0B5D298B,
+	  0x12AF5AF9, 0x111EACC2, 0x21303B70, 0x15AA5F76,
+	  0x2D072144, 0x3C998520, 0x3A580AA7, 0x2837D0BB,
+	  0x3282C310, 0x00C995F7 },
+
+	{ 0x063E1835, 0x07BF58C7, 0x23A5120E, 0x2268565F,
+	  0x1CFC9D15, 0x3722B547, 0x0A0ACA55, 0x026F42D3,
+	  0x1DEB97E7, 0x2B65DCC8, 0x298C1C8A, 0x3354AB24,
+	  0x00138251, 0x3270ED67, 0x127C700A, 0x3BBA5695,
+	  0x1CE1EF8D, 0x2AA4DCED, 0x398F3DE4, 0x009F3AB0,
+	  0x176462AF, 0x16616DC4, 0x0A0606AD, 0x21631E8A,
+	  0x261A698B, 0x00CACAE2 },
+
+	{ 0x036D84BC, 0x2AF36F0E, 0x0A297E60, 0x220BD287,
+	  0x2583B037, 0x19872F95, 0x18FC54F6, 0x39476FFE,
+	  0x2467F208, 0x317A8097, 0x377573CA, 0x28B09471,
+	  0x0011DE24, 0x26C1713A, 0x211052AF, 0x2E8FB331,
+	  0x1DDA1B42, 0x101AEB31, 0x2194CEDA, 0x1DEE88C9,
+	  0x111DD535, 0x27C5284B, 0x1FA42803, 0x12D0F583,
+	  0x31DD103E, 0x008FA696 },
+
+	{ 0x0E35C5DF, 0x24DFC215, 0x2FF30E50, 0x0C5F5C80,
+	  0x17383021, 0x3507C989, 0x35DA51CB, 0x2F2EDFC3,
+	  0x15D3C33E, 0x0349BCB4, 0x2B2226FE, 0x2B341934,
+	  0x00627BE1, 0x13F0F934, 0x1CCE9023, 0x0E165311,
+	  0x3116E361, 0x15441604, 0x193D84DC, 0x3774C998,
+	  0x14D49913, 0x1575B2C9, 0x369B053C, 0x1C21BE6D,
+	  0x132CFE2C, 0x0009766A },
+
+	{ 0x0FB6D0E1, 0x103C16D2, 0x1B9EBB20, 0x01549BD5,
+	  0x3B1C508B, 0x233277E9, 0x25FFA2D5, 0x3A65FEFA,
+	  0x1FFEAD6F, 0x3AFC8D3B, 0x388F29F8, 0x1CD97391,
+	  0x00283C1D, 0x0512EF8C, 0x1199336B, 0x2A78F9E6,
+	  0x3613B78C, 0x3D225630, 0x24B34076, 0x19729D9C,
+	  0x3619FB5E, 0x10471A61, 0x3F6E305A, 0x388BA52E,
+	  0x24187906, 0x009475C9 },
+
+	{ 0x1822C87D, 0x1BA6C9A7, 0x003D5ECE, 0x0C9635BD,
+	  0x2F11FB5A, 0x30F1CC95, 0x0190A900, 0x089FEF96,
+	  0x383445BF, 0x0A5E9BE8, 0x0BE75114, 0x23A965B8,
+	  0x00169277, 0x022B0AD2, 0x3DAAFE90, 0x1D1708D6,
+	  0x2B787A73, 0x0EEC196B, 0x30C30BB0, 0x21CD4BD1,
+	  0x12B71B54, 0x3D0E2255, 0x22E8F6E3, 0x06A83538,
+	  0x15C03504, 0x00DCD236 },
+
+	{ 0x1079118B, 0x31579118, 0x2E2B9535, 0x2214A2FF,
+	  0x3B6E21C3, 0x2C7B8A17, 0x3D3BAC6C, 0x3DCA479B,
+	  0x378F2216, 0x26E2C096, 0x33EF1BF2, 0x290126F2,
+	  0x008F0A39, 0x2C664AF8, 0x18B693E6, 0x3D51B682,
+	  0x1D0FBFB7, 0x19B3029E, 0x1E2152BB, 0x000C6B76,
+	  0x0F5F28F1, 0x29799A9B, 0x294C8B0E, 0x1D6452C4,
+	  0x050E2D80, 0x0062C77E },
+
+	{ 0x186658FB, 0x272CB44C, 0x07BF91AA, 0x23A16AD4,
+	  0x1238CCED, 0x3570A4A4, 0x39E88931, 0x0B642DE6,
+	  0x1E864F37, 0x275BBD3F, 0x2EC678D2, 0x158EF59F,
+	  0x00A669C5, 0x373A21DD, 0x1DE13DAA, 0x08288D99,
+	  0x1B606549, 0x3705A829, 0x0B7DE30E, 0x03C31C50,
+	  0x06554306, 0x2CDDF701, 0x20F6D7C3, 0x39F22D90,
+	  0x0AB9F049, 0x00A988B7 },
+
+	{ 0x15B4DDD8, 0x18D5BCED, 0x2FB81D62, 0x126D9B8E,
+	  0x2D3F8C47, 0x27F45224, 0x3C37456C, 0x0D7B560D,
+	  0x16C57FE9, 0x3B0A4120, 0x198DA1EE, 0x389F69EE,
+	  0x00099056, 0x38C5E0BB, 0x3576EA04, 0x3AAFF357,
+	  0x19B54498, 0x12A32554, 0x3E4FD06D, 0x363FD43F,
+	  0x3BB637F0, 0x20396FC4, 0x15512B17, 0x39668850,
+	  0x08D38C2A, 0x002E4C0C },
+
+	{ 0x3D2A7022, 0x1B68BA9D, 0x2817CB46, 0x129788B6,
+	  0x081406DA, 0x2BC9A469, 0x10E21648, 0x357907DB,
+	  0x03D08C2E, 0x108773DA, 0x289AB3AC, 0x0D26F524,
+	  0x00952A7A, 0x221BD16E, 0x3BDAEB33, 0x1743E229,
+	  0x06A99162, 0x16B50D03, 0x0A2C2586, 0x0A0EBB90,
+	  0x200DB386, 0x2F2E09FB, 0x37AB9BD9, 0x00563052,
+	  0x2BE12D6F, 0x00A0320F },
+
+	{ 0x3B5CBCE7, 0x2BC72878, 0x3D99F1BA, 0x397D106A,
+	  0x311C139E, 0x1EF347C3, 0x3873F626, 0x2FFE7C07,
+	  0x06AB9632, 0x1400BFF3, 0x25BAFDAF, 0x25ED9EBA,
+	  0x00A567BA, 0x36F429CC, 0x108E849C, 0x2218A7D6,
+	  0x1AF2E09C, 0x057D6677, 0x0A6F815E, 0x32EC0863,
+	  0x165411A4, 0x0ECC5185, 0x051EBC59, 0x318644E4,
+	  0x2CE627CC, 0x00DE1B38 },
+
+	{ 0x30F59EA0, 0x1C826B33, 0x002DE663, 0x2AE8936F,
+	  0x1CCA2C41, 0x1507AD94, 0x27DC95DE, 0x077FF48F,
+	  0x12B0877B, 0x31206E27, 0x2396BBEA, 0x13513EF0,
+	  0x00E8C8F9, 0x1B67B888, 0x1FB97278, 0x109DE22D,
+	  0x11A2E815, 0x1D0F48FC, 0x06504E82, 0x28D79C83,
+	  0x186479DC, 0x08A933B8, 0x2FDB794B, 0x2E0932BC,
+	  0x10D5BF22, 0x00891AE4 },
+
+	{ 0x1606860B, 0x2E21C06A, 0x0B6383B4, 0x12555E84,
+	  0x3C4E9CA8, 0x07E7DF69, 0x01C205B2, 0x1055BFFC,
+	  0x125522A9, 0x3047604D, 0x1058CC15, 0x322CCAC0,
+	  0x00B3D13F, 0x33F7BD62, 0x21756234, 0x284AF509,
+	  0x23493E2C, 0x1FBFD983, 0x04450DCF, 0x09AF484D,
+	  0x3128475D, 0x0B1BEEBA, 0x2C94D859, 0x2A61B049,
+	  0x39F7E458, 0x00152919 }
+};
+
+/*
+ * Lookup one of the Gwin[] values, by index. This is constant-time.
+ */
+static void
+lookup_Gwin(p384_jacobian *T, uint32_t idx)
+{
+	uint32_t xy[26];
+	uint32_t k;
+	size_t u;
+
+	memset(xy, 0, sizeof xy);
+	for (k = 0; k < 15; k ++) {
+		uint32_t m;
+
+		m = -EQ(idx, k + 1);
+		for (u = 0; u < 26; u ++) {
+			xy[u] |= m & Gwin[k][u];
+		}
+	}
+	memcpy(T->x, &xy[0], sizeof T->x);
+	memcpy(T->y, &xy[13], sizeof T->y);
+	memset(T->z, 0, sizeof T->z);
+	T->z[0] = 1;
+}
+
+/*
+ * Multiply the generator by an integer. The integer is assumed non-zero
+ * and lower than the curve order.
+ */
+static void
+p384_mulgen(p384_jacobian *P, const unsigned char *x, size_t xlen)
+{
+	/*
+	 * qz is a flag that is initially 1, and remains equal to 1
+	 * as long as the point is the point at infinity.
+	 *
+	 * We use a 4-bit window to handle multiplier bits by groups
+	 * of 4. The precomputed window is constant static data, with
+	 * points in affine coordinates; we use a constant-time lookup.
+	 */
+	p384_jacobian Q;
+	uint32_t qz;
+
+	memset(&Q, 0, sizeof Q);
+	qz = 1;
+	while (xlen -- > 0) {
+		int k;
+		unsigned bx;
+
+		bx = *x ++;
+		for (k = 0; k < 2; k ++) {
+			uint32_t bits;
+			uint32_t bnz;
+			p384_jacobian T, U;
+
+			p384_double(&Q);
+			p384_double(&Q);
+			p384_double(&Q);
+			p384_double(&Q);
+			bits = (bx >> 4) & 0x0F;
+			bnz = NEQ(bits, 0);
+			lookup_Gwin(&T, bits);
+			U = Q;
+			p384_add_mixed(&U, &T);
+			CCOPY(bnz & qz, &Q, &T, sizeof Q);
+			CCOPY(bnz & ~qz, &Q, &U, sizeof Q);
+			qz &= ~bnz;
+			bx <<= 4;
+		}
+	}
+	*P = Q;
+}
+
+static const unsigned char P384_G[] = {
+	0x04, 0xAA, 0x87, 0xCA, 0x22, 0xBE, 0x8B, 0x05, 0x37, 0x8E,
+	0xB1, 0xC7, 0x1E, 0xF3, 0x20, 0xAD, 0x74, 0x6E, 0x1D, 0x3B,
+	0x62, 0x8B, 0xA7, 0x9B, 0x98, 0x59, 0xF7, 0x41, 0xE0, 0x82,
+	0x54, 0x2A, 0x38, 0x55, 0x02, 0xF2, 0x5D, 0xBF, 0x55, 0x29,
+	0x6C, 0x3A, 0x54, 0x5E, 0x38, 0x72, 0x76, 0x0A, 0xB7, 0x36,
+	0x17, 0xDE, 0x4A, 0x96, 0x26, 0x2C, 0x6F, 0x5D, 0x9E, 0x98,
+	0xBF, 0x92, 0x92, 0xDC, 0x29, 0xF8, 0xF4, 0x1D, 0xBD, 0x28,
+	0x9A, 0x14, 0x7C, 0xE9, 0xDA, 0x31, 0x13, 0xB5, 0xF0, 0xB8,
+	0xC0, 0x0A, 0x60, 0xB1, 0xCE, 0x1D, 0x7E, 0x81, 0x9D, 0x7A,
+	0x43, 0x1D, 0x7C, 0x90, 0xEA, 0x0E, 0x5F
+};
+
+static const unsigned char P384_N[] = {
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x63, 0x4D, 0x81, 0xF4, 0x37,
+	0x2D, 0xDF, 0x58, 0x1A, 0x0D, 0xB2, 0x48, 0xB0, 0xA7, 0x7A,
+	0xEC, 0xEC, 0x19, 0x6A, 0xCC, 0xC5, 0x29, 0x73
+};
+
+static const unsigned char *
+api_generator(int curve, size_t *len)
+{
+	(void)curve;
+	*len = sizeof P384_G;
+	return P384_G;
+}
+
+static const unsigned char *
+api_order(int curve, size_t *len)
+{
+	(void)curve;
+	*len = sizeof P384_N;
+	return P384_N;
+}
+
+static size_t
+api_xoff(int curve, size_t *len)
+{
+	(void)curve;
+	*len = 48;
+	return 1;
+}
+
+static uint32_t
+api_mul(unsigned char *G, size_t Glen,
+	const unsigned char *x, size_t xlen, int curve)
+{
+	uint32_t r;
+	p384_jacobian P;
+
+	(void)curve;
+	r = p384_decode(&P, G, Glen);
+	p384_mul(&P, x, xlen);
+	if (Glen >= 97) {
+		p384_to_affine(&P);
+		p384_encode(G, &P);
+	}
+	return r;
+}
+
+static size_t
+api_mulgen(unsigned char *R,
+	const unsigned char *x, size_t xlen, int curve)
+{
+	p384_jacobian P;
+
+	(void)curve;
+	p384_mulgen(&P, x, xlen);
+	p384_to_affine(&P);
+	p384_encode(R, &P);
+	return 97;
+}
+
+static uint32_t
+api_muladd(unsigned char *A, const unsigned char *B, size_t len,
+	const unsigned char *x, size_t xlen,
+	const unsigned char *y, size_t ylen, int curve)
+{
+	p384_jacobian P, Q;
+	uint32_t r, t, z;
+	int i;
+
+	(void)curve;
+	r = p384_decode(&P, A, len);
+	p384_mul(&P, x, xlen);
+	if (B == NULL) {
+		p384_mulgen(&Q, y, ylen);
+	} else {
+		r &= p384_decode(&Q, B, len);
+		p384_mul(&Q, y, ylen);
+	}
+
+	/*
+	 * The final addition may fail in case both points are equal.
+	 */
+	t = p384_add(&P, &Q);
+	reduce_final_f384(P.z);
+	z = 0;
+	for (i = 0; i < 13; i ++) {
+		z |= P.z[i];
+	}
+	z = EQ(z, 0);
+	p384_double(&Q);
+
+	/*
+	 * If z is 1 then either P+Q = 0 (t = 1) or P = Q (t = 0). So we
+	 * have the following:
+	 *
+	 *   z = 0, t = 0   return P (normal addition)
+	 *   z = 0, t = 1   return P (normal addition)
+	 *   z = 1, t = 0   return Q (a 'double' case)
+	 *   z = 1, t = 1   report an error (P+Q = 0)
+	 */
+	CCOPY(z & ~t, &P, &Q, sizeof Q);
+	p384_to_affine(&P);
+	p384_encode(A, &P);
+	r &= ~(z & t);
+	return r;
+}
+
+/* see bearssl_ec.h */
+const br_ec_impl br_ec_p384_m31 = {
+	(uint32_t)0x01000000,
+	&api_generator,
+	&api_order,
+	&api_xoff,
+	&api_mul,
+	&api_mulgen,
+	&api_muladd
+};
@@ -604,6 +604,73 @@ point_mul(jacobian *P, const unsigned char *x, size_t xlen,
  * the point at infinity. If the point is invalid then this returns 0, but
  * the coordinates are still set to properly formed field elements.
  */
+#ifdef ARDUINO
+/*
+ * Compute x*P+y*Q into P with a single ladder over both multipliers
+ * (Shamir's trick): each bit costs one doubling and one addition with
+ * P, Q or P+Q, whereas two separate point_mul() calls cost two doublings
+ * and one addition per bit pair, for each multiplier.
+ *
+ * Returned value is 1 on success. It is 0 if an addition in the ladder
+ * had equal or opposite operands, which the addition code cannot
+ * handle; this requires P and Q to be linked by a small known factor,
+ * or x*P+y*Q = 0. The caller should then use two separate multiplications.
+ */
+static uint32_t
+point_muladd(jacobian *P, const jacobian *Q,
+	const unsigned char *x, size_t xlen,
+	const unsigned char *y, size_t ylen, const curve_params *cc)
+{
+	uint32_t qz, sz, ok, t, z;
+	size_t u, len;
+	jacobian S, R, T, U;
+
+	/*
+	 * Precompute S = P+Q. If P = Q, we must double instead; if
+	 * P = -Q, then S is infinity and sz is set, so that the
+	 * ladder skips the addition for that bit combination.
+	 */
+	memcpy(&S, P, sizeof S);
+	t = point_add(&S, Q, cc);
+	z = br_i31_iszero(S.c[2]);
+	memcpy(&T, Q, sizeof T);
+	point_double(&T, cc);
+	CCOPY(z & ~t, &S, &T, sizeof S);
+	sz = z & t;
+
+	point_zero(&R, cc);
+	qz = 1;
+	ok = 1;
+	len = xlen > ylen ? xlen : ylen;
+	for (u = 0; u < len; u ++) {
+		unsigned bx, by;
+		int k;
+
+		bx = (u + xlen >= len) ? x[u + xlen - len] : 0;
+		by = (u + ylen >= len) ? y[u + ylen - len] : 0;
+		for (k = 7; k >= 0; k --) {
+			uint32_t bits;
+			uint32_t bnz;
+
+			point_double(&R, cc);
+			bits = ((bx >> k) & 1) | (((by >> k) & 1) << 1);
+			memcpy(&T, P, sizeof T);
+			CCOPY(EQ(bits, 2), &T, Q, sizeof T);
+			CCOPY(EQ(bits, 3), &T, &S, sizeof T);
+			bnz = NEQ(bits, 0) & ~(EQ(bits, 3) & sz);
+			memcpy(&U, &R, sizeof U);
+			point_add(&U, &T, cc);
+			ok &= ~(bnz & ~qz & br_i31_iszero(U.c[2]));
+			CCOPY(bnz & qz, &R, &T, sizeof R);
+			CCOPY(bnz & ~qz, &R, &U, sizeof R);
+			qz &= ~bnz;
+		}
+	}
+	memcpy(P, &R, sizeof R);
+	return ok & ~qz;
+}
+#endif
+
 static uint32_t
 point_decode(jacobian *P, const void *src, size_t len, const curve_params *cc)
 {
@@ -776,6 +843,17 @@ api_muladd(unsigned char *A, const unsigned char *B, size_t len,
 		B = api_generator(curve, &Glen);
 	}
 	r &= point_decode(&Q, B, len, cc);
+#ifdef ARDUINO
+	{
+		jacobian T;
+
+		memcpy(&T, &P, sizeof T);
+		if (point_muladd(&T, &Q, x, xlen, y, ylen, cc)) {
+			point_encode(A, &T, cc);
+			return r;
+		}
+	}
+#endif
 	point_mul(&P, x, xlen, cc);
 	point_mul(&Q, y, ylen, cc);
 
@@ -27,12 +27,21 @@
 #define I15_LEN     ((BR_MAX_EC_SIZE + 29) / 15)
 #define POINT_LEN   (1 + (((BR_MAX_EC_SIZE + 7) >> 3) << 1))
 
-/* see bearssl_ec.h */
-uint32_t
-br_ecdsa_i15_vrfy_raw(const br_ec_impl *impl,
+/*
+ * Work area: five integers, then tx[], ty[] and eU[].
+ */
+#define TLEN        (5 * I15_LEN \
+	+ ((((BR_MAX_EC_SIZE + 7) >> 2) + POINT_LEN + 1) >> 1))
+
+#if BR_STATIC_SCRATCH && (TLEN + 1) / 2 > BR_SCRATCH_WORDS
+#error br_scratch[] is too small for the ECDSA work area
+#endif
+
+static uint32_t
+ecdsa_vrfy_raw(const br_ec_impl *impl,
 	const void *hash, size_t hash_len,
 	const br_ec_public_key *pk,
-	const void *sig, size_t sig_len)
+	const void *sig, size_t sig_len, uint16_t *tmp)
 {
 	/*
 	 * IMPORTANT: this code is fit only for curves with a prime
@@ -40,14 +49,21 @@ br_ecdsa_i15_vrfy_raw(const br_ec_impl *impl,
 	 * coordinate of a point can be done with a simple subtraction.
 	 */
 	const br_ec_curve_def *cd;
-	uint16_t n[I15_LEN], r[I15_LEN], s[I15_LEN], t1[I15_LEN], t2[I15_LEN];
-	unsigned char tx[(BR_MAX_EC_SIZE + 7) >> 3];
-	unsigned char ty[(BR_MAX_EC_SIZE + 7) >> 3];
-	unsigned char eU[POINT_LEN];
+	uint16_t *n, *r, *s, *t1, *t2;
+	unsigned char *tx, *ty, *eU;
 	size_t nlen, rlen, ulen;
 	uint16_t n0i;
 	uint32_t res;
 
+	n = tmp;
+	r = n + I15_LEN;
+	s = r + I15_LEN;
+	t1 = s + I15_LEN;
+	t2 = t1 + I15_LEN;
+	tx = (unsigned char *)(t2 + I15_LEN);
+	ty = tx + ((BR_MAX_EC_SIZE + 7) >> 3);
+	eU = ty + ((BR_MAX_EC_SIZE + 7) >> 3);
+
 	/*
 	 * If the curve is not supported, then report an error.
 	 */
@@ -164,3 +180,25 @@ br_ecdsa_i15_vrfy_raw(const br_ec_impl *impl,
 	res &= br_i15_iszero(t1);
 	return res;
 }
+
+/* see bearssl_ec.h */
+uint32_t
+br_ecdsa_i15_vrfy_raw(const br_ec_impl *impl,
+	const void *hash, size_t hash_len,
+	const br_ec_public_key *pk,
+	const void *sig, size_t sig_len)
+{
+#if BR_STATIC_SCRATCH
+	uint32_t r;
+
+	br_scratch_acquire();
+	r = ecdsa_vrfy_raw(impl, hash, hash_len, pk, sig, sig_len,
+		(uint16_t *)br_scratch);
+	br_scratch_release();
+	return r;
+#else
+	uint16_t tmp[TLEN];
+
+	return ecdsa_vrfy_raw(impl, hash, hash_len, pk, sig, sig_len, tmp);
+#endif
+}
@@ -27,12 +27,21 @@
 #define I31_LEN     ((BR_MAX_EC_SIZE + 61) / 31)
 #define POINT_LEN   (1 + (((BR_MAX_EC_SIZE + 7) >> 3) << 1))
 
-/* see bearssl_ec.h */
-uint32_t
-br_ecdsa_i31_vrfy_raw(const br_ec_impl *impl,
+/*
+ * Work area: five integers, then tx[], ty[] and eU[].
+ */
+#define TLEN        (5 * I31_LEN \
+	+ ((((BR_MAX_EC_SIZE + 7) >> 2) + POINT_LEN + 3) >> 2))
+
+#if BR_STATIC_SCRATCH && TLEN > BR_SCRATCH_WORDS
+#error br_scratch[] is too small for the ECDSA work area
+#endif
+
+static uint32_t
+ecdsa_vrfy_raw(const br_ec_impl *impl,
 	const void *hash, size_t hash_len,
 	const br_ec_public_key *pk,
-	const void *sig, size_t sig_len)
+	const void *sig, size_t sig_len, uint32_t *tmp)
 {
 	/*
 	 * IMPORTANT: this code is fit only for curves with a prime
@@ -40,13 +49,20 @@ br_ecdsa_i31_vrfy_raw(const br_ec_impl *impl,
 	 * coordinate of a point can be done with a simple subtraction.
 	 */
 	const br_ec_curve_def *cd;
-	uint32_t n[I31_LEN], r[I31_LEN], s[I31_LEN], t1[I31_LEN], t2[I31_LEN];
-	unsigned char tx[(BR_MAX_EC_SIZE + 7) >> 3];
-	unsigned char ty[(BR_MAX_EC_SIZE + 7) >> 3];
-	unsigned char eU[POINT_LEN];
+	uint32_t *n, *r, *s, *t1, *t2;
+	unsigned char *tx, *ty, *eU;
 	size_t nlen, rlen, ulen;
 	uint32_t n0i, res;
 
+	n = tmp;
+	r = n + I31_LEN;
+	s = r + I31_LEN;
+	t1 = s + I31_LEN;
+	t2 = t1 + I31_LEN;
+	tx = (unsigned char *)(t2 + I31_LEN);
+	ty = tx + ((BR_MAX_EC_SIZE + 7) >> 3);
+	eU = ty + ((BR_MAX_EC_SIZE + 7) >> 3);
+
 	/*
 	 * If the curve is not supported, then report an error.
 	 */
@@ -163,3 +179,25 @@ br_ecdsa_i31_vrfy_raw(const br_ec_impl *impl,
 	res &= br_i31_iszero(t1);
 	return res;
 }
+
+/* see bearssl_ec.h */
+uint32_t
+br_ecdsa_i31_vrfy_raw(const br_ec_impl *impl,
+	const void *hash, size_t hash_len,
+	const br_ec_public_key *pk,
+	const void *sig, size_t sig_len)
+{
+#if BR_STATIC_SCRATCH
+	uint32_t r;
+
+	br_scratch_acquire();
+	r = ecdsa_vrfy_raw(impl, hash, hash_len, pk, sig, sig_len,
+		br_scratch);
+	br_scratch_release();
+	return r;
+#else
+	uint32_t tmp[TLEN];
+
+	return ecdsa_vrfy_raw(impl, hash, hash_len, pk, sig, sig_len, tmp);
+#endif
+}
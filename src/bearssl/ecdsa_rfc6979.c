@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "inner.h"
+
+#ifdef ARDUINO
+
+/* see inner.h */
+void
+br_ecdsa_rfc6979_seed(br_hmac_context *hc, const br_hash_class *hf,
+	const void *x, size_t xlen)
+{
+	br_hmac_key_context kc;
+	unsigned char V[64];
+	size_t hlen;
+
+	/*
+	 * First HMAC of br_hmac_drbg_init(), K = HMAC(K, V || 0x00 || seed)
+	 * with K = 0x00..00 and V = 0x01..01, up to the private key.
+	 */
+	hlen = br_digest_size(hf);
+	memset(V, 0x00, hlen);
+	br_hmac_key_init(&kc, hf, V, hlen);
+	memset(V, 0x01, hlen);
+	br_hmac_init(hc, &kc, 0);
+	br_hmac_update(hc, V, hlen);
+	V[0] = 0x00;
+	br_hmac_update(hc, V, 1);
+	br_hmac_update(hc, x, xlen);
+}
+
+/* see inner.h */
+void
+br_ecdsa_rfc6979_init(br_hmac_drbg_context *drbg,
+	const br_hmac_context *seed, const void *tt, size_t nlen)
+{
+	const br_hash_class *dig;
+	br_hmac_key_context kc;
+	br_hmac_context hc;
+	size_t hlen;
+	unsigned char x;
+
+	dig = br_hmac_get_digest(seed);
+	hlen = br_digest_size(dig);
+	drbg->vtable = &br_hmac_drbg_vtable;
+	drbg->digest_class = dig;
+
+	/*
+	 * 1. K = HMAC(K, V || 0x00 || seed), resumed after the private key.
+	 */
+	hc = *seed;
+	br_hmac_update(&hc, (const unsigned char *)tt + nlen, nlen);
+	br_hmac_out(&hc, drbg->K);
+	br_hmac_key_init(&kc, dig, drbg->K, hlen);
+
+	/*
+	 * 2. V = HMAC(K, V)
+	 */
+	memset(drbg->V, 0x01, hlen);
+	br_hmac_init(&hc, &kc, 0);
+	br_hmac_update(&hc, drbg->V, hlen);
+	br_hmac_out(&hc, drbg->V);
+
+	/*
+	 * 3. K = HMAC(K, V || 0x01 || seed)
+	 */
+	br_hmac_init(&hc, &kc, 0);
+	br_hmac_update(&hc, drbg->V, hlen);
+	x = 0x01;
+	br_hmac_update(&hc, &x, 1);
+	br_hmac_update(&hc, tt, nlen << 1);
+	br_hmac_out(&hc, drbg->K);
+	br_hmac_key_init(&kc, dig, drbg->K, hlen);
+
+	/*
+	 * 4. V = HMAC(K, V)
+	 */
+	br_hmac_init(&hc, &kc, 0);
+	br_hmac_update(&hc, drbg->V, hlen);
+	br_hmac_out(&hc, drbg->V);
+}
+
+/* see bearssl_ec.h */
+uint32_t
+br_ecdsa_sign_precomp_init(br_ecdsa_sign_precomp_key *pk,
+	const br_ec_impl *impl, const br_hash_class *hf,
+	const br_ec_private_key *sk)
+{
+	const br_ec_curve_def *cd;
+	unsigned char tt[(BR_MAX_EC_SIZE + 7) >> 3];
+	const unsigned char *x;
+	size_t xlen, nlen;
+
+	if (((impl->supported_curves >> sk->curve) & 1) == 0) {
+		return 0;
+	}
+	switch (sk->curve) {
+	case BR_EC_secp256r1:
+		cd = &br_secp256r1;
+		break;
+	case BR_EC_secp384r1:
+		cd = &br_secp384r1;
+		break;
+	case BR_EC_secp521r1:
+		cd = &br_secp521r1;
+		break;
+	default:
+		return 0;
+	}
+
+	/*
+	 * The seed starts with the private key over exactly the length
+	 * of the curve order (int2octets). A key that is not lower than
+	 * the order is rejected later on, by the signature functions.
+	 */
+	nlen = cd->order_len;
+	x = sk->x;
+	xlen = sk->xlen;
+	while (xlen > 0 && *x == 0) {
+		x ++;
+		xlen --;
+	}
+	if (xlen == 0 || xlen > nlen) {
+		return 0;
+	}
+	memset(tt, 0, nlen - xlen);
+	memcpy(tt + nlen - xlen, x, xlen);
+
+	pk->impl = impl;
+	pk->sk = sk;
+	br_ecdsa_rfc6979_seed(&pk->seed, hf, tt, nlen);
+	return 1;
+}
+
+#endif
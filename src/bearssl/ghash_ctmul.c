@@ -193,7 +193,7 @@ bmul(uint32_t *hi, uint32_t *lo, uint32_t x, uint32_t y)
 #endif
 
 /* see bearssl_hash.h */
-void
+BR_FAST_FUNC void
 br_ghash_ctmul(void *y, const void *h, const void *data, size_t len)
 {
 	const unsigned char *buf, *hb;
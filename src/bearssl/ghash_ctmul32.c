@@ -92,7 +92,7 @@ rev32(uint32_t x)
 }
 
 /* see bearssl_hash.h */
-void
+BR_FAST_FUNC void
 br_ghash_ctmul32(void *y, const void *h, const void *data, size_t len)
 {
 	/*
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define BR_ENABLE_INTRINSICS   1
+#include "inner.h"
+
+/*
+ * This is the GHASH implementation that leverages the ARMv8 pmull
+ * opcode (64x64->128 carryless multiplication). It follows the same
+ * representation as ghash_pclmul.c: values are byte-swapped into full
+ * big-endian, so that the product only needs a final 1-bit left shift
+ * before the reduction.
+ */
+
+#if BR_ARMV8_CE
+
+/* see bearssl_hash.h */
+br_ghash
+br_ghash_pmull_get(void)
+{
+	return &br_ghash_pmull;
+}
+
+/*
+ * Carryless multiplication of x by y, 128-bit result in (hi,lo).
+ */
+static inline void
+clmul(uint64_t x, uint64_t y, uint64_t *hi, uint64_t *lo)
+{
+	uint64x2_t z;
+
+	z = vreinterpretq_u64_p128(vmull_p64((poly64_t)x, (poly64_t)y));
+	*lo = vgetq_lane_u64(z, 0);
+	*hi = vgetq_lane_u64(z, 1);
+}
+
+/* see bearssl_hash.h */
+void
+br_ghash_pmull(void *y, const void *h, const void *data, size_t len)
+{
+	const unsigned char *buf;
+	uint64_t y0, y1, h0, h1, hx;
+
+	buf = data;
+	y1 = br_dec64be(y);
+	y0 = br_dec64be((unsigned char *)y + 8);
+	h1 = br_dec64be(h);
+	h0 = br_dec64be((const unsigned char *)h + 8);
+	hx = h0 ^ h1;
+	while (len > 0) {
+		const unsigned char *src;
+		unsigned char tmp[16];
+		uint64_t a0, a1, b0, b1, c0, c1;
+		uint64_t z0, z1, z2, z3;
+
+		if (len >= 16) {
+			src = buf;
+			buf += 16;
+			len -= 16;
+		} else {
+			memcpy(tmp, buf, len);
+			memset(tmp + len, 0, (sizeof tmp) - len);
+			src = tmp;
+			len = 0;
+		}
+		y1 ^= br_dec64be(src);
+		y0 ^= br_dec64be(src + 8);
+
+		/*
+		 * Karatsuba: three 64x64 products give the 256-bit
+		 * value z3:z2:z1:z0.
+		 */
+		clmul(y0, h0, &a1, &a0);
+		clmul(y1, h1, &b1, &b0);
+		clmul(y0 ^ y1, hx, &c1, &c0);
+		c0 ^= a0 ^ b0;
+		c1 ^= a1 ^ b1;
+		z0 = a0;
+		z1 = a1 ^ c0;
+		z2 = b0 ^ c1;
+		z3 = b1;
+
+		/*
+		 * Left-shift by 1 bit (bit-reversal correction).
+		 */
+		z3 = (z3 << 1) | (z2 >> 63);
+		z2 = (z2 << 1) | (z1 >> 63);
+		z1 = (z1 << 1) | (z0 >> 63);
+		z0 = z0 << 1;
+
+		/*
+		 * Reduction modulo X^128 + X^7 + X^2 + X + 1, as in
+		 * REDUCE_F128() of ghash_pclmul.c (whose words x0..x3
+		 * are z3..z0 here).
+		 */
+		z2 ^= z0 ^ (z0 >> 1) ^ (z0 >> 2) ^ (z0 >> 7);
+		z1 ^= (z0 << 63) ^ (z0 << 62) ^ (z0 << 57);
+		z3 ^= z1 ^ (z1 >> 1) ^ (z1 >> 2) ^ (z1 >> 7);
+		z2 ^= (z1 << 63) ^ (z1 << 62) ^ (z1 << 57);
+		y1 = z3;
+		y0 = z2;
+	}
+	br_enc64be(y, y1);
+	br_enc64be((unsigned char *)y + 8, y0);
+}
+
+#else
+
+/* see bearssl_hash.h */
+br_ghash
+br_ghash_pmull_get(void)
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "inner.h"
+
+/*
+ * GHASH with 4-bit tables (Shoup's method). For each call, the sixteen
+ * multiples of H by a 4-bit polynomial are computed; each input block
+ * is then multiplied by H one nibble at a time, with a table lookup
+ * and a shift by 4 bits whose reduction uses another small table.
+ *
+ * This is faster than the multiplication based implementations on
+ * cores where multiplications are slow or not constant-time anyway,
+ * but the lookups use secret indices: this is NOT constant-time on a
+ * CPU with a data cache.
+ */
+
+static const uint32_t R4[] = {
+	0x0000, 0x1C20, 0x3840, 0x2460, 0x7080, 0x6CA0, 0x48C0, 0x54E0,
+	0xE100, 0xFD20, 0xD940, 0xC560, 0x9180, 0x8DA0, 0xA9C0, 0xB5E0
+};
+
+/* see bearssl_hash.h */
+void
+br_ghash_tab4(void *y, const void *h, const void *data, size_t len)
+{
+	const unsigned char *buf;
+	unsigned char *yb;
+	uint64_t hh[16], hl[16];
+	uint64_t vh, vl;
+	int i, j;
+
+	buf = data;
+	yb = y;
+
+	/*
+	 * Entry 8 is H itself (bit order is reversed in GHASH, so the
+	 * nibble value 8 stands for the polynomial 1); entries 4, 2
+	 * and 1 are H multiplied by x, x^2 and x^3.
+	 */
+	vh = br_dec64be(h);
+	vl = br_dec64be((const unsigned char *)h + 8);
+	hh[0] = 0;
+	hl[0] = 0;
+	hh[8] = vh;
+	hl[8] = vl;
+	for (i = 4; i > 0; i >>= 1) {
+		uint64_t t;
+
+		t = -(vl & 1) & ((uint64_t)0xE1000000 << 32);
+		vl = (vh << 63) | (vl >> 1);
+		vh = (vh >> 1) ^ t;
+		hh[i] = vh;
+		hl[i] = vl;
+	}
+	for (i = 2; i <= 8; i <<= 1) {
+		for (j = 1; j < i; j ++) {
+			hh[i + j] = hh[i] ^ hh[j];
+			hl[i + j] = hl[i] ^ hl[j];
+		}
+	}
+
+	while (len > 0) {
+		unsigned char x[16];
+		const unsigned char *src;
+		uint64_t zh, zl;
+		unsigned lo, hi, rem;
+
+		if (len >= 16) {
+			src = buf;
+			buf += 16;
+			len -= 16;
+		} else {
+			memcpy(x, buf, len);
+			memset(x + len, 0, (sizeof x) - len);
+			src = x;
+			len = 0;
+		}
+		for (i = 0; i < 16; i ++) {
+			x[i] = yb[i] ^ src[i];
+		}
+
+		lo = x[15] & 0x0F;
+		zh = hh[lo];
+		zl = hl[lo];
+		for (i = 15; i >= 0; i --) {
+			lo = x[i] & 0x0F;
+			hi = x[i] >> 4;
+			if (i != 15) {
+				rem = (unsigned)zl & 0x0F;
+				zl = (zh << 60) | (zl >> 4);
+				zh = (zh >> 4) ^ ((uint64_t)R4[rem] << 48);
+				zh ^= hh[lo];
+				zl ^= hl[lo];
+			}
+			rem = (unsigned)zl & 0x0F;
+			zl = (zh << 60) | (zl >> 4);
+			zh = (zh >> 4) ^ ((uint64_t)R4[rem] << 48);
+			zh ^= hh[hi];
+			zl ^= hl[hi];
+		}
+		br_enc64be(yb, zh);
+		br_enc64be(yb + 8, zl);
+	}
+}
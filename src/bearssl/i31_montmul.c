@@ -24,16 +24,59 @@
 
 #include "inner.h"
 
+#if BR_I31_CORTEXM
+
+/*
+ * One row of the Montgomery multiplication (the inner loop below), for
+ * Cortex-M4/M7. UMAAL adds xu*y[v+1], d[v+1] and the carry in a single
+ * opcode, and UMLAL adds f*m[v+1]; both are constant-time on these cores.
+ * The bounds are those of the C code: the accumulator is below 2^63, so
+ * the returned carry fits on 32 bits. The caller ensures len > 0.
+ */
+static inline uint32_t
+montymul_row(uint32_t *d, const uint32_t *y, const uint32_t *m,
+	uint32_t xu, uint32_t f, size_t len)
+{
+	uint32_t r, lo, t;
+
+	r = 0;
+	__asm__ __volatile__ (
+		"1:\n\t"
+		"ldr    %[lo], [%[d], #4]\n\t"
+		"ldr    %[t], [%[y]], #4\n\t"
+		"umaal  %[lo], %[r], %[xu], %[t]\n\t"
+		"ldr    %[t], [%[m]], #4\n\t"
+		"umlal  %[lo], %[r], %[f], %[t]\n\t"
+		"bic    %[t], %[lo], #0x80000000\n\t"
+		"str    %[t], [%[d]], #4\n\t"
+		"lsr    %[lo], %[lo], #31\n\t"
+		"orr    %[r], %[lo], %[r], lsl #1\n\t"
+		"subs   %[n], %[n], #1\n\t"
+		"bne    1b\n\t"
+		: [r] "+&r" (r), [lo] "=&r" (lo), [t] "=&r" (t),
+		  [d] "+&r" (d), [y] "+&r" (y), [m] "+&r" (m), [n] "+&r" (len)
+		: [xu] "r" (xu), [f] "r" (f)
+		: "cc", "memory");
+	return r;
+}
+
+#endif
+
 /* see inner.h */
 void
 br_i31_montymul(uint32_t *d, const uint32_t *x, const uint32_t *y,
 	const uint32_t *m, uint32_t m0i)
 {
-	size_t len, len4, u, v;
+	size_t len, u;
+#if !BR_I31_CORTEXM
+	size_t len4, v;
+#endif
 	uint64_t dh;
 
 	len = (m[0] + 31) >> 5;
+#if !BR_I31_CORTEXM
 	len4 = len & ~(size_t)3;
+#endif
 	br_i31_zero(d, m[0]);
 	dh = 0;
 	for (u = 0; u < len; u ++) {
@@ -43,6 +86,9 @@ br_i31_montymul(uint32_t *d, const uint32_t *x, const uint32_t *y,
 		xu = x[u + 1];
 		f = MUL31_lo((d[1] + MUL31_lo(x[u + 1], y[1])), m0i);
 
+#if BR_I31_CORTEXM
+		r = montymul_row(d, y + 1, m + 1, xu, f, len);
+#else
 		r = 0;
 		for (v = 0; v < len4; v += 4) {
 			uint64_t z;
@@ -72,6 +118,7 @@ br_i31_montymul(uint32_t *d, const uint32_t *x, const uint32_t *y,
 			r = z >> 31;
 			d[v] = (uint32_t)z & 0x7FFFFFFF;
 		}
+#endif
 
 		zh = dh + r;
 		d[len] = (uint32_t)zh & 0x7FFFFFFF;
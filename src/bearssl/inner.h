@@ -126,6 +126,80 @@
 #endif
 #endif
 
+/*
+ * On ARMv7E-M cores (Cortex-M4 and M7), UMULL and UMLAL are single-cycle
+ * and constant-time, so the field multiplications of ec_p256_m31.c and
+ * ec_c25519_m31.c can use them (in assembly) even though BR_LOMUL is set.
+ */
+#ifndef BR_EC_CORTEXM
+#if BR_ARMEL_CORTEXM_GCC && __thumb2__ && __ARM_FEATURE_DSP
+#define BR_EC_CORTEXM   1
+#endif
+#endif
+
+/*
+ * On the same cores, br_i31_montymul() has an assembly inner loop built
+ * on UMAAL, and the 31-bit RSA, ECDSA and generic EC code is used by
+ * default instead of the 15-bit code.
+ */
+#ifndef BR_I31_CORTEXM
+#define BR_I31_CORTEXM   BR_EC_CORTEXM
+#endif
+
+/*
+ * Number of precomputed generator tables for P-256 (see config.h).
+ */
+#ifndef BR_EC_P256_GEN_TABLE_SIZE
+#define BR_EC_P256_GEN_TABLE_SIZE   1
+#endif
+#if BR_EC_P256_GEN_TABLE_SIZE != 1 && BR_EC_P256_GEN_TABLE_SIZE != 2 \
+	&& BR_EC_P256_GEN_TABLE_SIZE != 4 && BR_EC_P256_GEN_TABLE_SIZE != 8
+#error BR_EC_P256_GEN_TABLE_SIZE must be 1, 2, 4 or 8
+#endif
+
+/*
+ * Exponentiation window for RSA private key operations (see config.h);
+ * 0 keeps the default stack buffers.
+ */
+#ifndef BR_RSA_WINDOW_BITS
+#define BR_RSA_WINDOW_BITS   0
+#endif
+#if BR_RSA_WINDOW_BITS < 0 || BR_RSA_WINDOW_BITS > 5
+#error BR_RSA_WINDOW_BITS must be between 0 and 5
+#endif
+
+/*
+ * Static scratch area for the RSA and ECDSA verification work areas
+ * (see config.h). Its size (in 32-bit words) is that of the largest of
+ * them, the private key work area of rsa_i15_priv.c or rsa_i31_priv.c;
+ * each user checks that its own work area fits.
+ */
+#ifndef BR_STATIC_SCRATCH
+#define BR_STATIC_SCRATCH   0
+#endif
+#if BR_STATIC_SCRATCH
+#if BR_RSA_WINDOW_BITS > 1
+#define BR_SCRATCH_UNITS(u)   ((5 + (1 << BR_RSA_WINDOW_BITS)) * (u))
+#else
+#define BR_SCRATCH_UNITS(u)   (8 * (u))
+#endif
+#define BR_SCRATCH_I31_WORDS \
+	(1 + BR_SCRATCH_UNITS(2 + ((BR_MAX_RSA_FACTOR + 30) / 31)))
+#define BR_SCRATCH_I15_WORDS \
+	((2 + BR_SCRATCH_UNITS(2 + ((BR_MAX_RSA_FACTOR + 14) / 15))) >> 1)
+#define BR_SCRATCH_WORDS   (BR_SCRATCH_I31_WORDS > BR_SCRATCH_I15_WORDS \
+	? BR_SCRATCH_I31_WORDS : BR_SCRATCH_I15_WORDS)
+
+extern uint32_t br_scratch[BR_SCRATCH_WORDS];
+
+/*
+ * Take and give back br_scratch[], through the lock callback set with
+ * br_scratch_set_lock() (if any).
+ */
+void br_scratch_acquire(void);
+void br_scratch_release(void);
+#endif
+
 /*
  * Architecture detection.
  */
@@ -280,6 +354,121 @@
 #endif
 #endif
 
+/*
+ * The AES peripheral (BR_AES_HW) is selected from the Arduino board.
+ */
+#if BR_AES_HW
+#if defined ARDUINO_ARCH_ESP32
+#define BR_AES_HW_ESP32   1
+#elif defined __SAMD51__
+#define BR_AES_HW_SAMD51   1
+#elif defined NRF52 || defined NRF52832_XXAA || defined NRF52840_XXAA
+#define BR_AES_HW_NRF52   1
+#else
+#undef BR_AES_HW
+#define BR_AES_HW   0
+#endif
+#endif
+
+/*
+ * The SHA peripheral (BR_SHA_HW) is selected from the Arduino board.
+ */
+#if BR_SHA_HW
+#if defined ARDUINO_ARCH_ESP32
+#define BR_SHA_HW_ESP32   1
+#elif defined __SAMD51__
+#define BR_SHA_HW_SAMD51   1
+#else
+#undef BR_SHA_HW
+#define BR_SHA_HW   0
+#endif
+#endif
+
+/*
+ * The random number generator (BR_RAND_HW) is selected from the Arduino
+ * board, and used by default.
+ */
+#if defined ARDUINO && !defined BR_RAND_HW
+#define BR_RAND_HW   1
+#endif
+#if BR_RAND_HW
+#if defined ARDUINO_ARCH_ESP32
+#define BR_RAND_HW_ESP32   1
+#elif defined __SAMD51__
+#define BR_RAND_HW_SAMD51   1
+#elif (defined NRF52 || defined NRF52832_XXAA || defined NRF52840_XXAA) \
+	&& !defined SOFTDEVICE_PRESENT
+#define BR_RAND_HW_NRF52   1
+#elif defined ARDUINO_ARCH_RP2040 && !defined PICO_RP2350
+#define BR_RAND_HW_RP2040   1
+#else
+#undef BR_RAND_HW
+#define BR_RAND_HW   0
+#endif
+#endif
+
+/*
+ * With BR_FAST_RAM (see config.h), BR_FAST_FUNC places a function in
+ * the BR_FAST_TEXT_SECTION section, and BR_FAST_TABLE places a table in
+ * the BR_FAST_DATA_SECTION section. The defaults are RAM sections that
+ * the board's linker script already copies at startup; on other boards
+ * (e.g. the Portenta H7, whose ITCM and DTCM are not in the mbed linker
+ * script) the tables go to .data and the code stays in flash, unless
+ * the section names are set to ones that the linker script maps.
+ */
+#ifndef BR_FAST_RAM
+#define BR_FAST_RAM   0
+#endif
+#if BR_FAST_RAM && __GNUC__ && !defined __AVR__
+#if defined ARDUINO_ARCH_ESP32
+#ifndef BR_FAST_TEXT_SECTION
+#define BR_FAST_TEXT_SECTION   ".iram1.br_fast"
+#endif
+#ifndef BR_FAST_DATA_SECTION
+#define BR_FAST_DATA_SECTION   ".dram1.br_fast"
+#endif
+#elif defined ARDUINO_ARCH_RP2040
+#ifndef BR_FAST_TEXT_SECTION
+#define BR_FAST_TEXT_SECTION   ".time_critical.br_fast"
+#endif
+#elif defined __IMXRT1062__
+#ifndef BR_FAST_TEXT_SECTION
+#define BR_FAST_TEXT_SECTION   ".fastrun"
+#endif
+#endif
+#ifndef BR_FAST_DATA_SECTION
+#define BR_FAST_DATA_SECTION   ".data.br_fast"
+#endif
+#ifdef BR_FAST_TEXT_SECTION
+#define BR_FAST_FUNC    __attribute__((section(BR_FAST_TEXT_SECTION)))
+#endif
+#define BR_FAST_TABLE   __attribute__((section(BR_FAST_DATA_SECTION)))
+#endif
+#ifndef BR_FAST_FUNC
+#define BR_FAST_FUNC
+#endif
+#ifndef BR_FAST_TABLE
+#define BR_FAST_TABLE
+#endif
+
+/*
+ * On AVR, constant data is copied to RAM at startup unless it is placed
+ * in program memory, which is read with LPM. BR_FLASH_TABLE places a
+ * table there, and BR_FLASH_BYTE() and BR_FLASH_U32() read its elements;
+ * it is used for the tables of the code that makes sense on 8-bit cores
+ * (AES "small", SHA-1/SHA-256, MD5). Elsewhere they are plain accesses.
+ */
+#if defined __AVR__
+#include <avr/pgmspace.h>
+#define BR_FLASH_TABLE         PROGMEM
+#define BR_FLASH_BYTE(t, i)    pgm_read_byte(&(t)[i])
+#define BR_FLASH_U32(t, i)     pgm_read_dword(&(t)[i])
+#else
+#define BR_FLASH_TABLE
+#define BR_FLASH_BYTE(t, i)    ((t)[i])
+#define BR_FLASH_U32(t, i)     ((t)[i])
+#endif
+
 /*
  * SSE2 intrinsics are available on x86 (32-bit and 64-bit) with
  * GCC 4.4+, Clang 3.7+ and MSC 2005+.
@@ -344,6 +533,21 @@
 #endif
 #endif
 
+#ifdef ARDUINO
+/*
+ * ARMv8 Cryptography Extensions (AES, PMULL, SHA-1 and SHA-256 opcodes)
+ * on little-endian AArch64, e.g. the Cortex-A53 of the Portenta X8. As
+ * for POWER8, we follow the compiler target (e.g. -march=armv8-a+crypto)
+ * rather than trying to detect support at runtime.
+ */
+#ifndef BR_ARMV8_CE
+#if __GNUC__ && __aarch64__ && __AARCH64EL__ && (__ARM_FEATURE_CRYPTO \
+	|| (__ARM_FEATURE_AES && __ARM_FEATURE_SHA2))
+#define BR_ARMV8_CE   1
+#endif
+#endif
+#endif
+
 /*
  * Detect endinanness on POWER8.
  */
@@ -408,6 +612,19 @@
 
 #endif
 
+/*
+ * ARMv7-M and ARMv8-M mainline cores allow unaligned single word and
+ * halfword accesses, but not unaligned LDRD/STRD or LDM/STM, which the
+ * compiler may use for accesses through a uint64_t pointer or to merge
+ * adjacent uint32_t accesses; see BR_ARM_UNALIGNED in config.h.
+ */
+#ifndef BR_ARM_UNALIGNED
+#if (BR_GCC || BR_CLANG) && __ARM_FEATURE_UNALIGNED && __ARMEL__ \
+	&& !BR_LE_UNALIGNED && !BR_BE_UNALIGNED
+#define BR_ARM_UNALIGNED   1
+#endif
+#endif
+
 /*
  * Detect support for an OS-provided time source.
  */
@@ -460,11 +677,49 @@ typedef union {
 	unsigned char b[sizeof(uint64_t)];
 } br_union_u64;
 
+#if BR_ARM_UNALIGNED
+/*
+ * memcpy() with a constant small length tells the compiler about the
+ * possible misalignment, and is compiled to a single LDR(H) or STR(H).
+ */
+static inline uint32_t
+br_arm_load32(const void *src)
+{
+	uint32_t x;
+
+	memcpy(&x, src, sizeof x);
+	return x;
+}
+
+static inline void
+br_arm_store32(void *dst, uint32_t x)
+{
+	memcpy(dst, &x, sizeof x);
+}
+
+static inline uint16_t
+br_arm_load16(const void *src)
+{
+	uint16_t x;
+
+	memcpy(&x, src, sizeof x);
+	return x;
+}
+
+static inline void
+br_arm_store16(void *dst, uint16_t x)
+{
+	memcpy(dst, &x, sizeof x);
+}
+#endif
+
 static inline void
 br_enc16le(void *dst, unsigned x)
 {
 #if BR_LE_UNALIGNED
 	((br_union_u16 *)dst)->u = x;
+#elif BR_ARM_UNALIGNED
+	br_arm_store16(dst, (uint16_t)x);
 #else
 	unsigned char *buf;
 
@@ -479,6 +734,8 @@ br_enc16be(void *dst, unsigned x)
 {
 #if BR_BE_UNALIGNED
 	((br_union_u16 *)dst)->u = x;
+#elif BR_ARM_UNALIGNED
+	br_arm_store16(dst, __builtin_bswap16((uint16_t)x));
 #else
 	unsigned char *buf;
 
@@ -493,6 +750,8 @@ br_dec16le(const void *src)
 {
 #if BR_LE_UNALIGNED
 	return ((const br_union_u16 *)src)->u;
+#elif BR_ARM_UNALIGNED
+	return br_arm_load16(src);
 #else
 	const unsigned char *buf;
 
@@ -506,6 +765,8 @@ br_dec16be(const void *src)
 {
 #if BR_BE_UNALIGNED
 	return ((const br_union_u16 *)src)->u;
+#elif BR_ARM_UNALIGNED
+	return __builtin_bswap16(br_arm_load16(src));
 #else
 	const unsigned char *buf;
 
@@ -519,6 +780,8 @@ br_enc32le(void *dst, uint32_t x)
 {
 #if BR_LE_UNALIGNED
 	((br_union_u32 *)dst)->u = x;
+#elif BR_ARM_UNALIGNED
+	br_arm_store32(dst, x);
 #else
 	unsigned char *buf;
 
@@ -535,6 +798,8 @@ br_enc32be(void *dst, uint32_t x)
 {
 #if BR_BE_UNALIGNED
 	((br_union_u32 *)dst)->u = x;
+#elif BR_ARM_UNALIGNED
+	br_arm_store32(dst, __builtin_bswap32(x));
 #else
 	unsigned char *buf;
 
@@ -551,6 +816,8 @@ br_dec32le(const void *src)
 {
 #if BR_LE_UNALIGNED
 	return ((const br_union_u32 *)src)->u;
+#elif BR_ARM_UNALIGNED
+	return br_arm_load32(src);
 #else
 	const unsigned char *buf;
 
@@ -567,6 +834,8 @@ br_dec32be(const void *src)
 {
 #if BR_BE_UNALIGNED
 	return ((const br_union_u32 *)src)->u;
+#elif BR_ARM_UNALIGNED
+	return __builtin_bswap32(br_arm_load32(src));
 #else
 	const unsigned char *buf;
 
@@ -684,6 +953,17 @@ void br_md5_round(const unsigned char *buf, uint32_t *val);
 void br_sha1_round(const unsigned char *buf, uint32_t *val);
 void br_sha2small_round(const unsigned char *buf, uint32_t *val);
 
+#if BR_SHA_HW
+/*
+ * Process num consecutive 64-byte blocks with the SHA peripheral (see
+ * BR_SHA_HW in config.h); val is updated as by num calls to
+ * br_sha1_round() and br_sha2small_round(), respectively.
+ */
+void br_sha1_hw_blocks(const unsigned char *buf, size_t num, uint32_t *val);
+void br_sha2small_hw_blocks(const unsigned char *buf,
+	size_t num, uint32_t *val);
+#endif
+
 /*
  * The core function for the TLS PRF. It computes
  * P_hash(secret, label + seed), and XORs the result into the dst buffer.
@@ -693,6 +973,14 @@ void br_tls_phash(void *dst, size_t len,
 	const void *secret, size_t secret_len, const char *label,
 	size_t seed_num, const br_tls_prf_seed_chunk *seed);
 
+/*
+ * Same as br_tls_phash(), with the HMAC key schedule of the secret
+ * already computed, so that repeated runs over one secret skip it.
+ */
+void br_tls_phash_keyed(void *dst, size_t len,
+	const br_hmac_key_context *kc, const char *label,
+	size_t seed_num, const br_tls_prf_seed_chunk *seed);
+
 /*
  * Copy all configured hash implementations from a multihash context
  * to another.
@@ -1920,6 +2208,24 @@ int br_aes_pwr8_supported(void);
 unsigned br_aes_pwr8_keysched(unsigned char *skni,
 	const void *key, size_t len);
 
+#ifdef ARDUINO
+/*
+ * AES key schedule for the ARMv8 AES opcodes: (num_rounds + 1) subkeys
+ * of 16 bytes each, in encryption order. Number of rounds is returned.
+ * Key size MUST be 16, 24 or 32 bytes; otherwise, 0 is returned.
+ */
+unsigned br_aes_armv8_keysched_enc(unsigned char *skey,
+	const void *key, size_t len);
+
+/*
+ * AES key schedule for the ARMv8 AES opcodes, in decryption order (for
+ * the equivalent inverse cipher). Number of rounds is returned.
+ * Key size MUST be 16, 24 or 32 bytes; otherwise, 0 is returned.
+ */
+unsigned br_aes_armv8_keysched_dec(unsigned char *skey,
+	const void *key, size_t len);
+#endif
+
 /* ==================================================================== */
 /*
  * RSA.
@@ -1977,6 +2283,23 @@ uint32_t br_rsa_i31_keygen_inner(const br_prng_class **rng,
 	br_rsa_public_key *pk, void *kbuf_pub,
 	unsigned size, uint32_t pubexp, br_i31_modpow_opt_type mp31);
 
+#ifdef ARDUINO
+/*
+ * Number of candidates covered by one br_rsa_keygen_sieve() call.
+ */
+#define BR_RSA_KEYGEN_SIEVE_BITS   512
+
+/*
+ * Sieve for the incremental prime search of the RSA key generators.
+ * The base candidate x is unsigned big-endian (xlen bytes). Bit k of
+ * sv (least significant bit first; BR_RSA_KEYGEN_SIEVE_BITS bits in
+ * total) is set when x + 4*k is a multiple of an odd prime up to 1481,
+ * or when pubexp is one of these primes and divides x + 4*k - 1.
+ */
+void br_rsa_keygen_sieve(unsigned char *sv,
+	const unsigned char *x, size_t xlen, uint32_t pubexp);
+#endif
+
 /* ==================================================================== */
 /*
  * Elliptic curves.
@@ -2007,6 +2330,16 @@ extern const br_ec_curve_def br_secp521r1;
  */
 extern const br_ec_curve_def br_curve25519;
 
+#if BR_EC_CORTEXM
+/*
+ * Product and square of integers of nine 30-bit words, with an 18-word
+ * result, for the 31-bit P-256 and Curve25519 code (Cortex-M4/M7
+ * assembly, see BR_EC_CORTEXM).
+ */
+void br_ec_cortexm_mul9(uint32_t *d, const uint32_t *a, const uint32_t *b);
+void br_ec_cortexm_square9(uint32_t *d, const uint32_t *a);
+#endif
+
 /*
  * Decode some bytes as an i31 integer, with truncation (corresponding
  * to the 'bits2int' operation in RFC 6979). The target ENCODED bit
@@ -2027,6 +2360,22 @@ void br_ecdsa_i31_bits2int(uint32_t *x,
 void br_ecdsa_i15_bits2int(uint16_t *x,
 	const void *src, size_t len, uint32_t ebitlen);
 
+#ifdef ARDUINO
+/*
+ * RFC 6979 HMAC_DRBG keying in two steps: br_ecdsa_rfc6979_seed()
+ * starts the first HMAC of br_hmac_drbg_init() over the private key
+ * 'x' (exactly the length of the curve order), then
+ * br_ecdsa_rfc6979_init() finishes the DRBG initialization from a copy
+ * of that state, for the seed 'tt' (private key and reduced hash value,
+ * 'nlen' bytes each). The result is the one of br_hmac_drbg_init() over
+ * 'tt'.
+ */
+void br_ecdsa_rfc6979_seed(br_hmac_context *hc, const br_hash_class *hf,
+	const void *x, size_t xlen);
+void br_ecdsa_rfc6979_init(br_hmac_drbg_context *drbg,
+	const br_hmac_context *seed, const void *tt, size_t nlen);
+#endif
+
 /* ==================================================================== */
 /*
  * ASN.1 support functions.
@@ -2210,6 +2559,16 @@ br_tls_prf_impl br_ssl_engine_get_PRF(br_ssl_engine_context *cc, int prf_id);
 void br_ssl_engine_compute_master(br_ssl_engine_context *cc,
 	int prf_id, const void *pms, size_t len);
 
+/*
+ * Run the PRF keyed with the master secret into dst (len bytes). With
+ * TLS 1.2, the HMAC key schedule of the master secret is computed on
+ * first use and kept in the engine for the following runs, with the
+ * hash implementation of the multihasher.
+ */
+void br_ssl_engine_prf_master(br_ssl_engine_context *cc, int prf_id,
+	void *dst, size_t len, const char *label,
+	size_t seed_num, const br_tls_prf_seed_chunk *seed);
+
 /*
  * Switch to CBC decryption for incoming records.
  *    cc               the engine context
@@ -2527,6 +2886,96 @@ br_cpuid(uint32_t mask_eax, uint32_t mask_ebx,
 
 #endif
 
+#if BR_ENABLE_INTRINSICS && BR_ARMV8_CE
+
+/*
+ * ARMv8 intrinsics. The Crypto Extensions must be enabled for the whole
+ * compilation (see BR_ARMV8_CE), so there is no target region here.
+ */
+#include <arm_neon.h>
+
+/*
+ * Load the subkeys produced by br_aes_armv8_keysched_enc() or
+ * br_aes_armv8_keysched_dec().
+ */
+static inline void
+br_aes_armv8_load_subkeys(uint8x16_t *sk,
+	const unsigned char *skey, unsigned num_rounds)
+{
+	unsigned u;
+
+	for (u = 0; u <= num_rounds; u ++) {
+		sk[u] = vld1q_u8(skey + (u << 4));
+	}
+}
+
+/*
+ * Encrypt one block. AESE combines AddRoundKey, SubBytes and ShiftRows,
+ * so the last subkey is simply XORed.
+ */
+static inline uint8x16_t
+br_aes_armv8_encrypt_block(const uint8x16_t *sk,
+	unsigned num_rounds, uint8x16_t x)
+{
+	unsigned u;
+
+	for (u = 0; u < num_rounds - 1; u ++) {
+		x = vaesmcq_u8(vaeseq_u8(x, sk[u]));
+	}
+	x = vaeseq_u8(x, sk[num_rounds - 1]);
+	return veorq_u8(x, sk[num_rounds]);
+}
+
+/*
+ * Decrypt one block, with subkeys in decryption order.
+ */
+static inline uint8x16_t
+br_aes_armv8_decrypt_block(const uint8x16_t *sk,
+	unsigned num_rounds, uint8x16_t x)
+{
+	unsigned u;
+
+	for (u = 0; u < num_rounds - 1; u ++) {
+		x = vaesimcq_u8(vaesdq_u8(x, sk[u]));
+	}
+	x = vaesdq_u8(x, sk[num_rounds - 1]);
+	return veorq_u8(x, sk[num_rounds]);
+}
+
+#endif
+
+/* ==================================================================== */
+
+#ifdef ARDUINO
+/*
+ * Profiling counters of the record protection and of the X.509
+ * signature checks. With BEAR_SSL_CRYPTO_STATS they are kept by
+ * ArduinoBearSSL.cpp (see ArduinoBearSSLClass::cryptoStats(), which
+ * uses the same order); otherwise the macros compile to nothing.
+ * BR_CRYPTO_STAT_END() adds one operation on len bytes, with the cycles
+ * elapsed since the last BR_CRYPTO_STAT_BEGIN(): the measured
+ * operations never nest.
+ */
+#define BR_CRYPTO_OP_GCM_ENCRYPT      0
+#define BR_CRYPTO_OP_GCM_DECRYPT      1
+#define BR_CRYPTO_OP_CHAPOL_ENCRYPT   2
+#define BR_CRYPTO_OP_CHAPOL_DECRYPT   3
+#define BR_CRYPTO_OP_CBC_ENCRYPT      4
+#define BR_CRYPTO_OP_CBC_DECRYPT      5
+#define BR_CRYPTO_OP_X509_VERIFY      6
+
+#ifdef BEAR_SSL_CRYPTO_STATS
+void br_crypto_stat_begin(void);
+void br_crypto_stat_end(int op, size_t len);
+
+#define BR_CRYPTO_STAT_BEGIN()          br_crypto_stat_begin()
+#define BR_CRYPTO_STAT_END(op, len)     br_crypto_stat_end(op, len)
+#else
+#define BR_CRYPTO_STAT_BEGIN()          ((void)0)
+#define BR_CRYPTO_STAT_END(op, len)     ((void)0)
+#endif
+
 /* ==================================================================== */
+#endif
 
 #endif
@@ -36,7 +36,7 @@ const uint32_t br_md5_IV[4] = {
 	0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476
 };
 
-static const uint32_t K[64] = {
+static const uint32_t K[64] BR_FLASH_TABLE = {
 	0xD76AA478, 0xE8C7B756, 0x242070DB, 0xC1BDCEEE,
 	0xF57C0FAF, 0x4787C62A, 0xA8304613, 0xFD469501,
 	0x698098D8, 0x8B44F7AF, 0xFFFF5BB1, 0x895CD7BE,
@@ -58,7 +58,7 @@ static const uint32_t K[64] = {
 	0xF7537E82, 0xBD3AF235, 0x2AD7D2BB, 0xEB86D391
 };
 
-static const unsigned char MP[48] = {
+static const unsigned char MP[48] BR_FLASH_TABLE = {
 	1, 6, 11, 0, 5, 10, 15, 4, 9, 14, 3, 8, 13, 2, 7, 12,
 	5, 8, 11, 14, 1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15, 2,
 	0, 7, 14, 5, 12, 3, 10, 1, 8, 15, 6, 13, 4, 11, 2, 9
@@ -84,28 +84,28 @@ br_md5_round(const unsigned char *buf, uint32_t *val)
 	br_range_dec32le(m, 16, buf);
 
 	for (i = 0; i < 16; i += 4) {
-		a = b + ROTL(a + F(b, c, d) + m[i + 0] + K[i + 0],  7);
-		d = a + ROTL(d + F(a, b, c) + m[i + 1] + K[i + 1], 12);
-		c = d + ROTL(c + F(d, a, b) + m[i + 2] + K[i + 2], 17);
-		b = c + ROTL(b + F(c, d, a) + m[i + 3] + K[i + 3], 22);
+		a = b + ROTL(a + F(b, c, d) + m[i + 0] + BR_FLASH_U32(K, i + 0),  7);
+		d = a + ROTL(d + F(a, b, c) + m[i + 1] + BR_FLASH_U32(K, i + 1), 12);
+		c = d + ROTL(c + F(d, a, b) + m[i + 2] + BR_FLASH_U32(K, i + 2), 17);
+		b = c + ROTL(b + F(c, d, a) + m[i + 3] + BR_FLASH_U32(K, i + 3), 22);
 	}
 	for (i = 16; i < 32; i += 4) {
-		a = b + ROTL(a + G(b, c, d) + m[MP[i - 16]] + K[i + 0],  5);
-		d = a + ROTL(d + G(a, b, c) + m[MP[i - 15]] + K[i + 1],  9);
-		c = d + ROTL(c + G(d, a, b) + m[MP[i - 14]] + K[i + 2], 14);
-		b = c + ROTL(b + G(c, d, a) + m[MP[i - 13]] + K[i + 3], 20);
+		a = b + ROTL(a + G(b, c, d) + m[BR_FLASH_BYTE(MP, i - 16)] + BR_FLASH_U32(K, i + 0),  5);
+		d = a + ROTL(d + G(a, b, c) + m[BR_FLASH_BYTE(MP, i - 15)] + BR_FLASH_U32(K, i + 1),  9);
+		c = d + ROTL(c + G(d, a, b) + m[BR_FLASH_BYTE(MP, i - 14)] + BR_FLASH_U32(K, i + 2), 14);
+		b = c + ROTL(b + G(c, d, a) + m[BR_FLASH_BYTE(MP, i - 13)] + BR_FLASH_U32(K, i + 3), 20);
 	}
 	for (i = 32; i < 48; i += 4) {
-		a = b + ROTL(a + H(b, c, d) + m[MP[i - 16]] + K[i + 0],  4);
-		d = a + ROTL(d + H(a, b, c) + m[MP[i - 15]] + K[i + 1], 11);
-		c = d + ROTL(c + H(d, a, b) + m[MP[i - 14]] + K[i + 2], 16);
-		b = c + ROTL(b + H(c, d, a) + m[MP[i - 13]] + K[i + 3], 23);
+		a = b + ROTL(a + H(b, c, d) + m[BR_FLASH_BYTE(MP, i - 16)] + BR_FLASH_U32(K, i + 0),  4);
+		d = a + ROTL(d + H(a, b, c) + m[BR_FLASH_BYTE(MP, i - 15)] + BR_FLASH_U32(K, i + 1), 11);
+		c = d + ROTL(c + H(d, a, b) + m[BR_FLASH_BYTE(MP, i - 14)] + BR_FLASH_U32(K, i + 2), 16);
+		b = c + ROTL(b + H(c, d, a) + m[BR_FLASH_BYTE(MP, i - 13)] + BR_FLASH_U32(K, i + 3), 23);
 	}
 	for (i = 48; i < 64; i += 4) {
-		a = b + ROTL(a + I(b, c, d) + m[MP[i - 16]] + K[i + 0],  6);
-		d = a + ROTL(d + I(a, b, c) + m[MP[i - 15]] + K[i + 1], 10);
-		c = d + ROTL(c + I(d, a, b) + m[MP[i - 14]] + K[i + 2], 15);
-		b = c + ROTL(b + I(c, d, a) + m[MP[i - 13]] + K[i + 3], 21);
+		a = b + ROTL(a + I(b, c, d) + m[BR_FLASH_BYTE(MP, i - 16)] + BR_FLASH_U32(K, i + 0),  6);
+		d = a + ROTL(d + I(a, b, c) + m[BR_FLASH_BYTE(MP, i - 15)] + BR_FLASH_U32(K, i + 1), 10);
+		c = d + ROTL(c + I(d, a, b) + m[BR_FLASH_BYTE(MP, i - 14)] + BR_FLASH_U32(K, i + 2), 15);
+		b = c + ROTL(b + I(c, d, a) + m[BR_FLASH_BYTE(MP, i - 13)] + BR_FLASH_U32(K, i + 3), 21);
 	}
 
 	val[0] += a;
@@ -32,7 +32,7 @@
  * On output, all accumulator words fit on 26 bits, except acc[1], which
  * may be slightly larger (but by a very small amount only).
  */
-static void
+BR_FAST_FUNC static void
 poly1305_inner(uint32_t *acc, const uint32_t *r, const void *data, size_t len)
 {
 	/*
@@ -27,7 +27,7 @@
 /*
  * Perform the inner processing of blocks for Poly1305.
  */
-static void
+BR_FAST_FUNC static void
 poly1305_inner(uint32_t *a, const uint32_t *r, const void *data, size_t len)
 {
 	/*
@@ -161,42 +161,17 @@ poly1305_inner(uint32_t *a, const uint32_t *r, const void *data, size_t len)
 	}
 }
 
-/* see bearssl_block.h */
-void
-br_poly1305_ctmul32_run(const void *key, const void *iv,
-	void *data, size_t len, const void *aad, size_t aad_len,
-	void *tag, br_chacha20_run ichacha, int encrypt)
+/*
+ * Decode the 'r' value (first 16 bytes of pkey[]) into 13-bit words,
+ * with the "clamping" operation applied, and extend it with the 5x
+ * factor pre-applied.
+ */
+static void
+poly1305_key(uint32_t *r, const unsigned char *pkey)
 {
-	unsigned char pkey[32], foot[16];
-	uint32_t z, r[19], acc[10], cc, ctl;
+	uint32_t z;
 	int i;
 
-	/*
-	 * Compute the MAC key. The 'r' value is the first 16 bytes of
-	 * pkey[].
-	 */
-	memset(pkey, 0, sizeof pkey);
-	ichacha(key, iv, 0, pkey, sizeof pkey);
-
-	/*
-	 * If encrypting, ChaCha20 must run first, followed by Poly1305.
-	 * When decrypting, the operations are reversed.
-	 */
-	if (encrypt) {
-		ichacha(key, iv, 1, data, len);
-	}
-
-	/*
-	 * Run Poly1305. We must process the AAD, then ciphertext, then
-	 * the footer (with the lengths). Note that the AAD and ciphertext
-	 * are meant to be padded with zeros up to the next multiple of 16,
-	 * and the length of the footer is 16 bytes as well.
-	 */
-
-	/*
-	 * Decode the 'r' value into 13-bit words, with the "clamping"
-	 * operation applied.
-	 */
 	z = br_dec32le(pkey) & 0x03FFFFFF;
 	r[9] = z & 0x1FFF;
 	r[10] = z >> 13;
@@ -213,27 +188,20 @@ br_poly1305_ctmul32_run(const void *key, const void *iv,
 	r[17] = z & 0x1FFF;
 	r[18] = z >> 13;
 
-	/*
-	 * Extend r[] with the 5x factor pre-applied.
-	 */
 	for (i = 0; i < 9; i ++) {
 		r[i] = MUL15(5, r[i + 10]);
 	}
+}
 
-	/*
-	 * Accumulator is 0.
-	 */
-	memset(acc, 0, sizeof acc);
-
-	/*
-	 * Process the additional authenticated data, ciphertext, and
-	 * footer in due order.
-	 */
-	br_enc64le(foot, (uint64_t)aad_len);
-	br_enc64le(foot + 8, (uint64_t)len);
-	poly1305_inner(acc, r, aad, aad_len);
-	poly1305_inner(acc, r, data, len);
-	poly1305_inner(acc, r, foot, sizeof foot);
+/*
+ * Finalise the accumulator and add the 's' value (second half of
+ * pkey[]) to obtain the tag.
+ */
+static void
+poly1305_final(uint32_t *acc, const unsigned char *s, void *tag)
+{
+	uint32_t z, cc, ctl;
+	int i;
 
 	/*
 	 * Finalise modular reduction. This is done with carry propagation
@@ -268,25 +236,74 @@ br_poly1305_ctmul32_run(const void *key, const void *iv,
 
 	/*
 	 * Convert back the accumulator to 32-bit words, and add the
-	 * 's' value (second half of pkey[]). That addition is done
-	 * modulo 2^128.
+	 * 's' value. That addition is done modulo 2^128.
 	 */
-	z = acc[0] + (acc[1] << 13) + br_dec16le(pkey + 16);
+	z = acc[0] + (acc[1] << 13) + br_dec16le(s);
 	br_enc16le((unsigned char *)tag, z & 0xFFFF);
-	z = (z >> 16) + (acc[2] << 10) + br_dec16le(pkey + 18);
+	z = (z >> 16) + (acc[2] << 10) + br_dec16le(s + 2);
 	br_enc16le((unsigned char *)tag + 2, z & 0xFFFF);
-	z = (z >> 16) + (acc[3] << 7) + br_dec16le(pkey + 20);
+	z = (z >> 16) + (acc[3] << 7) + br_dec16le(s + 4);
 	br_enc16le((unsigned char *)tag + 4, z & 0xFFFF);
-	z = (z >> 16) + (acc[4] << 4) + br_dec16le(pkey + 22);
+	z = (z >> 16) + (acc[4] << 4) + br_dec16le(s + 6);
 	br_enc16le((unsigned char *)tag + 6, z & 0xFFFF);
-	z = (z >> 16) + (acc[5] << 1) + (acc[6] << 14) + br_dec16le(pkey + 24);
+	z = (z >> 16) + (acc[5] << 1) + (acc[6] << 14) + br_dec16le(s + 8);
 	br_enc16le((unsigned char *)tag + 8, z & 0xFFFF);
-	z = (z >> 16) + (acc[7] << 11) + br_dec16le(pkey + 26);
+	z = (z >> 16) + (acc[7] << 11) + br_dec16le(s + 10);
 	br_enc16le((unsigned char *)tag + 10, z & 0xFFFF);
-	z = (z >> 16) + (acc[8] << 8) + br_dec16le(pkey + 28);
+	z = (z >> 16) + (acc[8] << 8) + br_dec16le(s + 12);
 	br_enc16le((unsigned char *)tag + 12, z & 0xFFFF);
-	z = (z >> 16) + (acc[9] << 5) + br_dec16le(pkey + 30);
+	z = (z >> 16) + (acc[9] << 5) + br_dec16le(s + 14);
 	br_enc16le((unsigned char *)tag + 14, z & 0xFFFF);
+}
+
+/* see bearssl_block.h */
+void
+br_poly1305_ctmul32_run(const void *key, const void *iv,
+	void *data, size_t len, const void *aad, size_t aad_len,
+	void *tag, br_chacha20_run ichacha, int encrypt)
+{
+	unsigned char pkey[32], foot[16];
+	uint32_t r[19], acc[10];
+
+	/*
+	 * Compute the MAC key. The 'r' value is the first 16 bytes of
+	 * pkey[].
+	 */
+	memset(pkey, 0, sizeof pkey);
+	ichacha(key, iv, 0, pkey, sizeof pkey);
+
+	/*
+	 * If encrypting, ChaCha20 must run first, followed by Poly1305.
+	 * When decrypting, the operations are reversed.
+	 */
+	if (encrypt) {
+		ichacha(key, iv, 1, data, len);
+	}
+
+	/*
+	 * Run Poly1305. We must process the AAD, then ciphertext, then
+	 * the footer (with the lengths). Note that the AAD and ciphertext
+	 * are meant to be padded with zeros up to the next multiple of 16,
+	 * and the length of the footer is 16 bytes as well.
+	 */
+	poly1305_key(r, pkey);
+
+	/*
+	 * Accumulator is 0.
+	 */
+	memset(acc, 0, sizeof acc);
+
+	/*
+	 * Process the additional authenticated data, ciphertext, and
+	 * footer in due order.
+	 */
+	br_enc64le(foot, (uint64_t)aad_len);
+	br_enc64le(foot + 8, (uint64_t)len);
+	poly1305_inner(acc, r, aad, aad_len);
+	poly1305_inner(acc, r, data, len);
+	poly1305_inner(acc, r, foot, sizeof foot);
+
+	poly1305_final(acc, pkey + 16, tag);
 
 	/*
 	 * If decrypting, then ChaCha20 runs _after_ Poly1305.
@@ -295,3 +312,114 @@ br_poly1305_ctmul32_run(const void *key, const void *iv,
 		ichacha(key, iv, 1, data, len);
 	}
 }
+
+#ifdef ARDUINO
+
+/*
+ * Inject bytes into the accumulator, keeping an incomplete block in
+ * the context buffer until more data (or padding) arrives.
+ */
+static void
+poly1305_inject(br_poly1305_ctmul32_context *ctx, const void *data, size_t len)
+{
+	const unsigned char *buf;
+	size_t clen;
+
+	buf = data;
+	if (ctx->ptr > 0) {
+		clen = 16 - ctx->ptr;
+		if (clen > len) {
+			clen = len;
+		}
+		memcpy(ctx->buf + ctx->ptr, buf, clen);
+		ctx->ptr += clen;
+		buf += clen;
+		len -= clen;
+		if (ctx->ptr < 16) {
+			return;
+		}
+		poly1305_inner(ctx->acc, ctx->r, ctx->buf, 16);
+		ctx->ptr = 0;
+	}
+	clen = len & ~(size_t)15;
+	poly1305_inner(ctx->acc, ctx->r, buf, clen);
+	memcpy(ctx->buf, buf + clen, len - clen);
+	ctx->ptr = len - clen;
+}
+
+/*
+ * Process the buffered incomplete block, if any, right-padded with
+ * zeros as the AEAD construction requires.
+ */
+static void
+poly1305_pad(br_poly1305_ctmul32_context *ctx)
+{
+	if (ctx->ptr > 0) {
+		poly1305_inner(ctx->acc, ctx->r, ctx->buf, ctx->ptr);
+		ctx->ptr = 0;
+	}
+}
+
+/* see bearssl_block.h */
+void
+br_poly1305_ctmul32_init(br_poly1305_ctmul32_context *ctx,
+	const void *key, const void *iv, br_chacha20_run ichacha)
+{
+	unsigned char pkey[32];
+
+	memset(pkey, 0, sizeof pkey);
+	ichacha(key, iv, 0, pkey, sizeof pkey);
+	poly1305_key(ctx->r, pkey);
+	memcpy(ctx->s, pkey + 16, sizeof ctx->s);
+	memset(ctx->acc, 0, sizeof ctx->acc);
+	ctx->ptr = 0;
+	ctx->aad_len = 0;
+	ctx->data_len = 0;
+	ctx->flipped = 0;
+}
+
+/* see bearssl_block.h */
+void
+br_poly1305_ctmul32_aad_inject(br_poly1305_ctmul32_context *ctx,
+	const void *data, size_t len)
+{
+	poly1305_inject(ctx, data, len);
+	ctx->aad_len += len;
+}
+
+/* see bearssl_block.h */
+void
+br_poly1305_ctmul32_flip(br_poly1305_ctmul32_context *ctx)
+{
+	poly1305_pad(ctx);
+	ctx->flipped = 1;
+}
+
+/* see bearssl_block.h */
+void
+br_poly1305_ctmul32_update(br_poly1305_ctmul32_context *ctx,
+	const void *data, size_t len)
+{
+	poly1305_inject(ctx, data, len);
+	ctx->data_len += len;
+}
+
+/* see bearssl_block.h */
+void
+br_poly1305_ctmul32_get_tag(br_poly1305_ctmul32_context *ctx, void *tag)
+{
+	unsigned char foot[16];
+	uint32_t acc[10];
+
+	if (!ctx->flipped) {
+		br_poly1305_ctmul32_flip(ctx);
+	}
+	poly1305_pad(ctx);
+	br_enc64le(foot, ctx->aad_len);
+	br_enc64le(foot + 8, ctx->data_len);
+	memcpy(acc, ctx->acc, sizeof acc);
+	poly1305_inner(acc, ctx->r, foot, sizeof foot);
+	poly1305_final(acc, ctx->s, tag);
+}
+
+#endif
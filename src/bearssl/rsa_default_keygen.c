@@ -30,9 +30,33 @@ br_rsa_keygen_get_default(void)
 {
 #if BR_INT128 || BR_UMUL128
 	return &br_rsa_i62_keygen;
-#elif BR_LOMUL
+#elif BR_LOMUL && !BR_I31_CORTEXM
 	return &br_rsa_i15_keygen;
 #else
 	return &br_rsa_i31_keygen;
 #endif
 }
+
+#ifdef ARDUINO
+/* see bearssl_rsa.h */
+br_rsa_keygen_factor
+br_rsa_keygen_factor_get_default(void)
+{
+#if BR_LOMUL && !BR_I31_CORTEXM
+	return &br_rsa_i15_keygen_factor;
+#else
+	return &br_rsa_i31_keygen_factor;
+#endif
+}
+
+/* see bearssl_rsa.h */
+br_rsa_keygen_finish
+br_rsa_keygen_finish_get_default(void)
+{
+#if BR_LOMUL && !BR_I31_CORTEXM
+	return &br_rsa_i15_keygen_finish;
+#else
+	return &br_rsa_i31_keygen_finish;
+#endif
+}
+#endif
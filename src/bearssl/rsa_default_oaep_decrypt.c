@@ -30,7 +30,7 @@ br_rsa_oaep_decrypt_get_default(void)
 {
 #if BR_INT128 || BR_UMUL128
 	return &br_rsa_i62_oaep_decrypt;
-#elif BR_LOMUL
+#elif BR_LOMUL && !BR_I31_CORTEXM
 	return &br_rsa_i15_oaep_decrypt;
 #else
 	return &br_rsa_i31_oaep_decrypt;
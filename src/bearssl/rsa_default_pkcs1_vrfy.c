@@ -30,7 +30,7 @@ br_rsa_pkcs1_vrfy_get_default(void)
 {
 #if BR_INT128 || BR_UMUL128
 	return &br_rsa_i62_pkcs1_vrfy;
-#elif BR_LOMUL
+#elif BR_LOMUL && !BR_I31_CORTEXM
 	return &br_rsa_i15_pkcs1_vrfy;
 #else
 	return &br_rsa_i31_pkcs1_vrfy;
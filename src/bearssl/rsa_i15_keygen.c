@@ -47,6 +47,7 @@ mkrand(const br_prng_class **rng, uint16_t *x, uint32_t esize)
 	}
 }
 
+#ifndef ARDUINO
 /*
  * This is the big-endian unsigned representation of the product of
  * all small primes from 13 to 1481.
@@ -79,6 +80,7 @@ static const unsigned char SMALL_PRIMES[] = {
 	0x57, 0xF0, 0x27, 0x2A, 0xC3, 0x47, 0xCA, 0xB9, 0xD7, 0x5C,
 	0xFF, 0xC2, 0xAC, 0x65, 0x4E, 0xBD
 };
+#endif
 
 /*
  * We need temporary values for at least 7 integers of the same size
@@ -92,6 +94,7 @@ static const unsigned char SMALL_PRIMES[] = {
 #define MAX(x, y)   ((x) > (y) ? (x) : (y))
 #define TEMPS       MAX(1024, 7 * ((((BR_MAX_RSA_SIZE + 1) >> 1) + 29) / 15))
 
+#ifndef ARDUINO
 /*
  * Perform trial division on a candidate prime. This computes
  * y = SMALL_PRIMES mod x, then tries to compute y/y mod x. The
@@ -113,6 +116,7 @@ trial_divisions(const uint16_t *x, uint16_t *t)
 	br_i15_decode_reduce(y, SMALL_PRIMES, sizeof SMALL_PRIMES, x);
 	return br_i15_moddiv(y, y, x, x0i, t);
 }
+#endif
 
 /*
  * Perform n rounds of Miller-Rabin on the candidate prime x. This
@@ -213,6 +217,112 @@ miller_rabin(const br_prng_class **rng, const uint16_t *x, int n,
 	return 1;
 }
 
+#ifdef ARDUINO
+
+/*
+ * Add v (lower than 2^15) to x. Returned value is 1 on success, 0 if the
+ * sum does not fit in the announced bit length of x.
+ */
+static uint32_t
+add_small(uint16_t *x, uint32_t v)
+{
+	size_t u, len;
+	uint32_t cc, m;
+
+	len = (x[0] + 15) >> 4;
+	cc = v;
+	for (u = 1; u <= len; u ++) {
+		uint32_t w;
+
+		w = x[u] + cc;
+		x[u] = w & 0x7FFF;
+		cc = w >> 15;
+	}
+	m = x[0] & 15;
+	if (m != 0) {
+		cc |= x[len] >> m;
+	}
+	return cc == 0;
+}
+
+/*
+ * Create a random prime of the provided size. 'size' is the _encoded_
+ * bit length. The two top bits and the two bottom bits are set to 1.
+ *
+ * This is an incremental search: from a random starting point x, the
+ * candidates are x, x + 4, x + 8... (all equal to 3 mod 4). A sieve by
+ * the odd primes up to 1481 rejects most composites, and the values for
+ * which a small public exponent would not be invertible, without any
+ * big integer computation. Timing only depends on the rejected
+ * candidates and on the distance from x to the returned prime.
+ */
+static void
+mkprime(const br_prng_class **rng, uint16_t *x, uint32_t esize,
+	uint32_t pubexp, uint16_t *t, size_t tlen)
+{
+	size_t len, xlen;
+	int rounds;
+	unsigned char sv[BR_RSA_KEYGEN_SIEVE_BITS >> 3];
+
+	x[0] = esize;
+	len = (esize + 15) >> 4;
+	xlen = ((esize - (esize >> 4)) + 7) >> 3;
+
+	/*
+	 * Miller-Rabin rounds for a 2^(-80) error probability, as in
+	 * the non-incremental search (encoded size thresholds).
+	 */
+	if (esize < 320) {
+		rounds = 12;
+	} else if (esize < 480) {
+		rounds = 9;
+	} else if (esize < 693) {
+		rounds = 6;
+	} else if (esize < 906) {
+		rounds = 4;
+	} else if (esize < 1386) {
+		rounds = 3;
+	} else {
+		rounds = 2;
+	}
+
+	for (;;) {
+		size_t k, last;
+
+		/*
+		 * Generate random bits. We force the two top bits and the
+		 * two bottom bits to 1.
+		 */
+		mkrand(rng, x, esize);
+		if ((esize & 15) == 0) {
+			x[len] |= 0x6000;
+		} else if ((esize & 15) == 1) {
+			x[len] |= 0x0001;
+			x[len - 1] |= 0x4000;
+		} else {
+			x[len] |= 0x0003 << ((esize & 15) - 2);
+		}
+		x[1] |= 0x0003;
+		br_i15_encode(t, xlen, x);
+		br_rsa_keygen_sieve(sv, (unsigned char *)t, xlen, pubexp);
+		last = 0;
+		for (k = 0; k < BR_RSA_KEYGEN_SIEVE_BITS; k ++) {
+			if (((sv[k >> 3] >> (k & 7)) & 1) != 0) {
+				continue;
+			}
+			if (!add_small(x, (uint32_t)(k - last) << 2)) {
+				break;
+			}
+			last = k;
+			if (miller_rabin(rng, x, rounds, t, tlen)) {
+				return;
+			}
+		}
+	}
+}
+
+#else
+
 /*
  * Create a random prime of the provided size. 'size' is the _encoded_
  * bit length. The two top bits and the two bottom bits are set to 1.
@@ -366,6 +476,8 @@ mkprime(const br_prng_class **rng, uint16_t *x, uint32_t esize,
 	}
 }
 
+#endif
+
 /*
  * Let p be a prime (p > 2^33, p = 3 mod 4). Let m = (p-1)/2, provided
  * as parameter (with announced bit length equal to that of p). This
@@ -581,3 +693,172 @@ br_rsa_i15_keygen(const br_prng_class **rng,
 
 	return r;
 }
+
+#ifdef ARDUINO
+
+/*
+ * Get the size of factor p (index 0) or q (index 1), and the offsets
+ * of that factor and of its CRT exponent in the private key buffer,
+ * with the layout used by br_rsa_i15_keygen(). The public
+ * exponent is checked and normalised. Returned value is 1 on success,
+ * 0 on error.
+ */
+static uint32_t
+factor_layout(unsigned size, uint32_t *pubexp, int index,
+	uint32_t *esize, size_t *off, size_t *doff, size_t *len)
+{
+	uint32_t esize_p, esize_q;
+	size_t plen, qlen;
+
+	if (size < BR_MIN_RSA_SIZE || size > BR_MAX_RSA_SIZE) {
+		return 0;
+	}
+	if (*pubexp == 0) {
+		*pubexp = 3;
+	} else if (*pubexp == 1 || (*pubexp & 1) == 0) {
+		return 0;
+	}
+
+	esize_p = (size + 1) >> 1;
+	esize_q = size - esize_p;
+	plen = (esize_p + 7) >> 3;
+	qlen = (esize_q + 7) >> 3;
+	if (index == 0) {
+		*esize = esize_p;
+		*off = 0;
+		*doff = plen + qlen;
+		*len = plen;
+	} else {
+		*esize = esize_q;
+		*off = plen;
+		*doff = (plen << 1) + qlen;
+		*len = qlen;
+	}
+	return 1;
+}
+
+/* see bearssl_rsa.h */
+uint32_t
+br_rsa_i15_keygen_factor(const br_prng_class **rng, void *kbuf_priv,
+	unsigned size, uint32_t pubexp, int index)
+{
+	uint32_t esize;
+	size_t off, doff, xlen, len, tlen;
+	uint16_t *x, *t;
+	uint16_t tmp[TEMPS];
+	unsigned char *buf;
+
+	if (!factor_layout(size, &pubexp, index, &esize, &off, &doff, &xlen)) {
+		return 0;
+	}
+	buf = kbuf_priv;
+
+	/*
+	 * Same search as in br_rsa_i15_keygen(), for a single
+	 * factor.
+	 */
+	esize += MUL15(esize, 17477) >> 18;
+	len = (esize + 15) >> 4;
+	x = tmp;
+	t = x + 1 + len;
+	tlen = ((sizeof tmp) / sizeof(uint16_t)) - (1 + len);
+	for (;;) {
+		mkprime(rng, x, esize, pubexp, t, tlen);
+		br_i15_rshift(x, 1);
+		if (invert_pubexp(t, x, pubexp, t + 1 + len)) {
+			br_i15_add(x, x, 1);
+			x[1] |= 1;
+			br_i15_encode(buf + off, xlen, x);
+			br_i15_encode(buf + doff, xlen, t);
+			return 1;
+		}
+	}
+}
+
+/* see bearssl_rsa.h */
+uint32_t
+br_rsa_i15_keygen_finish(br_rsa_private_key *sk, void *kbuf_priv,
+	br_rsa_public_key *pk, void *kbuf_pub,
+	unsigned size, uint32_t pubexp)
+{
+	uint32_t esize_p, esize_q;
+	size_t plen, qlen;
+	uint16_t *p, *q, *t;
+	uint16_t tmp[TEMPS];
+	uint32_t r;
+
+	if (size < BR_MIN_RSA_SIZE || size > BR_MAX_RSA_SIZE) {
+		return 0;
+	}
+	if (pubexp == 0) {
+		pubexp = 3;
+	} else if (pubexp == 1 || (pubexp & 1) == 0) {
+		return 0;
+	}
+
+	esize_p = (size + 1) >> 1;
+	esize_q = size - esize_p;
+	sk->n_bitlen = size;
+	sk->p = kbuf_priv;
+	sk->plen = (esize_p + 7) >> 3;
+	sk->q = sk->p + sk->plen;
+	sk->qlen = (esize_q + 7) >> 3;
+	sk->dp = sk->q + sk->qlen;
+	sk->dplen = sk->plen;
+	sk->dq = sk->dp + sk->dplen;
+	sk->dqlen = sk->qlen;
+	sk->iq = sk->dq + sk->dqlen;
+	sk->iqlen = sk->plen;
+
+	if (pk != NULL) {
+		pk->n = kbuf_pub;
+		pk->nlen = (size + 7) >> 3;
+		pk->e = pk->n + pk->nlen;
+		pk->elen = 4;
+		br_enc32be(pk->e, pubexp);
+		while (*pk->e == 0) {
+			pk->e ++;
+			pk->elen --;
+		}
+	}
+
+	/*
+	 * Both factors have their top bit set, so the decoded bit
+	 * lengths are the encoded sizes used by the key generator.
+	 */
+	p = tmp;
+	br_i15_decode(p, sk->p, sk->plen);
+	plen = (p[0] + 15) >> 4;
+	q = p + 1 + plen;
+	br_i15_decode(q, sk->q, sk->qlen);
+	qlen = (q[0] + 15) >> 4;
+	t = q + 1 + plen;
+
+	/*
+	 * Keep p > q, and compute iq = 1/q mod p and the modulus, as
+	 * in br_rsa_i15_keygen().
+	 */
+	if (p[0] == q[0] && br_i15_sub(p, q, 0) == 1) {
+		bufswap(p, q, (1 + plen) * sizeof *p);
+		bufswap(sk->p, sk->q, sk->plen);
+		bufswap(sk->dp, sk->dq, sk->dplen);
+	}
+	q[0] = p[0];
+	if (plen > qlen) {
+		q[plen] = 0;
+	}
+	br_i15_zero(t, p[0]);
+	t[1] = 1;
+	r = br_i15_moddiv(t, q, p, br_i15_ninv15(p[1]), t + 1 + plen);
+	br_i15_encode(sk->iq, sk->iqlen, t);
+
+	if (pk != NULL) {
+		br_i15_zero(t, p[0]);
+		br_i15_mulacc(t, p, q);
+		br_i15_encode(pk->n, pk->nlen, t);
+	}
+
+	return r;
+}
+
+#endif
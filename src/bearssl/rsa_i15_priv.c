@@ -25,18 +25,29 @@
 #include "inner.h"
 
 #define U      (2 + ((BR_MAX_RSA_FACTOR + 14) / 15))
+
+/*
+ * With BR_RSA_WINDOW_BITS, the work area has room for four factor-sized
+ * values and the 2^w+1 window temporaries of the exponentiation.
+ */
+#if BR_RSA_WINDOW_BITS > 1
+#define TLEN   ((5 + (1 << BR_RSA_WINDOW_BITS)) * U)
+#else
 #define TLEN   (8 * U)
+#endif
 
-/* see bearssl_rsa.h */
-uint32_t
-br_rsa_i15_private(unsigned char *x, const br_rsa_private_key *sk)
+#if BR_STATIC_SCRATCH && (2 + TLEN) / 2 > BR_SCRATCH_WORDS
+#error br_scratch[] is too small for the RSA work area
+#endif
+
+static uint32_t
+rsa_private(unsigned char *x, const br_rsa_private_key *sk, uint16_t *tmp)
 {
 	const unsigned char *p, *q;
 	size_t plen, qlen;
 	size_t fwlen;
 	uint16_t p0i, q0i;
 	size_t xlen, u;
-	uint16_t tmp[1 + TLEN];
 	long z;
 	uint16_t *mp, *mq, *s1, *s2, *t1, *t2, *t3;
 	uint32_t r;
@@ -207,3 +218,179 @@ br_rsa_i15_private(unsigned char *x, const br_rsa_private_key *sk)
 	 */
 	return p0i & q0i & r;
 }
+
+/* see bearssl_rsa.h */
+uint32_t
+br_rsa_i15_private(unsigned char *x, const br_rsa_private_key *sk)
+{
+#if BR_STATIC_SCRATCH
+	uint32_t r;
+
+	br_scratch_acquire();
+	r = rsa_private(x, sk, (uint16_t *)br_scratch);
+	br_scratch_release();
+	return r;
+#else
+	uint16_t tmp[1 + TLEN];
+
+	return rsa_private(x, sk, tmp);
+#endif
+}
+
+#ifdef ARDUINO
+
+/*
+ * Number of words for one factor-sized value (including the header
+ * word, rounded up to an even number), or 0 if a factor is too large.
+ */
+static size_t
+factor_wlen(const br_rsa_private_key *sk)
+{
+	const unsigned char *p, *q;
+	size_t plen, qlen, fwlen;
+	long z;
+
+	p = sk->p;
+	plen = sk->plen;
+	while (plen > 0 && *p == 0) {
+		p ++;
+		plen --;
+	}
+	q = sk->q;
+	qlen = sk->qlen;
+	while (qlen > 0 && *q == 0) {
+		q ++;
+		qlen --;
+	}
+	z = (long)(plen > qlen ? plen : qlen) << 3;
+	fwlen = 1;
+	while (z > 0) {
+		z -= 15;
+		fwlen ++;
+	}
+	fwlen += (fwlen & 1);
+	if (6 * fwlen > TLEN) {
+		return 0;
+	}
+	return fwlen;
+}
+
+/* see bearssl_rsa.h */
+size_t
+br_rsa_i15_priv_precomp_init(br_rsa_i15_priv_precomp_key *pp,
+	const br_rsa_private_key *sk, uint16_t *buf, size_t buf_len)
+{
+	size_t fwlen, skip;
+	uint16_t *mp, *mq, *iq;
+
+	/*
+	 * Ensure 32-bit alignment for value words, as in
+	 * br_rsa_i15_private().
+	 */
+	fwlen = factor_wlen(sk);
+	skip = ((uintptr_t)buf & 2) == 0;
+	if (fwlen == 0 || skip + 3 * fwlen > buf_len) {
+		return 0;
+	}
+	buf += skip;
+	mp = buf;
+	mq = buf + fwlen;
+	iq = buf + 2 * fwlen;
+	br_i15_decode(mp, sk->p, sk->plen);
+	br_i15_decode(mq, sk->q, sk->qlen);
+	pp->p0i = br_i15_ninv15(mp[1]);
+	pp->q0i = br_i15_ninv15(mq[1]);
+	if ((pp->p0i & pp->q0i) == 0) {
+		return 0;
+	}
+
+	/*
+	 * 1/q mod p is kept in Montgomery representation, so that a
+	 * single montymul() yields h = (s1 - s2)/q mod p.
+	 */
+	br_i15_decode_reduce(iq, sk->iq, sk->iqlen, mp);
+	br_i15_to_monty(iq, mp);
+
+	pp->p = mp;
+	pp->q = mq;
+	pp->iq = iq;
+	pp->fwlen = fwlen;
+	pp->n_bitlen = sk->n_bitlen;
+	pp->dp = sk->dp;
+	pp->dplen = sk->dplen;
+	pp->dq = sk->dq;
+	pp->dqlen = sk->dqlen;
+	return skip + 3 * fwlen;
+}
+
+/* see bearssl_rsa.h */
+uint32_t
+br_rsa_i15_private_precomp(unsigned char *x,
+	const br_rsa_i15_priv_precomp_key *pp, uint16_t *tmp, size_t tlen)
+{
+	const uint16_t *mp, *mq;
+	uint16_t *s1, *s2, *t1, *t2;
+	size_t fwlen, xlen, u;
+	uint32_t r;
+
+	if (((uintptr_t)tmp & 2) == 0 && tlen > 0) {
+		tmp ++;
+		tlen --;
+	}
+	fwlen = pp->fwlen;
+	if (6 * fwlen > tlen) {
+		return 0;
+	}
+	mp = pp->p;
+	mq = pp->q;
+	xlen = (pp->n_bitlen + 7) >> 3;
+
+	/*
+	 * Check that the source value is lower than the modulus, as in
+	 * br_rsa_i15_private(). Slots 2 to 5 are free at that point.
+	 */
+	t1 = tmp + 2 * fwlen;
+	t2 = tmp + 4 * fwlen;
+	br_i15_zero(t1, mq[0]);
+	br_i15_mulacc(t1, mq, mp);
+	br_i15_encode(t2, xlen, t1);
+	u = xlen;
+	r = 0;
+	while (u > 0) {
+		uint32_t wn, wx;
+
+		u --;
+		wn = ((unsigned char *)t2)[u];
+		wx = x[u];
+		r = ((wx - (wn + r)) >> 8) & 1;
+	}
+
+	/*
+	 * s2 = x^dq mod q goes in slot 0, s1 = x^dp mod p in slot 1; the
+	 * exponentiations use the rest of the buffer, so that a larger
+	 * buffer allows a larger window.
+	 */
+	s2 = tmp;
+	br_i15_decode_reduce(s2, x, xlen, mq);
+	r &= br_i15_modpow_opt(s2, pp->dq, pp->dqlen, mq, pp->q0i,
+		tmp + fwlen, tlen - fwlen);
+	s1 = tmp + fwlen;
+	br_i15_decode_reduce(s1, x, xlen, mp);
+	r &= br_i15_modpow_opt(s1, pp->dp, pp->dplen, mp, pp->p0i,
+		tmp + 2 * fwlen, tlen - 2 * fwlen);
+
+	/*
+	 * h = (s1 - s2)*(1/q) mod p goes in slot 3, then s = s2 + q*h
+	 * is accumulated over s2 (slots 0 and 1).
+	 */
+	t1 = tmp + 2 * fwlen;
+	t2 = tmp + 3 * fwlen;
+	br_i15_reduce(t1, s2, mp);
+	br_i15_add(s1, mp, br_i15_sub(s1, t1, 1));
+	br_i15_montymul(t2, s1, pp->iq, mp, pp->p0i);
+	br_i15_mulacc(s2, mq, t2);
+	br_i15_encode(x, xlen, s2);
+	return r;
+}
+
+#endif
@@ -30,14 +30,59 @@
  */
 #define TLEN   (4 * (2 + ((BR_MAX_RSA_SIZE + 14) / 15)))
 
-/* see bearssl_rsa.h */
-uint32_t
-br_rsa_i15_public(unsigned char *x, size_t xlen,
-	const br_rsa_public_key *pk)
+#if BR_STATIC_SCRATCH && (2 + TLEN) / 2 > BR_SCRATCH_WORDS
+#error br_scratch[] is too small for the RSA work area
+#endif
+
+#ifdef ARDUINO
+/*
+ * Left-to-right square-and-multiply with a public exponent (this is not
+ * constant-time with regards to e). g is the base, in Montgomery
+ * representation; a receives g^e, in Montgomery representation; b is a
+ * temporary. e must not be zero nor have leading zero bytes. For
+ * e = 65537, this is 16 squarings and one multiplication.
+ */
+static void
+pow_public(uint16_t *a, uint16_t *b, const uint16_t *g,
+	const unsigned char *e, size_t elen, const uint16_t *m, uint16_t m0i)
+{
+	size_t mlen;
+	int k;
+
+	mlen = ((m[0] + 31) >> 4) * sizeof m[0];
+	memcpy(a, g, mlen);
+	k = 7;
+	while (!((*e >> k) & 1)) {
+		k --;
+	}
+	for (;;) {
+		if (-- k < 0) {
+			if (-- elen == 0) {
+				break;
+			}
+			e ++;
+			k = 7;
+		}
+		br_i15_montymul(b, a, a, m, m0i);
+		if ((*e >> k) & 1) {
+			br_i15_montymul(a, b, g, m, m0i);
+		} else {
+			memcpy(a, b, mlen);
+		}
+	}
+}
+#endif
+
+static uint32_t
+rsa_public(unsigned char *x, size_t xlen,
+	const br_rsa_public_key *pk, uint16_t *tmp)
 {
 	const unsigned char *n;
 	size_t nlen;
-	uint16_t tmp[1 + TLEN];
+#ifdef ARDUINO
+	const unsigned char *e;
+	size_t elen;
+#endif
 	uint16_t *m, *a, *t;
 	size_t fwlen;
 	long z;
@@ -103,6 +148,25 @@ br_rsa_i15_public(unsigned char *x, size_t xlen,
 	/*
 	 * Compute the modular exponentiation.
 	 */
+#ifdef ARDUINO
+	/*
+	 * Short exponents (almost always 65537) use a plain square and
+	 * multiply: br_i15_modpow_opt() would also build a window table
+	 * and go through all bits of the encoded exponent.
+	 */
+	e = pk->e;
+	elen = pk->elen;
+	while (elen > 0 && *e == 0) {
+		e ++;
+		elen --;
+	}
+	if (elen > 0 && elen <= 4) {
+		br_i15_to_monty(a, m);
+		pow_public(t, t + fwlen, a, e, elen, m, m0i);
+		br_i15_from_monty(t, m, m0i);
+		memcpy(a, t, fwlen * sizeof t[0]);
+	} else
+#endif
 	br_i15_modpow_opt(a, pk->e, pk->elen, m, m0i, t, TLEN - 2 * fwlen);
 
 	/*
@@ -111,3 +175,150 @@ br_rsa_i15_public(unsigned char *x, size_t xlen,
 	br_i15_encode(x, xlen, a);
 	return r;
 }
+
+/* see bearssl_rsa.h */
+uint32_t
+br_rsa_i15_public(unsigned char *x, size_t xlen,
+	const br_rsa_public_key *pk)
+{
+#if BR_STATIC_SCRATCH
+	uint32_t r;
+
+	br_scratch_acquire();
+	r = rsa_public(x, xlen, pk, (uint16_t *)br_scratch);
+	br_scratch_release();
+	return r;
+#else
+	uint16_t tmp[1 + TLEN];
+
+	return rsa_public(x, xlen, pk, tmp);
+#endif
+}
+
+#ifdef ARDUINO
+/* see bearssl_rsa.h */
+size_t
+br_rsa_i15_precomp_init(br_rsa_i15_precomp_key *pp,
+	const br_rsa_public_key *pk, uint16_t *buf, size_t buf_len)
+{
+	const unsigned char *n;
+	size_t nlen, fwlen;
+	uint16_t *m, *r2;
+	long z;
+
+	n = pk->n;
+	nlen = pk->nlen;
+	while (nlen > 0 && *n == 0) {
+		n ++;
+		nlen --;
+	}
+	if (nlen == 0 || nlen > (BR_MAX_RSA_SIZE >> 3)) {
+		return 0;
+	}
+	z = (long)nlen << 3;
+	fwlen = 1;
+	while (z > 0) {
+		z -= 15;
+		fwlen ++;
+	}
+	fwlen += (fwlen & 1);
+
+	/*
+	 * Same alignment as in br_rsa_i15_public(): the first value word
+	 * of each integer on a 32-bit boundary.
+	 */
+	m = buf;
+	if (((uintptr_t)m & 2) == 0) {
+		m ++;
+	}
+	if ((size_t)(m - buf) + 2 * fwlen > buf_len) {
+		return 0;
+	}
+	r2 = m + fwlen;
+
+	br_i15_decode(m, n, nlen);
+	pp->m0i = br_i15_ninv15(m[1]);
+	if ((pp->m0i & 1) == 0) {
+		return 0;
+	}
+
+	/*
+	 * R^2 mod m, where R is the Montgomery factor: converting 1 into
+	 * Montgomery representation twice.
+	 */
+	br_i15_zero(r2, m[0]);
+	r2[1] = 1;
+	br_i15_to_monty(r2, m);
+	br_i15_to_monty(r2, m);
+
+	pp->m = m;
+	pp->r2 = r2;
+	pp->nlen = nlen;
+	pp->e = pk->e;
+	pp->elen = pk->elen;
+	return (size_t)(m - buf) + 2 * fwlen;
+}
+
+static uint32_t
+rsa_public_precomp(unsigned char *x, size_t xlen,
+	const br_rsa_i15_precomp_key *pp, uint16_t *tmp)
+{
+	const uint16_t *m;
+	const unsigned char *e;
+	size_t elen, fwlen;
+	uint16_t *a, *b, *g;
+	uint32_t r;
+
+	m = pp->m;
+	if (xlen != pp->nlen) {
+		return 0;
+	}
+	e = pp->e;
+	elen = pp->elen;
+	while (elen > 0 && *e == 0) {
+		e ++;
+		elen --;
+	}
+	if (elen == 0) {
+		return 0;
+	}
+	fwlen = (m[0] + 31) >> 4;
+	fwlen += (fwlen & 1);
+	a = tmp;
+	if (((uintptr_t)a & 2) == 0) {
+		a ++;
+	}
+	b = a + fwlen;
+	g = b + fwlen;
+
+	/*
+	 * g = x*R (Montgomery representation of x), then a
+	 * square-and-multiply with the exponent.
+	 */
+	r = br_i15_decode_mod(a, x, xlen, m);
+	br_i15_montymul(g, a, pp->r2, m, pp->m0i);
+	pow_public(a, b, g, e, elen, m, pp->m0i);
+	br_i15_from_monty(a, m, pp->m0i);
+	br_i15_encode(x, xlen, a);
+	return r;
+}
+
+/* see bearssl_rsa.h */
+uint32_t
+br_rsa_i15_public_precomp(unsigned char *x, size_t xlen,
+	const br_rsa_i15_precomp_key *pp)
+{
+#if BR_STATIC_SCRATCH
+	uint32_t r;
+
+	br_scratch_acquire();
+	r = rsa_public_precomp(x, xlen, pp, (uint16_t *)br_scratch);
+	br_scratch_release();
+	return r;
+#else
+	uint16_t tmp[1 + 3 * (2 + ((BR_MAX_RSA_SIZE + 14) / 15))];
+
+	return rsa_public_precomp(x, xlen, pp, tmp);
+#endif
+}
+#endif
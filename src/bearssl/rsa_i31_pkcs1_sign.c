@@ -35,3 +35,20 @@ br_rsa_i31_pkcs1_sign(const unsigned char *hash_oid,
 	}
 	return br_rsa_i31_private(x, sk);
 }
+
+#ifdef ARDUINO
+
+/* see bearssl_rsa.h */
+uint32_t
+br_rsa_i31_pkcs1_sign_precomp(const unsigned char *hash_oid,
+	const unsigned char *hash, size_t hash_len,
+	const br_rsa_i31_priv_precomp_key *pp, unsigned char *x,
+	uint32_t *tmp, size_t tlen)
+{
+	if (!br_rsa_pkcs1_sig_pad(hash_oid, hash, hash_len, pp->n_bitlen, x)) {
+		return 0;
+	}
+	return br_rsa_i31_private_precomp(x, pp, tmp, tlen);
+}
+
+#endif
@@ -30,14 +30,59 @@
  */
 #define TLEN   (4 * (2 + ((BR_MAX_RSA_SIZE + 30) / 31)))
 
-/* see bearssl_rsa.h */
-uint32_t
-br_rsa_i31_public(unsigned char *x, size_t xlen,
-	const br_rsa_public_key *pk)
+#if BR_STATIC_SCRATCH && 1 + TLEN > BR_SCRATCH_WORDS
+#error br_scratch[] is too small for the RSA work area
+#endif
+
+#ifdef ARDUINO
+/*
+ * Left-to-right square-and-multiply with a public exponent (this is not
+ * constant-time with regards to e). g is the base, in Montgomery
+ * representation; a receives g^e, in Montgomery representation; b is a
+ * temporary. e must not be zero nor have leading zero bytes. For
+ * e = 65537, this is 16 squarings and one multiplication.
+ */
+static void
+pow_public(uint32_t *a, uint32_t *b, const uint32_t *g,
+	const unsigned char *e, size_t elen, const uint32_t *m, uint32_t m0i)
+{
+	size_t mlen;
+	int k;
+
+	mlen = ((m[0] + 63) >> 5) * sizeof m[0];
+	memcpy(a, g, mlen);
+	k = 7;
+	while (!((*e >> k) & 1)) {
+		k --;
+	}
+	for (;;) {
+		if (-- k < 0) {
+			if (-- elen == 0) {
+				break;
+			}
+			e ++;
+			k = 7;
+		}
+		br_i31_montymul(b, a, a, m, m0i);
+		if ((*e >> k) & 1) {
+			br_i31_montymul(a, b, g, m, m0i);
+		} else {
+			memcpy(a, b, mlen);
+		}
+	}
+}
+#endif
+
+static uint32_t
+rsa_public(unsigned char *x, size_t xlen,
+	const br_rsa_public_key *pk, uint32_t *tmp)
 {
 	const unsigned char *n;
 	size_t nlen;
-	uint32_t tmp[1 + TLEN];
+#ifdef ARDUINO
+	const unsigned char *e;
+	size_t elen;
+#endif
 	uint32_t *m, *a, *t;
 	size_t fwlen;
 	long z;
@@ -96,6 +141,25 @@ br_rsa_i31_public(unsigned char *x, size_t xlen,
 	/*
 	 * Compute the modular exponentiation.
 	 */
+#ifdef ARDUINO
+	/*
+	 * Short exponents (almost always 65537) use a plain square and
+	 * multiply: br_i31_modpow_opt() would also build a window table
+	 * and go through all bits of the encoded exponent.
+	 */
+	e = pk->e;
+	elen = pk->elen;
+	while (elen > 0 && *e == 0) {
+		e ++;
+		elen --;
+	}
+	if (elen > 0 && elen <= 4) {
+		br_i31_to_monty(a, m);
+		pow_public(t, t + fwlen, a, e, elen, m, m0i);
+		br_i31_from_monty(t, m, m0i);
+		memcpy(a, t, fwlen * sizeof t[0]);
+	} else
+#endif
 	br_i31_modpow_opt(a, pk->e, pk->elen, m, m0i, t, TLEN - 2 * fwlen);
 
 	/*
@@ -104,3 +168,139 @@ br_rsa_i31_public(unsigned char *x, size_t xlen,
 	br_i31_encode(x, xlen, a);
 	return r;
 }
+
+/* see bearssl_rsa.h */
+uint32_t
+br_rsa_i31_public(unsigned char *x, size_t xlen,
+	const br_rsa_public_key *pk)
+{
+#if BR_STATIC_SCRATCH
+	uint32_t r;
+
+	br_scratch_acquire();
+	r = rsa_public(x, xlen, pk, br_scratch);
+	br_scratch_release();
+	return r;
+#else
+	uint32_t tmp[1 + TLEN];
+
+	return rsa_public(x, xlen, pk, tmp);
+#endif
+}
+
+#ifdef ARDUINO
+/* see bearssl_rsa.h */
+size_t
+br_rsa_i31_precomp_init(br_rsa_i31_precomp_key *pp,
+	const br_rsa_public_key *pk, uint32_t *buf, size_t buf_len)
+{
+	const unsigned char *n;
+	size_t nlen, fwlen;
+	uint32_t *m, *r2;
+	long z;
+
+	n = pk->n;
+	nlen = pk->nlen;
+	while (nlen > 0 && *n == 0) {
+		n ++;
+		nlen --;
+	}
+	if (nlen == 0 || nlen > (BR_MAX_RSA_SIZE >> 3)) {
+		return 0;
+	}
+	z = (long)nlen << 3;
+	fwlen = 1;
+	while (z > 0) {
+		z -= 31;
+		fwlen ++;
+	}
+	fwlen += (fwlen & 1);
+	m = buf;
+	if ((size_t)(m - buf) + 2 * fwlen > buf_len) {
+		return 0;
+	}
+	r2 = m + fwlen;
+
+	br_i31_decode(m, n, nlen);
+	pp->m0i = br_i31_ninv31(m[1]);
+	if ((pp->m0i & 1) == 0) {
+		return 0;
+	}
+
+	/*
+	 * R^2 mod m, where R is the Montgomery factor: converting 1 into
+	 * Montgomery representation twice.
+	 */
+	br_i31_zero(r2, m[0]);
+	r2[1] = 1;
+	br_i31_to_monty(r2, m);
+	br_i31_to_monty(r2, m);
+
+	pp->m = m;
+	pp->r2 = r2;
+	pp->nlen = nlen;
+	pp->e = pk->e;
+	pp->elen = pk->elen;
+	return (size_t)(m - buf) + 2 * fwlen;
+}
+
+static uint32_t
+rsa_public_precomp(unsigned char *x, size_t xlen,
+	const br_rsa_i31_precomp_key *pp, uint32_t *tmp)
+{
+	const uint32_t *m;
+	const unsigned char *e;
+	size_t elen, fwlen;
+	uint32_t *a, *b, *g;
+	uint32_t r;
+
+	m = pp->m;
+	if (xlen != pp->nlen) {
+		return 0;
+	}
+	e = pp->e;
+	elen = pp->elen;
+	while (elen > 0 && *e == 0) {
+		e ++;
+		elen --;
+	}
+	if (elen == 0) {
+		return 0;
+	}
+	fwlen = (m[0] + 63) >> 5;
+	fwlen += (fwlen & 1);
+	a = tmp;
+	b = a + fwlen;
+	g = b + fwlen;
+
+	/*
+	 * g = x*R (Montgomery representation of x), then a
+	 * square-and-multiply with the exponent.
+	 */
+	r = br_i31_decode_mod(a, x, xlen, m);
+	br_i31_montymul(g, a, pp->r2, m, pp->m0i);
+	pow_public(a, b, g, e, elen, m, pp->m0i);
+	br_i31_from_monty(a, m, pp->m0i);
+	br_i31_encode(x, xlen, a);
+	return r;
+}
+
+/* see bearssl_rsa.h */
+uint32_t
+br_rsa_i31_public_precomp(unsigned char *x, size_t xlen,
+	const br_rsa_i31_precomp_key *pp)
+{
+#if BR_STATIC_SCRATCH
+	uint32_t r;
+
+	br_scratch_acquire();
+	r = rsa_public_precomp(x, xlen, pp, br_scratch);
+	br_scratch_release();
+	return r;
+#else
+	uint32_t tmp[1 + 3 * (2 + ((BR_MAX_RSA_SIZE + 30) / 31))];
+
+	return rsa_public_precomp(x, xlen, pp, tmp);
+#endif
+}
+#endif
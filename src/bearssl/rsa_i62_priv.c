@@ -27,7 +27,17 @@
 #if BR_INT128 || BR_UMUL128
 
 #define U      (2 + ((BR_MAX_RSA_FACTOR + 30) / 31))
+
+/*
+ * TLEN is counted in 64-bit words. With BR_RSA_WINDOW_BITS, there is
+ * room for four factor-sized values, the 31-bit to 62-bit conversion
+ * (two values) and the 2^w+1 window temporaries of the exponentiation.
+ */
+#if BR_RSA_WINDOW_BITS > 1
+#define TLEN   (((7 + (1 << BR_RSA_WINDOW_BITS)) * U + 1) >> 1)
+#else
 #define TLEN   (4 * U)  /* TLEN is counted in 64-bit words */
+#endif
 
 /* see bearssl_rsa.h */
 uint32_t
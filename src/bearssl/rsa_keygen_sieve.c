@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "inner.h"
+
+#ifdef ARDUINO
+
+/*
+ * All odd primes up to 1481, i.e. 3 to 11 and the factors of the
+ * SMALL_PRIMES product used for trial divisions.
+ */
+static const uint16_t SIEVE_PRIMES[] = {
+	3, 5, 7, 11, 13, 17, 19, 23, 29, 31,
+	37, 41, 43, 47, 53, 59, 61, 67, 71, 73,
+	79, 83, 89, 97, 101, 103, 107, 109, 113, 127,
+	131, 137, 139, 149, 151, 157, 163, 167, 173, 179,
+	181, 191, 193, 197, 199, 211, 223, 227, 229, 233,
+	239, 241, 251, 257, 263, 269, 271, 277, 281, 283,
+	293, 307, 311, 313, 317, 331, 337, 347, 349, 353,
+	359, 367, 373, 379, 383, 389, 397, 401, 409, 419,
+	421, 431, 433, 439, 443, 449, 457, 461, 463, 467,
+	479, 487, 491, 499, 503, 509, 521, 523, 541, 547,
+	557, 563, 569, 571, 577, 587, 593, 599, 601, 607,
+	613, 617, 619, 631, 641, 643, 647, 653, 659, 661,
+	673, 677, 683, 691, 701, 709, 719, 727, 733, 739,
+	743, 751, 757, 761, 769, 773, 787, 797, 809, 811,
+	821, 823, 827, 829, 839, 853, 857, 859, 863, 877,
+	881, 883, 887, 907, 911, 919, 929, 937, 941, 947,
+	953, 967, 971, 977, 983, 991, 997, 1009, 1013, 1019,
+	1021, 1031, 1033, 1039, 1049, 1051, 1061, 1063, 1069, 1087,
+	1091, 1093, 1097, 1103, 1109, 1117, 1123, 1129, 1151, 1153,
+	1163, 1171, 1181, 1187, 1193, 1201, 1213, 1217, 1223, 1229,
+	1231, 1237, 1249, 1259, 1277, 1279, 1283, 1289, 1291, 1297,
+	1301, 1303, 1307, 1319, 1321, 1327, 1361, 1367, 1373, 1381,
+	1399, 1409, 1423, 1427, 1429, 1433, 1439, 1447, 1451, 1453,
+	1459, 1471, 1481
+};
+
+/* see inner.h */
+void
+br_rsa_keygen_sieve(unsigned char *sv, const unsigned char *x, size_t xlen,
+	uint32_t pubexp)
+{
+	size_t u, k;
+
+	memset(sv, 0, BR_RSA_KEYGEN_SIEVE_BITS >> 3);
+	for (u = 0; u < (sizeof SIEVE_PRIMES) / sizeof SIEVE_PRIMES[0]; u ++) {
+		uint32_t p, m, r, s, step, e1;
+		size_t v;
+
+		/*
+		 * r = x mod p, one byte at a time. The quotient of each
+		 * step is obtained with a multiplication by 2^30/p
+		 * (rounded up), which is exact because the value is
+		 * lower than 2^19 and p is lower than 2^11. There is no
+		 * division on secret data.
+		 */
+		p = SIEVE_PRIMES[u];
+		m = ((uint32_t)1 << 30) / p + 1;
+		r = 0;
+		for (v = 0; v < xlen; v ++) {
+			uint32_t w;
+
+			w = (r << 8) | x[v];
+			r = w - p * (uint32_t)(MUL31(w, m) >> 30);
+		}
+
+		/*
+		 * Walk the candidates x + 4*k; a residue of 0 means that
+		 * p divides the candidate, and a residue of 1 that the
+		 * public exponent (if equal to p) would not be invertible
+		 * modulo the candidate minus 1.
+		 */
+		s = r;
+		step = 4 % p;
+		e1 = EQ(p, pubexp);
+		for (k = 0; k < BR_RSA_KEYGEN_SIEVE_BITS; k ++) {
+			uint32_t bad;
+
+			bad = EQ0(s) | (e1 & EQ(s, 1));
+			sv[k >> 3] |= (unsigned char)(bad << (k & 7));
+			s += step;
+			s -= p & -GE(s, p);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "inner.h"
+
+#if BR_STATIC_SCRATCH
+
+uint32_t br_scratch[BR_SCRATCH_WORDS];
+
+static void (*scratch_lock)(void *ctx, int acquire);
+static void *scratch_lock_ctx;
+
+/* see bearssl.h */
+void
+br_scratch_set_lock(void (*lock)(void *ctx, int acquire), void *ctx)
+{
+	scratch_lock = lock;
+	scratch_lock_ctx = ctx;
+}
+
+/* see inner.h */
+void
+br_scratch_acquire(void)
+{
+	if (scratch_lock != NULL) {
+		scratch_lock(scratch_lock_ctx, 1);
+	}
+}
+
+/* see inner.h */
+void
+br_scratch_release(void)
+{
+	/*
+	 * RSA private key operations leave secret intermediate values
+	 * behind; unlike a stack frame, the area is not overwritten by
+	 * the next function calls.
+	 */
+	memset(br_scratch, 0, sizeof br_scratch);
+	if (scratch_lock != NULL) {
+		scratch_lock(scratch_lock_ctx, 0);
+	}
+}
+
+#endif
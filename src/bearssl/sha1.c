@@ -22,6 +22,7 @@
  * SOFTWARE.
  */
 
+#define BR_ENABLE_INTRINSICS   1
 #include "inner.h"
 
 #define F(B, C, D)     ((((C) ^ (D)) & (B)) ^ (D))
@@ -41,6 +42,59 @@ const uint32_t br_sha1_IV[5] = {
 	0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0
 };
 
+#if BR_ARMV8_CE
+
+/*
+ * SHA-1 compression with the ARMv8 SHA-1 opcodes, four rounds per
+ * sha1c/sha1p/sha1m, the message schedule four words at a time.
+ */
+static void
+sha1_round_armv8(const unsigned char *buf, uint32_t *val)
+{
+	uint32x4_t abcd, abcd0, m0, m1, m2, m3;
+	uint32_t e, e0;
+	int i;
+
+	abcd0 = abcd = vld1q_u32(val);
+	e0 = e = val[4];
+	m0 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(buf +  0)));
+	m1 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(buf + 16)));
+	m2 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(buf + 32)));
+	m3 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(buf + 48)));
+	for (i = 0; i < 20; i ++) {
+		uint32x4_t t, mt;
+		uint32_t ne;
+
+		ne = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+		if (i < 5) {
+			t = vaddq_u32(m0, vdupq_n_u32(K1));
+			abcd = vsha1cq_u32(abcd, e, t);
+		} else if (i < 10) {
+			t = vaddq_u32(m0, vdupq_n_u32(K2));
+			abcd = vsha1pq_u32(abcd, e, t);
+		} else if (i < 15) {
+			t = vaddq_u32(m0, vdupq_n_u32(K3));
+			abcd = vsha1mq_u32(abcd, e, t);
+		} else {
+			t = vaddq_u32(m0, vdupq_n_u32(K4));
+			abcd = vsha1pq_u32(abcd, e, t);
+		}
+		e = ne;
+		mt = m0;
+		if (i < 16) {
+			mt = vsha1su1q_u32(vsha1su0q_u32(m0, m1, m2), m3);
+		}
+		m0 = m1;
+		m1 = m2;
+		m2 = m3;
+		m3 = mt;
+	}
+	vst1q_u32(val, vaddq_u32(abcd, abcd0));
+	val[4] = e + e0;
+}
+
+#endif
+
 /* see inner.h */
 void
 br_sha1_round(const unsigned char *buf, uint32_t *val)
@@ -49,6 +103,10 @@ br_sha1_round(const unsigned char *buf, uint32_t *val)
 	uint32_t a, b, c, d, e;
 	int i;
 
+#if BR_ARMV8_CE
+	sha1_round_armv8(buf, val);
+	return;
+#endif
 	a = val[0];
 	b = val[1];
 	c = val[2];
@@ -117,6 +175,16 @@ br_sha1_update(br_sha1_context *cc, const void *data, size_t len)
 	while (len > 0) {
 		size_t clen;
 
+#if BR_SHA_HW
+		if (ptr == 0 && len >= 64) {
+			clen = len & ~(size_t)63;
+			br_sha1_hw_blocks(buf, clen >> 6, cc->val);
+			buf += clen;
+			len -= clen;
+			cc->count += (uint64_t)clen;
+			continue;
+		}
+#endif
 		clen = 64 - ptr;
 		if (clen > len) {
 			clen = len;
@@ -127,7 +195,11 @@ br_sha1_update(br_sha1_context *cc, const void *data, size_t len)
 		len -= clen;
 		cc->count += (uint64_t)clen;
 		if (ptr == 64) {
+#if BR_SHA_HW
+			br_sha1_hw_blocks(cc->buf, 1, cc->val);
+#else
 			br_sha1_round(cc->buf, cc->val);
+#endif
 			ptr = 0;
 		}
 	}
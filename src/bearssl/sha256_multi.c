@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define BR_ENABLE_INTRINSICS   1
+#include "inner.h"
+
+/*
+ * Hash the messages one after the other.
+ */
+static void
+sha256_multi_seq(unsigned char *out, const void *const *data,
+	size_t num, size_t len)
+{
+	br_sha256_context sc;
+	size_t u;
+
+	for (u = 0; u < num; u ++) {
+		br_sha256_init(&sc);
+		br_sha256_update(&sc, data[u], len);
+		br_sha256_out(&sc, out + (u << 5));
+	}
+}
+
+#if BR_SSE2
+
+/*
+ * Four SHA-256 computations in lockstep, one per 32-bit lane of the
+ * SSE2 registers: lane i holds the state words and message words of
+ * message i. All messages have the same length, hence the same number
+ * of blocks and the same padding position.
+ */
+
+static const uint32_t K[64] = {
+	0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5,
+	0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+	0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3,
+	0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+	0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC,
+	0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+	0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7,
+	0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+	0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13,
+	0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+	0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3,
+	0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+	0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5,
+	0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+	0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208,
+	0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+};
+
+BR_TARGETS_X86_UP
+
+#define ROTR(x, n)    _mm_or_si128( \
+		_mm_srli_epi32(x, n), _mm_slli_epi32(x, 32 - (n)))
+#define XOR3(x, y, z)   _mm_xor_si128(_mm_xor_si128(x, y), z)
+#define ADD(x, y)       _mm_add_epi32(x, y)
+
+#define BSG2_0(x)   XOR3(ROTR(x, 2), ROTR(x, 13), ROTR(x, 22))
+#define BSG2_1(x)   XOR3(ROTR(x, 6), ROTR(x, 11), ROTR(x, 25))
+#define SSG2_0(x)   XOR3(ROTR(x, 7), ROTR(x, 18), _mm_srli_epi32(x, 3))
+#define SSG2_1(x)   XOR3(ROTR(x, 17), ROTR(x, 19), _mm_srli_epi32(x, 10))
+
+#define CH(x, y, z)    _mm_xor_si128(_mm_and_si128( \
+		_mm_xor_si128(y, z), x), z)
+#define MAJ(x, y, z)   _mm_or_si128(_mm_and_si128(y, z), \
+		_mm_and_si128(_mm_or_si128(y, z), x))
+
+/*
+ * Process one 64-byte block of each of the four messages.
+ */
+BR_TARGET("sse2")
+static void
+sha256_x4_round(const unsigned char *const *blk, __m128i *val)
+{
+	__m128i w[16];
+	__m128i a, b, c, d, e, f, g, h;
+	int i;
+
+	for (i = 0; i < 16; i ++) {
+		w[i] = _mm_set_epi32(
+			(int)br_dec32be(blk[3] + (i << 2)),
+			(int)br_dec32be(blk[2] + (i << 2)),
+			(int)br_dec32be(blk[1] + (i << 2)),
+			(int)br_dec32be(blk[0] + (i << 2)));
+	}
+	a = val[0];
+	b = val[1];
+	c = val[2];
+	d = val[3];
+	e = val[4];
+	f = val[5];
+	g = val[6];
+	h = val[7];
+	for (i = 0; i < 64; i ++) {
+		__m128i wt, t1, t2;
+
+		if (i < 16) {
+			wt = w[i];
+		} else {
+			wt = ADD(ADD(SSG2_1(w[(i - 2) & 15]), w[(i - 7) & 15]),
+				ADD(SSG2_0(w[(i - 15) & 15]), w[i & 15]));
+			w[i & 15] = wt;
+		}
+		t1 = ADD(ADD(ADD(h, BSG2_1(e)), ADD(CH(e, f, g), wt)),
+			_mm_set1_epi32((int)K[i]));
+		t2 = ADD(BSG2_0(a), MAJ(a, b, c));
+		h = g;
+		g = f;
+		f = e;
+		e = ADD(d, t1);
+		d = c;
+		c = b;
+		b = a;
+		a = ADD(t1, t2);
+	}
+	val[0] = ADD(val[0], a);
+	val[1] = ADD(val[1], b);
+	val[2] = ADD(val[2], c);
+	val[3] = ADD(val[3], d);
+	val[4] = ADD(val[4], e);
+	val[5] = ADD(val[5], f);
+	val[6] = ADD(val[6], g);
+	val[7] = ADD(val[7], h);
+}
+
+/*
+ * Hash four messages (lanes may repeat a message when fewer remain).
+ */
+BR_TARGET("sse2")
+static void
+sha256_x4(unsigned char *const *out, const unsigned char *const *data,
+	size_t len)
+{
+	__m128i val[8];
+	unsigned char tail[4][128];
+	const unsigned char *blk[4];
+	size_t num, rem, tlen, u;
+	int i;
+
+	for (i = 0; i < 8; i ++) {
+		val[i] = _mm_set1_epi32((int)br_sha256_IV[i]);
+	}
+	num = len >> 6;
+	for (u = 0; u < num; u ++) {
+		for (i = 0; i < 4; i ++) {
+			blk[i] = data[i] + (u << 6);
+		}
+		sha256_x4_round(blk, val);
+	}
+
+	/*
+	 * Padding: one block if the 0x80 byte and the 64-bit length fit
+	 * after the remaining bytes, two otherwise.
+	 */
+	rem = len & 63;
+	tlen = rem < 56 ? 64 : 128;
+	for (i = 0; i < 4; i ++) {
+		memcpy(tail[i], data[i] + (num << 6), rem);
+		tail[i][rem] = 0x80;
+		memset(tail[i] + rem + 1, 0, tlen - rem - 9);
+		br_enc64be(tail[i] + tlen - 8, (uint64_t)len << 3);
+	}
+	for (u = 0; u < tlen; u += 64) {
+		for (i = 0; i < 4; i ++) {
+			blk[i] = tail[i] + u;
+		}
+		sha256_x4_round(blk, val);
+	}
+
+	for (i = 0; i < 8; i ++) {
+		uint32_t tmp[4];
+		int j;
+
+		_mm_storeu_si128((__m128i *)tmp, val[i]);
+		for (j = 0; j < 4; j ++) {
+			if (out[j] != NULL) {
+				br_enc32be(out[j] + (i << 2), tmp[j]);
+			}
+		}
+	}
+}
+
+#undef ROTR
+#undef XOR3
+#undef ADD
+#undef BSG2_0
+#undef BSG2_1
+#undef SSG2_0
+#undef SSG2_1
+#undef CH
+#undef MAJ
+
+BR_TARGETS_X86_DOWN
+
+/*
+ * SSE2 is part of the amd64 ABI; in 32-bit mode, it is indicated by
+ * bit 26 in EDX.
+ */
+static int
+sha256_multi_sse2(void)
+{
+#if BR_amd64
+	return 1;
+#else
+	return br_cpuid(0, 0, 0, 0x04000000);
+#endif
+}
+
+#endif
+
+/* see bearssl_hash.h */
+void
+br_sha256_multi(void *out, const void *const *data, size_t num, size_t len)
+{
+	unsigned char *buf;
+
+	buf = out;
+#if BR_SSE2
+	if (num > 1 && sha256_multi_sse2()) {
+		while (num > 0) {
+			unsigned char *lout[4];
+			const unsigned char *ldata[4];
+			int i;
+
+			/*
+			 * Unused lanes hash the first message again, and
+			 * their output is dropped.
+			 */
+			for (i = 0; i < 4; i ++) {
+				if ((size_t)i < num) {
+					lout[i] = buf + (i << 5);
+					ldata[i] = data[i];
+				} else {
+					lout[i] = NULL;
+					ldata[i] = data[0];
+				}
+			}
+			sha256_x4(lout, ldata, len);
+			if (num <= 4) {
+				break;
+			}
+			buf += 4 << 5;
+			data += 4;
+			num -= 4;
+		}
+		return;
+	}
+#endif
+	sha256_multi_seq(buf, data, num, len);
+}
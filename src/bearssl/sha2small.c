@@ -22,6 +22,7 @@
  * SOFTWARE.
  */
 
+#define BR_ENABLE_INTRINSICS   1
 #include "inner.h"
 
 #define CH(X, Y, Z)    ((((Y) ^ (Z)) & (X)) ^ (Z))
@@ -46,7 +47,7 @@ const uint32_t br_sha256_IV[8] = {
 	0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19
 };
 
-static const uint32_t K[64] = {
+static const uint32_t K[64] BR_FAST_TABLE BR_FLASH_TABLE = {
 	0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5,
 	0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
 	0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3,
@@ -65,14 +66,166 @@ static const uint32_t K[64] = {
 	0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
 };
 
+#if BR_ARMV8_CE
+
+/*
+ * SHA-256 compression with the ARMv8 SHA-256 opcodes, four rounds per
+ * sha256h/sha256h2 pair, the message schedule four words at a time.
+ */
+static void
+sha2small_round_armv8(const unsigned char *buf, uint32_t *val)
+{
+	uint32x4_t abcd, efgh, abcd0, efgh0, m0, m1, m2, m3;
+	int i;
+
+	abcd0 = abcd = vld1q_u32(val);
+	efgh0 = efgh = vld1q_u32(val + 4);
+	m0 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(buf +  0)));
+	m1 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(buf + 16)));
+	m2 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(buf + 32)));
+	m3 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(buf + 48)));
+	for (i = 0; i < 16; i ++) {
+		uint32x4_t t, tmp, mt;
+
+		t = vaddq_u32(m0, vld1q_u32(K + (i << 2)));
+		tmp = abcd;
+		abcd = vsha256hq_u32(abcd, efgh, t);
+		efgh = vsha256h2q_u32(efgh, tmp, t);
+		mt = m0;
+		if (i < 12) {
+			mt = vsha256su1q_u32(vsha256su0q_u32(m0, m1), m2, m3);
+		}
+		m0 = m1;
+		m1 = m2;
+		m2 = m3;
+		m3 = mt;
+	}
+	vst1q_u32(val, vaddq_u32(abcd, abcd0));
+	vst1q_u32(val + 4, vaddq_u32(efgh, efgh0));
+}
+
+#endif
+
+#if BR_ARMEL_CORTEXM_GCC && __thumb2__
+
+/*
+ * SHA-256 compression for the ARMv7-M cores (Cortex M3/M4/M7, see
+ * BR_ARMEL_CORTEXM_GCC in config.h). The eight state words stay in
+ * r4..r11 for the whole block, with the byte-swapped message words in
+ * a 16-word circular buffer (r1) and the round constants in r0.
+ * Each step computes the schedule word W[t+16] in place of W[t], and
+ * uses the immediate rotations of the Thumb-2 shifted operands for the
+ * sigma functions. The sixteen steps are unrolled, so that the state
+ * variables are renamed instead of moved; the last sixteen steps compute
+ * schedule words that are not used.
+ *
+ * ARMv6-M (M0/M0+) has no shifted operands, and uses the C code.
+ */
+
+#define SHA2_CM_STEP(A, B, C, D, E, F, G, H, w0, w1, w9, w14) \
+	"ldr    r2, [r1, #" #w1 "]\n\t" \
+	"ror    r12, r2, #7\n\t" \
+	"eor    r12, r12, r2, ror #18\n\t" \
+	"eor    r12, r12, r2, lsr #3\n\t" \
+	"ldr    r2, [r1, #" #w14 "]\n\t" \
+	"ror    lr, r2, #17\n\t" \
+	"eor    lr, lr, r2, ror #19\n\t" \
+	"eor    lr, lr, r2, lsr #10\n\t" \
+	"add    r12, r12, lr\n\t" \
+	"ldr    r2, [r1, #" #w9 "]\n\t" \
+	"add    r12, r12, r2\n\t" \
+	"ldr    r3, [r1, #" #w0 "]\n\t" \
+	"add    r12, r12, r3\n\t" \
+	"str    r12, [r1, #" #w0 "]\n\t" \
+	"ldr    r2, [r0], #4\n\t" \
+	"add    r3, r3, r2\n\t" \
+	"add    " #H ", " #H ", r3\n\t" \
+	"ror    r2, " #E ", #6\n\t" \
+	"eor    r2, r2, " #E ", ror #11\n\t" \
+	"eor    r2, r2, " #E ", ror #25\n\t" \
+	"add    " #H ", " #H ", r2\n\t" \
+	"eor    r2, " #F ", " #G "\n\t" \
+	"and    r2, r2, " #E "\n\t" \
+	"eor    r2, r2, " #G "\n\t" \
+	"add    " #H ", " #H ", r2\n\t" \
+	"add    " #D ", " #D ", " #H "\n\t" \
+	"ror    r2, " #A ", #2\n\t" \
+	"eor    r2, r2, " #A ", ror #13\n\t" \
+	"eor    r2, r2, " #A ", ror #22\n\t" \
+	"add    " #H ", " #H ", r2\n\t" \
+	"orr    r2, " #A ", " #B "\n\t" \
+	"and    r2, r2, " #C "\n\t" \
+	"and    r3, " #A ", " #B "\n\t" \
+	"orr    r2, r2, r3\n\t" \
+	"add    " #H ", " #H ", r2\n\t"
+
+static void
+sha2small_round_cortexm(const unsigned char *buf, uint32_t *val)
+{
+	uint32_t w[16];
+	uint32_t *wp;
+	const uint32_t *k, *kend;
+
+	br_range_dec32be(w, 16, buf);
+	wp = w;
+	k = K;
+	kend = K + 64;
+	__asm__ __volatile__ (
+	"ldr    r0, %[k]\n\t"
+	"ldr    r1, %[w]\n\t"
+	"ldr    r2, %[val]\n\t"
+	"ldm    r2, {r4, r5, r6, r7, r8, r9, r10, r11}\n\t"
+	"1:\n\t"
+	SHA2_CM_STEP(r4, r5, r6, r7, r8, r9, r10, r11,  0,  4, 36, 56)
+	SHA2_CM_STEP(r11, r4, r5, r6, r7, r8, r9, r10,  4,  8, 40, 60)
+	SHA2_CM_STEP(r10, r11, r4, r5, r6, r7, r8, r9,  8, 12, 44,  0)
+	SHA2_CM_STEP(r9, r10, r11, r4, r5, r6, r7, r8, 12, 16, 48,  4)
+	SHA2_CM_STEP(r8, r9, r10, r11, r4, r5, r6, r7, 16, 20, 52,  8)
+	SHA2_CM_STEP(r7, r8, r9, r10, r11, r4, r5, r6, 20, 24, 56, 12)
+	SHA2_CM_STEP(r6, r7, r8, r9, r10, r11, r4, r5, 24, 28, 60, 16)
+	SHA2_CM_STEP(r5, r6, r7, r8, r9, r10, r11, r4, 28, 32,  0, 20)
+	SHA2_CM_STEP(r4, r5, r6, r7, r8, r9, r10, r11, 32, 36,  4, 24)
+	SHA2_CM_STEP(r11, r4, r5, r6, r7, r8, r9, r10, 36, 40,  8, 28)
+	SHA2_CM_STEP(r10, r11, r4, r5, r6, r7, r8, r9, 40, 44, 12, 32)
+	SHA2_CM_STEP(r9, r10, r11, r4, r5, r6, r7, r8, 44, 48, 16, 36)
+	SHA2_CM_STEP(r8, r9, r10, r11, r4, r5, r6, r7, 48, 52, 20, 40)
+	SHA2_CM_STEP(r7, r8, r9, r10, r11, r4, r5, r6, 52, 56, 24, 44)
+	SHA2_CM_STEP(r6, r7, r8, r9, r10, r11, r4, r5, 56, 60, 28, 48)
+	SHA2_CM_STEP(r5, r6, r7, r8, r9, r10, r11, r4, 60,  0, 32, 52)
+	"ldr    r2, %[kend]\n\t"
+	"cmp    r0, r2\n\t"
+	"bne    1b\n\t"
+	"ldr    r12, %[val]\n\t"
+	"ldm    r12, {r0, r1, r2, r3}\n\t"
+	"add    r4, r4, r0\n\t"
+	"add    r5, r5, r1\n\t"
+	"add    r6, r6, r2\n\t"
+	"add    r7, r7, r3\n\t"
+	"add    lr, r12, #16\n\t"
+	"ldm    lr, {r0, r1, r2, r3}\n\t"
+	"add    r8, r8, r0\n\t"
+	"add    r9, r9, r1\n\t"
+	"add    r10, r10, r2\n\t"
+	"add    r11, r11, r3\n\t"
+	"stm    r12, {r4, r5, r6, r7, r8, r9, r10, r11}"
+	:
+	: [k] "m" (k), [kend] "m" (kend), [w] "m" (wp), [val] "m" (val)
+	: "r0", "r1", "r2", "r3", "r4", "r5", "r6", "r7", "r8", "r9",
+	  "r10", "r11", "r12", "lr", "cc", "memory");
+}
+
+#undef SHA2_CM_STEP
+
+#endif
+
 /* see inner.h */
-void
+BR_FAST_FUNC void
 br_sha2small_round(const unsigned char *buf, uint32_t *val)
 {
 
 #define SHA2_STEP(A, B, C, D, E, F, G, H, j)   do { \
 		uint32_t T1, T2; \
-		T1 = H + BSG2_1(E) + CH(E, F, G) + K[j] + w[j]; \
+		T1 = H + BSG2_1(E) + CH(E, F, G) + BR_FLASH_U32(K, j) + w[j]; \
 		T2 = BSG2_0(A) + MAJ(A, B, C); \
 		D += T1; \
 		H = T1 + T2; \
@@ -82,6 +235,13 @@ br_sha2small_round(const unsigned char *buf, uint32_t *val)
 	uint32_t a, b, c, d, e, f, g, h;
 	uint32_t w[64];
 
+#if BR_ARMV8_CE
+	sha2small_round_armv8(buf, val);
+	return;
+#elif BR_ARMEL_CORTEXM_GCC && __thumb2__
+	sha2small_round_cortexm(buf, val);
+	return;
+#endif
 	br_range_dec32be(w, 16, buf);
 	for (i = 16; i < 64; i ++) {
 		w[i] = SSG2_1(w[i - 2]) + w[i - 7]
@@ -211,6 +371,15 @@ sha2small_update(br_sha224_context *cc, const void *data, size_t len)
 	while (len > 0) {
 		size_t clen;
 
+#if BR_SHA_HW
+		if (ptr == 0 && len >= 64) {
+			clen = len & ~(size_t)63;
+			br_sha2small_hw_blocks(buf, clen >> 6, cc->val);
+			buf += clen;
+			len -= clen;
+			continue;
+		}
+#endif
 		clen = 64 - ptr;
 		if (clen > len) {
 			clen = len;
@@ -220,7 +389,11 @@ sha2small_update(br_sha224_context *cc, const void *data, size_t len)
 		buf += clen;
 		len -= clen;
 		if (ptr == 64) {
+#if BR_SHA_HW
+			br_sha2small_hw_blocks(cc->buf, 1, cc->val);
+#else
 			br_sha2small_round(cc->buf, cc->val);
+#endif
 			ptr = 0;
 		}
 	}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "inner.h"
+
+#if BR_SHA_HW
+
+#if BR_SHA_HW_ESP32
+#include "soc/soc_caps.h"
+#if SOC_SHA_SUPPORT_DMA
+#if defined __has_include
+#if __has_include("sha/sha_core.h")
+#include "sha/sha_core.h"
+#else
+#include "sha/sha_dma.h"
+#endif
+#else
+#include "sha/sha_dma.h"
+#endif
+#else
+/*
+ * The original ESP32 accelerator cannot be loaded with a saved state,
+ * so it is of no use for an arbitrary running hash.
+ */
+#define SHA_HW_SOFT   1
+#endif
+#elif BR_SHA_HW_SAMD51
+#include <sam.h>
+#endif
+
+#if SHA_HW_SOFT
+
+/* see inner.h */
+void
+br_sha1_hw_blocks(const unsigned char *buf, size_t num, uint32_t *val)
+{
+	while (num -- > 0) {
+		br_sha1_round(buf, val);
+		buf += 64;
+	}
+}
+
+/* see inner.h */
+void
+br_sha2small_hw_blocks(const unsigned char *buf, size_t num, uint32_t *val)
+{
+	while (num -- > 0) {
+		br_sha2small_round(buf, val);
+		buf += 64;
+	}
+}
+
+#else
+
+#if BR_SHA_HW_ESP32
+
+#define HW_SHA1     SHA1
+#define HW_SHA256   SHA2_256
+
+/*
+ * The accelerator state is the chaining value in big-endian order; it
+ * is written back before, and read after, the DMA run over the blocks.
+ * esp_sha_dma() copies input that is not DMA-capable (e.g. in flash)
+ * through internal RAM.
+ */
+static void
+hw_blocks(esp_sha_type type, size_t words,
+	const unsigned char *buf, size_t num, uint32_t *val)
+{
+	uint32_t state[8];
+
+	br_range_enc32be(state, val, words);
+	esp_sha_acquire_hardware();
+	esp_sha_write_digest_state(type, state);
+	esp_sha_dma(type, buf, (uint32_t)(num << 6), NULL, 0, false);
+	esp_sha_read_digest_state(type, state);
+	esp_sha_release_hardware();
+	br_range_dec32be(val, words, state);
+}
+
+#elif BR_SHA_HW_SAMD51
+
+#define HW_SHA1     ICM_CFG_UALGO_SHA1_Val
+#define HW_SHA256   ICM_CFG_UALGO_SHA256_Val
+
+/*
+ * The ICM reads a region of whole (already padded) blocks by DMA,
+ * starting from the user initial hash value, and writes the resulting
+ * chaining value to the hash area. Both are in big-endian order; a
+ * region covers at most 65536 blocks.
+ */
+static struct {
+	uint32_t raddr;
+	uint32_t rcfg;
+	uint32_t rctrl;
+	uint32_t rnext;
+} hw_dscr __attribute__((aligned(64)));
+
+static uint32_t hw_hash[32] __attribute__((aligned(128)));
+
+static void
+hw_blocks(uint32_t algo, size_t words,
+	const unsigned char *buf, size_t num, uint32_t *val)
+{
+	size_t u;
+
+	MCLK->AHBMASK.reg |= MCLK_AHBMASK_ICM;
+	MCLK->APBCMASK.reg |= MCLK_APBCMASK_ICM;
+	while (num > 0) {
+		size_t n;
+
+		n = num < 65536 ? num : 65536;
+		ICM->CTRL.reg = ICM_CTRL_SWRST;
+		ICM->CFG.reg = ICM_CFG_SLBDIS | ICM_CFG_UIHASH
+			| ICM_CFG_UALGO(algo);
+		for (u = 0; u < words; u ++) {
+			ICM->UIHVAL[u].reg = br_swap32(val[u]);
+		}
+		hw_dscr.raddr = (uint32_t)buf;
+		hw_dscr.rcfg = ICM_RCFG_EOM | ICM_RCFG_ALGO(algo);
+		hw_dscr.rctrl = (uint32_t)(n - 1);
+		hw_dscr.rnext = 0;
+		ICM->DSCR.reg = (uint32_t)&hw_dscr;
+		ICM->HASH.reg = (uint32_t)hw_hash;
+		ICM->CTRL.reg = ICM_CTRL_ENABLE;
+		while (!(ICM->ISR.reg & ICM_ISR_RHC(1)));
+		ICM->CTRL.reg = ICM_CTRL_DISABLE;
+		br_range_dec32be(val, words, hw_hash);
+		buf += n << 6;
+		num -= n;
+	}
+}
+
+#endif
+
+/* see inner.h */
+void
+br_sha1_hw_blocks(const unsigned char *buf, size_t num, uint32_t *val)
+{
+	hw_blocks(HW_SHA1, 5, buf, num, val);
+}
+
+/* see inner.h */
+void
+br_sha2small_hw_blocks(const unsigned char *buf, size_t num, uint32_t *val)
+{
+	hw_blocks(HW_SHA256, 8, buf, num, val);
+}
+
+#endif
+
+#endif
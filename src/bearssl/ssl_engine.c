@@ -688,6 +688,11 @@ recvrec_ack(br_ssl_engine_context *rc, size_t len)
 				br_ssl_engine_fail(rc, BR_ERR_TOO_LARGE);
 				return;
 			}
+#ifdef ARDUINO
+			if (5 + rlen > rc->max_record_in) {
+				rc->max_record_in = 5 + rlen;
+			}
+#endif
 		} else {
 			if (rlen > 16384) {
 				br_ssl_engine_fail(rc, BR_ERR_BAD_LENGTH);
@@ -853,6 +858,11 @@ sendpld_flush(br_ssl_engine_context *rc, int force)
 		rc->obuf + rc->oxc, &xlen);
 	rc->oxb = rc->oxa = (size_t)(buf - rc->obuf);
 	rc->oxc = rc->oxa + xlen;
+#ifdef ARDUINO
+	if (xlen > rc->max_record_out) {
+		rc->max_record_out = xlen;
+	}
+#endif
 }
 
 static void
@@ -1301,6 +1311,7 @@ br_ssl_engine_hs_reset(br_ssl_engine_context *cc,
 	cc->shutdown_recv = 0;
 	cc->application_data = 0;
 	cc->alert = 0;
+	cc->master_kc.dig_vtable = NULL;
 	jump_handshake(cc, 0);
 }
 
@@ -1333,6 +1344,42 @@ br_ssl_engine_compute_master(br_ssl_engine_context *cc,
 	iprf = br_ssl_engine_get_PRF(cc, prf_id);
 	iprf(cc->session.master_secret, sizeof cc->session.master_secret,
 		pms, pms_len, "master secret", 2, seed);
+	cc->master_kc.dig_vtable = NULL;
+}
+
+/* see inner.h */
+void
+br_ssl_engine_prf_master(br_ssl_engine_context *cc, int prf_id,
+	void *dst, size_t len, const char *label,
+	size_t seed_num, const br_tls_prf_seed_chunk *seed)
+{
+	const br_hash_class *dig;
+
+	dig = NULL;
+	if (cc->session.version >= BR_TLS12) {
+		dig = br_multihash_getimpl(&cc->mhash,
+			prf_id == br_sha384_ID ? br_sha384_ID : br_sha256_ID);
+	}
+	if (dig == NULL) {
+		br_ssl_engine_get_PRF(cc, prf_id)(dst, len,
+			cc->session.master_secret,
+			sizeof cc->session.master_secret,
+			label, seed_num, seed);
+		return;
+	}
+
+	/*
+	 * The key schedule costs two compression function calls, and
+	 * each handshake runs the PRF over the master secret four times
+	 * (key block for each direction, two Finished messages).
+	 */
+	if (cc->master_kc.dig_vtable != dig) {
+		br_hmac_key_init(&cc->master_kc, dig,
+			cc->session.master_secret,
+			sizeof cc->session.master_secret);
+	}
+	memset(dst, 0, len);
+	br_tls_phash_keyed(dst, len, &cc->master_kc, label, seed_num, seed);
 }
 
 /*
@@ -1342,15 +1389,12 @@ static void
 compute_key_block(br_ssl_engine_context *cc, int prf_id,
 	size_t half_len, unsigned char *kb)
 {
-	br_tls_prf_impl iprf;
 	br_tls_prf_seed_chunk seed[2] = {
 		{ cc->server_random, sizeof cc->server_random },
 		{ cc->client_random, sizeof cc->client_random }
 	};
 
-	iprf = br_ssl_engine_get_PRF(cc, prf_id);
-	iprf(kb, half_len << 1,
-		cc->session.master_secret, sizeof cc->session.master_secret,
+	br_ssl_engine_prf_master(cc, prf_id, kb, half_len << 1,
 		"key expansion", 2, seed);
 }
 
@@ -28,7 +28,7 @@
 void
 br_ssl_engine_set_default_aes_cbc(br_ssl_engine_context *cc)
 {
-#if BR_AES_X86NI || BR_POWER8
+#if BR_AES_X86NI || BR_POWER8 || BR_ARMV8_CE || BR_AES_HW
 	const br_block_cbcenc_class *ienc;
 	const br_block_cbcdec_class *idec;
 #endif
@@ -52,6 +52,26 @@ br_ssl_engine_set_default_aes_cbc(br_ssl_engine_context *cc)
 		return;
 	}
 #endif
+#if BR_ARMV8_CE
+	ienc = br_aes_armv8_cbcenc_get_vtable();
+	idec = br_aes_armv8_cbcdec_get_vtable();
+	if (ienc != NULL && idec != NULL) {
+		br_ssl_engine_set_aes_cbc(cc, ienc, idec);
+		return;
+	}
+#endif
+#if BR_AES_HW
+	/*
+	 * The peripheral may only encrypt (nRF52).
+	 */
+	ienc = br_aes_hw_cbcenc_get_vtable();
+	idec = br_aes_hw_cbcdec_get_vtable();
+	if (ienc != NULL) {
+		br_ssl_engine_set_aes_cbc(cc, ienc,
+			idec != NULL ? idec : &br_aes_ct_cbcdec_vtable);
+		return;
+	}
+#endif
 #if BR_64
 	br_ssl_engine_set_aes_cbc(cc,
 		&br_aes_ct64_cbcenc_vtable,
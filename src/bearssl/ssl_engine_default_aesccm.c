@@ -28,7 +28,7 @@
 void
 br_ssl_engine_set_default_aes_ccm(br_ssl_engine_context *cc)
 {
-#if BR_AES_X86NI || BR_POWER8
+#if BR_AES_X86NI || BR_POWER8 || BR_ARMV8_CE
 	const br_block_ctrcbc_class *ictrcbc;
 #endif
 
@@ -57,6 +57,9 @@ br_ssl_engine_set_default_aes_ccm(br_ssl_engine_context *cc)
 		br_ssl_engine_set_aes_ctrcbc(cc, &br_aes_ct_ctrcbc_vtable);
 #endif
 	}
+#elif BR_ARMV8_CE
+	ictrcbc = br_aes_armv8_ctrcbc_get_vtable();
+	br_ssl_engine_set_aes_ctrcbc(cc, ictrcbc);
 #else
 #if BR_64
 	br_ssl_engine_set_aes_ctrcbc(cc, &br_aes_ct64_ctrcbc_vtable);
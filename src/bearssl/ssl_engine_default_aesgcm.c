@@ -28,8 +28,10 @@
 void
 br_ssl_engine_set_default_aes_gcm(br_ssl_engine_context *cc)
 {
-#if BR_AES_X86NI || BR_POWER8
+#if BR_AES_X86NI || BR_POWER8 || BR_ARMV8_CE || BR_AES_HW
 	const br_block_ctr_class *ictr;
+#endif
+#if BR_AES_X86NI || BR_POWER8 || BR_ARMV8_CE
 	br_ghash ighash;
 #endif
 
@@ -58,6 +60,16 @@ br_ssl_engine_set_default_aes_gcm(br_ssl_engine_context *cc)
 		br_ssl_engine_set_aes_ctr(cc, &br_aes_ct_ctr_vtable);
 #endif
 	}
+#elif BR_ARMV8_CE
+	ictr = br_aes_armv8_ctr_get_vtable();
+	br_ssl_engine_set_aes_ctr(cc, ictr);
+#elif BR_AES_HW
+	ictr = br_aes_hw_ctr_get_vtable();
+	if (ictr != NULL) {
+		br_ssl_engine_set_aes_ctr(cc, ictr);
+	} else {
+		br_ssl_engine_set_aes_ctr(cc, &br_aes_ct_ctr_vtable);
+	}
 #else
 #if BR_64
 	br_ssl_engine_set_aes_ctr(cc, &br_aes_ct64_ctr_vtable);
@@ -79,7 +91,20 @@ br_ssl_engine_set_default_aes_gcm(br_ssl_engine_context *cc)
 		return;
 	}
 #endif
-#if BR_LOMUL
+#if BR_ARMV8_CE
+	ighash = br_ghash_pmull_get();
+	if (ighash != 0) {
+		br_ssl_engine_set_ghash(cc, ighash);
+		return;
+	}
+#endif
+#if defined(ARDUINO) && defined(__ARM_ARCH_7EM__)
+	/*
+	 * Cortex-M4/M7 have a single-cycle, constant-time 32x32->64
+	 * multiplication (UMULL), which br_ghash_ctmul uses.
+	 */
+	br_ssl_engine_set_ghash(cc, &br_ghash_ctmul);
+#elif BR_LOMUL
 	br_ssl_engine_set_ghash(cc, &br_ghash_ctmul32);
 #elif BR_64
 	br_ssl_engine_set_ghash(cc, &br_ghash_ctmul64);
@@ -44,7 +44,11 @@ br_ssl_engine_set_default_chapol(br_ssl_engine_context *cc)
 		br_ssl_engine_set_chacha20(cc, bc);
 	} else {
 #endif
+#if defined(ARDUINO) && BR_ARMEL_CORTEXM_GCC
+		br_ssl_engine_set_chacha20(cc, &br_chacha20_cortexm_run);
+#else
 		br_ssl_engine_set_chacha20(cc, &br_chacha20_ct_run);
+#endif
 #if BR_SSE2
 	}
 #endif
@@ -54,7 +58,13 @@ br_ssl_engine_set_default_chapol(br_ssl_engine_context *cc)
 		br_ssl_engine_set_poly1305(cc, bp);
 	} else {
 #endif
-#if BR_LOMUL
+#if defined(ARDUINO) && defined(__ARM_ARCH_7EM__)
+		/*
+		 * Radix 2^26 with 32x32->64 multiplications (UMULL and
+		 * UMLAL, constant-time on the Cortex-M4/M7).
+		 */
+		br_ssl_engine_set_poly1305(cc, &br_poly1305_ctmul_run);
+#elif BR_LOMUL
 		br_ssl_engine_set_poly1305(cc, &br_poly1305_ctmul32_run);
 #else
 		br_ssl_engine_set_poly1305(cc, &br_poly1305_ctmul_run);
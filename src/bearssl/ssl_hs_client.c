@@ -268,6 +268,10 @@ make_pms_ecdh(br_ssl_client_context *ctx, unsigned ecdhe, int prf_id)
 	const unsigned char *order, *point_src;
 	size_t glen, olen, point_len, xoff, xlen;
 	unsigned char mask;
+#ifdef ARDUINO
+	br_ssl_ecdhe_key *pre;
+	unsigned char pre_point[65];
+#endif
 
 	if (ecdhe) {
 		curve = ctx->eng.ecdhe_curve;
@@ -301,6 +305,22 @@ make_pms_ecdh(br_ssl_client_context *ctx, unsigned ecdhe, int prf_id)
 	br_hmac_drbg_generate(&ctx->eng.rng, key, olen);
 	key[0] &= mask;
 	key[olen - 1] |= 0x01;
+#ifdef ARDUINO
+	/*
+	 * A precomputed key for this curve replaces the fresh one; it
+	 * is used only once.
+	 */
+	pre = ctx->ecdhe_key;
+	if (pre != NULL && ecdhe && pre->curve == curve
+		&& pre->key_len == olen && pre->point_len == point_len)
+	{
+		memcpy(key, pre->key, olen);
+		memcpy(pre_point, pre->point, point_len);
+		memset(pre, 0, sizeof *pre);
+	} else {
+		pre = NULL;
+	}
+#endif
 
 	/*
 	 * Compute the common ECDH point, whose X coordinate is the
@@ -322,11 +342,54 @@ make_pms_ecdh(br_ssl_client_context *ctx, unsigned ecdhe, int prf_id)
 	xoff = ctx->eng.iec->xoff(curve, &xlen);
 	br_ssl_engine_compute_master(&ctx->eng, prf_id, point + xoff, xlen);
 
+#ifdef ARDUINO
+	if (pre != NULL) {
+		memcpy(ctx->eng.pad, pre_point, glen);
+		return (int)glen;
+	}
+#endif
 	ctx->eng.iec->mulgen(point, key, olen, curve);
 	memcpy(ctx->eng.pad, point, glen);
 	return (int)glen;
 }
 
+#ifdef ARDUINO
+/* see bearssl_ssl.h */
+int
+br_ssl_ecdhe_key_generate(br_ssl_ecdhe_key *key, const br_ec_impl *iec,
+	const br_prng_class **rng, int curve)
+{
+	const unsigned char *order;
+	size_t olen, glen;
+	unsigned char mask;
+
+	memset(key, 0, sizeof *key);
+	if ((iec->supported_curves & ((uint32_t)1 << curve)) == 0) {
+		return 0;
+	}
+	order = iec->order(curve, &olen);
+	iec->generator(curve, &glen);
+	if (olen > sizeof key->key || glen > sizeof key->point) {
+		return 0;
+	}
+
+	/*
+	 * Same key generation as in make_pms_ecdh().
+	 */
+	mask = 0xFF;
+	while (mask >= order[0]) {
+		mask >>= 1;
+	}
+	(*rng)->generate(rng, key->key, olen);
+	key->key[0] &= mask;
+	key->key[olen - 1] |= 0x01;
+	key->key_len = olen;
+	key->point_len = iec->mulgen(key->point, key->key, olen, curve);
+	key->curve = curve;
+	return 1;
+}
+#endif
+
 /*
  * Perform full static ECDH. This occurs only in the context of client
  * authentication with certificates: the server uses an EC public key,
@@ -1206,7 +1269,6 @@ br_ssl_hs_client_run(void *t0ctx)
 	unsigned char tmp[48];
 	br_tls_prf_seed_chunk seed;
 
-	br_tls_prf_impl prf = br_ssl_engine_get_PRF(ENG, prf_id);
 	seed.data = tmp;
 	if (ENG->session.version >= BR_TLS12) {
 		seed.len = br_multihash_out(&ENG->mhash, prf_id, tmp);
@@ -1215,8 +1277,7 @@ br_ssl_hs_client_run(void *t0ctx)
 		br_multihash_out(&ENG->mhash, br_sha1_ID, tmp + 16);
 		seed.len = 36;
 	}
-	prf(ENG->pad, 12, ENG->session.master_secret,
-		sizeof ENG->session.master_secret,
+	br_ssl_engine_prf_master(ENG, prf_id, ENG->pad, 12,
 		from_client ? "client finished" : "server finished",
 		1, &seed);
 
@@ -1231,6 +1292,12 @@ br_ssl_hs_client_run(void *t0ctx)
 	if (clen > sizeof ENG->pad) {
 		clen = sizeof ENG->pad;
 	}
+#ifdef ARDUINO
+	if (ENG->cert_reader != NULL) {
+		ENG->cert_reader(ENG->cert_reader_ctx,
+			ENG->cert_cur, ENG->pad, clen);
+	} else
+#endif
 	memcpy(ENG->pad, ENG->cert_cur, clen);
 	ENG->cert_cur += clen;
 	ENG->cert_len -= clen;
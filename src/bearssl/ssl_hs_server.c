@@ -1263,7 +1263,6 @@ br_ssl_hs_server_run(void *t0ctx)
 	unsigned char tmp[48];
 	br_tls_prf_seed_chunk seed;
 
-	br_tls_prf_impl prf = br_ssl_engine_get_PRF(ENG, prf_id);
 	seed.data = tmp;
 	if (ENG->session.version >= BR_TLS12) {
 		seed.len = br_multihash_out(&ENG->mhash, prf_id, tmp);
@@ -1272,8 +1271,7 @@ br_ssl_hs_server_run(void *t0ctx)
 		br_multihash_out(&ENG->mhash, br_sha1_ID, tmp + 16);
 		seed.len = 36;
 	}
-	prf(ENG->pad, 12, ENG->session.master_secret,
-		sizeof ENG->session.master_secret,
+	br_ssl_engine_prf_master(ENG, prf_id, ENG->pad, 12,
 		from_client ? "client finished" : "server finished",
 		1, &seed);
 
@@ -1300,6 +1298,12 @@ br_ssl_hs_server_run(void *t0ctx)
 	if (clen > sizeof ENG->pad) {
 		clen = sizeof ENG->pad;
 	}
+#ifdef ARDUINO
+	if (ENG->cert_reader != NULL) {
+		ENG->cert_reader(ENG->cert_reader_ctx,
+			ENG->cert_cur, ENG->pad, clen);
+	} else
+#endif
 	memcpy(ENG->pad, ENG->cert_cur, clen);
 	ENG->cert_cur += clen;
 	ENG->cert_len -= clen;
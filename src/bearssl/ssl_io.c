@@ -241,6 +241,64 @@ int br_sslio_peek(br_sslio_context *ctx, void *dst, size_t len)
 	memcpy(dst, buf, alen);
 	return (int)alen;
 }
+
+int br_sslio_step(br_sslio_context *ctx, unsigned target)
+{
+	unsigned state;
+
+	state = br_ssl_engine_current_state(ctx->engine);
+	if (state & BR_SSL_CLOSED) {
+		return -1;
+	}
+
+	/*
+	 * Same logic as run_until(), but we perform at most one
+	 * low-level I/O operation before handing control back to
+	 * the caller.
+	 */
+	if (state & BR_SSL_SENDREC) {
+		unsigned char *buf;
+		size_t len;
+		int wlen;
+
+		buf = br_ssl_engine_sendrec_buf(ctx->engine, &len);
+		wlen = ctx->low_write(ctx->write_context, buf, len);
+		if (wlen < 0) {
+			if (!ctx->engine->shutdown_recv) {
+				br_ssl_engine_fail(ctx->engine, BR_ERR_IO);
+			}
+			return -1;
+		}
+		if (wlen > 0) {
+			br_ssl_engine_sendrec_ack(ctx->engine, wlen);
+		}
+		return 0;
+	}
+	if (state & target) {
+		return 1;
+	}
+	if (state & BR_SSL_RECVAPP) {
+		return -1;
+	}
+	if (state & BR_SSL_RECVREC) {
+		unsigned char *buf;
+		size_t len;
+		int rlen;
+
+		buf = br_ssl_engine_recvrec_buf(ctx->engine, &len);
+		rlen = ctx->low_read(ctx->read_context, buf, len);
+		if (rlen < 0) {
+			br_ssl_engine_fail(ctx->engine, BR_ERR_IO);
+			return -1;
+		}
+		if (rlen > 0) {
+			br_ssl_engine_recvrec_ack(ctx->engine, rlen);
+		}
+		return 0;
+	}
+	br_ssl_engine_flush(ctx->engine, 0);
+	return 0;
+}
 #endif
 
 /* see bearssl_ssl.h */
@@ -47,7 +47,6 @@ br_ssl_key_export(br_ssl_engine_context *cc,
 	const void *context, size_t context_len)
 {
 	br_tls_prf_seed_chunk chunks[4];
-	br_tls_prf_impl iprf;
 	size_t num_chunks, u;
 	unsigned char tmp[2];
 	int prf_id;
@@ -75,9 +74,7 @@ br_ssl_key_export(br_ssl_engine_context *cc,
 			prf_id = BR_SSLPRF_SHA384;
 		}
 	}
-	iprf = br_ssl_engine_get_PRF(cc, prf_id);
-	iprf(dst, len,
-		cc->session.master_secret, sizeof cc->session.master_secret,
+	br_ssl_engine_prf_master(cc, prf_id, dst, len,
 		label, num_chunks, chunks);
 	return 1;
 }
@@ -113,6 +113,9 @@ cbc_decrypt(br_sslrec_in_cbc_context *cc,
 	buf = data;
 	len = *data_len;
 	blen = cc->bc.vtable->block_size;
+#ifdef ARDUINO
+	BR_CRYPTO_STAT_BEGIN();
+#endif
 
 	/*
 	 * Decrypt data, and skip the explicit IV (if applicable). Note
@@ -221,6 +224,9 @@ cbc_decrypt(br_sslrec_in_cbc_context *cc,
 	 * section ends and we can make conditional jumps again.
 	 */
 	good &= LE(len_nomac, 16384);
+#ifdef ARDUINO
+	BR_CRYPTO_STAT_END(BR_CRYPTO_OP_CBC_DECRYPT, *data_len);
+#endif
 
 	if (!good) {
 		return 0;
@@ -318,6 +324,9 @@ cbc_encrypt(br_sslrec_out_cbc_context *cc,
 	buf = data;
 	len = *data_len;
 	blen = cc->bc.vtable->block_size;
+#ifdef ARDUINO
+	BR_CRYPTO_STAT_BEGIN();
+#endif
 
 	/*
 	 * If using TLS 1.0, with more than one byte of plaintext, and
@@ -410,6 +419,9 @@ cbc_encrypt(br_sslrec_out_cbc_context *cc,
 	 * block is still a uniformly random block).
 	 */
 	cc->bc.vtable->run(&cc->bc.vtable, cc->iv, buf, len);
+#ifdef ARDUINO
+	BR_CRYPTO_STAT_END(BR_CRYPTO_OP_CBC_ENCRYPT, len);
+#endif
 
 	/*
 	 * Add the header and return.
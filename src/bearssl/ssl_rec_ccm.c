@@ -93,6 +93,26 @@ ccm_decrypt(br_sslrec_ccm_context *cc,
 	/*
 	 * Perform CCM decryption.
 	 */
+#ifdef ARDUINO
+	if (cc->bc.vtable == &br_aes_ct_ctrcbc_vtable) {
+		unsigned char tag[16];
+		size_t u;
+		uint32_t bad;
+
+		br_aes_ct_ctrcbc_ccm_run(&cc->bc.aes.c_ct, 0,
+			nonce, sizeof nonce, header, sizeof header,
+			buf, len, tag, cc->tag_len);
+		bad = 0;
+		for (u = 0; u < cc->tag_len; u ++) {
+			bad |= tag[u] ^ buf[len + u];
+		}
+		if (bad) {
+			return NULL;
+		}
+		*data_len = len;
+		return buf;
+	}
+#endif
 	br_ccm_init(&zc, &cc->bc.vtable);
 	br_ccm_reset(&zc, nonce, sizeof nonce, sizeof header, len, cc->tag_len);
 	br_ccm_aad_inject(&zc, header, sizeof header);
@@ -175,12 +195,28 @@ ccm_encrypt(br_sslrec_ccm_context *cc,
 	/*
 	 * Perform CCM encryption.
 	 */
+#ifdef ARDUINO
+	if (cc->bc.vtable == &br_aes_ct_ctrcbc_vtable) {
+		br_aes_ct_ctrcbc_ccm_run(&cc->bc.aes.c_ct, 1,
+			nonce, sizeof nonce, header, sizeof header,
+			buf, len, buf + len, cc->tag_len);
+	} else {
+		br_ccm_init(&zc, &cc->bc.vtable);
+		br_ccm_reset(&zc, nonce, sizeof nonce,
+			sizeof header, len, cc->tag_len);
+		br_ccm_aad_inject(&zc, header, sizeof header);
+		br_ccm_flip(&zc);
+		br_ccm_run(&zc, 1, buf, len);
+		br_ccm_get_tag(&zc, buf + len);
+	}
+#else
 	br_ccm_init(&zc, &cc->bc.vtable);
 	br_ccm_reset(&zc, nonce, sizeof nonce, sizeof header, len, cc->tag_len);
 	br_ccm_aad_inject(&zc, header, sizeof header);
 	br_ccm_flip(&zc);
 	br_ccm_run(&zc, 1, buf, len);
 	br_ccm_get_tag(&zc, buf + len);
+#endif
 
 	/*
 	 * Assemble header and adjust pointer/length.
@@ -90,7 +90,13 @@ chapol_decrypt(br_sslrec_chapol_context *cc,
 
 	buf = data;
 	len = *data_len - 16;
+#ifdef ARDUINO
+	BR_CRYPTO_STAT_BEGIN();
+#endif
 	gen_chapol_process(cc, record_type, version, buf, len, tag, 0);
+#ifdef ARDUINO
+	BR_CRYPTO_STAT_END(BR_CRYPTO_OP_CHAPOL_DECRYPT, len);
+#endif
 	bad = 0;
 	for (u = 0; u < 16; u ++) {
 		bad |= tag[u] ^ buf[len + u];
@@ -150,7 +156,13 @@ chapol_encrypt(br_sslrec_chapol_context *cc,
 
 	buf = data;
 	len = *data_len;
+#ifdef ARDUINO
+	BR_CRYPTO_STAT_BEGIN();
+#endif
 	gen_chapol_process(cc, record_type, version, buf, len, buf + len, 1);
+#ifdef ARDUINO
+	BR_CRYPTO_STAT_END(BR_CRYPTO_OP_CHAPOL_ENCRYPT, len);
+#endif
 	buf -= 5;
 	buf[0] = (unsigned char)record_type;
 	br_enc16be(buf + 1, version);
@@ -70,6 +70,78 @@ gcm_check_length(const br_sslrec_gcm_context *cc, size_t rlen)
 	return rlen >= 24 && rlen <= (16384 + 24);
 }
 
+#ifdef ARDUINO
+
+/*
+ * CTR encryption and GHASH are interleaved over chunks of that many
+ * bytes (a multiple of 16), so that each chunk is hashed while it is
+ * still in the data cache or write buffer instead of walking the whole
+ * record twice.
+ */
+#ifndef BR_GCM_CHUNK
+#define BR_GCM_CHUNK   512
+#endif
+#if BR_GCM_CHUNK % 16 != 0 || BR_GCM_CHUNK == 0
+#error BR_GCM_CHUNK must be a non-zero multiple of 16
+#endif
+
+/*
+ * Encrypt or decrypt the record data and compute the final, already
+ * CTR-encrypted, authentication tag. The ciphertext is hashed, i.e.
+ * after CTR when encrypting and before when decrypting.
+ */
+static void
+do_gcm(br_sslrec_gcm_context *cc,
+	int record_type, unsigned version, const void *nonce,
+	void *data, size_t len, void *tag, int encrypt)
+{
+	unsigned char header[13];
+	unsigned char footer[16];
+	unsigned char iv[12];
+	unsigned char xortag[16];
+	unsigned char *buf;
+	uint32_t ctr;
+	size_t u, clen;
+
+	memcpy(iv, cc->iv, 4);
+	memcpy(iv + 4, nonce, 8);
+	br_enc64be(header, cc->seq ++);
+	header[8] = (unsigned char)record_type;
+	br_enc16be(header + 9, version);
+	br_enc16be(header + 11, len);
+	br_enc64be(footer, (uint64_t)(sizeof header) << 3);
+	br_enc64be(footer + 8, (uint64_t)len << 3);
+	memset(tag, 0, 16);
+	cc->gh(tag, cc->h, header, sizeof header);
+
+	buf = data;
+	ctr = 2;
+	for (u = 0; u < len; u += clen) {
+		clen = len - u;
+		if (clen > BR_GCM_CHUNK) {
+			clen = BR_GCM_CHUNK;
+		}
+		if (encrypt) {
+			ctr = cc->bc.vtable->run(&cc->bc.vtable,
+				iv, ctr, buf + u, clen);
+			cc->gh(tag, cc->h, buf + u, clen);
+		} else {
+			cc->gh(tag, cc->h, buf + u, clen);
+			ctr = cc->bc.vtable->run(&cc->bc.vtable,
+				iv, ctr, buf + u, clen);
+		}
+	}
+	cc->gh(tag, cc->h, footer, sizeof footer);
+
+	memset(xortag, 0, sizeof xortag);
+	cc->bc.vtable->run(&cc->bc.vtable, iv, 1, xortag, sizeof xortag);
+	for (u = 0; u < 16; u ++) {
+		((unsigned char *)tag)[u] ^= xortag[u];
+	}
+}
+
+#else
+
 /*
  * Compute the authentication tag. The value written in 'tag' must still
  * be CTR-encrypted.
@@ -119,6 +191,8 @@ do_ctr(br_sslrec_gcm_context *cc, const void *nonce, void *data, size_t len,
 	cc->bc.vtable->run(&cc->bc.vtable, iv, 1, xortag, 16);
 }
 
+#endif
+
 static unsigned char *
 gcm_decrypt(br_sslrec_gcm_context *cc,
 	int record_type, unsigned version, void *data, size_t *data_len)
@@ -130,8 +204,14 @@ gcm_decrypt(br_sslrec_gcm_context *cc,
 
 	buf = (unsigned char *)data + 8;
 	len = *data_len - 24;
+#ifdef ARDUINO
+	BR_CRYPTO_STAT_BEGIN();
+	do_gcm(cc, record_type, version, data, buf, len, tag, 0);
+	BR_CRYPTO_STAT_END(BR_CRYPTO_OP_GCM_DECRYPT, len);
+#else
 	do_tag(cc, record_type, version, buf, len, tag);
 	do_ctr(cc, data, buf, len, tag);
+#endif
 
 	/*
 	 * Compare the computed tag with the value from the record. It
@@ -196,18 +276,27 @@ gcm_encrypt(br_sslrec_gcm_context *cc,
 	int record_type, unsigned version, void *data, size_t *data_len)
 {
 	unsigned char *buf;
-	size_t u, len;
+	size_t len;
+#ifndef ARDUINO
+	size_t u;
 	unsigned char tmp[16];
+#endif
 
 	buf = (unsigned char *)data;
 	len = *data_len;
-	memset(tmp, 0, sizeof tmp);
 	br_enc64be(buf - 8, cc->seq);
+#ifdef ARDUINO
+	BR_CRYPTO_STAT_BEGIN();
+	do_gcm(cc, record_type, version, buf - 8, buf, len, buf + len, 1);
+	BR_CRYPTO_STAT_END(BR_CRYPTO_OP_GCM_ENCRYPT, len);
+#else
+	memset(tmp, 0, sizeof tmp);
 	do_ctr(cc, buf - 8, buf, len, tmp);
 	do_tag(cc, record_type, version, buf, len, buf + len);
 	for (u = 0; u < 16; u ++) {
 		buf[len + u] ^= tmp[u];
 	}
+#endif
 	len += 24;
 	buf -= 13;
 	buf[0] = (unsigned char)record_type;
@@ -38,6 +38,93 @@
 #pragma comment(lib, "advapi32")
 #endif
 
+#if BR_RAND_HW_ESP32
+#if defined __has_include
+#if __has_include("esp_random.h")
+#include "esp_random.h"
+#else
+#include "esp_system.h"
+#endif
+#else
+#include "esp_system.h"
+#endif
+#elif BR_RAND_HW_SAMD51
+#include <sam.h>
+#elif BR_RAND_HW_NRF52
+#include <nrf.h>
+#endif
+
+#if BR_RAND_HW
+static int
+seeder_hw(const br_prng_class **ctx)
+{
+#if BR_RAND_HW_RP2040
+	/*
+	 * The ring oscillator gives one bit per read, with some bias and
+	 * correlation: four samples are taken for each seed bit, and the
+	 * PRNG update conditions them.
+	 */
+	unsigned char tmp[128];
+#else
+	unsigned char tmp[32];
+#endif
+#if !BR_RAND_HW_ESP32
+	size_t u;
+#endif
+
+#if BR_RAND_HW_ESP32
+	esp_fill_random(tmp, sizeof tmp);
+#elif BR_RAND_HW_SAMD51
+	MCLK->APBCMASK.reg |= MCLK_APBCMASK_TRNG;
+	TRNG->CTRLA.reg = TRNG_CTRLA_ENABLE;
+	for (u = 0; u < sizeof tmp; u += 4) {
+		while (!(TRNG->INTFLAG.reg & TRNG_INTFLAG_DATARDY));
+		br_enc32le(tmp + u, TRNG->DATA.reg);
+	}
+	TRNG->CTRLA.reg = 0;
+#elif BR_RAND_HW_NRF52
+	NRF_RNG->CONFIG = RNG_CONFIG_DERCEN_Msk;
+	NRF_RNG->EVENTS_VALRDY = 0;
+	NRF_RNG->TASKS_START = 1;
+	for (u = 0; u < sizeof tmp; u ++) {
+		while (NRF_RNG->EVENTS_VALRDY == 0);
+		NRF_RNG->EVENTS_VALRDY = 0;
+		tmp[u] = (unsigned char)NRF_RNG->VALUE;
+	}
+	NRF_RNG->TASKS_STOP = 1;
+#elif BR_RAND_HW_RP2040
+	for (u = 0; u < sizeof tmp; u ++) {
+		unsigned x;
+		int i;
+
+		x = 0;
+		for (i = 0; i < 8; i ++) {
+			/* ROSC RANDOMBIT register */
+			x = (x << 1) | (*(volatile uint32_t *)0x4006001C & 1);
+		}
+		tmp[u] = (unsigned char)x;
+	}
+#endif
+	(*ctx)->update(ctx, tmp, sizeof tmp);
+	memset(tmp, 0, sizeof tmp);
+	return 1;
+}
+
+static const char *
+seeder_hw_name(void)
+{
+#if BR_RAND_HW_ESP32
+	return "esp32";
+#elif BR_RAND_HW_SAMD51
+	return "samd51-trng";
+#elif BR_RAND_HW_NRF52
+	return "nrf52-rng";
+#else
+	return "rp2040-rosc";
+#endif
+}
+#endif
+
 #if BR_RDRAND
 BR_TARGETS_X86_UP
 BR_TARGET("rdrnd")
@@ -143,6 +230,12 @@ seeder_win32(const br_prng_class **ctx)
 br_prng_seeder
 br_prng_seeder_system(const char **name)
 {
+#if BR_RAND_HW
+	if (name != NULL) {
+		*name = seeder_hw_name();
+	}
+	return &seeder_hw;
+#endif
 #if BR_RDRAND
 	if (rdrand_supported()) {
 		if (name != NULL) {
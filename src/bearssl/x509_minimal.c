@@ -361,6 +361,73 @@ hash_dn(br_x509_minimal_context *ctx, const void *dn, size_t len,
 	ctx->dn_hash_impl->out(&ctx->dn_hash.vtable, out);
 }
 
+#ifdef ARDUINO
+/*
+ * Get the range of index positions whose trust anchors may have the
+ * provided DN hash. Without a usable index, this is the whole array and
+ * positions map directly to anchors.
+ */
+static void
+ta_range(br_x509_minimal_context *ctx, const unsigned char *dn_hash,
+	size_t *first, size_t *last)
+{
+	const br_x509_ta_index_entry *index;
+	size_t lo, hi;
+
+	index = ctx->ta_index;
+	if (index == NULL || ctx->dn_hash_impl->desc != br_sha256_vtable.desc) {
+		*first = 0;
+		*last = ctx->trust_anchors_num;
+		return;
+	}
+	lo = 0;
+	hi = ctx->trust_anchors_num;
+	while (lo < hi) {
+		size_t mid;
+
+		mid = (lo + hi) >> 1;
+		if (memcmp(index[mid].dn_hash, dn_hash,
+			sizeof index[mid].dn_hash) < 0)
+		{
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	*first = lo;
+	while (hi < ctx->trust_anchors_num && memcmp(index[hi].dn_hash,
+		dn_hash, sizeof index[hi].dn_hash) == 0)
+	{
+		hi ++;
+	}
+	*last = hi;
+}
+
+/*
+ * Get the trust anchor at the provided position: positions below 'last'
+ * come from the configured array (see ta_range()), the following ones
+ * from the loader, until it returns NULL.
+ */
+static const br_x509_trust_anchor *
+ta_get(br_x509_minimal_context *ctx, const unsigned char *dn_hash,
+	size_t pos, size_t last)
+{
+	int sha256;
+
+	sha256 = (ctx->dn_hash_impl->desc == br_sha256_vtable.desc);
+	if (pos < last) {
+		if (ctx->ta_index == NULL || !sha256) {
+			return &ctx->trust_anchors[pos];
+		}
+		return &ctx->trust_anchors[ctx->ta_index[pos].ta];
+	}
+	if (ctx->ta_loader == NULL || !sha256) {
+		return NULL;
+	}
+	return ctx->ta_loader(ctx->ta_loader_ctx, dn_hash, pos - last);
+}
+#endif
+
 /*
  * Compare two big integers for equality. The integers use unsigned big-endian
  * encoding; extra leading bytes (of value 0) are allowed.
@@ -414,6 +481,10 @@ eqnocase(const void *s1, const void *s2, size_t len)
 
 static int verify_signature(br_x509_minimal_context *ctx,
 	const br_x509_pkey *pk);
+#ifdef ARDUINO
+static int verify_ta_signature(br_x509_minimal_context *ctx,
+	const br_x509_trust_anchor *ta);
+#endif
 
 
 
@@ -1121,13 +1192,26 @@ br_x509_minimal_run(void *t0ctx)
 				/* check-direct-trust */
 
 	size_t u;
+#ifdef ARDUINO
+	size_t last;
 
+	ta_range(CTX, CTX->current_dn_hash, &u, &last);
+	for (;; u ++) {
+#else
 	for (u = 0; u < CTX->trust_anchors_num; u ++) {
+#endif
 		const br_x509_trust_anchor *ta;
 		unsigned char hashed_DN[64];
 		int kt;
 
+#ifdef ARDUINO
+		ta = ta_get(CTX, CTX->current_dn_hash, u, last);
+		if (ta == NULL) {
+			break;
+		}
+#else
 		ta = &CTX->trust_anchors[u];
+#endif
 		if (ta->flags & BR_X509_TA_CA) {
 			continue;
 		}
@@ -1183,12 +1267,25 @@ br_x509_minimal_run(void *t0ctx)
 				/* check-trust-anchor-CA */
 
 	size_t u;
+#ifdef ARDUINO
+	size_t last;
 
+	ta_range(CTX, CTX->saved_dn_hash, &u, &last);
+	for (;; u ++) {
+#else
 	for (u = 0; u < CTX->trust_anchors_num; u ++) {
+#endif
 		const br_x509_trust_anchor *ta;
 		unsigned char hashed_DN[64];
 
+#ifdef ARDUINO
+		ta = ta_get(CTX, CTX->saved_dn_hash, u, last);
+		if (ta == NULL) {
+			break;
+		}
+#else
 		ta = &CTX->trust_anchors[u];
+#endif
 		if (!(ta->flags & BR_X509_TA_CA)) {
 			continue;
 		}
@@ -1196,7 +1293,11 @@ br_x509_minimal_run(void *t0ctx)
 		if (memcmp(hashed_DN, CTX->saved_dn_hash, DNHASH_LEN)) {
 			continue;
 		}
+#ifdef ARDUINO
+		if (verify_ta_signature(CTX, ta) == 0) {
+#else
 		if (verify_signature(CTX, &ta->pkey) == 0) {
+#endif
 			CTX->err = BR_ERR_X509_OK;
 			T0_CO();
 		}
@@ -1670,6 +1771,9 @@ static int
 verify_signature(br_x509_minimal_context *ctx, const br_x509_pkey *pk)
 {
 	int kt;
+#ifdef ARDUINO
+	uint32_t r;
+#endif
 
 	kt = ctx->cert_signer_key_type;
 	if ((pk->key_type & 0x0F) != kt) {
@@ -1682,12 +1786,23 @@ verify_signature(br_x509_minimal_context *ctx, const br_x509_pkey *pk)
 		if (ctx->irsa == 0) {
 			return BR_ERR_X509_UNSUPPORTED;
 		}
+#ifdef ARDUINO
+		BR_CRYPTO_STAT_BEGIN();
+		r = ctx->irsa(ctx->cert_sig, ctx->cert_sig_len,
+			&t0_datablock[ctx->cert_sig_hash_oid],
+			ctx->cert_sig_hash_len, &pk->key.rsa, tmp);
+		BR_CRYPTO_STAT_END(BR_CRYPTO_OP_X509_VERIFY, ctx->cert_sig_len);
+		if (!r) {
+			return BR_ERR_X509_BAD_SIGNATURE;
+		}
+#else
 		if (!ctx->irsa(ctx->cert_sig, ctx->cert_sig_len,
 			&t0_datablock[ctx->cert_sig_hash_oid],
 			ctx->cert_sig_hash_len, &pk->key.rsa, tmp))
 		{
 			return BR_ERR_X509_BAD_SIGNATURE;
 		}
+#endif
 		if (memcmp(ctx->tbs_hash, tmp, ctx->cert_sig_hash_len) != 0) {
 			return BR_ERR_X509_BAD_SIGNATURE;
 		}
@@ -1697,12 +1812,23 @@ verify_signature(br_x509_minimal_context *ctx, const br_x509_pkey *pk)
 		if (ctx->iecdsa == 0) {
 			return BR_ERR_X509_UNSUPPORTED;
 		}
+#ifdef ARDUINO
+		BR_CRYPTO_STAT_BEGIN();
+		r = ctx->iecdsa(ctx->iec, ctx->tbs_hash,
+			ctx->cert_sig_hash_len, &pk->key.ec,
+			ctx->cert_sig, ctx->cert_sig_len);
+		BR_CRYPTO_STAT_END(BR_CRYPTO_OP_X509_VERIFY, ctx->cert_sig_len);
+		if (!r) {
+			return BR_ERR_X509_BAD_SIGNATURE;
+		}
+#else
 		if (!ctx->iecdsa(ctx->iec, ctx->tbs_hash,
 			ctx->cert_sig_hash_len, &pk->key.ec,
 			ctx->cert_sig, ctx->cert_sig_len))
 		{
 			return BR_ERR_X509_BAD_SIGNATURE;
 		}
+#endif
 		return 0;
 
 	default:
@@ -1710,4 +1836,59 @@ verify_signature(br_x509_minimal_context *ctx, const br_x509_pkey *pk)
 	}
 }
 
+#ifdef ARDUINO
+/*
+ * Verify the current signature with a trust anchor key, through the
+ * trust anchor RSA or ECDSA verifier if there is one for that anchor.
+ */
+static int
+verify_ta_signature(br_x509_minimal_context *ctx,
+	const br_x509_trust_anchor *ta)
+{
+	unsigned char tmp[64];
+	int r;
+
+	if (ctx->ta_ecdsa_vrfy != 0
+		&& ctx->cert_signer_key_type == BR_KEYTYPE_EC
+		&& ta->pkey.key_type == BR_KEYTYPE_EC
+		&& ta >= ctx->trust_anchors
+		&& ta < ctx->trust_anchors + ctx->trust_anchors_num)
+	{
+		BR_CRYPTO_STAT_BEGIN();
+		r = ctx->ta_ecdsa_vrfy(ctx->ta_ecdsa_vrfy_ctx,
+			(size_t)(ta - ctx->trust_anchors),
+			ctx->tbs_hash, ctx->cert_sig_hash_len,
+			ctx->cert_sig, ctx->cert_sig_len);
+		if (r >= 0) {
+			BR_CRYPTO_STAT_END(BR_CRYPTO_OP_X509_VERIFY,
+				ctx->cert_sig_len);
+			return r ? 0 : BR_ERR_X509_BAD_SIGNATURE;
+		}
+		return verify_signature(ctx, &ta->pkey);
+	}
+	if (ctx->ta_rsa_vrfy == 0
+		|| ctx->cert_signer_key_type != BR_KEYTYPE_RSA
+		|| ta->pkey.key_type != BR_KEYTYPE_RSA
+		|| ta < ctx->trust_anchors
+		|| ta >= ctx->trust_anchors + ctx->trust_anchors_num)
+	{
+		return verify_signature(ctx, &ta->pkey);
+	}
+	BR_CRYPTO_STAT_BEGIN();
+	r = ctx->ta_rsa_vrfy(ctx->ta_rsa_vrfy_ctx,
+		(size_t)(ta - ctx->trust_anchors),
+		ctx->cert_sig, ctx->cert_sig_len,
+		&t0_datablock[ctx->cert_sig_hash_oid],
+		ctx->cert_sig_hash_len, tmp);
+	if (r < 0) {
+		return verify_signature(ctx, &ta->pkey);
+	}
+	BR_CRYPTO_STAT_END(BR_CRYPTO_OP_X509_VERIFY, ctx->cert_sig_len);
+	if (!r || memcmp(ctx->tbs_hash, tmp, ctx->cert_sig_hash_len) != 0) {
+		return BR_ERR_X509_BAD_SIGNATURE;
+	}
+	return 0;
+}
+#endif
+
 
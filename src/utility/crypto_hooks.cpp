@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "crypto_hooks.h"
+
+static void (*begin_callback)(void) = NULL;
+static void (*end_callback)(void) = NULL;
+static int depth = 0;
+
+static void
+burst_begin(void)
+{
+	if (depth++ == 0 && begin_callback) {
+		begin_callback();
+	}
+}
+
+static void
+burst_end(void)
+{
+	if (--depth == 0 && end_callback) {
+		end_callback();
+	}
+}
+
+static const br_ec_impl *ec_base;
+static br_ec_impl ec_wrapper;
+
+static const unsigned char *
+ec_generator(int curve, size_t *len)
+{
+	return ec_base->generator(curve, len);
+}
+
+static const unsigned char *
+ec_order(int curve, size_t *len)
+{
+	return ec_base->order(curve, len);
+}
+
+static size_t
+ec_xoff(int curve, size_t *len)
+{
+	return ec_base->xoff(curve, len);
+}
+
+static uint32_t
+ec_mul(unsigned char *G, size_t Glen,
+	const unsigned char *x, size_t xlen, int curve)
+{
+	uint32_t r;
+
+	burst_begin();
+	r = ec_base->mul(G, Glen, x, xlen, curve);
+	burst_end();
+	return r;
+}
+
+static size_t
+ec_mulgen(unsigned char *R,
+	const unsigned char *x, size_t xlen, int curve)
+{
+	size_t len;
+
+	burst_begin();
+	len = ec_base->mulgen(R, x, xlen, curve);
+	burst_end();
+	return len;
+}
+
+static uint32_t
+ec_muladd(unsigned char *A, const unsigned char *B, size_t len,
+	const unsigned char *x, size_t xlen,
+	const unsigned char *y, size_t ylen, int curve)
+{
+	uint32_t r;
+
+	burst_begin();
+	r = ec_base->muladd(A, B, len, x, xlen, y, ylen, curve);
+	burst_end();
+	return r;
+}
+
+const br_ec_impl *
+crypto_hooks_ec_impl(const br_ec_impl *base)
+{
+	if (base == NULL || base == &ec_wrapper) {
+		return base;
+	}
+
+	ec_base = base;
+	ec_wrapper.supported_curves = base->supported_curves;
+	ec_wrapper.generator = ec_generator;
+	ec_wrapper.order = ec_order;
+	ec_wrapper.xoff = ec_xoff;
+	ec_wrapper.mul = ec_mul;
+	ec_wrapper.mulgen = ec_mulgen;
+	ec_wrapper.muladd = ec_muladd;
+	return &ec_wrapper;
+}
+
+static br_rsa_pkcs1_vrfy rsa_vrfy_base;
+
+static uint32_t
+rsa_vrfy(const unsigned char *x, size_t xlen,
+	const unsigned char *hash_oid, size_t hash_len,
+	const br_rsa_public_key *pk, unsigned char *hash_out)
+{
+	uint32_t r;
+
+	burst_begin();
+	r = rsa_vrfy_base(x, xlen, hash_oid, hash_len, pk, hash_out);
+	burst_end();
+	return r;
+}
+
+br_rsa_pkcs1_vrfy
+crypto_hooks_rsa_pkcs1_vrfy(br_rsa_pkcs1_vrfy base)
+{
+	if (base == NULL || base == rsa_vrfy) {
+		return base;
+	}
+
+	rsa_vrfy_base = base;
+	return rsa_vrfy;
+}
+
+static br_rsa_pkcs1_sign rsa_sign_base;
+
+static uint32_t
+rsa_sign(const unsigned char *hash_oid,
+	const unsigned char *hash, size_t hash_len,
+	const br_rsa_private_key *sk, unsigned char *x)
+{
+	uint32_t r;
+
+	burst_begin();
+	r = rsa_sign_base(hash_oid, hash, hash_len, sk, x);
+	burst_end();
+	return r;
+}
+
+br_rsa_pkcs1_sign
+crypto_hooks_rsa_pkcs1_sign(br_rsa_pkcs1_sign base)
+{
+	if (base == NULL || base == rsa_sign) {
+		return base;
+	}
+
+	rsa_sign_base = base;
+	return rsa_sign;
+}
+
+static br_tls_prf_impl prf10_base;
+static br_tls_prf_impl prf_sha256_base;
+static br_tls_prf_impl prf_sha384_base;
+
+#define PRF_WRAPPER(name) \
+static void \
+name(void *dst, size_t len, \
+	const void *secret, size_t secret_len, const char *label, \
+	size_t seed_num, const br_tls_prf_seed_chunk *seed) \
+{ \
+	burst_begin(); \
+	name ## _base(dst, len, secret, secret_len, label, seed_num, seed); \
+	burst_end(); \
+}
+
+PRF_WRAPPER(prf10)
+PRF_WRAPPER(prf_sha256)
+PRF_WRAPPER(prf_sha384)
+
+void
+crypto_hooks_prf(br_ssl_engine_context *eng)
+{
+	if (eng->prf10 != NULL && eng->prf10 != prf10) {
+		prf10_base = eng->prf10;
+		eng->prf10 = prf10;
+	}
+	if (eng->prf_sha256 != NULL && eng->prf_sha256 != prf_sha256) {
+		prf_sha256_base = eng->prf_sha256;
+		eng->prf_sha256 = prf_sha256;
+	}
+	if (eng->prf_sha384 != NULL && eng->prf_sha384 != prf_sha384) {
+		prf_sha384_base = eng->prf_sha384;
+		eng->prf_sha384 = prf_sha384;
+	}
+}
+
+void
+crypto_hooks_set(void (*begin)(void), void (*end)(void))
+{
+	begin_callback = begin;
+	end_callback = end;
+}
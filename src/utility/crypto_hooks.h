@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _CRYPTO_HOOKS_H_
+#define _CRYPTO_HOOKS_H_
+
+#include "bearssl/bearssl.h"
+
+/*
+ * Implementations that call the functions set with crypto_hooks_set()
+ * before and after each CPU-heavy operation of a handshake, e.g. to
+ * raise the CPU clock only while it runs: point multiplications of base
+ * (ECDHE, ECDSA verifications and signatures), RSA PKCS#1 verifications
+ * and signatures, and the TLS PRF (key derivation and Finished
+ * messages). Nested operations (a signature made of point
+ * multiplications) call the functions once.
+ *
+ * Like worker_core.h, the bases and the functions are kept in static
+ * variables: all connections share the last ones.
+ */
+const br_ec_impl *crypto_hooks_ec_impl(const br_ec_impl *base);
+
+br_rsa_pkcs1_vrfy crypto_hooks_rsa_pkcs1_vrfy(br_rsa_pkcs1_vrfy base);
+
+br_rsa_pkcs1_sign crypto_hooks_rsa_pkcs1_sign(br_rsa_pkcs1_sign base);
+
+/*
+ * Wrap the three PRF implementations of the engine.
+ */
+void crypto_hooks_prf(br_ssl_engine_context *eng);
+
+void crypto_hooks_set(void (*begin)(void), void (*end)(void));
+
+#endif
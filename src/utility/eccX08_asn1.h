@@ -38,4 +38,23 @@ eccX08_vrfy_asn1(const br_ec_impl *impl,
   const br_ec_public_key *pk,
   const void *sig, size_t sig_len);
 
+// Routes each verification to the faster of the secure element (the
+// ECCX08 unless another one is selected) and the software verifier: both are timed on the first valid P-256 signature, other
+// curves always go to the software verifier. eccX08_vrfy_auto_select() forces
+// one engine, or ECCX08_VRFY_AUTO to measure again.
+enum {
+  ECCX08_VRFY_AUTO,
+  ECCX08_VRFY_SOFTWARE,
+  ECCX08_VRFY_ECCX08
+};
+
+uint32_t
+eccX08_vrfy_auto_asn1(const br_ec_impl *impl,
+  const void *hash, size_t hash_len,
+  const br_ec_public_key *pk,
+  const void *sig, size_t sig_len);
+
+void eccX08_vrfy_auto_select(int engine);
+int eccX08_vrfy_auto_selected();
+
 #endif
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ArduinoBearSSL.h"
+
+#ifndef ARDUINO_DISABLE_ECCX08
+#include "eccX08_ecdh.h"
+
+static const br_ec_impl *base;
+static br_ec_impl wrapper;
+static SecureElement* keyElement = NULL;
+static int keySlot = -1;
+// stands for the private key in br_ssl_ecdhe_key: the engine never
+// generates a zero scalar
+static const unsigned char token[32] = { 0 };
+static int ecdhSupported = -1;
+
+static const unsigned char* ecGenerator(int curve, size_t* len)
+{
+  return base->generator(curve, len);
+}
+
+static const unsigned char* ecOrder(int curve, size_t* len)
+{
+  return base->order(curve, len);
+}
+
+static size_t ecXoff(int curve, size_t* len)
+{
+  return base->xoff(curve, len);
+}
+
+static uint32_t ecMul(unsigned char* G, size_t Glen, const unsigned char* x, size_t xlen, int curve)
+{
+  if (curve != BR_EC_secp256r1 || xlen != sizeof(token) || memcmp(x, token, sizeof(token)) != 0) {
+    return base->mul(G, Glen, x, xlen, curve);
+  }
+
+  // the chip key is good for a single exchange
+  int slot = keySlot;
+  byte secret[32];
+
+  keySlot = -1;
+  if (slot < 0 || Glen != 65 || G[0] != 0x04 || !keyElement->ecdh(slot, &G[1], secret)) {
+    return 0;
+  }
+
+  // the engine only uses the X coordinate
+  memcpy(&G[1], secret, sizeof(secret));
+  memset(&G[33], 0x00, 32);
+  memset(secret, 0x00, sizeof(secret));
+
+  return 1;
+}
+
+static size_t ecMulgen(unsigned char* R, const unsigned char* x, size_t xlen, int curve)
+{
+  return base->mulgen(R, x, xlen, curve);
+}
+
+static uint32_t ecMuladd(unsigned char* A, const unsigned char* B, size_t len, const unsigned char* x, size_t xlen, const unsigned char* y, size_t ylen, int curve)
+{
+  return base->muladd(A, B, len, x, xlen, y, ylen, curve);
+}
+
+int eccX08_ecdhe_key_generate(br_ssl_ecdhe_key *key, int slot)
+{
+  SecureElement* element = ArduinoBearSSL.secureElement();
+  byte publicKey[64];
+
+  memset(key, 0x00, sizeof(*key));
+
+  // a new element has to pass the check again
+  if (element != keyElement) {
+    keyElement = element;
+    keySlot = -1;
+    ecdhSupported = -1;
+  }
+
+  if (ecdhSupported == 0 || element == NULL || !element->ready() || !element->generateKey(slot, publicKey)) {
+    return 0;
+  }
+
+  // the first time, check that the slot allows ECDH with its own key
+  if (ecdhSupported < 0) {
+    byte secret[32];
+
+    ecdhSupported = element->ecdh(slot, publicKey, secret) ? 1 : 0;
+    memset(secret, 0x00, sizeof(secret));
+
+    if (!ecdhSupported) {
+      return 0;
+    }
+  }
+
+  keySlot = slot;
+
+  memcpy(key->key, token, sizeof(token));
+  key->key_len = sizeof(token);
+  key->point[0] = 0x04;
+  memcpy(&key->point[1], publicKey, sizeof(publicKey));
+  key->point_len = 1 + sizeof(publicKey);
+  key->curve = BR_EC_secp256r1;
+
+  return 1;
+}
+
+const br_ec_impl *eccX08_ec_impl(const br_ec_impl *impl)
+{
+  if (impl == &wrapper) {
+    return impl;
+  }
+
+  base = impl;
+  wrapper.supported_curves = impl->supported_curves;
+  wrapper.generator = ecGenerator;
+  wrapper.order = ecOrder;
+  wrapper.xoff = ecXoff;
+  wrapper.mul = ecMul;
+  wrapper.mulgen = ecMulgen;
+  wrapper.muladd = ecMuladd;
+
+  return &wrapper;
+}
+#endif
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _ECCX08_ECDH_H_
+#define _ECCX08_ECDH_H_
+
+#include "bearssl/bearssl.h"
+
+// ECDHE on the ECCX08: eccX08_ecdhe_key_generate() makes a P-256 key
+// pair in a slot of the chip (GenKey) and fills key with the public
+// point and a token in place of the private scalar. Given to
+// the engine with br_ssl_client_set_ecdhe_key(), together with the
+// implementation returned by eccX08_ec_impl(), the shared point of the
+// next P-256 handshake is then computed by the chip (ECDH command); all
+// other operations go to base. The slot must allow GenKey and ECDH with
+// clear output. The chip holds one such key at a time.
+//
+// The chip is the one of ArduinoBearSSL.secureElement(). Returns 0 if it
+// cannot do ECDH in that slot.
+int eccX08_ecdhe_key_generate(br_ssl_ecdhe_key *key, int slot);
+
+const br_ec_impl *eccX08_ec_impl(const br_ec_impl *base);
+
+#endif
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ArduinoBearSSL.h"
+
+#ifndef ARDUINO_DISABLE_ECCX08
+#include "eccX08_sha256.h"
+
+#include <ArduinoECCX08.h>
+
+enum {
+  SOFTWARE = 0,
+  CHIP     = 1,   // the ECCX08 holds the state, buf has the partial block
+  DONE     = 2,   // buf has the digest
+  FAILED   = -1
+};
+
+// context that has the SHA engine of the chip
+static const eccX08_sha256_context* owner = NULL;
+
+static void release(eccX08_sha256_context* ctx)
+{
+  if (owner == ctx) {
+    owner = NULL;
+    ArduinoBearSSL.eccX08Release();
+  }
+}
+
+static void init(const br_hash_class** ctx)
+{
+  eccX08_sha256_init((eccX08_sha256_context*)ctx, 0);
+}
+
+static void update(const br_hash_class** ctx, const void* data, size_t len)
+{
+  eccX08_sha256_context* sc = (eccX08_sha256_context*)ctx;
+  const unsigned char* buf = (const unsigned char*)data;
+
+  if (sc->chip == SOFTWARE) {
+    br_sha256_update(&sc->soft, data, len);
+    return;
+  }
+
+  if (sc->chip != CHIP) {
+    // after out() or a failure the chip cannot go on
+    release(sc);
+    sc->chip = FAILED;
+    return;
+  }
+
+  while (len) {
+    size_t ptr = (size_t)sc->count & 63;
+    size_t clen = 64 - ptr;
+
+    if (clen > len) {
+      clen = len;
+    }
+
+    memcpy(sc->buf + ptr, buf, clen);
+    buf += clen;
+    len -= clen;
+    sc->count += clen;
+
+    if ((sc->count & 63) == 0 && !ECCX08.updateSHA256(sc->buf)) {
+      release(sc);
+      sc->chip = FAILED;
+      return;
+    }
+  }
+}
+
+static void out(const br_hash_class* const* ctx, void* dst)
+{
+  eccX08_sha256_out((const eccX08_sha256_context*)ctx, dst);
+}
+
+static uint64_t state(const br_hash_class* const* ctx, void* dst)
+{
+  const eccX08_sha256_context* sc = (const eccX08_sha256_context*)ctx;
+
+  if (sc->chip == SOFTWARE) {
+    return br_sha256_state(&sc->soft, dst);
+  }
+
+  // the chip does not export its state
+  memset(dst, 0x00, 32);
+
+  return sc->count;
+}
+
+static void set_state(const br_hash_class** ctx, const void* stb, uint64_t count)
+{
+  eccX08_sha256_context* sc = (eccX08_sha256_context*)ctx;
+
+  release(sc);
+  sc->vtable = &eccX08_sha256_vtable;
+  br_sha256_init(&sc->soft);
+  br_sha256_set_state(&sc->soft, stb, count);
+  sc->count = count;
+  sc->chip = SOFTWARE;
+}
+
+const br_hash_class eccX08_sha256_vtable = {
+  sizeof(eccX08_sha256_context),
+  BR_HASHDESC_ID(br_sha256_ID)
+    | BR_HASHDESC_OUT(32)
+    | BR_HASHDESC_STATE(32)
+    | BR_HASHDESC_LBLEN(6)
+    | BR_HASHDESC_MD_PADDING
+    | BR_HASHDESC_MD_PADDING_BE,
+  init,
+  update,
+  out,
+  state,
+  set_state
+};
+
+void eccX08_sha256_init(eccX08_sha256_context* ctx, uint64_t length)
+{
+  release(ctx);
+
+  ctx->vtable = &eccX08_sha256_vtable;
+  ctx->count = 0;
+  ctx->chip = SOFTWARE;
+
+  if (length >= ECCX08_SHA256_THRESHOLD && owner == NULL &&
+      ArduinoBearSSL.eccX08Ready() && ECCX08.beginSHA256()) {
+    owner = ctx;
+    ctx->chip = CHIP;
+  } else {
+    br_sha256_init(&ctx->soft);
+  }
+}
+
+int eccX08_sha256_out(const eccX08_sha256_context* ctx, void* dst)
+{
+  // the chip ends the hash, the digest is kept for later calls
+  eccX08_sha256_context* sc = (eccX08_sha256_context*)ctx;
+  byte digest[32];
+
+  switch (sc->chip) {
+    case SOFTWARE:
+      br_sha256_out(&sc->soft, dst);
+      return 1;
+
+    case CHIP:
+      if (ECCX08.endSHA256(sc->buf, (int)(sc->count & 63), digest)) {
+        memcpy(sc->buf, digest, sizeof(digest));
+        sc->chip = DONE;
+      } else {
+        sc->chip = FAILED;
+      }
+      release(sc);
+      break;
+  }
+
+  if (sc->chip != DONE) {
+    memset(dst, 0x00, 32);
+    return 0;
+  }
+
+  memcpy(dst, sc->buf, 32);
+
+  return 1;
+}
+#endif
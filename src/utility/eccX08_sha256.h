@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _ECCX08_SHA256_H_
+#define _ECCX08_SHA256_H_
+
+#include "bearssl/bearssl.h"
+
+// hashes of at least this many bytes are computed by the ECCX08, shorter
+// ones by br_sha256_vtable: every 64 byte block is a transfer on the
+// bus, which only pays off for long inputs such as firmware images
+#ifndef ECCX08_SHA256_THRESHOLD
+#define ECCX08_SHA256_THRESHOLD 16384
+#endif
+
+typedef struct {
+	const br_hash_class *vtable;
+	br_sha256_context soft;
+	unsigned char buf[64];
+	uint64_t count;
+	int chip;
+} eccX08_sha256_context;
+
+// SHA-256 with the ECCX08 SHA engine. init() through the vtable does
+// not know the length and hashes in software, eccX08_sha256_init() puts
+// the hash on the chip when length reaches ECCX08_SHA256_THRESHOLD and
+// the chip is free; it holds one such hash at a time, and other ECCX08
+// commands (e.g. a handshake signature) must not run until out().
+//
+// On the chip out() ends the hash: it can be called again but update()
+// cannot. state() and set_state() are only meaningful in software, so
+// this does not fit HMAC or the TLS transcript and is meant for
+// sequential hashes.
+extern const br_hash_class eccX08_sha256_vtable;
+
+void eccX08_sha256_init(eccX08_sha256_context *ctx, uint64_t length);
+
+// out() that also reports failures of the chip: 0 if the ECCX08 did not
+// complete the hash, dst is then zeroed
+int eccX08_sha256_out(const eccX08_sha256_context *ctx, void *dst);
+
+#endif
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ArduinoBearSSL.h"
+
+#ifndef ARDUINO_DISABLE_ECCX08
+#include "eccX08_asn1.h"
+
+static int engine = ECCX08_VRFY_AUTO;
+
+uint32_t
+eccX08_vrfy_auto_asn1(const br_ec_impl *impl,
+  const void *hash, size_t hash_len,
+  const br_ec_public_key *pk,
+  const void *sig, size_t sig_len)
+{
+  br_ecdsa_vrfy software = br_ecdsa_vrfy_asn1_get_default();
+
+  // the ECCX08 only knows P-256 with SHA-256
+  if (hash_len != 32 || pk->curve != BR_EC_secp256r1 || engine == ECCX08_VRFY_SOFTWARE) {
+    return software(impl, hash, hash_len, pk, sig, sig_len);
+  }
+
+  if (engine == ECCX08_VRFY_ECCX08) {
+    return secure_element_vrfy_asn1(impl, hash, hash_len, pk, sig, sig_len);
+  }
+
+  // run both until a valid P-256 signature is seen: the software result
+  // is the answer, and an ECCX08 that disagrees (e.g. missing or not
+  // responding) is not used
+  unsigned long start = micros();
+  uint32_t result = software(impl, hash, hash_len, pk, sig, sig_len);
+  unsigned long softwareTime = micros() - start;
+
+  start = micros();
+  uint32_t eccX08Result = secure_element_vrfy_asn1(impl, hash, hash_len, pk, sig, sig_len);
+  unsigned long eccX08Time = micros() - start;
+
+  if (result == 1) {
+    engine = (eccX08Result == 1 && eccX08Time < softwareTime) ? ECCX08_VRFY_ECCX08 : ECCX08_VRFY_SOFTWARE;
+  }
+
+  return result;
+}
+
+void eccX08_vrfy_auto_select(int selected)
+{
+  engine = selected;
+}
+
+int eccX08_vrfy_auto_selected()
+{
+  return engine;
+}
+#endif
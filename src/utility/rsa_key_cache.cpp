@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stddef.h>
+
+#include "rsa_key_cache.h"
+
+#define CACHE_ALIGN   (sizeof(void *) > 4 ? sizeof(void *) : 4)
+
+static size_t
+align_up(size_t x)
+{
+	return (x + CACHE_ALIGN - 1) & ~(CACHE_ALIGN - 1);
+}
+
+void
+rsa_key_cache_init(rsa_key_cache_context *ctx, void *buf, size_t len)
+{
+	size_t skip;
+
+	skip = align_up((uintptr_t)buf) - (uintptr_t)buf;
+	if (skip > len) {
+		skip = len;
+	}
+	ctx->buf = (unsigned char *)buf + skip;
+	ctx->len = len - skip;
+	ctx->tmp = NULL;
+	ctx->tmp_len = 0;
+	ctx->src = NULL;
+	ctx->ready = 0;
+	ctx->i15 = br_rsa_pkcs1_sign_get_default() == &br_rsa_i15_pkcs1_sign;
+}
+
+void
+rsa_key_cache_reset(rsa_key_cache_context *ctx)
+{
+	ctx->src = NULL;
+	ctx->ready = 0;
+}
+
+const br_rsa_private_key *
+rsa_key_cache_set_key(rsa_key_cache_context *ctx,
+	const br_rsa_private_key *sk)
+{
+	size_t used, fwlen, wsize;
+
+	if (ctx->ready && ctx->src == sk) {
+		return &ctx->sk;
+	}
+	ctx->ready = 0;
+	ctx->src = sk;
+	if (ctx->i15) {
+		wsize = sizeof(uint16_t);
+		used = br_rsa_i15_priv_precomp_init(&ctx->key.i15, sk,
+			(uint16_t *)(void *)ctx->buf, ctx->len / wsize);
+		fwlen = ctx->key.i15.fwlen;
+	} else {
+		wsize = sizeof(uint32_t);
+		used = br_rsa_i31_priv_precomp_init(&ctx->key.i31, sk,
+			(uint32_t *)(void *)ctx->buf, ctx->len / wsize);
+		fwlen = ctx->key.i31.fwlen;
+	}
+	if (used == 0) {
+		return NULL;
+	}
+
+	/*
+	 * The work area takes the rest of the buffer if it has room for
+	 * at least six factor-sized values (plus one word for alignment).
+	 */
+	used = align_up(used * wsize);
+	if (used <= ctx->len && (ctx->len - used) / wsize >= 6 * fwlen + 1) {
+		ctx->tmp = ctx->buf + used;
+		ctx->tmp_len = (ctx->len - used) / wsize;
+	} else {
+		ctx->tmp = NULL;
+		ctx->tmp_len = 0;
+	}
+	ctx->sk = *sk;
+	ctx->ready = 1;
+	return &ctx->sk;
+}
+
+size_t
+rsa_key_cache_key_size(uint32_t n_bitlen)
+{
+	size_t s15, s31;
+
+	s15 = BR_RSA_I15_PRIV_PRECOMP_WORDS(n_bitlen) * sizeof(uint16_t);
+	s31 = BR_RSA_I31_PRIV_PRECOMP_WORDS(n_bitlen) * sizeof(uint32_t);
+	return (s15 > s31 ? s15 : s31) + CACHE_ALIGN - 1;
+}
+
+static rsa_key_cache_context *
+get_context(const br_rsa_private_key *sk)
+{
+	return (rsa_key_cache_context *)(void *)((unsigned char *)sk
+		- offsetof(rsa_key_cache_context, sk));
+}
+
+static uint32_t
+sign(const unsigned char *hash_oid,
+	const unsigned char *hash, size_t hash_len,
+	const br_rsa_private_key *sk, unsigned char *x)
+{
+	rsa_key_cache_context *cc;
+
+	cc = get_context(sk);
+	if (!cc->ready) {
+		return 0;
+	}
+	if (cc->i15) {
+		return br_rsa_i15_pkcs1_sign_precomp(hash_oid, hash, hash_len,
+			&cc->key.i15, x, (uint16_t *)cc->tmp, cc->tmp_len);
+	}
+	return br_rsa_i31_pkcs1_sign_precomp(hash_oid, hash, hash_len,
+		&cc->key.i31, x, (uint32_t *)cc->tmp, cc->tmp_len);
+}
+
+/*
+ * Same as sign(), with the work area on the stack. It is a separate
+ * callback so that sign() does not reserve that stack space. The size
+ * is for the largest keys (BR_MAX_RSA_SIZE); a 2048-bit key then gets
+ * the 3-bit window of br_rsa_i15_private().
+ */
+static uint32_t
+sign_stack(const unsigned char *hash_oid,
+	const unsigned char *hash, size_t hash_len,
+	const br_rsa_private_key *sk, unsigned char *x)
+{
+	rsa_key_cache_context *cc;
+
+	cc = get_context(sk);
+	if (!cc->ready) {
+		return 0;
+	}
+	if (cc->i15) {
+		uint16_t tmp[BR_RSA_I15_PRIV_TMP_WORDS(4096, 2)];
+
+		return br_rsa_i15_pkcs1_sign_precomp(hash_oid, hash, hash_len,
+			&cc->key.i15, x, tmp, sizeof tmp / sizeof tmp[0]);
+	} else {
+		uint32_t tmp[BR_RSA_I31_PRIV_TMP_WORDS(4096, 2)];
+
+		return br_rsa_i31_pkcs1_sign_precomp(hash_oid, hash, hash_len,
+			&cc->key.i31, x, tmp, sizeof tmp / sizeof tmp[0]);
+	}
+}
+
+br_rsa_pkcs1_sign
+rsa_key_cache_get_sign(const rsa_key_cache_context *ctx)
+{
+	return ctx->tmp ? &sign : &sign_stack;
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _RSA_KEY_CACHE_H_
+#define _RSA_KEY_CACHE_H_
+
+#include "bearssl/bearssl.h"
+
+/*
+ * RSA client key signer (see br_ssl_client_set_single_rsa()) that keeps
+ * the precomputed form of the key (see br_rsa_i15_priv_precomp_init())
+ * in a caller-provided buffer, so that the factors are decoded and the
+ * CRT constants computed once instead of in every handshake. The rest
+ * of the buffer is the work area of the private key operation: a larger
+ * work area allows a larger exponentiation window. A buffer that only
+ * fits the key (see rsa_key_cache_key_size()) leaves the work area on
+ * the stack, as in br_rsa_i15_private(). The representation follows the
+ * default RSA implementation ("i15" or "i31").
+ */
+typedef struct {
+	/* first, so that rsa_key_cache_sign() finds the context */
+	br_rsa_private_key sk;
+	const br_rsa_private_key *src;
+	unsigned char *buf;
+	size_t len;
+	void *tmp;
+	size_t tmp_len;
+	int i15;
+	int ready;
+	union {
+		br_rsa_i15_priv_precomp_key i15;
+		br_rsa_i31_priv_precomp_key i31;
+	} key;
+} rsa_key_cache_context;
+
+void
+rsa_key_cache_init(rsa_key_cache_context *ctx, void *buf, size_t len);
+
+/*
+ * Forget the cached key, the next rsa_key_cache_set_key() precomputes
+ * it again (the contents of a key may change at the same address).
+ */
+void
+rsa_key_cache_reset(rsa_key_cache_context *ctx);
+
+/*
+ * Buffer size (in bytes) that holds the precomputed form of a key of
+ * n_bitlen bits, without a work area.
+ */
+size_t
+rsa_key_cache_key_size(uint32_t n_bitlen);
+
+/*
+ * Precompute sk, unless it is the cached key already, and return the
+ * key to use with the rsa_key_cache_get_sign() callback, or NULL if it
+ * does not fit in the buffer. The callback depends on whether there is
+ * room for a work area.
+ */
+const br_rsa_private_key *
+rsa_key_cache_set_key(rsa_key_cache_context *ctx,
+	const br_rsa_private_key *sk);
+
+br_rsa_pkcs1_sign
+rsa_key_cache_get_sign(const rsa_key_cache_context *ctx);
+
+#endif
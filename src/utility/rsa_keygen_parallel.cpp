@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "BearSSLConfig.h"
+#include "rsa_keygen_parallel.h"
+
+#if defined(BEARSSL_NO_HEAP)
+// the task or the core 1 stack would come from the heap, both primes
+// are searched for on this core
+#elif defined(ARDUINO_ARCH_ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#if !CONFIG_FREERTOS_UNICORE
+#define RSA_KEYGEN_ESP32 1
+#endif
+#elif defined(ARDUINO_ARCH_RP2040) && !defined(ARDUINO_ARCH_MBED)
+#include <pico/multicore.h>
+#define RSA_KEYGEN_RP2040 1
+
+// defined by sketches that run their own code on core 1
+extern void setup1() __attribute__((weak));
+extern void loop1() __attribute__((weak));
+#endif
+
+typedef struct {
+	br_hmac_drbg_context rng;
+	br_rsa_keygen_factor factor;
+	void *kbuf_priv;
+	unsigned size;
+	uint32_t pubexp;
+	volatile uint32_t result;
+	volatile int done;
+#if RSA_KEYGEN_ESP32
+	SemaphoreHandle_t finished;
+#endif
+} keygen_job;
+
+static void
+run_job(keygen_job *job)
+{
+	job->result = job->factor(&job->rng.vtable, job->kbuf_priv,
+		job->size, job->pubexp, 1);
+}
+
+#if RSA_KEYGEN_ESP32
+static void
+keygen_task(void *arg)
+{
+	keygen_job *job = (keygen_job *)arg;
+
+	run_job(job);
+	xSemaphoreGive(job->finished);
+	vTaskDelete(NULL);
+}
+
+/*
+ * Start the search for q on the other core; returns 0 if it must be
+ * done on this core instead.
+ */
+static int
+start_job(keygen_job *job)
+{
+	job->finished = xSemaphoreCreateBinary();
+	if (job->finished == NULL) {
+		return 0;
+	}
+
+	// idle priority, so that the idle task of the other core still
+	// gets to feed the task watchdog
+	if (xTaskCreatePinnedToCore(keygen_task, "rsa_keygen",
+		RSA_KEYGEN_PARALLEL_STACK_SIZE, job, tskIDLE_PRIORITY, NULL,
+		xPortGetCoreID() ^ 1) != pdPASS)
+	{
+		vSemaphoreDelete(job->finished);
+		return 0;
+	}
+	return 1;
+}
+
+static void
+join_job(keygen_job *job)
+{
+	xSemaphoreTake(job->finished, portMAX_DELAY);
+	vSemaphoreDelete(job->finished);
+}
+#elif RSA_KEYGEN_RP2040
+static keygen_job *core1_job;
+static uint32_t *core1_stack;
+
+static void
+keygen_core1(void)
+{
+	run_job(core1_job);
+	__sync_synchronize();
+	core1_job->done = 1;
+	for (;;) {
+		tight_loop_contents();
+	}
+}
+
+static int
+start_job(keygen_job *job)
+{
+	if (setup1 || loop1) {
+		return 0;
+	}
+	core1_stack = (uint32_t *)malloc(RSA_KEYGEN_PARALLEL_STACK_SIZE);
+	if (core1_stack == NULL) {
+		return 0;
+	}
+	core1_job = job;
+	job->done = 0;
+	multicore_launch_core1_with_stack(keygen_core1, core1_stack,
+		RSA_KEYGEN_PARALLEL_STACK_SIZE);
+	return 1;
+}
+
+static void
+join_job(keygen_job *job)
+{
+	while (!job->done) {
+		tight_loop_contents();
+	}
+	__sync_synchronize();
+	multicore_reset_core1();
+	free(core1_stack);
+	core1_stack = NULL;
+	core1_job = NULL;
+}
+#else
+static int
+start_job(keygen_job *job)
+{
+	(void)job;
+	return 0;
+}
+
+static void
+join_job(keygen_job *job)
+{
+	(void)job;
+}
+#endif
+
+uint32_t
+rsa_keygen_parallel(const br_prng_class **rng,
+	br_rsa_private_key *sk, void *kbuf_priv,
+	br_rsa_public_key *pk, void *kbuf_pub,
+	unsigned size, uint32_t pubexp)
+{
+	keygen_job job;
+	unsigned char seed[32];
+	br_rsa_keygen_finish finish;
+	int started;
+	uint32_t r;
+
+	// the other core must not share the caller's PRNG
+	(*rng)->generate(rng, seed, sizeof seed);
+	br_hmac_drbg_init(&job.rng, &br_sha256_vtable, seed, sizeof seed);
+	memset(seed, 0, sizeof seed);
+
+	job.factor = br_rsa_keygen_factor_get_default();
+	job.kbuf_priv = kbuf_priv;
+	job.size = size;
+	job.pubexp = pubexp;
+	job.result = 0;
+
+	started = start_job(&job);
+	r = job.factor(rng, kbuf_priv, size, pubexp, 0);
+	if (started) {
+		join_job(&job);
+	} else if (r) {
+		run_job(&job);
+	}
+	memset(&job.rng, 0, sizeof job.rng);
+
+	if (!r || !job.result) {
+		return 0;
+	}
+
+	finish = br_rsa_keygen_finish_get_default();
+	return finish(sk, kbuf_priv, pk, kbuf_pub, size, pubexp);
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _RSA_KEYGEN_PARALLEL_H_
+#define _RSA_KEYGEN_PARALLEL_H_
+
+#include "bearssl/bearssl.h"
+
+/*
+ * Stack size (in bytes) of the task that searches for the second factor.
+ */
+#ifndef RSA_KEYGEN_PARALLEL_STACK_SIZE
+#define RSA_KEYGEN_PARALLEL_STACK_SIZE 6144
+#endif
+
+/*
+ * RSA key pair generation with the br_rsa_keygen signature, that looks
+ * for the two factors at the same time on the two cores of an ESP32 or
+ * an RP2040 (see br_rsa_keygen_factor), which roughly halves the time
+ * spent on a device that generates its key when it is provisioned. The
+ * other core uses its own HMAC_DRBG, seeded from rng. Other boards, an
+ * ESP32 running FreeRTOS on a single core, and an RP2040 sketch that
+ * uses core 1 itself (setup1() or loop1()) search for the factors one
+ * after the other, as br_rsa_keygen_get_default() would.
+ */
+uint32_t
+rsa_keygen_parallel(const br_prng_class **rng,
+	br_rsa_private_key *sk, void *kbuf_priv,
+	br_rsa_public_key *pk, void *kbuf_pub,
+	unsigned size, uint32_t pubexp);
+
+#endif
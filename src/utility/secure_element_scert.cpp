@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "SecureElement.h"
+#include "secure_element_scert.h"
+
+void
+secure_element_scert_init(secure_element_scert_context *ctx,
+	const br_x509_certificate *chain, size_t chain_len,
+	const br_ec_private_key *sk)
+{
+	ctx->vtable = &secure_element_scert_vtable;
+	ctx->chain = chain;
+	ctx->chain_len = chain_len;
+	ctx->sk = sk;
+}
+
+static int
+ses_choose(const br_ssl_server_policy_class **pctx,
+	const br_ssl_server_context *cc,
+	br_ssl_server_choices *choices)
+{
+	secure_element_scert_context *pc;
+	const br_suite_translated *st;
+	size_t u, st_num;
+
+	pc = (secure_element_scert_context *)(void *)pctx;
+	if (cc->eng.session.version < BR_TLS12) {
+		return 0;
+	}
+
+	/*
+	 * Bits 8 to 15 are the hash functions the client accepts
+	 * with ECDSA.
+	 */
+	if (((br_ssl_server_get_client_hashes(cc) >> 8)
+		& (1u << br_sha256_ID)) == 0)
+	{
+		return 0;
+	}
+
+	st = br_ssl_server_get_client_suites(cc, &st_num);
+	for (u = 0; u < st_num; u ++) {
+		if ((st[u][1] >> 12) == BR_SSLKEYX_ECDHE_ECDSA) {
+			choices->cipher_suite = st[u][0];
+			choices->algo_id = br_sha256_ID + 0xFF00;
+			choices->chain = pc->chain;
+			choices->chain_len = pc->chain_len;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+static uint32_t
+ses_do_keyx(const br_ssl_server_policy_class ** /*pctx*/,
+	unsigned char * /*data*/, size_t * /*len*/)
+{
+	/*
+	 * Static ECDH is never chosen.
+	 */
+	return 0;
+}
+
+static size_t
+ses_do_sign(const br_ssl_server_policy_class **pctx,
+	unsigned algo_id, unsigned char *data, size_t hv_len, size_t len)
+{
+	secure_element_scert_context *pc;
+	unsigned char hv[32];
+
+	pc = (secure_element_scert_context *)(void *)pctx;
+	if ((algo_id & 0xFF) != br_sha256_ID || hv_len != sizeof hv
+		|| len < 72)
+	{
+		return 0;
+	}
+	memcpy(hv, data, hv_len);
+	return secure_element_sign_asn1(NULL, &br_sha256_vtable,
+		hv, pc->sk, data);
+}
+
+const br_ssl_server_policy_class secure_element_scert_vtable = {
+	sizeof(secure_element_scert_context),
+	ses_choose,
+	ses_do_keyx,
+	ses_do_sign
+};
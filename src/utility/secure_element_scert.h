@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _SECURE_ELEMENT_SCERT_H_
+#define _SECURE_ELEMENT_SCERT_H_
+
+#include "bearssl/bearssl.h"
+
+/*
+ * Server policy for a P-256 certificate whose private key stays in a
+ * secure element (sk->x points to a secure_element_key): like
+ * br_ssl_server_set_single_ec() with BR_KEYTYPE_SIGN only, except that
+ * the ServerKeyExchange is always signed over SHA-256, the only hash
+ * the element signs, with secure_element_sign_asn1(). Only ECDHE_ECDSA
+ * suites on TLS 1.2 can be chosen.
+ */
+typedef struct {
+	const br_ssl_server_policy_class *vtable;
+	const br_x509_certificate *chain;
+	size_t chain_len;
+	const br_ec_private_key *sk;
+} secure_element_scert_context;
+
+extern const br_ssl_server_policy_class secure_element_scert_vtable;
+
+void
+secure_element_scert_init(secure_element_scert_context *ctx,
+	const br_x509_certificate *chain, size_t chain_len,
+	const br_ec_private_key *sk);
+
+#endif
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "session_cache_psk.h"
+
+void
+session_cache_psk_init(session_cache_psk_context *ctx,
+	const br_ssl_session_cache_class **inner,
+	const br_ssl_session_parameters *session)
+{
+	ctx->vtable = &session_cache_psk_vtable;
+	ctx->inner = inner;
+	ctx->session = session;
+}
+
+static void
+scp_save(const br_ssl_session_cache_class **ctx,
+	br_ssl_server_context *server_ctx,
+	const br_ssl_session_parameters *params)
+{
+	session_cache_psk_context *cc;
+
+	cc = (session_cache_psk_context *)(void *)ctx;
+	if (cc->inner != NULL) {
+		(*cc->inner)->save(cc->inner, server_ctx, params);
+	}
+}
+
+static int
+scp_load(const br_ssl_session_cache_class **ctx,
+	br_ssl_server_context *server_ctx,
+	br_ssl_session_parameters *params)
+{
+	session_cache_psk_context *cc;
+
+	cc = (session_cache_psk_context *)(void *)ctx;
+	if (params->session_id_len == cc->session->session_id_len
+		&& memcmp(params->session_id, cc->session->session_id,
+		params->session_id_len) == 0)
+	{
+		*params = *cc->session;
+		return 1;
+	}
+	if (cc->inner != NULL) {
+		return (*cc->inner)->load(cc->inner, server_ctx, params);
+	}
+	return 0;
+}
+
+const br_ssl_session_cache_class session_cache_psk_vtable = {
+	sizeof(session_cache_psk_context),
+	scp_save,
+	scp_load
+};
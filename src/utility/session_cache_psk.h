@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _SESSION_CACHE_PSK_H_
+#define _SESSION_CACHE_PSK_H_
+
+#include "bearssl/bearssl.h"
+
+/*
+ * Server session cache that resumes one fixed session, derived from a
+ * pre-shared key, and passes every other session ID to the inner cache
+ * (NULL for none). New sessions are saved in the inner cache.
+ */
+typedef struct {
+	const br_ssl_session_cache_class *vtable;
+	const br_ssl_session_cache_class **inner;
+	const br_ssl_session_parameters *session;
+} session_cache_psk_context;
+
+extern const br_ssl_session_cache_class session_cache_psk_vtable;
+
+void
+session_cache_psk_init(session_cache_psk_context *ctx,
+	const br_ssl_session_cache_class **inner,
+	const br_ssl_session_parameters *session);
+
+#endif
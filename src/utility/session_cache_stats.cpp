@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "session_cache_stats.h"
+
+void
+session_cache_stats_init(session_cache_stats_context *ctx,
+	const br_ssl_session_cache_class **inner)
+{
+	ctx->vtable = &session_cache_stats_vtable;
+	ctx->inner = inner;
+	ctx->hits = 0;
+	ctx->misses = 0;
+	ctx->saves = 0;
+}
+
+static void
+scs_save(const br_ssl_session_cache_class **ctx,
+	br_ssl_server_context *server_ctx,
+	const br_ssl_session_parameters *params)
+{
+	session_cache_stats_context *cc;
+
+	cc = (session_cache_stats_context *)(void *)ctx;
+	(*cc->inner)->save(cc->inner, server_ctx, params);
+	cc->saves ++;
+}
+
+static int
+scs_load(const br_ssl_session_cache_class **ctx,
+	br_ssl_server_context *server_ctx,
+	br_ssl_session_parameters *params)
+{
+	session_cache_stats_context *cc;
+	int found;
+
+	cc = (session_cache_stats_context *)(void *)ctx;
+	found = (*cc->inner)->load(cc->inner, server_ctx, params);
+	if (found) {
+		cc->hits ++;
+	} else {
+		cc->misses ++;
+	}
+	return found;
+}
+
+const br_ssl_session_cache_class session_cache_stats_vtable = {
+	sizeof(session_cache_stats_context),
+	scs_save,
+	scs_load
+};
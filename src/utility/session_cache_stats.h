@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _SESSION_CACHE_STATS_H_
+#define _SESSION_CACHE_STATS_H_
+
+#include "bearssl/bearssl.h"
+
+/*
+ * Server session cache that wraps another one and counts the resumption
+ * attempts it served (hits), the ones it could not (misses) and the
+ * sessions stored after a full handshake (saves). The server only asks
+ * the cache when the ClientHello carries a session ID, so a client that
+ * does not try to resume counts as neither a hit nor a miss.
+ */
+typedef struct {
+	const br_ssl_session_cache_class *vtable;
+	const br_ssl_session_cache_class **inner;
+	uint32_t hits;
+	uint32_t misses;
+	uint32_t saves;
+} session_cache_stats_context;
+
+extern const br_ssl_session_cache_class session_cache_stats_vtable;
+
+void
+session_cache_stats_init(session_cache_stats_context *ctx,
+	const br_ssl_session_cache_class **inner);
+
+#endif
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ssl_features.h"
+
+#if BEARSSL_ENABLE_RSA
+#define IF_RSA(...) __VA_ARGS__
+#else
+#define IF_RSA(...)
+#endif
+#if BEARSSL_ENABLE_GCM
+#define IF_GCM(...) __VA_ARGS__
+#else
+#define IF_GCM(...)
+#endif
+#if BEARSSL_ENABLE_CBC
+#define IF_CBC(...) __VA_ARGS__
+#else
+#define IF_CBC(...)
+#endif
+#if BEARSSL_ENABLE_3DES
+#define IF_3DES(...) __VA_ARGS__
+#else
+#define IF_3DES(...)
+#endif
+#if BEARSSL_ENABLE_CCM
+#define IF_CCM(...) __VA_ARGS__
+#else
+#define IF_CCM(...)
+#endif
+#if BEARSSL_ENABLE_CHACHA
+#define IF_CHACHA(...) __VA_ARGS__
+#else
+#define IF_CHACHA(...)
+#endif
+#if BEARSSL_ENABLE_SHA384
+#define IF_SHA384(...) __VA_ARGS__
+#else
+#define IF_SHA384(...)
+#endif
+
+/* in the order of br_ssl_client_init_full() */
+static const uint16_t ssl_features_suites[] = {
+	IF_CHACHA(BR_TLS_ECDHE_ECDSA_WITH_CHACHA20_POLY1305_SHA256,)
+	IF_CHACHA(IF_RSA(BR_TLS_ECDHE_RSA_WITH_CHACHA20_POLY1305_SHA256,))
+	IF_GCM(BR_TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256,)
+	IF_GCM(IF_RSA(BR_TLS_ECDHE_RSA_WITH_AES_128_GCM_SHA256,))
+	IF_GCM(IF_SHA384(BR_TLS_ECDHE_ECDSA_WITH_AES_256_GCM_SHA384,))
+	IF_GCM(IF_SHA384(IF_RSA(BR_TLS_ECDHE_RSA_WITH_AES_256_GCM_SHA384,)))
+	IF_CCM(BR_TLS_ECDHE_ECDSA_WITH_AES_128_CCM,)
+	IF_CCM(BR_TLS_ECDHE_ECDSA_WITH_AES_256_CCM,)
+	IF_CCM(BR_TLS_ECDHE_ECDSA_WITH_AES_128_CCM_8,)
+	IF_CCM(BR_TLS_ECDHE_ECDSA_WITH_AES_256_CCM_8,)
+	IF_CBC(BR_TLS_ECDHE_ECDSA_WITH_AES_128_CBC_SHA256,)
+	IF_CBC(IF_RSA(BR_TLS_ECDHE_RSA_WITH_AES_128_CBC_SHA256,))
+	IF_CBC(IF_SHA384(BR_TLS_ECDHE_ECDSA_WITH_AES_256_CBC_SHA384,))
+	IF_CBC(IF_SHA384(IF_RSA(BR_TLS_ECDHE_RSA_WITH_AES_256_CBC_SHA384,)))
+	IF_CBC(BR_TLS_ECDHE_ECDSA_WITH_AES_128_CBC_SHA,)
+	IF_CBC(IF_RSA(BR_TLS_ECDHE_RSA_WITH_AES_128_CBC_SHA,))
+	IF_CBC(BR_TLS_ECDHE_ECDSA_WITH_AES_256_CBC_SHA,)
+	IF_CBC(IF_RSA(BR_TLS_ECDHE_RSA_WITH_AES_256_CBC_SHA,))
+	IF_GCM(BR_TLS_ECDH_ECDSA_WITH_AES_128_GCM_SHA256,)
+	IF_GCM(IF_RSA(BR_TLS_ECDH_RSA_WITH_AES_128_GCM_SHA256,))
+	IF_GCM(IF_SHA384(BR_TLS_ECDH_ECDSA_WITH_AES_256_GCM_SHA384,))
+	IF_GCM(IF_SHA384(IF_RSA(BR_TLS_ECDH_RSA_WITH_AES_256_GCM_SHA384,)))
+	IF_CBC(BR_TLS_ECDH_ECDSA_WITH_AES_128_CBC_SHA256,)
+	IF_CBC(IF_RSA(BR_TLS_ECDH_RSA_WITH_AES_128_CBC_SHA256,))
+	IF_CBC(IF_SHA384(BR_TLS_ECDH_ECDSA_WITH_AES_256_CBC_SHA384,))
+	IF_CBC(IF_SHA384(IF_RSA(BR_TLS_ECDH_RSA_WITH_AES_256_CBC_SHA384,)))
+	IF_CBC(BR_TLS_ECDH_ECDSA_WITH_AES_128_CBC_SHA,)
+	IF_CBC(IF_RSA(BR_TLS_ECDH_RSA_WITH_AES_128_CBC_SHA,))
+	IF_CBC(BR_TLS_ECDH_ECDSA_WITH_AES_256_CBC_SHA,)
+	IF_CBC(IF_RSA(BR_TLS_ECDH_RSA_WITH_AES_256_CBC_SHA,))
+	IF_GCM(IF_RSA(BR_TLS_RSA_WITH_AES_128_GCM_SHA256,))
+	IF_GCM(IF_SHA384(IF_RSA(BR_TLS_RSA_WITH_AES_256_GCM_SHA384,)))
+	IF_CCM(IF_RSA(BR_TLS_RSA_WITH_AES_128_CCM,))
+	IF_CCM(IF_RSA(BR_TLS_RSA_WITH_AES_256_CCM,))
+	IF_CCM(IF_RSA(BR_TLS_RSA_WITH_AES_128_CCM_8,))
+	IF_CCM(IF_RSA(BR_TLS_RSA_WITH_AES_256_CCM_8,))
+	IF_CBC(IF_RSA(BR_TLS_RSA_WITH_AES_128_CBC_SHA256,))
+	IF_CBC(IF_RSA(BR_TLS_RSA_WITH_AES_256_CBC_SHA256,))
+	IF_CBC(IF_RSA(BR_TLS_RSA_WITH_AES_128_CBC_SHA,))
+	IF_CBC(IF_RSA(BR_TLS_RSA_WITH_AES_256_CBC_SHA,))
+	IF_3DES(BR_TLS_ECDHE_ECDSA_WITH_3DES_EDE_CBC_SHA,)
+	IF_3DES(IF_RSA(BR_TLS_ECDHE_RSA_WITH_3DES_EDE_CBC_SHA,))
+	IF_3DES(BR_TLS_ECDH_ECDSA_WITH_3DES_EDE_CBC_SHA,)
+	IF_3DES(IF_RSA(BR_TLS_ECDH_RSA_WITH_3DES_EDE_CBC_SHA,))
+	IF_3DES(IF_RSA(BR_TLS_RSA_WITH_3DES_EDE_CBC_SHA,))
+	0
+};
+
+/* indexed by hash ID - 1, MD5 and SHA-1 remain for TLS 1.0 and 1.1 */
+static const br_hash_class *const ssl_features_hashes[] = {
+	&br_md5_vtable,
+	&br_sha1_vtable,
+	&br_sha224_vtable,
+	&br_sha256_vtable,
+	IF_SHA384(&br_sha384_vtable, &br_sha512_vtable,)
+};
+
+/* see ssl_features.h */
+void
+ssl_features_init(br_ssl_engine_context *eng, br_x509_minimal_context *xc,
+	const br_ec_impl *ec)
+{
+	size_t u;
+
+	br_ssl_engine_set_versions(eng, BR_TLS10, BR_TLS12);
+
+	/* the terminating 0 is only there to keep the array non-empty */
+	br_ssl_engine_set_suites(eng, ssl_features_suites,
+		(sizeof ssl_features_suites) / (sizeof ssl_features_suites[0]) - 1);
+	br_ssl_engine_set_ec(eng, ec);
+
+	for (u = 0; u < (sizeof ssl_features_hashes) / (sizeof ssl_features_hashes[0]); u ++) {
+		br_ssl_engine_set_hash(eng, (int)u + 1, ssl_features_hashes[u]);
+		if (xc != NULL) {
+			br_x509_minimal_set_hash(xc, (int)u + 1, ssl_features_hashes[u]);
+		}
+	}
+
+	br_ssl_engine_set_prf10(eng, &br_tls10_prf);
+	br_ssl_engine_set_prf_sha256(eng, &br_tls12_sha256_prf);
+#if BEARSSL_ENABLE_SHA384
+	br_ssl_engine_set_prf_sha384(eng, &br_tls12_sha384_prf);
+#endif
+
+	if (xc != NULL) {
+#if BEARSSL_ENABLE_RSA
+		br_ssl_engine_set_default_rsavrfy(eng);
+		br_x509_minimal_set_rsa(xc, br_ssl_engine_get_rsavrfy(eng));
+#endif
+		br_ssl_engine_set_ecdsa(eng, br_ecdsa_vrfy_asn1_get_default());
+		br_x509_minimal_set_ecdsa(xc, ec, br_ssl_engine_get_ecdsa(eng));
+	}
+
+#if BEARSSL_ENABLE_CBC
+	br_ssl_engine_set_default_aes_cbc(eng);
+#endif
+#if BEARSSL_ENABLE_CCM
+	br_ssl_engine_set_default_aes_ccm(eng);
+#endif
+#if BEARSSL_ENABLE_GCM
+	br_ssl_engine_set_default_aes_gcm(eng);
+#endif
+#if BEARSSL_ENABLE_3DES
+	br_ssl_engine_set_default_des_cbc(eng);
+#endif
+#if BEARSSL_ENABLE_CHACHA
+	br_ssl_engine_set_default_chapol(eng);
+#endif
+}
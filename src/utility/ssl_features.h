@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _SSL_FEATURES_H_
+#define _SSL_FEATURES_H_
+
+#include "BearSSLConfig.h"
+#include "bearssl/bearssl.h"
+
+/*
+ * Engine setup of br_ssl_client_init_full() and br_ssl_server_init_full_*()
+ * limited to the algorithms enabled in BearSSLConfig.h (BEARSSL_ENABLE_*):
+ * TLS 1.0 to 1.2, the full suite list without the disabled ones, hash
+ * functions, PRFs and record ciphers, and the 'ec' implementation for
+ * ECDHE. With an X.509 context (clients), it also gets the hash functions
+ * and signature verifiers, and the engine the RSA and ECDSA verifiers.
+ * Only the code of the enabled algorithms is referenced.
+ */
+void
+ssl_features_init(br_ssl_engine_context *eng, br_x509_minimal_context *xc,
+	const br_ec_impl *ec);
+
+#endif
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ta_key_cache.h"
+
+typedef struct {
+	size_t ta;
+	size_t size;
+	union {
+		br_rsa_i15_precomp_key i15;
+		br_rsa_i31_precomp_key i31;
+		br_ec_p256_precomp_key ec;
+	} key;
+} ta_key_cache_entry;
+
+#define ENTRY_ALIGN   (sizeof(void *) > 4 ? sizeof(void *) : 4)
+
+static size_t
+align_up(size_t x)
+{
+	return (x + ENTRY_ALIGN - 1) & ~(ENTRY_ALIGN - 1);
+}
+
+void
+ta_key_cache_init(ta_key_cache_context *ctx, void *buf, size_t len,
+	const br_x509_trust_anchor *tas, size_t num_tas)
+{
+	const br_ec_impl *iec;
+	size_t skip;
+
+	skip = align_up((uintptr_t)buf) - (uintptr_t)buf;
+	if (skip > len) {
+		skip = len;
+	}
+	ctx->buf = (unsigned char *)buf + skip;
+	ctx->len = len - skip;
+	ctx->used = 0;
+	ctx->tas = tas;
+	ctx->num_tas = num_tas;
+	ctx->rsa_i15 = br_rsa_pkcs1_vrfy_get_default() == &br_rsa_i15_pkcs1_vrfy;
+	iec = br_ec_get_default();
+	ctx->ec_m15 = iec == &br_ec_all_m15 || iec == &br_ec_p256_m15;
+	ctx->ecdsa_i15 = br_ecdsa_vrfy_asn1_get_default() == &br_ecdsa_i15_vrfy_asn1;
+}
+
+/*
+ * Precompute an RSA key after the entry header, returning the number of
+ * bytes used (0 on error).
+ */
+static size_t
+make_rsa(ta_key_cache_context *ctx, ta_key_cache_entry *e,
+	const br_rsa_public_key *pk, unsigned char *tab, size_t len)
+{
+	if (ctx->rsa_i15) {
+		return br_rsa_i15_precomp_init(&e->key.i15, pk,
+			(uint16_t *)(void *)tab, len / sizeof(uint16_t))
+			* sizeof(uint16_t);
+	}
+	return br_rsa_i31_precomp_init(&e->key.i31, pk,
+		(uint32_t *)(void *)tab, len / sizeof(uint32_t))
+		* sizeof(uint32_t);
+}
+
+/*
+ * Precompute a P-256 key after the entry header, returning the number
+ * of bytes used (0 on error).
+ */
+static size_t
+make_ec(ta_key_cache_context *ctx, ta_key_cache_entry *e,
+	const br_ec_public_key *pk, unsigned char *tab, size_t len)
+{
+	uint32_t r;
+
+	if (len < BR_EC_P256_PRECOMP_WORDS * sizeof(uint32_t)) {
+		return 0;
+	}
+	if (ctx->ec_m15) {
+		r = br_ec_p256_m15_precomp(&e->key.ec,
+			(uint32_t *)(void *)tab, pk->q, pk->qlen);
+	} else {
+		r = br_ec_p256_m31_precomp(&e->key.ec,
+			(uint32_t *)(void *)tab, pk->q, pk->qlen);
+	}
+	return r ? BR_EC_P256_PRECOMP_WORDS * sizeof(uint32_t) : 0;
+}
+
+/*
+ * Find the entry of an anchor, or make it if there is room left.
+ */
+static const ta_key_cache_entry *
+get_entry(ta_key_cache_context *ctx, size_t ta)
+{
+	const br_x509_pkey *pk;
+	ta_key_cache_entry *e;
+	size_t off, head, size;
+	unsigned char *tab;
+
+	for (off = 0; off < ctx->used; off += e->size) {
+		e = (ta_key_cache_entry *)(void *)(ctx->buf + off);
+		if (e->ta == ta) {
+			return e;
+		}
+	}
+	head = align_up(sizeof *e);
+	if (ctx->used + head >= ctx->len) {
+		return NULL;
+	}
+	e = (ta_key_cache_entry *)(void *)(ctx->buf + ctx->used);
+	tab = (unsigned char *)e + head;
+	pk = &ctx->tas[ta].pkey;
+	if (pk->key_type == BR_KEYTYPE_RSA) {
+		size = make_rsa(ctx, e, &pk->key.rsa,
+			tab, ctx->len - ctx->used - head);
+	} else {
+		/*
+		 * Other curves are not cached, there may still be room
+		 * for other anchors.
+		 */
+		if (pk->key.ec.curve != BR_EC_secp256r1) {
+			return NULL;
+		}
+		size = make_ec(ctx, e, &pk->key.ec,
+			tab, ctx->len - ctx->used - head);
+	}
+	if (size == 0 || ctx->used + align_up(head + size) > ctx->len) {
+		/*
+		 * Don't try again on every signature: the buffer is full.
+		 */
+		ctx->len = ctx->used;
+		return NULL;
+	}
+	e->ta = ta;
+	e->size = align_up(head + size);
+	ctx->used += e->size;
+	return e;
+}
+
+int
+ta_key_cache_rsa_vrfy(void *ctx, size_t ta,
+	const unsigned char *x, size_t xlen,
+	const unsigned char *hash_oid, size_t hash_len,
+	unsigned char *hash_out)
+{
+	ta_key_cache_context *cc;
+	const ta_key_cache_entry *e;
+
+	cc = (ta_key_cache_context *)ctx;
+	if (ta >= cc->num_tas || cc->tas[ta].pkey.key_type != BR_KEYTYPE_RSA) {
+		return -1;
+	}
+	e = get_entry(cc, ta);
+	if (e == NULL) {
+		return -1;
+	}
+	if (cc->rsa_i15) {
+		return (int)br_rsa_i15_pkcs1_vrfy_precomp(x, xlen,
+			hash_oid, hash_len, &e->key.i15, hash_out);
+	}
+	return (int)br_rsa_i31_pkcs1_vrfy_precomp(x, xlen,
+		hash_oid, hash_len, &e->key.i31, hash_out);
+}
+
+int
+ta_key_cache_ecdsa_vrfy(void *ctx, size_t ta,
+	const void *hash, size_t hash_len,
+	const void *sig, size_t sig_len)
+{
+	ta_key_cache_context *cc;
+	const ta_key_cache_entry *e;
+
+	cc = (ta_key_cache_context *)ctx;
+	if (ta >= cc->num_tas || cc->tas[ta].pkey.key_type != BR_KEYTYPE_EC) {
+		return -1;
+	}
+	e = get_entry(cc, ta);
+	if (e == NULL) {
+		return -1;
+	}
+	if (cc->ecdsa_i15) {
+		return (int)br_ecdsa_i15_vrfy_asn1_precomp(&e->key.ec,
+			hash, hash_len, sig, sig_len);
+	}
+	return (int)br_ecdsa_i31_vrfy_asn1_precomp(&e->key.ec,
+		hash, hash_len, sig, sig_len);
+}
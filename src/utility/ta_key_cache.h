@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _TA_KEY_CACHE_H_
+#define _TA_KEY_CACHE_H_
+
+#include "bearssl/bearssl.h"
+
+/*
+ * Trust anchor RSA and ECDSA verifiers (see br_x509_minimal_set_ta_rsa_vrfy()
+ * and br_x509_minimal_set_ta_ecdsa_vrfy()) that keep the precomputed form
+ * of the anchor keys they have used in a caller-provided buffer: the
+ * key is decoded, and the RSA Montgomery constants or the P-256 window
+ * table computed, the first time an anchor verifies a signature, and
+ * reused afterwards. The representation follows the default RSA ("i15"
+ * or "i31") and EC ("m15" or "m31") implementations. Once the buffer is
+ * full, further anchors use the regular implementation, as do EC
+ * anchors on other curves than P-256.
+ */
+typedef struct {
+	unsigned char *buf;
+	size_t len;
+	size_t used;
+	const br_x509_trust_anchor *tas;
+	size_t num_tas;
+	int rsa_i15;
+	int ec_m15;
+	int ecdsa_i15;
+} ta_key_cache_context;
+
+void
+ta_key_cache_init(ta_key_cache_context *ctx, void *buf, size_t len,
+	const br_x509_trust_anchor *tas, size_t num_tas);
+
+int
+ta_key_cache_rsa_vrfy(void *ctx, size_t ta,
+	const unsigned char *x, size_t xlen,
+	const unsigned char *hash_oid, size_t hash_len,
+	unsigned char *hash_out);
+
+int
+ta_key_cache_ecdsa_vrfy(void *ctx, size_t ta,
+	const void *hash, size_t hash_len,
+	const void *sig, size_t sig_len);
+
+#endif
@@ -0,0 +1,393 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "BearSSLConfig.h"
+#include "worker_core.h"
+
+#if defined(BEARSSL_NO_HEAP)
+// the task or the core 1 stack would come from the heap, everything
+// runs on this core
+#elif defined(ARDUINO_ARCH_ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#if !CONFIG_FREERTOS_UNICORE
+#define WORKER_CORE_ESP32 1
+#endif
+#elif defined(ARDUINO_ARCH_RP2040) && !defined(ARDUINO_ARCH_MBED)
+#include <pico/multicore.h>
+#define WORKER_CORE_RP2040 1
+
+// defined by sketches that run their own code on core 1
+extern void setup1() __attribute__((weak));
+extern void loop1() __attribute__((weak));
+#endif
+
+typedef struct {
+	void (*run)(void *args);
+	void *args;
+	volatile int done;
+#if WORKER_CORE_ESP32
+	SemaphoreHandle_t finished;
+#endif
+} worker_job;
+
+static void (*wait_callback)(void) = NULL;
+
+#if WORKER_CORE_ESP32
+// one job at a time on the other core, the others queue up
+static SemaphoreHandle_t queue = NULL;
+
+static void
+worker_task(void *arg)
+{
+	worker_job *job = (worker_job *)arg;
+
+	job->run(job->args);
+	xSemaphoreGive(job->finished);
+	vTaskDelete(NULL);
+}
+
+/*
+ * Start the job on the other core; returns 0 if it must be run on this
+ * core instead.
+ */
+static int
+start_job(worker_job *job)
+{
+	if (queue == NULL) {
+		SemaphoreHandle_t created = xSemaphoreCreateMutex();
+		SemaphoreHandle_t expected = NULL;
+
+		if (created == NULL) {
+			return 0;
+		}
+		if (!__atomic_compare_exchange_n(&queue, &expected, created,
+			false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+		{
+			vSemaphoreDelete(created);
+		}
+	}
+
+	// the wait callback of a job of this task started another one
+	if (xSemaphoreGetMutexHolder(queue) == xTaskGetCurrentTaskHandle()) {
+		return 0;
+	}
+	while (xSemaphoreTake(queue, wait_callback ? 1 : portMAX_DELAY) != pdTRUE) {
+		wait_callback();
+	}
+
+	job->finished = xSemaphoreCreateBinary();
+	if (job->finished == NULL) {
+		xSemaphoreGive(queue);
+		return 0;
+	}
+
+	// idle priority, so that the idle task of the other core still
+	// gets to feed the task watchdog
+	if (xTaskCreatePinnedToCore(worker_task, "bearssl_worker",
+		WORKER_CORE_STACK_SIZE, job, tskIDLE_PRIORITY, NULL,
+		xPortGetCoreID() ^ 1) != pdPASS)
+	{
+		vSemaphoreDelete(job->finished);
+		xSemaphoreGive(queue);
+		return 0;
+	}
+	return 1;
+}
+
+static void
+join_job(worker_job *job)
+{
+	if (wait_callback == NULL) {
+		xSemaphoreTake(job->finished, portMAX_DELAY);
+	} else {
+		while (xSemaphoreTake(job->finished, 1) != pdTRUE) {
+			wait_callback();
+		}
+	}
+	vSemaphoreDelete(job->finished);
+	xSemaphoreGive(queue);
+}
+#elif WORKER_CORE_RP2040
+static worker_job *volatile core1_job;
+static uint32_t *core1_stack;
+
+static void
+worker_core1(void)
+{
+	core1_job->run(core1_job->args);
+	__sync_synchronize();
+	core1_job->done = 1;
+	for (;;) {
+		tight_loop_contents();
+	}
+}
+
+static int
+start_job(worker_job *job)
+{
+	// core 1 is busy, e.g. the wait callback started a handshake too
+	if (setup1 || loop1 || core1_job != NULL) {
+		return 0;
+	}
+	core1_stack = (uint32_t *)malloc(WORKER_CORE_STACK_SIZE);
+	if (core1_stack == NULL) {
+		return 0;
+	}
+	core1_job = job;
+	job->done = 0;
+	multicore_launch_core1_with_stack(worker_core1, core1_stack,
+		WORKER_CORE_STACK_SIZE);
+	return 1;
+}
+
+static void
+join_job(worker_job *job)
+{
+	while (!job->done) {
+		if (wait_callback != NULL) {
+			wait_callback();
+		} else {
+			tight_loop_contents();
+		}
+	}
+	__sync_synchronize();
+	multicore_reset_core1();
+	free(core1_stack);
+	core1_stack = NULL;
+	core1_job = NULL;
+}
+#else
+static int
+start_job(worker_job *job)
+{
+	(void)job;
+	return 0;
+}
+
+static void
+join_job(worker_job *job)
+{
+	(void)job;
+}
+#endif
+
+static void
+run_job(void (*run)(void *args), void *args)
+{
+	worker_job job;
+
+	job.run = run;
+	job.args = args;
+	job.done = 0;
+	if (start_job(&job)) {
+		join_job(&job);
+	} else {
+		run(args);
+	}
+}
+
+static const br_ec_impl *ec_base;
+static br_ec_impl ec_wrapper;
+
+typedef struct {
+	unsigned char *A;
+	const unsigned char *B;
+	size_t len;
+	const unsigned char *x;
+	size_t xlen;
+	const unsigned char *y;
+	size_t ylen;
+	int curve;
+	uint32_t result;
+	size_t length;
+} ec_args;
+
+static const unsigned char *
+ec_generator(int curve, size_t *len)
+{
+	return ec_base->generator(curve, len);
+}
+
+static const unsigned char *
+ec_order(int curve, size_t *len)
+{
+	return ec_base->order(curve, len);
+}
+
+static size_t
+ec_xoff(int curve, size_t *len)
+{
+	return ec_base->xoff(curve, len);
+}
+
+static void
+run_mul(void *arg)
+{
+	ec_args *a = (ec_args *)arg;
+
+	a->result = ec_base->mul(a->A, a->len, a->x, a->xlen, a->curve);
+}
+
+static uint32_t
+ec_mul(unsigned char *G, size_t Glen,
+	const unsigned char *x, size_t xlen, int curve)
+{
+	ec_args a;
+
+	a.A = G;
+	a.len = Glen;
+	a.x = x;
+	a.xlen = xlen;
+	a.curve = curve;
+	run_job(run_mul, &a);
+	return a.result;
+}
+
+static void
+run_mulgen(void *arg)
+{
+	ec_args *a = (ec_args *)arg;
+
+	a->length = ec_base->mulgen(a->A, a->x, a->xlen, a->curve);
+}
+
+static size_t
+ec_mulgen(unsigned char *R,
+	const unsigned char *x, size_t xlen, int curve)
+{
+	ec_args a;
+
+	a.A = R;
+	a.x = x;
+	a.xlen = xlen;
+	a.curve = curve;
+	run_job(run_mulgen, &a);
+	return a.length;
+}
+
+static void
+run_muladd(void *arg)
+{
+	ec_args *a = (ec_args *)arg;
+
+	a->result = ec_base->muladd(a->A, a->B, a->len,
+		a->x, a->xlen, a->y, a->ylen, a->curve);
+}
+
+static uint32_t
+ec_muladd(unsigned char *A, const unsigned char *B, size_t len,
+	const unsigned char *x, size_t xlen,
+	const unsigned char *y, size_t ylen, int curve)
+{
+	ec_args a;
+
+	a.A = A;
+	a.B = B;
+	a.len = len;
+	a.x = x;
+	a.xlen = xlen;
+	a.y = y;
+	a.ylen = ylen;
+	a.curve = curve;
+	run_job(run_muladd, &a);
+	return a.result;
+}
+
+const br_ec_impl *
+worker_core_ec_impl(const br_ec_impl *base)
+{
+	if (base == NULL || base == &ec_wrapper) {
+		return base;
+	}
+
+	ec_base = base;
+	ec_wrapper.supported_curves = base->supported_curves;
+	ec_wrapper.generator = ec_generator;
+	ec_wrapper.order = ec_order;
+	ec_wrapper.xoff = ec_xoff;
+	ec_wrapper.mul = ec_mul;
+	ec_wrapper.mulgen = ec_mulgen;
+	ec_wrapper.muladd = ec_muladd;
+	return &ec_wrapper;
+}
+
+static br_rsa_pkcs1_vrfy rsa_base;
+
+typedef struct {
+	const unsigned char *x;
+	size_t xlen;
+	const unsigned char *hash_oid;
+	size_t hash_len;
+	const br_rsa_public_key *pk;
+	unsigned char *hash_out;
+	uint32_t result;
+} rsa_args;
+
+static void
+run_rsa_vrfy(void *arg)
+{
+	rsa_args *a = (rsa_args *)arg;
+
+	a->result = rsa_base(a->x, a->xlen, a->hash_oid, a->hash_len,
+		a->pk, a->hash_out);
+}
+
+static uint32_t
+rsa_vrfy(const unsigned char *x, size_t xlen,
+	const unsigned char *hash_oid, size_t hash_len,
+	const br_rsa_public_key *pk, unsigned char *hash_out)
+{
+	rsa_args a;
+
+	a.x = x;
+	a.xlen = xlen;
+	a.hash_oid = hash_oid;
+	a.hash_len = hash_len;
+	a.pk = pk;
+	a.hash_out = hash_out;
+	run_job(run_rsa_vrfy, &a);
+	return a.result;
+}
+
+br_rsa_pkcs1_vrfy
+worker_core_rsa_pkcs1_vrfy(br_rsa_pkcs1_vrfy base)
+{
+	if (base == NULL || base == rsa_vrfy) {
+		return base;
+	}
+
+	rsa_base = base;
+	return rsa_vrfy;
+}
+
+void
+worker_core_set_wait(void (*wait)(void))
+{
+	wait_callback = wait;
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _WORKER_CORE_H_
+#define _WORKER_CORE_H_
+
+#include "bearssl/bearssl.h"
+
+/*
+ * Stack size (in bytes) of the task or core that runs an operation.
+ */
+#ifndef WORKER_CORE_STACK_SIZE
+#define WORKER_CORE_STACK_SIZE 6144
+#endif
+
+/*
+ * Implementations that run the expensive public key operations of a
+ * handshake on the other core of an ESP32 or an RP2040, while the
+ * calling core waits: point multiplications of base (ECDHE, and the
+ * ECDSA verifications and signatures that use this implementation) and
+ * RSA PKCS#1 verifications of base. All other operations go to base.
+ * There is one job at a time on the other core, the connections of other
+ * tasks queue up behind it; a job started by the wait callback meanwhile
+ * (e.g. the handshake of another connection, see BearSSLConnectionSet)
+ * runs on the calling core.
+ *
+ * On an ESP32 the calling task blocks, so that the other tasks of its
+ * core (e.g. the network stack) keep running; on an RP2040 the caller
+ * spins. In both cases the function set with worker_core_set_wait() is
+ * called repeatedly in the meantime, it must not use the connection that
+ * is in its handshake. Other boards, an ESP32 running FreeRTOS on a
+ * single core, an RP2040 sketch that uses core 1 itself (setup1() or
+ * loop1()), and builds with BEARSSL_NO_HEAP run the operations on the
+ * calling core, as base would.
+ *
+ * base is kept in a static variable: all connections share the last one.
+ */
+const br_ec_impl *worker_core_ec_impl(const br_ec_impl *base);
+
+br_rsa_pkcs1_vrfy worker_core_rsa_pkcs1_vrfy(br_rsa_pkcs1_vrfy base);
+
+void worker_core_set_wait(void (*wait)(void));
+
+#endif
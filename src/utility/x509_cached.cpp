@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "x509_cached.h"
+
+void
+x509_cached_init(x509_cached_context *ctx, br_x509_minimal_context *inner,
+	void *records, size_t len)
+{
+	ctx->vtable = &x509_cached_vtable;
+	ctx->inner = inner;
+	ctx->records = (unsigned char *)records;
+	ctx->num_records = len / X509_CACHED_RECORD_SIZE;
+	ctx->record = NULL;
+	ctx->cert_num = 0;
+	ctx->hit = 0;
+}
+
+/*
+ * Compare two dates, expressed in days and seconds.
+ */
+static int
+date_cmp(uint32_t d1, uint32_t s1, uint32_t d2, uint32_t s2)
+{
+	if (d1 != d2) {
+		return d1 < d2 ? -1 : 1;
+	}
+	if (s1 != s2) {
+		return s1 < s2 ? -1 : 1;
+	}
+	return 0;
+}
+
+static void
+xc_start_chain(const br_x509_class **ctx, const char *server_name)
+{
+	x509_cached_context *xc;
+	unsigned char zero;
+
+	xc = (x509_cached_context *)(void *)ctx;
+	xc->cert_num = 0;
+	xc->hit = 0;
+	xc->record = NULL;
+	zero = 0;
+	br_sha256_init(&xc->hc);
+	if (server_name != NULL) {
+		br_sha256_update(&xc->hc, server_name, strlen(server_name));
+	}
+	br_sha256_update(&xc->hc, &zero, 1);
+	xc->inner->vtable->start_chain(&xc->inner->vtable, server_name);
+}
+
+static void
+xc_start_cert(const br_x509_class **ctx, uint32_t length)
+{
+	x509_cached_context *xc;
+
+	xc = (x509_cached_context *)(void *)ctx;
+	if (xc->hit) {
+		return;
+	}
+	if (xc->cert_num == 0) {
+		br_x509_decoder_init(&xc->decoder, 0, 0);
+	}
+	xc->inner->vtable->start_cert(&xc->inner->vtable, length);
+}
+
+static void
+xc_append(const br_x509_class **ctx, const unsigned char *buf, size_t len)
+{
+	x509_cached_context *xc;
+
+	xc = (x509_cached_context *)(void *)ctx;
+	if (xc->hit) {
+		return;
+	}
+	if (xc->cert_num == 0) {
+		br_sha256_update(&xc->hc, buf, len);
+		br_x509_decoder_push(&xc->decoder, buf, len);
+	}
+	xc->inner->vtable->append(&xc->inner->vtable, buf, len);
+}
+
+static void
+xc_end_cert(const br_x509_class **ctx)
+{
+	x509_cached_context *xc;
+	br_x509_decoder_context *dc;
+	br_x509_minimal_context *mc;
+
+	xc = (x509_cached_context *)(void *)ctx;
+	if (xc->hit) {
+		return;
+	}
+	xc->inner->vtable->end_cert(&xc->inner->vtable);
+	if (xc->cert_num ++ != 0) {
+		return;
+	}
+
+	/*
+	 * The end-entity certificate is complete: look it up before the
+	 * minimal engine gets to verify its signature with the next key.
+	 */
+	dc = &xc->decoder;
+	mc = xc->inner;
+	if (xc->num_records == 0 || (mc->days == 0 && mc->seconds == 0)
+		|| br_x509_decoder_get_pkey(dc) == NULL)
+	{
+		return;
+	}
+	br_sha256_out(&xc->hc, xc->hash);
+	xc->record = xc->records
+		+ (xc->hash[0] % xc->num_records) * X509_CACHED_RECORD_SIZE;
+	if (date_cmp(mc->days, mc->seconds,
+		dc->notbefore_days, dc->notbefore_seconds) < 0
+		|| date_cmp(mc->days, mc->seconds,
+		dc->notafter_days, dc->notafter_seconds) > 0)
+	{
+		/*
+		 * Let the minimal engine report the expired certificate,
+		 * and don't record it.
+		 */
+		xc->record = NULL;
+		return;
+	}
+	xc->hit = memcmp(xc->record, xc->hash, sizeof xc->hash) == 0;
+}
+
+static unsigned
+xc_end_chain(const br_x509_class **ctx)
+{
+	x509_cached_context *xc;
+	unsigned err, usages;
+
+	xc = (x509_cached_context *)(void *)ctx;
+	if (xc->hit) {
+		return 0;
+	}
+	err = xc->inner->vtable->end_chain(&xc->inner->vtable);
+	if (err == 0 && xc->record != NULL) {
+		usages = 0;
+		xc->inner->vtable->get_pkey(
+			(const br_x509_class *const *)&xc->inner->vtable, &usages);
+		memcpy(xc->record, xc->hash, sizeof xc->hash);
+		xc->record[sizeof xc->hash] = (unsigned char)usages;
+	}
+	return err;
+}
+
+static const br_x509_pkey *
+xc_get_pkey(const br_x509_class *const *ctx, unsigned *usages)
+{
+	x509_cached_context *xc;
+
+	xc = (x509_cached_context *)(void *)ctx;
+	if (!xc->hit) {
+		return xc->inner->vtable->get_pkey(
+			(const br_x509_class *const *)&xc->inner->vtable, usages);
+	}
+	if (usages != NULL) {
+		*usages = xc->record[sizeof xc->hash];
+	}
+	return br_x509_decoder_get_pkey(&xc->decoder);
+}
+
+const br_x509_class x509_cached_vtable = {
+	sizeof(x509_cached_context),
+	xc_start_chain,
+	xc_start_cert,
+	xc_append,
+	xc_end_cert,
+	xc_end_chain,
+	xc_get_pkey
+};
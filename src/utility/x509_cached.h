@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _X509_CACHED_H_
+#define _X509_CACHED_H_
+
+#include "bearssl/bearssl.h"
+
+/*
+ * Size of a cache record: hash of the server name and end-entity
+ * certificate, followed by the key usages granted by the validation.
+ */
+#define X509_CACHED_RECORD_SIZE   (32 + 1)
+
+/*
+ * X.509 "engine" that remembers which end-entity certificates a
+ * br_x509_minimal_context has already validated. When the server presents
+ * the same end-entity certificate again for the same server name, and the
+ * validation time is within that certificate's validity period, the rest
+ * of the chain is not processed, so the signatures of the chain are not
+ * verified again. Otherwise the chain goes to the minimal engine, and a
+ * successful validation is recorded.
+ *
+ * The records live in a caller-provided buffer, so that they can be kept
+ * in memory that survives a reset. The buffer must be cleared when the
+ * trust anchors change. Without a validation time (br_x509_minimal_set_time)
+ * the cache is not used.
+ */
+typedef struct {
+	const br_x509_class *vtable;
+	br_x509_minimal_context *inner;
+	unsigned char *records;
+	size_t num_records;
+	br_x509_decoder_context decoder;
+	br_sha256_context hc;
+	unsigned char hash[32];
+	unsigned char *record;
+	unsigned cert_num;
+	int hit;
+} x509_cached_context;
+
+extern const br_x509_class x509_cached_vtable;
+
+void
+x509_cached_init(x509_cached_context *ctx, br_x509_minimal_context *inner,
+	void *records, size_t len);
+
+#endif
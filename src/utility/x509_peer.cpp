@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "x509_peer.h"
+
+void
+x509_peer_init(x509_peer_context *ctx, const br_x509_class **inner,
+	const br_ssl_engine_context *eng,
+	void (*callback)(void *ctx, const unsigned char *der, size_t len,
+		unsigned err),
+	void *callback_ctx, unsigned char *spill, size_t spill_len)
+{
+	ctx->vtable = &x509_peer_vtable;
+	ctx->inner = inner;
+	ctx->eng = eng;
+	ctx->callback = callback;
+	ctx->callback_ctx = callback_ctx;
+	ctx->spill = spill;
+	ctx->spill_len = spill_len;
+	ctx->der = NULL;
+	ctx->index = -1;
+}
+
+static void
+xp_start_chain(const br_x509_class **ctx, const char *server_name)
+{
+	x509_peer_context *xc;
+
+	xc = (x509_peer_context *)(void *)ctx;
+	xc->der = NULL;
+	xc->last = NULL;
+	xc->len = 0;
+	xc->expected = 0;
+	xc->index = -1;
+	xc->in_place = 1;
+	(*xc->inner)->start_chain(xc->inner, server_name);
+}
+
+static void
+xp_start_cert(const br_x509_class **ctx, uint32_t length)
+{
+	x509_peer_context *xc;
+
+	xc = (x509_peer_context *)(void *)ctx;
+	if (++xc->index == 0) {
+		xc->expected = length;
+	}
+	(*xc->inner)->start_cert(xc->inner, length);
+}
+
+static void
+xp_append(const br_x509_class **ctx, const unsigned char *buf, size_t len)
+{
+	x509_peer_context *xc;
+	const br_ssl_engine_context *eng;
+	const unsigned char *src;
+
+	xc = (x509_peer_context *)(void *)ctx;
+	eng = xc->eng;
+	(*xc->inner)->append(xc->inner, buf, len);
+
+	/*
+	 * The chunk was read from the current pass over the payload if
+	 * it starts after the beginning of that pass (ixa is updated when
+	 * the handshake code returns); a chunk of another record or pass
+	 * starts before the end of the previous one, as the payload is
+	 * always read from the start of the buffer.
+	 */
+	src = eng->hbuf_in - len;
+	if (src < eng->ibuf + eng->ixa
+		|| (xc->last != NULL && src < xc->last))
+	{
+		xc->in_place = 0;
+	}
+	xc->last = eng->hbuf_in;
+
+	if (xc->index != 0) {
+		return;
+	}
+	if (xc->der == NULL) {
+		xc->der = src;
+	} else if (src != xc->der + xc->len) {
+		xc->in_place = 0;
+	}
+	if (xc->spill != NULL && xc->len + len <= xc->spill_len) {
+		memcpy(xc->spill + xc->len, buf, len);
+	}
+	xc->len += len;
+}
+
+static void
+xp_end_cert(const br_x509_class **ctx)
+{
+	x509_peer_context *xc;
+
+	xc = (x509_peer_context *)(void *)ctx;
+	(*xc->inner)->end_cert(xc->inner);
+}
+
+static unsigned
+xp_end_chain(const br_x509_class **ctx)
+{
+	x509_peer_context *xc;
+	const unsigned char *der;
+	unsigned err;
+
+	xc = (x509_peer_context *)(void *)ctx;
+	err = (*xc->inner)->end_chain(xc->inner);
+
+	der = NULL;
+	if (xc->index >= 0 && xc->len == xc->expected) {
+		if (xc->in_place) {
+			der = xc->der;
+		} else if (xc->spill != NULL && xc->len <= xc->spill_len) {
+			der = xc->spill;
+		}
+	}
+	xc->callback(xc->callback_ctx, der, der != NULL ? xc->len : 0, err);
+	return err;
+}
+
+static const br_x509_pkey *
+xp_get_pkey(const br_x509_class *const *ctx, unsigned *usages)
+{
+	x509_peer_context *xc;
+
+	xc = (x509_peer_context *)(void *)ctx;
+	return (*xc->inner)->get_pkey(
+		(const br_x509_class *const *)xc->inner, usages);
+}
+
+const br_x509_class x509_peer_vtable = {
+	sizeof(x509_peer_context),
+	xp_start_chain,
+	xp_start_cert,
+	xp_append,
+	xp_end_cert,
+	xp_end_chain,
+	xp_get_pkey
+};
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _X509_PEER_H_
+#define _X509_PEER_H_
+
+#include "bearssl/bearssl.h"
+
+/*
+ * X.509 "engine" that wraps another one and hands the end-entity
+ * certificate of the chain to a callback once the inner engine has
+ * returned from end_chain (with its error code, 0 if the chain is
+ * valid).
+ *
+ * The handshake code copies each chunk of the Certificate message from
+ * the record payload (eng->hbuf_in) to eng->pad before appending it, so
+ * the chunk is also found just behind hbuf_in. As long as every chunk
+ * since the start of the end-entity certificate came from the same
+ * record, in the same pass over the input buffer, the certificate is
+ * still there in one piece and its DER is handed over without a copy.
+ * Otherwise (the chain spans several records, or the record was larger
+ * than the input buffer), the certificate is found in the spill buffer
+ * if one was given and it is large enough, and the callback gets NULL if
+ * not. Either way the DER is only valid during the callback.
+ */
+typedef struct {
+	const br_x509_class *vtable;
+	const br_x509_class **inner;
+	const br_ssl_engine_context *eng;
+	void (*callback)(void *ctx, const unsigned char *der, size_t len,
+		unsigned err);
+	void *callback_ctx;
+	unsigned char *spill;
+	size_t spill_len;
+	const unsigned char *der;
+	const unsigned char *last;
+	size_t len;
+	size_t expected;
+	int index;
+	int in_place;
+} x509_peer_context;
+
+extern const br_x509_class x509_peer_vtable;
+
+void
+x509_peer_init(x509_peer_context *ctx, const br_x509_class **inner,
+	const br_ssl_engine_context *eng,
+	void (*callback)(void *ctx, const unsigned char *der, size_t len,
+		unsigned err),
+	void *callback_ctx, unsigned char *spill, size_t spill_len);
+
+#endif
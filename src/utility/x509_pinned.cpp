@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "x509_pinned.h"
+
+static const unsigned char OID_RSA_ALGID[] = {
+	0x30, 0x0D, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86,
+	0xF7, 0x0D, 0x01, 0x01, 0x01, 0x05, 0x00
+};
+
+static const unsigned char OID_EC_PUBLIC_KEY[] = {
+	0x06, 0x07, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x02, 0x01
+};
+
+static const unsigned char OID_SECP256R1[] = {
+	0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x03, 0x01, 0x07
+};
+
+static const unsigned char OID_SECP384R1[] = {
+	0x06, 0x05, 0x2B, 0x81, 0x04, 0x00, 0x22
+};
+
+static const unsigned char OID_SECP521R1[] = {
+	0x06, 0x05, 0x2B, 0x81, 0x04, 0x00, 0x23
+};
+
+/*
+ * Length of a DER length field.
+ */
+static size_t
+len_size(size_t len)
+{
+	return (len < 0x80) ? 1 : (len < 0x100) ? 2 : 3;
+}
+
+static void
+hash_header(br_sha256_context *hc, unsigned char tag, size_t len)
+{
+	unsigned char buf[4];
+	size_t n;
+
+	buf[0] = tag;
+	if (len < 0x80) {
+		buf[1] = (unsigned char)len;
+		n = 2;
+	} else if (len < 0x100) {
+		buf[1] = 0x81;
+		buf[2] = (unsigned char)len;
+		n = 3;
+	} else {
+		buf[1] = 0x82;
+		buf[2] = (unsigned char)(len >> 8);
+		buf[3] = (unsigned char)len;
+		n = 4;
+	}
+	br_sha256_update(hc, buf, n);
+}
+
+/*
+ * Unsigned big-endian integer as the contents of a DER INTEGER: leading
+ * zeros are dropped, a zero is added back if the top bit is set.
+ */
+static const unsigned char *
+trim_int(const unsigned char *x, size_t *len, int *pad)
+{
+	size_t n;
+
+	n = *len;
+	while (n > 1 && *x == 0) {
+		x ++;
+		n --;
+	}
+	*pad = (n > 0 && (*x & 0x80)) ? 1 : 0;
+	*len = n;
+	return x;
+}
+
+int
+x509_pinned_spki_hash(const br_x509_pkey *pk, unsigned char hash[32])
+{
+	br_sha256_context hc;
+	unsigned char zero;
+
+	zero = 0;
+	br_sha256_init(&hc);
+	switch (pk->key_type) {
+
+	case BR_KEYTYPE_RSA: {
+		const unsigned char *n, *e;
+		size_t nlen, elen, nint, eint, seq, bits;
+		int npad, epad;
+
+		nlen = pk->key.rsa.nlen;
+		elen = pk->key.rsa.elen;
+		n = trim_int(pk->key.rsa.n, &nlen, &npad);
+		e = trim_int(pk->key.rsa.e, &elen, &epad);
+		nint = nlen + npad;
+		eint = elen + epad;
+		seq = 1 + len_size(nint) + nint + 1 + len_size(eint) + eint;
+		bits = 1 + 1 + len_size(seq) + seq;
+		hash_header(&hc, 0x30, sizeof OID_RSA_ALGID
+			+ 1 + len_size(bits) + bits);
+		br_sha256_update(&hc, OID_RSA_ALGID, sizeof OID_RSA_ALGID);
+		hash_header(&hc, 0x03, bits);
+		br_sha256_update(&hc, &zero, 1);
+		hash_header(&hc, 0x30, seq);
+		hash_header(&hc, 0x02, nint);
+		if (npad) {
+			br_sha256_update(&hc, &zero, 1);
+		}
+		br_sha256_update(&hc, n, nlen);
+		hash_header(&hc, 0x02, eint);
+		if (epad) {
+			br_sha256_update(&hc, &zero, 1);
+		}
+		br_sha256_update(&hc, e, elen);
+		break;
+	}
+
+	case BR_KEYTYPE_EC: {
+		const unsigned char *curve;
+		size_t curve_len, algid, bits;
+
+		switch (pk->key.ec.curve) {
+		case BR_EC_secp256r1:
+			curve = OID_SECP256R1;
+			curve_len = sizeof OID_SECP256R1;
+			break;
+		case BR_EC_secp384r1:
+			curve = OID_SECP384R1;
+			curve_len = sizeof OID_SECP384R1;
+			break;
+		case BR_EC_secp521r1:
+			curve = OID_SECP521R1;
+			curve_len = sizeof OID_SECP521R1;
+			break;
+		default:
+			return 0;
+		}
+		algid = sizeof OID_EC_PUBLIC_KEY + curve_len;
+		bits = 1 + pk->key.ec.qlen;
+		hash_header(&hc, 0x30, 1 + len_size(algid) + algid
+			+ 1 + len_size(bits) + bits);
+		hash_header(&hc, 0x30, algid);
+		br_sha256_update(&hc, OID_EC_PUBLIC_KEY, sizeof OID_EC_PUBLIC_KEY);
+		br_sha256_update(&hc, curve, curve_len);
+		hash_header(&hc, 0x03, bits);
+		br_sha256_update(&hc, &zero, 1);
+		br_sha256_update(&hc, pk->key.ec.q, pk->key.ec.qlen);
+		break;
+	}
+
+	default:
+		return 0;
+	}
+	br_sha256_out(&hc, hash);
+	return 1;
+}
+
+void
+x509_pinned_init(x509_pinned_context *ctx, const unsigned char pin[32])
+{
+	ctx->vtable = &x509_pinned_vtable;
+	memcpy(ctx->pin, pin, sizeof ctx->pin);
+	ctx->cert_num = 0;
+	ctx->err = BR_ERR_X509_NOT_TRUSTED;
+}
+
+static void
+xp_start_chain(const br_x509_class **ctx, const char *server_name)
+{
+	x509_pinned_context *xc;
+
+	(void)server_name;
+	xc = (x509_pinned_context *)(void *)ctx;
+	xc->cert_num = 0;
+	xc->err = BR_ERR_X509_NOT_TRUSTED;
+}
+
+static void
+xp_start_cert(const br_x509_class **ctx, uint32_t length)
+{
+	x509_pinned_context *xc;
+
+	(void)length;
+	xc = (x509_pinned_context *)(void *)ctx;
+	if (xc->cert_num == 0) {
+		br_x509_decoder_init(&xc->decoder, 0, 0);
+	}
+}
+
+static void
+xp_append(const br_x509_class **ctx, const unsigned char *buf, size_t len)
+{
+	x509_pinned_context *xc;
+
+	xc = (x509_pinned_context *)(void *)ctx;
+	if (xc->cert_num == 0) {
+		br_x509_decoder_push(&xc->decoder, buf, len);
+	}
+}
+
+static void
+xp_end_cert(const br_x509_class **ctx)
+{
+	x509_pinned_context *xc;
+	const br_x509_pkey *pk;
+	unsigned char hash[32];
+
+	xc = (x509_pinned_context *)(void *)ctx;
+	if (xc->cert_num ++ != 0) {
+		return;
+	}
+	pk = br_x509_decoder_get_pkey(&xc->decoder);
+	if (pk == NULL) {
+		xc->err = br_x509_decoder_last_error(&xc->decoder);
+		return;
+	}
+	if (x509_pinned_spki_hash(pk, hash)
+		&& memcmp(hash, xc->pin, sizeof hash) == 0)
+	{
+		xc->err = 0;
+	}
+}
+
+static unsigned
+xp_end_chain(const br_x509_class **ctx)
+{
+	x509_pinned_context *xc;
+
+	xc = (x509_pinned_context *)(void *)ctx;
+	return (unsigned)xc->err;
+}
+
+static const br_x509_pkey *
+xp_get_pkey(const br_x509_class *const *ctx, unsigned *usages)
+{
+	x509_pinned_context *xc;
+
+	xc = (x509_pinned_context *)(void *)ctx;
+	if (xc->err != 0) {
+		return NULL;
+	}
+	if (usages != NULL) {
+		*usages = BR_KEYTYPE_KEYX | BR_KEYTYPE_SIGN;
+	}
+	return br_x509_decoder_get_pkey(&xc->decoder);
+}
+
+const br_x509_class x509_pinned_vtable = {
+	sizeof(x509_pinned_context),
+	xp_start_chain,
+	xp_start_cert,
+	xp_append,
+	xp_end_cert,
+	xp_end_chain,
+	xp_get_pkey
+};
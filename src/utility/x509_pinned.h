@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef _X509_PINNED_H_
+#define _X509_PINNED_H_
+
+#include "bearssl/bearssl.h"
+
+/*
+ * X.509 "engine" that accepts the server only if the SHA-256 hash of the
+ * SubjectPublicKeyInfo of its end-entity certificate matches a pin (the
+ * value of "pin-sha256" in RFC 7469). The rest of the chain is ignored and
+ * no signature is verified.
+ */
+typedef struct {
+	const br_x509_class *vtable;
+	br_x509_decoder_context decoder;
+	unsigned char pin[32];
+	unsigned cert_num;
+	int err;
+} x509_pinned_context;
+
+extern const br_x509_class x509_pinned_vtable;
+
+void
+x509_pinned_init(x509_pinned_context *ctx, const unsigned char pin[32]);
+
+/*
+ * Compute the pin of a public key, as the SHA-256 hash of its DER
+ * encoded SubjectPublicKeyInfo. Returns 0 if the key can't be encoded.
+ */
+int
+x509_pinned_spki_hash(const br_x509_pkey *pk, unsigned char hash[32]);
+
+#endif
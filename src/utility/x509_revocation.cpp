@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "x509_revocation.h"
+
+/*
+ * Elements of the certificate that are read, in order. The serial number
+ * and the issuer are hashed, the rest is skipped.
+ */
+#define STEP_CERT      0
+#define STEP_TBS       1
+#define STEP_VERSION   2
+#define STEP_SERIAL    3
+#define STEP_SIGALG    4
+#define STEP_ISSUER    5
+#define STEP_DONE      6
+
+void
+x509_revocation_init(x509_revocation_context *ctx, const br_x509_class **inner,
+	x509_revocation_check check, void *check_ctx, int revoked_err)
+{
+	ctx->vtable = &x509_revocation_vtable;
+	ctx->inner = inner;
+	ctx->check = check;
+	ctx->check_ctx = check_ctx;
+	ctx->revoked_err = revoked_err;
+	ctx->step = STEP_DONE;
+	ctx->err = 0;
+}
+
+static void
+content_done(x509_revocation_context *xc)
+{
+	unsigned char key[32];
+
+	xc->in_content = 0;
+	switch (xc->step) {
+	case STEP_VERSION:
+		xc->step = STEP_SERIAL;
+		break;
+	case STEP_SERIAL:
+		xc->step = STEP_SIGALG;
+		break;
+	case STEP_SIGALG:
+		xc->step = STEP_ISSUER;
+		break;
+	case STEP_ISSUER:
+		xc->step = STEP_DONE;
+		br_sha256_out(&xc->hc, key);
+		if (xc->check(xc->check_ctx, key)) {
+			xc->err = xc->revoked_err;
+		}
+		break;
+	}
+}
+
+static void
+header_done(x509_revocation_context *xc, unsigned tag, uint32_t len)
+{
+	switch (xc->step) {
+	case STEP_CERT:
+	case STEP_TBS:
+		if (tag != 0x30) {
+			xc->step = STEP_DONE;
+			return;
+		}
+		/* descend into the SEQUENCE */
+		xc->step ++;
+		return;
+	case STEP_VERSION:
+		if (tag == 0x02) {
+			xc->step = STEP_SERIAL;
+		} else if (tag != 0xA0) {
+			xc->step = STEP_DONE;
+			return;
+		}
+		break;
+	case STEP_SERIAL:
+		if (tag != 0x02) {
+			xc->step = STEP_DONE;
+			return;
+		}
+		break;
+	case STEP_SIGALG:
+	case STEP_ISSUER:
+		if (tag != 0x30) {
+			xc->step = STEP_DONE;
+			return;
+		}
+		if (xc->step == STEP_ISSUER) {
+			br_sha256_update(&xc->hc, xc->hdr, xc->hdr_len);
+		}
+		break;
+	}
+	xc->remaining = len;
+	xc->in_content = 1;
+	if (len == 0) {
+		content_done(xc);
+	}
+}
+
+static void
+parse(x509_revocation_context *xc, const unsigned char *buf, size_t len)
+{
+	while (len > 0 && xc->step != STEP_DONE) {
+		size_t clen;
+
+		if (!xc->in_content) {
+			unsigned n;
+
+			xc->hdr[xc->hdr_len ++] = *buf ++;
+			len --;
+			if (xc->hdr_len < 2) {
+				continue;
+			}
+			n = (xc->hdr[1] & 0x80) ? (xc->hdr[1] & 0x7F) : 0;
+			if (n > 4 || (xc->hdr[1] == 0x80)) {
+				xc->step = STEP_DONE;
+				return;
+			}
+			if (xc->hdr_len == 2 + n) {
+				uint32_t elen;
+				size_t u;
+
+				if (n == 0) {
+					elen = xc->hdr[1];
+				} else {
+					elen = 0;
+					for (u = 0; u < n; u ++) {
+						elen = (elen << 8) | xc->hdr[2 + u];
+					}
+				}
+				header_done(xc, xc->hdr[0], elen);
+				xc->hdr_len = 0;
+			}
+			continue;
+		}
+		clen = len < xc->remaining ? len : xc->remaining;
+		if (xc->step == STEP_SERIAL || xc->step == STEP_ISSUER) {
+			br_sha256_update(&xc->hc, buf, clen);
+		}
+		buf += clen;
+		len -= clen;
+		xc->remaining -= clen;
+		if (xc->remaining == 0) {
+			content_done(xc);
+		}
+	}
+}
+
+static void
+xr_start_chain(const br_x509_class **ctx, const char *server_name)
+{
+	x509_revocation_context *xc;
+
+	xc = (x509_revocation_context *)(void *)ctx;
+	xc->err = 0;
+	(*xc->inner)->start_chain(xc->inner, server_name);
+}
+
+static void
+xr_start_cert(const br_x509_class **ctx, uint32_t length)
+{
+	x509_revocation_context *xc;
+
+	xc = (x509_revocation_context *)(void *)ctx;
+	if (xc->err != 0) {
+		return;
+	}
+	br_sha256_init(&xc->hc);
+	xc->step = STEP_CERT;
+	xc->hdr_len = 0;
+	xc->in_content = 0;
+	(*xc->inner)->start_cert(xc->inner, length);
+}
+
+static void
+xr_append(const br_x509_class **ctx, const unsigned char *buf, size_t len)
+{
+	x509_revocation_context *xc;
+
+	xc = (x509_revocation_context *)(void *)ctx;
+	if (xc->err != 0) {
+		return;
+	}
+	parse(xc, buf, len);
+	if (xc->err != 0) {
+		return;
+	}
+	(*xc->inner)->append(xc->inner, buf, len);
+}
+
+static void
+xr_end_cert(const br_x509_class **ctx)
+{
+	x509_revocation_context *xc;
+
+	xc = (x509_revocation_context *)(void *)ctx;
+	if (xc->err != 0) {
+		return;
+	}
+	(*xc->inner)->end_cert(xc->inner);
+}
+
+static unsigned
+xr_end_chain(const br_x509_class **ctx)
+{
+	x509_revocation_context *xc;
+
+	xc = (x509_revocation_context *)(void *)ctx;
+	if (xc->err != 0) {
+		return (unsigned)xc->err;
+	}
+	return (*xc->inner)->end_chain(xc->inner);
+}
+
+static const br_x509_pkey *
+xr_get_pkey(const br_x509_class *const *ctx, unsigned *usages)
+{
+	x509_revocation_context *xc;
+
+	xc = (x509_revocation_context *)(void *)ctx;
+	if (xc->err != 0) {
+		return NULL;
+	}
+	return (*xc->inner)->get_pkey(
+		(const br_x509_class *const *)xc->inner, usages);
+}
+
+const br_x509_class x509_revocation_vtable = {
+	sizeof(x509_revocation_context),
+	xr_start_chain,
+	xr_start_cert,
+	xr_append,
+	xr_end_cert,
+	xr_end_chain,
+	xr_get_pkey
+};
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _X509_REVOCATION_H_
+#define _X509_REVOCATION_H_
+
+#include "bearssl/bearssl.h"
+
+/*
+ * Revocation callback: returns non-zero when the certificate identified
+ * by key, the SHA-256 hash of its serial number (the contents of the DER
+ * INTEGER) followed by its DER encoded issuer Name, is revoked.
+ */
+typedef int (*x509_revocation_check)(void *ctx, const unsigned char key[32]);
+
+/*
+ * X.509 "engine" that wraps another one and rejects the chain with err
+ * as soon as one of its certificates is reported as revoked. The serial
+ * number and issuer are picked from the start of each certificate as it
+ * streams by, nothing is buffered.
+ */
+typedef struct {
+	const br_x509_class *vtable;
+	const br_x509_class **inner;
+	x509_revocation_check check;
+	void *check_ctx;
+	int revoked_err;
+	br_sha256_context hc;
+	unsigned step;
+	unsigned char hdr[6];
+	size_t hdr_len;
+	uint32_t remaining;
+	int in_content;
+	int err;
+} x509_revocation_context;
+
+extern const br_x509_class x509_revocation_vtable;
+
+void
+x509_revocation_init(x509_revocation_context *ctx, const br_x509_class **inner,
+	x509_revocation_check check, void *check_ctx, int revoked_err);
+
+#endif
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "x509_timing.h"
+
+void
+x509_timing_init(x509_timing_context *ctx, const br_x509_class **inner,
+	unsigned long (*clock)(void))
+{
+	ctx->vtable = &x509_timing_vtable;
+	ctx->inner = inner;
+	ctx->clock = clock;
+	ctx->started = 0;
+	ctx->ended = 0;
+}
+
+static void
+xt_start_chain(const br_x509_class **ctx, const char *server_name)
+{
+	x509_timing_context *xc;
+
+	xc = (x509_timing_context *)(void *)ctx;
+	xc->chain_start = xc->clock();
+	xc->started = 1;
+	xc->ended = 0;
+	(*xc->inner)->start_chain(xc->inner, server_name);
+}
+
+static void
+xt_start_cert(const br_x509_class **ctx, uint32_t length)
+{
+	x509_timing_context *xc;
+
+	xc = (x509_timing_context *)(void *)ctx;
+	(*xc->inner)->start_cert(xc->inner, length);
+}
+
+static void
+xt_append(const br_x509_class **ctx, const unsigned char *buf, size_t len)
+{
+	x509_timing_context *xc;
+
+	xc = (x509_timing_context *)(void *)ctx;
+	(*xc->inner)->append(xc->inner, buf, len);
+}
+
+static void
+xt_end_cert(const br_x509_class **ctx)
+{
+	x509_timing_context *xc;
+
+	xc = (x509_timing_context *)(void *)ctx;
+	(*xc->inner)->end_cert(xc->inner);
+}
+
+static unsigned
+xt_end_chain(const br_x509_class **ctx)
+{
+	x509_timing_context *xc;
+	unsigned err;
+
+	xc = (x509_timing_context *)(void *)ctx;
+	err = (*xc->inner)->end_chain(xc->inner);
+	if (err == 0) {
+		xc->chain_end = xc->clock();
+		xc->ended = 1;
+	}
+	return err;
+}
+
+static const br_x509_pkey *
+xt_get_pkey(const br_x509_class *const *ctx, unsigned *usages)
+{
+	x509_timing_context *xc;
+
+	xc = (x509_timing_context *)(void *)ctx;
+	return (*xc->inner)->get_pkey(
+		(const br_x509_class *const *)xc->inner, usages);
+}
+
+const br_x509_class x509_timing_vtable = {
+	sizeof(x509_timing_context),
+	xt_start_chain,
+	xt_start_cert,
+	xt_append,
+	xt_end_cert,
+	xt_end_chain,
+	xt_get_pkey
+};
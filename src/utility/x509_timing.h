@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026 Arduino SA. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining 
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be 
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _X509_TIMING_H_
+#define _X509_TIMING_H_
+
+#include "bearssl/bearssl.h"
+
+/*
+ * X.509 "engine" that wraps another one and records, with the given
+ * clock, when the server's Certificate message starts (start_chain) and
+ * when the inner engine has validated the chain (end_chain returned).
+ * Everything else is passed through unchanged.
+ */
+typedef struct {
+	const br_x509_class *vtable;
+	const br_x509_class **inner;
+	unsigned long (*clock)(void);
+	unsigned long chain_start;
+	unsigned long chain_end;
+	int started;
+	int ended;
+} x509_timing_context;
+
+extern const br_x509_class x509_timing_vtable;
+
+void
+x509_timing_init(x509_timing_context *ctx, const br_x509_class **inner,
+	unsigned long (*clock)(void));
+
+#endif